@@ -753,6 +753,10 @@ def _com_google_absl():
         name = "abseil_base",
         actual = "@com_google_absl//absl/base:base",
     )
+    native.bind(
+        name = "abseil_bits",
+        actual = "@com_google_absl//absl/numeric:bits",
+    )
 
     # Bind for grpc.
     native.bind(
@@ -147,6 +147,11 @@ public:
   virtual SysCallPtrResult mmap(void* addr, size_t length, int prot, int flags, int fd,
                                 off_t offset) PURE;
 
+  /**
+   * @see man 2 munmap
+   */
+  virtual SysCallIntResult munmap(void* addr, size_t length) PURE;
+
   /**
    * @see man 2 stat
    */
@@ -219,6 +224,11 @@ public:
    */
   virtual SysCallIntResult unlink(const char* pathname) const PURE;
 
+  /**
+   * @see man 2 mkdir
+   */
+  virtual SysCallIntResult mkdir(const char* pathname, mode_t mode) const PURE;
+
   /**
    * @see man 2 unlink
    */
@@ -563,6 +563,13 @@ public:
    * @return the number of streams reset
    */
   virtual uint64_t resetAccountsGivenPressure(float pressure) PURE;
+
+  /**
+   * @return the aggregate balance across all accounts created by this factory. This gives an
+   *         O(1) per-worker view of account-tracked buffer memory, which individual per-buffer
+   *         watermarks cannot provide. Factories that do not track accounts return 0.
+   */
+  virtual uint64_t totalAccountBalance() const { return 0; }
 };
 
 using WatermarkFactoryPtr = std::unique_ptr<WatermarkFactory>;
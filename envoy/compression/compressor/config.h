@@ -14,7 +14,7 @@ public:
 
   virtual CompressorFactoryPtr
   createCompressorFactoryFromProto(const Protobuf::Message& config,
-                                   Server::Configuration::FactoryContext& context) PURE;
+                                   Server::Configuration::ServerFactoryContext& context) PURE;
 
   std::string category() const override { return "envoy.compression.compressor"; }
 };
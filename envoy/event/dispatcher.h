@@ -37,7 +37,10 @@ namespace Event {
  */
 #define ALL_DISPATCHER_STATS(HISTOGRAM)                                                            \
   HISTOGRAM(loop_duration_us, Microseconds)                                                        \
-  HISTOGRAM(poll_delay_us, Microseconds)
+  HISTOGRAM(poll_delay_us, Microseconds)                                                           \
+  HISTOGRAM(post_queue_depth, Unspecified)                                                         \
+  HISTOGRAM(post_wait_us, Microseconds)                                                            \
+  HISTOGRAM(deferred_delete_backlog, Unspecified)
 
 /**
  * Struct definition for all dispatcher stats. @see stats_macros.h
@@ -132,6 +135,16 @@ public:
    */
   virtual Event::TimerPtr createTimer(TimerCb cb) PURE;
 
+  /**
+   * Allocates a coarse timer. Coarse timers are multiplexed onto a per-dispatcher timing wheel
+   * driven by a single underlying timer, making arm and cancel O(1) regardless of how many are
+   * pending; in exchange a coarse timer may fire up to one wheel tick late. Intended for
+   * high-volume deadline timers such as request timeouts where sub-tick precision does not
+   * matter. @see Timer for docs on how to use the timer.
+   * @param cb supplies the callback to invoke when the timer fires.
+   */
+  virtual Event::TimerPtr createCoarseTimer(TimerCb cb) PURE;
+
   /**
    * Allocates a scaled timer. @see Timer for docs on how to use the timer.
    * @param timer_type the type of timer to create.
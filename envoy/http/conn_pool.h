@@ -119,6 +119,15 @@ public:
    * @return absl::string_view a protocol description for logging.
    */
   virtual absl::string_view protocolDescription() const PURE;
+
+  /**
+   * Registers callbacks to be told as connections in the pool become usable for requests or
+   * start draining. The callbacks must outlive the pool.
+   * @param hash_key the hash key the pool was created under, passed back on each callback.
+   * @param callbacks the callbacks to fire.
+   */
+  virtual void setConnectionLifetimeCallbacks(std::vector<uint8_t> hash_key,
+                                              ConnectionLifetimeCallbacks& callbacks) PURE;
 };
 
 using InstancePtr = std::unique_ptr<Instance>;
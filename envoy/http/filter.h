@@ -780,6 +780,17 @@ public:
    */
   virtual void onMatchCallback(const Matcher::Action&) {}
 
+  /**
+   * Filters that neither observe nor modify body data or trailers may override this to return
+   * true. The filter manager then skips the filter entirely during data and trailer iteration,
+   * exactly as if the filter had been invoked and returned Continue. Such a filter will not
+   * receive decodeData()/encodeData(), decodeTrailers()/encodeTrailers() or, for streams that
+   * end with data or trailers, the corresponding decodeComplete()/encodeComplete() calls.
+   * Headers and metadata are delivered as usual. The returned value must be constant for the
+   * lifetime of the filter; it is read once when the filter is added to the filter chain.
+   */
+  virtual bool passThroughBodyAndTrailers() const { return false; }
+
   struct LocalReplyData {
     // The error code which (barring reset) will be sent to the client.
     Http::Code code_;
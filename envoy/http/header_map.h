@@ -15,6 +15,7 @@
 #include "envoy/http/header_formatter.h"
 #include "envoy/tracing/trace_context.h"
 
+#include "source/common/common/ascii.h"
 #include "source/common/common/assert.h"
 #include "source/common/common/hash.h"
 #include "source/common/common/macros.h"
@@ -30,19 +31,7 @@ namespace Http {
 static inline bool validHeaderString(absl::string_view s) {
   // If you modify this list of illegal embedded characters you will probably
   // want to change header_map_fuzz_impl_test at the same time.
-  for (const char c : s) {
-    switch (c) {
-    case '\0':
-      FALLTHRU;
-    case '\r':
-      FALLTHRU;
-    case '\n':
-      return false;
-    default:
-      continue;
-    }
-  }
-  return true;
+  return !Ascii::containsEmbeddedNulCrLf(s);
 }
 
 /**
@@ -85,9 +74,7 @@ public:
   operator absl::string_view() const { return string_; }
 
 private:
-  void lower() {
-    std::transform(string_.begin(), string_.end(), string_.begin(), absl::ascii_tolower);
-  }
+  void lower() { Ascii::toLowerInPlace(string_.data(), string_.size()); }
   bool valid() const { return validHeaderString(string_); }
 
   std::string string_;
@@ -449,6 +436,14 @@ public:
    */
   virtual uint64_t byteSize() const PURE;
 
+  /**
+   * @return uint64_t the byte size of the largest single header entry (key plus value) the map
+   * has held. This is a high-water mark maintained incrementally as entries are added, appended
+   * to, or overwritten; it is not decreased by removals, so it can be read in O(1) after the
+   * fact (e.g. for oversized-header detection). clear() resets it.
+   */
+  virtual uint64_t maxEntryByteSize() const PURE;
+
   /**
    * This is a wrapper for the return result from get(). It avoids a copy when translating from
    * non-const HeaderEntry to const HeaderEntry and only provides const access to the result.
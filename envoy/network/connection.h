@@ -14,6 +14,7 @@
 #include "envoy/network/listen_socket.h"
 #include "envoy/network/socket.h"
 #include "envoy/ssl/connection.h"
+#include "envoy/stats/histogram.h"
 #include "envoy/stream_info/stream_info.h"
 
 namespace Envoy {
@@ -102,6 +103,10 @@ public:
     Stats::Counter* bind_errors_;
     // Optional counter. Delayed close timeouts will not be tracked if this is nullptr.
     Stats::Counter* delayed_close_timeouts_;
+    // Optional histogram recording the time in microseconds this connection spent dispatching
+    // read data through its filter chain per socket read event. Makes connections that dominate
+    // a worker (e.g. many tiny HTTP/2 frames) visible. Not recorded if this is nullptr.
+    Stats::Histogram* read_dispatch_us_{nullptr};
   };
 
   ~Connection() override = default;
@@ -272,6 +272,13 @@ public:
    * Called when a new connection is rejected.
    */
   virtual void onReject(RejectCause cause) PURE;
+
+  /**
+   * Called after the listener finished draining its accept queue for one socket event, before
+   * returning to the event loop.
+   * @param connections_accepted the number of connections handed to onAccept() during the event.
+   */
+  virtual void recordConnectionsAcceptedOnSocketEvent(uint32_t connections_accepted) PURE;
 };
 
 /**
@@ -528,6 +528,12 @@ public:
    * @return true if the trace span should be sampled.
    */
   virtual bool traceSampled() const PURE;
+
+  /**
+   * @return the maximum number of request body bytes to mirror, if configured. Body bytes past
+   *         the limit are dropped from the mirrored request only.
+   */
+  virtual absl::optional<uint64_t> maxMirroredBodyBytes() const PURE;
 };
 
 using ShadowPolicyPtr = std::shared_ptr<ShadowPolicy>;
@@ -1215,6 +1221,21 @@ public:
       const std::string& filter_name,
       std::function<void(const Router::RouteSpecificFilterConfig&)> cb) const PURE;
 
+  /**
+   * Check whether the filter is disabled on this route, up along the config hierarchy
+   * (Route --> VirtualHost --> RouteConfiguration), most specific level wins. This is set by
+   * wrapping the filter's per-filter config in an
+   * :ref:`FilterConfig <envoy_v3_api_msg_config.route.v3.FilterConfig>` message. A default
+   * implementation is provided so route implementations without per-filter configs need not
+   * override.
+   * @param config_name the name of the filter config entry in the filter chain.
+   * @return absl::nullopt if no per-filter config entry exists at any level, otherwise whether
+   *         the most specific entry disables the filter.
+   */
+  virtual absl::optional<bool> filterDisabled(absl::string_view /*config_name*/) const {
+    return absl::nullopt;
+  }
+
   /**
    * @return const envoy::config::core::v3::Metadata& return the metadata provided in the config for
    * this route.
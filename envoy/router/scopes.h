@@ -50,14 +50,20 @@ public:
   bool operator!=(const ScopeKey& other) const;
   bool operator==(const ScopeKey& other) const;
 
+  // Combines the running key hash with a new fragment hash. Exposed so scope key hashes can be
+  // computed fragment-by-fragment on the request path without materializing a ScopeKey. The byte
+  // layout matches the historical std::stringbuf based implementation, so hashes stored at config
+  // load remain comparable.
+  static uint64_t combineHash(uint64_t key_hash, uint64_t fragment_hash) {
+    const uint64_t buffer[2] = {key_hash, fragment_hash};
+    return HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(buffer), sizeof(buffer)));
+  }
+
 private:
   // Update the key's hash with the new fragment hash.
   void updateHash(const ScopeKeyFragmentBase& fragment) {
-    std::stringbuf buffer;
-    buffer.sputn(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
-    const auto& fragment_hash = fragment.hash();
-    buffer.sputn(reinterpret_cast<const char*>(&fragment_hash), sizeof(fragment_hash));
-    hash_ = HashUtil::xxHash64(buffer.str());
+    hash_ = combineHash(hash_, fragment.hash());
   }
 
   uint64_t hash_{0};
@@ -61,7 +61,8 @@ public:
     virtual const std::string& name() const PURE;
   };
 
-  using OverrideLayerConstPtr = std::unique_ptr<const OverrideLayer>;
+  // Layers are immutable once constructed and may be shared by several snapshots.
+  using OverrideLayerConstPtr = std::shared_ptr<const OverrideLayer>;
 
   /**
    * Returns true if a deprecated feature is allowed.
@@ -82,6 +82,19 @@ public:
   virtual void forEachGauge(SizeFn f_size, StatFn<Gauge> f_stat) const PURE;
   virtual void forEachTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const PURE;
 
+  /**
+   * Iterate over all metric families -- groups of stats sharing a
+   * tag-extracted name -- in increasing symbol-table order of the family name,
+   * with each family's stats ordered by their full name. The index backing
+   * this iteration is maintained incrementally as stats are created and
+   * destroyed, so no sorting occurs during the iteration itself. Unlike
+   * iterate(), each stat is visited exactly once. The same deadlock caveat as
+   * forEachCounter applies: the callback must not create or delete stats.
+   */
+  virtual void forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const PURE;
+  virtual void forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const PURE;
+  virtual void forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const PURE;
+
   /**
    * Iterate over all stats that need to be flushed to sinks. Note, that implementations can
    * potentially hold on to a mutex that will deadlock if the passed in functors try to create
@@ -24,6 +24,13 @@ public:
    * @return The buckets for the histogram. Each value is an upper bound of a bucket.
    */
   virtual ConstSupportedBuckets& buckets(absl::string_view stat_name) const PURE;
+
+  /**
+   * @return whether histograms should use the fixed-layout backend, which
+   * trades some precision for constant per-histogram memory, allocation-free
+   * recording and faster merges.
+   */
+  virtual bool useFixedLayout() const PURE;
 };
 
 using HistogramSettingsConstPtr = std::unique_ptr<const HistogramSettings>;
@@ -46,6 +46,30 @@ public:
    * @return the time in UTC since epoch when the snapshot was created.
    */
   virtual SystemTime snapshotTime() const PURE;
+
+  // Sinks that re-transmit every metric each interval can instead consume the
+  // changed* views below, which contain only the metrics modified since the
+  // previous flush. Periodically the server produces a full-sync snapshot
+  // whose changed* views contain every metric, so sinks that missed an update
+  // (e.g. across a reconnect) converge without any extra bookkeeping.
+
+  /**
+   * @return the subset of counters() whose delta is non-zero, or all counters
+   *         on a full-sync snapshot.
+   */
+  virtual const std::vector<CounterSnapshot>& changedCounters() PURE;
+
+  /**
+   * @return the subset of gauges() modified since the previous flush, or all
+   *         gauges on a full-sync snapshot.
+   */
+  virtual const std::vector<std::reference_wrapper<const Gauge>>& changedGauges() PURE;
+
+  /**
+   * @return the subset of textReadouts() modified since the previous flush, or
+   *         all text readouts on a full-sync snapshot.
+   */
+  virtual const std::vector<std::reference_wrapper<const TextReadout>>& changedTextReadouts() PURE;
 };
 
 /**
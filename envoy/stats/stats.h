@@ -96,11 +96,13 @@ public:
    * Flags:
    * Used: used by all stats types to figure out whether they have been used.
    * Logic...: used by gauges to cache how they should be combined with a parent's value.
+   * Changed: used by gauges and text readouts to track modification since the last flush.
    */
   struct Flags {
     static constexpr uint8_t Used = 0x01;
     static constexpr uint8_t LogicAccumulate = 0x02;
     static constexpr uint8_t NeverImport = 0x04;
+    static constexpr uint8_t Changed = 0x08;
   };
   virtual SymbolTable& symbolTable() PURE;
   virtual const SymbolTable& constSymbolTable() const PURE;
@@ -168,6 +170,13 @@ public:
    * @param import_mode the new import mode.
    */
   virtual void mergeImportMode(ImportMode import_mode) PURE;
+
+  /**
+   * Returns whether the gauge has been modified since the last call, and clears
+   * the mark. Analogous to Counter::latch(), this lets the flush path hand
+   * sinks only the gauges that changed since the previous flush.
+   */
+  virtual bool latchChanged() PURE;
 };
 
 using GaugeSharedPtr = RefcountPtr<Gauge>;
@@ -195,6 +204,12 @@ public:
    * @return the copy of this TextReadout value.
    */
   virtual std::string value() const PURE;
+
+  /**
+   * Returns whether the text readout has been set since the last call, and
+   * clears the mark. See Gauge::latchChanged().
+   */
+  virtual bool latchChanged() PURE;
 };
 
 using TextReadoutSharedPtr = RefcountPtr<TextReadout>;
@@ -209,5 +224,17 @@ using SizeFn = std::function<void(std::size_t)>;
  */
 template <typename Stat> using StatFn = std::function<void(Stat&)>;
 
+/**
+ * Callback invoked for each metric family -- the set of stats sharing a
+ * tag-extracted name -- during family iteration. Returning false stops the
+ * iteration. The stats vector holds references that remain valid after the
+ * callback returns; the tag_extracted_name references storage owned by one of
+ * the stats, so it must not be retained beyond the lifetime of those
+ * references.
+ */
+template <typename Stat>
+using FamilyIterateFn =
+    std::function<bool(StatName tag_extracted_name, const std::vector<RefcountPtr<Stat>>& stats)>;
+
 } // namespace Stats
 } // namespace Envoy
@@ -152,6 +152,22 @@ public:
   virtual bool iterate(const IterateFn<Histogram>& fn) const PURE;
   virtual bool iterate(const IterateFn<TextReadout>& fn) const PURE;
 
+  /**
+   * Iterate over all metric families -- groups of stats sharing a
+   * tag-extracted name -- in increasing symbol-table order of the family name,
+   * with each family's stats ordered by their full name. The index backing
+   * this iteration is maintained incrementally as stats are created and
+   * destroyed, so no per-call grouping or sorting occurs; this is the
+   * preferred way to render family-ordered output such as the Prometheus
+   * exposition format. Unlike iterate(), each stat is visited exactly once
+   * even if it appears in overlapping scopes. The deadlock caveat from
+   * forEachCounter applies: the callback must not create or delete stats.
+   */
+  virtual void forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const PURE;
+  virtual void forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const PURE;
+  virtual void forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const PURE;
+  virtual void forEachHistogramFamily(const FamilyIterateFn<ParentHistogram>& fn) const PURE;
+
   // Delegate some methods to the root scope; these are exposed to make it more
   // convenient to use stats_macros.h. We may consider dropping them if desired,
   // when we resolve #24007 or in the next follow-up.
@@ -144,6 +144,13 @@ public:
    * to secure mode. Implemented only by start_tls transport socket.
    */
   virtual bool startUpstreamSecureTransport() PURE;
+
+  /**
+   * @return the upstream connection when this upstream is a plain TCP connection, or nullptr for
+   *         tunneling upstreams. Used by optimizations that need direct socket access, such as
+   *         the TcpProxy splice relay.
+   */
+  virtual Network::Connection* connection() { return nullptr; }
 };
 
 using GenericConnPoolPtr = std::unique_ptr<GenericConnPool>;
@@ -56,6 +56,9 @@ using ThreadPtr = std::unique_ptr<Thread>;
 // Options specified during thread creation.
 struct Options {
   std::string name_; // A name supplied for the thread. On Linux this is limited to 15 chars.
+  // If non-negative, the CPU the thread should be pinned to. Best effort: platforms without
+  // thread affinity support ignore this.
+  int32_t cpu_{-1};
 };
 
 using OptionsOptConstRef = const absl::optional<Options>&;
@@ -656,6 +656,7 @@ public:
   COUNTER(upstream_cx_none_healthy)                                                                \
   COUNTER(upstream_cx_overflow)                                                                    \
   COUNTER(upstream_cx_pool_overflow)                                                               \
+  COUNTER(upstream_cx_preconnect_predictive)                                                       \
   COUNTER(upstream_cx_protocol_error)                                                              \
   COUNTER(upstream_cx_rx_bytes_total)                                                              \
   COUNTER(upstream_cx_total)                                                                       \
@@ -674,6 +675,8 @@ public:
   COUNTER(upstream_rq_pending_overflow)                                                            \
   COUNTER(upstream_rq_pending_total)                                                               \
   COUNTER(upstream_rq_0rtt)                                                                        \
+  COUNTER(upstream_rq_hedge_abandoned)                                                             \
+  COUNTER(upstream_rq_hedge_attempted)                                                             \
   COUNTER(upstream_rq_per_try_timeout)                                                             \
   COUNTER(upstream_rq_per_try_idle_timeout)                                                        \
   COUNTER(upstream_rq_retry)                                                                       \
@@ -768,8 +771,9 @@ MAKE_STATS_STRUCT(ClusterLbStats, ClusterLbStatNames, ALL_CLUSTER_LB_STATS);
 MAKE_STAT_NAMES_STRUCT(ClusterTrafficStatNames, ALL_CLUSTER_TRAFFIC_STATS);
 MAKE_STATS_STRUCT(ClusterTrafficStats, ClusterTrafficStatNames, ALL_CLUSTER_TRAFFIC_STATS);
 /*
- * NOTE: LazyClusterTrafficStats for now is an alias of "std::unique_ptr<ClusterTrafficStats>",
- * this is to make way for future lazy-init on trafficStats(). See
+ * NOTE: LazyClusterTrafficStats is an alias of "std::unique_ptr<ClusterTrafficStats>" so that
+ * trafficStats() can defer allocation until first use (enabled via
+ * envoy.reloadable_features.deferred_cluster_traffic_stats). See
  * https://github.com/envoyproxy/envoy/pull/23921#issuecomment-1335239116 for more context.
  */
 using LazyClusterTrafficStats = std::unique_ptr<ClusterTrafficStats>;
@@ -87,8 +87,9 @@ AccessLogFileImpl::~AccessLogFileImpl() {
 
   // Flush any remaining data. If file was not opened for some reason, skip flushing part.
   if (file_->isOpen()) {
-    if (flush_buffer_.length() > 0) {
-      doWrite(flush_buffer_);
+    moveStripesTo(about_to_write_buffer_);
+    if (about_to_write_buffer_.length() > 0) {
+      doWrite(about_to_write_buffer_);
     }
     const Api::IoCallBoolResult result = file_->close();
     ASSERT(result.return_value_, fmt::format("unable to close file '{}': {}", file_->path(),
@@ -133,9 +134,10 @@ void AccessLogFileImpl::flushThreadFunc() {
     {
       Thread::LockGuard write_lock(write_lock_);
 
-      // flush_event_ can be woken up either by large enough flush_buffer or by timer.
-      // In case it was timer, flush_buffer_ can be empty.
-      while (flush_buffer_.length() == 0 && !flush_thread_exit_ && !reopen_file_) {
+      // flush_event_ can be woken up either by a large enough backlog in the stripes or by timer.
+      // In case it was timer, the stripes can be empty.
+      while (buffered_bytes_.load(std::memory_order_acquire) == 0 && !flush_thread_exit_ &&
+             !reopen_file_) {
         // CondVar::wait() does not throw, so it's safe to pass the mutex rather than the guard.
         flush_event_.wait(write_lock_);
       }
@@ -145,8 +147,7 @@ void AccessLogFileImpl::flushThreadFunc() {
       }
 
       flush_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
-      about_to_write_buffer_.move(flush_buffer_);
-      ASSERT(flush_buffer_.length() == 0);
+      moveStripesTo(about_to_write_buffer_);
     }
 
     // if we failed to reopen before, do it next loop.
@@ -169,44 +170,69 @@ void AccessLogFileImpl::flushThreadFunc() {
 }
 
 void AccessLogFileImpl::flush() {
-  std::unique_lock<Thread::BasicLockable> flush_buffer_lock;
-
-  {
-    Thread::LockGuard write_lock(write_lock_);
-
-    // flush_lock_ must be held while checking this or else it is
-    // possible that flushThreadFunc() has already moved data from
-    // flush_buffer_ to about_to_write_buffer_, has unlocked write_lock_,
-    // but has not yet completed doWrite(). This would allow flush() to
-    // return before the pending data has actually been written to disk.
-    flush_buffer_lock = std::unique_lock<Thread::BasicLockable>(flush_lock_);
-
-    if (flush_buffer_.length() == 0) {
-      return;
-    }
-
-    about_to_write_buffer_.move(flush_buffer_);
-    ASSERT(flush_buffer_.length() == 0);
+  // flush_lock_ must be held while draining the stripes or else it is
+  // possible that flushThreadFunc() has already moved data from
+  // the stripes to about_to_write_buffer_ but has not yet completed
+  // doWrite(). Since the flush thread holds flush_lock_ across doWrite(),
+  // acquiring it here guarantees that flush() does not return before
+  // previously buffered data has actually been written to disk.
+  std::unique_lock<Thread::BasicLockable> flush_buffer_lock(flush_lock_);
+
+  moveStripesTo(about_to_write_buffer_);
+  if (about_to_write_buffer_.length() == 0) {
+    return;
   }
 
   doWrite(about_to_write_buffer_);
 }
 
 void AccessLogFileImpl::write(absl::string_view data) {
-  Thread::LockGuard lock(write_lock_);
-
-  if (flush_thread_ == nullptr) {
-    createFlushStructures();
+  WriteStripe& stripe = stripes_[threadStripeIndex()];
+  {
+    Thread::LockGuard lock(stripe.mutex);
+    stripe.buffer.add(data.data(), data.size());
   }
 
   stats_.write_buffered_.inc();
   stats_.write_total_buffered_.add(data.length());
-  flush_buffer_.add(data.data(), data.size());
-  if (flush_buffer_.length() > MIN_FLUSH_SIZE) {
+  const uint64_t previous_total =
+      buffered_bytes_.fetch_add(data.length(), std::memory_order_acq_rel);
+
+  if (!flush_thread_created_.load(std::memory_order_acquire)) {
+    Thread::LockGuard lock(write_lock_);
+    if (flush_thread_ == nullptr) {
+      createFlushStructures();
+    }
+    flush_thread_created_.store(true, std::memory_order_release);
+    // The new flush thread sees the backlog on its first pass, so no wakeup is needed.
+    return;
+  }
+
+  if (previous_total <= MIN_FLUSH_SIZE && previous_total + data.length() > MIN_FLUSH_SIZE) {
+    // Notify under write_lock_ so the wakeup cannot race with the flush thread's predicate check.
+    // This only happens once per MIN_FLUSH_SIZE of backlog, so writers almost never contend here.
+    Thread::LockGuard lock(write_lock_);
     flush_event_.notifyOne();
   }
 }
 
+void AccessLogFileImpl::moveStripesTo(Buffer::Instance& destination) {
+  for (WriteStripe& stripe : stripes_) {
+    Thread::LockGuard lock(stripe.mutex);
+    const uint64_t length = stripe.buffer.length();
+    if (length > 0) {
+      buffered_bytes_.fetch_sub(length, std::memory_order_acq_rel);
+      destination.move(stripe.buffer);
+    }
+  }
+}
+
+size_t AccessLogFileImpl::threadStripeIndex() {
+  static std::atomic<size_t> next_index{0};
+  static thread_local size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+  return index % NumWriteStripes;
+}
+
 void AccessLogFileImpl::createFlushStructures() {
   flush_thread_ = thread_factory_.createThread([this]() -> void { flushThreadFunc(); },
                                                Thread::Options{"AccessLogFlush"});
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 
 #include "envoy/access_log/access_log.h"
@@ -82,11 +84,28 @@ public:
   void flush() override;
 
 private:
+  // Number of independently locked write buffers. Writers are spread across the stripes by
+  // thread, so workers logging to the same file concurrently rarely contend on a lock, while
+  // all writes from any single thread land in one stripe and keep their relative order.
+  static constexpr size_t NumWriteStripes = 8;
+
+  struct WriteStripe {
+    Thread::MutexBasicLockable mutex;
+    Buffer::OwnedImpl buffer ABSL_GUARDED_BY(mutex);
+  };
+
   void doWrite(Buffer::Instance& buffer);
   void flushThreadFunc();
   Api::IoCallBoolResult open();
   void createFlushStructures();
 
+  // Move all buffered data out of the write stripes into the given buffer.
+  void moveStripesTo(Buffer::Instance& destination);
+
+  // Stripe index for the calling thread. Threads are assigned round-robin on first use, so
+  // distinct workers map to distinct stripes until there are more threads than stripes.
+  static size_t threadStripeIndex();
+
   // return default flags set which used by open
   static Filesystem::FlagSet defaultFlags();
 
@@ -98,7 +117,8 @@ private:
   // These locks are always acquired in the following order if multiple locks are held:
   //    1) write_lock_
   //    2) flush_lock_
-  //    3) file_lock_
+  //    3) WriteStripe::mutex
+  //    4) file_lock_
   Thread::BasicLockable& file_lock_;      // This lock is used only by the flush thread when writing
                                           // to disk. This is used to make sure that file blocks do
                                           // not get interleaved by multiple processes writing to
@@ -109,23 +129,26 @@ private:
                                           // and all other data used during flushing and file
                                           // re-opening.
   Thread::MutexBasicLockable
-      write_lock_; // The lock is used when filling the flush buffer. It allows
-                   // multiple threads to write to the same file at relatively
-                   // high performance. It is always local to the process.
+      write_lock_; // This lock guards creation of the flush thread and pairs with flush_event_ to
+                   // wake it. The log data itself goes through the write stripes below, so writers
+                   // only take this lock on the first write and when crossing MIN_FLUSH_SIZE.
   Thread::ThreadPtr flush_thread_;
   Thread::CondVar flush_event_;
+  std::atomic<bool> flush_thread_created_{};
   std::atomic<bool> flush_thread_exit_{};
   std::atomic<bool> reopen_file_{};
-  Buffer::OwnedImpl
-      flush_buffer_ ABSL_GUARDED_BY(write_lock_); // This buffer is used by multiple threads. It
-                                                  // gets filled and then flushed either when max
-                                                  // size is reached or when a timer fires.
+  std::array<WriteStripe, NumWriteStripes> stripes_; // Buffered log data, filled by writer threads
+                                                     // and drained either when MIN_FLUSH_SIZE is
+                                                     // reached or when a timer fires.
+  std::atomic<uint64_t> buffered_bytes_{}; // Total bytes across all stripes not yet moved to the
+                                           // flush thread; lets writers and the flush thread check
+                                           // the backlog without taking any stripe lock.
   // TODO(jmarantz): this should be ABSL_GUARDED_BY(flush_lock_) but the analysis cannot poke
   // through the std::make_unique assignment. I do not believe it's possible to annotate this
   // properly now due to limitations in the clang thread annotation analysis.
   Buffer::OwnedImpl about_to_write_buffer_; // This buffer is used only by the flush thread. Data
-                                            // is moved from flush_buffer_ under lock, and then
-                                            // the lock is released so that flush_buffer_ can
+                                            // is moved from the stripes under lock, and then
+                                            // the locks are released so that the stripes can
                                             // continue to fill. This buffer is then used for the
                                             // final write to disk.
   Event::TimerPtr flush_timer_;
@@ -203,6 +203,11 @@ SysCallPtrResult OsSysCallsImpl::mmap(void* addr, size_t length, int prot, int f
   return {rc, rc != MAP_FAILED ? 0 : errno};
 }
 
+SysCallIntResult OsSysCallsImpl::munmap(void* addr, size_t length) {
+  const int rc = ::munmap(addr, length);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
 SysCallIntResult OsSysCallsImpl::stat(const char* pathname, struct stat* buf) {
   const int rc = ::stat(pathname, buf);
   return {rc, rc != -1 ? 0 : errno};
@@ -284,6 +289,11 @@ SysCallIntResult OsSysCallsImpl::unlink(const char* pathname) const {
   return {rc, rc != -1 ? 0 : errno};
 }
 
+SysCallIntResult OsSysCallsImpl::mkdir(const char* pathname, mode_t mode) const {
+  const int rc = ::mkdir(pathname, mode);
+  return {rc, rc != -1 ? 0 : errno};
+}
+
 SysCallIntResult OsSysCallsImpl::linkat(os_fd_t olddirfd, const char* oldpath, os_fd_t newdirfd,
                                         const char* newpath, int flags) const {
   const int rc = ::linkat(olddirfd, oldpath, newdirfd, newpath, flags);
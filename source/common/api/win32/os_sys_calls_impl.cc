@@ -1,3 +1,4 @@
+#include <direct.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <io.h>
@@ -232,6 +233,10 @@ SysCallPtrResult OsSysCallsImpl::mmap(void* addr, size_t length, int prot, int f
   PANIC("mmap not implemented on Windows");
 }
 
+SysCallIntResult OsSysCallsImpl::munmap(void* addr, size_t length) {
+  PANIC("munmap not implemented on Windows");
+}
+
 SysCallIntResult OsSysCallsImpl::stat(const char* pathname, struct stat* buf) {
   const int rc = ::stat(pathname, buf);
   return {rc, rc != -1 ? 0 : errno};
@@ -312,6 +317,11 @@ SysCallIntResult OsSysCallsImpl::unlink(const char* pathname) const {
   return {rc, rc != -1 ? 0 : ::WSAGetLastError()};
 }
 
+SysCallIntResult OsSysCallsImpl::mkdir(const char* pathname, mode_t) const {
+  const int rc = ::_mkdir(pathname);
+  return {rc, rc != -1 ? 0 : ::WSAGetLastError()};
+}
+
 SysCallIntResult OsSysCallsImpl::linkat(os_fd_t olddirfd, const char* oldpath, os_fd_t newdirfd,
                                         const char* newpath, int flags) const {
   PANIC("not implemented");
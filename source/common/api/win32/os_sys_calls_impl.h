@@ -38,6 +38,7 @@ public:
   SysCallIntResult ftruncate(int fd, off_t length) override;
   SysCallPtrResult mmap(void* addr, size_t length, int prot, int flags, int fd,
                         off_t offset) override;
+  SysCallIntResult munmap(void* addr, size_t length) override;
   SysCallIntResult stat(const char* pathname, struct stat* buf) override;
   SysCallIntResult fstat(os_fd_t fd, struct stat* buf) override;
   SysCallIntResult setsockopt(os_fd_t sockfd, int level, int optname, const void* optval,
@@ -55,6 +56,7 @@ public:
   SysCallIntResult open(const char* pathname, int flags) const override;
   SysCallIntResult open(const char* pathname, int flags, mode_t mode) const override;
   SysCallIntResult unlink(const char* pathname) const override;
+  SysCallIntResult mkdir(const char* pathname, mode_t mode) const override;
   SysCallIntResult linkat(os_fd_t olddirfd, const char* oldpath, os_fd_t newdirfd,
                           const char* newpath, int flags) const override;
   SysCallIntResult mkstemp(char* tmplate) const override;
@@ -19,9 +19,7 @@ namespace {
 constexpr uint64_t CopyThreshold = 512;
 } // namespace
 
-thread_local absl::InlinedVector<Slice::StoragePtr,
-                                 OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_max_>
-    OwnedImpl::OwnedImplReservationSlicesOwnerMultiple::free_list_;
+thread_local Slice::StorageCache Slice::storage_cache_;
 
 void OwnedImpl::addImpl(const void* data, uint64_t size) {
   const char* src = static_cast<const char*>(data);
@@ -628,6 +626,14 @@ std::vector<Slice::SliceRepresentation> OwnedImpl::describeSlicesForTest() const
   return slices;
 }
 
+uint64_t OwnedImpl::totalSliceCapacity() const {
+  uint64_t capacity = 0;
+  for (const auto& slice : slices_) {
+    capacity += slice.capacity();
+  }
+  return capacity;
+}
+
 size_t OwnedImpl::addFragments(absl::Span<const absl::string_view> fragments) {
   size_t total_size_to_copy = 0;
 
@@ -55,7 +55,7 @@ public:
    * @param account the account to charge.
    */
   Slice(uint64_t min_capacity, const BufferMemoryAccountSharedPtr& account)
-      : capacity_(sliceSize(min_capacity)), storage_(new uint8_t[capacity_]),
+      : capacity_(sliceSize(min_capacity)), storage_(acquireStorage(capacity_)),
         base_(storage_.get()) {
     if (account) {
       account->charge(capacity_);
@@ -111,6 +111,7 @@ public:
   Slice& operator=(Slice&& rhs) noexcept {
     if (this != &rhs) {
       callAndClearDrainTrackersAndCharges();
+      recycleStorage();
 
       capacity_ = rhs.capacity_;
       storage_ = std::move(rhs.storage_);
@@ -129,7 +130,10 @@ public:
     return *this;
   }
 
-  ~Slice() { callAndClearDrainTrackersAndCharges(); }
+  ~Slice() {
+    callAndClearDrainTrackersAndCharges();
+    recycleStorage();
+  }
 
   /**
    * @return true if the data in the slice is mutable
@@ -171,6 +175,12 @@ public:
     }
   }
 
+  /**
+   * @return the total number of bytes of storage backing the slice, including drained and
+   * reservable space.
+   */
+  uint64_t capacity() const { return capacity_; }
+
   /**
    * @return the number of bytes available to be reserved.
    * @note Read-only implementations of Slice should return zero from this method.
@@ -369,9 +379,57 @@ public:
    */
   static inline SizedStorage newStorage(uint64_t min_capacity) {
     const uint64_t slice_size = sliceSize(min_capacity);
-    return {StoragePtr{new uint8_t[slice_size]}, static_cast<size_t>(slice_size)};
+    return {acquireStorage(slice_size), static_cast<size_t>(slice_size)};
+  }
+
+  using StorageCache = absl::InlinedVector<StoragePtr, 8>;
+
+  /**
+   * Maximum number of default-sized storage blocks retained by the per-thread storage cache.
+   * This is a high watermark: storage released while the cache is full goes straight back to
+   * the allocator, so a burst of buffer usage trims back down to this bound.
+   */
+  static constexpr uint32_t storage_cache_high_watermark_ = 64;
+
+  /**
+   * @return the calling thread's free list of default-sized storage blocks. Slices of
+   * default_slice_size_ recycle their storage through this cache so that connection and stream
+   * churn does not cross the allocator for every buffer.
+   */
+  static StorageCache& storageCache() { return storage_cache_; }
+
+private:
+  /**
+   * Take a storage block from the per-thread cache, falling back to the allocator when the cache
+   * is empty or the capacity is not the cached default size.
+   */
+  static StoragePtr acquireStorage(uint64_t capacity) {
+    if (capacity == default_slice_size_) {
+      StorageCache& cache = storageCache();
+      if (!cache.empty()) {
+        StoragePtr storage = std::move(cache.back());
+        cache.pop_back();
+        return storage;
+      }
+    }
+    return StoragePtr{new uint8_t[capacity]};
   }
 
+  /**
+   * Return this slice's storage, if any, to the per-thread cache. Only default-sized storage is
+   * cached, and only while the cache is below its high watermark.
+   */
+  void recycleStorage() {
+    if (storage_ != nullptr && capacity_ == default_slice_size_) {
+      StorageCache& cache = storageCache();
+      if (cache.size() < storage_cache_high_watermark_) {
+        cache.push_back(std::move(storage_));
+      }
+    }
+  }
+
+  static thread_local StorageCache storage_cache_;
+
 protected:
   /** Length of the byte array that base_ points to. This is also the offset in bytes from the start
    * of the slice to the end of the Reservable section. */
@@ -719,6 +777,12 @@ public:
 
   size_t addFragments(absl::Span<const absl::string_view> fragments) override;
 
+  /**
+   * @return the total number of bytes of slice storage held by the buffer, including drained
+   * and reservable space. Together with length() this describes how fragmented the buffer is.
+   */
+  uint64_t totalSliceCapacity() const;
+
 protected:
   static constexpr uint64_t default_read_reservation_size_ =
       Reservation::MAX_SLICES_ * Slice::default_slice_size_;
@@ -763,14 +827,12 @@ private:
 
   struct OwnedImplReservationSlicesOwnerMultiple : public OwnedImplReservationSlicesOwner {
   public:
-    static constexpr uint32_t free_list_max_ = Buffer::Reservation::MAX_SLICES_;
-
-    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(free_list_) {}
+    OwnedImplReservationSlicesOwnerMultiple() : free_list_ref_(Slice::storageCache()) {}
     ~OwnedImplReservationSlicesOwnerMultiple() override {
       for (auto r = owned_storages_.rbegin(); r != owned_storages_.rend(); r++) {
         if (r->mem_ != nullptr) {
           ASSERT(r->len_ == Slice::default_slice_size_);
-          if (free_list_ref_.size() < free_list_max_) {
+          if (free_list_ref_.size() < Slice::storage_cache_high_watermark_) {
             free_list_ref_.push_back(std::move(r->mem_));
           }
         }
@@ -800,12 +862,7 @@ private:
   private:
     // Thread local resolving introduces additional overhead. Initialize this reference once when
     // constructing the owner to reduce thread local resolving to improve performance.
-    absl::InlinedVector<Slice::StoragePtr, free_list_max_>& free_list_ref_;
-
-    // Simple thread local cache to reduce unnecessary memory allocation and release. This cache
-    // is currently only used for multiple slices reservation because of the additional overhead
-    // that thread local resolving would introduce.
-    static thread_local absl::InlinedVector<Slice::StoragePtr, free_list_max_> free_list_;
+    Slice::StorageCache& free_list_ref_;
   };
 
   struct OwnedImplReservationSlicesOwnerSingle : public OwnedImplReservationSlicesOwner {
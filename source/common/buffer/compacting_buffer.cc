@@ -0,0 +1,70 @@
+#include "source/common/buffer/compacting_buffer.h"
+
+namespace Envoy {
+namespace Buffer {
+
+namespace {
+// Compaction is skipped while the buffer holds no more than this much storage: a handful of
+// slices is the steady state for a well-behaved buffer and not worth copying.
+constexpr uint64_t CompactionFloorBytes = 4 * Slice::default_slice_size_;
+} // namespace
+
+void CompactingOwnedImpl::drain(uint64_t size) {
+  OwnedImpl::drain(size);
+  maybeCompact();
+}
+
+void CompactingOwnedImpl::move(Instance& rhs) {
+  OwnedImpl::move(rhs);
+  maybeCompact();
+}
+
+void CompactingOwnedImpl::move(Instance& rhs, uint64_t length) {
+  OwnedImpl::move(rhs, length);
+  maybeCompact();
+}
+
+void CompactingOwnedImpl::addDrainTracker(std::function<void()> drain_tracker) {
+  has_drain_trackers_ = true;
+  OwnedImpl::addDrainTracker(std::move(drain_tracker));
+}
+
+void CompactingOwnedImpl::bindAccount(BufferMemoryAccountSharedPtr account) {
+  has_account_ = true;
+  OwnedImpl::bindAccount(std::move(account));
+}
+
+double CompactingOwnedImpl::fragmentationRatio() const {
+  const uint64_t capacity = totalSliceCapacity();
+  if (capacity == 0) {
+    return 0.0;
+  }
+  return 1.0 - static_cast<double>(length()) / static_cast<double>(capacity);
+}
+
+void CompactingOwnedImpl::maybeCompact() {
+  if (has_drain_trackers_ || has_account_) {
+    return;
+  }
+  const uint64_t capacity = totalSliceCapacity();
+  if (capacity <= CompactionFloorBytes) {
+    return;
+  }
+  const uint64_t live = length();
+  if (live * 100 >= capacity * min_occupancy_percent_) {
+    return;
+  }
+
+  // Copy the live content into fresh slices and release the old storage. add() packs default
+  // sized slices back to back, so the result holds the minimal slice count for the content.
+  OwnedImpl compacted;
+  for (const RawSlice& slice : getRawSlices()) {
+    compacted.add(slice.mem_, slice.len_);
+  }
+  OwnedImpl::drain(live);
+  OwnedImpl::move(compacted);
+  compactions_++;
+}
+
+} // namespace Buffer
+} // namespace Envoy
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "source/common/buffer/buffer_impl.h"
+
+namespace Envoy {
+namespace Buffer {
+
+/**
+ * An OwnedImpl for long-lived streams that tracks how densely its slice storage is used and
+ * compacts itself when occupancy drops below a configured floor. Streaming workloads that
+ * append and drain many small chunks (e.g. per-message gRPC frames) otherwise accumulate large
+ * numbers of mostly-empty slices, inflating resident memory and making linearize() expensive.
+ *
+ * Compaction copies the live content into fresh, densely packed slices and releases the old
+ * storage. It only runs when the buffer holds more than a few slices' worth of storage, so
+ * small buffers never pay for it, and it is suppressed while drain trackers or a memory
+ * account are attached, since both are tied to the identity of the original slices.
+ */
+class CompactingOwnedImpl : public OwnedImpl {
+public:
+  static constexpr uint32_t DefaultMinOccupancyPercent = 25;
+
+  explicit CompactingOwnedImpl(uint32_t min_occupancy_percent = DefaultMinOccupancyPercent)
+      : min_occupancy_percent_(min_occupancy_percent) {}
+
+  // Buffer::Instance
+  void drain(uint64_t size) override;
+  void move(Instance& rhs) override;
+  void move(Instance& rhs, uint64_t length) override;
+  void addDrainTracker(std::function<void()> drain_tracker) override;
+  void bindAccount(BufferMemoryAccountSharedPtr account) override;
+
+  /**
+   * @return the fraction of held slice storage not occupied by live content, in [0, 1].
+   */
+  double fragmentationRatio() const;
+
+  /**
+   * @return the number of compaction passes the buffer has performed.
+   */
+  uint64_t compactions() const { return compactions_; }
+
+private:
+  void maybeCompact();
+
+  const uint32_t min_occupancy_percent_;
+  uint64_t compactions_{0};
+  bool has_drain_trackers_{false};
+  bool has_account_{false};
+};
+
+} // namespace Buffer
+} // namespace Envoy
@@ -204,7 +204,8 @@ uint64_t WatermarkBufferFactory::resetAccountsGivenPressure(float pressure) {
       std::floor(pressure * BufferMemoryAccountImpl::NUM_MEMORY_CLASSES_) + 1, 8);
 
   uint32_t last_bucket_to_clear = BufferMemoryAccountImpl::NUM_MEMORY_CLASSES_ - buckets_to_clear;
-  ENVOY_LOG_MISC(warn, "resetting streams in buckets >= {}", last_bucket_to_clear);
+  ENVOY_LOG_MISC(warn, "resetting streams in buckets >= {}, aggregate account balance {} bytes",
+                 last_bucket_to_clear, total_account_balance_);
 
   // Clear buckets, prioritizing the buckets with larger streams.
   uint32_t num_streams_reset = 0;
@@ -279,6 +280,7 @@ void BufferMemoryAccountImpl::updateAccountClass() {
 void BufferMemoryAccountImpl::credit(uint64_t amount) {
   ASSERT(buffer_memory_allocated_ >= amount);
   buffer_memory_allocated_ -= amount;
+  factory_->creditAccountBalance(amount);
   updateAccountClass();
 }
 
@@ -286,6 +288,7 @@ void BufferMemoryAccountImpl::charge(uint64_t amount) {
   // Check overflow
   ASSERT(std::numeric_limits<uint64_t>::max() - buffer_memory_allocated_ >= amount);
   buffer_memory_allocated_ += amount;
+  factory_->chargeAccountBalance(amount);
   updateAccountClass();
 }
 
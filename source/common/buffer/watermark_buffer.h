@@ -200,6 +200,15 @@ public:
 
   BufferMemoryAccountSharedPtr createAccount(Http::StreamResetHandler& reset_handler) override;
   uint64_t resetAccountsGivenPressure(float pressure) override;
+  uint64_t totalAccountBalance() const override { return total_account_balance_; }
+
+  // Called by BufferMemoryAccountImpls created by the factory as their balance
+  // changes, keeping the factory-wide aggregate up to date in O(1).
+  void chargeAccountBalance(uint64_t amount) { total_account_balance_ += amount; }
+  void creditAccountBalance(uint64_t amount) {
+    ASSERT(total_account_balance_ >= amount);
+    total_account_balance_ -= amount;
+  }
 
   // Called by BufferMemoryAccountImpls created by the factory on account class
   // updated.
@@ -221,6 +230,10 @@ protected:
   // How much to bit shift right balances to test whether the account should be
   // tracked in *size_class_account_sets_*.
   const uint32_t bitshift_;
+  // Aggregate balance of all accounts created by this factory, including those
+  // below the tracking threshold. The factory is per-dispatcher, so this is a
+  // plain counter touched only on the owning worker.
+  uint64_t total_account_balance_{0};
 };
 
 } // namespace Buffer
@@ -0,0 +1,35 @@
+#include "source/common/common/cpu_affinity.h"
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace Envoy {
+namespace Thread {
+
+std::vector<int32_t> allowedCpus() {
+  std::vector<int32_t> cpus;
+#if defined(__linux__)
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  if (sched_getaffinity(0, sizeof(cpuset), &cpuset) == 0) {
+    for (int32_t i = 0; i < CPU_SETSIZE; i++) {
+      if (CPU_ISSET(i, &cpuset)) {
+        cpus.push_back(i);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+absl::optional<int32_t> pinnedCpuForWorker(uint32_t worker_index) {
+  const std::vector<int32_t> cpus = allowedCpus();
+  if (cpus.empty()) {
+    return absl::nullopt;
+  }
+  return cpus[worker_index % cpus.size()];
+}
+
+} // namespace Thread
+} // namespace Envoy
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "absl/types/optional.h"
+
+namespace Envoy {
+namespace Thread {
+
+/**
+ * @return the CPUs the process is allowed to run on, in ascending order. Empty if they cannot be
+ * determined, including on platforms without thread affinity support.
+ */
+std::vector<int32_t> allowedCpus();
+
+/**
+ * @return the CPU a worker thread is pinned to under the bootstrap ``pin_worker_threads`` option:
+ * the worker index taken round-robin over allowedCpus(). nullopt if the allowed CPUs cannot be
+ * determined.
+ */
+absl::optional<int32_t> pinnedCpuForWorker(uint32_t worker_index);
+
+} // namespace Thread
+} // namespace Envoy
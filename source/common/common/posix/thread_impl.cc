@@ -4,6 +4,7 @@
 #include "absl/strings/str_cat.h"
 
 #if defined(__linux__)
+#include <sched.h>
 #include <sys/syscall.h>
 #endif
 
@@ -52,6 +53,19 @@ public:
         this);
     RELEASE_ASSERT(rc == 0, "");
 
+#if defined(__linux__)
+    if (options && options->cpu_ >= 0) {
+      cpu_set_t cpuset;
+      CPU_ZERO(&cpuset);
+      CPU_SET(options->cpu_, &cpuset);
+      const int pin_rc = pthread_setaffinity_np(thread_handle_, sizeof(cpuset), &cpuset);
+      if (pin_rc != 0) {
+        ENVOY_LOG_MISC(warn, "Error {} pinning thread `{}' to CPU {}", pin_rc, name_,
+                       options->cpu_);
+      }
+    }
+#endif
+
 #if SUPPORTS_PTHREAD_NAMING
     // If the name was not specified, get it from the OS. If the name was
     // specified, write it into the thread, and assert that the OS sees it the
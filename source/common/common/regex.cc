@@ -8,20 +8,64 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/common/fmt.h"
+#include "source/common/common/macros.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
 namespace Envoy {
 namespace Regex {
 
+namespace {
+
+// Process-wide cache of compiled RE2 programs. Large route configs commonly repeat the same
+// pattern across thousands of matchers; sharing the compiled program collapses both compile time
+// and program memory to one instance per distinct pattern. Entries are weak so a program is freed
+// with its last matcher; expired entries are swept once the map grows past a threshold so serial
+// config reloads cannot grow it without bound.
+struct CompiledRegexCache {
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::weak_ptr<const re2::RE2>>
+      programs_ ABSL_GUARDED_BY(mutex_);
+};
+
+CompiledRegexCache& compiledRegexCache() { MUTABLE_CONSTRUCT_ON_FIRST_USE(CompiledRegexCache); }
+
+std::shared_ptr<const re2::RE2> compileSharedRegexProgram(const std::string& regex) {
+  auto& cache = compiledRegexCache();
+  absl::MutexLock lock(&cache.mutex_);
+  const auto it = cache.programs_.find(regex);
+  if (it != cache.programs_.end()) {
+    if (std::shared_ptr<const re2::RE2> existing = it->second.lock()) {
+      return existing;
+    }
+  }
+
+  auto program = std::make_shared<const re2::RE2>(regex, re2::RE2::Quiet);
+  // Invalid patterns are not cached; the caller reports the error and the config is rejected.
+  if (!program->ok()) {
+    return program;
+  }
+  constexpr size_t SweepThreshold = 4096;
+  if (cache.programs_.size() >= SweepThreshold) {
+    absl::erase_if(cache.programs_, [](const auto& entry) { return entry.second.expired(); });
+  }
+  cache.programs_.insert_or_assign(regex, program);
+  return program;
+}
+
+} // namespace
+
 CompiledGoogleReMatcher::CompiledGoogleReMatcher(const std::string& regex,
                                                  bool do_program_size_check)
-    : regex_(regex, re2::RE2::Quiet) {
-  if (!regex_.ok()) {
-    throw EnvoyException(regex_.error());
+    : regex_(compileSharedRegexProgram(regex)) {
+  if (!regex_->ok()) {
+    throw EnvoyException(regex_->error());
   }
 
   if (do_program_size_check && Runtime::isRuntimeInitialized()) {
-    const uint32_t regex_program_size = static_cast<uint32_t>(regex_.ProgramSize());
+    const uint32_t regex_program_size = static_cast<uint32_t>(regex_->ProgramSize());
     const uint32_t max_program_size_error_level =
         Runtime::getInteger("re2.max_program_size.error_level", 100);
     if (regex_program_size > max_program_size_error_level) {
@@ -45,7 +89,7 @@ CompiledGoogleReMatcher::CompiledGoogleReMatcher(const std::string& regex,
 CompiledGoogleReMatcher::CompiledGoogleReMatcher(
     const envoy::type::matcher::v3::RegexMatcher& config)
     : CompiledGoogleReMatcher(config.regex(), !config.google_re2().has_max_program_size()) {
-  const uint32_t regex_program_size = static_cast<uint32_t>(regex_.ProgramSize());
+  const uint32_t regex_program_size = static_cast<uint32_t>(regex_->ProgramSize());
 
   // Check if the deprecated field max_program_size is set first, and follow the old logic if so.
   if (config.google_re2().has_max_program_size()) {
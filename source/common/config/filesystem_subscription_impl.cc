@@ -67,10 +67,17 @@ std::string FilesystemSubscriptionImpl::refreshInternal(ProtobufTypes::MessagePt
   auto owned_message = std::make_unique<envoy::service::discovery::v3::DiscoveryResponse>();
   auto& message = *owned_message;
   MessageUtil::loadFromFile(path_, message, validation_visitor_, api_);
+  const uint64_t config_hash = MessageUtil::hash(message);
+  if (last_config_hash_.has_value() && *last_config_hash_ == config_hash) {
+    ENVOY_LOG(debug, "Filesystem config unchanged for {}, skipping update", path_);
+    *config_update = std::move(owned_message);
+    return message.version_info();
+  }
   *config_update = std::move(owned_message);
   const auto decoded_resources =
       DecodedResourcesWrapper(*resource_decoder_, message.resources(), message.version_info());
   callbacks_.onConfigUpdate(decoded_resources.refvec_, message.version_info());
+  last_config_hash_ = config_hash;
   return message.version_info();
 }
 
@@ -117,6 +124,12 @@ FilesystemCollectionSubscriptionImpl::refreshInternal(ProtobufTypes::MessagePtr*
   auto owned_resource_message = std::make_unique<envoy::service::discovery::v3::Resource>();
   auto& resource_message = *owned_resource_message;
   MessageUtil::loadFromFile(path_, resource_message, validation_visitor_, api_);
+  const uint64_t config_hash = MessageUtil::hash(resource_message);
+  if (last_config_hash_.has_value() && *last_config_hash_ == config_hash) {
+    ENVOY_LOG(debug, "Filesystem config unchanged for {}, skipping update", path_);
+    *config_update = std::move(owned_resource_message);
+    return resource_message.version();
+  }
   // Dynamically load the collection message.
   const std::string collection_type =
       std::string(TypeUtil::typeUrlToDescriptorFullName(resource_message.resource().type_url()));
@@ -155,6 +168,7 @@ FilesystemCollectionSubscriptionImpl::refreshInternal(ProtobufTypes::MessagePtr*
   }
   *config_update = std::move(owned_resource_message);
   callbacks_.onConfigUpdate(decoded_resources.refvec_, resource_message.version());
+  last_config_hash_ = config_hash;
   return resource_message.version();
 }
 
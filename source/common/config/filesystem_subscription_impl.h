@@ -45,6 +45,9 @@ protected:
   void configRejected(const EnvoyException& e, const std::string& message);
 
   bool started_{};
+  // Content hash of the last delivered config, used to swallow watch events that do not change
+  // the config (a rotation's temp-file writes and renames raise several events per change).
+  absl::optional<uint64_t> last_config_hash_;
   const std::string path_;
   std::unique_ptr<Filesystem::Watcher> file_watcher_;
   WatchedDirectoryPtr directory_watcher_;
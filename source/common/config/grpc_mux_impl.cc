@@ -2,13 +2,16 @@
 
 #include "envoy/service/discovery/v3/discovery.pb.h"
 
+#include "source/common/common/hash.h"
 #include "source/common/config/decoded_resource_impl.h"
 #include "source/common/config/utility.h"
 #include "source/common/config/xds_source_id.h"
 #include "source/common/memory/utils.h"
 #include "source/common/protobuf/protobuf.h"
+#include "source/common/protobuf/utility.h"
 
 #include "absl/container/btree_map.h"
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_set.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_cat.h"
@@ -290,15 +293,20 @@ void GrpcMuxImpl::onDiscoveryResponse(
   same_type_resume = pause(type_url);
   TRY_ASSERT_MAIN_THREAD {
     std::vector<DecodedResourcePtr> resources;
+    resources.reserve(message->resources().size());
     OpaqueResourceDecoder& resource_decoder = *api_state.watches_.front()->resource_decoder_;
 
     for (const auto& resource : message->resources()) {
       // TODO(snowp): Check the underlying type when the resource is a Resource.
       if (!resource.Is<envoy::service::discovery::v3::Resource>() &&
           type_url != resource.type_url()) {
-        throw EnvoyException(
-            fmt::format("{} does not match the message-wide type URL {} in DiscoveryResponse {}",
-                        resource.type_url(), type_url, message->DebugString()));
+        // Don't serialize the whole response into the error message; it can be arbitrarily
+        // large and stringifying it would stall the main thread.
+        throw EnvoyException(fmt::format(
+            "{} does not match the message-wide type URL {} in DiscoveryResponse (version={}, "
+            "nonce={}, resources={})",
+            resource.type_url(), type_url, message->version_info(), message->nonce(),
+            message->resources().size()));
       }
 
       auto decoded_resource =
@@ -379,6 +387,22 @@ void GrpcMuxImpl::processDiscoveryResources(const std::vector<DecodedResourcePtr
     config_validators_->executeValidators(type_url, resources);
   }
 
+  // Content hashes are computed lazily and memoized so that a resource referenced by several
+  // watches is hashed at most once per response. The TTL is folded into the hash so that a
+  // TTL-only refresh is still delivered to subscribers.
+  absl::flat_hash_map<const DecodedResource*, uint64_t> content_hashes;
+  auto content_hash = [&content_hashes](const DecodedResource& resource) -> uint64_t {
+    auto it = content_hashes.find(&resource);
+    if (it == content_hashes.end()) {
+      const int64_t ttl_ms = resource.ttl().has_value() ? resource.ttl()->count() : -1;
+      const uint64_t hash = HashUtil::xxHash64(
+          absl::string_view(reinterpret_cast<const char*>(&ttl_ms), sizeof(ttl_ms)),
+          MessageUtil::hash(resource.resource()));
+      it = content_hashes.emplace(&resource, hash).first;
+    }
+    return it->second;
+  };
+
   for (auto watch : api_state.watches_) {
     // onConfigUpdate should be called in all cases for single watch xDS (Cluster and
     // Listener) even if the message does not have resources so that update_empty stat
@@ -411,7 +435,25 @@ void GrpcMuxImpl::processDiscoveryResources(const std::vector<DecodedResourcePtr
     // onConfigUpdate should be called only on watches(clusters/listeners) that have
     // updates in the message for EDS/RDS.
     if (!found_resources.empty()) {
+      // SotW responses re-send every resource on each push. Skip the callback when this watch
+      // has already applied exactly these resource contents, so that e.g. a change to a single
+      // ClusterLoadAssignment does not re-process the assignments of every other watched
+      // cluster.
+      uint64_t delivered_hash = 0;
+      for (const DecodedResourceRef& resource_ref : found_resources) {
+        delivered_hash = HashUtil::xxHash64(resource_ref.get().name(), delivered_hash);
+        const uint64_t resource_hash = content_hash(resource_ref.get());
+        delivered_hash = HashUtil::xxHash64(
+            absl::string_view(reinterpret_cast<const char*>(&resource_hash),
+                              sizeof(resource_hash)),
+            delivered_hash);
+      }
+      if (watch->last_delivered_hash_ == delivered_hash) {
+        continue;
+      }
       watch->callbacks_.onConfigUpdate(found_resources, version_info);
+      // Only record the hash once the update has been accepted without throwing.
+      watch->last_delivered_hash_ = delivered_hash;
     }
   }
 
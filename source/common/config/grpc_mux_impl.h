@@ -125,6 +125,11 @@ private:
 
     // Maintain deterministic wire ordering via ordered std::set.
     std::set<std::string> resources_;
+    // Hash over the names and contents of the resources most recently delivered to this watch.
+    // Used to elide redundant onConfigUpdate() calls when a SotW response re-sends resources
+    // that this watch has already applied. Cleared when the watch's interest changes so that
+    // a fresh set of resources is always delivered.
+    absl::optional<uint64_t> last_delivered_hash_;
     SubscriptionCallbacks& callbacks_;
     OpaqueResourceDecoderSharedPtr resource_decoder_;
     const std::string type_url_;
@@ -133,6 +138,7 @@ private:
   private:
     void updateResources(const absl::flat_hash_set<std::string>& resources) {
       resources_.clear();
+      last_delivered_hash_.reset();
       std::transform(
           resources.begin(), resources.end(), std::inserter(resources_, resources_.begin()),
           [this](const std::string& resource_name) -> std::string {
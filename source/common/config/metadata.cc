@@ -105,13 +105,12 @@ bool Metadata::metadataLabelMatch(const LabelSet& label_set,
   return true;
 }
 
-ConstMetadataSharedPoolSharedPtr
-Metadata::getConstMetadataSharedPool(Singleton::Manager& manager, Event::Dispatcher& dispatcher) {
+ConstMetadataSharedPoolSharedPtr Metadata::getConstMetadataSharedPool(Singleton::Manager& manager) {
   return manager.getTyped<SharedPool::ObjectSharedPool<const envoy::config::core::v3::Metadata,
                                                        MessageUtil, MessageUtil>>(
-      SINGLETON_MANAGER_REGISTERED_NAME(const_metadata_shared_pool), [&dispatcher] {
+      SINGLETON_MANAGER_REGISTERED_NAME(const_metadata_shared_pool), [] {
         return std::make_shared<SharedPool::ObjectSharedPool<
-            const envoy::config::core::v3::Metadata, MessageUtil, MessageUtil>>(dispatcher);
+            const envoy::config::core::v3::Metadata, MessageUtil, MessageUtil>>();
       });
 }
 
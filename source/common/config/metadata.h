@@ -5,7 +5,6 @@
 
 #include "envoy/config/core/v3/base.pb.h"
 #include "envoy/config/typed_metadata.h"
-#include "envoy/event/dispatcher.h"
 #include "envoy/registry/registry.h"
 #include "envoy/singleton/manager.h"
 #include "envoy/type/metadata/v3/metadata.pb.h"
@@ -93,11 +92,8 @@ public:
   /**
    * Returns an ObjectSharedPool to store const Metadata
    * @param manager used to create singleton
-   * @param dispatcher the dispatcher object reference to the thread that created the
-   * ObjectSharedPool
    */
-  static ConstMetadataSharedPoolSharedPtr getConstMetadataSharedPool(Singleton::Manager& manager,
-                                                                     Event::Dispatcher& dispatcher);
+  static ConstMetadataSharedPoolSharedPtr getConstMetadataSharedPool(Singleton::Manager& manager);
 };
 
 template <typename factoryClass> class TypedMetadataImpl : public TypedMetadata {
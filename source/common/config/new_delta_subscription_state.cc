@@ -185,16 +185,16 @@ bool NewDeltaSubscriptionState::isHeartbeatResponse(
 void NewDeltaSubscriptionState::handleGoodResponse(
     const envoy::service::discovery::v3::DeltaDiscoveryResponse& message) {
   absl::flat_hash_set<std::string> names_added_removed;
-  Protobuf::RepeatedPtrField<envoy::service::discovery::v3::Resource> non_heartbeat_resources;
+  bool has_heartbeats = false;
   for (const auto& resource : message.resources()) {
     if (!names_added_removed.insert(resource.name()).second) {
       throw EnvoyException(
           fmt::format("duplicate name {} found among added/updated resources", resource.name()));
     }
     if (isHeartbeatResponse(resource)) {
+      has_heartbeats = true;
       continue;
     }
-    non_heartbeat_resources.Add()->CopyFrom(resource);
     // DeltaDiscoveryResponses for unresolved aliases don't contain an actual resource
     if (!resource.has_resource() && resource.aliases_size() > 0) {
       continue;
@@ -212,6 +212,18 @@ void NewDeltaSubscriptionState::handleGoodResponse(
           fmt::format("duplicate name {} found in the union of added+removed resources", name));
     }
   }
+  // Heartbeat responses are rare; only materialize a filtered copy of the resource list when one
+  // is present so that the common case passes the response's own resource list through without
+  // deep-copying every resource payload.
+  Protobuf::RepeatedPtrField<envoy::service::discovery::v3::Resource> non_heartbeat_resources;
+  if (has_heartbeats) {
+    for (const auto& resource : message.resources()) {
+      if (!isHeartbeatResponse(resource)) {
+        non_heartbeat_resources.Add()->CopyFrom(resource);
+      }
+    }
+  }
+  const auto& effective_resources = has_heartbeats ? non_heartbeat_resources : message.resources();
 
   if (!Runtime::runtimeFeatureEnabled(
           "envoy.reloadable_features.delta_xds_subscription_state_tracking_fix")) {
@@ -231,12 +243,12 @@ void NewDeltaSubscriptionState::handleGoodResponse(
     }
   }
 
-  watch_map_.onConfigUpdate(non_heartbeat_resources, message.removed_resources(),
+  watch_map_.onConfigUpdate(effective_resources, message.removed_resources(),
                             message.system_version_info());
 
   // Processing point when resources are successfully ingested.
   if (xds_config_tracker_.has_value()) {
-    xds_config_tracker_->onConfigAccepted(message.type_url(), non_heartbeat_resources,
+    xds_config_tracker_->onConfigAccepted(message.type_url(), effective_resources,
                                           message.removed_resources());
   }
 
@@ -46,16 +46,21 @@ void SotwSubscriptionState::markStreamFresh() {
 void SotwSubscriptionState::handleGoodResponse(
     const envoy::service::discovery::v3::DiscoveryResponse& message) {
   std::vector<DecodedResourcePtr> non_heartbeat_resources;
+  non_heartbeat_resources.reserve(message.resources().size());
 
   {
     const auto scoped_update = ttl_.scopedTtlUpdate();
     for (const auto& any : message.resources()) {
       if (!any.Is<envoy::service::discovery::v3::Resource>() &&
           any.type_url() != message.type_url()) {
+        // Don't serialize the whole response into the error message; it can be arbitrarily
+        // large and stringifying it would stall the main thread.
         throw EnvoyException(fmt::format("type URL {} embedded in an individual Any does not match "
-                                         "the message-wide type URL {} in DiscoveryResponse {}",
+                                         "the message-wide type URL {} in DiscoveryResponse "
+                                         "(version={}, nonce={}, resources={})",
                                          any.type_url(), message.type_url(),
-                                         message.DebugString()));
+                                         message.version_info(), message.nonce(),
+                                         message.resources().size()));
       }
 
       auto decoded_resource =
@@ -357,6 +357,10 @@ void ConnPoolImplBase::transitionActiveClientState(ActiveClient& client,
                                                    ActiveClient::State new_state) {
   auto& old_list = owningList(client.state());
   auto& new_list = owningList(new_state);
+  if (new_state == ActiveClient::State::Draining &&
+      client.state() != ActiveClient::State::Draining) {
+    onClientDraining(client);
+  }
   client.setState(new_state);
 
   // old_list and new_list can be equal when transitioning from Busy to Draining.
@@ -518,6 +522,10 @@ void ConnPoolImplBase::onConnectionEvent(ActiveClient& client, absl::string_view
       if (!is_draining_for_deletion_) {
         tryCreateNewConnections();
       }
+    } else if (client.state() != ActiveClient::State::Draining) {
+      // A connected client which closes abruptly never passed through the Draining state, so
+      // report it as draining now to keep the notifications balanced.
+      onClientDraining(client);
     }
 
     // We need to release our resourceManager() resources before checking below for
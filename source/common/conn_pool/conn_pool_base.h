@@ -317,6 +317,9 @@ public:
 protected:
   virtual void onConnected(Envoy::ConnectionPool::ActiveClient&) {}
   virtual void onConnectFailed(Envoy::ConnectionPool::ActiveClient&) {}
+  // Called at most once per client, when a connected client either transitions to the
+  // Draining state or closes without having drained.
+  virtual void onClientDraining(Envoy::ConnectionPool::ActiveClient&) {}
 
   enum class ConnectionResult {
     FailedToCreateConnection,
@@ -23,6 +23,7 @@
 #include "source/common/event/scaled_range_timer_manager_impl.h"
 #include "source/common/event/signal_impl.h"
 #include "source/common/event/timer_impl.h"
+#include "source/common/event/wheel_timer_scheduler.h"
 #include "source/common/filesystem/watcher_impl.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/network/connection_impl.h"
@@ -115,35 +116,66 @@ void DispatcherImpl::initializeStats(Stats::Scope& scope,
 
 void DispatcherImpl::clearDeferredDeleteList() {
   ASSERT(isThreadSafe());
-  std::vector<DeferredDeletablePtr>* to_delete = current_to_delete_;
-
-  size_t num_to_delete = to_delete->size();
-  if (deferred_deleting_ || !num_to_delete) {
+  if (deferred_deleting_) {
     return;
   }
 
-  ENVOY_LOG(trace, "clearing deferred deletion list (size={})", num_to_delete);
-
-  // Swap the current deletion vector so that if we do deferred delete while we are deleting, we
-  // use the other vector. We will get another callback to delete that vector.
-  if (current_to_delete_ == &to_delete_1_) {
-    current_to_delete_ = &to_delete_2_;
-  } else {
-    current_to_delete_ = &to_delete_1_;
+  // If a previous pass exhausted its budget, keep draining that vector; otherwise swap the
+  // current deletion vector so that if we do deferred delete while we are deleting, we use the
+  // other vector. We will get another callback to delete that vector.
+  if (draining_to_delete_ == nullptr) {
+    if (current_to_delete_->empty()) {
+      return;
+    }
+    draining_to_delete_ = current_to_delete_;
+    drain_index_ = 0;
+    if (current_to_delete_ == &to_delete_1_) {
+      current_to_delete_ = &to_delete_2_;
+    } else {
+      current_to_delete_ = &to_delete_1_;
+    }
   }
 
+  ENVOY_LOG(trace, "clearing deferred deletion list (size={})",
+            draining_to_delete_->size() - drain_index_);
+
   touchWatchdog();
   deferred_deleting_ = true;
 
-  // Calling clear() on the vector does not specify which order destructors run in. We want to
-  // destroy in FIFO order so just do it manually. This required 2 passes over the vector which is
-  // not optimal but can be cleaned up later if needed.
-  for (size_t i = 0; i < num_to_delete; i++) {
-    (*to_delete)[i].reset();
+  // Destroy in FIFO order, but bound the work done in one pass so a burst of teardowns (e.g.
+  // 10k connections draining at once) cannot stall the loop for milliseconds; the remainder
+  // carries over to the next loop iteration. The clock is only consulted every
+  // DeferredDeleteTimeCheckInterval destructions to keep the common small-list case cheap.
+  const MonotonicTime start = time_source_.monotonicTime();
+  size_t destroyed = 0;
+  while (drain_index_ < draining_to_delete_->size()) {
+    (*draining_to_delete_)[drain_index_++].reset();
+    if (++destroyed == MaxDeferredDeletesPerLoopIteration) {
+      break;
+    }
+    if (destroyed % DeferredDeleteTimeCheckInterval == 0 &&
+        time_source_.monotonicTime() - start >= DeferredDeleteTimeBudget) {
+      break;
+    }
   }
 
-  to_delete->clear();
   deferred_deleting_ = false;
+
+  if (drain_index_ == draining_to_delete_->size()) {
+    draining_to_delete_->clear();
+    draining_to_delete_ = nullptr;
+    return;
+  }
+
+  // Budget exhausted with a backlog remaining; record it and resume after the loop has had a
+  // chance to poll so deletion storms do not starve I/O.
+  const uint64_t backlog =
+      (draining_to_delete_->size() - drain_index_) + current_to_delete_->size();
+  if (stats_ != nullptr) {
+    stats_->deferred_delete_backlog_.recordValue(backlog);
+  }
+  ENVOY_LOG(trace, "deferred deletion budget exhausted (backlog={})", backlog);
+  deferred_delete_cb_->scheduleCallbackNextIteration();
 }
 
 Network::ServerConnectionPtr
@@ -215,6 +247,19 @@ TimerPtr DispatcherImpl::createTimer(TimerCb cb) {
   return createTimerInternal(cb);
 }
 
+TimerPtr DispatcherImpl::createCoarseTimer(TimerCb cb) {
+  ASSERT(isThreadSafe());
+  if (coarse_scheduler_ == nullptr) {
+    coarse_scheduler_ = std::make_unique<WheelTimerScheduler>(*scheduler_, time_source_);
+  }
+  return coarse_scheduler_->createTimer(
+      [this, cb]() {
+        touchWatchdog();
+        cb();
+      },
+      *this);
+}
+
 TimerPtr DispatcherImpl::createScaledTimer(ScaledTimerType timer_type, TimerCb cb) {
   ASSERT(isThreadSafe());
   return scaled_timer_manager_->createTimer(timer_type, std::move(cb));
@@ -262,14 +307,10 @@ SignalEventPtr DispatcherImpl::listenForSignal(signal_t signal_num, SignalCb cb)
 }
 
 void DispatcherImpl::post(std::function<void()> callback) {
-  bool do_post;
-  {
-    Thread::LockGuard lock(post_lock_);
-    do_post = post_callbacks_.empty();
-    post_callbacks_.push_back(callback);
-  }
-
-  if (do_post) {
+  // The queue is lock free for producers and returns true only on the empty to non-empty
+  // transition, so the loop is woken at most once per drain cycle no matter how many threads
+  // post concurrently.
+  if (post_queue_.push(std::move(callback), time_source_.monotonicTime())) {
     post_cb_->scheduleCallbackCurrentIteration();
   }
 }
@@ -309,11 +350,7 @@ void DispatcherImpl::shutdown() {
   // callbacks and dispatcher thread deletable objects.
   ASSERT(isThreadSafe());
   auto deferred_deletables_size = current_to_delete_->size();
-  std::list<std::function<void()>>::size_type post_callbacks_size;
-  {
-    Thread::LockGuard lock(post_lock_);
-    post_callbacks_size = post_callbacks_.size();
-  }
+  const uint64_t post_callbacks_size = post_queue_.size();
 
   std::list<DispatcherThreadDeletableConstPtr> local_deletables;
   {
@@ -359,27 +396,34 @@ void DispatcherImpl::runPostCallbacks() {
   // objects that is being deferred deleted.
   clearDeferredDeleteList();
 
-  std::list<std::function<void()>> callbacks;
-  {
-    // Take ownership of the callbacks under the post_lock_. The lock must be released before
-    // callbacks execute. Callbacks added after this transfer will re-arm post_cb_ and will execute
-    // later in the event loop.
-    Thread::LockGuard lock(post_lock_);
-    callbacks = std::move(post_callbacks_);
-    // post_callbacks_ should be empty after the move.
-    ASSERT(post_callbacks_.empty());
+  // Bound this drain to the callbacks queued on entry so callbacks posted during execution
+  // (including self-posts) run later in the event loop rather than starving it, matching the
+  // old snapshot-the-list semantics.
+  uint64_t to_run = post_queue_.size();
+  if (stats_ != nullptr && to_run != 0) {
+    stats_->post_queue_depth_.recordValue(to_run);
   }
-  // It is important that the execution and deletion of the callback happen while post_lock_ is not
-  // held. Either the invocation or destructor of the callback can call post() on this dispatcher.
-  while (!callbacks.empty()) {
+  std::function<void()> callback;
+  MonotonicTime enqueue_time;
+  while (to_run-- > 0 && post_queue_.pop(callback, enqueue_time)) {
     // Touch the watchdog before executing the callback to avoid spurious watchdog miss events when
     // executing a long list of callbacks.
     touchWatchdog();
+    if (stats_ != nullptr) {
+      stats_->post_wait_us_.recordValue(std::chrono::duration_cast<std::chrono::microseconds>(
+                                            time_source_.monotonicTime() - enqueue_time)
+                                            .count());
+    }
     // Run the callback.
-    callbacks.front()();
-    // Pop the front so that the destructor of the callback that just executed runs before the next
-    // callback executes.
-    callbacks.pop_front();
+    callback();
+    // Destroy the callback that just executed before the next one runs; the invocation or
+    // destructor of a callback can itself call post() on this dispatcher.
+    callback = nullptr;
+  }
+  // Re-arm for callbacks that arrived during the drain without signaling (the queue was
+  // non-empty) and for producers caught between linking steps.
+  if (!post_queue_.empty()) {
+    post_cb_->scheduleCallbackCurrentIteration();
   }
 }
 
@@ -18,6 +18,7 @@
 #include "source/common/common/thread.h"
 #include "source/common/event/libevent.h"
 #include "source/common/event/libevent_scheduler.h"
+#include "source/common/event/post_callback_queue.h"
 #include "source/common/signal/fatal_error_handler.h"
 
 #include "absl/container/inlined_vector.h"
@@ -30,6 +31,13 @@ namespace Event {
 // shouldn't have to grow larger.
 inline constexpr size_t ExpectedMaxTrackedObjectStackDepth = 10;
 
+// Deferred deletion is budgeted per loop iteration so that bursts of teardowns cannot stall the
+// loop; whatever count or time budget is hit first ends the pass and the remainder carries over.
+inline constexpr size_t MaxDeferredDeletesPerLoopIteration = 1000;
+inline constexpr std::chrono::microseconds DeferredDeleteTimeBudget{200};
+// How many destructions run between clock reads while checking the time budget.
+inline constexpr size_t DeferredDeleteTimeCheckInterval = 64;
+
 /**
  * libevent implementation of Event::Dispatcher.
  */
@@ -82,6 +90,7 @@ public:
   createUdpListener(Network::SocketSharedPtr socket, Network::UdpListenerCallbacks& cb,
                     const envoy::config::core::v3::UdpSocketConfig& config) override;
   TimerPtr createTimer(TimerCb cb) override;
+  TimerPtr createCoarseTimer(TimerCb cb) override;
   TimerPtr createScaledTimer(ScaledTimerType timer_type, TimerCb cb) override;
   TimerPtr createScaledTimer(ScaledTimerMinimum minimum, TimerCb cb) override;
 
@@ -157,6 +166,10 @@ private:
   Buffer::WatermarkFactorySharedPtr buffer_factory_;
   LibeventScheduler base_scheduler_;
   SchedulerPtr scheduler_;
+  // Timing wheel layered over scheduler_ that multiplexes coarse timers onto one driving timer.
+  // Created lazily by the first createCoarseTimer() call; declared after scheduler_ so the wheel
+  // (and its driver timer) is destroyed first.
+  SchedulerPtr coarse_scheduler_;
 
   SchedulableCallbackPtr thread_local_delete_cb_;
   Thread::MutexBasicLockable thread_local_deletable_lock_;
@@ -168,12 +181,15 @@ private:
   SchedulableCallbackPtr deferred_delete_cb_;
 
   SchedulableCallbackPtr post_cb_;
-  Thread::MutexBasicLockable post_lock_;
-  std::list<std::function<void()>> post_callbacks_ ABSL_GUARDED_BY(post_lock_);
+  PostCallbackQueue post_queue_;
 
   std::vector<DeferredDeletablePtr> to_delete_1_;
   std::vector<DeferredDeletablePtr> to_delete_2_;
   std::vector<DeferredDeletablePtr>* current_to_delete_;
+  // Non-null while a budget-exhausted deletion pass still has entries to destroy in the
+  // non-current vector; drain_index_ is the resume point within it.
+  std::vector<DeferredDeletablePtr>* draining_to_delete_{nullptr};
+  size_t drain_index_{0};
 
   absl::InlinedVector<const ScopeTrackedObject*, ExpectedMaxTrackedObjectStackDepth>
       tracked_object_stack_;
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+
+#include "envoy/common/time.h"
+
+#include "source/common/common/assert.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * An unbounded multi-producer single-consumer FIFO of post() callbacks. Producers are lock and
+ * wait free (one allocation plus two atomic operations per push), replacing the mutex-guarded
+ * list previously used for cross-thread posts, which suffered under heavy cluster-manager and
+ * stats-flush post traffic. The consumer must be a single thread (the dispatcher thread).
+ *
+ * The design is the classic two-pointer MPSC linked queue: producers link nodes with an atomic
+ * exchange on the tail, the consumer walks from the head. Between a producer's tail exchange and
+ * the next-pointer store, the linked-but-unreachable node makes pop() transiently return false
+ * while size() is non-zero; the caller handles this by retrying on a later loop iteration.
+ */
+class PostCallbackQueue {
+public:
+  PostCallbackQueue() {
+    auto* stub = new Node();
+    head_ = stub;
+    tail_.store(stub, std::memory_order_relaxed);
+  }
+
+  ~PostCallbackQueue() {
+    // No producers may be active at destruction; drain remaining callbacks unrun.
+    Node* node = head_;
+    while (node != nullptr) {
+      Node* next = node->next_.load(std::memory_order_relaxed);
+      delete node;
+      node = next;
+    }
+  }
+
+  /**
+   * Enqueues a callback. Safe to call from any thread.
+   * @return true if the queue transitioned from empty to non-empty, in which case the caller
+   *         must wake the consumer; producers racing on a non-empty queue return false so only
+   *         one wakeup is issued per drain cycle.
+   */
+  bool push(std::function<void()>&& callback, MonotonicTime enqueue_time) {
+    auto* node = new Node();
+    node->callback_ = std::move(callback);
+    node->enqueue_time_ = enqueue_time;
+    Node* prev = tail_.exchange(node, std::memory_order_acq_rel);
+    prev->next_.store(node, std::memory_order_release);
+    return size_.fetch_add(1, std::memory_order_seq_cst) == 0;
+  }
+
+  /**
+   * Dequeues the oldest callback. Consumer thread only.
+   * @return false if the queue is empty or a producer has not finished linking its node; in the
+   *         latter case size() is non-zero and the caller should retry later.
+   */
+  bool pop(std::function<void()>& callback, MonotonicTime& enqueue_time) {
+    Node* head = head_;
+    Node* next = head->next_.load(std::memory_order_acquire);
+    if (next == nullptr) {
+      return false;
+    }
+    // The head node is always a consumed stub; the oldest value lives in its successor, which
+    // becomes the new stub once drained.
+    callback = std::move(next->callback_);
+    enqueue_time = next->enqueue_time_;
+    next->callback_ = nullptr;
+    head_ = next;
+    delete head;
+    size_.fetch_sub(1, std::memory_order_seq_cst);
+    return true;
+  }
+
+  /**
+   * Approximate number of queued callbacks. Safe to call from any thread.
+   */
+  uint64_t size() const { return size_.load(std::memory_order_seq_cst); }
+
+  bool empty() const { return size() == 0; }
+
+private:
+  struct Node {
+    std::atomic<Node*> next_{nullptr};
+    std::function<void()> callback_;
+    MonotonicTime enqueue_time_;
+  };
+
+  // Consumer-owned pointer to the current stub node.
+  Node* head_;
+  // Producers append with an atomic exchange here.
+  std::atomic<Node*> tail_;
+  std::atomic<uint64_t> size_{0};
+};
+
+} // namespace Event
+} // namespace Envoy
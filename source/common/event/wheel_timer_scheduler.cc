@@ -0,0 +1,210 @@
+#include "source/common/event/wheel_timer_scheduler.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/common/scope_tracker.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * A timer living on the wheel. Coarse enables link the timer into a wheel slot; short and high
+ * resolution enables delegate to a lazily created base-scheduler timer.
+ */
+class WheelTimerScheduler::WheelTimer : public Timer {
+public:
+  WheelTimer(WheelTimerScheduler& parent, TimerCb cb, Dispatcher& dispatcher)
+      : parent_(parent), cb_(cb), dispatcher_(dispatcher) {
+    ASSERT(cb_);
+  }
+
+  ~WheelTimer() override {
+    if (in_wheel_) {
+      removeFromWheel();
+    }
+  }
+
+  // Timer
+  void disableTimer() override {
+    ASSERT(dispatcher_.isThreadSafe());
+    if (in_wheel_) {
+      removeFromWheel();
+    }
+    if (fallback_timer_ != nullptr) {
+      fallback_timer_->disableTimer();
+    }
+    object_ = nullptr;
+  }
+
+  void enableTimer(std::chrono::milliseconds ms, const ScopeTrackedObject* object) override {
+    ASSERT(dispatcher_.isThreadSafe());
+    disableTimer();
+    // Below two ticks the rounding error would rival the requested delay; keep such timers on
+    // the precise path.
+    if (ms < 2 * parent_.tick_interval_) {
+      enableFallback(std::chrono::duration_cast<std::chrono::microseconds>(ms), object);
+      return;
+    }
+    object_ = object;
+    // Round up so a wheel timer never fires early.
+    const uint64_t delay_ticks =
+        (ms.count() + parent_.tick_interval_.count() - 1) / parent_.tick_interval_.count();
+    deadline_tick_ = parent_.nowTick() + std::max<uint64_t>(1, delay_ticks);
+    parent_.insert(*this);
+  }
+
+  void enableHRTimer(std::chrono::microseconds us, const ScopeTrackedObject* object) override {
+    ASSERT(dispatcher_.isThreadSafe());
+    disableTimer();
+    enableFallback(us, object);
+  }
+
+  bool enabled() override {
+    ASSERT(dispatcher_.isThreadSafe());
+    return in_wheel_ || (fallback_timer_ != nullptr && fallback_timer_->enabled());
+  }
+
+private:
+  friend class WheelTimerScheduler;
+
+  void enableFallback(std::chrono::microseconds us, const ScopeTrackedObject* object) {
+    if (fallback_timer_ == nullptr) {
+      fallback_timer_ = parent_.base_scheduler_.createTimer(cb_, dispatcher_);
+    }
+    fallback_timer_->enableHRTimer(us, object);
+  }
+
+  // Unlinks this timer from its current slot. O(1).
+  void removeFromWheel() {
+    ASSERT(in_wheel_);
+    slot_->erase(slot_position_);
+    in_wheel_ = false;
+    ASSERT(parent_.pending_timers_ > 0);
+    --parent_.pending_timers_;
+  }
+
+  void fire() {
+    const ScopeTrackedObject* object = object_;
+    object_ = nullptr;
+    if (object == nullptr) {
+      cb_();
+      return;
+    }
+    ScopeTrackerScopeState scope(object, dispatcher_);
+    cb_();
+  }
+
+  WheelTimerScheduler& parent_;
+  TimerCb cb_;
+  Dispatcher& dispatcher_;
+  TimerPtr fallback_timer_;
+  const ScopeTrackedObject* object_{};
+  uint64_t deadline_tick_{0};
+  bool in_wheel_{false};
+  Slot* slot_{nullptr};
+  Slot::iterator slot_position_;
+};
+
+WheelTimerScheduler::WheelTimerScheduler(Scheduler& base_scheduler, TimeSource& time_source,
+                                         std::chrono::milliseconds tick_interval)
+    : base_scheduler_(base_scheduler), time_source_(time_source), tick_interval_(tick_interval),
+      start_(time_source.monotonicTime()), current_tick_(0) {
+  ASSERT(tick_interval_.count() > 0);
+}
+
+WheelTimerScheduler::~WheelTimerScheduler() {
+  // Timers must be destroyed before their scheduler, mirroring the libevent timer contract.
+  ASSERT(pending_timers_ == 0);
+}
+
+TimerPtr WheelTimerScheduler::createTimer(const TimerCb& cb, Dispatcher& dispatcher) {
+  return std::make_unique<WheelTimer>(*this, cb, dispatcher);
+}
+
+uint64_t WheelTimerScheduler::nowTick() const {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(time_source_.monotonicTime() -
+                                                               start_)
+             .count() /
+         tick_interval_.count();
+}
+
+void WheelTimerScheduler::insert(WheelTimer& timer) {
+  ASSERT(!timer.in_wheel_);
+  ASSERT(timer.deadline_tick_ > current_tick_);
+  const uint64_t delta = timer.deadline_tick_ - current_tick_;
+
+  // Pick the innermost level whose span covers the remaining delta; deadlines beyond the outer
+  // horizon park in the outermost level and re-bucket on cascade.
+  uint32_t level = 0;
+  while (level < NumLevels - 1 && delta >= (1ULL << (SlotBits * (level + 1)))) {
+    level++;
+  }
+  const uint64_t horizon = (1ULL << (SlotBits * (NumLevels))) - 1;
+  const uint64_t placement_tick = std::min(timer.deadline_tick_, current_tick_ + horizon);
+  const uint32_t slot_index = (placement_tick >> (SlotBits * level)) & (SlotsPerLevel - 1);
+
+  Slot& slot = wheel_[level][slot_index];
+  slot.push_front(&timer);
+  timer.slot_ = &slot;
+  timer.slot_position_ = slot.begin();
+  timer.in_wheel_ = true;
+  ++pending_timers_;
+  if (driver_timer_ == nullptr) {
+    driver_timer_ = base_scheduler_.createTimer([this]() { advance(); }, timer.dispatcher_);
+  }
+  armDriver();
+}
+
+void WheelTimerScheduler::armDriver() {
+  ASSERT(driver_timer_ != nullptr);
+  if (driver_timer_->enabled()) {
+    return;
+  }
+  // Fire at the next tick boundary; advance() re-arms while timers remain.
+  const MonotonicTime next_tick_time = start_ + (current_tick_ + 1) * tick_interval_;
+  const auto delay = std::chrono::duration_cast<std::chrono::microseconds>(
+      next_tick_time - time_source_.monotonicTime());
+  driver_timer_->enableHRTimer(std::max(delay, std::chrono::microseconds(0)));
+}
+
+void WheelTimerScheduler::cascade(uint32_t level, uint32_t slot_index) {
+  Slot& slot = wheel_[level][slot_index];
+  while (!slot.empty()) {
+    WheelTimer* timer = slot.front();
+    timer->removeFromWheel();
+    if (timer->deadline_tick_ <= current_tick_) {
+      // Became due while parked at this level.
+      timer->fire();
+    } else {
+      insert(*timer);
+    }
+  }
+}
+
+void WheelTimerScheduler::advance() {
+  const uint64_t target_tick = nowTick();
+  while (current_tick_ < target_tick) {
+    ++current_tick_;
+    // On wrap of a level, pull the next outer level's slot down before firing, so timers
+    // re-bucket into the slots about to be scanned.
+    for (uint32_t level = 1; level < NumLevels; level++) {
+      if ((current_tick_ & ((1ULL << (SlotBits * level)) - 1)) != 0) {
+        break;
+      }
+      cascade(level, (current_tick_ >> (SlotBits * level)) & (SlotsPerLevel - 1));
+    }
+
+    Slot& due = wheel_[0][current_tick_ & (SlotsPerLevel - 1)];
+    while (!due.empty()) {
+      WheelTimer* timer = due.front();
+      timer->removeFromWheel();
+      timer->fire();
+    }
+  }
+
+  if (pending_timers_ > 0) {
+    armDriver();
+  }
+}
+
+} // namespace Event
+} // namespace Envoy
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <list>
+
+#include "envoy/common/time.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/event/timer.h"
+
+namespace Envoy {
+namespace Event {
+
+/**
+ * A Scheduler backed by a hierarchical timing wheel, intended for workloads with very large
+ * numbers of coarse timers (idle, drain, TTL). Insert and cancel are O(1) list operations on a
+ * slot, instead of the O(log n) heap operations the libevent min-heap performs, and the wheel is
+ * advanced by a single underlying libevent timer ticking at the configured granularity while any
+ * wheel timer is pending.
+ *
+ * Timers enabled for at least two ticks are placed on the wheel and may fire up to one tick
+ * late; that slack is the point of the design and is fine for idle-style timeouts. Timers
+ * enabled below that horizon, and all high resolution timers, transparently fall back to a
+ * per-timer base scheduler timer so precision-sensitive users keep libevent semantics.
+ *
+ * The wheel has four levels of 64 slots; with the default 100ms tick the levels span 6.4s,
+ * ~6.8min, ~7.3h and ~19.4d. Deadlines beyond the horizon park in the outermost level and
+ * re-bucket as the wheel cascades.
+ */
+class WheelTimerScheduler : public Scheduler {
+public:
+  WheelTimerScheduler(Scheduler& base_scheduler, TimeSource& time_source,
+                      std::chrono::milliseconds tick_interval = std::chrono::milliseconds(100));
+  ~WheelTimerScheduler() override;
+
+  // Scheduler
+  TimerPtr createTimer(const TimerCb& cb, Dispatcher& dispatcher) override;
+
+private:
+  class WheelTimer;
+  friend class WheelTimer;
+
+  static constexpr uint32_t SlotBits = 6;
+  static constexpr uint32_t SlotsPerLevel = 1 << SlotBits; // 64
+  static constexpr uint32_t NumLevels = 4;
+
+  using Slot = std::list<WheelTimer*>;
+
+  // Places the timer into the slot covering its deadline tick and arms the driver.
+  void insert(WheelTimer& timer);
+  // Advances the wheel to the current tick, cascading higher levels and firing due timers.
+  void advance();
+  // Moves every timer out of the given slot and re-buckets it by its remaining time.
+  void cascade(uint32_t level, uint32_t slot_index);
+  // Arms the driver timer for the next tick boundary if it is not already pending.
+  void armDriver();
+
+  uint64_t nowTick() const;
+
+  Scheduler& base_scheduler_;
+  TimeSource& time_source_;
+  const std::chrono::milliseconds tick_interval_;
+  const MonotonicTime start_;
+  // The last tick processed by advance(); slots are indexed by absolute tick.
+  uint64_t current_tick_;
+  uint64_t pending_timers_{0};
+  std::array<std::array<Slot, SlotsPerLevel>, NumLevels> wheel_;
+  // Single base-scheduler timer that drives the wheel; created lazily because a Dispatcher is
+  // only available once the first timer is created.
+  TimerPtr driver_timer_;
+};
+
+} // namespace Event
+} // namespace Envoy
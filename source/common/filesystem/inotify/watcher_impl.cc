@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "envoy/api/api.h"
 #include "envoy/common/exception.h"
@@ -13,6 +14,8 @@
 #include "source/common/common/utility.h"
 #include "source/common/filesystem/watcher_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Filesystem {
 
@@ -50,11 +53,18 @@ void WatcherImpl::addWatch(absl::string_view path, uint32_t events, OnChangedCb
 }
 
 void WatcherImpl::onInotifyEvent() {
+  // One logical file change can queue several inotify events (e.g. a rotation that writes a
+  // temporary file and renames it over the watched path). Drain the whole queue first,
+  // coalescing the matched events per watch, and fire each callback once at the end with the
+  // union of its events.
+  absl::flat_hash_map<FileWatch*, uint32_t> pending_events;
+  std::vector<FileWatch*> pending_order;
+
   while (true) {
     uint8_t buffer[sizeof(inotify_event) + NAME_MAX + 1];
     ssize_t rc = read(inotify_fd_, &buffer, sizeof(buffer));
     if (rc == -1 && errno == EAGAIN) {
-      return;
+      break;
     }
     RELEASE_ASSERT(rc >= 0, "");
 
@@ -84,17 +94,28 @@ void WatcherImpl::onInotifyEvent() {
         if (watch.events_ & events) {
           if (watch.file_ == file) {
             ENVOY_LOG(debug, "matched callback: file: {}", file);
-            watch.cb_(events);
           } else if (watch.file_.empty()) {
             ENVOY_LOG(debug, "matched callback: directory: {}", file);
-            watch.cb_(events);
+          } else {
+            continue;
+          }
+          auto& pending = pending_events[&watch];
+          if (pending == 0) {
+            pending_order.push_back(&watch);
           }
+          pending |= events;
         }
       }
 
       index += sizeof(inotify_event) + file_event->len;
     }
   }
+
+  // FileWatch pointers are stable here: watches live in a std::list inside a node hash map and
+  // are never removed, and any watch added by a callback cannot have pending events.
+  for (FileWatch* watch : pending_order) {
+    watch->cb_(pending_events[watch]);
+  }
 }
 
 } // namespace Filesystem
@@ -23,6 +23,7 @@
 #include "source/common/grpc/common.h"
 #include "source/common/grpc/status.h"
 #include "source/common/http/utility.h"
+#include "source/common/json/json_utility.h"
 #include "source/common/protobuf/message_validator_impl.h"
 #include "source/common/protobuf/utility.h"
 #include "source/common/runtime/runtime_features.h"
@@ -58,6 +59,26 @@ const std::regex& getSystemTimeFormatNewlinePattern() {
 }
 const std::regex& getNewlinePattern() { CONSTRUCT_ON_FIRST_USE(std::regex, "\n"); }
 
+// Bounded per-substitution size estimate used when reserving the output line. Variable fields
+// (addresses, durations, header values) are typically no longer than this.
+constexpr size_t EstimatedVariableFieldSize = 32;
+
+// Estimate the formatted line size at config time: literal segments are measured exactly and
+// each substitution gets a bounded estimate, so a typical log line is built without
+// reallocation.
+size_t estimateFormattedSize(const std::vector<FormatterProviderPtr>& providers) {
+  size_t size = 0;
+  for (const FormatterProviderPtr& provider : providers) {
+    if (const auto* literal = dynamic_cast<const PlainStringFormatter*>(provider.get());
+        literal != nullptr) {
+      size += literal->length();
+    } else {
+      size += EstimatedVariableFieldSize;
+    }
+  }
+  return size;
+}
+
 } // namespace
 
 const std::string SubstitutionFormatUtils::DEFAULT_FORMAT =
@@ -126,12 +147,14 @@ const std::string SubstitutionFormatUtils::getHostnameOrDefault() {
 FormatterImpl::FormatterImpl(const std::string& format, bool omit_empty_values)
     : empty_value_string_(omit_empty_values ? EMPTY_STRING : DefaultUnspecifiedValueString) {
   providers_ = SubstitutionFormatParser::parse(format);
+  reserve_size_ = estimateFormattedSize(providers_);
 }
 
 FormatterImpl::FormatterImpl(const std::string& format, bool omit_empty_values,
                              const std::vector<CommandParserPtr>& command_parsers)
     : empty_value_string_(omit_empty_values ? EMPTY_STRING : DefaultUnspecifiedValueString) {
   providers_ = SubstitutionFormatParser::parse(format, command_parsers);
+  reserve_size_ = estimateFormattedSize(providers_);
 }
 
 std::string FormatterImpl::format(const Http::RequestHeaderMap& request_headers,
@@ -140,7 +163,7 @@ std::string FormatterImpl::format(const Http::RequestHeaderMap& request_headers,
                                   const StreamInfo::StreamInfo& stream_info,
                                   absl::string_view local_reply_body) const {
   std::string log_line;
-  log_line.reserve(256);
+  log_line.reserve(reserve_size_);
 
   for (const FormatterProviderPtr& provider : providers_) {
     const auto bit = provider->format(request_headers, response_headers, response_trailers,
@@ -159,9 +182,13 @@ std::string JsonFormatterImpl::format(const Http::RequestHeaderMap& request_head
   const ProtobufWkt::Struct output_struct = struct_formatter_.format(
       request_headers, response_headers, response_trailers, stream_info, local_reply_body);
 
-  const std::string log_line =
-      MessageUtil::getJsonStringFromMessageOrDie(output_struct, false, true);
-  return absl::StrCat(log_line, "\n");
+  // Serialize the output directly rather than through the protobuf JSON printer; the reflection
+  // machinery there is a measurable cost at high log volumes.
+  std::string log_line;
+  log_line.reserve(1024);
+  Json::Utility::appendStructToString(output_struct, log_line);
+  log_line.push_back('\n');
+  return log_line;
 }
 
 StructFormatter::StructFormatter(const ProtobufWkt::Struct& format_mapping, bool preserve_types,
@@ -426,6 +453,24 @@ SubstitutionFormatParser::getKnownFormatters() {
            return std::make_unique<HeadersByteSizeFormatter>(
                HeadersByteSizeFormatter::HeaderType::ResponseTrailers);
          }}},
+       {"REQUEST_HEADERS_COUNT",
+        {CommandSyntaxChecker::COMMAND_ONLY,
+         [](const std::string&, absl::optional<size_t>&) {
+           return std::make_unique<HeadersCountFormatter>(
+               HeadersCountFormatter::HeaderType::RequestHeaders);
+         }}},
+       {"RESPONSE_HEADERS_COUNT",
+        {CommandSyntaxChecker::COMMAND_ONLY,
+         [](const std::string&, absl::optional<size_t>&) {
+           return std::make_unique<HeadersCountFormatter>(
+               HeadersCountFormatter::HeaderType::ResponseHeaders);
+         }}},
+       {"RESPONSE_TRAILERS_COUNT",
+        {CommandSyntaxChecker::COMMAND_ONLY,
+         [](const std::string&, absl::optional<size_t>&) {
+           return std::make_unique<HeadersCountFormatter>(
+               HeadersCountFormatter::HeaderType::ResponseTrailers);
+         }}},
        {"START_TIME",
         {CommandSyntaxChecker::PARAMS_OPTIONAL,
          [](const std::string& format, const absl::optional<size_t>&) {
@@ -1811,6 +1856,40 @@ HeadersByteSizeFormatter::formatValue(const Http::RequestHeaderMap& request_head
       extractHeadersByteSize(request_headers, response_headers, response_trailers));
 }
 
+HeadersCountFormatter::HeadersCountFormatter(const HeaderType header_type)
+    : header_type_(header_type) {}
+
+uint64_t HeadersCountFormatter::extractHeadersCount(
+    const Http::RequestHeaderMap& request_headers, const Http::ResponseHeaderMap& response_headers,
+    const Http::ResponseTrailerMap& response_trailers) const {
+  switch (header_type_) {
+  case HeaderType::RequestHeaders:
+    return request_headers.size();
+  case HeaderType::ResponseHeaders:
+    return response_headers.size();
+  case HeaderType::ResponseTrailers:
+    return response_trailers.size();
+  }
+  PANIC_DUE_TO_CORRUPT_ENUM;
+}
+
+absl::optional<std::string>
+HeadersCountFormatter::format(const Http::RequestHeaderMap& request_headers,
+                              const Http::ResponseHeaderMap& response_headers,
+                              const Http::ResponseTrailerMap& response_trailers,
+                              const StreamInfo::StreamInfo&, absl::string_view) const {
+  return absl::StrCat(extractHeadersCount(request_headers, response_headers, response_trailers));
+}
+
+ProtobufWkt::Value
+HeadersCountFormatter::formatValue(const Http::RequestHeaderMap& request_headers,
+                                   const Http::ResponseHeaderMap& response_headers,
+                                   const Http::ResponseTrailerMap& response_trailers,
+                                   const StreamInfo::StreamInfo&, absl::string_view) const {
+  return ValueUtil::numberValue(
+      extractHeadersCount(request_headers, response_headers, response_trailers));
+}
+
 GrpcStatusFormatter::Format GrpcStatusFormatter::parseFormat(absl::string_view format) {
   if (format.empty() || format == "CAMEL_STRING") {
     return GrpcStatusFormatter::CamelString;
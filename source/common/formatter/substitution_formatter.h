@@ -156,6 +156,9 @@ public:
 private:
   const std::string& empty_value_string_;
   std::vector<FormatterProviderPtr> providers_;
+  // Output reservation computed at config time from the literal lengths plus a bounded estimate
+  // per substitution, so format() typically fills its output without reallocating.
+  size_t reserve_size_{0};
 };
 
 // Helper classes for StructFormatter::StructFormatMapVisitor.
@@ -279,6 +282,9 @@ public:
                                  const Http::ResponseTrailerMap&, const StreamInfo::StreamInfo&,
                                  absl::string_view) const override;
 
+  // Length of the literal, used for output size accounting at config time.
+  size_t length() const { return str_.string_value().length(); }
+
 private:
   ProtobufWkt::Value str_;
 };
@@ -362,6 +368,33 @@ private:
   HeaderType header_type_;
 };
 
+/**
+ * FormatterProvider for the number of entries in the request/response header maps. Together with
+ * the *_BYTES commands this captures the shape of a request without logging any payload.
+ */
+class HeadersCountFormatter : public FormatterProvider {
+public:
+  enum class HeaderType { RequestHeaders, ResponseHeaders, ResponseTrailers };
+
+  HeadersCountFormatter(const HeaderType header_type);
+
+  absl::optional<std::string> format(const Http::RequestHeaderMap& request_headers,
+                                     const Http::ResponseHeaderMap& response_headers,
+                                     const Http::ResponseTrailerMap& response_trailers,
+                                     const StreamInfo::StreamInfo&,
+                                     absl::string_view) const override;
+  ProtobufWkt::Value formatValue(const Http::RequestHeaderMap& request_headers,
+                                 const Http::ResponseHeaderMap& response_headers,
+                                 const Http::ResponseTrailerMap& response_trailers,
+                                 const StreamInfo::StreamInfo&, absl::string_view) const override;
+
+private:
+  uint64_t extractHeadersCount(const Http::RequestHeaderMap& request_headers,
+                               const Http::ResponseHeaderMap& response_headers,
+                               const Http::ResponseTrailerMap& response_trailers) const;
+  HeaderType header_type_;
+};
+
 /**
  * FormatterProvider for request headers.
  */
@@ -7,6 +7,8 @@
 #include "source/common/common/utility.h"
 #include "source/common/grpc/common.h"
 #include "source/common/http/header_map_impl.h"
+#include "source/common/http/headers.h"
+#include "source/common/http/message_impl.h"
 #include "source/common/http/utility.h"
 
 #include "absl/strings/str_cat.h"
@@ -49,6 +51,18 @@ AsyncRequest* AsyncClientImpl::sendRaw(absl::string_view service_full_name,
   return async_request;
 }
 
+const std::string& AsyncClientImpl::methodPath(absl::string_view service_full_name,
+                                               absl::string_view method_name) {
+  for (const auto& entry : method_paths_) {
+    if (entry.service_full_name_ == service_full_name && entry.method_name_ == method_name) {
+      return entry.path_;
+    }
+  }
+  method_paths_.push_back({std::string(service_full_name), std::string(method_name),
+                           absl::StrCat("/", service_full_name, "/", method_name)});
+  return method_paths_.back().path_;
+}
+
 RawAsyncStream* AsyncClientImpl::startRaw(absl::string_view service_full_name,
                                           absl::string_view method_name,
                                           RawAsyncStreamCallbacks& callbacks,
@@ -92,9 +106,22 @@ void AsyncStreamImpl::initialize(bool buffer_body_for_retry) {
 
   // TODO(htuch): match Google gRPC base64 encoding behavior for *-bin headers, see
   // https://github.com/envoyproxy/envoy/pull/2444#discussion_r163914459.
-  headers_message_ = Common::prepareHeaders(
-      parent_.host_name_.empty() ? parent_.remote_cluster_name_ : parent_.host_name_,
-      service_full_name_, method_name_, options_.timeout);
+  // The static initial metadata is set by reference to client-owned strings: the method path is
+  // composed once per distinct method and the authority is fixed at configuration time. The
+  // client outlives its streams (it resets them all on destruction), so the references stay
+  // valid. Same header order as Common::prepareHeaders(): per
+  // https://github.com/grpc/grpc/blob/master/doc/PROTOCOL-HTTP2.md TE appears before Timeout
+  // and ContentType.
+  headers_message_ = std::make_unique<Http::RequestMessageImpl>();
+  auto& headers = headers_message_->headers();
+  headers.setReferenceMethod(Http::Headers::get().MethodValues.Post);
+  headers.setReferencePath(parent_.methodPath(service_full_name_, method_name_));
+  headers.setReferenceHost(parent_.authority());
+  headers.setReferenceTE(Http::Headers::get().TEValues.Trailers);
+  if (options_.timeout) {
+    Common::toGrpcTimeout(options_.timeout.value(), headers);
+  }
+  headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Grpc);
   // Fill service-wide initial metadata.
   // TODO(cpakulski): Find a better way to access requestHeaders after runtime guard
   // envoy_reloadable_features_unified_header_formatter runtime guard is deprecated and
@@ -37,11 +37,28 @@ public:
   absl::string_view destination() override { return remote_cluster_name_; }
 
 private:
+  // Returns a client-owned fully qualified method path ("/package.Service/Method"), composed on
+  // first use and reused by reference for every subsequent call to the same method.
+  const std::string& methodPath(absl::string_view service_full_name,
+                                absl::string_view method_name);
+  const std::string& authority() const {
+    return host_name_.empty() ? remote_cluster_name_ : host_name_;
+  }
+
+  struct MethodPath {
+    std::string service_full_name_;
+    std::string method_name_;
+    std::string path_;
+  };
+
   Upstream::ClusterManager& cm_;
   const std::string remote_cluster_name_;
   // The host header value in the http transport.
   const std::string host_name_;
   std::list<AsyncStreamImplPtr> active_streams_;
+  // Internal gRPC clients call a small fixed set of methods, so the cache is a linear scan over
+  // a list; the list gives the cached paths stable addresses so streams can reference them.
+  std::list<MethodPath> method_paths_;
   TimeSource& time_source_;
   Router::HeaderParserPtr metadata_parser_;
 
@@ -123,18 +123,22 @@ absl::optional<Status::GrpcStatus> Common::getGrpcStatus(const Http::ResponseTra
   //   1. trailers gRPC status, if it exists.
   //   2. headers gRPC status, if it exists.
   //   3. Inferred from info HTTP status, if it exists.
-  const std::array<absl::optional<Grpc::Status::GrpcStatus>, 3> optional_statuses = {{
-      {Grpc::Common::getGrpcStatus(trailers, allow_user_defined)},
-      {Grpc::Common::getGrpcStatus(headers, allow_user_defined)},
-      {info.responseCode() ? absl::optional<Grpc::Status::GrpcStatus>(
-                                 Grpc::Utility::httpToGrpcStatus(info.responseCode().value()))
-                           : absl::nullopt},
-  }};
-
-  for (const auto& optional_status : optional_statuses) {
-    if (optional_status.has_value()) {
-      return optional_status;
-    }
+  // Each source is only consulted when the previous one had no status; for well-formed gRPC
+  // responses the trailer probe settles it.
+  const absl::optional<Status::GrpcStatus> trailers_status =
+      Grpc::Common::getGrpcStatus(trailers, allow_user_defined);
+  if (trailers_status.has_value()) {
+    return trailers_status;
+  }
+
+  const absl::optional<Status::GrpcStatus> headers_status =
+      Grpc::Common::getGrpcStatus(headers, allow_user_defined);
+  if (headers_status.has_value()) {
+    return headers_status;
+  }
+
+  if (info.responseCode().has_value()) {
+    return {Grpc::Utility::httpToGrpcStatus(info.responseCode().value())};
   }
 
   return absl::nullopt;
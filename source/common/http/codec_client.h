@@ -94,6 +94,11 @@ public:
    */
   uint64_t id() const { return connection_->id(); }
 
+  /**
+   * @return the underlying network connection.
+   */
+  const Network::Connection& connection() const { return *connection_; }
+
   /**
    * @return the underlying codec protocol.
    */
@@ -20,27 +20,37 @@ namespace Http {
 
 CodeStatsImpl::CodeStatsImpl(Stats::SymbolTable& symbol_table)
     : stat_name_pool_(symbol_table), symbol_table_(symbol_table),
-      canary_(stat_name_pool_.add("canary")), external_(stat_name_pool_.add("external")),
-      internal_(stat_name_pool_.add("internal")),
-      upstream_rq_1xx_(stat_name_pool_.add("upstream_rq_1xx")),
-      upstream_rq_2xx_(stat_name_pool_.add("upstream_rq_2xx")),
-      upstream_rq_3xx_(stat_name_pool_.add("upstream_rq_3xx")),
-      upstream_rq_4xx_(stat_name_pool_.add("upstream_rq_4xx")),
-      upstream_rq_5xx_(stat_name_pool_.add("upstream_rq_5xx")),
-      upstream_rq_unknown_(stat_name_pool_.add("upstream_rq_unknown")), // Covers invalid http
-                                                                        // response codes e.g. 600.
-      upstream_rq_completed_(stat_name_pool_.add("upstream_rq_completed")),
-      upstream_rq_time_(stat_name_pool_.add("upstream_rq_time")),
       vcluster_(stat_name_pool_.add("vcluster")), vhost_(stat_name_pool_.add("vhost")),
       route_(stat_name_pool_.add("route")), zone_(stat_name_pool_.add("zone")) {
 
+  // The composite names created here re-use the symbols for the category and
+  // "upstream_rq_*" tokens, so this costs a handful of encodings, not a
+  // handful of symbols.
+  populateRqStatNames("", upstream_rq_);
+  populateRqStatNames("canary", canary_upstream_rq_);
+  populateRqStatNames("internal", internal_upstream_rq_);
+  populateRqStatNames("external", external_upstream_rq_);
+
   // Pre-allocate response codes 200, 404, and 503, as those seem quite likely.
   // We don't pre-allocate all the HTTP codes because the first 127 allocations
   // are likely to be encoded in one byte, and we would rather spend those on
   // common components of stat-names that appear frequently.
-  upstreamRqStatName(Code::OK);
-  upstreamRqStatName(Code::NotFound);
-  upstreamRqStatName(Code::ServiceUnavailable);
+  upstreamRqStatName(upstream_rq_, Code::OK);
+  upstreamRqStatName(upstream_rq_, Code::NotFound);
+  upstreamRqStatName(upstream_rq_, Code::ServiceUnavailable);
+}
+
+void CodeStatsImpl::populateRqStatNames(absl::string_view category, RqStatNames& stat_names) {
+  if (!category.empty()) {
+    stat_names.category_prefix_ = absl::StrCat(category, ".");
+  }
+  const std::string prefix = absl::StrCat(stat_names.category_prefix_, "upstream_rq_");
+  stat_names.completed_ = stat_name_pool_.add(absl::StrCat(prefix, "completed"));
+  stat_names.time_ = stat_name_pool_.add(absl::StrCat(prefix, "time"));
+  stat_names.unknown_ = stat_name_pool_.add(absl::StrCat(prefix, "unknown"));
+  for (uint32_t i = 0; i < stat_names.groups_.size(); ++i) {
+    stat_names.groups_[i] = stat_name_pool_.add(absl::StrCat(prefix, i + 1, "xx"));
+  }
 }
 
 void CodeStatsImpl::incCounter(Stats::Scope& scope, const Stats::StatNameVec& names) const {
@@ -65,14 +75,14 @@ void CodeStatsImpl::chargeBasicResponseStat(Stats::Scope& scope, Stats::StatName
   ASSERT(&symbol_table_ == &scope.symbolTable());
 
   // Build a dynamic stat for the response code and increment it.
-  incCounter(scope, prefix, upstream_rq_completed_);
+  incCounter(scope, prefix, upstream_rq_.completed_);
 
   if (!exclude_http_code_stats) {
-    const Stats::StatName rq_group = upstreamRqGroup(response_code);
+    const Stats::StatName rq_group = upstreamRqGroup(upstream_rq_, response_code);
     if (!rq_group.empty()) {
       incCounter(scope, prefix, rq_group);
     }
-    incCounter(scope, prefix, upstreamRqStatName(response_code));
+    incCounter(scope, prefix, upstreamRqStatName(upstream_rq_, response_code));
   }
 }
 
@@ -83,25 +93,25 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
   ASSERT(&info.cluster_scope_.symbolTable() == &symbol_table_);
   chargeBasicResponseStat(info.cluster_scope_, info.prefix_, code, exclude_http_code_stats);
 
-  const Stats::StatName rq_group = upstreamRqGroup(code);
-  const Stats::StatName rq_code = upstreamRqStatName(code);
+  const Stats::StatName rq_group = upstreamRqGroup(upstream_rq_, code);
+  const Stats::StatName rq_code = upstreamRqStatName(upstream_rq_, code);
 
   // If the response is from a canary, also create canary stats.
   if (info.upstream_canary_) {
-    writeCategory(info, rq_group, rq_code, canary_);
+    writeCategory(info, code, canary_upstream_rq_);
   }
 
   // Split stats into external vs. internal.
   if (info.internal_request_) {
-    writeCategory(info, rq_group, rq_code, internal_);
+    writeCategory(info, code, internal_upstream_rq_);
   } else {
-    writeCategory(info, rq_group, rq_code, external_);
+    writeCategory(info, code, external_upstream_rq_);
   }
 
   // Handle request virtual cluster.
   if (!info.request_vcluster_name_.empty()) {
     incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, vcluster_,
-                                    info.request_vcluster_name_, upstream_rq_completed_});
+                                    info.request_vcluster_name_, upstream_rq_.completed_});
     incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, vcluster_,
                                     info.request_vcluster_name_, rq_group});
     incCounter(info.global_scope_,
@@ -111,7 +121,7 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
   // Handle route level stats.
   if (!info.request_route_name_.empty()) {
     incCounter(info.global_scope_, {vhost_, info.request_vhost_name_, route_,
-                                    info.request_route_name_, upstream_rq_completed_});
+                                    info.request_route_name_, upstream_rq_.completed_});
     incCounter(info.global_scope_,
                {vhost_, info.request_vhost_name_, route_, info.request_route_name_, rq_group});
     incCounter(info.global_scope_,
@@ -121,87 +131,84 @@ void CodeStatsImpl::chargeResponseStat(const ResponseStatInfo& info,
   // Handle per zone stats.
   if (!info.from_zone_.empty() && !info.to_zone_.empty()) {
     incCounter(info.cluster_scope_,
-               {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_completed_});
+               {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_.completed_});
     incCounter(info.cluster_scope_,
                {info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_group});
     incCounter(info.cluster_scope_, {info.prefix_, zone_, info.from_zone_, info.to_zone_, rq_code});
   }
 }
 
-void CodeStatsImpl::writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
-                                  Stats::StatName rq_code, Stats::StatName category) const {
-  incCounter(info.cluster_scope_, {info.prefix_, category, upstream_rq_completed_});
+void CodeStatsImpl::writeCategory(const ResponseStatInfo& info, Code response_code,
+                                  const RqStatNames& category_stat_names) const {
+  incCounter(info.cluster_scope_, info.prefix_, category_stat_names.completed_);
+  const Stats::StatName rq_group = upstreamRqGroup(category_stat_names, response_code);
   if (!rq_group.empty()) {
-    incCounter(info.cluster_scope_, {info.prefix_, category, rq_group});
+    incCounter(info.cluster_scope_, info.prefix_, rq_group);
   }
-  incCounter(info.cluster_scope_, {info.prefix_, category, rq_code});
+  incCounter(info.cluster_scope_, info.prefix_,
+             upstreamRqStatName(category_stat_names, response_code));
 }
 
 void CodeStatsImpl::chargeResponseTiming(const ResponseTimingInfo& info) const {
   const uint64_t count = info.response_time_.count();
-  recordHistogram(info.cluster_scope_, {info.prefix_, upstream_rq_time_},
+  recordHistogram(info.cluster_scope_, {info.prefix_, upstream_rq_.time_},
                   Stats::Histogram::Unit::Milliseconds, count);
   if (info.upstream_canary_) {
-    recordHistogram(info.cluster_scope_, {info.prefix_, canary_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, {info.prefix_, canary_upstream_rq_.time_},
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 
   if (info.internal_request_) {
-    recordHistogram(info.cluster_scope_, {info.prefix_, internal_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, {info.prefix_, internal_upstream_rq_.time_},
                     Stats::Histogram::Unit::Milliseconds, count);
   } else {
-    recordHistogram(info.cluster_scope_, {info.prefix_, external_, upstream_rq_time_},
+    recordHistogram(info.cluster_scope_, {info.prefix_, external_upstream_rq_.time_},
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 
   if (!info.request_vcluster_name_.empty()) {
     recordHistogram(info.global_scope_,
                     {vhost_, info.request_vhost_name_, vcluster_, info.request_vcluster_name_,
-                     upstream_rq_time_},
+                     upstream_rq_.time_},
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 
   if (!info.request_route_name_.empty()) {
     recordHistogram(
         info.global_scope_,
-        {vhost_, info.request_vhost_name_, route_, info.request_route_name_, upstream_rq_time_},
+        {vhost_, info.request_vhost_name_, route_, info.request_route_name_, upstream_rq_.time_},
         Stats::Histogram::Unit::Milliseconds, count);
   }
 
   // Handle per zone stats.
   if (!info.from_zone_.empty() && !info.to_zone_.empty()) {
     recordHistogram(info.cluster_scope_,
-                    {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_time_},
+                    {info.prefix_, zone_, info.from_zone_, info.to_zone_, upstream_rq_.time_},
                     Stats::Histogram::Unit::Milliseconds, count);
   }
 }
 
-Stats::StatName CodeStatsImpl::upstreamRqGroup(Code response_code) const {
-  switch (enumToInt(response_code) / 100) {
-  case 1:
-    return upstream_rq_1xx_;
-  case 2:
-    return upstream_rq_2xx_;
-  case 3:
-    return upstream_rq_3xx_;
-  case 4:
-    return upstream_rq_4xx_;
-  case 5:
-    return upstream_rq_5xx_;
+Stats::StatName CodeStatsImpl::upstreamRqGroup(const RqStatNames& stat_names,
+                                               Code response_code) const {
+  const uint64_t group_index = enumToInt(response_code) / 100;
+  if (group_index < 1 || group_index > stat_names.groups_.size()) {
+    return empty_; // Unknown codes do not go into a group.
   }
-  return empty_; // Unknown codes do not go into a group.
+  return stat_names.groups_[group_index - 1];
 }
 
-Stats::StatName CodeStatsImpl::upstreamRqStatName(Code response_code) const {
+Stats::StatName CodeStatsImpl::upstreamRqStatName(const RqStatNames& stat_names,
+                                                  Code response_code) const {
   // Take a lock only if we've never seen this response-code before.
   const uint32_t rc_index = static_cast<uint32_t>(response_code) - HttpCodeOffset;
   if (rc_index >= NumHttpCodes) {
-    return upstream_rq_unknown_;
+    return stat_names.unknown_;
   }
-  return Stats::StatName(rc_stat_names_.get(rc_index, [this, response_code]() -> const uint8_t* {
-    return stat_name_pool_.addReturningStorage(
-        absl::StrCat("upstream_rq_", enumToInt(response_code)));
-  }));
+  return Stats::StatName(stat_names.rc_stat_names_.get(
+      rc_index, [this, &stat_names, response_code]() -> const uint8_t* {
+        return stat_name_pool_.addReturningStorage(absl::StrCat(
+            stat_names.category_prefix_, "upstream_rq_", enumToInt(response_code)));
+      }));
 }
 
 std::string CodeUtility::groupStringForResponseCode(Code response_code) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <cstdint>
 #include <string>
@@ -56,65 +57,75 @@ public:
 private:
   friend class CodeStatsTest;
 
-  void writeCategory(const ResponseStatInfo& info, Stats::StatName rq_group,
-                     Stats::StatName rq_code, Stats::StatName category) const;
+  static constexpr uint32_t NumHttpCodes = 500;
+  static constexpr uint32_t HttpCodeOffset = 100; // code 100 is at index 0.
+
+  // Pre-encoded composites of a response-stat category ("canary", "internal",
+  // "external", or none) with the "upstream_rq_*" suffixes. The well-known
+  // names are encoded once at construction, and the per-code names on first
+  // use, so that the request-completion path only joins the dynamic cluster
+  // prefix with one pre-encoded name instead of re-joining the static parts
+  // on every request.
+  struct RqStatNames {
+    Stats::StatName completed_;
+    Stats::StatName time_;
+    Stats::StatName unknown_; // Covers invalid http response codes e.g. 600.
+    std::array<Stats::StatName, 5> groups_; // Indexed by response-code class - 1.
+
+    // The prefix prepended when lazily building per-code names, e.g. "canary.".
+    std::string category_prefix_;
+
+    // Use an array of atomic pointers to hold StatNameStorage objects for
+    // every conceivable HTTP response code. In the hot-path we'll reference
+    // these with a null-check, and if we need to allocate a symbol for a
+    // new code, we'll take a mutex to avoid duplicate allocations and
+    // subsequent leaks. This is similar in principle to a ReaderMutexLock,
+    // but should be faster, as ReaderMutexLocks appear to be too expensive for
+    // fine-grained controls. Another option would be to use a lock per
+    // stat-name, which might have similar performance to atomics with default
+    // barrier policy.
+    //
+    // We don't allocate these all up front during construction because
+    // SymbolTable greedily encodes the first 128 names it discovers in one
+    // byte. We don't want those high-value single-byte codes to go to fully
+    // enumerating the 4 prefixes combined with HTTP codes that are seldom used,
+    // so we allocate these on demand.
+    //
+    // There can be multiple symbol tables in a server. The one passed into the
+    // Codes constructor should be the same as the one passed to
+    // Stats::ThreadLocalStore. Note that additional symbol tables can be created
+    // from IsolatedStoreImpl's default constructor.
+    //
+    // The Codes object is global to the server.
+    mutable Thread::AtomicPtrArray<const uint8_t, NumHttpCodes,
+                                   Thread::AtomicPtrAllocMode::DoNotDelete>
+        rc_stat_names_;
+  };
+
+  void populateRqStatNames(absl::string_view category, RqStatNames& stat_names);
+  void writeCategory(const ResponseStatInfo& info, Code response_code,
+                     const RqStatNames& category_stat_names) const;
   void incCounter(Stats::Scope& scope, const Stats::StatNameVec& names) const;
   void incCounter(Stats::Scope& scope, Stats::StatName a, Stats::StatName b) const;
   void recordHistogram(Stats::Scope& scope, const Stats::StatNameVec& names,
                        Stats::Histogram::Unit unit, uint64_t count) const;
 
-  Stats::StatName upstreamRqGroup(Code response_code) const;
-  Stats::StatName upstreamRqStatName(Code response_code) const;
+  Stats::StatName upstreamRqGroup(const RqStatNames& stat_names, Code response_code) const;
+  Stats::StatName upstreamRqStatName(const RqStatNames& stat_names, Code response_code) const;
 
   mutable Stats::StatNamePool stat_name_pool_;
   Stats::SymbolTable& symbol_table_;
 
-  const Stats::StatName canary_;
   const Stats::StatName empty_; // Used for the group-name for invalid http codes.
-  const Stats::StatName external_;
-  const Stats::StatName internal_;
-  const Stats::StatName upstream_;
-  const Stats::StatName upstream_rq_1xx_;
-  const Stats::StatName upstream_rq_2xx_;
-  const Stats::StatName upstream_rq_3xx_;
-  const Stats::StatName upstream_rq_4xx_;
-  const Stats::StatName upstream_rq_5xx_;
-  const Stats::StatName upstream_rq_unknown_;
-  const Stats::StatName upstream_rq_completed_;
-  const Stats::StatName upstream_rq_time_;
   const Stats::StatName vcluster_;
   const Stats::StatName vhost_;
   const Stats::StatName route_;
   const Stats::StatName zone_;
 
-  // Use an array of atomic pointers to hold StatNameStorage objects for
-  // every conceivable HTTP response code. In the hot-path we'll reference
-  // these with a null-check, and if we need to allocate a symbol for a
-  // new code, we'll take a mutex to avoid duplicate allocations and
-  // subsequent leaks. This is similar in principle to a ReaderMutexLock,
-  // but should be faster, as ReaderMutexLocks appear to be too expensive for
-  // fine-grained controls. Another option would be to use a lock per
-  // stat-name, which might have similar performance to atomics with default
-  // barrier policy.
-  //
-  // We don't allocate these all up front during construction because
-  // SymbolTable greedily encodes the first 128 names it discovers in one
-  // byte. We don't want those high-value single-byte codes to go to fully
-  // enumerating the 4 prefixes combined with HTTP codes that are seldom used,
-  // so we allocate these on demand.
-  //
-  // There can be multiple symbol tables in a server. The one passed into the
-  // Codes constructor should be the same as the one passed to
-  // Stats::ThreadLocalStore. Note that additional symbol tables can be created
-  // from IsolatedStoreImpl's default constructor.
-  //
-  // The Codes object is global to the server.
-
-  static constexpr uint32_t NumHttpCodes = 500;
-  static constexpr uint32_t HttpCodeOffset = 100; // code 100 is at index 0.
-  mutable Thread::AtomicPtrArray<const uint8_t, NumHttpCodes,
-                                 Thread::AtomicPtrAllocMode::DoNotDelete>
-      rc_stat_names_;
+  RqStatNames upstream_rq_;
+  RqStatNames canary_upstream_rq_;
+  RqStatNames internal_upstream_rq_;
+  RqStatNames external_upstream_rq_;
 };
 
 /**
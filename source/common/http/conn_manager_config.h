@@ -83,6 +83,7 @@ namespace Http {
   GAUGE(downstream_cx_upgrades_active, Accumulate)                                                 \
   GAUGE(downstream_rq_active, Accumulate)                                                          \
   HISTOGRAM(downstream_cx_length_ms, Milliseconds)                                                 \
+  HISTOGRAM(downstream_cx_read_dispatch_us, Microseconds)                                          \
   HISTOGRAM(downstream_rq_time, Milliseconds)
 
 /**
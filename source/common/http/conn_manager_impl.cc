@@ -28,6 +28,7 @@
 #include "source/common/common/empty_string.h"
 #include "source/common/common/enum_to_int.h"
 #include "source/common/common/fmt.h"
+#include "source/common/common/hash.h"
 #include "source/common/common/perf_tracing.h"
 #include "source/common/common/scope_tracker.h"
 #include "source/common/common/utility.h"
@@ -55,6 +56,12 @@
 namespace Envoy {
 namespace Http {
 
+bool expandAgnosticStreamLifetimeEnabled() {
+  static Runtime::CachedRuntimeFeature expand_agnostic_stream_lifetime(
+      Runtime::expand_agnostic_stream_lifetime);
+  return expand_agnostic_stream_lifetime.enabled();
+}
+
 bool requestWasConnect(const RequestHeaderMapSharedPtr& headers, Protocol protocol) {
   if (!headers) {
     return false;
@@ -158,7 +165,8 @@ void ConnectionManagerImpl::initializeReadFilterCallbacks(Network::ReadFilterCal
   read_callbacks_->connection().setConnectionStats(
       {stats_.named_.downstream_cx_rx_bytes_total_, stats_.named_.downstream_cx_rx_bytes_buffered_,
        stats_.named_.downstream_cx_tx_bytes_total_, stats_.named_.downstream_cx_tx_bytes_buffered_,
-       nullptr, &stats_.named_.downstream_cx_delayed_close_timeout_});
+       nullptr, &stats_.named_.downstream_cx_delayed_close_timeout_,
+       &stats_.named_.downstream_cx_read_dispatch_us_});
 }
 
 ConnectionManagerImpl::~ConnectionManagerImpl() {
@@ -255,12 +263,13 @@ void ConnectionManagerImpl::doEndStream(ActiveStream& stream, bool check_for_def
   bool request_complete = stream.filter_manager_.remoteDecodeComplete();
 
   if (check_for_deferred_close) {
+    static Runtime::CachedRuntimeFeature no_delay_close_for_upgrades(
+        "envoy.reloadable_features.no_delay_close_for_upgrades");
     // Don't do delay close for responses which are framed by connection close:
     // HTTP/1.0 and below, upgrades, and CONNECT responses.
     checkForDeferredClose(
         (connection_close && (request_complete || http_10_sans_cl)) ||
-        (stream.state_.is_tunneling_ &&
-         Runtime::runtimeFeatureEnabled("envoy.reloadable_features.no_delay_close_for_upgrades")));
+        (stream.state_.is_tunneling_ && no_delay_close_for_upgrades.enabled()));
   }
 }
 
@@ -309,15 +318,15 @@ void ConnectionManagerImpl::doDeferredStreamDestroy(ActiveStream& stream) {
   stream.filter_manager_.onStreamComplete();
   stream.streamInfo().setStreamState(StreamInfo::StreamState::Ended);
 
+  static Runtime::CachedRuntimeFeature quic_defer_logging_to_ack_listener(
+      "envoy.reloadable_features.quic_defer_logging_to_ack_listener");
   // For HTTP/3, skip access logging here and add deferred logging info
   // to stream info for QuicStatsGatherer to use later.
   if (codec_ && codec_->protocol() == Protocol::Http3 &&
       // There was a downstream reset, log immediately.
       !stream.filter_manager_.sawDownstreamReset() &&
       // On recreate stream, log immediately.
-      stream.response_encoder_ != nullptr &&
-      Runtime::runtimeFeatureEnabled(
-          "envoy.reloadable_features.quic_defer_logging_to_ack_listener")) {
+      stream.response_encoder_ != nullptr && quic_defer_logging_to_ack_listener.enabled()) {
     stream.deferHeadersAndTrailers();
   } else {
     // For HTTP/1 and HTTP/2, log here as usual.
@@ -735,8 +744,7 @@ ConnectionManagerImpl::ActiveStream::ActiveStream(ConnectionManagerImpl& connect
                       StreamInfo::FilterState::LifeSpan::Connection),
       request_response_timespan_(new Stats::HistogramCompletableTimespanImpl(
           connection_manager_.stats_.named_.downstream_rq_time_, connection_manager_.timeSource())),
-      expand_agnostic_stream_lifetime_(
-          Runtime::runtimeFeatureEnabled(Runtime::expand_agnostic_stream_lifetime)),
+      expand_agnostic_stream_lifetime_(expandAgnosticStreamLifetimeEnabled()),
       header_validator_(
           connection_manager.config_.makeHeaderValidator(connection_manager.codec_->protocol())) {
   ASSERT(!connection_manager.config_.isRoutable() ||
@@ -1470,6 +1478,13 @@ void ConnectionManagerImpl::ActiveStream::refreshDurationTimeout() {
 void ConnectionManagerImpl::ActiveStream::refreshCachedRoute(const Router::RouteCallback& cb) {
   Router::RouteConstSharedPtr route;
   if (request_headers_ != nullptr) {
+    // Latch route match phase timings so that per-stream consumers (access logs, CEL) can
+    // attribute time spent inside route resolution. If a filter refreshes the route the
+    // timestamps describe the most recent match.
+    StreamInfo::DownstreamTiming& downstream_timing =
+        filter_manager_.streamInfo().downstreamTiming();
+    downstream_timing.setValue(RouteMatchStartKey,
+                               connection_manager_.timeSource().monotonicTime());
     if (connection_manager_.config_.isRoutable() &&
         connection_manager_.config_.scopedRouteConfigProvider() != nullptr) {
       // NOTE: re-select scope as well in case the scope key header has been changed by a filter.
@@ -1479,9 +1494,25 @@ void ConnectionManagerImpl::ActiveStream::refreshCachedRoute(const Router::Route
       route = snapped_route_config_->route(cb, *request_headers_, filter_manager_.streamInfo(),
                                            stream_id_);
     }
+    downstream_timing.setValue(RouteMatchEndKey,
+                               connection_manager_.timeSource().monotonicTime());
   }
 
   setRoute(route);
+  route_matching_inputs_hash_ = routeMatchingInputsHash();
+}
+
+absl::optional<uint64_t> ConnectionManagerImpl::ActiveStream::routeMatchingInputsHash() const {
+  if (request_headers_ == nullptr) {
+    return absl::nullopt;
+  }
+  uint64_t hash = 0;
+  request_headers_->iterate([&hash](const HeaderEntry& header) -> HeaderMap::Iterate {
+    hash = HashUtil::xxHash64(header.key().getStringView(), hash);
+    hash = HashUtil::xxHash64(header.value().getStringView(), hash);
+    return HeaderMap::Iterate::Continue;
+  });
+  return hash;
 }
 
 void ConnectionManagerImpl::ActiveStream::refreshCachedTracingCustomTags() {
@@ -1859,6 +1890,9 @@ ConnectionManagerImpl::ActiveStream::route(const Router::RouteCallback& cb) {
  * functions as a helper to refreshCachedRoute(const Router::RouteCallback& cb).
  */
 void ConnectionManagerImpl::ActiveStream::setRoute(Router::RouteConstSharedPtr route) {
+  // The hash only describes routes produced by matching; refreshCachedRoute() re-establishes
+  // it after a match. A route set directly by a filter must always be clearable.
+  route_matching_inputs_hash_.reset();
   filter_manager_.streamInfo().route_ = route;
   cached_route_ = std::move(route);
   if (nullptr == filter_manager_.streamInfo().route() ||
@@ -1909,6 +1943,21 @@ void ConnectionManagerImpl::ActiveStream::refreshAccessLogFlushTimer() {
 }
 
 void ConnectionManagerImpl::ActiveStream::clearRouteCache() {
+  // Filter chains commonly clear the route cache defensively after header mutation even when
+  // none of the inputs route matching consults have changed. Re-running the full route match
+  // in that case is pure overhead, so when the (opt-in) feature is enabled, keep the cached
+  // route if the request headers hash to the same value as when the route was resolved. This
+  // is intentionally not enabled by default since matching on dynamic metadata or filter
+  // state is not covered by the hash.
+  static Runtime::CachedRuntimeFeature skip_route_refresh_for_unchanged_headers(
+      "envoy.reloadable_features.http_skip_route_refresh_for_unchanged_headers");
+  if (route_matching_inputs_hash_.has_value() &&
+      skip_route_refresh_for_unchanged_headers.enabled() &&
+      routeMatchingInputsHash() == route_matching_inputs_hash_) {
+    ENVOY_STREAM_LOG(debug, "route cache clear skipped, matching inputs unchanged", *this);
+    return;
+  }
+  route_matching_inputs_hash_.reset();
   cached_route_ = absl::optional<Router::RouteConstSharedPtr>();
   cached_cluster_info_ = absl::optional<Upstream::ClusterInfoConstSharedPtr>();
   if (tracing_custom_tags_) {
@@ -314,6 +314,17 @@ private:
     void refreshCachedRoute();
     void refreshCachedRoute(const Router::RouteCallback& cb);
 
+    // Keys for the route match phase timestamps latched into DownstreamTiming. The naming
+    // follows the keys recorded by the dynamic forward proxy filter.
+    static constexpr absl::string_view RouteMatchStartKey =
+        "envoy.conn_manager.route_match_start_ms";
+    static constexpr absl::string_view RouteMatchEndKey = "envoy.conn_manager.route_match_end_ms";
+
+    // Hash of the request headers (which subsume the path, host, method and query string
+    // inputs to route matching), used to detect no-op clearRouteCache() calls. nullopt when
+    // no route has been resolved or request headers are not available.
+    absl::optional<uint64_t> routeMatchingInputsHash() const;
+
     void refreshCachedTracingCustomTags();
     void refreshDurationTimeout();
     void refreshIdleTimeout();
@@ -442,6 +453,8 @@ private:
     const bool expand_agnostic_stream_lifetime_;
     absl::optional<Router::RouteConstSharedPtr> cached_route_;
     absl::optional<Upstream::ClusterInfoConstSharedPtr> cached_cluster_info_;
+    // Value of routeMatchingInputsHash() when cached_route_ was last resolved.
+    absl::optional<uint64_t> route_matching_inputs_hash_;
     const std::string* decorated_operation_{nullptr};
     std::unique_ptr<RdsRouteConfigUpdateRequester> route_config_update_requester_;
     std::unique_ptr<Tracing::CustomTagMap> tracing_custom_tags_{nullptr};
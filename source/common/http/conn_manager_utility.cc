@@ -550,14 +550,16 @@ ConnectionManagerUtility::maybeNormalizePath(RequestHeaderMap& request_headers,
 
   auto fragment_pos = request_headers.getPathValue().find('#');
   if (fragment_pos != absl::string_view::npos) {
-    if (Runtime::runtimeFeatureEnabled(
-            "envoy.reloadable_features.http_reject_path_with_fragment")) {
+    static Runtime::CachedRuntimeFeature reject_path_with_fragment(
+        "envoy.reloadable_features.http_reject_path_with_fragment");
+    if (reject_path_with_fragment.enabled()) {
       return NormalizePathAction::Reject;
     }
     // Check runtime override and throw away fragment from URI path
     // TODO(yanavlasov): remove this override after deprecation period.
-    if (Runtime::runtimeFeatureEnabled(
-            "envoy.reloadable_features.http_strip_fragment_from_path_unsafe_if_disabled")) {
+    static Runtime::CachedRuntimeFeature strip_fragment_from_path(
+        "envoy.reloadable_features.http_strip_fragment_from_path_unsafe_if_disabled");
+    if (strip_fragment_from_path.enabled()) {
       request_headers.setPath(request_headers.getPathValue().substr(0, fragment_pos));
     }
   }
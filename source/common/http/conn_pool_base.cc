@@ -93,6 +93,26 @@ void HttpConnPoolImplBase::onPoolReady(Envoy::ConnectionPool::ActiveClient& clie
                         http_client->codec_client_->protocol());
 }
 
+void HttpConnPoolImplBase::onConnected(Envoy::ConnectionPool::ActiveClient& client) {
+  // In the mixed ALPN pool the first Connected event fires for the raw TCP client, which has
+  // no protocol; only the replacement HTTP client is reported.
+  if (lifetime_callbacks_ == nullptr || !client.protocol().has_value()) {
+    return;
+  }
+  ActiveClient* http_client = static_cast<ActiveClient*>(&client);
+  lifetime_callbacks_->onConnectionOpen(*this, lifetime_hash_key_,
+                                        http_client->codec_client_->connection());
+}
+
+void HttpConnPoolImplBase::onClientDraining(Envoy::ConnectionPool::ActiveClient& client) {
+  if (lifetime_callbacks_ == nullptr || !client.protocol().has_value()) {
+    return;
+  }
+  ActiveClient* http_client = static_cast<ActiveClient*>(&client);
+  lifetime_callbacks_->onConnectionDraining(*this, lifetime_hash_key_,
+                                            http_client->codec_client_->connection());
+}
+
 // All streams are 2^31. Client streams are half that, minus stream 0. Just to be on the safe
 // side we do 2^29.
 static const uint64_t DEFAULT_MAX_STREAMS = (1 << 29);
@@ -72,6 +72,12 @@ public:
                                          const Instance::StreamOptions& options) override;
   bool maybePreconnect(float ratio) override { return maybePreconnectImpl(ratio); }
   bool hasActiveConnections() const override;
+  void setConnectionLifetimeCallbacks(std::vector<uint8_t> hash_key,
+                                      Http::ConnectionPool::ConnectionLifetimeCallbacks& callbacks)
+      override {
+    lifetime_hash_key_ = std::move(hash_key);
+    lifetime_callbacks_ = &callbacks;
+  }
 
   // Creates a new PendingStream and enqueues it into the queue.
   ConnectionPool::Cancellable* newPendingStream(Envoy::ConnectionPool::AttachContext& context,
@@ -96,7 +102,13 @@ protected:
 
   void setOrigin(absl::optional<HttpServerPropertiesCache::Origin> origin) { origin_ = origin; }
 
+  // Envoy::ConnectionPool::ConnPoolImplBase
+  void onConnected(Envoy::ConnectionPool::ActiveClient& client) override;
+  void onClientDraining(Envoy::ConnectionPool::ActiveClient& client) override;
+
   Random::RandomGenerator& random_generator_;
+  std::vector<uint8_t> lifetime_hash_key_;
+  Http::ConnectionPool::ConnectionLifetimeCallbacks* lifetime_callbacks_{};
 
 private:
   absl::optional<HttpServerPropertiesCache::Origin> origin_;
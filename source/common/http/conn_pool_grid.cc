@@ -277,6 +277,18 @@ absl::optional<ConnectivityGrid::PoolIterator> ConnectivityGrid::createNextPool(
 
 void ConnectivityGrid::setupPool(ConnectionPool::Instance& pool) {
   pool.addIdleCallback([this]() { onIdleReceived(); });
+  if (lifetime_callbacks_ != nullptr) {
+    pool.setConnectionLifetimeCallbacks(lifetime_hash_key_, *lifetime_callbacks_);
+  }
+}
+
+void ConnectivityGrid::setConnectionLifetimeCallbacks(
+    std::vector<uint8_t> hash_key, ConnectionPool::ConnectionLifetimeCallbacks& callbacks) {
+  lifetime_hash_key_ = std::move(hash_key);
+  lifetime_callbacks_ = &callbacks;
+  for (const auto& pool : pools_) {
+    pool->setConnectionLifetimeCallbacks(lifetime_hash_key_, *lifetime_callbacks_);
+  }
 }
 
 bool ConnectivityGrid::hasActiveConnections() const {
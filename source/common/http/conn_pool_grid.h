@@ -155,6 +155,9 @@ public:
   Upstream::HostDescriptionConstSharedPtr host() const override;
   bool maybePreconnect(float preconnect_ratio) override;
   absl::string_view protocolDescription() const override { return "connection grid"; }
+  void setConnectionLifetimeCallbacks(std::vector<uint8_t> hash_key,
+                                      ConnectionPool::ConnectionLifetimeCallbacks& callbacks)
+      override;
 
   // Returns the next pool in the ordered priority list.
   absl::optional<PoolIterator> nextPool(PoolIterator pool_it);
@@ -224,6 +227,10 @@ private:
   // desired use.
   std::list<ConnectionPool::InstancePtr> pools_;
 
+  // Lifetime callbacks to install on each pool as it is created.
+  std::vector<uint8_t> lifetime_hash_key_;
+  ConnectionPool::ConnectionLifetimeCallbacks* lifetime_callbacks_{};
+
   // True iff under the stack of the destructor, to avoid calling drain
   // callbacks on deletion.
   bool destroying_{};
@@ -12,27 +12,31 @@ public:
   DateProviderDateFormatter() : DateFormatter("%a, %d %b %Y %H:%M:%S GMT") {}
 };
 using DateProviderDateFormatterSingleton = ConstSingleton<DateProviderDateFormatter>;
+
+constexpr std::chrono::milliseconds RefreshInterval{500};
+
 } // namespace
 
 TlsCachingDateProviderImpl::TlsCachingDateProviderImpl(Event::Dispatcher& dispatcher,
                                                        ThreadLocal::SlotAllocator& tls)
-    : DateProviderImplBase(dispatcher.timeSource()), tls_(tls.allocateSlot()),
-      refresh_timer_(dispatcher.createTimer([this]() -> void { onRefreshDate(); })) {
-
-  onRefreshDate();
+    : DateProviderImplBase(dispatcher.timeSource()), tls_(tls.allocateSlot()) {
+  tls_->set(
+      [this](Event::Dispatcher& thread_dispatcher) -> ThreadLocal::ThreadLocalObjectSharedPtr {
+        return std::make_shared<ThreadLocalCachedDate>(thread_dispatcher, time_source_);
+      });
 }
 
-void TlsCachingDateProviderImpl::onRefreshDate() {
-  std::string new_date_string = DateProviderDateFormatterSingleton::get().now(time_source_);
-  tls_->set([new_date_string](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
-    return std::make_shared<ThreadLocalCachedDate>(new_date_string);
-  });
-
-  refresh_timer_->enableTimer(std::chrono::milliseconds(500));
+const std::string& TlsCachingDateProviderImpl::ThreadLocalCachedDate::dateString() {
+  const MonotonicTime now = dispatcher_.approximateMonotonicTime();
+  if (date_string_.empty() || now - last_refresh_ >= RefreshInterval) {
+    last_refresh_ = now;
+    date_string_ = DateProviderDateFormatterSingleton::get().now(time_source_);
+  }
+  return date_string_;
 }
 
 void TlsCachingDateProviderImpl::setDateHeader(ResponseHeaderMap& headers) {
-  headers.setDate(tls_->getTyped<ThreadLocalCachedDate>().date_string_);
+  headers.setDate(tls_->getTyped<ThreadLocalCachedDate>().dateString());
 }
 
 void SlowDateProviderImpl::setDateHeader(ResponseHeaderMap& headers) {
@@ -26,8 +26,10 @@ protected:
 };
 
 /**
- * A caching thread local provider. This implementation updates the date string every 500ms and
- * caches on each thread.
+ * A caching thread local provider. Each worker keeps its own formatted date string and
+ * refreshes it at most every 500ms. Staleness is decided with the dispatcher's approximate
+ * monotonic time (updated once per event loop iteration), so the request path involves no
+ * syscall, no cross-thread updates and no shared cache lines.
  */
 class TlsCachingDateProviderImpl : public DateProviderImplBase, public Singleton::Instance {
 public:
@@ -38,15 +40,19 @@ public:
 
 private:
   struct ThreadLocalCachedDate : public ThreadLocal::ThreadLocalObject {
-    ThreadLocalCachedDate(const std::string& date_string) : date_string_(date_string) {}
+    ThreadLocalCachedDate(Event::Dispatcher& dispatcher, TimeSource& time_source)
+        : dispatcher_(dispatcher), time_source_(time_source) {}
 
-    const std::string date_string_;
-  };
+    // Returns the cached date string, re-formatting it first if stale.
+    const std::string& dateString();
 
-  void onRefreshDate();
+    Event::Dispatcher& dispatcher_;
+    TimeSource& time_source_;
+    std::string date_string_;
+    MonotonicTime last_refresh_;
+  };
 
   ThreadLocal::SlotPtr tls_;
-  Event::TimerPtr refresh_timer_;
 };
 
 /**
@@ -4,6 +4,7 @@
 
 #include "envoy/http/header_map.h"
 #include "envoy/matcher/matcher.h"
+#include "envoy/router/router.h"
 
 #include "source/common/common/enum_to_int.h"
 #include "source/common/common/scope_tracked_object_stack.h"
@@ -497,6 +498,22 @@ void FilterManager::applyFilterFactoryCb(FilterContext context, FilterFactoryCb&
   factory(callbacks);
 }
 
+void DownstreamFilterManager::applyFilterFactoryCb(FilterContext context,
+                                                   FilterFactoryCb& factory) {
+  // If the matched route disables this filter, skip the factory entirely: the filter is neither
+  // constructed nor added to the chain, so disabled filters cost nothing per stream. The route is
+  // cached before filter chain creation so this reflects the route that will serve the stream;
+  // refreshing the route afterwards does not restore a skipped filter. This only applies to
+  // downstream filter chains: route level disabling has no effect on upstream HTTP filters.
+  const Router::RouteConstSharedPtr route = streamInfo().route();
+  if (route != nullptr && route->filterDisabled(context.config_name).value_or(false)) {
+    ENVOY_STREAM_LOG(trace, "filter '{}' is disabled by the route and will not be created", *this,
+                     context.config_name);
+    return;
+  }
+  FilterManager::applyFilterFactoryCb(context, factory);
+}
+
 void FilterManager::maybeContinueDecoding(
     const std::list<ActiveStreamDecoderFilterPtr>::iterator& continue_data_entry) {
   if (continue_data_entry != decoder_filters_.end()) {
@@ -646,6 +663,12 @@ void FilterManager::decodeData(ActiveStreamDecoderFilter* filter, Buffer::Instan
     if ((*entry)->end_stream_) {
       return;
     }
+    // Filters that declared body/trailer pass-through behave exactly as if they were invoked
+    // and returned Continue, so skip the dispatch entirely. This keeps the per-chunk cost of
+    // body-agnostic filter chains to one flag test per filter.
+    if ((*entry)->pass_through_body_and_trailers_ && (*entry)->canIterate()) {
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeData));
 
     // We check the request_trailers_ pointer here in case addDecodedTrailers
@@ -751,6 +774,11 @@ void FilterManager::decodeTrailers(ActiveStreamDecoderFilter* filter, RequestTra
     if ((*entry)->stoppedAll()) {
       return;
     }
+    // See the equivalent check in decodeData().
+    if ((*entry)->pass_through_body_and_trailers_ && (*entry)->canIterate()) {
+      (*entry)->end_stream_ = true;
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::DecodeTrailers));
     state_.filter_call_state_ |= FilterCallState::DecodeTrailers;
     FilterTrailersStatus status = (*entry)->handle_->decodeTrailers(trailers);
@@ -1056,6 +1084,11 @@ void FilterManager::encode1xxHeaders(ActiveStreamEncoderFilter* filter,
   // filter. This is simpler than that case because 100 continue implies no
   // end-stream, and because there are normal headers coming there's no need for
   // complex continuation logic.
+  // This loop is also the entirety of the per-1xx overhead beyond the codecs: it runs
+  // synchronously in the dispatcher callback that delivered the upstream 1xx, so a
+  // codec-to-codec bypass would save one virtual call per encoder filter and nothing
+  // else. Filters cannot declare 1xx disinterest up front (and some, e.g. external
+  // processing, do rewrite 1xx responses), so no such bypass is provided.
   // 100-continue filter iteration should always start with the next filter if available.
   std::list<ActiveStreamEncoderFilterPtr>::iterator entry =
       commonEncodePrefix(filter, false, FilterIterationStartState::AlwaysStartFromNext);
@@ -1166,6 +1199,11 @@ void FilterManager::encodeHeaders(ActiveStreamEncoderFilter* filter, ResponseHea
     return;
   }
 
+  // Note on response TTFB: the loop above and this call all run synchronously inside the same
+  // dispatcher callback that delivered the upstream headers, so the headers reach the codec (and
+  // the connection's output buffer) without an intervening event loop iteration. Writing headers
+  // to the wire before the remaining encoder filters have run would not overlap any I/O; it would
+  // only break filters that mutate headers, since headers are immutable once serialized.
   const bool modified_end_stream = (end_stream && continue_data_entry == encoder_filters_.end());
   state_.non_100_response_headers_encoded_ = true;
   filter_manager_callbacks_.encodeHeaders(headers, modified_end_stream);
@@ -1262,6 +1300,10 @@ void FilterManager::encodeData(ActiveStreamEncoderFilter* filter, Buffer::Instan
     if ((*entry)->end_stream_) {
       return;
     }
+    // See the equivalent check in decodeData().
+    if ((*entry)->pass_through_body_and_trailers_ && (*entry)->canIterate()) {
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeData));
 
     // We check the response_trailers_ pointer here in case addEncodedTrailers
@@ -1327,6 +1369,11 @@ void FilterManager::encodeTrailers(ActiveStreamEncoderFilter* filter,
     if ((*entry)->stoppedAll()) {
       return;
     }
+    // See the equivalent check in decodeData().
+    if ((*entry)->pass_through_body_and_trailers_ && (*entry)->canIterate()) {
+      (*entry)->end_stream_ = true;
+      continue;
+    }
     ASSERT(!(state_.filter_call_state_ & FilterCallState::EncodeTrailers));
     state_.filter_call_state_ |= FilterCallState::EncodeTrailers;
     FilterTrailersStatus status = (*entry)->handle_->encodeTrailers(trailers);
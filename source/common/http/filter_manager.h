@@ -24,6 +24,7 @@
 #include "source/common/http/utility.h"
 #include "source/common/local_reply/local_reply.h"
 #include "source/common/matcher/matcher.h"
+#include "source/common/memory/arena.h"
 #include "source/common/protobuf/utility.h"
 #include "source/common/stream_info/stream_info_impl.h"
 
@@ -45,11 +46,23 @@ struct ActiveStreamFilterBase;
 struct ActiveStreamFilterBase : public virtual StreamFilterCallbacks,
                                 Logger::Loggable<Logger::Id::http> {
   ActiveStreamFilterBase(FilterManager& parent, bool is_encoder_decoder_filter,
-                         FilterContext filter_context)
+                         bool pass_through_body_and_trailers, FilterContext filter_context)
       : parent_(parent), iteration_state_(IterationState::Continue),
         filter_context_(std::move(filter_context)), iterate_from_current_filter_(false),
         headers_continued_(false), continued_1xx_headers_(false), end_stream_(false),
-        is_encoder_decoder_filter_(is_encoder_decoder_filter), processed_headers_(false) {}
+        is_encoder_decoder_filter_(is_encoder_decoder_filter),
+        pass_through_body_and_trailers_(pass_through_body_and_trailers),
+        processed_headers_(false) {}
+
+  // Filter wrappers are allocated from the owning FilterManager's per-stream arena so that
+  // building and tearing down the filter chain does not hit the heap once per filter. The
+  // matching operator delete is a no-op: destructors run normally through the wrapper's
+  // unique_ptr, but the storage is reclaimed wholesale when the arena is destroyed with the
+  // stream.
+  static void* operator new(size_t size, Memory::Arena& arena) { return arena.allocate(size); }
+  static void operator delete(void*) noexcept {}
+  // Matching placement delete, called only if a wrapper constructor throws.
+  static void operator delete(void*, Memory::Arena&) noexcept {}
 
   // Functions in the following block are called after the filter finishes processing
   // corresponding data. Those functions handle state updates and data storage (if needed)
@@ -160,6 +173,9 @@ struct ActiveStreamFilterBase : public virtual StreamFilterCallbacks,
   // If true, end_stream is called for this filter.
   bool end_stream_ : 1;
   const bool is_encoder_decoder_filter_ : 1;
+  // Cached value of StreamFilterBase::passThroughBodyAndTrailers() for this filter; when true,
+  // data and trailer iteration skips the filter as if it returned Continue.
+  const bool pass_through_body_and_trailers_ : 1;
   // If true, the filter has processed headers.
   bool processed_headers_ : 1;
 };
@@ -172,7 +188,8 @@ struct ActiveStreamDecoderFilter : public ActiveStreamFilterBase,
                                    LinkedObject<ActiveStreamDecoderFilter> {
   ActiveStreamDecoderFilter(FilterManager& parent, StreamDecoderFilterSharedPtr filter,
                             bool is_encoder_decoder_filter, FilterContext filter_context)
-      : ActiveStreamFilterBase(parent, is_encoder_decoder_filter, std::move(filter_context)),
+      : ActiveStreamFilterBase(parent, is_encoder_decoder_filter,
+                               filter->passThroughBodyAndTrailers(), std::move(filter_context)),
         handle_(std::move(filter)) {
     handle_->setDecoderFilterCallbacks(*this);
   }
@@ -266,7 +283,8 @@ struct ActiveStreamEncoderFilter : public ActiveStreamFilterBase,
                                    LinkedObject<ActiveStreamEncoderFilter> {
   ActiveStreamEncoderFilter(FilterManager& parent, StreamEncoderFilterSharedPtr filter,
                             bool is_encoder_decoder_filter, FilterContext filter_context)
-      : ActiveStreamFilterBase(parent, is_encoder_decoder_filter, std::move(filter_context)),
+      : ActiveStreamFilterBase(parent, is_encoder_decoder_filter,
+                               filter->passThroughBodyAndTrailers(), std::move(filter_context)),
         handle_(std::move(filter)) {
     handle_->setEncoderFilterCallbacks(*this);
   }
@@ -880,24 +898,24 @@ private:
 
     void addStreamDecoderFilter(Http::StreamDecoderFilterSharedPtr filter) override {
       manager_.addStreamFilterBase(filter.get());
-      manager_.addStreamDecoderFilter(std::make_unique<ActiveStreamDecoderFilter>(
-          manager_, std::move(filter), false, context_));
+      manager_.addStreamDecoderFilter(ActiveStreamDecoderFilterPtr(new (
+          manager_.arena_) ActiveStreamDecoderFilter(manager_, std::move(filter), false, context_)));
     }
 
     void addStreamEncoderFilter(Http::StreamEncoderFilterSharedPtr filter) override {
       manager_.addStreamFilterBase(filter.get());
-      manager_.addStreamEncoderFilter(std::make_unique<ActiveStreamEncoderFilter>(
-          manager_, std::move(filter), false, context_));
+      manager_.addStreamEncoderFilter(ActiveStreamEncoderFilterPtr(new (
+          manager_.arena_) ActiveStreamEncoderFilter(manager_, std::move(filter), false, context_)));
     }
 
     void addStreamFilter(Http::StreamFilterSharedPtr filter) override {
       StreamDecoderFilter* decoder_filter = filter.get();
       manager_.addStreamFilterBase(decoder_filter);
 
-      manager_.addStreamDecoderFilter(
-          std::make_unique<ActiveStreamDecoderFilter>(manager_, filter, true, context_));
-      manager_.addStreamEncoderFilter(
-          std::make_unique<ActiveStreamEncoderFilter>(manager_, std::move(filter), true, context_));
+      manager_.addStreamDecoderFilter(ActiveStreamDecoderFilterPtr(
+          new (manager_.arena_) ActiveStreamDecoderFilter(manager_, filter, true, context_)));
+      manager_.addStreamEncoderFilter(ActiveStreamEncoderFilterPtr(new (
+          manager_.arena_) ActiveStreamEncoderFilter(manager_, std::move(filter), true, context_)));
     }
 
     void addAccessLogHandler(AccessLog::InstanceSharedPtr handler) override {
@@ -979,6 +997,9 @@ private:
   Buffer::BufferMemoryAccountSharedPtr account_;
   const bool proxy_100_continue_;
 
+  // Per-stream arena backing the filter wrappers below. Declared before the wrapper lists so
+  // that the wrappers (whose storage it owns) are destroyed first.
+  Memory::Arena arena_;
   std::list<ActiveStreamDecoderFilterPtr> decoder_filters_;
   std::list<ActiveStreamEncoderFilterPtr> encoder_filters_;
   std::list<StreamFilterBase*> filters_;
@@ -1064,6 +1085,10 @@ public:
   StreamInfo::StreamInfoImpl& streamInfo() override { return stream_info_; }
   const StreamInfo::StreamInfoImpl& streamInfo() const override { return stream_info_; }
 
+  // Http::FilterChainManager
+  // Skips filters that the cached route disables; see Router::Route::filterDisabled().
+  void applyFilterFactoryCb(FilterContext context, FilterFactoryCb& factory) override;
+
   void setDownstreamRemoteAddress(
       const Network::Address::InstanceConstSharedPtr& downstream_remote_address) {
     stream_info_.setDownstreamRemoteAddress(downstream_remote_address);
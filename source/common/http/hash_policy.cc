@@ -83,12 +83,21 @@ public:
                    const absl::optional<std::chrono::seconds>& ttl, bool terminal)
       : HashMethodImplBase(terminal), key_(key), path_(path), ttl_(ttl) {}
 
-  absl::optional<uint64_t> evaluate(const Network::Address::Instance*,
-                                    const RequestHeaderMap& headers,
-                                    const HashPolicy::AddCookieCallback add_cookie,
-                                    const StreamInfo::FilterStateSharedPtr) const override {
+  absl::optional<uint64_t>
+  evaluate(const Network::Address::Instance*, const RequestHeaderMap& headers,
+           const HashPolicy::AddCookieCallback add_cookie,
+           const StreamInfo::FilterStateSharedPtr filter_state) const override {
     absl::optional<uint64_t> hash;
-    std::string value = Utility::parseCookieValue(headers, key_);
+    // Use the per-stream memoized cookie view when filter state is available so that multiple
+    // cookie hash policies parse the Cookie header only once.
+    std::string value;
+    if (filter_state != nullptr) {
+      value = std::string(Utility::getOrCreateParsedCookies(headers, *filter_state)
+                              .getCookieValue(key_)
+                              .value_or(""));
+    } else {
+      value = Utility::parseCookieValue(headers, key_);
+    }
     if (value.empty() && ttl_.has_value()) {
       value = add_cookie(key_, path_, ttl_.value());
       hash = HashUtil::xxHash64(value);
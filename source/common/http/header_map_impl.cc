@@ -1,5 +1,6 @@
 #include "source/common/http/header_map_impl.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <list>
 #include <memory>
@@ -128,9 +129,8 @@ template <> HeaderMapImpl::StaticLookupTable<RequestHeaderMap>::StaticLookupTabl
   const auto handle =
       CustomInlineHeaderRegistry::getInlineHeader<RequestHeaderMap::header_map_type>(
           Headers::get().Host);
-  add(Headers::get().HostLegacy.get().c_str(), [handle](HeaderMapImpl& h) -> StaticLookupResponse {
-    return {&h.inlineHeaders()[handle.value().it_->second], &handle.value().it_->first};
-  });
+  table_.emplace(Headers::get().HostLegacy.get(),
+                 StaticLookupEntry{handle.value().it_->second, &handle.value().it_->first});
 }
 
 template <> HeaderMapImpl::StaticLookupTable<RequestTrailerMap>::StaticLookupTable() {
@@ -184,6 +184,11 @@ void HeaderMapImpl::subtractSize(uint64_t size) {
   cached_byte_size_ -= size;
 }
 
+void HeaderMapImpl::maybeUpdateMaxEntrySize(const HeaderEntry& entry) {
+  max_entry_byte_size_ =
+      std::max<uint64_t>(max_entry_byte_size_, entry.key().size() + entry.value().size());
+}
+
 void HeaderMapImpl::copyFrom(HeaderMap& lhs, const HeaderMap& header_map) {
   header_map.iterate([&lhs](const HeaderEntry& header) -> HeaderMap::Iterate {
     // TODO(mattklein123) PERF: Avoid copying here if not necessary.
@@ -244,12 +249,14 @@ void HeaderMapImpl::insertByKey(HeaderString&& key, HeaderString&& value) {
       const uint64_t added_size =
           appendToHeader((*lookup.value().entry_)->value(), value.getStringView(), delimiter);
       addSize(added_size);
+      maybeUpdateMaxEntrySize(**lookup.value().entry_);
       value.clear();
     }
   } else {
     addSize(key.size() + value.size());
     HeaderNode i = headers_.insert(std::move(key), std::move(value));
     i->entry_ = i;
+    maybeUpdateMaxEntrySize(*i);
   }
 }
 
@@ -310,6 +317,7 @@ void HeaderMapImpl::appendCopy(const LowerCaseString& key, absl::string_view val
     const auto delimiter = delimiterByHeader(key);
     const uint64_t added_size = appendToHeader(entry[0]->value(), value, delimiter);
     addSize(added_size);
+    maybeUpdateMaxEntrySize(*entry[0]);
   } else {
     addCopy(key, value);
   }
@@ -332,6 +340,8 @@ void HeaderMapImpl::setCopy(const LowerCaseString& key, absl::string_view value)
 
 uint64_t HeaderMapImpl::byteSize() const { return cached_byte_size_; }
 
+uint64_t HeaderMapImpl::maxEntryByteSize() const { return max_entry_byte_size_; }
+
 void HeaderMapImpl::verifyByteSizeInternalForTest() const {
   // Computes the total byte size by summing the byte size of the keys and values.
   uint64_t byte_size = 0;
@@ -407,6 +417,7 @@ void HeaderMapImpl::clear() {
   clearInline();
   headers_.clear();
   cached_byte_size_ = 0;
+  max_entry_byte_size_ = 0;
 }
 
 size_t HeaderMapImpl::removeIf(const HeaderMap::HeaderMatchPredicate& predicate) {
@@ -460,6 +471,7 @@ HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl
   HeaderNode i = headers_.insert(key);
   i->entry_ = i;
   *entry = &(*i);
+  maybeUpdateMaxEntrySize(*i);
   return **entry;
 }
 
@@ -475,6 +487,7 @@ HeaderMapImpl::HeaderEntryImpl& HeaderMapImpl::maybeCreateInline(HeaderEntryImpl
   HeaderNode i = headers_.insert(key, std::move(value));
   i->entry_ = i;
   *entry = &(*i);
+  maybeUpdateMaxEntrySize(*i);
   return **entry;
 }
 
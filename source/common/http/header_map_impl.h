@@ -15,6 +15,8 @@
 #include "source/common/http/headers.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Http {
 
@@ -91,6 +93,7 @@ public:
   void setReferenceKey(const LowerCaseString& key, absl::string_view value);
   void setCopy(const LowerCaseString& key, absl::string_view value);
   uint64_t byteSize() const;
+  uint64_t maxEntryByteSize() const;
   HeaderMap::GetResult get(const LowerCaseString& key) const;
   void iterate(HeaderMap::ConstIterateCb cb) const;
   void iterateReverse(HeaderMap::ConstIterateCb cb) const;
@@ -137,20 +140,30 @@ protected:
 
   /**
    * Base class for a static lookup table that converts a string key into an O(1) header.
+   *
+   * Dispatch is a single hash probe into a flat table of POD entries holding the inline
+   * array index directly. A fully compile-time (gperf style) table is not possible here
+   * because the names themselves are runtime configurable (the envoy header prefix and
+   * late-bound custom inline headers), but once built at singleton construction the table
+   * is immutable and the lookup involves no per-entry allocation or indirect call.
    */
-  template <class Interface>
-  struct StaticLookupTable
-      : public TrieLookupTable<std::function<StaticLookupResponse(HeaderMapImpl&)>> {
+  template <class Interface> struct StaticLookupTable {
     StaticLookupTable();
 
+    struct StaticLookupEntry {
+      size_t inline_index_;
+      const LowerCaseString* key_;
+    };
+
     void finalizeTable() {
       CustomInlineHeaderRegistry::finalize<Interface::header_map_type>();
       auto& headers = CustomInlineHeaderRegistry::headers<Interface::header_map_type>();
       size_ = headers.size();
+      table_.reserve(headers.size());
       for (const auto& header : headers) {
-        this->add(header.first.get().c_str(), [&header](HeaderMapImpl& h) -> StaticLookupResponse {
-          return {&h.inlineHeaders()[header.second], &header.first};
-        });
+        // The registry owns the key storage for the process lifetime, so the string_view
+        // key and LowerCaseString pointer remain valid.
+        table_.emplace(header.first.get(), StaticLookupEntry{header.second, &header.first});
       }
     }
 
@@ -167,14 +180,16 @@ protected:
 
     static absl::optional<StaticLookupResponse> lookup(HeaderMapImpl& header_map,
                                                        absl::string_view key) {
-      const auto& entry = ConstSingleton<StaticLookupTable>::get().find(key);
-      if (entry != nullptr) {
-        return entry(header_map);
-      } else {
-        return absl::nullopt;
+      const auto& table = ConstSingleton<StaticLookupTable>::get().table_;
+      const auto entry = table.find(key);
+      if (entry != table.end()) {
+        return StaticLookupResponse{&header_map.inlineHeaders()[entry->second.inline_index_],
+                                    entry->second.key_};
       }
+      return absl::nullopt;
     }
 
+    absl::flat_hash_map<absl::string_view, StaticLookupEntry> table_;
     size_t size_;
   };
 
@@ -323,6 +338,9 @@ protected:
   void updateSize(uint64_t from_size, uint64_t to_size);
   void addSize(uint64_t size);
   void subtractSize(uint64_t size);
+  // Raises max_entry_byte_size_ to the current size of the entry if it is larger. Called at
+  // every site where an entry is created or grown.
+  void maybeUpdateMaxEntrySize(const HeaderEntry& entry);
   virtual absl::optional<StaticLookupResponse> staticLookup(absl::string_view) PURE;
   virtual void clearInline() PURE;
   virtual HeaderEntryImpl** inlineHeaders() PURE;
@@ -335,6 +353,9 @@ protected:
   StatefulHeaderKeyFormatterPtr formatter_;
   // This holds the internal byte size of the HeaderMap.
   uint64_t cached_byte_size_ = 0;
+  // High-water mark of the byte size (key plus value) of any single entry held by the map. Not
+  // decreased by removals; reset by clear().
+  uint64_t max_entry_byte_size_ = 0;
 };
 
 /**
@@ -382,6 +403,7 @@ public:
     HeaderMapImpl::setCopy(key, value);
   }
   uint64_t byteSize() const override { return HeaderMapImpl::byteSize(); }
+  uint64_t maxEntryByteSize() const override { return HeaderMapImpl::maxEntryByteSize(); }
   HeaderMap::GetResult get(const LowerCaseString& key) const override {
     return HeaderMapImpl::get(key);
   }
@@ -419,18 +441,21 @@ public:
     ASSERT(handle.it_->second < inlineHeadersSize());
     HeaderEntry& entry = maybeCreateInline(&inlineHeaders()[handle.it_->second], handle.it_->first);
     addSize(HeaderMapImpl::appendToHeader(entry.value(), data, delimiter));
+    maybeUpdateMaxEntrySize(entry);
   }
   void setReferenceInline(Handle handle, absl::string_view value) override {
     ASSERT(handle.it_->second < inlineHeadersSize());
     HeaderEntry& entry = maybeCreateInline(&inlineHeaders()[handle.it_->second], handle.it_->first);
     updateSize(entry.value().size(), value.size());
     entry.value().setReference(value);
+    maybeUpdateMaxEntrySize(entry);
   }
   void setInline(Handle handle, absl::string_view value) override {
     ASSERT(handle.it_->second < inlineHeadersSize());
     HeaderEntry& entry = maybeCreateInline(&inlineHeaders()[handle.it_->second], handle.it_->first);
     updateSize(entry.value().size(), value.size());
     entry.value().setCopy(value);
+    maybeUpdateMaxEntrySize(entry);
   }
   void setInline(Handle handle, uint64_t value) override {
     ASSERT(handle.it_->second < inlineHeadersSize());
@@ -438,6 +463,7 @@ public:
     subtractSize(entry.value().size());
     entry.value().setInteger(value);
     addSize(entry.value().size());
+    maybeUpdateMaxEntrySize(entry);
   }
   size_t removeInline(Handle handle) override {
     ASSERT(handle.it_->second < inlineHeadersSize());
@@ -201,8 +201,9 @@ bool HeaderUtility::headerNameContainsUnderscore(const absl::string_view header_
 }
 
 bool HeaderUtility::authorityIsValid(const absl::string_view header_value) {
-  if (Runtime::runtimeFeatureEnabled(
-          "envoy.reloadable_features.http2_validate_authority_with_quiche")) {
+  static Runtime::CachedRuntimeFeature validate_authority_with_quiche(
+      "envoy.reloadable_features.http2_validate_authority_with_quiche");
+  if (validate_authority_with_quiche.enabled()) {
     return http2::adapter::HeaderValidator::IsValidAuthority(header_value);
   } else {
     return nghttp2_check_authority(reinterpret_cast<const uint8_t*>(header_value.data()),
@@ -4,6 +4,7 @@
 #include <cctype>
 #include <cstdint>
 
+#include "source/common/common/ascii.h"
 #include "source/common/common/assert.h"
 #include "source/common/common/regex.h"
 #include "source/common/http/headers.h"
@@ -49,21 +50,31 @@ bool isMethodValid(absl::string_view method) {
 }
 #endif
 
+// Same set of characters are allowed for path and query: HTAB, FF, and '!' through '~'.
+// The printable range check is done a word at a time; the two rare control character
+// exceptions are only inspected when the range check rejects a byte.
+bool isAllValidPathQueryChars(absl::string_view text) {
+  while (true) {
+    const size_t i = Ascii::findFirstNotInRange(text, '!', '~');
+    if (i == absl::string_view::npos) {
+      return true;
+    }
+    if (text[i] != 9 && text[i] != 12) {
+      return false;
+    }
+    text.remove_prefix(i + 1);
+  }
+}
+
 // This function is crafted to match the URL validation behavior of the http-parser library.
 bool isUrlValid(absl::string_view url, bool is_connect) {
   if (url.empty()) {
     return false;
   }
 
-  // Same set of characters are allowed for path and query.
-  const auto is_valid_path_query_char = [](char c) {
-    return c == 9 || c == 12 || ('!' <= c && c <= 126);
-  };
-
   // The URL may start with a path.
-  if (auto it = url.begin(); *it == '/' || *it == '*') {
-    ++it;
-    return std::all_of(it, url.end(), is_valid_path_query_char);
+  if (const char first = url.front(); first == '/' || first == '*') {
+    return isAllValidPathQueryChars(url.substr(1));
   }
 
   // If method is not CONNECT, parse scheme.
@@ -104,7 +115,7 @@ bool isUrlValid(absl::string_view url, bool is_connect) {
   // Match http-parser's quirk of allowing any number of '@' characters in host
   // as long as they are not consecutive.
   return std::all_of(host.begin(), host.end(), valid_host_char) && !absl::StrContains(host, "@@") &&
-         std::all_of(path_query.begin(), path_query.end(), is_valid_path_query_char);
+         isAllValidPathQueryChars(path_query);
 }
 
 bool isVersionValid(absl::string_view version_input) {
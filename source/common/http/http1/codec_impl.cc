@@ -28,6 +28,7 @@
 
 #include "absl/container/fixed_array.h"
 #include "absl/strings/ascii.h"
+#include "absl/strings/numbers.h"
 
 namespace Envoy {
 namespace Http {
@@ -228,11 +229,29 @@ void StreamEncoderImpl::encodeHeadersBase(const RequestOrResponseHeaderMap& head
 
   if (end_stream) {
     endEncode();
-  } else {
+  } else if (!shouldDeferFlushUntilBody(headers, status)) {
     flushOutput();
   }
 }
 
+bool StreamEncoderImpl::shouldDeferFlushUntilBody(const RequestOrResponseHeaderMap& headers,
+                                                 absl::optional<uint64_t> status) const {
+  // For responses with a known-small content length the body almost always arrives in the same
+  // dispatch as the headers. Leaving the headers in the codec output buffer lets the body flush
+  // emit headers + body through the connection write path in a single pass instead of two.
+  // Requests are excluded as buffered request headers could deadlock an upstream exchange that
+  // waits for them (e.g. expect/continue handshakes).
+  if (!status.has_value() || headers.ContentLength() == nullptr ||
+      !Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.http1_coalesce_small_response_writes")) {
+    return false;
+  }
+  static constexpr uint64_t MaxDeferredFlushContentLength = 16 * 1024;
+  uint64_t content_length;
+  return absl::SimpleAtoi(headers.getContentLengthValue(), &content_length) &&
+         content_length <= MaxDeferredFlushContentLength;
+}
+
 void StreamEncoderImpl::encodeData(Buffer::Instance& data, bool end_stream) {
   // end_stream may be indicated with a zero length data buffer. If that is the case, so not
   // actually write the zero length buffer out.
@@ -298,9 +317,10 @@ void StreamEncoderImpl::endEncode() {
   notifyEncodeComplete();
   // With CONNECT or TCP tunneling, half-closing the connection is used to signal end stream so
   // don't delay that signal.
+  static Runtime::CachedRuntimeFeature no_delay_close_for_upgrades(
+      "envoy.reloadable_features.no_delay_close_for_upgrades");
   if (connect_request_ || is_tcp_tunneling_ ||
-      (is_response_to_connect_request_ &&
-       Runtime::runtimeFeatureEnabled("envoy.reloadable_features.no_delay_close_for_upgrades"))) {
+      (is_response_to_connect_request_ && no_delay_close_for_upgrades.enabled())) {
     connection_.connection().close(
         Network::ConnectionCloseType::FlushWrite,
         StreamInfo::LocalCloseReasons::get().CloseForConnectRequestOrTcpTunneling);
@@ -748,7 +768,14 @@ CallbackResult ConnectionImpl::onHeadersComplete() {
 
 void ConnectionImpl::bufferBody(const char* data, size_t length) {
   auto slice = current_dispatching_buffer_->frontSlice();
-  if (data == slice.mem_ && length == slice.len_) {
+  const char* slice_start = static_cast<const char*>(slice.mem_);
+  if (length != 0 && data >= slice_start && data + length == slice_start + slice.len_) {
+    // The body bytes are the tail of the slice currently being dispatched (in particular, a
+    // whole slice body hits this path too). Everything before them in the slice has already
+    // been consumed by the parser, so it can be drained and the body bytes moved over by
+    // slice reference instead of copied. Since the body ends exactly at the slice boundary,
+    // the parser is guaranteed to be finished with this slice.
+    current_dispatching_buffer_->drain(data - slice_start);
     buffered_body_.move(*current_dispatching_buffer_, length);
     dispatching_slice_already_drained_ = true;
   } else {
@@ -123,6 +123,13 @@ private:
   void encodeFormattedHeader(absl::string_view key, absl::string_view value,
                              HeaderKeyFormatterOptConstRef formatter);
 
+  /**
+   * @return whether the headers flush can be deferred so that headers and a known-small body are
+   *         written to the connection together.
+   */
+  bool shouldDeferFlushUntilBody(const RequestOrResponseHeaderMap& headers,
+                                 absl::optional<uint64_t> status) const;
+
   void flushOutput(bool end_encode = false);
 
   absl::string_view details_;
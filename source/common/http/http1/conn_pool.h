@@ -13,6 +13,13 @@ namespace Http1 {
 
 /**
  * An active client for HTTP/1.1 connections.
+ *
+ * Each client carries exactly one stream at a time; see numActiveStreams(). This is deliberate:
+ * HTTP/1.1 pipelining is not supported and will not be added. Pipelined responses cannot be
+ * demultiplexed on error (a single upstream close or garbled response poisons every in-flight
+ * request with no way to tell which ones executed, making retries unsafe even for idempotent
+ * methods), and widespread intermediary breakage is why browsers removed support. Upstreams that
+ * need connection multiplexing should speak HTTP/2, which exists to solve exactly this.
  */
 class ActiveClient : public Envoy::Http::ActiveClient {
 public:
@@ -224,6 +224,13 @@ void ConnectionImpl::StreamImpl::buildHeaders(std::vector<nghttp2_nv>& final_hea
   });
 }
 
+// Non-reference header strings must be copied here: when headers are submitted from a dispatching
+// context the adapter defers the actual send until after the source HeaderMap may have been
+// destroyed, so the adapter needs its own copy of the bytes. This is also why the codec cannot
+// cache pre-encoded HPACK for repeated header blocks above the adapter: the adapter owns the HPACK
+// dynamic table, and splicing externally encoded bytes would desynchronize table state between the
+// peers. Repeated header values are instead indexed by the adapter's own dynamic table, sized via
+// the hpack_table_size protocol option.
 http2::adapter::HeaderRep getRep(const HeaderString& str) {
   if (str.isReference()) {
     return str.getStringView();
@@ -641,7 +648,7 @@ bool ConnectionImpl::StreamDataFrameSource::Send(absl::string_view frame_header,
                                                  size_t payload_length) {
   stream_.parent_.protocol_constraints_.incrementOutboundDataFrameCount();
 
-  Buffer::OwnedImpl output;
+  Buffer::OwnedImpl& output = stream_.parent_.output_buffer_;
   stream_.parent_.addOutboundFrameFragment(
       output, reinterpret_cast<const uint8_t*>(frame_header.data()), frame_header.size());
   if (!stream_.parent_.protocol_constraints_.checkOutboundFrameLimits().ok()) {
@@ -652,7 +659,16 @@ bool ConnectionImpl::StreamDataFrameSource::Send(absl::string_view frame_header,
 
   stream_.parent_.stats_.pending_send_bytes_.sub(payload_length);
   output.move(*stream_.pending_send_data_, payload_length);
-  stream_.parent_.connection_.write(output, false);
+  if (stream_.pending_send_data_->length() == 0 && stream_.pending_send_enqueue_time_.has_value()) {
+    // The queued burst has fully drained to the connection; record how long it waited behind
+    // other streams and connection flow control.
+    stream_.parent_.stats_.pending_send_drain_ms_.recordValue(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            stream_.parent_.connection_.dispatcher().timeSource().monotonicTime() -
+            *stream_.pending_send_enqueue_time_)
+            .count());
+    stream_.pending_send_enqueue_time_.reset();
+  }
   return true;
 }
 
@@ -702,6 +718,9 @@ void ConnectionImpl::StreamImpl::encodeDataHelper(Buffer::Instance& data, bool e
 
   local_end_stream_ = end_stream;
   parent_.stats_.pending_send_bytes_.add(data.length());
+  if (pending_send_data_->length() == 0 && data.length() > 0) {
+    pending_send_enqueue_time_ = parent_.connection_.dispatcher().timeSource().monotonicTime();
+  }
   pending_send_data_->move(data);
   if (data_deferred_) {
     bool success = parent_.adapter_->ResumeStream(stream_id_);
@@ -1298,18 +1317,26 @@ void ConnectionImpl::addOutboundFrameFragment(Buffer::OwnedImpl& output, const u
 
 ssize_t ConnectionImpl::onSend(const uint8_t* data, size_t length) {
   ENVOY_CONN_LOG(trace, "send data: bytes={}", connection_, length);
-  Buffer::OwnedImpl buffer;
-  addOutboundFrameFragment(buffer, data, length);
+  // Frames are accumulated in output_buffer_ and flushed to the connection in a single
+  // batch once the adapter has finished producing output for this send pass; see
+  // flushOutputBuffer().
+  addOutboundFrameFragment(output_buffer_, data, length);
+  return length;
+}
 
-  // While the buffer is transient the fragment it contains will be moved into the
+void ConnectionImpl::flushOutputBuffer() {
+  if (output_buffer_.length() == 0) {
+    return;
+  }
+
+  // While output_buffer_ is transient the fragments it contains will be moved into the
   // write_buffer_ of the underlying connection_ by the write method below.
   // This creates lifetime dependency between the write_buffer_ of the underlying connection
   // and the codec object. Specifically the write_buffer_ MUST be either fully drained or
   // deleted before the codec object is deleted. This is presently guaranteed by the
   // destruction order of the Network::ConnectionImpl object where write_buffer_ is
   // destroyed before the filter_manager_ which owns the codec through Http::ConnectionManagerImpl.
-  connection_.write(buffer, false);
-  return length;
+  connection_.write(output_buffer_, false);
 }
 
 Status ConnectionImpl::onStreamClose(StreamImpl* stream, uint32_t error_code) {
@@ -1474,6 +1501,10 @@ Status ConnectionImpl::sendPendingFrames() {
   }
 
   const int rc = adapter_->Send();
+  // Flush whatever was produced even on error so that frames already generated (e.g. a
+  // GOAWAY preceding the failure) make it onto the wire, matching the previous
+  // write-per-frame behavior.
+  flushOutputBuffer();
   if (rc != 0) {
     ASSERT(rc == NGHTTP2_ERR_CALLBACK_FAILURE);
     return codecProtocolError(nghttp2_strerror(rc));
@@ -1610,7 +1641,9 @@ void ConnectionImpl::onProtocolConstraintViolation() {
 }
 
 void ConnectionImpl::onUnderlyingConnectionBelowWriteBufferLowWatermark() {
-  if (Runtime::runtimeFeatureEnabled(Runtime::defer_processing_backedup_streams)) {
+  static Runtime::CachedRuntimeFeature defer_processing_backedup_streams(
+      Runtime::defer_processing_backedup_streams);
+  if (defer_processing_backedup_streams.enabled()) {
     // Notify the streams based on least recently encoding to the connection.
     for (auto it = active_streams_.rbegin(); it != active_streams_.rend(); ++it) {
       (*it)->runLowWatermarkCallbacks();
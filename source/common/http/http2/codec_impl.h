@@ -336,6 +336,10 @@ protected:
     // See source/docs/flow_control.md for more information.
     Buffer::InstancePtr pending_recv_data_;
     Buffer::InstancePtr pending_send_data_;
+    // Time at which pending_send_data_ last transitioned from empty to non-empty; used to record
+    // how long a burst of queued data waits in the per-stream send buffer before the codec fully
+    // drains it to the connection (pending_send_drain_ms).
+    absl::optional<MonotonicTime> pending_send_enqueue_time_;
     HeaderMapPtr pending_trailers_to_encode_;
     std::unique_ptr<MetadataDecoder> metadata_decoder_;
     std::unique_ptr<NewMetadataEncoder> metadata_encoder_;
@@ -702,6 +706,10 @@ private:
 
   // Adds buffer fragment for a new outbound frame to the supplied Buffer::OwnedImpl.
   void addOutboundFrameFragment(Buffer::OwnedImpl& output, const uint8_t* data, size_t length);
+  // Writes any frames accumulated in output_buffer_ to the connection in a single write. All
+  // frames produced by one adapter Send() pass (potentially spanning many streams) are batched
+  // this way so the connection write path runs once per flush instead of once per frame.
+  void flushOutputBuffer();
   virtual Status trackInboundFrames(int32_t stream_id, size_t length, uint8_t type, uint8_t flags,
                                     uint32_t padding_length) PURE;
   void onKeepaliveResponse();
@@ -709,6 +717,9 @@ private:
   bool slowContainsStreamId(int32_t stream_id) const;
   virtual StreamResetReason getMessagingErrorResetReason() const PURE;
 
+  // Accumulates outbound frames produced while the adapter is sending; flushed to the
+  // connection by flushOutputBuffer(). Only ever non-empty within sendPendingFrames().
+  Buffer::OwnedImpl output_buffer_;
   // Tracks the current slice we're processing in the dispatch loop.
   const Buffer::RawSlice* current_slice_ = nullptr;
   // Streams that are pending deferred reset. Using an ordered map provides determinism in the rare
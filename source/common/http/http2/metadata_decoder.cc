@@ -66,9 +66,10 @@ bool MetadataDecoder::receiveMetadata(const uint8_t* data, size_t len) {
 }
 
 bool MetadataDecoder::onMetadataFrameComplete(bool end_metadata) {
+  static Runtime::CachedRuntimeFeature decode_metadata_with_quiche(
+      "envoy.reloadable_features.http2_decode_metadata_with_quiche");
   bool success;
-  if (Runtime::runtimeFeatureEnabled(
-          "envoy.reloadable_features.http2_decode_metadata_with_quiche")) {
+  if (decode_metadata_with_quiche.enabled()) {
     success = decodeMetadataPayload(end_metadata);
   } else {
     success = decodeMetadataPayloadUsingNghttp2(end_metadata);
@@ -95,7 +95,8 @@ Http3ConnPoolImpl::Http3ConnPoolImpl(
                  static_cast<uint16_t>(host_->address()->ip()->port()), false),
       connect_callback_(connect_callback) {}
 
-void Http3ConnPoolImpl::onConnected(Envoy::ConnectionPool::ActiveClient&) {
+void Http3ConnPoolImpl::onConnected(Envoy::ConnectionPool::ActiveClient& client) {
+  FixedHttpConnPoolImpl::onConnected(client);
   if (connect_callback_ != absl::nullopt) {
     connect_callback_->onHandshakeComplete();
   }
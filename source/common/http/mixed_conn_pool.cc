@@ -32,8 +32,10 @@ void HttpConnPoolImplMixed::onConnected(Envoy::ConnectionPool::ActiveClient& cli
   // client, the TCP client is detached from the connection and discarded, and an
   // HTTP client is associated with that connection. When the first call returns, the
   // Network::Connection will inform the new callback (the HTTP client) that it
-  // is connected. The early return is to ignore that second call.
+  // is connected. The second call is for the real HTTP client; let the base class report it
+  // to any connection lifetime callbacks, but skip the TCP-to-HTTP conversion below.
   if (client.protocol() != absl::nullopt) {
+    HttpConnPoolImplBase::onConnected(client);
     return;
   }
 
@@ -1,5 +1,7 @@
 #include "source/common/http/path_utility.h"
 
+#include <array>
+
 #include "source/common/common/logger.h"
 #include "source/common/runtime/runtime_features.h"
 
@@ -13,6 +15,53 @@ namespace Envoy {
 namespace Http {
 
 namespace {
+
+// Bytes that url::CanonicalizePath passes through verbatim: unreserved characters and
+// sub-delimiters plus ':', '@' and '/' (the RFC 3986 path character set). Everything else —
+// percent escapes, backslashes, characters googleurl would escape — takes the full
+// canonicalization path.
+constexpr std::array<bool, 256> buildPassthroughTable() {
+  std::array<bool, 256> table{};
+  for (char c = 'a'; c <= 'z'; c++) {
+    table[static_cast<uint8_t>(c)] = true;
+  }
+  for (char c = 'A'; c <= 'Z'; c++) {
+    table[static_cast<uint8_t>(c)] = true;
+  }
+  for (char c = '0'; c <= '9'; c++) {
+    table[static_cast<uint8_t>(c)] = true;
+  }
+  constexpr absl::string_view extra = "-._~!$&'()*+,;=:@/";
+  for (const char c : extra) {
+    table[static_cast<uint8_t>(c)] = true;
+  }
+  return table;
+}
+
+constexpr std::array<bool, 256> kPassthroughChars = buildPassthroughTable();
+
+// Returns true if the path (query excluded) is already in canonical form, i.e.
+// url::CanonicalizePath would return it byte for byte unchanged: it starts with '/', every byte
+// is passed through verbatim by googleurl, and there are no empty ("//") or dot ("/.", "/..")
+// segments. Almost all traffic is already canonical, so this check lets canonicalPath() skip the
+// googleurl round trip and its intermediate string allocation for the common case.
+bool isCanonicalPath(absl::string_view path) {
+  if (path.empty() || path.front() != '/') {
+    return false;
+  }
+  char prev = '\0';
+  for (const char c : path) {
+    if (!kPassthroughChars[static_cast<uint8_t>(c)]) {
+      return false;
+    }
+    if (prev == '/' && (c == '/' || c == '.')) {
+      return false;
+    }
+    prev = c;
+  }
+  return true;
+}
+
 absl::optional<std::string> canonicalizePath(absl::string_view original_path) {
   std::string canonical_path;
   url::Component in_component(0, original_path.size());
@@ -42,11 +91,15 @@ bool PathUtil::canonicalPath(RequestHeaderMap& headers) {
   const auto original_path = headers.getPathValue();
   // canonicalPath is supposed to apply on path component in URL instead of :path header
   const auto query_pos = original_path.find('?');
-  auto normalized_path_opt = canonicalizePath(
+  const absl::string_view path_portion =
       query_pos == original_path.npos
           ? original_path
-          : absl::string_view(original_path.data(), query_pos) // '?' is not included
-  );
+          : absl::string_view(original_path.data(), query_pos); // '?' is not included
+  if (isCanonicalPath(path_portion)) {
+    // Canonicalization would produce the same bytes; leave the header untouched.
+    return true;
+  }
+  auto normalized_path_opt = canonicalizePath(path_portion);
 
   if (!normalized_path_opt.has_value()) {
     return false;
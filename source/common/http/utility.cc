@@ -391,6 +391,32 @@ Utility::parseCookies(const RequestHeaderMap& headers,
   return cookies;
 }
 
+Utility::ParsedCookies::ParsedCookies(const RequestHeaderMap& headers)
+    : cookies_(parseCookies(headers)) {}
+
+absl::optional<absl::string_view>
+Utility::ParsedCookies::getCookieValue(absl::string_view name) const {
+  const auto it = cookies_.find(name);
+  if (it == cookies_.end()) {
+    return absl::nullopt;
+  }
+  return absl::string_view(it->second);
+}
+
+const Utility::ParsedCookies&
+Utility::getOrCreateParsedCookies(const RequestHeaderMap& headers,
+                                  StreamInfo::FilterState& filter_state) {
+  const ParsedCookies* parsed = filter_state.getDataReadOnly<ParsedCookies>(ParsedCookies::key());
+  if (parsed == nullptr) {
+    auto created = std::make_shared<ParsedCookies>(headers);
+    parsed = created.get();
+    filter_state.setData(ParsedCookies::key(), std::move(created),
+                         StreamInfo::FilterState::StateType::ReadOnly,
+                         StreamInfo::FilterState::LifeSpan::FilterChain);
+  }
+  return *parsed;
+}
+
 bool Utility::Url::containsFragment() { return (component_bitmap_ & (1 << UcFragment)); }
 
 bool Utility::Url::containsUserinfo() { return (component_bitmap_ & (1 << UcUserinfo)); }
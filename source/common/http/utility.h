@@ -15,6 +15,7 @@
 #include "envoy/http/message.h"
 #include "envoy/http/metadata_interface.h"
 #include "envoy/http/query_params.h"
+#include "envoy/stream_info/filter_state.h"
 
 #include "source/common/http/exception.h"
 #include "source/common/http/status.h"
@@ -344,6 +345,39 @@ parseCookies(const RequestHeaderMap& headers,
  **/
 absl::flat_hash_map<std::string, std::string> parseCookies(const RequestHeaderMap& headers);
 
+/**
+ * Per-stream memoized view of the request's Cookie header. The first consumer materializes the
+ * parsed map into filter state; subsequent lookups (e.g. several cookie hash policies) hit the
+ * index instead of re-scanning the header. The view is not invalidated if a filter later mutates
+ * the Cookie header.
+ */
+class ParsedCookies : public StreamInfo::FilterState::Object {
+public:
+  explicit ParsedCookies(const RequestHeaderMap& headers);
+
+  // The filter state key under which the parsed view is stored.
+  static constexpr absl::string_view key() { return "envoy.http.parsed_cookies"; }
+
+  /**
+   * @param name the name of the cookie to look up.
+   * @return the value of the first cookie with the given name, or absl::nullopt if absent.
+   */
+  absl::optional<absl::string_view> getCookieValue(absl::string_view name) const;
+
+private:
+  const absl::flat_hash_map<std::string, std::string> cookies_;
+};
+
+/**
+ * Return the memoized parsed Cookie header for the stream, materializing it into filter state on
+ * first use.
+ * @param headers supplies the headers to parse cookies from on first use.
+ * @param filter_state the stream's filter state holding the memoized view.
+ * @return the parsed cookie view.
+ */
+const ParsedCookies& getOrCreateParsedCookies(const RequestHeaderMap& headers,
+                                              StreamInfo::FilterState& filter_state);
+
 /**
  * Parse a particular value out of a set-cookie
  * @param headers supplies the headers to get the set-cookie from.
@@ -14,22 +14,28 @@ ManagerImpl::ManagerImpl(absl::string_view name)
 
 Manager::State ManagerImpl::state() const { return state_; }
 
-void ManagerImpl::add(const Target& target) {
+void ManagerImpl::add(const Target& target) { add(target, {}); }
+
+void ManagerImpl::add(const Target& target, std::vector<std::string> dependencies) {
   ++count_;
   TargetHandlePtr target_handle(target.createHandle(name_));
   ++target_names_count_[target.name()];
   switch (state_) {
   case State::Uninitialized:
-    // If the manager isn't initialized yet, save the target handle to be initialized later.
+    // If the manager isn't initialized yet, save the target to be initialized later.
     ENVOY_LOG(debug, "added {} to {}", target.name(), name_);
-    target_handles_.push_back(std::move(target_handle));
+    targets_.push_back(
+        {std::move(target_handle), std::string(target.name()), std::move(dependencies), false});
     return;
   case State::Initializing:
-    // If the manager is already initializing, initialize the new target immediately. Note that
-    // it's important in this case that count_ was incremented above before calling the target,
-    // because if the target calls the init manager back immediately, count_ will be decremented
-    // here (see the definition of watcher_ above).
-    target_handle->initialize(watcher_);
+    // If the manager is already initializing, initialize the new target as soon as its
+    // dependencies allow (immediately for a dependency-free target). Note that it's important in
+    // this case that count_ was incremented above before calling the target, because if the
+    // target calls the init manager back immediately, count_ will be decremented here (see the
+    // definition of watcher_ above).
+    targets_.push_back(
+        {std::move(target_handle), std::string(target.name()), std::move(dependencies), false});
+    startReadyTargets();
     return;
   case State::Initialized:
     // If the manager has already completed initialization, consider this a programming error.
@@ -52,12 +58,54 @@ void ManagerImpl::initialize(const Watcher& watcher) {
     // If we have some targets, start initialization...
     ENVOY_LOG(debug, "{} initializing", name_);
     state_ = State::Initializing;
+    startReadyTargets();
+  }
+}
 
-    // Attempt to initialize each target. If a target is unavailable, treat it as though it
-    // completed immediately.
-    for (const auto& target_handle : target_handles_) {
-      if (!target_handle->initialize(watcher_)) {
-        onTargetReady(target_handle->name());
+bool ManagerImpl::dependenciesSatisfied(const TargetRecord& record) const {
+  for (const std::string& dependency : record.dependencies) {
+    // A dependency is outstanding as long as any unready target with that name is registered.
+    // Names with no registered target count as satisfied so that optional dependencies (e.g. a
+    // listener without RDS) do not block dependents.
+    if (target_names_count_.contains(dependency)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ManagerImpl::startReadyTargets() {
+  // Sweep until a fixpoint: a target that initializes synchronously may satisfy the dependencies
+  // of targets earlier in the list.
+  bool started_any = true;
+  while (started_any) {
+    started_any = false;
+    for (auto& record : targets_) {
+      if (record.started || !dependenciesSatisfied(record)) {
+        continue;
+      }
+      record.started = true;
+      started_any = true;
+      ++in_flight_count_;
+      // Attempt to initialize the target. If it is unavailable, treat it as though it completed
+      // immediately.
+      if (!record.handle->initialize(watcher_)) {
+        onTargetReady(record.name);
+      }
+    }
+  }
+  // If no target is in flight while unready targets remain, no callback can ever unblock them:
+  // the dependency graph has a cycle. Surface the bug and start the remaining targets anyway
+  // rather than hanging initialization forever.
+  if (in_flight_count_ == 0 && count_ > 0 && state_ == State::Initializing) {
+    ENVOY_BUG(false, fmt::format("{} has a dependency cycle among its targets", name_));
+    for (auto& record : targets_) {
+      if (!record.started) {
+        record.started = true;
+        ++in_flight_count_;
+        if (!record.handle->initialize(watcher_)) {
+          onTargetReady(record.name);
+        }
       }
     }
   }
@@ -79,14 +127,21 @@ void ManagerImpl::onTargetReady(absl::string_view target_name) {
 
   // Decrease target_name count by 1.
   ASSERT(target_names_count_.find(target_name) != target_names_count_.end());
+  ASSERT(in_flight_count_ != 0);
+  --in_flight_count_;
+  bool name_fully_ready = false;
   if (--target_names_count_[target_name] == 0) {
     target_names_count_.erase(target_name);
+    name_fully_ready = true;
   }
 
   // If there are no uninitialized targets remaining when called back by a target, that means it was
   // the last. Signal `ready` to the handle we saved in `initialize`.
   if (--count_ == 0) {
     ready();
+  } else if (name_fully_ready) {
+    // The last target with this name is now ready, so targets that were waiting on it can start.
+    startReadyTargets();
   }
 }
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <list>
+#include <string>
+#include <vector>
 
 #include "envoy/init/manager.h"
 
@@ -38,11 +40,38 @@ public:
   void initialize(const Watcher& watcher) override;
   void dumpUnreadyTargets(envoy::admin::v3::UnreadyTargetsDumps& dumps) override;
 
+  /**
+   * Register a target that must not begin initialization until every target named in
+   * `dependencies` has initialized. Dependencies refer to target names registered with this
+   * manager; a name with no registered target is considered satisfied, so optional dependencies
+   * do not block dependents. Targets registered through the dependency-free overload behave as
+   * before: they all start concurrently when the manager initializes. Dependency cycles are a
+   * programming error; they are surfaced via ENVOY_BUG and the affected targets are started
+   * anyway so that initialization cannot hang.
+   */
+  void add(const Target& target, std::vector<std::string> dependencies);
+
 private:
+  // A registered target together with the names of the targets it depends on. The handle is
+  // started only once every dependency has initialized.
+  struct TargetRecord {
+    TargetHandlePtr handle;
+    std::string name;
+    std::vector<std::string> dependencies;
+    bool started{false};
+  };
+
   // Callback function with an additional target_name parameter, decrease unready targets count by
   // 1, update target_names_count_ hash map.
   void onTargetReady(absl::string_view target_name);
 
+  // Whether every dependency of the record has initialized (or was never registered).
+  bool dependenciesSatisfied(const TargetRecord& record) const;
+
+  // Start every not-yet-started target whose dependencies are satisfied, sweeping to a fixpoint
+  // since a target that initializes synchronously may unblock others.
+  void startReadyTargets();
+
   void ready();
 
   // Human-readable name for logging.
@@ -64,7 +93,12 @@ private:
   const WatcherImpl watcher_;
 
   // All registered targets.
-  std::list<TargetHandlePtr> target_handles_;
+  std::list<TargetRecord> targets_;
+
+  // Number of targets that have been started but have not yet initialized. Used to detect
+  // dependency cycles: if no target is in flight while unready targets remain, no callback can
+  // ever unblock them.
+  uint32_t in_flight_count_{0};
 
   // Count of target_name of unready targets.
   absl::flat_hash_map<std::string, uint32_t> target_names_count_;
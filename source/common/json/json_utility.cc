@@ -0,0 +1,98 @@
+#include "source/common/json/json_utility.h"
+
+#include <cmath>
+
+#include "source/common/json/json_sanitizer.h"
+
+#include "fmt/format.h"
+
+namespace Envoy {
+namespace Json {
+
+namespace {
+
+void structToString(const ProtobufWkt::Struct& struct_value, std::string& dest);
+void listToString(const ProtobufWkt::ListValue& list_value, std::string& dest);
+
+void sanitizedAppend(absl::string_view str, std::string& dest) {
+  std::string sanitize_buffer;
+  const absl::string_view sanitized = sanitize(sanitize_buffer, str);
+  dest.push_back('"');
+  dest.append(sanitized.data(), sanitized.size());
+  dest.push_back('"');
+}
+
+void valueToString(const ProtobufWkt::Value& value, std::string& dest) {
+  switch (value.kind_case()) {
+  case ProtobufWkt::Value::KIND_NOT_SET:
+  case ProtobufWkt::Value::kNullValue:
+    dest.append("null");
+    return;
+  case ProtobufWkt::Value::kNumberValue: {
+    const double number = value.number_value();
+    if (std::isfinite(number)) {
+      // fmt uses shortest round-trip formatting and emits whole doubles without a fractional
+      // part, matching the protobuf JSON printer.
+      dest.append(fmt::format("{}", number));
+    } else {
+      // JSON has no representation for non-finite numbers; the protobuf JSON printer emits
+      // them as strings.
+      sanitizedAppend(std::isnan(number) ? "NaN" : (number > 0 ? "Infinity" : "-Infinity"), dest);
+    }
+    return;
+  }
+  case ProtobufWkt::Value::kStringValue:
+    sanitizedAppend(value.string_value(), dest);
+    return;
+  case ProtobufWkt::Value::kBoolValue:
+    dest.append(value.bool_value() ? "true" : "false");
+    return;
+  case ProtobufWkt::Value::kStructValue:
+    structToString(value.struct_value(), dest);
+    return;
+  case ProtobufWkt::Value::kListValue:
+    listToString(value.list_value(), dest);
+    return;
+  }
+}
+
+void structToString(const ProtobufWkt::Struct& struct_value, std::string& dest) {
+  dest.push_back('{');
+  bool first = true;
+  for (const auto& [key, value] : struct_value.fields()) {
+    if (!first) {
+      dest.push_back(',');
+    }
+    first = false;
+    sanitizedAppend(key, dest);
+    dest.push_back(':');
+    valueToString(value, dest);
+  }
+  dest.push_back('}');
+}
+
+void listToString(const ProtobufWkt::ListValue& list_value, std::string& dest) {
+  dest.push_back('[');
+  bool first = true;
+  for (const ProtobufWkt::Value& value : list_value.values()) {
+    if (!first) {
+      dest.push_back(',');
+    }
+    first = false;
+    valueToString(value, dest);
+  }
+  dest.push_back(']');
+}
+
+} // namespace
+
+void Utility::appendValueToString(const ProtobufWkt::Value& value, std::string& dest) {
+  valueToString(value, dest);
+}
+
+void Utility::appendStructToString(const ProtobufWkt::Struct& struct_value, std::string& dest) {
+  structToString(struct_value, dest);
+}
+
+} // namespace Json
+} // namespace Envoy
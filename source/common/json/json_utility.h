@@ -0,0 +1,31 @@
+#pragma once
+
+#include <string>
+
+#include "source/common/protobuf/protobuf.h"
+
+namespace Envoy {
+namespace Json {
+
+class Utility {
+public:
+  /**
+   * Append a JSON rendering of a ProtobufWkt::Value to the output string. The result is
+   * semantically equivalent to serializing the value with the protobuf JSON printer, but the
+   * conversion walks the value directly instead of going through the reflection machinery,
+   * which matters on hot paths such as JSON access logging.
+   * @param value message of type type.googleapis.com/google.protobuf.Value.
+   * @param dest string the serialized JSON is appended to.
+   */
+  static void appendValueToString(const ProtobufWkt::Value& value, std::string& dest);
+
+  /**
+   * Append a JSON rendering of a ProtobufWkt::Struct to the output string as a JSON object.
+   * @param struct_value message of type type.googleapis.com/google.protobuf.Struct.
+   * @param dest string the serialized JSON is appended to.
+   */
+  static void appendStructToString(const ProtobufWkt::Struct& struct_value, std::string& dest);
+};
+
+} // namespace Json
+} // namespace Envoy
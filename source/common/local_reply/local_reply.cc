@@ -18,9 +18,11 @@ namespace LocalReply {
 
 class BodyFormatter {
 public:
-  BodyFormatter()
-      : formatter_(std::make_unique<Envoy::Formatter::FormatterImpl>("%LOCAL_REPLY_BODY%")),
-        content_type_(Http::Headers::get().ContentTypeValues.Text) {}
+  // The default body format is "%LOCAL_REPLY_BODY%", which is an identity transform of the
+  // body. Leave formatter_ null so format() can skip the substitution machinery entirely on
+  // this path; local replies with no configured body format are the common case and can be
+  // generated at a high rate during upstream outages.
+  BodyFormatter() : content_type_(Http::Headers::get().ContentTypeValues.Text) {}
 
   BodyFormatter(const envoy::config::core::v3::SubstitutionFormatString& config,
                 Server::Configuration::CommonFactoryContext& context)
@@ -37,8 +39,10 @@ public:
               const Http::ResponseTrailerMap& response_trailers,
               const StreamInfo::StreamInfo& stream_info, std::string& body,
               absl::string_view& content_type) const {
-    body =
-        formatter_->format(request_headers, response_headers, response_trailers, stream_info, body);
+    if (formatter_ != nullptr) {
+      body = formatter_->format(request_headers, response_headers, response_trailers, stream_info,
+                                body);
+    }
     content_type = content_type_;
   }
 
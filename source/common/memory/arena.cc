@@ -0,0 +1,35 @@
+#include "source/common/memory/arena.h"
+
+namespace Envoy {
+namespace Memory {
+
+void* Arena::allocate(size_t size, size_t alignment) {
+  ASSERT(alignment > 0 && (alignment & (alignment - 1)) == 0);
+  ASSERT(alignment <= alignof(std::max_align_t));
+
+  uint8_t* aligned =
+      reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) &
+                                 ~static_cast<uintptr_t>(alignment - 1));
+  if (cursor_ == nullptr || aligned + size > end_) {
+    addBlock(size + alignment);
+    aligned =
+        reinterpret_cast<uint8_t*>((reinterpret_cast<uintptr_t>(cursor_) + alignment - 1) &
+                                   ~static_cast<uintptr_t>(alignment - 1));
+  }
+  cursor_ = aligned + size;
+  bytes_allocated_ += size;
+  return aligned;
+}
+
+void Arena::addBlock(size_t min_size) {
+  const size_t capacity = std::max(min_size, next_block_size_);
+  blocks_.push_back(Block{std::unique_ptr<uint8_t[]>(new uint8_t[capacity]), capacity});
+  cursor_ = blocks_.back().storage_.get();
+  end_ = cursor_ + capacity;
+  // Grow subsequent blocks geometrically so that a stream with many filters or large
+  // per-request state converges to O(log n) block allocations.
+  next_block_size_ = std::min(next_block_size_ * 2, MaxBlockSize);
+}
+
+} // namespace Memory
+} // namespace Envoy
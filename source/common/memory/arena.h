@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "source/common/common/assert.h"
+
+#include "absl/container/inlined_vector.h"
+
+namespace Envoy {
+namespace Memory {
+
+/**
+ * A simple bump-pointer arena allocator. Allocations are satisfied from a chain of
+ * geometrically growing blocks and are freed wholesale when the arena is destroyed;
+ * individual allocations cannot be returned to the arena. This is intended for
+ * request/stream scoped objects where many small allocations share a single lifetime,
+ * replacing per-object heap traffic with one reset at end of scope.
+ *
+ * Objects placed in the arena must have their destructors run by the owner (e.g. via a
+ * smart pointer whose deleter only invokes the destructor); the arena only manages raw
+ * memory.
+ *
+ * This class is not thread safe.
+ */
+class Arena {
+public:
+  static constexpr size_t DefaultInitialBlockSize = 1024;
+  static constexpr size_t MaxBlockSize = 32 * 1024;
+
+  explicit Arena(size_t initial_block_size = DefaultInitialBlockSize)
+      : next_block_size_(initial_block_size) {}
+
+  /**
+   * Allocate raw memory from the arena.
+   * @param size supplies the number of bytes to allocate.
+   * @param alignment supplies the required alignment; must be a power of two no larger
+   *        than alignof(std::max_align_t).
+   * @return pointer to uninitialized storage valid for the lifetime of the arena.
+   */
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  /**
+   * @return the total number of bytes handed out by allocate(). This does not include
+   *         per-block slack.
+   */
+  uint64_t bytesAllocated() const { return bytes_allocated_; }
+
+private:
+  void addBlock(size_t min_size);
+
+  struct Block {
+    std::unique_ptr<uint8_t[]> storage_;
+    size_t capacity_;
+  };
+
+  // Most streams fit in the first block; keep the block list inline to avoid a heap
+  // allocation for the common case.
+  absl::InlinedVector<Block, 4> blocks_;
+  uint8_t* cursor_{nullptr};
+  uint8_t* end_{nullptr};
+  size_t next_block_size_;
+  uint64_t bytes_allocated_{0};
+};
+
+} // namespace Memory
+} // namespace Envoy
@@ -42,9 +42,9 @@ uint64_t Stats::totalPhysicalBytes() {
   return tcmalloc::MallocExtension::GetProperties()["generic.physical_memory_used"].value;
 }
 
-void Stats::dumpStatsToLog() {
-  ENVOY_LOG_MISC(debug, "TCMalloc stats:\n{}", tcmalloc::MallocExtension::GetStats());
-}
+std::string Stats::detailedStats() { return std::string(tcmalloc::MallocExtension::GetStats()); }
+
+void Stats::dumpStatsToLog() { ENVOY_LOG_MISC(debug, "TCMalloc stats:\n{}", detailedStats()); }
 
 } // namespace Memory
 } // namespace Envoy
@@ -93,13 +93,15 @@ uint64_t Stats::totalPhysicalBytes() {
   return value;
 }
 
-void Stats::dumpStatsToLog() {
+std::string Stats::detailedStats() {
   constexpr int buffer_size = 100000;
   auto buffer = std::make_unique<char[]>(buffer_size);
   MallocExtension::instance()->GetStats(buffer.get(), buffer_size);
-  ENVOY_LOG_MISC(debug, "TCMalloc stats:\n{}", buffer.get());
+  return std::string(buffer.get());
 }
 
+void Stats::dumpStatsToLog() { ENVOY_LOG_MISC(debug, "TCMalloc stats:\n{}", detailedStats()); }
+
 } // namespace Memory
 } // namespace Envoy
 
@@ -114,6 +116,7 @@ uint64_t Stats::totalCurrentlyReserved() { return 0; }
 uint64_t Stats::totalPageHeapUnmapped() { return 0; }
 uint64_t Stats::totalPageHeapFree() { return 0; }
 uint64_t Stats::totalPhysicalBytes() { return 0; }
+std::string Stats::detailedStats() { return ""; }
 void Stats::dumpStatsToLog() {}
 
 } // namespace Memory
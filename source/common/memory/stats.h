@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <string>
 
 namespace Envoy {
 namespace Memory {
@@ -45,6 +46,13 @@ public:
    */
   static uint64_t totalPhysicalBytes();
 
+  /**
+   * @return std::string the allocator's detailed breakdown of current memory usage (per-size-class
+   *                     and page heap occupancy, caches, etc). Empty when Envoy is not built with
+   *                     tcmalloc.
+   */
+  static std::string detailedStats();
+
   /**
    * Log detailed stats about current memory allocation. Intended for debugging purposes.
    */
@@ -15,6 +15,8 @@
 #include "source/common/network/socket_interface.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Network {
 namespace Address {
@@ -45,6 +47,47 @@ InstanceConstSharedPtr throwOnError(StatusOr<InstanceConstSharedPtr> address) {
   return *address;
 }
 
+// Per-thread cache of recently constructed IP address instances keyed by the raw sockaddr bytes.
+// Address instances are immutable, so identical bytes can share one instance. Accept-heavy paths
+// rebuild identical addresses constantly (most notably the local address of a wildcard listener,
+// which is identical for every accepted connection), and each rebuild pays two allocations plus
+// the friendly-name formatting; a hit here skips all of that. The cache is bounded and simply
+// reset when full: ephemeral-port remote addresses cycle through it, and recycling the map is
+// cheaper than tracking recency.
+class AddressInstanceCache {
+public:
+  InstanceConstSharedPtr find(const sockaddr_storage& ss, socklen_t ss_len, bool v6only) {
+    const auto entry = cache_.find(makeKey(ss, ss_len, v6only));
+    return entry == cache_.end() ? nullptr : entry->second;
+  }
+
+  void store(const sockaddr_storage& ss, socklen_t ss_len, bool v6only,
+             const InstanceConstSharedPtr& address) {
+    if (cache_.size() >= CacheLimit) {
+      cache_.clear();
+    }
+    cache_.emplace(std::string(makeKey(ss, ss_len, v6only)), address);
+  }
+
+private:
+  static constexpr size_t CacheLimit = 256;
+
+  // Builds the lookup key in place; the heterogeneous find above keeps cache hits allocation
+  // free. The first key byte disambiguates the v6only flag, which changes how v4-mapped v6
+  // addresses are materialized.
+  absl::string_view makeKey(const sockaddr_storage& ss, socklen_t ss_len, bool v6only) {
+    ASSERT(static_cast<size_t>(ss_len) < sizeof(key_buffer_));
+    key_buffer_[0] = v6only ? 1 : 0;
+    memcpy(&key_buffer_[1], &ss, ss_len); // NOLINT(safe-memcpy)
+    return {key_buffer_, static_cast<size_t>(ss_len) + 1};
+  }
+
+  absl::flat_hash_map<std::string, InstanceConstSharedPtr> cache_;
+  char key_buffer_[sizeof(sockaddr_storage) + 1];
+};
+
+thread_local AddressInstanceCache address_instance_cache;
+
 } // namespace
 
 bool forceV6() {
@@ -78,19 +121,38 @@ StatusOr<Address::InstanceConstSharedPtr> addressFromSockAddr(const sockaddr_sto
     RELEASE_ASSERT(ss_len == 0 || static_cast<unsigned int>(ss_len) == sizeof(sockaddr_in), "");
     const struct sockaddr_in* sin = reinterpret_cast<const struct sockaddr_in*>(&ss);
     ASSERT(AF_INET == sin->sin_family);
-    return Address::InstanceFactory::createInstancePtr<Address::Ipv4Instance>(sin);
+    if (ss_len != 0) {
+      if (InstanceConstSharedPtr cached = address_instance_cache.find(ss, ss_len, v6only)) {
+        return cached;
+      }
+    }
+    auto address = Address::InstanceFactory::createInstancePtr<Address::Ipv4Instance>(sin);
+    if (ss_len != 0 && address.ok()) {
+      address_instance_cache.store(ss, ss_len, v6only, *address);
+    }
+    return address;
   }
   case AF_INET6: {
     RELEASE_ASSERT(ss_len == 0 || static_cast<unsigned int>(ss_len) == sizeof(sockaddr_in6), "");
     const struct sockaddr_in6* sin6 = reinterpret_cast<const struct sockaddr_in6*>(&ss);
     ASSERT(AF_INET6 == sin6->sin6_family);
+    if (ss_len != 0) {
+      if (InstanceConstSharedPtr cached = address_instance_cache.find(ss, ss_len, v6only)) {
+        return cached;
+      }
+    }
+    StatusOr<InstanceConstSharedPtr> address;
     if (!v6only && IN6_IS_ADDR_V4MAPPED(&sin6->sin6_addr)) {
       struct sockaddr_in sin;
       ipv6ToIpv4CompatibleAddress(sin6, &sin);
-      return Address::InstanceFactory::createInstancePtr<Address::Ipv4Instance>(&sin);
+      address = Address::InstanceFactory::createInstancePtr<Address::Ipv4Instance>(&sin);
     } else {
-      return Address::InstanceFactory::createInstancePtr<Address::Ipv6Instance>(*sin6, v6only);
+      address = Address::InstanceFactory::createInstancePtr<Address::Ipv6Instance>(*sin6, v6only);
+    }
+    if (ss_len != 0 && address.ok()) {
+      address_instance_cache.store(ss, ss_len, v6only, *address);
     }
+    return address;
   }
   case AF_UNIX: {
     const struct sockaddr_un* sun = reinterpret_cast<const struct sockaddr_un*>(&ss);
@@ -1,5 +1,7 @@
 #include "source/common/network/connection_balancer_impl.h"
 
+#include <thread>
+
 namespace Envoy {
 namespace Network {
 
@@ -16,6 +18,59 @@ void ExactConnectionBalancerImpl::unregisterHandler(BalancedConnectionHandler& h
   handlers_.erase(std::find(handlers_.begin(), handlers_.end(), &handler));
 }
 
+void LeastLoadedConnectionBalancerImpl::registerHandler(BalancedConnectionHandler& handler) {
+  absl::MutexLock lock(&lock_);
+  handlers_.push_back(&handler);
+  publishSnapshotLocked();
+}
+
+void LeastLoadedConnectionBalancerImpl::unregisterHandler(BalancedConnectionHandler& handler) {
+  {
+    absl::MutexLock lock(&lock_);
+    handlers_.erase(std::find(handlers_.begin(), handlers_.end(), &handler));
+    publishSnapshotLocked();
+  }
+  // Wait for in-flight picks that may still be examining the handler through the old snapshot.
+  // A pick is a handful of loads so this drains immediately, and registration changes are rare
+  // (listener add/drain), so a spin is cheaper than making every accept take a lock.
+  while (active_picks_.load(std::memory_order_acquire) != 0) {
+    std::this_thread::yield();
+  }
+}
+
+void LeastLoadedConnectionBalancerImpl::publishSnapshotLocked() {
+  std::atomic_store(&snapshot_, std::shared_ptr<const HandlerSnapshot>(
+                                    std::make_shared<const HandlerSnapshot>(handlers_)));
+}
+
+BalancedConnectionHandler&
+LeastLoadedConnectionBalancerImpl::pickTargetHandler(BalancedConnectionHandler& current_handler) {
+  active_picks_.fetch_add(1, std::memory_order_acquire);
+  const auto snapshot = std::atomic_load(&snapshot_);
+  BalancedConnectionHandler* picked = &current_handler;
+  if (snapshot != nullptr && !snapshot->empty()) {
+    const uint64_t size = snapshot->size();
+    // Two indices from one mixed sequence number; avalanche the bits so consecutive accepts on
+    // one worker do not sample the same pair.
+    const uint64_t mixed = (pick_seq_.fetch_add(1, std::memory_order_relaxed) + 1) *
+                           0x9e3779b97f4a7c15; // 64-bit golden ratio.
+    uint64_t first = (mixed >> 32) % size;
+    uint64_t second = (mixed & 0xffffffff) % size;
+    if (first == second) {
+      second = (second + 1) % size;
+    }
+    picked = (*snapshot)[first];
+    if ((*snapshot)[second]->numConnections() < picked->numConnections()) {
+      picked = (*snapshot)[second];
+    }
+    picked->incNumConnections();
+  } else {
+    current_handler.incNumConnections();
+  }
+  active_picks_.fetch_sub(1, std::memory_order_release);
+  return *picked;
+}
+
 BalancedConnectionHandler&
 ExactConnectionBalancerImpl::pickTargetHandler(BalancedConnectionHandler&) {
   BalancedConnectionHandler* min_connection_handler = nullptr;
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 #include "envoy/config/listener/v3/listener.pb.h"
 #include "envoy/network/connection_balancer.h"
 #include "envoy/registry/registry.h"
@@ -44,6 +48,38 @@ private:
   std::vector<BalancedConnectionHandler*> handlers_ ABSL_GUARDED_BY(lock_);
 };
 
+/**
+ * Implementation of connection balancer that steers accepts by live handler load without taking a
+ * lock on the accept path. Handler registration publishes an immutable snapshot of the handler
+ * set; each pick samples two handlers from the snapshot ("power of two choices") and takes the
+ * one with fewer connections. This keeps workers within a small constant factor of each other
+ * under load while avoiding both the herding of a global minimum scan and the lock the exact
+ * balancer holds on every accept, so it suits listeners with high accept rates.
+ */
+class LeastLoadedConnectionBalancerImpl : public ConnectionBalancer {
+public:
+  // ConnectionBalancer
+  void registerHandler(BalancedConnectionHandler& handler) override;
+  void unregisterHandler(BalancedConnectionHandler& handler) override;
+  BalancedConnectionHandler& pickTargetHandler(BalancedConnectionHandler& current_handler) override;
+
+private:
+  using HandlerSnapshot = std::vector<BalancedConnectionHandler*>;
+
+  void publishSnapshotLocked() ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
+  absl::Mutex lock_;
+  std::vector<BalancedConnectionHandler*> handlers_ ABSL_GUARDED_BY(lock_);
+  // Read with std::atomic_load on the accept path; replaced wholesale under lock_ when the
+  // handler set changes.
+  std::shared_ptr<const HandlerSnapshot> snapshot_;
+  // Number of picks currently reading a snapshot; unregisterHandler() waits for this to drain so
+  // a handler is never examined after its listener is torn down.
+  std::atomic<uint32_t> active_picks_{0};
+  // Monotonic sequence mixed into the two sampled indices.
+  std::atomic<uint64_t> pick_seq_{0};
+};
+
 /**
  * A NOP connection balancer implementation that always continues execution after incrementing
  * the handler's connection count.
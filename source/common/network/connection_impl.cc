@@ -342,7 +342,19 @@ void ConnectionImpl::onRead(uint64_t read_buffer_size) {
     read_end_stream_raised_ = true;
   }
 
-  filter_manager_.onRead();
+  if (connection_stats_ != nullptr && connection_stats_->read_dispatch_us_ != nullptr) {
+    // Account the time this connection spends dispatching read data through its filter chain
+    // (which includes codec work for HTTP connections). This makes connections that monopolize a
+    // worker visible without affecting the dispatch itself.
+    const MonotonicTime start = dispatcher_.timeSource().monotonicTime();
+    filter_manager_.onRead();
+    connection_stats_->read_dispatch_us_->recordValue(
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            dispatcher_.timeSource().monotonicTime() - start)
+            .count());
+  } else {
+    filter_manager_.onRead();
+  }
 }
 
 void ConnectionImpl::enableHalfClose(bool enabled) {
@@ -11,6 +11,22 @@
 #include "absl/container/fixed_array.h"
 #include "absl/types/optional.h"
 
+#if defined(__linux__)
+#include <linux/errqueue.h>
+
+// Allow building against kernel headers that predate these constants; the runtime kernel
+// simply rejects SO_ZEROCOPY if it does not implement it.
+#ifndef SO_ZEROCOPY
+#define SO_ZEROCOPY 60
+#endif
+#ifndef MSG_ZEROCOPY
+#define MSG_ZEROCOPY 0x4000000
+#endif
+#ifndef SO_EE_ORIGIN_ZEROCOPY
+#define SO_EE_ORIGIN_ZEROCOPY 5
+#endif
+#endif // defined(__linux__)
+
 using Envoy::Api::SysCallIntResult;
 using Envoy::Api::SysCallSizeResult;
 
@@ -74,6 +90,15 @@ Api::IoCallUint64Result IoSocketHandleImpl::close() {
     file_event_.reset();
   }
 
+#if defined(__linux__)
+  if (!zero_copy_in_flight_.empty()) {
+    // Collect any notifications that already arrived; slices whose transmission is still in
+    // flight are released with the socket, matching the kernel's teardown of the error queue.
+    reapZeroCopyCompletions();
+    zero_copy_in_flight_.clear();
+  }
+#endif
+
   ASSERT(SOCKET_VALID(fd_));
   const int rc = Api::OsSysCallsSingleton::get().close(fd_).return_value_;
   SET_SOCKET_INVALID(fd_);
@@ -149,15 +174,131 @@ Api::IoCallUint64Result IoSocketHandleImpl::writev(const Buffer::RawSlice* slice
 }
 
 Api::IoCallUint64Result IoSocketHandleImpl::write(Buffer::Instance& buffer) {
+#if defined(__linux__)
+  if (zero_copy_send_enabled_) {
+    reapZeroCopyCompletions();
+    static constexpr uint64_t ZeroCopySendThreshold = 64 * 1024;
+    if (buffer.length() >= ZeroCopySendThreshold) {
+      return writeZeroCopy(buffer);
+    }
+  }
+#endif
   constexpr uint64_t MaxSlices = 16;
   Buffer::RawSliceVector slices = buffer.getRawSlices(MaxSlices);
   Api::IoCallUint64Result result = writev(slices.begin(), slices.size());
   if (result.ok() && result.return_value_ > 0) {
-    buffer.drain(static_cast<uint64_t>(result.return_value_));
+    if (!zero_copy_in_flight_.empty()) {
+      retainZeroCopySlices(buffer, result.return_value_);
+    } else {
+      buffer.drain(static_cast<uint64_t>(result.return_value_));
+    }
   }
   return result;
 }
 
+bool IoSocketHandleImpl::enableZeroCopySend() {
+#if defined(__linux__)
+  const int on = 1;
+  const Api::SysCallIntResult result =
+      Api::OsSysCallsSingleton::get().setsockopt(fd_, SOL_SOCKET, SO_ZEROCOPY, &on, sizeof(on));
+  zero_copy_send_enabled_ = result.return_value_ == 0;
+#endif
+  return zero_copy_send_enabled_;
+}
+
+#if defined(__linux__)
+Api::IoCallUint64Result IoSocketHandleImpl::writeZeroCopy(Buffer::Instance& buffer) {
+  constexpr uint64_t MaxSlices = 16;
+  Buffer::RawSliceVector slices = buffer.getRawSlices(MaxSlices);
+  absl::FixedArray<iovec> iov(slices.size());
+  uint64_t num_slices_to_write = 0;
+  for (const Buffer::RawSlice& slice : slices) {
+    if (slice.mem_ != nullptr && slice.len_ != 0) {
+      iov[num_slices_to_write].iov_base = slice.mem_;
+      iov[num_slices_to_write].iov_len = slice.len_;
+      num_slices_to_write++;
+    }
+  }
+  if (num_slices_to_write == 0) {
+    return Api::ioCallUint64ResultNoError();
+  }
+
+  msghdr message{};
+  message.msg_iov = iov.begin();
+  message.msg_iovlen = num_slices_to_write;
+  Api::SysCallSizeResult result =
+      Api::OsSysCallsSingleton::get().sendmsg(fd_, &message, MSG_ZEROCOPY);
+  if (result.return_value_ < 0 && result.errno_ == ENOBUFS) {
+    // The kernel could not pin more pages (optmem_max); fall back to a copying send for this
+    // write and let the next large write try zero-copy again.
+    result = Api::OsSysCallsSingleton::get().sendmsg(fd_, &message, 0);
+    if (result.return_value_ > 0) {
+      if (!zero_copy_in_flight_.empty()) {
+        retainZeroCopySlices(buffer, result.return_value_);
+      } else {
+        buffer.drain(static_cast<uint64_t>(result.return_value_));
+      }
+    }
+    return sysCallResultToIoCallResult(result);
+  }
+  if (result.return_value_ < 0) {
+    return sysCallResultToIoCallResult(result);
+  }
+
+  // The kernel references the sent bytes in place until the matching notification arrives on
+  // the error queue, so move their slices out of the caller's buffer into the retention list.
+  const uint32_t notification_id = zero_copy_send_counter_++;
+  zero_copy_in_flight_.emplace_back(notification_id, Buffer::OwnedImpl());
+  zero_copy_in_flight_.back().second.move(buffer, result.return_value_);
+  return sysCallResultToIoCallResult(result);
+}
+
+void IoSocketHandleImpl::reapZeroCopyCompletions() {
+  while (!zero_copy_in_flight_.empty()) {
+    msghdr message{};
+    char control[CMSG_SPACE(sizeof(sock_extended_err))];
+    message.msg_control = control;
+    message.msg_controllen = sizeof(control);
+    const Api::SysCallSizeResult result =
+        Api::OsSysCallsSingleton::get().recvmsg(fd_, &message, MSG_ERRQUEUE | MSG_DONTWAIT);
+    if (result.return_value_ < 0) {
+      // Nothing further on the error queue.
+      return;
+    }
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&message); cmsg != nullptr;
+         cmsg = CMSG_NXTHDR(&message, cmsg)) {
+      if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+          (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR)) {
+        const auto* serr = reinterpret_cast<const sock_extended_err*>(CMSG_DATA(cmsg));
+        if (serr->ee_errno == 0 && serr->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+          // The notification covers the inclusive range [ee_info, ee_data]; notifications are
+          // delivered in order, so everything keyed at or below the upper bound is done.
+          const uint32_t upper_bound = serr->ee_data;
+          while (!zero_copy_in_flight_.empty() &&
+                 zero_copy_in_flight_.front().first <= upper_bound) {
+            zero_copy_in_flight_.pop_front();
+          }
+        }
+      }
+    }
+  }
+}
+
+void IoSocketHandleImpl::retainZeroCopySlices(Buffer::Instance& buffer, uint64_t length) {
+  ASSERT(!zero_copy_in_flight_.empty());
+  // A copying send carries no notification of its own; its slices are released together with
+  // the newest outstanding zero-copy send, which completes no earlier than any reference an
+  // older send may still hold into them.
+  zero_copy_in_flight_.back().second.move(buffer, length);
+}
+#else
+Api::IoCallUint64Result IoSocketHandleImpl::writeZeroCopy(Buffer::Instance&) {
+  return Api::ioCallUint64ResultNoError();
+}
+void IoSocketHandleImpl::reapZeroCopyCompletions() {}
+void IoSocketHandleImpl::retainZeroCopySlices(Buffer::Instance&, uint64_t) {}
+#endif // defined(__linux__)
+
 Api::IoCallUint64Result IoSocketHandleImpl::sendmsg(const Buffer::RawSlice* slices,
                                                     uint64_t num_slice, int flags,
                                                     const Address::Ip* self_ip,
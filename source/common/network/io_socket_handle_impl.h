@@ -6,6 +6,9 @@
 #include "envoy/event/dispatcher.h"
 #include "envoy/network/io_handle.h"
 
+#include <list>
+
+#include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/logger.h"
 #include "source/common/network/io_socket_error_impl.h"
 #include "source/common/runtime/runtime_features.h"
@@ -44,6 +47,15 @@ public:
 
   Api::IoCallUint64Result write(Buffer::Instance& buffer) override;
 
+  /**
+   * Opts this handle into MSG_ZEROCOPY transmission (Linux only). Writes of 64KB or more are
+   * handed to the kernel by reference and their slices are retained until the kernel reports
+   * the transmission complete on the socket error queue; smaller writes keep the regular
+   * copying path.
+   * @return whether the socket accepted SO_ZEROCOPY.
+   */
+  bool enableZeroCopySend();
+
   Api::IoCallUint64Result sendmsg(const Buffer::RawSlice* slices, uint64_t num_slice, int flags,
                                   const Address::Ip* self_ip,
                                   const Address::Instance& peer_address) override;
@@ -106,11 +118,30 @@ protected:
              : Api::IoErrorPtr(new IoSocketError(result.errno_), IoSocketError::deleteIoError)));
   }
 
+  // Transmits a large write with MSG_ZEROCOPY and moves the sent slices into
+  // zero_copy_in_flight_ so they outlive the kernel's reference to them.
+  Api::IoCallUint64Result writeZeroCopy(Buffer::Instance& buffer);
+
+  // Drains zero-copy completion notifications from the socket error queue and releases the
+  // retained slices they cover.
+  void reapZeroCopyCompletions();
+
+  // Moves length sent bytes out of buffer into the retention list. Used instead of a plain
+  // drain while zero-copy sends are outstanding, since a partially sent slice may still be
+  // referenced by an earlier MSG_ZEROCOPY transmission.
+  void retainZeroCopySlices(Buffer::Instance& buffer, uint64_t length);
+
   os_fd_t fd_;
   int socket_v6only_{false};
   const absl::optional<int> domain_;
   Event::FileEventPtr file_event_{nullptr};
 
+  // MSG_ZEROCOPY state: each entry holds the slices of one send, keyed by the zero-copy
+  // notification counter value the kernel will report when the send has been transmitted.
+  bool zero_copy_send_enabled_{false};
+  uint32_t zero_copy_send_counter_{0};
+  std::list<std::pair<uint32_t, Buffer::OwnedImpl>> zero_copy_in_flight_;
+
   // The minimum cmsg buffer size to filled in destination address, packets dropped and gso
   // size when receiving a packet. It is possible for a received packet to contain both IPv4
   // and IPV6 addresses.
@@ -117,6 +117,13 @@ SocketOptionFactory::buildTcpFastOpenOptions(uint32_t queue_length) {
   return options;
 }
 
+std::unique_ptr<Socket::Options> SocketOptionFactory::buildTcpFastOpenConnectOptions() {
+  std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
+  options->push_back(std::make_shared<Network::SocketOptionImpl>(
+      envoy::config::core::v3::SocketOption::STATE_PREBIND, ENVOY_SOCKET_TCP_FASTOPEN_CONNECT, 1));
+  return options;
+}
+
 std::unique_ptr<Socket::Options> SocketOptionFactory::buildIpPacketInfoOptions() {
   std::unique_ptr<Socket::Options> options = std::make_unique<Socket::Options>();
   options->push_back(std::make_shared<AddrFamilyAwareSocketOptionImpl>(
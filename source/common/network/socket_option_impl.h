@@ -104,6 +104,13 @@ namespace Network {
 #define ENVOY_SOCKET_TCP_FASTOPEN Network::SocketOptionName()
 #endif
 
+#ifdef TCP_FASTOPEN_CONNECT
+#define ENVOY_SOCKET_TCP_FASTOPEN_CONNECT                                                          \
+  ENVOY_MAKE_SOCKET_OPTION_NAME(IPPROTO_TCP, TCP_FASTOPEN_CONNECT)
+#else
+#define ENVOY_SOCKET_TCP_FASTOPEN_CONNECT Network::SocketOptionName()
+#endif
+
 // Linux uses IP_PKTINFO for both sending source address and receiving destination
 // address.
 // FreeBSD uses IP_RECVDSTADDR for receiving destination address and IP_SENDSRCADDR for sending
@@ -130,6 +137,12 @@ static_assert(IP_RECVDSTADDR == IP_SENDSRCADDR);
 #define ENVOY_ATTACH_REUSEPORT_CBPF Network::SocketOptionName()
 #endif
 
+#ifdef SO_INCOMING_CPU
+#define ENVOY_SOCKET_SO_INCOMING_CPU ENVOY_MAKE_SOCKET_OPTION_NAME(SOL_SOCKET, SO_INCOMING_CPU)
+#else
+#define ENVOY_SOCKET_SO_INCOMING_CPU Network::SocketOptionName()
+#endif
+
 class SocketOptionImpl : public Socket::Option, Logger::Loggable<Logger::Id::connection> {
 public:
   SocketOptionImpl(envoy::config::core::v3::SocketOption::SocketState in_state,
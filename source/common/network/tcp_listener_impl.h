@@ -30,6 +30,11 @@ public:
 
   static const absl::string_view GlobalMaxCxRuntimeKey;
 
+  // Maximum number of connections accepted during one socket event. Bounds the time the listener
+  // can monopolize a worker during a connection storm; the remainder of the backlog is picked up
+  // by the next (level triggered) event.
+  static constexpr uint32_t MaxAcceptsPerSocketEvent = 64;
+
 protected:
   TcpListenerCallbacks& cb_;
 
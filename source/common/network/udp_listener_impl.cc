@@ -17,6 +17,7 @@
 #include "source/common/event/dispatcher_impl.h"
 #include "source/common/network/address_impl.h"
 #include "source/common/network/io_socket_error_impl.h"
+#include "source/common/runtime/runtime_features.h"
 
 #include "absl/container/fixed_array.h"
 #include "event2/listener.h"
@@ -32,8 +33,10 @@ UdpListenerImpl::UdpListenerImpl(Event::DispatcherImpl& dispatcher, SocketShared
                                  UdpListenerCallbacks& cb, TimeSource& time_source,
                                  const envoy::config::core::v3::UdpSocketConfig& config)
     : BaseListenerImpl(dispatcher, std::move(socket)), cb_(cb), time_source_(time_source),
-      // Default prefer_gro to false for downstream server traffic.
-      config_(config, false) {
+      // Default prefer_gro to false for downstream server traffic unless the runtime flag opts
+      // in; an explicit prefer_gro in the listener config always wins.
+      config_(config, Runtime::runtimeFeatureEnabled(
+                          "envoy.reloadable_features.udp_listener_prefer_gro")) {
   socket_->ioHandle().initializeFileEvent(
       dispatcher, [this](uint32_t events) -> void { onSocketEvent(events); },
       Event::PlatformDefaultTriggerType, Event::FileReadyType::Read | Event::FileReadyType::Write);
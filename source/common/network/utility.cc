@@ -636,7 +636,13 @@ Api::IoCallUint64Result Utility::readFromSocket(IoHandle& handle,
   }
 
   if (handle.supportsMmsg()) {
-    const auto max_rx_datagram_size = udp_packet_processor.maxDatagramSize();
+    const uint64_t max_allowed_datagram_size = udp_packet_processor.maxDatagramSize();
+    // Reserve whole default-sized slices so the per-datagram storage comes from the per-thread
+    // storage cache instead of the allocator; reservations for datagrams that do not arrive in
+    // this batch recycle straight back to it. The processor's limit is still enforced below on
+    // the received length.
+    const uint64_t max_rx_datagram_size =
+        std::max<uint64_t>(max_allowed_datagram_size, Buffer::Slice::default_slice_size_);
 
     // Buffer::ReservationSingleSlice is always passed by value, and can only be constructed
     // by Buffer::Instance::reserve(), so this is needed to keep a fixed array
@@ -676,6 +682,13 @@ Api::IoCallUint64Result Utility::readFromSocket(IoHandle& handle,
       Buffer::RawSlice* slice = slices[i].data();
       const uint64_t msg_len = output.msg_[i].msg_len_;
       ASSERT(msg_len <= slice->len_);
+      if (msg_len > max_allowed_datagram_size) {
+        // The rounded-up reservation can fit datagrams beyond the processor's limit; drop them
+        // exactly as the kernel truncation path used to.
+        ENVOY_LOG_MISC(debug, "Dropped a packet with {} bytes over the max datagram size {}",
+                       msg_len, max_allowed_datagram_size);
+        continue;
+      }
       ENVOY_LOG_MISC(debug, "Receive a packet with {} bytes from {}", msg_len,
                      output.msg_[i].peer_address_->asString());
 
@@ -10,12 +10,15 @@
 #include "source/common/common/assert.h"
 #include "source/common/common/documentation_url.h"
 #include "source/common/common/fmt.h"
+#include "source/common/json/json_utility.h"
 #include "source/common/protobuf/message_validator_impl.h"
 #include "source/common/protobuf/protobuf.h"
 #include "source/common/protobuf/visitor.h"
 #include "source/common/runtime/runtime_features.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/match.h"
+#include "absl/synchronization/mutex.h"
 #include "udpa/annotations/sensitive.pb.h"
 #include "udpa/annotations/status.pb.h"
 #include "validate/validate.h"
@@ -110,13 +113,26 @@ ProtobufWkt::Value parseYamlNode(const YAML::Node& node) {
 void jsonConvertInternal(const Protobuf::Message& source,
                          ProtobufMessage::ValidationVisitor& validation_visitor,
                          Protobuf::Message& dest) {
-  Protobuf::util::JsonPrintOptions json_options;
-  json_options.preserve_proto_field_names = true;
   std::string json;
-  const auto status = Protobuf::util::MessageToJsonString(source, &json, json_options);
-  if (!status.ok()) {
-    throw EnvoyException(fmt::format("Unable to convert protobuf message to JSON string: {} {}",
-                                     status.ToString(), source.DebugString()));
+  // YAML loading converts through a Value intermediary (YAML -> Value -> JSON -> message), so
+  // on this path the source is a Struct or Value; render it with the direct JSON walker
+  // instead of the reflection-based printer. This shows up at startup, where every YAML
+  // bootstrap and typed config passes through here.
+  const auto* struct_source = Protobuf::DynamicCastToGenerated<ProtobufWkt::Struct>(&source);
+  const auto* value_source =
+      struct_source ? nullptr : Protobuf::DynamicCastToGenerated<ProtobufWkt::Value>(&source);
+  if (struct_source != nullptr) {
+    Json::Utility::appendStructToString(*struct_source, json);
+  } else if (value_source != nullptr) {
+    Json::Utility::appendValueToString(*value_source, json);
+  } else {
+    Protobuf::util::JsonPrintOptions json_options;
+    json_options.preserve_proto_field_names = true;
+    const auto status = Protobuf::util::MessageToJsonString(source, &json, json_options);
+    if (!status.ok()) {
+      throw EnvoyException(fmt::format("Unable to convert protobuf message to JSON string: {} {}",
+                                       status.ToString(), source.DebugString()));
+    }
   }
   MessageUtil::loadFromJson(json, dest, validation_visitor);
 }
@@ -223,7 +239,63 @@ void ProtoExceptionUtil::throwProtoValidationException(const std::string& valida
   throw ProtoValidationException(validation_error, message);
 }
 
+namespace {
+
+// Feeds the bytes written by a serialization pass directly into an xxHash64 streaming state,
+// without materializing the serialized string.
+class XxHash64OutputStream : public Protobuf::io::ZeroCopyOutputStream {
+public:
+  XxHash64OutputStream() { XXH64_reset(&state_, 0); }
+
+  // Protobuf::io::ZeroCopyOutputStream
+  bool Next(void** data, int* size) override {
+    hashPending();
+    *data = buffer_;
+    *size = sizeof(buffer_);
+    pending_ = sizeof(buffer_);
+    byte_count_ += sizeof(buffer_);
+    return true;
+  }
+  void BackUp(int count) override {
+    pending_ -= count;
+    byte_count_ -= count;
+  }
+  int64_t ByteCount() const override { return byte_count_; }
+
+  uint64_t digest() {
+    hashPending();
+    return XXH64_digest(&state_);
+  }
+
+private:
+  void hashPending() {
+    if (pending_ > 0) {
+      XXH64_update(&state_, buffer_, pending_);
+      pending_ = 0;
+    }
+  }
+
+  XXH64_state_t state_;
+  char buffer_[1024];
+  int pending_{0};
+  int64_t byte_count_{0};
+};
+
+} // namespace
+
 size_t MessageUtil::hash(const Protobuf::Message& message) {
+  if (Runtime::runtimeFeatureEnabled("envoy.restart_features.use_fast_protobuf_hash")) {
+    // Stream the deterministic wire form straight into the hash state. Note this hashes the
+    // serialized bytes: unlike the text format path below it includes unknown fields and does
+    // not expand Any messages.
+    XxHash64OutputStream hashing_stream;
+    Protobuf::io::CodedOutputStream coded_stream(&hashing_stream);
+    coded_stream.SetSerializationDeterministic(true);
+    message.SerializeToCodedStream(&coded_stream);
+    coded_stream.Trim();
+    return hashing_stream.digest();
+  }
+
   std::string text_format;
 
   {
@@ -364,6 +436,50 @@ void checkForDeprecatedNonRepeatedEnumValue(
       message, validation_visitor);
 }
 
+// Static per-field-descriptor properties that determine whether onField() below has any
+// work to do. The descriptor pool is immutable at runtime, so these are computed once per
+// field descriptor and memoized; fields without deprecation/WIP annotations (the vast
+// majority) then skip all reflection during the validation walk.
+constexpr uint8_t CheckDeprecatedEnumValue = 0x1;
+constexpr uint8_t CheckWorkInProgress = 0x2;
+constexpr uint8_t CheckDeprecatedField = 0x4;
+
+uint8_t computeFieldChecks(const Protobuf::FieldDescriptor& field) {
+  uint8_t checks = 0;
+  if (!field.is_repeated() && field.cpp_type() == Protobuf::FieldDescriptor::CPPTYPE_ENUM) {
+    const Protobuf::EnumDescriptor& enum_type = *field.enum_type();
+    for (int i = 0; i < enum_type.value_count(); ++i) {
+      if (enum_type.value(i)->options().deprecated()) {
+        checks |= CheckDeprecatedEnumValue;
+        break;
+      }
+    }
+  }
+  if (field.options().GetExtension(xds::annotations::v3::field_status).work_in_progress()) {
+    checks |= CheckWorkInProgress;
+  }
+  if (field.options().deprecated()) {
+    checks |= CheckDeprecatedField;
+  }
+  return checks;
+}
+
+uint8_t fieldChecks(const Protobuf::FieldDescriptor& field) {
+  static absl::Mutex mutex;
+  static auto* checks_map = new absl::flat_hash_map<const Protobuf::FieldDescriptor*, uint8_t>();
+  {
+    absl::ReaderMutexLock lock(&mutex);
+    auto it = checks_map->find(&field);
+    if (it != checks_map->end()) {
+      return it->second;
+    }
+  }
+  const uint8_t checks = computeFieldChecks(field);
+  absl::WriterMutexLock lock(&mutex);
+  checks_map->emplace(&field, checks);
+  return checks;
+}
+
 constexpr absl::string_view WipWarning =
     "API features marked as work-in-progress are not considered stable, are not covered by the "
     "threat model, are not supported by the security team, and are subject to breaking changes. Do "
@@ -376,13 +492,22 @@ public:
       : validation_visitor_(validation_visitor), runtime_(runtime) {}
 
   void onField(const Protobuf::Message& message, const Protobuf::FieldDescriptor& field) override {
+    // Fields without deprecation/WIP annotations anywhere in their descriptor have nothing
+    // to report; skip them without touching reflection.
+    const uint8_t checks = fieldChecks(field);
+    if (checks == 0) {
+      return;
+    }
+
     const Protobuf::Reflection* reflection = message.GetReflection();
     absl::string_view filename = filenameFromPath(field.file()->name());
 
     // Before we check to see if the field is in use, see if there's a
     // deprecated default enum value.
-    checkForDeprecatedNonRepeatedEnumValue(message, filename, &field, reflection, runtime_,
-                                           validation_visitor_);
+    if ((checks & CheckDeprecatedEnumValue) != 0) {
+      checkForDeprecatedNonRepeatedEnumValue(message, filename, &field, reflection, runtime_,
+                                             validation_visitor_);
+    }
 
     // If this field is not in use, continue.
     if ((field.is_repeated() && reflection->FieldSize(message, &field) == 0) ||
@@ -390,14 +515,13 @@ public:
       return;
     }
 
-    const auto& field_status = field.options().GetExtension(xds::annotations::v3::field_status);
-    if (field_status.work_in_progress()) {
+    if ((checks & CheckWorkInProgress) != 0) {
       validation_visitor_.onWorkInProgress(fmt::format(
           "field '{}' is marked as work-in-progress. {}", field.full_name(), WipWarning));
     }
 
     // If this field is deprecated, warn or throw an error.
-    if (field.options().deprecated()) {
+    if ((checks & CheckDeprecatedField) != 0) {
       const std::string warning =
           absl::StrCat("Using {}deprecated option '", field.full_name(), "' from file ", filename,
                        ". This configuration will be removed from "
@@ -525,6 +649,28 @@ std::string MessageUtil::getYamlStringFromMessage(const Protobuf::Message& messa
 ProtobufUtil::StatusOr<std::string>
 MessageUtil::getJsonStringFromMessage(const Protobuf::Message& message, const bool pretty_print,
                                       const bool always_print_primitive_fields) {
+  // Struct and Value payloads (access log formatters, tracer annotations, typed filter configs)
+  // can be walked directly instead of going through the reflection-based JSON printer; the
+  // printer options below do not affect these types. Guarded off by default because the walker
+  // accepts inputs the printer rejects: non-finite numbers and invalid UTF-8 serialize instead
+  // of returning an error.
+  if (!pretty_print &&
+      Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.protobuf_direct_struct_json_serialization")) {
+    const auto* struct_message = Protobuf::DynamicCastToGenerated<ProtobufWkt::Struct>(&message);
+    if (struct_message != nullptr) {
+      std::string json;
+      Json::Utility::appendStructToString(*struct_message, json);
+      return json;
+    }
+    const auto* value_message = Protobuf::DynamicCastToGenerated<ProtobufWkt::Value>(&message);
+    if (value_message != nullptr) {
+      std::string json;
+      Json::Utility::appendValueToString(*value_message, json);
+      return json;
+    }
+  }
+
   Protobuf::util::JsonPrintOptions json_options;
   // By default, proto field names are converted to camelCase when the message is converted to JSON.
   // Setting this option makes debugging easier because it keeps field names consistent in JSON
@@ -196,6 +196,11 @@ uint32_t ActiveQuicListener::destination(const Network::UdpRecvData& data) const
   }
 
   connection_id_snippet = htonl(connection_id_snippet);
+  if ((concurrency_ & (concurrency_ - 1)) == 0) {
+    // Concurrency is a power of two: same routing decision as the modulus below
+    // without a division per packet.
+    return connection_id_snippet & (concurrency_ - 1);
+  }
   return connection_id_snippet % concurrency_;
 }
 
@@ -109,7 +109,9 @@ void EnvoyQuicClientStream::encodeData(Buffer::Instance& data, bool end_stream)
     quic_slices.reserve(raw_slices.size());
     for (auto& slice : raw_slices) {
       ASSERT(slice.len_ != 0);
-      // Move each slice into a stand-alone buffer.
+      // Move each slice into a stand-alone mem slice without copying the payload: the refcounted
+      // Envoy buffer slice is transferred into the mem slice and retained by quiche's stream send
+      // buffer until the corresponding stream bytes are acked.
       // TODO(danzh): investigate the cost of allocating one buffer per slice.
       // If it turns out to be expensive, add a new function to free data in the middle in buffer
       // interface and re-design QuicheMemSliceImpl.
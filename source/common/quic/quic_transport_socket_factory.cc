@@ -61,7 +61,8 @@ QuicClientTransportSocketFactory::QuicClientTransportSocketFactory(
     Server::Configuration::TransportSocketFactoryContext& factory_context)
     : QuicTransportSocketFactoryBase(factory_context.scope(), "client"),
       fallback_factory_(std::make_unique<Extensions::TransportSockets::Tls::ClientSslSocketFactory>(
-          std::move(config), factory_context.sslContextManager(), factory_context.scope())) {}
+          std::move(config), factory_context.sslContextManager(), factory_context.scope())),
+      session_cache_(std::make_shared<quic::QuicClientSessionCache>()) {}
 
 ProtobufTypes::MessagePtr QuicClientTransportSocketConfigFactory::createEmptyConfigProto() {
   return std::make_unique<envoy::extensions::transport_sockets::quic::v3::QuicUpstreamTransport>();
@@ -77,11 +78,12 @@ std::shared_ptr<quic::QuicCryptoClientConfig> QuicClientTransportSocketFactory::
   }
 
   if (client_context_ != context) {
-    // If the context has been updated, update the crypto config.
+    // If the context has been updated, update the crypto config. The session cache is
+    // reused so that resumption tickets cached under the previous context remain usable
+    // and new connections can still attempt 0-RTT right after a cert update.
     client_context_ = context;
     crypto_config_ = std::make_shared<quic::QuicCryptoClientConfig>(
-        std::make_unique<Quic::EnvoyQuicProofVerifier>(std::move(context)),
-        std::make_unique<quic::QuicClientSessionCache>());
+        std::make_unique<Quic::EnvoyQuicProofVerifier>(std::move(context)), session_cache_);
   }
   // Return the latest crypto config.
   return crypto_config_;
@@ -144,6 +144,10 @@ private:
   Envoy::Ssl::ClientContextSharedPtr client_context_;
   // If client_context_ changes, client config will be updated as well.
   std::shared_ptr<quic::QuicCryptoClientConfig> crypto_config_;
+  // Shared across crypto config updates so that cached TLS resumption state (session
+  // tickets and transport parameters, keyed by server id) survives cert rotations and
+  // keeps 0-RTT available for new connections.
+  std::shared_ptr<quic::SessionCache> session_cache_;
 };
 
 // Base class to create above QuicTransportSocketFactory for server and client
@@ -428,6 +428,9 @@ ShadowPolicyImpl::ShadowPolicyImpl(const RequestMirrorPolicy& config)
     default_value_.set_denominator(envoy::type::v3::FractionalPercent::HUNDRED);
   }
   trace_sampled_ = PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, trace_sampled, true);
+  if (config.has_max_mirrored_body_bytes()) {
+    max_mirrored_body_bytes_ = config.max_mirrored_body_bytes().value();
+  }
 }
 
 DecoratorImpl::DecoratorImpl(const envoy::config::route::v3::Decorator& decorator)
@@ -575,12 +578,12 @@ RouteEntryImplBase::RouteEntryImplBase(const VirtualHostImpl& vhost,
       match_grpc_(route.match().has_grpc()),
       case_sensitive_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(route.match(), case_sensitive, true)) {
   if (!route.request_headers_to_add().empty() || !route.request_headers_to_remove().empty()) {
-    request_headers_parser_ =
-        HeaderParser::configure(route.request_headers_to_add(), route.request_headers_to_remove());
+    request_headers_parser_ = HeaderParser::configureShared(route.request_headers_to_add(),
+                                                            route.request_headers_to_remove());
   }
   if (!route.response_headers_to_add().empty() || !route.response_headers_to_remove().empty()) {
-    response_headers_parser_ = HeaderParser::configure(route.response_headers_to_add(),
-                                                       route.response_headers_to_remove());
+    response_headers_parser_ = HeaderParser::configureShared(route.response_headers_to_add(),
+                                                             route.response_headers_to_remove());
   }
   if (route.has_metadata()) {
     metadata_ = std::make_unique<envoy::config::core::v3::Metadata>(route.metadata());
@@ -615,7 +618,11 @@ RouteEntryImplBase::RouteEntryImplBase(const VirtualHostImpl& vhost,
     const std::string& runtime_key_prefix = route.route().weighted_clusters().runtime_key_prefix();
 
     std::vector<WeightedClusterEntrySharedPtr> weighted_clusters;
+    std::vector<uint64_t> cumulative_cluster_weights;
     weighted_clusters.reserve(route.route().weighted_clusters().clusters().size());
+    if (runtime_key_prefix.empty()) {
+      cumulative_cluster_weights.reserve(route.route().weighted_clusters().clusters().size());
+    }
     for (const auto& cluster : route.route().weighted_clusters().clusters()) {
       auto cluster_entry = std::make_unique<WeightedClusterEntry>(
           this, runtime_key_prefix + "." + cluster.name(), factory_context, validator, cluster,
@@ -627,6 +634,11 @@ RouteEntryImplBase::RouteEntryImplBase(const VirtualHostImpl& vhost,
             fmt::format("The sum of weights of all weighted clusters of route {} exceeds {}",
                         route_name_, std::numeric_limits<uint32_t>::max()));
       }
+      // Without a runtime_key_prefix the weights are immutable, so the interval bounds can be
+      // precomputed for a binary search pick at request time.
+      if (runtime_key_prefix.empty()) {
+        cumulative_cluster_weights.push_back(total_weight);
+      }
     }
 
     // Reject the config if the total_weight of all clusters is 0.
@@ -635,7 +647,8 @@ RouteEntryImplBase::RouteEntryImplBase(const VirtualHostImpl& vhost,
     }
 
     weighted_clusters_config_ = std::make_unique<WeightedClustersConfig>(
-        weighted_clusters, total_weight, route.route().weighted_clusters().header_name());
+        weighted_clusters, total_weight, route.route().weighted_clusters().header_name(),
+        std::move(cumulative_cluster_weights));
 
   } else if (route.route().cluster_specifier_case() ==
              envoy::config::route::v3::RouteAction::ClusterSpecifierCase::
@@ -751,6 +764,27 @@ RouteEntryImplBase::RouteEntryImplBase(const VirtualHostImpl& vhost,
   } else {
     early_data_policy_ = std::make_unique<DefaultEarlyDataPolicy>(/*allow_safe_request*/ true);
   }
+
+  // Resolve the route -> virtual host -> route configuration typed_per_filter_config walk once
+  // here, so that the per-request mostSpecificPerFilterConfig() lookup is a single map probe.
+  // All three levels are fully constructed before any route entry (see the ConfigImpl and
+  // VirtualHostImpl constructors), so the resolved pointers are stable.
+  absl::flat_hash_set<std::string> filter_names;
+  for (std::string& name : vhost.perFilterConfigNames()) {
+    filter_names.insert(std::move(name));
+  }
+  for (std::string& name : per_filter_configs_.filterNames()) {
+    filter_names.insert(std::move(name));
+  }
+  for (const std::string& name : filter_names) {
+    const RouteSpecificFilterConfig* config = per_filter_configs_.get(name);
+    if (config == nullptr) {
+      config = vhost.mostSpecificPerFilterConfig(name);
+    }
+    if (config != nullptr) {
+      resolved_per_filter_configs_.emplace(name, config);
+    }
+  }
 }
 
 bool RouteEntryImplBase::evaluateRuntimeMatch(const uint64_t random_value) const {
@@ -843,6 +877,12 @@ bool RouteEntryImplBase::matchRoute(const Http::RequestHeaderMap& headers,
   return matches;
 }
 
+bool RouteEntryImplBase::matchesOnPathOnly() const {
+  return case_sensitive_ && runtime_ == nullptr && !match_grpc_ && config_headers_.empty() &&
+         config_query_parameters_.empty() && tls_context_match_criteria_ == nullptr &&
+         dynamic_metadata_.empty();
+}
+
 const std::string& RouteEntryImplBase::clusterName() const { return cluster_name_; }
 
 void RouteEntryImplBase::finalizeRequestHeaders(Http::RequestHeaderMap& headers,
@@ -1283,9 +1323,8 @@ RouteConstSharedPtr RouteEntryImplBase::pickWeightedCluster(const Http::HeaderMa
   // weighted_clusters_config_ is known not to be nullptr here. If it were, pickWeightedCluster
   // would not be called.
   ASSERT(weighted_clusters_config_ != nullptr);
-  if (!weighted_clusters_config_->random_value_header_name_.empty()) {
-    const auto header_value = headers.get(
-        Envoy::Http::LowerCaseString(weighted_clusters_config_->random_value_header_name_));
+  if (!weighted_clusters_config_->random_value_header_name_.get().empty()) {
+    const auto header_value = headers.get(weighted_clusters_config_->random_value_header_name_);
     if (!header_value.empty() && header_value.size() == 1) {
       // We expect single-valued header here, otherwise it will potentially cause inconsistent
       // weighted cluster picking throughout the process because different values are used to
@@ -1308,34 +1347,54 @@ RouteConstSharedPtr RouteEntryImplBase::pickWeightedCluster(const Http::HeaderMa
   const uint64_t selected_value =
       (random_value_from_header.has_value() ? random_value_from_header.value() : random_value) %
       weighted_clusters_config_->total_cluster_weight_;
-  uint64_t begin = 0;
-  uint64_t end = 0;
-
-  // Find the right cluster to route to based on the interval in which
-  // the selected value falls. The intervals are determined as
-  // [0, cluster1_weight), [cluster1_weight, cluster1_weight+cluster2_weight),..
-  for (const WeightedClusterEntrySharedPtr& cluster :
-       weighted_clusters_config_->weighted_clusters_) {
-    end = begin + cluster->clusterWeight();
-    if (!ignore_overflow) {
-      // end > total_cluster_weight: This case can only occur with Runtimes,
-      // when the user specifies invalid weights such that
-      // sum(weights) > total_cluster_weight.
-      ASSERT(end <= weighted_clusters_config_->total_cluster_weight_);
-    }
-
-    if (selected_value >= begin && selected_value < end) {
-      if (!cluster->clusterHeaderName().get().empty() &&
-          !headers.get(cluster->clusterHeaderName()).empty()) {
-        return pickClusterViaClusterHeader(cluster->clusterHeaderName(), headers,
-                                           static_cast<RouteEntryAndRoute*>(cluster.get()));
+
+  const std::vector<WeightedClusterEntrySharedPtr>& clusters =
+      weighted_clusters_config_->weighted_clusters_;
+  const WeightedClusterEntrySharedPtr* selected_cluster = nullptr;
+  const std::vector<uint64_t>& cumulative_weights =
+      weighted_clusters_config_->cumulative_cluster_weights_;
+  if (!cumulative_weights.empty()) {
+    // Weights are immutable (no runtime_key_prefix), so the cluster whose half-open interval
+    // contains the selected value is found with a binary search over the precomputed interval
+    // upper bounds. upper_bound() naturally skips zero weight clusters, matching the scan below.
+    const size_t index =
+        std::upper_bound(cumulative_weights.begin(), cumulative_weights.end(), selected_value) -
+        cumulative_weights.begin();
+    ASSERT(index < clusters.size());
+    selected_cluster = &clusters[index];
+  } else {
+    // Find the right cluster to route to based on the interval in which
+    // the selected value falls. The intervals are determined as
+    // [0, cluster1_weight), [cluster1_weight, cluster1_weight+cluster2_weight),..
+    uint64_t begin = 0;
+    uint64_t end = 0;
+    for (const WeightedClusterEntrySharedPtr& cluster : clusters) {
+      end = begin + cluster->clusterWeight();
+      if (!ignore_overflow) {
+        // end > total_cluster_weight: This case can only occur with Runtimes,
+        // when the user specifies invalid weights such that
+        // sum(weights) > total_cluster_weight.
+        ASSERT(end <= weighted_clusters_config_->total_cluster_weight_);
       }
-      return cluster;
+
+      if (selected_value >= begin && selected_value < end) {
+        selected_cluster = &cluster;
+        break;
+      }
+      begin = end;
     }
-    begin = end;
   }
 
-  PANIC("unexpected");
+  if (selected_cluster == nullptr) {
+    PANIC("unexpected");
+  }
+  const WeightedClusterEntrySharedPtr& cluster = *selected_cluster;
+  if (!cluster->clusterHeaderName().get().empty() &&
+      !headers.get(cluster->clusterHeaderName()).empty()) {
+    return pickClusterViaClusterHeader(cluster->clusterHeaderName(), headers,
+                                       static_cast<RouteEntryAndRoute*>(cluster.get()));
+  }
+  return cluster;
 }
 
 void RouteEntryImplBase::validateClusters(
@@ -1398,12 +1457,12 @@ RouteEntryImplBase::WeightedClusterEntry::WeightedClusterEntry(
       host_rewrite_(cluster.host_rewrite_literal()),
       cluster_header_name_(cluster.cluster_header()) {
   if (!cluster.request_headers_to_add().empty() || !cluster.request_headers_to_remove().empty()) {
-    request_headers_parser_ = HeaderParser::configure(cluster.request_headers_to_add(),
-                                                      cluster.request_headers_to_remove());
+    request_headers_parser_ = HeaderParser::configureShared(cluster.request_headers_to_add(),
+                                                            cluster.request_headers_to_remove());
   }
   if (!cluster.response_headers_to_add().empty() || !cluster.response_headers_to_remove().empty()) {
-    response_headers_parser_ = HeaderParser::configure(cluster.response_headers_to_add(),
-                                                       cluster.response_headers_to_remove());
+    response_headers_parser_ = HeaderParser::configureShared(cluster.response_headers_to_add(),
+                                                             cluster.response_headers_to_remove());
   }
 
   if (cluster.has_metadata_match()) {
@@ -1655,13 +1714,13 @@ VirtualHostImpl::VirtualHostImpl(
       include_is_timeout_retry_header_(virtual_host.include_is_timeout_retry_header()) {
   if (!virtual_host.request_headers_to_add().empty() ||
       !virtual_host.request_headers_to_remove().empty()) {
-    request_headers_parser_ = HeaderParser::configure(virtual_host.request_headers_to_add(),
-                                                      virtual_host.request_headers_to_remove());
+    request_headers_parser_ = HeaderParser::configureShared(
+        virtual_host.request_headers_to_add(), virtual_host.request_headers_to_remove());
   }
   if (!virtual_host.response_headers_to_add().empty() ||
       !virtual_host.response_headers_to_remove().empty()) {
-    response_headers_parser_ = HeaderParser::configure(virtual_host.response_headers_to_add(),
-                                                       virtual_host.response_headers_to_remove());
+    response_headers_parser_ = HeaderParser::configureShared(
+        virtual_host.response_headers_to_add(), virtual_host.response_headers_to_remove());
   }
   switch (virtual_host.require_tls()) {
     PANIC_ON_PROTO_ENUM_SENTINEL_VALUES;
@@ -1723,6 +1782,12 @@ VirtualHostImpl::VirtualHostImpl(
       routes_.emplace_back(createAndValidateRoute(route, *this, optional_http_filters,
                                                   factory_context, validator, validation_clusters));
     }
+    if (!routes_.empty()) {
+      // Large path-only route tables (API gateway style configs) can be indexed for
+      // O(path length) selection; create() returns nullptr when any route needs the
+      // linear scan.
+      path_only_route_index_ = PathOnlyRouteIndex::create(routes_);
+    }
   }
 
   if (!virtual_host.virtual_clusters().empty()) {
@@ -1765,6 +1830,23 @@ VirtualHostImpl::mostSpecificPerFilterConfig(const std::string& name) const {
   return per_filter_config != nullptr ? per_filter_config
                                       : global_route_config_.perFilterConfig(name);
 }
+
+absl::optional<bool> VirtualHostImpl::filterDisabled(absl::string_view config_name) const {
+  absl::optional<bool> result = per_filter_configs_.disabled(config_name);
+  if (result.has_value()) {
+    return result;
+  }
+  return global_route_config_.filterDisabled(config_name);
+}
+
+std::vector<std::string> VirtualHostImpl::perFilterConfigNames() const {
+  std::vector<std::string> names = global_route_config_.perFilterConfigNames();
+  std::vector<std::string> own_names = per_filter_configs_.filterNames();
+  names.insert(names.end(), std::make_move_iterator(own_names.begin()),
+               std::make_move_iterator(own_names.end()));
+  return names;
+}
+
 void VirtualHostImpl::traversePerFilterConfig(
     const std::string& filter_name,
     std::function<void(const Router::RouteSpecificFilterConfig&)> cb) const {
@@ -1846,6 +1928,66 @@ RouteMatcher::RouteMatcher(const envoy::config::route::v3::RouteConfiguration& r
   }
 }
 
+std::unique_ptr<const PathOnlyRouteIndex>
+PathOnlyRouteIndex::create(const std::vector<RouteEntryImplBaseConstSharedPtr>& routes) {
+  std::unique_ptr<PathOnlyRouteIndex> index(new PathOnlyRouteIndex());
+  for (size_t i = 0; i < routes.size(); i++) {
+    const RouteEntryImplBase& route = *routes[i];
+    if (!route.matchesOnPathOnly()) {
+      return nullptr;
+    }
+    const PathMatchCriterion& criterion = route.pathMatchCriterion();
+    switch (criterion.matchType()) {
+    case PathMatchType::Exact:
+      index->add(criterion.matcher(), i, true);
+      break;
+    case PathMatchType::Prefix:
+      index->add(criterion.matcher(), i, false);
+      break;
+    default:
+      return nullptr;
+    }
+  }
+  return index;
+}
+
+void PathOnlyRouteIndex::add(absl::string_view path, size_t route_index, bool exact) {
+  TrieNode* node = &root_;
+  for (const char c : path) {
+    std::unique_ptr<TrieNode>& child = node->children_[c];
+    if (child == nullptr) {
+      child = std::make_unique<TrieNode>();
+    }
+    node = child.get();
+  }
+  absl::optional<size_t>& slot = exact ? node->exact_index_ : node->prefix_index_;
+  if (!slot.has_value() || route_index < *slot) {
+    slot = route_index;
+  }
+}
+
+absl::optional<size_t> PathOnlyRouteIndex::find(absl::string_view path) const {
+  absl::optional<size_t> best;
+  auto consider = [&best](const absl::optional<size_t>& candidate) {
+    if (candidate.has_value() && (!best.has_value() || *candidate < *best)) {
+      best = candidate;
+    }
+  };
+
+  const TrieNode* node = &root_;
+  consider(node->prefix_index_);
+  for (const char c : path) {
+    const auto child = node->children_.find(c);
+    if (child == node->children_.end()) {
+      return best;
+    }
+    node = child->second.get();
+    consider(node->prefix_index_);
+  }
+  consider(node->exact_index_);
+  return best;
+}
+
 RouteConstSharedPtr VirtualHostImpl::getRouteFromRoutes(
     const RouteCallback& cb, const Http::RequestHeaderMap& headers,
     const StreamInfo::StreamInfo& stream_info, uint64_t random_value,
@@ -1931,6 +2073,34 @@ RouteConstSharedPtr VirtualHostImpl::getRouteFromEntries(const RouteCallback& cb
     return nullptr;
   }
 
+  // Indexed path-only selection. The callback variant needs to visit every matching route in
+  // order, so it always takes the linear scan.
+  if (path_only_route_index_ != nullptr && cb == nullptr) {
+    if (!headers.Path()) {
+      // Every indexed route requires a path to match.
+      return nullptr;
+    }
+    // Replicate the sanitization the per-route path matchers apply: optionally strip path
+    // parameters, then the query string and fragment.
+    absl::string_view path = headers.getPathValue();
+    if (global_route_config_.ignorePathParametersInPathMatching()) {
+      path = path.substr(0, path.find_first_of(';'));
+    }
+    path = Http::PathUtil::removeQueryAndFragment(path);
+
+    const absl::optional<size_t> route_index = path_only_route_index_->find(path);
+    if (!route_index.has_value()) {
+      return nullptr;
+    }
+    RouteConstSharedPtr route_entry =
+        routes_[*route_index]->matches(headers, stream_info, random_value);
+    if (route_entry != nullptr) {
+      return route_entry;
+    }
+    // The selected route declined the match (e.g. cluster selection failed); stay correct by
+    // falling back to the full scan.
+  }
+
   // Check for a route that matches the request.
   return getRouteFromRoutes(cb, headers, stream_info, random_value, routes_);
 }
@@ -2055,12 +2225,12 @@ ConfigImpl::ConfigImpl(const envoy::config::route::v3::RouteConfiguration& confi
   }
 
   if (!config.request_headers_to_add().empty() || !config.request_headers_to_remove().empty()) {
-    request_headers_parser_ = HeaderParser::configure(config.request_headers_to_add(),
-                                                      config.request_headers_to_remove());
+    request_headers_parser_ = HeaderParser::configureShared(config.request_headers_to_add(),
+                                                            config.request_headers_to_remove());
   }
   if (!config.response_headers_to_add().empty() || !config.response_headers_to_remove().empty()) {
-    response_headers_parser_ = HeaderParser::configure(config.response_headers_to_add(),
-                                                       config.response_headers_to_remove());
+    response_headers_parser_ = HeaderParser::configureShared(config.response_headers_to_add(),
+                                                             config.response_headers_to_remove());
   }
 }
 
@@ -2082,11 +2252,9 @@ RouteConstSharedPtr ConfigImpl::route(const RouteCallback& cb,
 }
 
 RouteSpecificFilterConfigConstSharedPtr PerFilterConfigs::createRouteSpecificFilterConfig(
-    const std::string& name, const ProtobufWkt::Any& typed_config,
-    const OptionalHttpFilters& optional_http_filters,
+    const std::string& name, const ProtobufWkt::Any& typed_config, bool is_optional,
     Server::Configuration::ServerFactoryContext& factory_context,
     ProtobufMessage::ValidationVisitor& validator) {
-  bool is_optional = (optional_http_filters.find(name) != optional_http_filters.end());
   Server::Configuration::NamedHttpFilterConfigFactory* factory =
       Envoy::Config::Utility::getFactoryByType<Server::Configuration::NamedHttpFilterConfigFactory>(
           typed_config);
@@ -2127,17 +2295,57 @@ PerFilterConfigs::PerFilterConfigs(
     ProtobufMessage::ValidationVisitor& validator) {
   for (const auto& it : typed_configs) {
     const auto& name = it.first;
-    auto object = createRouteSpecificFilterConfig(name, it.second, optional_http_filters,
+    const ProtobufWkt::Any* typed_config = &it.second;
+    bool is_optional = optional_http_filters.contains(name);
+
+    envoy::config::route::v3::FilterConfig filter_config;
+    if (typed_config->Is<envoy::config::route::v3::FilterConfig>()) {
+      // The config is wrapped in a FilterConfig envelope: honor the 'disabled' and 'is_optional'
+      // flags and unwrap the inner config.
+      MessageUtil::unpackTo(*typed_config, filter_config);
+      if (filter_config.disabled()) {
+        // Any inner config is ignored for a disabled filter; the filter will not be created for
+        // streams matching this route so there is nothing to build.
+        configs_.emplace(name, FilterConfig{nullptr, true});
+        continue;
+      }
+      is_optional |= filter_config.is_optional();
+      if (!filter_config.has_config()) {
+        if (is_optional) {
+          ENVOY_LOG(warn, "Empty FilterConfig for optional http filter '{}': ignoring it", name);
+          continue;
+        }
+        throw EnvoyException(
+            fmt::format("Empty FilterConfig for http filter '{}' is not allowed", name));
+      }
+      typed_config = &filter_config.config();
+    }
+
+    auto object = createRouteSpecificFilterConfig(name, *typed_config, is_optional,
                                                   factory_context, validator);
     if (object != nullptr) {
-      configs_[name] = std::move(object);
+      configs_.emplace(name, FilterConfig{std::move(object), false});
     }
   }
 }
 
 const RouteSpecificFilterConfig* PerFilterConfigs::get(const std::string& name) const {
   auto it = configs_.find(name);
-  return it == configs_.end() ? nullptr : it->second.get();
+  return it == configs_.end() ? nullptr : it->second.config_.get();
+}
+
+absl::optional<bool> PerFilterConfigs::disabled(absl::string_view name) const {
+  auto it = configs_.find(name);
+  return it == configs_.end() ? absl::nullopt : absl::make_optional(it->second.disabled_);
+}
+
+std::vector<std::string> PerFilterConfigs::filterNames() const {
+  std::vector<std::string> names;
+  names.reserve(configs_.size());
+  for (const auto& entry : configs_) {
+    names.push_back(entry.first);
+  }
+  return names;
 }
 
 Matcher::ActionFactoryCb RouteMatchActionFactory::createActionFactoryCb(
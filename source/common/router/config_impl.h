@@ -87,14 +87,30 @@ public:
 
   const RouteSpecificFilterConfig* get(const std::string& name) const;
 
+  /**
+   * @return absl::nullopt if no entry exists for the filter at this config level, otherwise
+   *         whether the entry (a FilterConfig wrapper or a bare typed config) disables the filter.
+   */
+  absl::optional<bool> disabled(absl::string_view name) const;
+
+  /**
+   * @return the names of all filters that have an entry at this config level.
+   */
+  std::vector<std::string> filterNames() const;
+
 private:
+  struct FilterConfig {
+    RouteSpecificFilterConfigConstSharedPtr config_;
+    bool disabled_{};
+  };
+
   RouteSpecificFilterConfigConstSharedPtr
   createRouteSpecificFilterConfig(const std::string& name, const ProtobufWkt::Any& typed_config,
-                                  const OptionalHttpFilters& optional_http_filters,
+                                  bool is_optional,
                                   Server::Configuration::ServerFactoryContext& factory_context,
                                   ProtobufMessage::ValidationVisitor& validator);
 
-  absl::node_hash_map<std::string, RouteSpecificFilterConfigConstSharedPtr> configs_;
+  absl::node_hash_map<std::string, FilterConfig> configs_;
 };
 
 class RouteEntryImplBase;
@@ -215,6 +231,44 @@ using RetryPolicyConstOptRef = const OptRef<const envoy::config::route::v3::Retr
 using HedgePolicyConstOptRef = const OptRef<const envoy::config::route::v3::HedgePolicy>;
 
 class ConfigImpl;
+
+/**
+ * A trie index over a virtual host's route table, giving route selection in O(path length)
+ * independent of route count. The index can only be built when every route in the table
+ * matches on a literal, case sensitive exact or prefix path with no additional match
+ * criteria (headers, query parameters, grpc, runtime fractions, TLS context or dynamic
+ * metadata); virtual hosts with any other route fall back to the linear scan. First-match
+ * semantics are preserved by tracking the smallest route index among all exact and prefix
+ * candidates along the path.
+ */
+class PathOnlyRouteIndex {
+public:
+  /**
+   * @return an index over the given route table, or nullptr if any route is not eligible.
+   */
+  static std::unique_ptr<const PathOnlyRouteIndex>
+  create(const std::vector<RouteEntryImplBaseConstSharedPtr>& routes);
+
+  /**
+   * @param path the request path with path parameters, query and fragment already removed.
+   * @return the index of the first route whose path criterion matches, if any.
+   */
+  absl::optional<size_t> find(absl::string_view path) const;
+
+private:
+  PathOnlyRouteIndex() = default;
+  void add(absl::string_view path, size_t route_index, bool exact);
+
+  struct TrieNode {
+    absl::flat_hash_map<char, std::unique_ptr<TrieNode>> children_;
+    // Route index of an exact path route terminating at this node.
+    absl::optional<size_t> exact_index_;
+    // Smallest route index among prefix routes whose prefix terminates at this node.
+    absl::optional<size_t> prefix_index_;
+  };
+  TrieNode root_;
+};
+
 /**
  * Holds all routing configuration for an entire virtual host.
  */
@@ -257,6 +311,11 @@ public:
   }
   const Config& routeConfig() const override;
   const RouteSpecificFilterConfig* mostSpecificPerFilterConfig(const std::string&) const override;
+  absl::optional<bool> filterDisabled(absl::string_view config_name) const;
+  // Names of all filters with a typed_per_filter_config entry at the virtual host or route
+  // configuration level, possibly with duplicates. Used by routes to pre-resolve the
+  // most-specific-config walk at config load time.
+  std::vector<std::string> perFilterConfigNames() const;
   bool includeAttemptCountInRequest() const override { return include_attempt_count_in_request_; }
   bool includeAttemptCountInResponse() const override { return include_attempt_count_in_response_; }
   bool includeIsTimeoutRetryHeader() const override { return include_is_timeout_retry_header_; }
@@ -331,14 +390,16 @@ private:
   const Stats::StatNameManagedStorage stat_name_storage_;
   Stats::ScopeSharedPtr vcluster_scope_;
   std::vector<RouteEntryImplBaseConstSharedPtr> routes_;
+  // Non-null when every entry in routes_ is eligible for path-only indexed lookup.
+  std::unique_ptr<const PathOnlyRouteIndex> path_only_route_index_;
   std::vector<VirtualClusterEntry> virtual_clusters_;
   std::unique_ptr<const RateLimitPolicyImpl> rate_limit_policy_;
   std::vector<ShadowPolicyPtr> shadow_policies_;
   std::unique_ptr<const CorsPolicyImpl> cors_policy_;
   const ConfigImpl& global_route_config_; // See note in RouteEntryImplBase::clusterEntry() on why
                                           // raw ref to the top level config is currently safe.
-  HeaderParserPtr request_headers_parser_;
-  HeaderParserPtr response_headers_parser_;
+  HeaderParserSharedPtr request_headers_parser_;
+  HeaderParserSharedPtr response_headers_parser_;
   PerFilterConfigs per_filter_configs_;
   std::unique_ptr<envoy::config::route::v3::RetryPolicy> retry_policy_;
   std::unique_ptr<envoy::config::route::v3::HedgePolicy> hedge_policy_;
@@ -436,6 +497,9 @@ public:
   const std::string& runtimeKey() const override { return runtime_key_; }
   const envoy::type::v3::FractionalPercent& defaultValue() const override { return default_value_; }
   bool traceSampled() const override { return trace_sampled_; }
+  absl::optional<uint64_t> maxMirroredBodyBytes() const override {
+    return max_mirrored_body_bytes_;
+  }
 
 private:
   const std::string cluster_;
@@ -443,6 +507,7 @@ private:
   std::string runtime_key_;
   envoy::type::v3::FractionalPercent default_value_;
   bool trace_sampled_;
+  absl::optional<uint64_t> max_mirrored_body_bytes_;
 };
 
 /**
@@ -796,8 +861,15 @@ public:
   const RouteTracing* tracingConfig() const override { return route_tracing_.get(); }
   const RouteSpecificFilterConfig*
   mostSpecificPerFilterConfig(const std::string& name) const override {
-    auto* config = per_filter_configs_.get(name);
-    return config ? config : vhost_.mostSpecificPerFilterConfig(name);
+    const auto it = resolved_per_filter_configs_.find(name);
+    return it != resolved_per_filter_configs_.end() ? it->second : nullptr;
+  }
+  absl::optional<bool> filterDisabled(absl::string_view config_name) const override {
+    absl::optional<bool> result = per_filter_configs_.disabled(config_name);
+    if (result.has_value()) {
+      return result;
+    }
+    return vhost_.filterDisabled(config_name);
   }
   void traversePerFilterConfig(
       const std::string& filter_name,
@@ -929,6 +1001,9 @@ public:
     mostSpecificPerFilterConfig(const std::string& name) const override {
       return parent_->mostSpecificPerFilterConfig(name);
     }
+    absl::optional<bool> filterDisabled(absl::string_view config_name) const override {
+      return parent_->filterDisabled(config_name);
+    }
     void traversePerFilterConfig(
         const std::string& filter_name,
         std::function<void(const Router::RouteSpecificFilterConfig&)> cb) const override {
@@ -1007,6 +1082,14 @@ public:
       return config ? config : DynamicRouteEntry::mostSpecificPerFilterConfig(name);
     }
 
+    absl::optional<bool> filterDisabled(absl::string_view config_name) const override {
+      absl::optional<bool> result = per_filter_configs_.disabled(config_name);
+      if (result.has_value()) {
+        return result;
+      }
+      return DynamicRouteEntry::filterDisabled(config_name);
+    }
+
     void traversePerFilterConfig(
         const std::string& filter_name,
         std::function<void(const Router::RouteSpecificFilterConfig&)> cb) const override;
@@ -1018,8 +1101,8 @@ public:
     Runtime::Loader& loader_;
     const uint64_t cluster_weight_;
     MetadataMatchCriteriaConstPtr cluster_metadata_match_criteria_;
-    HeaderParserPtr request_headers_parser_;
-    HeaderParserPtr response_headers_parser_;
+    HeaderParserSharedPtr request_headers_parser_;
+    HeaderParserSharedPtr response_headers_parser_;
     PerFilterConfigs per_filter_configs_;
     const std::string host_rewrite_;
     const Http::LowerCaseString cluster_header_name_;
@@ -1032,14 +1115,29 @@ public:
   struct WeightedClustersConfig {
     WeightedClustersConfig(const std::vector<WeightedClusterEntrySharedPtr>& weighted_clusters,
                            uint64_t total_cluster_weight,
-                           const std::string& random_value_header_name)
+                           const std::string& random_value_header_name,
+                           std::vector<uint64_t>&& cumulative_cluster_weights)
         : weighted_clusters_(weighted_clusters), total_cluster_weight_(total_cluster_weight),
-          random_value_header_name_(random_value_header_name) {}
+          random_value_header_name_(random_value_header_name),
+          cumulative_cluster_weights_(std::move(cumulative_cluster_weights)) {}
     const std::vector<WeightedClusterEntrySharedPtr> weighted_clusters_;
     const uint64_t total_cluster_weight_;
-    const std::string random_value_header_name_;
+    const Http::LowerCaseString random_value_header_name_;
+    // Upper bounds of each cluster's weight interval, precomputed at config load when no
+    // runtime_key_prefix is configured (weights then cannot change at request time). Enables an
+    // O(log n) binary search pick instead of a linear scan. Empty when weights may be overridden
+    // via runtime, in which case the scan re-reads the weights per request.
+    const std::vector<uint64_t> cumulative_cluster_weights_;
   };
 
+  /**
+   * @return whether this route's match outcome depends only on the case sensitive literal
+   *         request path, i.e. the route has no header, query parameter, grpc, runtime
+   *         fraction, TLS context or dynamic metadata criteria. Such routes are eligible
+   *         for the virtual host's PathOnlyRouteIndex.
+   */
+  bool matchesOnPathOnly() const;
+
 protected:
   const std::string prefix_rewrite_;
   Regex::CompiledMatcherPtr regex_rewrite_;
@@ -1174,8 +1272,8 @@ private:
   std::unique_ptr<const Http::HashPolicyImpl> hash_policy_;
   MetadataMatchCriteriaConstPtr metadata_match_criteria_;
   TlsContextMatchCriteriaConstPtr tls_context_match_criteria_;
-  HeaderParserPtr request_headers_parser_;
-  HeaderParserPtr response_headers_parser_;
+  HeaderParserSharedPtr request_headers_parser_;
+  HeaderParserSharedPtr response_headers_parser_;
   std::unique_ptr<const envoy::config::core::v3::Metadata> metadata_;
   std::unique_ptr<const RouteTypedMetadata> typed_metadata_;
   const std::vector<Envoy::Matchers::MetadataMatcher> dynamic_metadata_;
@@ -1187,6 +1285,11 @@ private:
   const RouteTracingConstPtr route_tracing_;
   std::string direct_response_body_;
   PerFilterConfigs per_filter_configs_;
+  // The route -> virtual host -> route configuration inheritance walk, resolved once at config
+  // load so mostSpecificPerFilterConfig() is a single map probe at request time. Values point
+  // into the PerFilterConfigs instances of this route, vhost_ or the global config, all of which
+  // share this route's lifetime (see the note on vhost_ above).
+  absl::flat_hash_map<std::string, const RouteSpecificFilterConfig*> resolved_per_filter_configs_;
   const std::string route_name_;
   TimeSource& time_source_;
   EarlyDataPolicyPtr early_data_policy_;
@@ -1531,6 +1634,12 @@ public:
   const RouteSpecificFilterConfig* perFilterConfig(const std::string& name) const {
     return per_filter_configs_.get(name);
   }
+  std::vector<std::string> perFilterConfigNames() const {
+    return per_filter_configs_.filterNames();
+  }
+  absl::optional<bool> filterDisabled(absl::string_view config_name) const {
+    return per_filter_configs_.disabled(config_name);
+  }
 
   // Router::Config
   RouteConstSharedPtr route(const Http::RequestHeaderMap& headers,
@@ -1569,8 +1678,8 @@ public:
 private:
   std::unique_ptr<RouteMatcher> route_matcher_;
   std::list<Http::LowerCaseString> internal_only_headers_;
-  HeaderParserPtr request_headers_parser_;
-  HeaderParserPtr response_headers_parser_;
+  HeaderParserSharedPtr request_headers_parser_;
+  HeaderParserSharedPtr response_headers_parser_;
   const std::string name_;
   Stats::SymbolTable& symbol_table_;
   std::vector<ShadowPolicyPtr> shadow_policies_;
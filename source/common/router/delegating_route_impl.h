@@ -36,6 +36,9 @@ public:
       std::function<void(const Router::RouteSpecificFilterConfig&)> cb) const override {
     base_route_->traversePerFilterConfig(filter_name, cb);
   }
+  absl::optional<bool> filterDisabled(absl::string_view config_name) const override {
+    return base_route_->filterDisabled(config_name);
+  }
 
   const envoy::config::core::v3::Metadata& metadata() const override {
     return base_route_->metadata();
@@ -8,14 +8,17 @@
 #include "envoy/config/core/v3/base.pb.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/macros.h"
 #include "source/common/formatter/substitution_formatter.h"
 #include "source/common/http/header_utility.h"
 #include "source/common/http/headers.h"
 #include "source/common/json/json_loader.h"
 #include "source/common/protobuf/utility.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/strings/str_cat.h"
 #include "absl/strings/str_replace.h"
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace Router {
@@ -329,6 +332,71 @@ HeaderParser::configure(const Protobuf::RepeatedPtrField<HeaderValueOption>& hea
   return header_parser;
 }
 
+namespace {
+
+// Process-wide cache of parsers shared across identical header mutation configs. Entries are
+// weak so a parser disappears with the last config referencing it; expired entries are swept
+// once the map grows past a threshold so serial config reloads cannot grow it without bound.
+struct SharedHeaderParserCache {
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::weak_ptr<const HeaderParser>>
+      parsers_ ABSL_GUARDED_BY(mutex_);
+};
+
+SharedHeaderParserCache& sharedHeaderParserCache() {
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(SharedHeaderParserCache);
+}
+
+// Builds a deterministic key for a header mutation config using the same field-number,
+// single-line text format as RepeatedPtrUtil::hash(), but keeping the full text so distinct
+// configs can never collide. Each line is tagged with its section so an add can never alias a
+// removal.
+std::string sharedHeaderParserCacheKey(
+    const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add,
+    const Protobuf::RepeatedPtrField<std::string>& headers_to_remove) {
+  std::string key;
+  Protobuf::TextFormat::Printer printer;
+  printer.SetExpandAny(true);
+  printer.SetUseFieldNumber(true);
+  printer.SetSingleLineMode(true);
+  printer.SetHideUnknownFields(true);
+  for (const auto& header_value_option : headers_to_add) {
+    std::string text;
+    printer.PrintToString(header_value_option, &text);
+    absl::StrAppend(&key, "+", text, "\n");
+  }
+  for (const auto& header : headers_to_remove) {
+    absl::StrAppend(&key, "-", header, "\n");
+  }
+  return key;
+}
+
+} // namespace
+
+HeaderParserSharedPtr
+HeaderParser::configureShared(const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add,
+                              const Protobuf::RepeatedPtrField<std::string>& headers_to_remove) {
+  std::string key = sharedHeaderParserCacheKey(headers_to_add, headers_to_remove);
+  auto& cache = sharedHeaderParserCache();
+  absl::MutexLock lock(&cache.mutex_);
+  const auto it = cache.parsers_.find(key);
+  if (it != cache.parsers_.end()) {
+    if (HeaderParserSharedPtr existing = it->second.lock()) {
+      return existing;
+    }
+  }
+
+  // configure() may throw on an invalid config, in which case nothing is cached.
+  HeaderParserSharedPtr parser = configure(headers_to_add, headers_to_remove);
+  constexpr size_t SweepThreshold = 512;
+  if (cache.parsers_.size() >= SweepThreshold) {
+    absl::erase_if(cache.parsers_,
+                   [](const auto& entry) { return entry.second.expired(); });
+  }
+  cache.parsers_.insert_or_assign(std::move(key), parser);
+  return parser;
+}
+
 void HeaderParser::evaluateHeaders(Http::HeaderMap& headers,
                                    const Http::RequestHeaderMap& request_headers,
                                    const Http::ResponseHeaderMap& response_headers,
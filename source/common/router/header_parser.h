@@ -17,6 +17,7 @@ namespace Router {
 
 class HeaderParser;
 using HeaderParserPtr = std::unique_ptr<HeaderParser>;
+using HeaderParserSharedPtr = std::shared_ptr<const HeaderParser>;
 
 using HeaderAppendAction = envoy::config::core::v3::HeaderValueOption::HeaderAppendAction;
 using HeaderValueOption = envoy::config::core::v3::HeaderValueOption;
@@ -66,6 +67,17 @@ public:
   configure(const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add,
             const Protobuf::RepeatedPtrField<std::string>& headers_to_remove);
 
+  /*
+   * Variant of the two argument configure() that returns one immutable parser shared by every
+   * caller with an identical header mutation config. Route configs commonly repeat the same
+   * mutation set across thousands of routes; sharing avoids re-parsing the substitution formats
+   * on every route and collapses the per-route memory footprint. Parsers are stateless after
+   * construction so sharing across routes (and worker threads) is safe.
+   */
+  static HeaderParserSharedPtr
+  configureShared(const Protobuf::RepeatedPtrField<HeaderValueOption>& headers_to_add,
+                  const Protobuf::RepeatedPtrField<std::string>& headers_to_remove);
+
   static const HeaderParser& defaultParser() {
     static HeaderParser* instance = new HeaderParser();
     return *instance;
@@ -88,21 +88,11 @@ RetryStateImpl::RetryStateImpl(const RetryPolicy& route_policy,
     retry_on_ |= RetryPolicy::RETRY_ON_RETRIABLE_STATUS_CODES;
     retriable_status_codes_.push_back(static_cast<uint32_t>(Http::Code::TooEarly));
   }
-  std::chrono::milliseconds base_interval(
-      runtime_.snapshot().getInteger("upstream.base_retry_backoff_ms", 25));
-  if (route_policy.baseInterval()) {
-    base_interval = *route_policy.baseInterval();
-  }
-
-  // By default, cap the max interval to 10 times the base interval to ensure reasonable back-off
-  // intervals.
-  std::chrono::milliseconds max_interval = base_interval * 10;
-  if (route_policy.maxInterval()) {
-    max_interval = *route_policy.maxInterval();
-  }
-
-  backoff_strategy_ = std::make_unique<JitteredExponentialBackOffStrategy>(
-      base_interval.count(), max_interval.count(), random_);
+  // Only the policy-provided intervals are captured here; resolving the runtime default for the
+  // base interval and allocating the backoff strategy are deferred to the first backoff, since
+  // most requests that carry a retry policy never actually retry.
+  base_interval_ = route_policy.baseInterval();
+  max_interval_ = route_policy.maxInterval();
   host_selection_max_attempts_ = route_policy.hostSelectionMaxAttempts();
 
   // Merge in the headers.
@@ -181,7 +171,19 @@ void RetryStateImpl::enableBackoffTimer() {
     cluster_.trafficStats()->upstream_rq_retry_backoff_ratelimited_.inc();
 
   } else {
-    // Otherwise we use a fully jittered exponential backoff algorithm.
+    // Otherwise we use a fully jittered exponential backoff algorithm, created on first use.
+    if (backoff_strategy_ == nullptr) {
+      const std::chrono::milliseconds base_interval =
+          base_interval_.has_value()
+              ? *base_interval_
+              : std::chrono::milliseconds(
+                    runtime_.snapshot().getInteger("upstream.base_retry_backoff_ms", 25));
+      // By default, cap the max interval to 10 times the base interval to ensure reasonable
+      // back-off intervals.
+      const std::chrono::milliseconds max_interval = max_interval_.value_or(base_interval * 10);
+      backoff_strategy_ = std::make_unique<JitteredExponentialBackOffStrategy>(
+          base_interval.count(), max_interval.count(), random_);
+    }
     retry_timer_->enableTimer(std::chrono::milliseconds(backoff_strategy_->nextBackOffMs()));
 
     cluster_.trafficStats()->upstream_rq_retry_backoff_exponential_.inc();
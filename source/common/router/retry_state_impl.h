@@ -125,8 +125,13 @@ private:
   DoRetryCallback backoff_callback_;
   Event::SchedulableCallbackPtr next_loop_callback_;
   Event::TimerPtr retry_timer_;
+  // Created on the first backoff; most retry states never schedule a retry.
   BackOffStrategyPtr backoff_strategy_;
   BackOffStrategyPtr ratelimited_backoff_strategy_{};
+  // Backoff intervals from the route policy, if configured; the runtime default for the base
+  // interval is resolved when backoff_strategy_ is created.
+  absl::optional<std::chrono::milliseconds> base_interval_;
+  absl::optional<std::chrono::milliseconds> max_interval_;
   std::vector<Upstream::RetryHostPredicateSharedPtr> retry_host_predicates_;
   Upstream::RetryPrioritySharedPtr retry_priority_;
   std::vector<uint32_t> retriable_status_codes_;
@@ -100,13 +100,20 @@ bool RouteConfigUpdateReceiverImpl::onVhdsUpdate(
   const bool removed = removeVhosts(*vhosts_after_this_update, removed_resources);
   const bool updated = updateVhosts(*vhosts_after_this_update, added_vhosts);
 
-  auto route_config_after_this_update =
-      std::make_unique<envoy::config::route::v3::RouteConfiguration>();
-  route_config_after_this_update->CopyFrom(base_.protobufConfiguration());
-  rebuildRouteConfigVirtualHosts(*rds_virtual_hosts_, *vhosts_after_this_update,
-                                 *route_config_after_this_update);
-
-  base_.updateConfig(std::move(route_config_after_this_update));
+  // Only recompile the route table when the merged set of virtual hosts actually changed.
+  // Management servers commonly resend unchanged virtual hosts (e.g. when resolving on-demand
+  // aliases); rebuilding the full ConfigImpl for those updates is pure overhead on the main
+  // thread. The existing parsed configuration remains valid, so on-demand callbacks waiting in
+  // RdsRouteConfigProviderImpl::onConfigUpdate() can still be notified against it.
+  if (removed || updated) {
+    auto route_config_after_this_update =
+        std::make_unique<envoy::config::route::v3::RouteConfiguration>();
+    route_config_after_this_update->CopyFrom(base_.protobufConfiguration());
+    rebuildRouteConfigVirtualHosts(*rds_virtual_hosts_, *vhosts_after_this_update,
+                                   *route_config_after_this_update);
+
+    base_.updateConfig(std::move(route_config_after_this_update));
+  }
   // No exception, route_config_after_this_update is valid, can update the state.
   vhds_virtual_hosts_ = std::move(vhosts_after_this_update);
   resource_ids_in_last_update_ = added_resource_ids;
@@ -134,6 +141,11 @@ bool RouteConfigUpdateReceiverImpl::updateVhosts(VirtualHostMap& vhosts,
   for (const auto& vhost : added_vhosts) {
     auto found = vhosts.find(vhost.get().name());
     if (found != vhosts.end()) {
+      if (MessageUtil::hash(found->second) == MessageUtil::hash(vhost.get())) {
+        // Resending an identical virtual host is a no-op; skipping it lets onVhdsUpdate() avoid
+        // recompiling the route table when nothing changed.
+        continue;
+      }
       vhosts.erase(found);
     }
     vhosts.emplace(vhost.get().name(), vhost.get());
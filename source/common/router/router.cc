@@ -423,16 +423,17 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
         direct_response->responseCode(), direct_response->responseBody(),
         [this, direct_response,
          &request_headers = headers](Http::ResponseHeaderMap& response_headers) -> void {
-          std::string new_uri;
-          if (request_headers.Path()) {
-            new_uri = direct_response->newUri(request_headers);
-          }
           // See https://tools.ietf.org/html/rfc7231#section-7.1.2.
           const auto add_location =
               direct_response->responseCode() == Http::Code::Created ||
               Http::CodeUtility::is3xx(enumToInt(direct_response->responseCode()));
-          if (!new_uri.empty() && add_location) {
-            response_headers.addReferenceKey(Http::Headers::get().Location, new_uri);
+          // Only render the redirect URI for response codes that can carry a Location header;
+          // plain direct responses (e.g. health check endpoints) skip the string assembly.
+          if (add_location && request_headers.Path()) {
+            const std::string new_uri = direct_response->newUri(request_headers);
+            if (!new_uri.empty()) {
+              response_headers.addReferenceKey(Http::Headers::get().Location, new_uri);
+            }
           }
           direct_response->finalizeResponseHeaders(response_headers, callbacks_->streamInfo());
         },
@@ -678,7 +679,14 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
       const auto& policy_ref = *shadow_policy;
       if (FilterUtility::shouldShadow(policy_ref, config_.runtime_, callbacks_->streamId())) {
         active_shadow_policies_.push_back(std::cref(policy_ref));
-        shadow_headers_ = Http::createHeaderMap<Http::RequestHeaderMapImpl>(*downstream_headers_);
+        // One snapshot of the headers (taken before the router mutates them for the upstream
+        // request) is shared by all active shadow policies.
+        if (shadow_headers_ == nullptr) {
+          shadow_headers_ = Http::createHeaderMap<Http::RequestHeaderMapImpl>(*downstream_headers_);
+        }
+        if (policy_ref.maxMirroredBodyBytes().has_value()) {
+          shadow_body_capped_ = true;
+        }
       }
     }
   }
@@ -703,7 +711,7 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
       *this, std::move(generic_conn_pool), can_send_early_data, can_use_http3);
   LinkedList::moveIntoList(std::move(upstream_request), upstream_requests_);
   upstream_requests_.front()->acceptHeadersFromRouter(end_stream);
-  if (streaming_shadows_) {
+  if (streamingShadows()) {
     // start the shadow streams.
     for (const auto& shadow_policy_wrapper : active_shadow_policies_) {
       const auto& shadow_policy = shadow_policy_wrapper.get();
@@ -712,7 +720,14 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
       if (!shadow_cluster_name.has_value()) {
         continue;
       }
-      auto shadow_headers = Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_);
+      // The snapshot has no further readers in the streaming path, so the final dispatch can take
+      // ownership of it instead of paying for another full header map copy.
+      Http::RequestHeaderMapPtr shadow_headers;
+      if (&shadow_policy_wrapper == &active_shadow_policies_.back()) {
+        shadow_headers = std::move(shadow_headers_);
+      } else {
+        shadow_headers = Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_);
+      }
       auto options =
           Http::AsyncClient::RequestOptions()
               .setTimeout(timeout_.global_timeout_)
@@ -730,8 +745,7 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
       if (end_stream) {
         // This is a header-only request, and can be dispatched immediately to the shadow
         // without waiting.
-        Http::RequestMessagePtr request(new Http::RequestMessageImpl(
-            Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_)));
+        Http::RequestMessagePtr request(new Http::RequestMessageImpl(std::move(shadow_headers)));
         config_.shadowWriter().shadow(std::string(shadow_cluster_name.value()), std::move(request),
                                       options);
       } else {
@@ -799,7 +813,7 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
   ASSERT(upstream_requests_.size() <= 1);
 
   bool buffering = (retry_state_ && retry_state_->enabled()) ||
-                   (!active_shadow_policies_.empty() && !streaming_shadows_) ||
+                   (!active_shadow_policies_.empty() && !streamingShadows()) ||
                    (route_entry_ && route_entry_->internalRedirectPolicy().enabled());
   if (buffering &&
       getLength(callbacks_->decodingBuffer()) + data.length() > retry_shadow_buffer_limit_) {
@@ -868,7 +882,9 @@ Http::FilterDataStatus Filter::decodeData(Buffer::Instance& data, bool end_strea
 Http::FilterTrailersStatus Filter::decodeTrailers(Http::RequestTrailerMap& trailers) {
   ENVOY_STREAM_LOG(debug, "router decoding trailers:\n{}", *callbacks_, trailers);
 
-  if (shadow_headers_) {
+  // In the streaming shadow path the header snapshot may already have been handed off to the
+  // last shadow stream, so also key off the streams themselves.
+  if (shadow_headers_ != nullptr || !shadow_streams_.empty()) {
     shadow_trailers_ = Http::createHeaderMap<Http::RequestTrailerMapImpl>(trailers);
   }
 
@@ -956,13 +972,43 @@ void Filter::maybeDoShadowing() {
       continue;
     }
 
-    Http::RequestMessagePtr request(new Http::RequestMessageImpl(
-        Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_)));
+    // The last shadow to dispatch takes ownership of the header/trailer snapshots; earlier
+    // shadows (the rare multi-policy case) get copies.
+    const bool last_shadow = &shadow_policy_wrapper == &active_shadow_policies_.back();
+    Http::RequestHeaderMapPtr shadow_headers;
+    if (last_shadow) {
+      shadow_headers = std::move(shadow_headers_);
+    } else {
+      shadow_headers = Http::createHeaderMap<Http::RequestHeaderMapImpl>(*shadow_headers_);
+    }
+    Http::RequestMessagePtr request(new Http::RequestMessageImpl(std::move(shadow_headers)));
     if (callbacks_->decodingBuffer()) {
-      request->body().add(*callbacks_->decodingBuffer());
+      const absl::optional<uint64_t> max_bytes = shadow_policy.maxMirroredBodyBytes();
+      if (max_bytes.has_value() && callbacks_->decodingBuffer()->length() > *max_bytes) {
+        // Mirror only the first max_mirrored_body_bytes bytes of the body. The content length
+        // header is rewritten to the truncated size so the mirrored request stays well formed.
+        uint64_t remaining = *max_bytes;
+        for (const Buffer::RawSlice& slice : callbacks_->decodingBuffer()->getRawSlices()) {
+          const uint64_t to_copy = std::min<uint64_t>(remaining, slice.len_);
+          request->body().add(slice.mem_, to_copy);
+          remaining -= to_copy;
+          if (remaining == 0) {
+            break;
+          }
+        }
+        if (request->headers().ContentLength() != nullptr) {
+          request->headers().setContentLength(request->body().length());
+        }
+      } else {
+        request->body().add(*callbacks_->decodingBuffer());
+      }
     }
     if (shadow_trailers_) {
-      request->trailers(Http::createHeaderMap<Http::RequestTrailerMapImpl>(*shadow_trailers_));
+      if (last_shadow) {
+        request->trailers(std::move(shadow_trailers_));
+      } else {
+        request->trailers(Http::createHeaderMap<Http::RequestTrailerMapImpl>(*shadow_trailers_));
+      }
     }
 
     auto options = Http::AsyncClient::RequestOptions()
@@ -990,12 +1036,19 @@ void Filter::onRequestComplete() {
   if (!upstream_requests_.empty()) {
     // Even if we got an immediate reset, we could still shadow, but that is a riskier change and
     // seems unnecessary right now.
-    if (!streaming_shadows_) {
+    if (!streamingShadows()) {
       maybeDoShadowing();
     }
 
     if (timeout_.global_timeout_.count() > 0) {
-      response_timeout_ = dispatcher.createTimer([this]() -> void { onResponseTimeout(); });
+      Event::TimerCb timeout_cb = [this]() -> void { onResponseTimeout(); };
+      // Coarse timers multiplex all request timeouts onto one underlying dispatcher timer; the
+      // up-to-one-tick firing slack is irrelevant at request timeout magnitudes.
+      response_timeout_ =
+          Runtime::runtimeFeatureEnabled(
+              "envoy.reloadable_features.router_coarse_timeout_timers")
+              ? dispatcher.createCoarseTimer(std::move(timeout_cb))
+              : dispatcher.createTimer(std::move(timeout_cb));
       response_timeout_->enableTimer(timeout_.global_timeout_);
     }
 
@@ -1086,7 +1139,7 @@ void Filter::onSoftPerTryTimeout(UpstreamRequest& upstream_request) {
       // back.
       upstream_request.retried(true);
 
-      // TODO: cluster stat for hedge attempted.
+      cluster_->trafficStats()->upstream_rq_hedge_attempted_.inc();
     } else if (retry_status == RetryStatus::NoOverflow) {
       callbacks_->streamInfo().setResponseFlag(StreamInfo::ResponseFlag::UpstreamOverflow);
     } else if (retry_status == RetryStatus::NoRetryLimitExceeded) {
@@ -1425,8 +1478,8 @@ void Filter::resetOtherUpstreams(UpstreamRequest& upstream_request) {
         upstream_requests_.back()->removeFromList(upstream_requests_);
     if (upstream_request_tmp.get() != &upstream_request) {
       upstream_request_tmp->resetStream();
+      cluster_->trafficStats()->upstream_rq_hedge_abandoned_.inc();
       // TODO: per-host stat for hedge abandoned.
-      // TODO: cluster stat for hedge abandoned.
     } else {
       final_upstream_request = std::move(upstream_request_tmp);
     }
@@ -368,7 +368,8 @@ public:
         downstream_1xx_headers_encoded_(false), downstream_response_started_(false),
         downstream_end_stream_(false), is_retry_(false), request_buffer_overflowed_(false),
         streaming_shadows_(
-            Runtime::runtimeFeatureEnabled("envoy.reloadable_features.streaming_shadow")) {}
+            Runtime::runtimeFeatureEnabled("envoy.reloadable_features.streaming_shadow")),
+        shadow_body_capped_(false) {}
 
   ~Filter() override;
 
@@ -577,6 +578,9 @@ private:
                                                      const Http::HeaderMap& headers) const;
 
   void maybeDoShadowing();
+  // Whether shadow bodies are streamed to the mirror clusters for this stream. False when the
+  // runtime flag is off or an active shadow policy caps the mirrored body size.
+  bool streamingShadows() const { return streaming_shadows_ && !shadow_body_capped_; }
   bool maybeRetryReset(Http::StreamResetReason reset_reason, UpstreamRequest& upstream_request,
                        TimeoutRetry is_timeout_retry);
   uint32_t numRequestsAwaitingHeaders();
@@ -665,6 +669,9 @@ private:
   bool include_timeout_retry_header_in_request_ : 1;
   bool request_buffer_overflowed_ : 1;
   const bool streaming_shadows_ : 1;
+  // Set when an active shadow policy configures max_mirrored_body_bytes; the mirrored body must
+  // then be buffered so it can be truncated, so streaming shadows are disabled for the stream.
+  bool shadow_body_capped_ : 1;
 };
 
 class ProdFilter : public Filter {
@@ -21,7 +21,8 @@ bool ScopeKey::operator==(const ScopeKey& other) const {
 HeaderValueExtractorImpl::HeaderValueExtractorImpl(
     ScopedRoutes::ScopeKeyBuilder::FragmentBuilder&& config)
     : FragmentBuilderBase(std::move(config)),
-      header_value_extractor_config_(config_.header_value_extractor()) {
+      header_value_extractor_config_(config_.header_value_extractor()),
+      header_name_(header_value_extractor_config_.name()) {
   ASSERT(config_.type_case() ==
              ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::kHeaderValueExtractor,
          "header_value_extractor is not set.");
@@ -40,12 +41,11 @@ HeaderValueExtractorImpl::HeaderValueExtractorImpl(
   }
 }
 
-std::unique_ptr<ScopeKeyFragmentBase>
-HeaderValueExtractorImpl::computeFragment(const Http::HeaderMap& headers) const {
-  const auto header_entry =
-      headers.get(Envoy::Http::LowerCaseString(header_value_extractor_config_.name()));
+absl::optional<absl::string_view>
+HeaderValueExtractorImpl::extractFragmentValue(const Http::HeaderMap& headers) const {
+  const auto header_entry = headers.get(header_name_);
   if (header_entry.empty()) {
-    return nullptr;
+    return absl::nullopt;
   }
 
   // This is an implicitly untrusted header, so per the API documentation only the first
@@ -61,20 +61,40 @@ HeaderValueExtractorImpl::computeFragment(const Http::HeaderMap& headers) const
       std::pair<absl::string_view, absl::string_view> key_value = absl::StrSplit(
           element, absl::MaxSplits(header_value_extractor_config_.element().separator(), 1));
       if (key_value.first == header_value_extractor_config_.element().key()) {
-        return std::make_unique<StringKeyFragment>(key_value.second);
+        return key_value.second;
       }
     }
     break;
   case ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::HeaderValueExtractor::kIndex:
     if (header_value_extractor_config_.index() < elements.size()) {
-      return std::make_unique<StringKeyFragment>(elements[header_value_extractor_config_.index()]);
+      return elements[header_value_extractor_config_.index()];
     }
     break;
   case ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::HeaderValueExtractor::EXTRACT_TYPE_NOT_SET:
     PANIC("not reached");
   }
 
-  return nullptr;
+  return absl::nullopt;
+}
+
+std::unique_ptr<ScopeKeyFragmentBase>
+HeaderValueExtractorImpl::computeFragment(const Http::HeaderMap& headers) const {
+  const absl::optional<absl::string_view> value = extractFragmentValue(headers);
+  if (!value.has_value()) {
+    return nullptr;
+  }
+  return std::make_unique<StringKeyFragment>(*value);
+}
+
+absl::optional<uint64_t>
+HeaderValueExtractorImpl::computeFragmentHash(const Http::HeaderMap& headers) const {
+  const absl::optional<absl::string_view> value = extractFragmentValue(headers);
+  if (!value.has_value()) {
+    return absl::nullopt;
+  }
+  // Matches StringKeyFragment's hash so hashes computed here line up with the fragments built
+  // from ScopedRouteConfiguration at config load.
+  return HashUtil::xxHash64(*value);
 }
 
 ScopedRouteInfo::ScopedRouteInfo(envoy::config::route::v3::ScopedRouteConfiguration config_proto,
@@ -121,6 +141,19 @@ ScopeKeyPtr ScopeKeyBuilderImpl::computeScopeKey(const Http::HeaderMap& headers)
   return std::make_unique<ScopeKey>(std::move(key));
 }
 
+absl::optional<uint64_t>
+ScopeKeyBuilderImpl::computeScopeKeyHash(const Http::HeaderMap& headers) const {
+  uint64_t hash = 0;
+  for (const auto& builder : fragment_builders_) {
+    const absl::optional<uint64_t> fragment_hash = builder->computeFragmentHash(headers);
+    if (!fragment_hash.has_value()) {
+      return absl::nullopt;
+    }
+    hash = ScopeKey::combineHash(hash, *fragment_hash);
+  }
+  return hash;
+}
+
 void ScopedConfigImpl::addOrUpdateRoutingScopes(
     const std::vector<ScopedRouteInfoConstSharedPtr>& scoped_route_infos) {
   for (auto& scoped_route_info : scoped_route_infos) {
@@ -147,11 +180,13 @@ void ScopedConfigImpl::removeRoutingScopes(const std::vector<std::string>& scope
 
 Router::ConfigConstSharedPtr
 ScopedConfigImpl::getRouteConfig(const Http::HeaderMap& headers) const {
-  ScopeKeyPtr scope_key = scope_key_builder_.computeScopeKey(headers);
-  if (scope_key == nullptr) {
+  // Only the hash is needed for the lookup, so skip materializing the ScopeKey and its
+  // heap-allocated fragments.
+  const absl::optional<uint64_t> scope_key_hash = scope_key_builder_.computeScopeKeyHash(headers);
+  if (!scope_key_hash.has_value()) {
     return nullptr;
   }
-  auto iter = scoped_route_info_by_key_.find(scope_key->hash());
+  auto iter = scoped_route_info_by_key_.find(*scope_key_hash);
   if (iter != scoped_route_info_by_key_.end()) {
     return iter->second->routeConfig();
   }
@@ -16,6 +16,7 @@
 
 #include "absl/numeric/int128.h"
 #include "absl/strings/str_format.h"
+#include "absl/types/optional.h"
 
 namespace Envoy {
 namespace Router {
@@ -36,6 +37,11 @@ public:
   virtual std::unique_ptr<ScopeKeyFragmentBase>
   computeFragment(const Http::HeaderMap& headers) const PURE;
 
+  // Returns the hash of the fragment that computeFragment() would produce, or nullopt if no
+  // fragment could be generated from the headers. Used on the request path to compute scope key
+  // hashes without allocating fragment objects.
+  virtual absl::optional<uint64_t> computeFragmentHash(const Http::HeaderMap& headers) const PURE;
+
 protected:
   const ScopedRoutes::ScopeKeyBuilder::FragmentBuilder config_;
 };
@@ -47,9 +53,17 @@ public:
   std::unique_ptr<ScopeKeyFragmentBase>
   computeFragment(const Http::HeaderMap& headers) const override;
 
+  absl::optional<uint64_t> computeFragmentHash(const Http::HeaderMap& headers) const override;
+
 private:
+  // Returns a view into the header value for the extracted fragment, or nullopt if the rule does
+  // not apply to the given headers.
+  absl::optional<absl::string_view> extractFragmentValue(const Http::HeaderMap& headers) const;
+
   const ScopedRoutes::ScopeKeyBuilder::FragmentBuilder::HeaderValueExtractor&
       header_value_extractor_config_;
+  // Lower-cased at config load so request path lookups do not re-allocate the header name.
+  const Http::LowerCaseString header_name_;
 };
 
 /**
@@ -64,6 +78,11 @@ public:
   // Computes scope key for given headers, returns nullptr if a key can't be computed.
   virtual ScopeKeyPtr computeScopeKey(const Http::HeaderMap& headers) const PURE;
 
+  // Computes the hash of the scope key for the given headers without allocating a ScopeKey or
+  // its fragments, returns nullopt if a key can't be computed. Equivalent to
+  // computeScopeKey(headers)->hash().
+  virtual absl::optional<uint64_t> computeScopeKeyHash(const Http::HeaderMap& headers) const PURE;
+
 protected:
   const ScopedRoutes::ScopeKeyBuilder config_;
 };
@@ -73,6 +92,7 @@ public:
   explicit ScopeKeyBuilderImpl(ScopedRoutes::ScopeKeyBuilder&& config);
 
   ScopeKeyPtr computeScopeKey(const Http::HeaderMap& headers) const override;
+  absl::optional<uint64_t> computeScopeKeyHash(const Http::HeaderMap& headers) const override;
 
 private:
   std::vector<std::unique_ptr<FragmentBuilderBase>> fragment_builders_;
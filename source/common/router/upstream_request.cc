@@ -530,8 +530,11 @@ void UpstreamRequest::resetPerTryIdleTimer() {
 void UpstreamRequest::setupPerTryTimeout() {
   ASSERT(!per_try_timeout_);
   if (parent_.timeout().per_try_timeout_.count() > 0) {
+    Event::TimerCb timeout_cb = [this]() -> void { onPerTryTimeout(); };
     per_try_timeout_ =
-        parent_.callbacks()->dispatcher().createTimer([this]() -> void { onPerTryTimeout(); });
+        Runtime::runtimeFeatureEnabled("envoy.reloadable_features.router_coarse_timeout_timers")
+            ? parent_.callbacks()->dispatcher().createCoarseTimer(std::move(timeout_cb))
+            : parent_.callbacks()->dispatcher().createTimer(std::move(timeout_cb));
     per_try_timeout_->enableTimer(parent_.timeout().per_try_timeout_);
   }
 
@@ -1,9 +1,13 @@
 #include "source/common/runtime/runtime_features.h"
 
+#include "source/common/common/macros.h"
+
+#include "absl/container/flat_hash_map.h"
 #include "absl/flags/commandlineflag.h"
 #include "absl/flags/flag.h"
 #include "absl/strings/match.h"
 #include "absl/strings/str_replace.h"
+#include "absl/synchronization/mutex.h"
 
 #define RUNTIME_GUARD(name) ABSL_FLAG(bool, name, true, "");        // NOLINT
 #define FALSE_RUNTIME_GUARD(name) ABSL_FLAG(bool, name, false, ""); // NOLINT
@@ -32,6 +36,7 @@
 RUNTIME_GUARD(envoy_reloadable_features_allow_compact_maglev);
 RUNTIME_GUARD(envoy_reloadable_features_allow_upstream_filters);
 RUNTIME_GUARD(envoy_reloadable_features_append_query_parameters_path_rewriter);
+RUNTIME_GUARD(envoy_reloadable_features_cares_merge_concurrent_resolutions);
 RUNTIME_GUARD(envoy_reloadable_features_closer_shadow_behavior);
 RUNTIME_GUARD(envoy_reloadable_features_conn_pool_delete_when_idle);
 RUNTIME_GUARD(envoy_reloadable_features_correct_remote_address);
@@ -60,6 +65,7 @@ RUNTIME_GUARD(envoy_reloadable_features_original_dst_rely_on_idle_timeout);
 RUNTIME_GUARD(envoy_reloadable_features_quic_defer_logging_to_ack_listener);
 RUNTIME_GUARD(envoy_reloadable_features_quic_defer_send_in_response_to_packet);
 RUNTIME_GUARD(envoy_reloadable_features_reject_require_client_certificate_with_quic);
+RUNTIME_GUARD(envoy_reloadable_features_reuse_filter_chain_on_match_only_change);
 RUNTIME_GUARD(envoy_reloadable_features_skip_dns_lookup_for_proxied_requests);
 RUNTIME_GUARD(envoy_reloadable_features_successful_active_health_check_uneject_host);
 RUNTIME_GUARD(envoy_reloadable_features_tcp_pool_idle_timeout);
@@ -92,6 +98,22 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_defer_processing_backedup_streams)
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_http2_use_oghttp2);
 // TODO(bencebeky): Finish BalsaParser implementation, then enable by default. See issue #21245.
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_http1_use_balsa_parser);
+// Skips route re-matching on clearRouteCache() when the request headers are unchanged. Opt-in
+// because configurations that route on dynamic metadata or filter state can observe stale
+// routes with this enabled.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_http_skip_route_refresh_for_unchanged_headers);
+// Defers allocation of a cluster's traffic stats block until its first use, so clusters that
+// never receive traffic never pay the memory cost. Opt-in because stats consumers may expect
+// zero-valued cluster stats to exist before any traffic is routed.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_deferred_cluster_traffic_stats);
+// Multiplexes router request timeout timers (global and per-try) onto the dispatcher's coarse
+// timing wheel so arming/cancelling them is O(1). Opt-in because coarse timers may fire up to
+// one wheel tick (100ms) late.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_router_coarse_timeout_timers);
+// Defers the HTTP/1 response headers flush when content-length is known and <= 16KB so headers
+// and body are written to the connection in one pass. Opt-in because headers are not written
+// until the first body byte (or end of stream) arrives from the upstream.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_http1_coalesce_small_response_writes);
 // Used to track if runtime is initialized.
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_runtime_initialized);
 // TODO(mattklein123): Flip this to true and/or remove completely once verified by Envoy Mobile.
@@ -102,6 +124,26 @@ FALSE_RUNTIME_GUARD(envoy_reloadable_features_always_use_v6);
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_no_delay_close_for_upgrades);
 // TODO(pradeepcrao) reset this to true after 2 releases (1.27)
 FALSE_RUNTIME_GUARD(envoy_reloadable_features_enable_include_histograms);
+// Opt-in kernel TLS offload after the handshake; requires Linux with the tls ULP.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_tls_enable_kernel_offload);
+// Opt-in splice(2) relay for TcpProxy on eligible plain-TCP sessions.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_tcp_proxy_use_splice);
+// Default downstream UDP listeners to GRO batched receive when the OS supports it.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_udp_listener_prefer_gro);
+// Use the lock-free least-loaded connection balancer where exact_balance is configured.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_listener_least_loaded_connection_balance);
+// Use the WRSQ scheduler instead of EDF for weighted host picks (not applied with slow start).
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_lb_use_wrsq_scheduler);
+// Share active health check probe results across clusters with identical HC configs/endpoints.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_health_check_share_probe_results);
+// Serialize Struct/Value messages in MessageUtil::getJsonStringFromMessage with the direct
+// walker instead of the protobuf JSON printer. Opt-in until proven byte-identical: the walker
+// renders non-finite numbers and invalid UTF-8 that the printer rejects with an error.
+FALSE_RUNTIME_GUARD(envoy_reloadable_features_protobuf_direct_struct_json_serialization);
+// Hash protos by streaming their deterministic wire form instead of printing them to text
+// format. Changes hash values (notably for the cache filter's stable keys), hence opt-in.
+// TODO(agent): flip to true after a release of soak time.
+FALSE_RUNTIME_GUARD(envoy_restart_features_use_fast_protobuf_hash);
 
 // Block of non-boolean flags. Use of int flags is deprecated. Do not add more.
 ABSL_FLAG(uint64_t, re2_max_program_size_error_level, 100, ""); // NOLINT
@@ -165,6 +207,52 @@ bool isRuntimeFeature(absl::string_view feature) {
   return RuntimeFeaturesDefaults::get().getFlag(feature) != nullptr;
 }
 
+// Tracks all live CachedRuntimeFeature handles so that their cached values can be refreshed when
+// a runtime guard changes. Registration happens once per call site and refresh once per runtime
+// guard update, so a mutex-protected map is sufficient; the hot path never takes the lock.
+class CachedFeatureRegistry {
+public:
+  static CachedFeatureRegistry& get() { MUTABLE_CONSTRUCT_ON_FIRST_USE(CachedFeatureRegistry); }
+
+  void add(CachedRuntimeFeature& handle) {
+    absl::MutexLock lock(&mutex_);
+    handle.enabled_.store(runtimeFeatureEnabled(handle.feature_), std::memory_order_relaxed);
+    handles_[handle.feature_].push_back(&handle);
+  }
+
+  void refresh(absl::string_view feature, bool value) {
+    absl::MutexLock lock(&mutex_);
+    const auto it = handles_.find(feature);
+    if (it == handles_.end()) {
+      return;
+    }
+    for (CachedRuntimeFeature* handle : it->second) {
+      handle->enabled_.store(value, std::memory_order_relaxed);
+    }
+  }
+
+  void refreshAll() {
+    absl::MutexLock lock(&mutex_);
+    for (const auto& [feature, handles] : handles_) {
+      const bool value = runtimeFeatureEnabled(feature);
+      for (CachedRuntimeFeature* handle : handles) {
+        handle->enabled_.store(value, std::memory_order_relaxed);
+      }
+    }
+  }
+
+private:
+  absl::Mutex mutex_;
+  absl::flat_hash_map<std::string, std::vector<CachedRuntimeFeature*>>
+      handles_ ABSL_GUARDED_BY(mutex_);
+};
+
+CachedRuntimeFeature::CachedRuntimeFeature(absl::string_view feature) : feature_(feature) {
+  CachedFeatureRegistry::get().add(*this);
+}
+
+void refreshCachedRuntimeFeatures() { CachedFeatureRegistry::get().refreshAll(); }
+
 bool runtimeFeatureEnabled(absl::string_view feature) {
   absl::CommandLineFlag* flag = RuntimeFeaturesDefaults::get().getFlag(feature);
   if (flag == nullptr) {
@@ -204,6 +292,7 @@ void maybeSetRuntimeGuard(absl::string_view name, bool value) {
   }
   std::string err;
   flag->ParseFrom(value ? "true" : "false", &err);
+  CachedFeatureRegistry::get().refresh(name, value);
 }
 
 void maybeSetDeprecatedInts(absl::string_view name, uint32_t value) {
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "envoy/runtime/runtime.h"
@@ -18,6 +19,32 @@ bool isRuntimeFeature(absl::string_view feature);
 bool runtimeFeatureEnabled(absl::string_view feature);
 uint64_t getInteger(absl::string_view feature, uint64_t default_value);
 
+/**
+ * A pre-resolved handle to a boolean runtime feature ("runtime guard").
+ *
+ * Construction resolves the feature name once and registers the handle to be refreshed whenever
+ * runtime guards are updated, after which enabled() is a single relaxed atomic load: no string
+ * hashing or flag reflection on the hot path. Handles are never unregistered, so they must be
+ * process-lifetime objects, e.g. function-local statics at hot call sites.
+ */
+class CachedRuntimeFeature {
+public:
+  explicit CachedRuntimeFeature(absl::string_view feature);
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+
+private:
+  friend class CachedFeatureRegistry;
+
+  const std::string feature_;
+  std::atomic<bool> enabled_{false};
+};
+
+// Re-read the backing flags of all registered CachedRuntimeFeature handles. Only needed where
+// flag values are modified without going through maybeSetRuntimeGuard(), e.g. the
+// absl::FlagSaver restoration performed by TestScopedRuntime.
+void refreshCachedRuntimeFeatures();
+
 void markRuntimeInitialized();
 bool isRuntimeInitialized();
 
@@ -410,6 +410,8 @@ LoaderImpl::LoaderImpl(Event::Dispatcher& dispatcher, ThreadLocal::SlotAllocator
       config_(config), service_cluster_(local_info.clusterName()), api_(api),
       init_watcher_("RTDS", [this]() { onRtdsReady(); }), store_(store) {
   absl::node_hash_set<std::string> layer_names;
+  cached_layers_.resize(config_.layers().size());
+  uint32_t layer_idx = 0;
   for (const auto& layer : config_.layers()) {
     auto ret = layer_names.insert(layer.name());
     if (!ret.second) {
@@ -431,16 +433,22 @@ LoaderImpl::LoaderImpl(Event::Dispatcher& dispatcher, ThreadLocal::SlotAllocator
         watcher_ = dispatcher.createFilesystemWatcher();
       }
       watcher_->addWatch(layer.disk_layer().symlink_root(), Filesystem::Watcher::Events::MovedTo,
-                         [this](uint32_t) -> void { loadNewSnapshot(); });
+                         [this](uint32_t) -> void {
+                           invalidateCachedLayersOfType(envoy::config::bootstrap::v3::RuntimeLayer::
+                                                            LayerSpecifierCase::kDiskLayer);
+                           loadNewSnapshot();
+                         });
       break;
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kRtdsLayer:
       subscriptions_.emplace_back(
           std::make_unique<RtdsSubscription>(*this, layer.rtds_layer(), store, validation_visitor));
+      subscriptions_.back()->layer_idx_ = layer_idx;
       init_manager_.add(subscriptions_.back()->init_target_);
       break;
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::LAYER_SPECIFIER_NOT_SET:
       throw EnvoyException("layer specifier not set");
     }
+    ++layer_idx;
   }
 
   loadNewSnapshot();
@@ -491,6 +499,7 @@ void RtdsSubscription::onConfigUpdate(const std::vector<Config::DecodedResourceR
   }
   ENVOY_LOG(debug, "Reloading RTDS snapshot for onConfigUpdate");
   proto_.CopyFrom(runtime.layer());
+  parent_.invalidateCachedLayer(layer_idx_);
   parent_.loadNewSnapshot();
   init_target_.ready();
 }
@@ -538,10 +547,25 @@ void RtdsSubscription::onConfigRemoved(
   }
   ENVOY_LOG(debug, "Clear RTDS snapshot for onConfigUpdate");
   proto_.Clear();
+  parent_.invalidateCachedLayer(layer_idx_);
   parent_.loadNewSnapshot();
   init_target_.ready();
 }
 
+void LoaderImpl::invalidateCachedLayer(uint32_t layer_idx) {
+  ASSERT(layer_idx < cached_layers_.size());
+  cached_layers_[layer_idx].reset();
+}
+
+void LoaderImpl::invalidateCachedLayersOfType(
+    envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase kind) {
+  for (int i = 0; i < config_.layers().size(); ++i) {
+    if (config_.layers(i).layer_specifier_case() == kind) {
+      cached_layers_[i].reset();
+    }
+  }
+}
+
 void LoaderImpl::loadNewSnapshot() {
   std::shared_ptr<SnapshotImpl> ptr = createNewSnapshot();
   tls_->set([ptr](Event::Dispatcher&) -> ThreadLocal::ThreadLocalObjectSharedPtr {
@@ -578,6 +602,8 @@ void LoaderImpl::mergeValues(const absl::node_hash_map<std::string, std::string>
     throw EnvoyException("No admin layer specified");
   }
   admin_layer_->mergeValues(values);
+  invalidateCachedLayersOfType(
+      envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kAdminLayer);
   loadNewSnapshot();
 }
 
@@ -597,10 +623,25 @@ SnapshotImplPtr LoaderImpl::createNewSnapshot() {
   uint32_t disk_layers = 0;
   uint32_t error_layers = 0;
   uint32_t rtds_layer = 0;
-  for (const auto& layer : config_.layers()) {
+  for (int i = 0; i < config_.layers().size(); ++i) {
+    const auto& layer = config_.layers(i);
+    // Reuse the cached layer unless its backing source changed since the last snapshot; only the
+    // invalidated layers are rebuilt below.
+    if (cached_layers_[i] != nullptr) {
+      if (layer.layer_specifier_case() ==
+          envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kDiskLayer) {
+        ++disk_layers;
+      } else if (layer.layer_specifier_case() ==
+                 envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kRtdsLayer) {
+        ++rtds_layer;
+      }
+      layers.push_back(cached_layers_[i]);
+      continue;
+    }
     switch (layer.layer_specifier_case()) {
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kStaticLayer:
-      layers.emplace_back(std::make_unique<const ProtoLayer>(layer.name(), layer.static_layer()));
+      cached_layers_[i] = std::make_shared<const ProtoLayer>(layer.name(), layer.static_layer());
+      layers.push_back(cached_layers_[i]);
       break;
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kDiskLayer: {
       std::string path =
@@ -610,7 +651,8 @@ SnapshotImplPtr LoaderImpl::createNewSnapshot() {
       }
       if (api_.fileSystem().directoryExists(path)) {
         TRY_ASSERT_MAIN_THREAD {
-          layers.emplace_back(std::make_unique<DiskLayer>(layer.name(), path, api_));
+          cached_layers_[i] = std::make_shared<const DiskLayer>(layer.name(), path, api_);
+          layers.push_back(cached_layers_[i]);
           ++disk_layers;
         }
         END_TRY
@@ -625,11 +667,13 @@ SnapshotImplPtr LoaderImpl::createNewSnapshot() {
       break;
     }
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kAdminLayer:
-      layers.push_back(std::make_unique<AdminLayer>(*admin_layer_));
+      cached_layers_[i] = std::make_shared<const AdminLayer>(*admin_layer_);
+      layers.push_back(cached_layers_[i]);
       break;
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::kRtdsLayer: {
       auto* subscription = subscriptions_[rtds_layer++].get();
-      layers.emplace_back(std::make_unique<const ProtoLayer>(layer.name(), subscription->proto_));
+      cached_layers_[i] = std::make_shared<const ProtoLayer>(layer.name(), subscription->proto_);
+      layers.push_back(cached_layers_[i]);
       break;
     }
     case envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase::LAYER_SPECIFIER_NOT_SET:
@@ -219,6 +219,9 @@ struct RtdsSubscription : Envoy::Config::SubscriptionBase<envoy::service::runtim
   std::string resource_name_;
   Init::TargetImpl init_target_;
   ProtobufWkt::Struct proto_;
+  // Index of this subscription's layer in the bootstrap layer list, used to invalidate only this
+  // layer's cache entry when the subscription receives an update.
+  uint32_t layer_idx_{0};
 };
 
 using RtdsSubscriptionPtr = std::unique_ptr<RtdsSubscription>;
@@ -253,6 +256,12 @@ private:
   SnapshotImplPtr createNewSnapshot();
   // Load a new Snapshot into TLS
   void loadNewSnapshot();
+  // Drop the cached layer at the given bootstrap layer index so that the next snapshot rebuilds
+  // it. Main thread only, like snapshot creation itself.
+  void invalidateCachedLayer(uint32_t layer_idx);
+  // Drop all cached layers of the given kind, e.g. every disk layer after a symlink swap.
+  void invalidateCachedLayersOfType(
+      envoy::config::bootstrap::v3::RuntimeLayer::LayerSpecifierCase kind);
   RuntimeStats generateStats(Stats::Store& store);
   void onRtdsReady();
 
@@ -271,6 +280,12 @@ private:
   Upstream::ClusterManager* cm_{};
   Stats::Store& store_;
 
+  // Cache of immutable layers, parallel to config_.layers(). Layers are rebuilt only when their
+  // backing source changes (admin merge, disk symlink swap, RTDS update); unchanged layers are
+  // shared by reference with every new snapshot so that e.g. a one-key RTDS update does not
+  // re-parse the static and disk layers. Accessed on the main thread only.
+  std::vector<Snapshot::OverrideLayerConstPtr> cached_layers_;
+
   absl::Mutex snapshot_mutex_;
   SnapshotConstSharedPtr thread_safe_snapshot_ ABSL_GUARDED_BY(snapshot_mutex_);
 };
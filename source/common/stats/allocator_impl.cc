@@ -24,37 +24,41 @@ namespace Stats {
 const char AllocatorImpl::DecrementToZeroSyncPoint[] = "decrement-zero";
 
 AllocatorImpl::~AllocatorImpl() {
-  ASSERT(counters_.empty());
-  ASSERT(gauges_.empty());
+  for (Shard& shard : shards_) {
+    ASSERT(shard.counters_.empty());
+    ASSERT(shard.gauges_.empty());
 
 #ifndef NDEBUG
-  // Move deleted stats into the sets for the ASSERTs in removeFromSetLockHeld to function.
-  for (auto& counter : deleted_counters_) {
-    auto insertion = counters_.insert(counter.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
-  for (auto& gauge : deleted_gauges_) {
-    auto insertion = gauges_.insert(gauge.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
-  for (auto& text_readout : deleted_text_readouts_) {
-    auto insertion = text_readouts_.insert(text_readout.get());
-    // Assert that there were no duplicates.
-    ASSERT(insertion.second);
-  }
+    // Move deleted stats into the sets for the ASSERTs in removeFromSetLockHeld to function.
+    for (auto& counter : shard.deleted_counters_) {
+      auto insertion = shard.counters_.insert(counter.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
+    for (auto& gauge : shard.deleted_gauges_) {
+      auto insertion = shard.gauges_.insert(gauge.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
+    for (auto& text_readout : shard.deleted_text_readouts_) {
+      auto insertion = shard.text_readouts_.insert(text_readout.get());
+      // Assert that there were no duplicates.
+      ASSERT(insertion.second);
+    }
 #endif
+  }
 }
 
 #ifndef ENVOY_CONFIG_COVERAGE
 void AllocatorImpl::debugPrint() {
-  Thread::LockGuard lock(mutex_);
-  for (Counter* counter : counters_) {
-    ENVOY_LOG_MISC(info, "counter: {}", symbolTable().toString(counter->statName()));
-  }
-  for (Gauge* gauge : gauges_) {
-    ENVOY_LOG_MISC(info, "gauge: {}", symbolTable().toString(gauge->statName()));
+  for (Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (Counter* counter : shard.counters_) {
+      ENVOY_LOG_MISC(info, "counter: {}", symbolTable().toString(counter->statName()));
+    }
+    for (Gauge* gauge : shard.gauges_) {
+      ENVOY_LOG_MISC(info, "gauge: {}", symbolTable().toString(gauge->statName()));
+    }
   }
 }
 #endif
@@ -89,7 +93,7 @@ public:
   // RefcountInterface
   void incRefCount() override { ++ref_count_; }
   bool decRefCount() override {
-    // We must, unfortunately, hold the allocator's lock when decrementing the
+    // We must, unfortunately, hold the owning shard's lock when decrementing the
     // refcount. Otherwise another thread may simultaneously try to allocate the
     // same name'd stat after we decrement it, and we'll wind up with a
     // dtor/update race. To avoid this we must hold the lock until the stat is
@@ -100,11 +104,20 @@ public:
     // destruct anything. But it seems preferable at to be conservative here,
     // as stats will only go out of scope when a scope is destructed (during
     // xDS) or during admin stats operations.
-    Thread::LockGuard lock(alloc_.mutex_);
+    AllocatorImpl::Shard& shard = alloc_.shardForStatName(this->statName());
+    Thread::LockGuard lock(shard.mutex_);
     ASSERT(ref_count_ >= 1);
+    if (ref_count_ == 1) {
+      // Remove from the family index before the final decrement. Family
+      // iteration pins members by incrementing their ref-counts while holding
+      // family_mutex_, so after this removal no new reference can appear, and
+      // if one appeared first the decrement below does not reach zero and the
+      // stat simply drops out of the index one release early.
+      removeFromFamilyIndex();
+    }
     if (--ref_count_ == 0) {
       alloc_.sync().syncPoint(AllocatorImpl::DecrementToZeroSyncPoint);
-      removeFromSetLockHeld();
+      removeFromSetLockHeld(shard);
       return true;
     }
     return false;
@@ -112,11 +125,20 @@ public:
   uint32_t use_count() const override { return ref_count_; }
 
   /**
-   * We must atomically remove the counter/gauges from the allocator's sets when
-   * our ref-count decrement hits zero. The counters and gauges are held in
+   * We must atomically remove the counter/gauges from the owning shard's sets
+   * when our ref-count decrement hits zero. The counters and gauges are held in
    * distinct sets so we virtualize this removal helper.
    */
-  virtual void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) PURE;
+  virtual void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) PURE;
+
+  /**
+   * Removes this stat from the per-type family index, called with the owning
+   * shard's mutex held when the last reference is about to be released. The
+   * counters and gauges are held in distinct family maps so we virtualize this
+   * removal helper, mirroring removeFromSetLockHeld.
+   */
+  virtual void removeFromFamilyIndex() PURE;
 
 protected:
   AllocatorImpl& alloc_;
@@ -127,9 +149,10 @@ protected:
   // but these are always in transition to ref-count 2 or higher, and thus
   // cannot race with a decrement to zero.
   //
-  // However, we must hold alloc_.mutex_ when decrementing ref_count_ so that
-  // when it hits zero we can atomically remove it from alloc_.counters_ or
-  // alloc_.gauges_. We leave it atomic to avoid taking the lock on increment.
+  // However, we must hold the owning shard's mutex when decrementing
+  // ref_count_ so that when it hits zero we can atomically remove it from the
+  // shard's counters_ or gauges_. We leave it atomic to avoid taking the lock
+  // on increment.
   std::atomic<uint32_t> ref_count_{0};
 
   std::atomic<uint16_t> flags_{0};
@@ -141,10 +164,16 @@ public:
               const StatNameTagVector& stat_name_tags)
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
-  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
-    const size_t count = alloc_.counters_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) override {
+    const size_t count = shard.counters_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_counters_.erase(this);
+    shard.sinked_counters_.erase(this);
+  }
+
+  void removeFromFamilyIndex() override {
+    Thread::LockGuard lock(alloc_.family_mutex_);
+    alloc_.removeFromFamiliesLockHeld<Counter>(alloc_.counter_families_, *this);
   }
 
   // Stats::Counter
@@ -186,30 +215,41 @@ public:
     }
   }
 
-  void removeFromSetLockHeld() override ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) {
-    const size_t count = alloc_.gauges_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard) override
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) {
+    const size_t count = shard.gauges_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_gauges_.erase(this);
+    shard.sinked_gauges_.erase(this);
+  }
+
+  void removeFromFamilyIndex() override {
+    Thread::LockGuard lock(alloc_.family_mutex_);
+    alloc_.removeFromFamiliesLockHeld<Gauge>(alloc_.gauge_families_, *this);
   }
 
   // Stats::Gauge
   void add(uint64_t amount) override {
     child_value_ += amount;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void dec() override { sub(1); }
   void inc() override { add(1); }
   void set(uint64_t value) override {
     child_value_ = value;
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   void sub(uint64_t amount) override {
     ASSERT(child_value_ >= amount);
     ASSERT(used() || amount == 0);
     child_value_ -= amount;
+    flags_ |= Flags::Changed;
   }
   uint64_t value() const override { return child_value_ + parent_value_; }
 
+  bool latchChanged() override {
+    return (flags_.fetch_and(static_cast<uint16_t>(~Flags::Changed)) & Flags::Changed) != 0;
+  }
+
   ImportMode importMode() const override {
     if (flags_ & Flags::NeverImport) {
       return ImportMode::NeverImport;
@@ -246,7 +286,10 @@ public:
     }
   }
 
-  void setParentValue(uint64_t value) override { parent_value_ = value; }
+  void setParentValue(uint64_t value) override {
+    parent_value_ = value;
+    flags_ |= Flags::Changed;
+  }
 
 private:
   std::atomic<uint64_t> parent_value_{0};
@@ -259,10 +302,16 @@ public:
                   const StatNameTagVector& stat_name_tags)
       : StatsSharedImpl(name, alloc, tag_extracted_name, stat_name_tags) {}
 
-  void removeFromSetLockHeld() ABSL_EXCLUSIVE_LOCKS_REQUIRED(alloc_.mutex_) override {
-    const size_t count = alloc_.text_readouts_.erase(statName());
+  void removeFromSetLockHeld(AllocatorImpl::Shard& shard)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(shard.mutex_) override {
+    const size_t count = shard.text_readouts_.erase(statName());
     ASSERT(count == 1);
-    alloc_.sinked_text_readouts_.erase(this);
+    shard.sinked_text_readouts_.erase(this);
+  }
+
+  void removeFromFamilyIndex() override {
+    Thread::LockGuard lock(alloc_.family_mutex_);
+    alloc_.removeFromFamiliesLockHeld<TextReadout>(alloc_.text_readout_families_, *this);
   }
 
   // Stats::TextReadout
@@ -270,13 +319,17 @@ public:
     std::string value_copy(value);
     absl::MutexLock lock(&mutex_);
     value_ = std::move(value_copy);
-    flags_ |= Flags::Used;
+    flags_ |= Flags::Used | Flags::Changed;
   }
   std::string value() const override {
     absl::MutexLock lock(&mutex_);
     return value_;
   }
 
+  bool latchChanged() override {
+    return (flags_.fetch_and(static_cast<uint16_t>(~Flags::Changed)) & Flags::Changed) != 0;
+  }
+
 private:
   mutable absl::Mutex mutex_;
   std::string value_ ABSL_GUARDED_BY(mutex_);
@@ -284,18 +337,24 @@ private:
 
 CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracted_name,
                                             const StatNameTagVector& stat_name_tags) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(gauges_.find(name) == gauges_.end());
-  ASSERT(text_readouts_.find(name) == text_readouts_.end());
-  auto iter = counters_.find(name);
-  if (iter != counters_.end()) {
+  Shard& shard = shardForStatName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.gauges_.find(name) == shard.gauges_.end());
+  ASSERT(shard.text_readouts_.find(name) == shard.text_readouts_.end());
+  auto iter = shard.counters_.find(name);
+  if (iter != shard.counters_.end()) {
     return {*iter};
   }
   auto counter = CounterSharedPtr(makeCounterInternal(name, tag_extracted_name, stat_name_tags));
-  counters_.insert(counter.get());
+  shard.counters_.insert(counter.get());
+  {
+    Thread::LockGuard family_lock(family_mutex_);
+    addToFamiliesLockHeld(counter_families_, *counter);
+  }
   // Add counter to sinked_counters_ if it matches the sink predicate.
-  if (sink_predicates_ != nullptr && sink_predicates_->includeCounter(*counter)) {
-    auto val = sinked_counters_.insert(counter.get());
+  SinkPredicates* sink_predicates = sink_predicates_.load(std::memory_order_acquire);
+  if (sink_predicates != nullptr && sink_predicates->includeCounter(*counter)) {
+    auto val = shard.sinked_counters_.insert(counter.get());
     ASSERT(val.second);
   }
   return counter;
@@ -304,19 +363,25 @@ CounterSharedPtr AllocatorImpl::makeCounter(StatName name, StatName tag_extracte
 GaugeSharedPtr AllocatorImpl::makeGauge(StatName name, StatName tag_extracted_name,
                                         const StatNameTagVector& stat_name_tags,
                                         Gauge::ImportMode import_mode) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(counters_.find(name) == counters_.end());
-  ASSERT(text_readouts_.find(name) == text_readouts_.end());
-  auto iter = gauges_.find(name);
-  if (iter != gauges_.end()) {
+  Shard& shard = shardForStatName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.counters_.find(name) == shard.counters_.end());
+  ASSERT(shard.text_readouts_.find(name) == shard.text_readouts_.end());
+  auto iter = shard.gauges_.find(name);
+  if (iter != shard.gauges_.end()) {
     return {*iter};
   }
   auto gauge =
       GaugeSharedPtr(new GaugeImpl(name, *this, tag_extracted_name, stat_name_tags, import_mode));
-  gauges_.insert(gauge.get());
+  shard.gauges_.insert(gauge.get());
+  {
+    Thread::LockGuard family_lock(family_mutex_);
+    addToFamiliesLockHeld(gauge_families_, *gauge);
+  }
   // Add gauge to sinked_gauges_ if it matches the sink predicate.
-  if (sink_predicates_ != nullptr && sink_predicates_->includeGauge(*gauge)) {
-    auto val = sinked_gauges_.insert(gauge.get());
+  SinkPredicates* sink_predicates = sink_predicates_.load(std::memory_order_acquire);
+  if (sink_predicates != nullptr && sink_predicates->includeGauge(*gauge)) {
+    auto val = shard.sinked_gauges_.insert(gauge.get());
     ASSERT(val.second);
   }
   return gauge;
@@ -324,30 +389,39 @@ GaugeSharedPtr AllocatorImpl::makeGauge(StatName name, StatName tag_extracted_na
 
 TextReadoutSharedPtr AllocatorImpl::makeTextReadout(StatName name, StatName tag_extracted_name,
                                                     const StatNameTagVector& stat_name_tags) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(counters_.find(name) == counters_.end());
-  ASSERT(gauges_.find(name) == gauges_.end());
-  auto iter = text_readouts_.find(name);
-  if (iter != text_readouts_.end()) {
+  Shard& shard = shardForStatName(name);
+  Thread::LockGuard lock(shard.mutex_);
+  ASSERT(shard.counters_.find(name) == shard.counters_.end());
+  ASSERT(shard.gauges_.find(name) == shard.gauges_.end());
+  auto iter = shard.text_readouts_.find(name);
+  if (iter != shard.text_readouts_.end()) {
     return {*iter};
   }
   auto text_readout =
       TextReadoutSharedPtr(new TextReadoutImpl(name, *this, tag_extracted_name, stat_name_tags));
-  text_readouts_.insert(text_readout.get());
+  shard.text_readouts_.insert(text_readout.get());
+  {
+    Thread::LockGuard family_lock(family_mutex_);
+    addToFamiliesLockHeld(text_readout_families_, *text_readout);
+  }
   // Add text_readout to sinked_text_readouts_ if it matches the sink predicate.
-  if (sink_predicates_ != nullptr && sink_predicates_->includeTextReadout(*text_readout)) {
-    auto val = sinked_text_readouts_.insert(text_readout.get());
+  SinkPredicates* sink_predicates = sink_predicates_.load(std::memory_order_acquire);
+  if (sink_predicates != nullptr && sink_predicates->includeTextReadout(*text_readout)) {
+    auto val = shard.sinked_text_readouts_.insert(text_readout.get());
     ASSERT(val.second);
   }
   return text_readout;
 }
 
 bool AllocatorImpl::isMutexLockedForTest() {
-  bool locked = mutex_.tryLock();
-  if (locked) {
-    mutex_.unlock();
+  for (Shard& shard : shards_) {
+    const bool locked = shard.mutex_.tryLock();
+    if (!locked) {
+      return true;
+    }
+    shard.mutex_.unlock();
   }
-  return !locked;
+  return false;
 }
 
 Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracted_name,
@@ -355,42 +429,169 @@ Counter* AllocatorImpl::makeCounterInternal(StatName name, StatName tag_extracte
   return new CounterImpl(name, *this, tag_extracted_name, stat_name_tags);
 }
 
+template <typename StatType>
+void AllocatorImpl::addToFamiliesLockHeld(FamilyMap<StatType>& families, StatType& stat) {
+  std::vector<StatType*>& members = families.try_emplace(stat.tagExtractedStatName()).first->second;
+  const auto pos = std::lower_bound(members.begin(), members.end(), &stat,
+                                    [this](const StatType* a, const StatType* b) {
+                                      return symbol_table_.lessThan(a->statName(), b->statName());
+                                    });
+  members.insert(pos, &stat);
+}
+
+template <typename StatType>
+void AllocatorImpl::removeFromFamiliesLockHeld(FamilyMap<StatType>& families, StatType& stat) {
+  auto family = families.find(stat.tagExtractedStatName());
+  if (family == families.end()) {
+    return;
+  }
+  std::vector<StatType*>& members = family->second;
+  // Match by name rather than by address, mirroring removeFromSetLockHeld:
+  // tests wrap stats (see NotifyingCounter), so the indexed pointer may not be
+  // the impl object whose destruction triggered this removal.
+  const auto pos = std::find_if(members.begin(), members.end(), [&stat](const StatType* member) {
+    return member == &stat || member->statName() == stat.statName();
+  });
+  if (pos == members.end()) {
+    // The stat was already removed from the index when it was marked for
+    // deletion; see markCounterForDeletion.
+    return;
+  }
+  members.erase(pos);
+  if (members.empty()) {
+    families.erase(family);
+    return;
+  }
+  // The map key may reference symbol storage owned by the stat being removed,
+  // so re-key the family from a surviving member.
+  auto node = families.extract(family);
+  node.key() = node.mapped().front()->tagExtractedStatName();
+  families.insert(std::move(node));
+}
+
+template <typename StatType>
+std::vector<std::vector<RefcountPtr<StatType>>>
+AllocatorImpl::snapshotFamiliesLockHeld(const FamilyMap<StatType>& families) const {
+  std::vector<std::vector<RefcountPtr<StatType>>> snapshot;
+  snapshot.reserve(families.size());
+  for (const auto& family : families) {
+    snapshot.emplace_back(family.second.begin(), family.second.end());
+  }
+  return snapshot;
+}
+
+// Invokes `fn` for each family in the snapshot. The family name is taken from
+// a member rather than from the index, as the snapshot must remain usable
+// after family_mutex_ has been released and the index has possibly changed.
+template <typename StatType>
+static void iterateFamilySnapshot(const std::vector<std::vector<RefcountPtr<StatType>>>& snapshot,
+                                  const FamilyIterateFn<StatType>& fn) {
+  for (const std::vector<RefcountPtr<StatType>>& members : snapshot) {
+    ASSERT(!members.empty());
+    if (!fn(members.front()->tagExtractedStatName(), members)) {
+      return;
+    }
+  }
+}
+
+void AllocatorImpl::forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const {
+  std::vector<std::vector<CounterSharedPtr>> snapshot;
+  {
+    Thread::LockGuard lock(family_mutex_);
+    snapshot = snapshotFamiliesLockHeld(counter_families_);
+  }
+  iterateFamilySnapshot(snapshot, fn);
+}
+
+void AllocatorImpl::forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const {
+  std::vector<std::vector<GaugeSharedPtr>> snapshot;
+  {
+    Thread::LockGuard lock(family_mutex_);
+    snapshot = snapshotFamiliesLockHeld(gauge_families_);
+  }
+  iterateFamilySnapshot(snapshot, fn);
+}
+
+void AllocatorImpl::forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const {
+  std::vector<std::vector<TextReadoutSharedPtr>> snapshot;
+  {
+    Thread::LockGuard lock(family_mutex_);
+    snapshot = snapshotFamiliesLockHeld(text_readout_families_);
+  }
+  iterateFamilySnapshot(snapshot, fn);
+}
+
+// Iteration locks one shard at a time rather than holding every shard lock for
+// the whole traversal, so stats created or destroyed concurrently in
+// not-yet-visited shards may or may not be seen, and the count passed to
+// f_size may differ slightly from the number of stats visited. Callers use
+// f_size only to reserve space, so an approximate count is acceptable; the
+// same visibility caveat already applied to stats created while the caller
+// processes the iteration output.
 void AllocatorImpl::forEachCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(counters_.size());
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.counters_.size();
+    }
+    f_size(total);
   }
-  for (auto& counter : counters_) {
-    f_stat(*counter);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& counter : shard.counters_) {
+      f_stat(*counter);
+    }
   }
 }
 
 void AllocatorImpl::forEachGauge(SizeFn f_size, StatFn<Gauge> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(gauges_.size());
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.gauges_.size();
+    }
+    f_size(total);
   }
-  for (auto& gauge : gauges_) {
-    f_stat(*gauge);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& gauge : shard.gauges_) {
+      f_stat(*gauge);
+    }
   }
 }
 
 void AllocatorImpl::forEachTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const {
-  Thread::LockGuard lock(mutex_);
   if (f_size != nullptr) {
-    f_size(text_readouts_.size());
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.text_readouts_.size();
+    }
+    f_size(total);
   }
-  for (auto& text_readout : text_readouts_) {
-    f_stat(*text_readout);
+  for (const Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    for (auto& text_readout : shard.text_readouts_) {
+      f_stat(*text_readout);
+    }
   }
 }
 
 void AllocatorImpl::forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
-  if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_counters_.size());
-    for (auto counter : sinked_counters_) {
-      f_stat(*counter);
+  if (sink_predicates_.load(std::memory_order_acquire) != nullptr) {
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_counters_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto counter : shard.sinked_counters_) {
+        f_stat(*counter);
+      }
     }
   } else {
     forEachCounter(f_size, f_stat);
@@ -398,11 +599,18 @@ void AllocatorImpl::forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat)
 }
 
 void AllocatorImpl::forEachSinkedGauge(SizeFn f_size, StatFn<Gauge> f_stat) const {
-  if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_gauges_.size());
-    for (auto gauge : sinked_gauges_) {
-      f_stat(*gauge);
+  if (sink_predicates_.load(std::memory_order_acquire) != nullptr) {
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_gauges_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto gauge : shard.sinked_gauges_) {
+        f_stat(*gauge);
+      }
     }
   } else {
     forEachGauge(f_size, f_stat);
@@ -410,11 +618,18 @@ void AllocatorImpl::forEachSinkedGauge(SizeFn f_size, StatFn<Gauge> f_stat) cons
 }
 
 void AllocatorImpl::forEachSinkedTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const {
-  if (sink_predicates_ != nullptr) {
-    Thread::LockGuard lock(mutex_);
-    f_size(sinked_text_readouts_.size());
-    for (auto text_readout : sinked_text_readouts_) {
-      f_stat(*text_readout);
+  if (sink_predicates_.load(std::memory_order_acquire) != nullptr) {
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      total += shard.sinked_text_readouts_.size();
+    }
+    f_size(total);
+    for (const Shard& shard : shards_) {
+      Thread::LockGuard lock(shard.mutex_);
+      for (auto text_readout : shard.sinked_text_readouts_) {
+        f_stat(*text_readout);
+      }
     }
   } else {
     forEachTextReadout(f_size, f_stat);
@@ -422,72 +637,87 @@ void AllocatorImpl::forEachSinkedTextReadout(SizeFn f_size, StatFn<TextReadout>
 }
 
 void AllocatorImpl::setSinkPredicates(std::unique_ptr<SinkPredicates>&& sink_predicates) {
-  Thread::LockGuard lock(mutex_);
-  ASSERT(sink_predicates_ == nullptr);
-  sink_predicates_ = std::move(sink_predicates);
-  sinked_counters_.clear();
-  sinked_gauges_.clear();
-  sinked_text_readouts_.clear();
-  // Add counters to the set of sinked counters.
-  for (auto& counter : counters_) {
-    if (sink_predicates_->includeCounter(*counter)) {
-      sinked_counters_.emplace(counter);
+  ASSERT(sink_predicates_.load(std::memory_order_relaxed) == nullptr);
+  owned_sink_predicates_ = std::move(sink_predicates);
+  // Publish before rebuilding the sinked sets: a maker observing the pointer early simply adds
+  // its new stat to the sinked set under the shard mutex, which the rebuild below then
+  // recomputes consistently. Publishing after the rebuild could instead miss such a stat.
+  sink_predicates_.store(owned_sink_predicates_.get(), std::memory_order_release);
+  for (Shard& shard : shards_) {
+    Thread::LockGuard lock(shard.mutex_);
+    shard.sinked_counters_.clear();
+    shard.sinked_gauges_.clear();
+    shard.sinked_text_readouts_.clear();
+    // Add counters to the set of sinked counters.
+    for (auto& counter : shard.counters_) {
+      if (owned_sink_predicates_->includeCounter(*counter)) {
+        shard.sinked_counters_.emplace(counter);
+      }
     }
-  }
-  // Add gauges to the set of sinked gauges.
-  for (auto& gauge : gauges_) {
-    if (sink_predicates_->includeGauge(*gauge)) {
-      sinked_gauges_.insert(gauge);
+    // Add gauges to the set of sinked gauges.
+    for (auto& gauge : shard.gauges_) {
+      if (owned_sink_predicates_->includeGauge(*gauge)) {
+        shard.sinked_gauges_.insert(gauge);
+      }
     }
-  }
-  // Add text_readouts to the set of sinked text readouts.
-  for (auto& text_readout : text_readouts_) {
-    if (sink_predicates_->includeTextReadout(*text_readout)) {
-      sinked_text_readouts_.insert(text_readout);
+    // Add text_readouts to the set of sinked text readouts.
+    for (auto& text_readout : shard.text_readouts_) {
+      if (owned_sink_predicates_->includeTextReadout(*text_readout)) {
+        shard.sinked_text_readouts_.insert(text_readout);
+      }
     }
   }
 }
 
 void AllocatorImpl::markCounterForDeletion(const CounterSharedPtr& counter) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = counters_.find(counter->statName());
-  if (iter == counters_.end()) {
+  Shard& shard = shardForStatName(counter->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.counters_.find(counter->statName());
+  if (iter == shard.counters_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(counter.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_counters_.emplace_back(*iter);
-  counters_.erase(iter);
-  sinked_counters_.erase(counter.get());
+  shard.deleted_counters_.emplace_back(*iter);
+  shard.counters_.erase(iter);
+  shard.sinked_counters_.erase(counter.get());
+  Thread::LockGuard family_lock(family_mutex_);
+  removeFromFamiliesLockHeld(counter_families_, *counter);
 }
 
 void AllocatorImpl::markGaugeForDeletion(const GaugeSharedPtr& gauge) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = gauges_.find(gauge->statName());
-  if (iter == gauges_.end()) {
+  Shard& shard = shardForStatName(gauge->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.gauges_.find(gauge->statName());
+  if (iter == shard.gauges_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(gauge.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_gauges_.emplace_back(*iter);
-  gauges_.erase(iter);
-  sinked_gauges_.erase(gauge.get());
+  shard.deleted_gauges_.emplace_back(*iter);
+  shard.gauges_.erase(iter);
+  shard.sinked_gauges_.erase(gauge.get());
+  Thread::LockGuard family_lock(family_mutex_);
+  removeFromFamiliesLockHeld(gauge_families_, *gauge);
 }
 
 void AllocatorImpl::markTextReadoutForDeletion(const TextReadoutSharedPtr& text_readout) {
-  Thread::LockGuard lock(mutex_);
-  auto iter = text_readouts_.find(text_readout->statName());
-  if (iter == text_readouts_.end()) {
+  Shard& shard = shardForStatName(text_readout->statName());
+  Thread::LockGuard lock(shard.mutex_);
+  auto iter = shard.text_readouts_.find(text_readout->statName());
+  if (iter == shard.text_readouts_.end()) {
     // This has already been marked for deletion.
     return;
   }
   ASSERT(text_readout.get() == *iter);
   // Duplicates are ASSERTed in ~AllocatorImpl.
-  deleted_text_readouts_.emplace_back(*iter);
-  text_readouts_.erase(iter);
-  sinked_text_readouts_.erase(text_readout.get());
+  shard.deleted_text_readouts_.emplace_back(*iter);
+  shard.text_readouts_.erase(iter);
+  shard.sinked_text_readouts_.erase(text_readout.get());
+  Thread::LockGuard family_lock(family_mutex_);
+  removeFromFamiliesLockHeld(text_readout_families_, *text_readout);
 }
 
 } // namespace Stats
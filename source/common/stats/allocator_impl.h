@@ -1,5 +1,8 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <map>
 #include <vector>
 
 #include "envoy/common/optref.h"
@@ -20,7 +23,16 @@ class AllocatorImpl : public Allocator {
 public:
   static const char DecrementToZeroSyncPoint[];
 
-  AllocatorImpl(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
+  // The stat sets are sharded by StatName hash, with an independent mutex per
+  // shard, so that workers creating or destroying stats concurrently (e.g.
+  // during cluster churn) contend only when their stats land in the same
+  // shard. Must be a power of two so shard selection is a mask.
+  static constexpr uint64_t NumShards = 16;
+
+  AllocatorImpl(SymbolTable& symbol_table)
+      : counter_families_(StatNameLessThan(symbol_table)),
+        gauge_families_(StatNameLessThan(symbol_table)),
+        text_readout_families_(StatNameLessThan(symbol_table)), symbol_table_(symbol_table) {}
   ~AllocatorImpl() override;
 
   // Allocator
@@ -40,6 +52,10 @@ public:
 
   void forEachTextReadout(SizeFn, StatFn<TextReadout>) const override;
 
+  void forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const override;
+  void forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const override;
+  void forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const override;
+
   void forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat) const override;
   void forEachSinkedGauge(SizeFn f_size, StatFn<Gauge> f_stat) const override;
   void forEachSinkedTextReadout(SizeFn f_size, StatFn<TextReadout> f_stat) const override;
@@ -55,7 +71,8 @@ public:
   Thread::ThreadSynchronizer& sync() { return sync_; }
 
   /**
-   * @return whether the allocator's mutex is locked, exposed for testing purposes.
+   * @return whether any of the allocator's shard mutexes is locked, exposed for
+   * testing purposes.
    */
   bool isMutexLockedForTest();
 
@@ -74,39 +91,97 @@ private:
   friend class TextReadoutImpl;
   friend class NotifyingAllocatorImpl;
 
-  // A mutex is needed here to protect both the stats_ object from both
-  // alloc() and free() operations. Although alloc() operations are called under existing locking,
-  // free() operations are made from the destructors of the individual stat objects, which are not
-  // protected by locks.
-  mutable Thread::MutexBasicLockable mutex_;
-
-  StatSet<Counter> counters_ ABSL_GUARDED_BY(mutex_);
-  StatSet<Gauge> gauges_ ABSL_GUARDED_BY(mutex_);
-  StatSet<TextReadout> text_readouts_ ABSL_GUARDED_BY(mutex_);
-
   template <typename StatType> using StatPointerSet = absl::flat_hash_set<StatType*>;
-  // Stat pointers that participate in the flush to sink process.
-  StatPointerSet<Counter> sinked_counters_ ABSL_GUARDED_BY(mutex_);
-  StatPointerSet<Gauge> sinked_gauges_ ABSL_GUARDED_BY(mutex_);
-  StatPointerSet<TextReadout> sinked_text_readouts_ ABSL_GUARDED_BY(mutex_);
 
-  // Predicates used to filter stats to be flushed.
-  std::unique_ptr<SinkPredicates> sink_predicates_;
+  // Index of metric families, keyed by tag-extracted name, with each family's
+  // members kept sorted by full stat name. The index is updated incrementally
+  // as stats are created and destroyed so that forEach*Family can walk a
+  // prebuilt, already-ordered structure without grouping or sorting per call.
+  // The key references symbol storage owned by the family's first member, and
+  // is re-keyed when that member is removed.
+  template <typename StatType>
+  using FamilyMap = std::map<StatName, std::vector<StatType*>, StatNameLessThan>;
+
+  // Inserts `stat` into its family, creating the family if needed. Callers
+  // hold the owning shard's mutex; family_mutex_ is always acquired after a
+  // shard mutex, never before.
+  template <typename StatType>
+  void addToFamiliesLockHeld(FamilyMap<StatType>& families, StatType& stat)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(family_mutex_);
+
+  // Removes `stat` from its family, erasing the family when it becomes empty.
+  // Tolerates stats that are absent from the index, which happens when a stat
+  // marked for deletion is finally destroyed.
+  template <typename StatType>
+  void removeFromFamiliesLockHeld(FamilyMap<StatType>& families, StatType& stat)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(family_mutex_);
+
+  // Takes a reference to every member of every family, so that the references
+  // can be handed to a FamilyIterateFn after family_mutex_ is released.
+  // Releasing a stat reference acquires a shard mutex, which must never happen
+  // while family_mutex_ is held, so the callbacks (and the destruction of the
+  // snapshot) run outside the lock.
+  template <typename StatType>
+  std::vector<std::vector<RefcountPtr<StatType>>>
+  snapshotFamiliesLockHeld(const FamilyMap<StatType>& families) const
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(family_mutex_);
+
+  // One independently locked slice of the allocator's stats. A StatName always
+  // maps to the same shard (see shardForStatName), so the cross-type ASSERTs
+  // in makeCounter etc. remain valid within a shard.
+  struct Shard {
+    // A mutex is needed here to protect the stat sets from both alloc() and
+    // free() operations. Although alloc() operations are called under existing
+    // locking, free() operations are made from the destructors of the
+    // individual stat objects, which are not protected by locks.
+    mutable Thread::MutexBasicLockable mutex_;
+
+    StatSet<Counter> counters_ ABSL_GUARDED_BY(mutex_);
+    StatSet<Gauge> gauges_ ABSL_GUARDED_BY(mutex_);
+    StatSet<TextReadout> text_readouts_ ABSL_GUARDED_BY(mutex_);
+
+    // Stat pointers that participate in the flush to sink process.
+    StatPointerSet<Counter> sinked_counters_ ABSL_GUARDED_BY(mutex_);
+    StatPointerSet<Gauge> sinked_gauges_ ABSL_GUARDED_BY(mutex_);
+    StatPointerSet<TextReadout> sinked_text_readouts_ ABSL_GUARDED_BY(mutex_);
+
+    // Retain storage for deleted stats; these are no longer in maps because
+    // the matcher-pattern was established after they were created. Since the
+    // stats are held by reference in code that expects them to be there, we
+    // can't actually delete the stats.
+    //
+    // It seems like it would be better to have each client that expects a stat
+    // to exist to hold it as (e.g.) a CounterSharedPtr rather than a Counter&
+    // but that would be fairly complex to change.
+    std::vector<CounterSharedPtr> deleted_counters_ ABSL_GUARDED_BY(mutex_);
+    std::vector<GaugeSharedPtr> deleted_gauges_ ABSL_GUARDED_BY(mutex_);
+    std::vector<TextReadoutSharedPtr> deleted_text_readouts_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  Shard& shardForStatName(StatName name) { return shards_[name.hash() & (NumShards - 1)]; }
+  const Shard& shardForStatName(StatName name) const {
+    return shards_[name.hash() & (NumShards - 1)];
+  }
+
+  // The family index spans all shards, so it has its own mutex. Declared
+  // before shards_ so that it outlives them: stats retained in the deleted_*
+  // vectors consult the index from their destructors during shard teardown.
+  mutable Thread::MutexBasicLockable family_mutex_;
+  FamilyMap<Counter> counter_families_ ABSL_GUARDED_BY(family_mutex_);
+  FamilyMap<Gauge> gauge_families_ ABSL_GUARDED_BY(family_mutex_);
+  FamilyMap<TextReadout> text_readout_families_ ABSL_GUARDED_BY(family_mutex_);
+
+  std::array<Shard, NumShards> shards_;
+
+  // Predicates used to filter stats to be flushed. Set at most once; ownership lives in
+  // owned_sink_predicates_ while readers (the makeCounter/makeGauge/makeTextReadout hot paths
+  // under their shard mutex and the lock-free checks in forEachSinked*) go through the atomic
+  // pointer, which is published with release semantics in setSinkPredicates.
+  std::unique_ptr<SinkPredicates> owned_sink_predicates_;
+  std::atomic<SinkPredicates*> sink_predicates_{nullptr};
   SymbolTable& symbol_table_;
 
   Thread::ThreadSynchronizer sync_;
-
-  // Retain storage for deleted stats; these are no longer in maps because
-  // the matcher-pattern was established after they were created. Since the
-  // stats are held by reference in code that expects them to be there, we
-  // can't actually delete the stats.
-  //
-  // It seems like it would be better to have each client that expects a stat
-  // to exist to hold it as (e.g.) a CounterSharedPtr rather than a Counter&
-  // but that would be fairly complex to change.
-  std::vector<CounterSharedPtr> deleted_counters_ ABSL_GUARDED_BY(mutex_);
-  std::vector<GaugeSharedPtr> deleted_gauges_ ABSL_GUARDED_BY(mutex_);
-  std::vector<TextReadoutSharedPtr> deleted_text_readouts_ ABSL_GUARDED_BY(mutex_);
 };
 
 } // namespace Stats
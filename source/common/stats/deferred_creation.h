@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+
+#include "envoy/stats/scope.h"
+
+#include "absl/base/call_once.h"
+
+namespace Envoy {
+namespace Stats {
+
+/**
+ * Wraps a stats struct generated by MAKE_STATS_STRUCT so that instantiation of the backing
+ * counters and gauges can be deferred until the block is first accessed. Most stat blocks of
+ * most clusters never leave zero, so deferring creation avoids allocating backing storage for
+ * them at all. A deferred block does not appear in stats sinks or on the admin endpoint until
+ * its first access.
+ *
+ * When constructed with deferred == false the wrapped struct is created eagerly and the wrapper
+ * behaves exactly like a plain member.
+ */
+template <typename StatsStructType> class DeferredCreationCompatibleStats {
+public:
+  DeferredCreationCompatibleStats(ScopeSharedPtr scope,
+                                  const typename StatsStructType::StatNames& stat_names,
+                                  bool deferred)
+      : scope_(std::move(scope)), stat_names_(stat_names) {
+    if (!deferred) {
+      get();
+    }
+  }
+
+  /**
+   * @return StatsStructType& the wrapped stats struct, instantiating it on first call.
+   * Thread-safe; after the first call this is a single atomic load.
+   */
+  StatsStructType& get() {
+    absl::call_once(once_,
+                    [this] { stats_ = std::make_unique<StatsStructType>(stat_names_, *scope_); });
+    return *stats_;
+  }
+
+private:
+  ScopeSharedPtr scope_;
+  const typename StatsStructType::StatNames& stat_names_;
+  absl::once_flag once_;
+  std::unique_ptr<StatsStructType> stats_;
+};
+
+} // namespace Stats
+} // namespace Envoy
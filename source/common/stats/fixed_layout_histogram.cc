@@ -0,0 +1,59 @@
+#include "source/common/stats/fixed_layout_histogram.h"
+
+#include <algorithm>
+
+namespace Envoy {
+namespace Stats {
+
+void FixedLayoutHistogram::approxQuantiles(const double* quantiles, size_t size,
+                                           double* out) const {
+  if (sample_count_ == 0) {
+    std::fill(out, out + size, 0.0);
+    return;
+  }
+  uint64_t cumulative = 0;
+  uint32_t bucket = 0;
+  for (size_t i = 0; i < size; ++i) {
+    const double target = quantiles[i] * static_cast<double>(sample_count_);
+    while (bucket < NumBuckets - 1 &&
+           (counts_[bucket] == 0 ||
+            static_cast<double>(cumulative + counts_[bucket]) < target)) {
+      cumulative += counts_[bucket];
+      ++bucket;
+    }
+    double fraction = 0.0;
+    if (counts_[bucket] != 0) {
+      fraction = std::min(
+          1.0, std::max(0.0, (target - static_cast<double>(cumulative)) /
+                                 static_cast<double>(counts_[bucket])));
+    }
+    out[i] = static_cast<double>(bucketLowerBound(bucket)) +
+             fraction * static_cast<double>(bucketWidth(bucket));
+  }
+}
+
+double FixedLayoutHistogram::approxCountBelow(double threshold) const {
+  if (threshold <= 0) {
+    return 0;
+  }
+  double count = 0;
+  for (uint32_t i = 0; i <= MaxBucketIndex; ++i) {
+    const double lower = static_cast<double>(bucketLowerBound(i));
+    if (lower >= threshold) {
+      break;
+    }
+    if (counts_[i] == 0) {
+      continue;
+    }
+    const double width = static_cast<double>(bucketWidth(i));
+    if (threshold >= lower + width) {
+      count += static_cast<double>(counts_[i]);
+    } else {
+      count += static_cast<double>(counts_[i]) * (threshold - lower) / width;
+    }
+  }
+  return count;
+}
+
+} // namespace Stats
+} // namespace Envoy
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "absl/numeric/bits.h"
+
+namespace Envoy {
+namespace Stats {
+
+/**
+ * A histogram with a fixed, allocation-free layout: log-linear base-2 buckets
+ * (every power-of-two range is split into SubBucketCount linear sub-buckets)
+ * held in a flat inline array. Compared to the default circllhist backend this
+ * trades a slightly coarser relative error, at most 1/SubBucketCount, for O(1)
+ * recording with no dynamic allocation, predictable per-histogram memory, and
+ * merges that are a single pass over two flat arrays which the compiler can
+ * vectorize.
+ *
+ * Like the circllhist instances in ThreadLocalHistogramImpl, this class is not
+ * internally synchronized; callers must ensure single-threaded access or
+ * provide external locking.
+ */
+class FixedLayoutHistogram {
+public:
+  // Each power-of-two range [2^e, 2^(e+1)) is split into SubBucketCount
+  // equal-width buckets, bounding the relative error of a recorded value by
+  // 1/SubBucketCount. Values below SubBucketCount are recorded exactly.
+  static constexpr uint32_t SubBucketBits = 4;
+  static constexpr uint32_t SubBucketCount = 1 << SubBucketBits;
+
+  // The largest index used is for values with the top bit set; round the array
+  // up to a power of two.
+  static constexpr uint32_t MaxBucketIndex = (63 - SubBucketBits + 1) * SubBucketCount +
+                                             SubBucketCount - 1;
+  static constexpr uint32_t NumBuckets = 1024;
+  static_assert(MaxBucketIndex < NumBuckets);
+
+  /**
+   * @return the index of the bucket holding value; O(1) via bit operations.
+   */
+  static uint32_t bucketIndex(uint64_t value) {
+    if (value < SubBucketCount) {
+      return static_cast<uint32_t>(value);
+    }
+    const uint32_t exponent = 63 - absl::countl_zero(value);
+    const uint32_t sub =
+        static_cast<uint32_t>(value >> (exponent - SubBucketBits)) - SubBucketCount;
+    return (exponent - SubBucketBits + 1) * SubBucketCount + sub;
+  }
+
+  /**
+   * @return the smallest value mapping to the bucket at index.
+   */
+  static uint64_t bucketLowerBound(uint32_t index) {
+    if (index < 2 * SubBucketCount) {
+      return index;
+    }
+    const uint32_t exponent = index / SubBucketCount + SubBucketBits - 1;
+    const uint32_t sub = index % SubBucketCount;
+    return static_cast<uint64_t>(SubBucketCount + sub) << (exponent - SubBucketBits);
+  }
+
+  /**
+   * @return the width of the bucket at index; the bucket covers
+   *         [bucketLowerBound(index), bucketLowerBound(index) + width).
+   */
+  static uint64_t bucketWidth(uint32_t index) {
+    if (index < 2 * SubBucketCount) {
+      return 1;
+    }
+    return uint64_t(1) << (index / SubBucketCount - 1);
+  }
+
+  void recordValue(uint64_t value) {
+    ++counts_[bucketIndex(value)];
+    ++sample_count_;
+    sample_sum_ += static_cast<double>(value);
+  }
+
+  /**
+   * Adds all samples recorded in other to this histogram. The layout is
+   * identical for all instances, so this is an element-wise sum over the two
+   * flat arrays.
+   */
+  void merge(const FixedLayoutHistogram& other) {
+    for (uint32_t i = 0; i < NumBuckets; ++i) {
+      counts_[i] += other.counts_[i];
+    }
+    sample_count_ += other.sample_count_;
+    sample_sum_ += other.sample_sum_;
+  }
+
+  void clear() {
+    counts_.fill(0);
+    sample_count_ = 0;
+    sample_sum_ = 0;
+  }
+
+  /**
+   * Computes approximate quantiles by linear interpolation within buckets,
+   * mirroring hist_approx_quantile.
+   * @param quantiles the quantiles to compute, in ascending order.
+   * @param size the number of quantiles.
+   * @param out receives the computed values; must have room for size entries.
+   */
+  void approxQuantiles(const double* quantiles, size_t size, double* out) const;
+
+  /**
+   * @return the approximate number of samples recorded below threshold,
+   *         interpolating linearly within the bucket containing it. Mirrors
+   *         hist_approx_count_below.
+   */
+  double approxCountBelow(double threshold) const;
+
+  uint64_t sampleCount() const { return sample_count_; }
+  double sampleSum() const { return sample_sum_; }
+
+private:
+  std::array<uint64_t, NumBuckets> counts_{};
+  uint64_t sample_count_{0};
+  double sample_sum_{0};
+};
+
+} // namespace Stats
+} // namespace Envoy
@@ -25,6 +25,13 @@ HistogramStatisticsImpl::HistogramStatisticsImpl(const histogram_t* histogram_pt
   refresh(histogram_ptr);
 }
 
+HistogramStatisticsImpl::HistogramStatisticsImpl(Histogram::Unit unit,
+                                                 ConstSupportedBuckets& supported_buckets)
+    : supported_buckets_(supported_buckets),
+      computed_quantiles_(HistogramStatisticsImpl::supportedQuantiles().size(), 0.0), unit_(unit) {
+  computed_buckets_.resize(supported_buckets.size(), 0);
+}
+
 const std::vector<double>& HistogramStatisticsImpl::supportedQuantiles() const {
   CONSTRUCT_ON_FIRST_USE(std::vector<double>,
                          {0, 0.25, 0.5, 0.75, 0.90, 0.95, 0.99, 0.995, 0.999, 1});
@@ -97,6 +104,37 @@ void HistogramStatisticsImpl::refresh(const histogram_t* new_histogram_ptr) {
   }
 }
 
+void HistogramStatisticsImpl::refresh(const FixedLayoutHistogram& new_histogram) {
+  constexpr double percent_scale = Histogram::PercentScale;
+
+  std::fill(computed_quantiles_.begin(), computed_quantiles_.end(), 0.0);
+  ASSERT(supportedQuantiles().size() == computed_quantiles_.size());
+  new_histogram.approxQuantiles(supportedQuantiles().data(), supportedQuantiles().size(),
+                                computed_quantiles_.data());
+  if (unit_ == Histogram::Unit::Percent) {
+    for (double& val : computed_quantiles_) {
+      val /= percent_scale;
+    }
+  }
+
+  sample_count_ = new_histogram.sampleCount();
+  sample_sum_ = new_histogram.sampleSum();
+  if (unit_ == Histogram::Unit::Percent) {
+    sample_sum_ /= percent_scale;
+  }
+
+  computed_buckets_.clear();
+  ConstSupportedBuckets& supported_buckets = supportedBuckets();
+  computed_buckets_.reserve(supported_buckets.size());
+  for (auto bucket : supported_buckets) {
+    if (unit_ == Histogram::Unit::Percent) {
+      bucket *= percent_scale;
+    }
+    computed_buckets_.emplace_back(
+        static_cast<uint64_t>(new_histogram.approxCountBelow(bucket)));
+  }
+}
+
 HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::StatsConfig& config)
     : configs_([&config]() {
         std::vector<Config> configs;
@@ -107,7 +145,8 @@ HistogramSettingsImpl::HistogramSettingsImpl(const envoy::config::metrics::v3::S
         }
 
         return configs;
-      }()) {}
+      }()),
+      use_fixed_layout_(config.use_fixed_layout_histograms()) {}
 
 const ConstSupportedBuckets& HistogramSettingsImpl::buckets(absl::string_view stat_name) const {
   for (const auto& config : configs_) {
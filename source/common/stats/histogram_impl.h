@@ -10,6 +10,7 @@
 
 #include "source/common/common/matchers.h"
 #include "source/common/common/non_copyable.h"
+#include "source/common/stats/fixed_layout_histogram.h"
 #include "source/common/stats/metric_impl.h"
 
 #include "circllhist.h"
@@ -24,6 +25,7 @@ public:
 
   // HistogramSettings
   const ConstSupportedBuckets& buckets(absl::string_view stat_name) const override;
+  bool useFixedLayout() const override { return use_fixed_layout_; }
 
   static ConstSupportedBuckets& defaultBuckets();
 
@@ -31,6 +33,7 @@ private:
   using Config = std::pair<Matchers::StringMatcherImpl<envoy::type::matcher::v3::StringMatcher>,
                            ConstSupportedBuckets>;
   const std::vector<Config> configs_{};
+  const bool use_fixed_layout_{false};
 };
 
 /**
@@ -49,9 +52,16 @@ public:
       const histogram_t* histogram_ptr, Histogram::Unit unit = Histogram::Unit::Unspecified,
       ConstSupportedBuckets& supported_buckets = HistogramSettingsImpl::defaultBuckets());
 
+  /**
+   * Constructs statistics with no samples, suitable for either backend;
+   * populated via one of the refresh() overloads.
+   */
+  HistogramStatisticsImpl(Histogram::Unit unit, ConstSupportedBuckets& supported_buckets);
+
   static ConstSupportedBuckets& defaultSupportedBuckets();
 
   void refresh(const histogram_t* new_histogram_ptr);
+  void refresh(const FixedLayoutHistogram& new_histogram);
 
   // HistogramStatistics
   std::string quantileSummary() const override;
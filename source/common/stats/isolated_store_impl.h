@@ -203,6 +203,23 @@ public:
     }
   }
 
+  void forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const override {
+    alloc_.forEachCounterFamily(fn);
+  }
+
+  void forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const override {
+    alloc_.forEachGaugeFamily(fn);
+  }
+
+  void forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const override {
+    alloc_.forEachTextReadoutFamily(fn);
+  }
+
+  // Isolated stores have no parent histograms, matching forEachHistogram.
+  void forEachHistogramFamily(const FamilyIterateFn<ParentHistogram>& fn) const override {
+    UNREFERENCED_PARAMETER(fn);
+  }
+
   void forEachSinkedCounter(SizeFn f_size, StatFn<Counter> f_stat) const override {
     forEachCounter(f_size, f_stat);
   }
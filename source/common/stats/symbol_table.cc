@@ -345,6 +345,10 @@ void SymbolTable::incRefCount(const StatName& stat_name) {
   const SymbolVec symbols = Encoding::decodeSymbols(stat_name);
 
   Thread::LockGuard lock(lock_);
+  incRefCountLockHeld(symbols);
+}
+
+void SymbolTable::incRefCountLockHeld(const SymbolVec& symbols) {
   for (Symbol symbol : symbols) {
     auto decode_search = decode_map_.find(symbol);
 
@@ -571,6 +575,53 @@ SymbolTable::StoragePtr SymbolTable::encode(absl::string_view name) {
   return mem_block.release();
 }
 
+std::vector<SymbolTable::StoragePtr>
+SymbolTable::encodeAll(absl::Span<const absl::string_view> names) {
+  // As in addTokensToEncoding(), we want to hold the lock for the minimum
+  // amount of time, so all the string-splitting happens before we take it. The
+  // win over calling encode() in a loop is that the whole batch is symbolized
+  // under a single lock acquisition.
+  std::vector<absl::string_view> trimmed_names;
+  std::vector<std::vector<absl::string_view>> tokens;
+  trimmed_names.reserve(names.size());
+  tokens.reserve(names.size());
+  for (absl::string_view name : names) {
+    name = StringUtil::removeTrailingCharacters(name, '.');
+    trimmed_names.push_back(name);
+    if (name.empty()) {
+      tokens.emplace_back();
+    } else {
+      tokens.push_back(absl::StrSplit(name, '.'));
+    }
+  }
+
+  std::vector<SymbolVec> symbols(names.size());
+  {
+    Thread::LockGuard lock(lock_);
+    for (uint64_t i = 0; i < tokens.size(); ++i) {
+      if (tokens[i].empty()) {
+        continue;
+      }
+      recent_lookups_.lookup(trimmed_names[i]);
+      symbols[i].reserve(tokens[i].size());
+      for (absl::string_view token : tokens[i]) {
+        symbols[i].push_back(toSymbol(token));
+      }
+    }
+  }
+
+  std::vector<StoragePtr> storage;
+  storage.reserve(names.size());
+  for (const SymbolVec& symbol_vec : symbols) {
+    Encoding encoding;
+    encoding.addSymbols(symbol_vec);
+    MemBlockBuilder<uint8_t> mem_block(Encoding::totalSizeBytes(encoding.bytesRequired()));
+    encoding.moveToMemBlock(mem_block);
+    storage.push_back(mem_block.release());
+  }
+  return storage;
+}
+
 StatNameStorage::StatNameStorage(absl::string_view name, SymbolTable& table)
     : StatNameStorageBase(table.encode(name)) {}
 
@@ -638,6 +689,17 @@ const uint8_t* StatNamePool::addReturningStorage(absl::string_view str) {
 
 StatName StatNamePool::add(absl::string_view str) { return StatName(addReturningStorage(str)); }
 
+std::vector<StatName> StatNamePool::addAll(absl::Span<const absl::string_view> names) {
+  std::vector<StatName> stat_names;
+  stat_names.reserve(names.size());
+  storage_vector_.reserve(storage_vector_.size() + names.size());
+  for (SymbolTable::StoragePtr& storage : symbol_table_.encodeAll(names)) {
+    storage_vector_.push_back(StatNameStorage(std::move(storage)));
+    stat_names.emplace_back(storage_vector_.back().bytes());
+  }
+  return stat_names;
+}
+
 StatName StatNameDynamicPool::add(absl::string_view str) {
   storage_vector_.push_back(Stats::StatNameDynamicStorage(str, symbol_table_));
   return StatName(storage_vector_.back().bytes());
@@ -703,10 +765,19 @@ void SymbolTable::populateList(const StatName* names, uint32_t num_names, StatNa
   // into storage.
   MemBlockBuilder<uint8_t> mem_block(total_size_bytes);
   mem_block.appendOne(num_names);
+  SymbolVec symbols;
   for (uint32_t i = 0; i < num_names; ++i) {
     const StatName stat_name = names[i];
     Encoding::appendToMemBlock(stat_name, mem_block);
-    incRefCount(stat_name);
+    const SymbolVec stat_name_symbols = Encoding::decodeSymbols(stat_name);
+    symbols.insert(symbols.end(), stat_name_symbols.begin(), stat_name_symbols.end());
+  }
+
+  // populateList() runs on every stat instantiation, so we bump the ref-counts
+  // for all the names with a single lock acquisition rather than once per name.
+  {
+    Thread::LockGuard lock(lock_);
+    incRefCountLockHeld(symbols);
   }
 
   // This assertion double-checks the arithmetic where we computed
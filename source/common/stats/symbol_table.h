@@ -19,6 +19,7 @@
 #include "absl/container/inlined_vector.h"
 #include "absl/strings/str_join.h"
 #include "absl/strings/str_split.h"
+#include "absl/types/span.h"
 
 namespace Envoy {
 namespace Stats {
@@ -356,6 +357,7 @@ public:
 
 private:
   friend class StatName;
+  friend class StatNamePool;
   friend class StatNameTest;
   friend class StatNameDeathTest;
   friend class StatNameDynamicStorage;
@@ -372,6 +374,18 @@ private:
    *
    */
   StoragePtr encode(absl::string_view name);
+
+  /**
+   * Encodes a batch of names with a single lock acquisition, rather than the
+   * one-per-name cost of calling encode() in a loop. The reference-counting
+   * contract is the same as encode(): the caller owns each returned storage
+   * and must release it via SymbolTable::free().
+   *
+   * @param names the names to encode.
+   * @return the encoded names, in the same order as the input.
+   */
+  std::vector<StoragePtr> encodeAll(absl::Span<const absl::string_view> names);
+
   StoragePtr makeDynamicStorage(absl::string_view name);
 
   /**
@@ -428,6 +442,15 @@ private:
    */
   Symbol toSymbol(absl::string_view sv) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
+  /**
+   * Bumps the reference counts for a batch of already-decoded symbols. Factored
+   * out of incRefCount() so that populateList() can bump the counts for all the
+   * names in a list with a single lock acquisition.
+   *
+   * @param symbols the symbols whose reference counts should be incremented.
+   */
+  void incRefCountLockHeld(const SymbolVec& symbols) ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
+
   /**
    * Convenience function for decode(), decoding one symbol at a time.
    *
@@ -544,6 +567,14 @@ public:
    * @param table the symbol table.
    */
   void free(SymbolTable& table);
+
+private:
+  friend class StatNamePool;
+
+  // Adopts storage already encoded (with reference counts held) by the symbol
+  // table, e.g. via SymbolTable::encodeAll().
+  explicit StatNameStorage(SymbolTable::StoragePtr&& storage)
+      : StatNameStorageBase(std::move(storage)) {}
 };
 
 /**
@@ -754,6 +785,17 @@ public:
    */
   StatName add(absl::string_view name);
 
+  /**
+   * Adds a batch of names to the pool with a single symbol-table lock
+   * acquisition, rather than the one-per-name cost of calling add() in a
+   * loop. Useful when instantiating groups of related stat names, e.g. the
+   * fixed names used by a newly discovered cluster.
+   *
+   * @param names the names to add to the container.
+   * @return the StatNames held in the container, in the same order as names.
+   */
+  std::vector<StatName> addAll(absl::Span<const absl::string_view> names);
+
   /**
    * Does essentially the same thing as add(), but returns the storage as a
    * pointer which can later be used to create a StatName. This can be used
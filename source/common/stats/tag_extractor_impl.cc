@@ -217,6 +217,15 @@ bool TagExtractorTokensImpl::extractTag(TagExtractionContext& context, std::vect
     PERF_TAG_INC(missed_);
     return false;
   }
+  addMatch(input_tokens, match_input_index, start, tags, remove_characters);
+  PERF_RECORD(perf, "tokens-match", name_);
+  return true;
+}
+
+void TagExtractorTokensImpl::addMatch(const std::vector<absl::string_view>& input_tokens,
+                                      uint32_t match_input_index, uint32_t start,
+                                      std::vector<Tag>& tags,
+                                      IntervalSet<size_t>& remove_characters) const {
   const absl::string_view tag_value = input_tokens[match_input_index];
 
   // Given the starting character-index of the match token, we have to
@@ -244,10 +253,7 @@ bool TagExtractorTokensImpl::extractTag(TagExtractionContext& context, std::vect
   }
   addTagReturningValueRef(tags) = std::string(tag_value);
   remove_characters.insert(start, end);
-
-  PERF_RECORD(perf, "tokens-match", name_);
   PERF_TAG_INC(matched_);
-  return true;
 }
 
 bool TagExtractorTokensImpl::searchTags(const std::vector<absl::string_view>& input_tokens,
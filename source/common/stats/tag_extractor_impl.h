@@ -160,6 +160,27 @@ public:
   bool extractTag(TagExtractionContext& context, std::vector<Tag>& tags,
                   IntervalSet<size_t>& remove_characters) const override;
 
+  /**
+   * Emits the tag and the character-interval to remove for a match found at
+   * the specified token position. This is broken out of extractTag so that
+   * TagProducerImpl can share a single walk over the stat-name's tokens
+   * across all token-based extractors, recording each match that walk finds.
+   *
+   * @param input_tokens the '.'-separated tokens of the stat name.
+   * @param match_input_index the index in input_tokens of the captured tag value.
+   * @param start the character offset of the captured token within the stat name.
+   * @param tags the list of tags to append to.
+   * @param remove_characters set of intervals to remove from the stat name.
+   */
+  void addMatch(const std::vector<absl::string_view>& input_tokens, uint32_t match_input_index,
+                uint32_t start, std::vector<Tag>& tags,
+                IntervalSet<size_t>& remove_characters) const;
+
+  /**
+   * @return the parsed pattern tokens, e.g. {"cluster", "$", "**"}.
+   */
+  const std::vector<std::string>& patternTokens() const { return tokens_; }
+
 private:
   static uint32_t findMatchIndex(const std::vector<std::string>& tokens);
   bool searchTags(const std::vector<absl::string_view>& input_tokens, uint32_t input_index,
@@ -65,14 +65,17 @@ int TagProducerImpl::addExtractorsMatching(absl::string_view name) {
   return num_found;
 }
 
-void TagProducerImpl::addExtractor(TagExtractorPtr extractor) {
-  auto insertion = extractor_map_.insert(std::make_pair(extractor->name(), std::ref(*extractor)));
+void TagProducerImpl::recordExtractorName(TagExtractor& extractor) {
+  auto insertion = extractor_map_.insert(std::make_pair(extractor.name(), std::ref(extractor)));
   if (!insertion.second) {
-    extractor->setOtherExtractorWithSameNameExists(true);
+    extractor.setOtherExtractorWithSameNameExists(true);
     std::reference_wrapper<TagExtractor> other = insertion.first->second;
     other.get().setOtherExtractorWithSameNameExists(true);
   }
+}
 
+void TagProducerImpl::addExtractor(TagExtractorPtr extractor) {
+  recordExtractorName(*extractor);
   const absl::string_view prefix = extractor->prefixToken();
   if (prefix.empty()) {
     tag_extractors_without_prefix_.emplace_back(std::move(extractor));
@@ -81,19 +84,104 @@ void TagProducerImpl::addExtractor(TagExtractorPtr extractor) {
   }
 }
 
-void TagProducerImpl::forEachExtractorMatching(
-    absl::string_view stat_name, std::function<void(const TagExtractorPtr&)> f) const {
-  IntervalSetImpl<size_t> remove_characters;
+void TagProducerImpl::addExtractor(std::unique_ptr<TagExtractorTokensImpl> extractor) {
+  recordExtractorName(*extractor);
+
+  // Merge the pattern into the trie, so that all token-based extractors can be
+  // matched with one walk over a stat-name's tokens in produceTags.
+  TokensTrieNode* node = &tokens_trie_root_;
+  for (const std::string& token : extractor->patternTokens()) {
+    std::unique_ptr<TokensTrieNode>* child;
+    if (token == "*") {
+      child = &node->single_token_child_;
+    } else if (token == "$") {
+      child = &node->capture_child_;
+    } else if (token == "**") {
+      child = &node->glob_child_;
+    } else {
+      child = &node->literal_children_[token];
+    }
+    if (*child == nullptr) {
+      *child = std::make_unique<TokensTrieNode>();
+      (*child)->glob_ = token == "**";
+    }
+    node = child->get();
+  }
+  node->extractors_.push_back(extractor.get());
+  tokens_extractors_.push_back(std::move(extractor));
+}
+
+void TagProducerImpl::forEachExtractorMatching(absl::string_view stat_name,
+                                               std::function<void(const TagExtractor&)> f) const {
   for (const TagExtractorPtr& tag_extractor : tag_extractors_without_prefix_) {
-    f(tag_extractor);
+    f(*tag_extractor);
   }
+  absl::string_view token;
   const absl::string_view::size_type dot = stat_name.find('.');
   if (dot != std::string::npos) {
-    const absl::string_view token = absl::string_view(stat_name.data(), dot);
+    token = absl::string_view(stat_name.data(), dot);
     const auto iter = tag_extractor_prefix_map_.find(token);
     if (iter != tag_extractor_prefix_map_.end()) {
       for (const TagExtractorPtr& tag_extractor : iter->second) {
-        f(tag_extractor);
+        f(*tag_extractor);
+      }
+    }
+  }
+  for (const auto& tag_extractor : tokens_extractors_) {
+    const absl::string_view prefix = tag_extractor->prefixToken();
+    if (prefix.empty() || prefix == token) {
+      f(*tag_extractor);
+    }
+  }
+}
+
+void TagProducerImpl::matchTokensTrie(const TokensTrieNode& node,
+                                      const std::vector<absl::string_view>& tokens,
+                                      uint32_t input_index, uint32_t char_index,
+                                      uint32_t capture_index, uint32_t capture_start,
+                                      std::vector<TokensMatch>& matches) const {
+  if (!node.extractors_.empty() && (node.glob_ || input_index == tokens.size())) {
+    for (const TagExtractorTokensImpl* extractor : node.extractors_) {
+      // Keep only the first match found for each extractor; later ones come
+      // from longer "**" expansions of the same pattern.
+      bool already_matched = false;
+      for (const TokensMatch& match : matches) {
+        if (match.extractor_ == extractor) {
+          already_matched = true;
+          break;
+        }
+      }
+      if (!already_matched) {
+        matches.push_back(TokensMatch{extractor, capture_index, capture_start});
+      }
+    }
+  }
+  if (input_index < tokens.size()) {
+    const absl::string_view input_token = tokens[input_index];
+    const uint32_t next_char_index = char_index + input_token.size() + 1;
+    const auto iter = node.literal_children_.find(input_token);
+    if (iter != node.literal_children_.end()) {
+      matchTokensTrie(*iter->second, tokens, input_index + 1, next_char_index, capture_index,
+                      capture_start, matches);
+    }
+    if (node.single_token_child_ != nullptr) {
+      matchTokensTrie(*node.single_token_child_, tokens, input_index + 1, next_char_index,
+                      capture_index, capture_start, matches);
+    }
+    if (node.capture_child_ != nullptr) {
+      matchTokensTrie(*node.capture_child_, tokens, input_index + 1, next_char_index, input_index,
+                      char_index, matches);
+    }
+  }
+  if (node.glob_child_ != nullptr) {
+    // A "**" matches 0 or more tokens, so try the remainder of the trie at
+    // each possible suffix, shortest expansion first.
+    uint32_t glob_char_index = char_index;
+    for (uint32_t i = input_index; i <= tokens.size(); ++i) {
+      matchTokensTrie(*node.glob_child_, tokens, i, glob_char_index, capture_index, capture_start,
+                      matches);
+      if (i < tokens.size()) {
+        glob_char_index += tokens[i].size() + 1;
       }
     }
   }
@@ -103,26 +191,61 @@ std::string TagProducerImpl::produceTags(absl::string_view metric_name, TagVecto
   // TODO(jmarantz): Skip the creation of string-based tags, creating a StatNameTagVector instead.
   IntervalSetImpl<size_t> remove_characters;
   TagExtractionContext tag_extraction_context(metric_name);
-  std::vector<absl::string_view> tokens;
   absl::flat_hash_set<absl::string_view> dup_set;
-  forEachExtractorMatching(metric_name, [&remove_characters, &tags, &tag_extraction_context,
-                                         &dup_set](const TagExtractorPtr& tag_extractor) {
-    // It is relatively cheap to populate a set of string_view for every tag,
-    // but it saves 2% CPU time to only populate and check dup_set for tag-names
-    // where there is more than one extractor. This is rare. For built-in
-    // extractors this only occurs with HTTP_CONN_MANAGER_PREFIX. Istio/Wasm
-    // add configuration for an alternate pattern for RESPONSE_CODE.
-    bool other_extractor_with_same_name_exists = tag_extractor->otherExtractorWithSameNameExists();
-    if (other_extractor_with_same_name_exists &&
-        dup_set.find(tag_extractor->name()) != dup_set.end()) {
-      ENVOY_LOG_EVERY_POW_2_MISC(warn, "Skipping duplicate tag for ", tag_extractor->name());
+
+  // It is relatively cheap to populate a set of string_view for every tag,
+  // but it saves 2% CPU time to only populate and check dup_set for tag-names
+  // where there is more than one extractor. This is rare. For built-in
+  // extractors this only occurs with HTTP_CONN_MANAGER_PREFIX. Istio/Wasm
+  // add configuration for an alternate pattern for RESPONSE_CODE.
+  const auto skip_duplicate = [&dup_set](const TagExtractor& tag_extractor) -> bool {
+    if (tag_extractor.otherExtractorWithSameNameExists() &&
+        dup_set.find(tag_extractor.name()) != dup_set.end()) {
+      ENVOY_LOG_EVERY_POW_2_MISC(warn, "Skipping duplicate tag for ", tag_extractor.name());
+      return true;
+    }
+    return false;
+  };
+
+  const auto extract = [&](const TagExtractorPtr& tag_extractor) {
+    if (skip_duplicate(*tag_extractor)) {
       return;
     }
     if (tag_extractor->extractTag(tag_extraction_context, tags, remove_characters) &&
-        other_extractor_with_same_name_exists) {
+        tag_extractor->otherExtractorWithSameNameExists()) {
       dup_set.insert(tag_extractor->name());
     }
-  });
+  };
+
+  for (const TagExtractorPtr& tag_extractor : tag_extractors_without_prefix_) {
+    extract(tag_extractor);
+  }
+  const absl::string_view::size_type dot = metric_name.find('.');
+  if (dot != std::string::npos) {
+    const auto iter = tag_extractor_prefix_map_.find(metric_name.substr(0, dot));
+    if (iter != tag_extractor_prefix_map_.end()) {
+      for (const TagExtractorPtr& tag_extractor : iter->second) {
+        extract(tag_extractor);
+      }
+    }
+  }
+
+  // All token-based extractors are matched with a single walk of the trie over
+  // the stat-name's tokens.
+  std::vector<TokensMatch> matches;
+  matchTokensTrie(tokens_trie_root_, tag_extraction_context.tokens(), 0, 0, 0, 0, matches);
+  for (const TokensMatch& match : matches) {
+    const TagExtractorTokensImpl& tag_extractor = *match.extractor_;
+    if (skip_duplicate(tag_extractor)) {
+      continue;
+    }
+    tag_extractor.addMatch(tag_extraction_context.tokens(), match.match_input_index_, match.start_,
+                           tags, remove_characters);
+    if (tag_extractor.otherExtractorWithSameNameExists()) {
+      dup_set.insert(tag_extractor.name());
+    }
+  }
+
   return StringUtil::removeCharacters(metric_name, remove_characters);
 }
 
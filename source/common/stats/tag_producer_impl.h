@@ -14,6 +14,7 @@
 #include "source/common/common/utility.h"
 #include "source/common/config/well_known_names.h"
 #include "source/common/protobuf/protobuf.h"
+#include "source/common/stats/tag_extractor_impl.h"
 
 #include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_set.h"
@@ -46,6 +47,33 @@ public:
 private:
   friend class DefaultTagRegexTester;
 
+  // A node in a trie combining every token-based extraction pattern. Each
+  // pattern contributes a path of literal-token, "*", "$", and "**" edges, so
+  // that a single walk over a stat-name's tokens finds the matches for all
+  // token-based extractors at once, rather than re-scanning the tokens for
+  // each extractor in turn.
+  struct TokensTrieNode {
+    absl::flat_hash_map<std::string, std::unique_ptr<TokensTrieNode>> literal_children_;
+    std::unique_ptr<TokensTrieNode> single_token_child_; // "*": matches any one token.
+    std::unique_ptr<TokensTrieNode> capture_child_;      // "$": any one token, captured.
+    std::unique_ptr<TokensTrieNode> glob_child_;         // "**": matches 0 or more tokens.
+
+    // True if this node was created by a "**" pattern-token, in which case
+    // patterns terminating here match regardless of how many tokens remain.
+    bool glob_{false};
+
+    // The extractors whose patterns terminate at this node.
+    std::vector<const TagExtractorTokensImpl*> extractors_;
+  };
+
+  // A match found by walking the token-trie: the extractor that matched, plus
+  // the token-index and character-offset of the value captured by its "$".
+  struct TokensMatch {
+    const TagExtractorTokensImpl* extractor_;
+    uint32_t match_input_index_;
+    uint32_t start_;
+  };
+
   /**
    * Adds a TagExtractor to the collection of tags, tracking prefixes to help make
    * produceTags run efficiently by trying only extractors that have a chance to match.
@@ -53,6 +81,38 @@ private:
    */
   void addExtractor(TagExtractorPtr extractor);
 
+  /**
+   * Adds a token-based extractor, taking ownership and merging its pattern
+   * into the token-trie.
+   * @param extractor the token-based extractor to add.
+   */
+  void addExtractor(std::unique_ptr<TagExtractorTokensImpl> extractor);
+
+  /**
+   * Records the extractor's tag name in extractor_map_ so that duplicate tag
+   * names can be elided during extraction.
+   * @param extractor TagExtractor& the extractor being added.
+   */
+  void recordExtractorName(TagExtractor& extractor);
+
+  /**
+   * Recursively walks the token-trie against the stat-name's tokens, appending
+   * a TokensMatch for the first match found for each extractor. "**" expansions
+   * are tried shortest-first, so each extractor matches at the same position
+   * that its own extractTag search would find.
+   *
+   * @param node the trie node to walk from.
+   * @param tokens the '.'-separated tokens of the stat name.
+   * @param input_index the index of the next token to match.
+   * @param char_index the character offset of that token within the stat name.
+   * @param capture_index the token-index captured by "$" on the path so far.
+   * @param capture_start the character offset of the captured token.
+   * @param matches the accumulated matches.
+   */
+  void matchTokensTrie(const TokensTrieNode& node, const std::vector<absl::string_view>& tokens,
+                       uint32_t input_index, uint32_t char_index, uint32_t capture_index,
+                       uint32_t capture_start, std::vector<TokensMatch>& matches) const;
+
   /**
    * Adds all default extractors matching the specified tag name. In this model,
    * more than one TagExtractor can be used to generate a given tag. The default
@@ -84,21 +144,29 @@ private:
    *   2. Collecting the TagExtractors whose regexes have that same prefix "^prefix\\."
    *   3. Collecting also the TagExtractors whose regexes don't start with any prefix.
    * In the future, we may also do substring searches in some cases.
-   * See DefaultTagRegexTester::produceTagsReverse in test/common/stats/stats_impl_test.cc.
+   * See DefaultTagRegexTester::produceTagsReverse in test/common/stats/tag_extractor_impl_test.cc.
+   *
+   * Note that produceTags does not use this helper for the token-based
+   * extractors; those are matched in one pass through the token-trie instead.
    *
    * @param stat_name const std::string& the stat name.
-   * @param f std::function<void(const TagExtractorPtr&)> function to call for each extractor.
+   * @param f std::function<void(const TagExtractor&)> function to call for each extractor.
    */
   void forEachExtractorMatching(absl::string_view stat_name,
-                                std::function<void(const TagExtractorPtr&)> f) const;
+                                std::function<void(const TagExtractor&)> f) const;
 
   std::vector<TagExtractorPtr> tag_extractors_without_prefix_;
 
   // Maps a prefix word extracted out of a regex to a vector of TagExtractors. Note that
   // the storage for the prefix string is owned by the TagExtractor, which, depending on
-  // implementation, may need make a copy of the prefix.
+  // implementation, may need make a copy of the prefix. Token-based extractors
+  // are not dispatched through this map; they are owned by tokens_extractors_
+  // and matched via the token-trie.
   absl::flat_hash_map<absl::string_view, std::vector<TagExtractorPtr>> tag_extractor_prefix_map_;
 
+  std::vector<std::unique_ptr<TagExtractorTokensImpl>> tokens_extractors_;
+  TokensTrieNode tokens_trie_root_;
+
   // Keep track of which names have extractors. If an extractor is added and there's
   // already one for that name, we set a bit in the extractor so we can decide whether
   // we need do elide duplicate extractors during extraction. It is not valid to
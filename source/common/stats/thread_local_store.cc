@@ -1,5 +1,6 @@
 #include "source/common/stats/thread_local_store.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <list>
@@ -33,7 +34,8 @@ ThreadLocalStoreImpl::ThreadLocalStoreImpl(Allocator& alloc)
       histogram_settings_(std::make_unique<HistogramSettingsImpl>()),
       null_counter_(alloc.symbolTable()), null_gauge_(alloc.symbolTable()),
       null_histogram_(alloc.symbolTable()), null_text_readout_(alloc.symbolTable()),
-      well_known_tags_(alloc.symbolTable().makeSet("well_known_tags")) {
+      well_known_tags_(alloc.symbolTable().makeSet("well_known_tags")),
+      histogram_families_(StatNameLessThan(alloc.constSymbolTable())) {
   for (const auto& desc : Config::TagNames::get().descriptorVec()) {
     well_known_tags_->rememberBuiltin(desc.name_);
   }
@@ -54,7 +56,7 @@ ThreadLocalStoreImpl::~ThreadLocalStoreImpl() {
 
 void ThreadLocalStoreImpl::setHistogramSettings(HistogramSettingsConstPtr&& histogram_settings) {
   iterateScopes([](const ScopeImplSharedPtr& scope) -> bool {
-    ASSERT(scope->centralCacheLockHeld()->histograms_.empty());
+    ASSERT(scope->centralCache()->histograms_.empty());
     return true;
   });
   histogram_settings_ = std::move(histogram_settings);
@@ -74,7 +76,8 @@ void ThreadLocalStoreImpl::setStatsMatcher(StatsMatcherPtr&& stats_matcher) {
   const uint32_t first_histogram_index = deleted_histograms_.size();
   iterateScopesLockHeld([this](const ScopeImplSharedPtr& scope) ABSL_EXCLUSIVE_LOCKS_REQUIRED(
                             lock_) -> bool {
-    const CentralCacheEntrySharedPtr& central_cache = scope->centralCacheLockHeld();
+    const CentralCacheEntrySharedPtr& central_cache = scope->centralCache();
+    Thread::LockGuard cache_lock(central_cache->mutex_);
     removeRejectedStats<CounterSharedPtr>(central_cache->counters_,
                                           [this](const CounterSharedPtr& counter) mutable {
                                             alloc_.markCounterForDeletion(counter);
@@ -97,6 +100,8 @@ void ThreadLocalStoreImpl::setStatsMatcher(StatsMatcherPtr&& stats_matcher) {
       uint32_t erased = histogram_set_.erase(deleted_histograms_[i].get());
       ASSERT(erased == 1);
       sinked_histograms_.erase(deleted_histograms_[i].get());
+      removeHistogramFromFamiliesLockHeld(
+          *static_cast<ParentHistogramImpl*>(deleted_histograms_[i].get()));
     }
   }
 }
@@ -228,6 +233,7 @@ void ThreadLocalStoreImpl::shutdownThreading() {
   }
   histogram_set_.clear();
   sinked_histograms_.clear();
+  histogram_families_.clear();
 }
 
 void ThreadLocalStoreImpl::mergeHistograms(PostMergeCb merge_complete_cb) {
@@ -297,7 +303,7 @@ void ThreadLocalStoreImpl::releaseScopeCrossThread(ScopeImpl* scope) {
     // VirtualHosts.
     bool need_post = scopes_to_cleanup_.empty();
     scopes_to_cleanup_.push_back(scope->scope_id_);
-    central_cache_entries_to_cleanup_.push_back(scope->centralCacheLockHeld());
+    central_cache_entries_to_cleanup_.push_back(scope->centralCache());
     lock.release();
 
     if (need_post) {
@@ -482,7 +488,7 @@ bool ThreadLocalStoreImpl::checkAndRememberRejection(StatName name,
 template <class StatType>
 StatType& ThreadLocalStoreImpl::ScopeImpl::safeMakeStat(
     StatName full_stat_name, StatName name_no_tags,
-    const absl::optional<StatNameTagVector>& stat_name_tags,
+    const absl::optional<StatNameTagVector>& stat_name_tags, CentralCacheEntry& central_cache,
     StatNameHashMap<RefcountPtr<StatType>>& central_cache_map,
     StatsMatcher::FastResult fast_reject_result, StatNameStorageSet& central_rejected_stats,
     MakeStatFn<StatType> make_stat, StatRefMap<StatType>* tls_cache,
@@ -503,7 +509,9 @@ StatType& ThreadLocalStoreImpl::ScopeImpl::safeMakeStat(
 
   // We must now look in the central store so we must be locked. We grab a reference to the
   // central store location. It might contain nothing. In this case, we allocate a new stat.
-  Thread::LockGuard lock(parent_.lock_);
+  // Only the owning scope's central-cache mutex is taken, so misses in other scopes and
+  // store-wide bookkeeping under lock_ are not blocked.
+  Thread::LockGuard lock(central_cache.mutex_);
   auto iter = central_cache_map.find(full_stat_name);
   RefcountPtr<StatType>* central_ref = nullptr;
   if (iter != central_cache_map.end()) {
@@ -556,10 +564,10 @@ Counter& ThreadLocalStoreImpl::ScopeImpl::counterFromStatNameWithTags(
     tls_rejected_stats = &entry.rejected_stats_;
   }
 
-  const CentralCacheEntrySharedPtr& central_cache = centralCacheNoThreadAnalysis();
+  const CentralCacheEntrySharedPtr& central_cache = centralCache();
   return safeMakeStat<Counter>(
-      final_stat_name, joiner.tagExtractedName(), stat_name_tags, central_cache->counters_,
-      fast_reject_result, central_cache->rejected_stats_,
+      final_stat_name, joiner.tagExtractedName(), stat_name_tags, *central_cache,
+      central_cache->counters_, fast_reject_result, central_cache->rejected_stats_,
       [](Allocator& allocator, StatName name, StatName tag_extracted_name,
          const StatNameTagVector& tags) -> CounterSharedPtr {
         return allocator.makeCounter(name, tag_extracted_name, tags);
@@ -607,10 +615,10 @@ Gauge& ThreadLocalStoreImpl::ScopeImpl::gaugeFromStatNameWithTags(
     tls_rejected_stats = &entry.rejected_stats_;
   }
 
-  const CentralCacheEntrySharedPtr& central_cache = centralCacheNoThreadAnalysis();
+  const CentralCacheEntrySharedPtr& central_cache = centralCache();
   Gauge& gauge = safeMakeStat<Gauge>(
-      final_stat_name, joiner.tagExtractedName(), stat_name_tags, central_cache->gauges_,
-      fast_reject_result, central_cache->rejected_stats_,
+      final_stat_name, joiner.tagExtractedName(), stat_name_tags, *central_cache,
+      central_cache->gauges_, fast_reject_result, central_cache->rejected_stats_,
       [import_mode](Allocator& allocator, StatName name, StatName tag_extracted_name,
                     const StatNameTagVector& tags) -> GaugeSharedPtr {
         return allocator.makeGauge(name, tag_extracted_name, tags, import_mode);
@@ -653,8 +661,8 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
     }
   }
 
-  Thread::LockGuard lock(parent_.lock_);
-  const CentralCacheEntrySharedPtr& central_cache = centralCacheNoThreadAnalysis();
+  const CentralCacheEntrySharedPtr& central_cache = centralCache();
+  Thread::LockGuard lock(central_cache->mutex_);
   auto iter = central_cache->histograms_.find(final_stat_name);
   ParentHistogramImplSharedPtr* central_ref = nullptr;
   if (iter != central_cache->histograms_.end()) {
@@ -678,9 +686,11 @@ Histogram& ThreadLocalStoreImpl::ScopeImpl::histogramFromStatNameWithTags(
       } else {
         stat = new ParentHistogramImpl(final_stat_name, unit, parent_,
                                        tag_helper.tagExtractedName(), tag_helper.statNameTags(),
-                                       *buckets, parent_.next_histogram_id_++);
+                                       *buckets, parent_.histogram_settings_->useFixedLayout(),
+                                       parent_.next_histogram_id_++);
         if (!parent_.shutting_down_) {
           parent_.histogram_set_.insert(stat.get());
+          parent_.addHistogramToFamiliesLockHeld(*stat);
           if (parent_.sink_predicates_.has_value() &&
               parent_.sink_predicates_->includeHistogram(*stat)) {
             parent_.sinked_histograms_.insert(stat.get());
@@ -724,10 +734,10 @@ TextReadout& ThreadLocalStoreImpl::ScopeImpl::textReadoutFromStatNameWithTags(
     tls_rejected_stats = &entry.rejected_stats_;
   }
 
-  const CentralCacheEntrySharedPtr& central_cache = centralCacheNoThreadAnalysis();
+  const CentralCacheEntrySharedPtr& central_cache = centralCache();
   return safeMakeStat<TextReadout>(
-      final_stat_name, joiner.tagExtractedName(), stat_name_tags, central_cache->text_readouts_,
-      fast_reject_result, central_cache->rejected_stats_,
+      final_stat_name, joiner.tagExtractedName(), stat_name_tags, *central_cache,
+      central_cache->text_readouts_, fast_reject_result, central_cache->rejected_stats_,
       [](Allocator& allocator, StatName name, StatName tag_extracted_name,
          const StatNameTagVector& tags) -> TextReadoutSharedPtr {
         return allocator.makeTextReadout(name, tag_extracted_name, tags);
@@ -736,22 +746,21 @@ TextReadout& ThreadLocalStoreImpl::ScopeImpl::textReadoutFromStatNameWithTags(
 }
 
 CounterOptConstRef ThreadLocalStoreImpl::ScopeImpl::findCounter(StatName name) const {
-  Thread::LockGuard lock(parent_.lock_);
+  Thread::LockGuard lock(central_cache_->mutex_);
   return findStatLockHeld<Counter>(name, central_cache_->counters_);
 }
 
 GaugeOptConstRef ThreadLocalStoreImpl::ScopeImpl::findGauge(StatName name) const {
-  Thread::LockGuard lock(parent_.lock_);
+  Thread::LockGuard lock(central_cache_->mutex_);
   return findStatLockHeld<Gauge>(name, central_cache_->gauges_);
 }
 
 HistogramOptConstRef ThreadLocalStoreImpl::ScopeImpl::findHistogram(StatName name) const {
-  Thread::LockGuard lock(parent_.lock_);
+  Thread::LockGuard lock(central_cache_->mutex_);
   return findHistogramLockHeld(name);
 }
 
-HistogramOptConstRef ThreadLocalStoreImpl::ScopeImpl::findHistogramLockHeld(StatName name) const
-    ABSL_EXCLUSIVE_LOCKS_REQUIRED(parent_.lock_) {
+HistogramOptConstRef ThreadLocalStoreImpl::ScopeImpl::findHistogramLockHeld(StatName name) const {
   auto iter = central_cache_->histograms_.find(name);
   if (iter == central_cache_->histograms_.end()) {
     return absl::nullopt;
@@ -762,7 +771,7 @@ HistogramOptConstRef ThreadLocalStoreImpl::ScopeImpl::findHistogramLockHeld(Stat
 }
 
 TextReadoutOptConstRef ThreadLocalStoreImpl::ScopeImpl::findTextReadout(StatName name) const {
-  Thread::LockGuard lock(parent_.lock_);
+  Thread::LockGuard lock(central_cache_->mutex_);
   return findStatLockHeld<TextReadout>(name, central_cache_->text_readouts_);
 }
 
@@ -785,7 +794,8 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 
   TlsHistogramSharedPtr hist_tls_ptr(
       new ThreadLocalHistogramImpl(parent.statName(), parent.unit(), tag_helper.tagExtractedName(),
-                                   tag_helper.statNameTags(), symbolTable()));
+                                   tag_helper.statNameTags(), symbolTable(),
+                                   parent.usesFixedLayout()));
 
   parent.addTlsHistogram(hist_tls_ptr);
 
@@ -799,23 +809,38 @@ Histogram& ThreadLocalStoreImpl::tlsHistogram(ParentHistogramImpl& parent, uint6
 ThreadLocalHistogramImpl::ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit,
                                                    StatName tag_extracted_name,
                                                    const StatNameTagVector& stat_name_tags,
-                                                   SymbolTable& symbol_table)
+                                                   SymbolTable& symbol_table,
+                                                   bool use_fixed_layout)
     : HistogramImplHelper(name, tag_extracted_name, stat_name_tags, symbol_table), unit_(unit),
       current_active_(0), used_(false), created_thread_id_(std::this_thread::get_id()),
       symbol_table_(symbol_table) {
-  histograms_[0] = hist_alloc();
-  histograms_[1] = hist_alloc();
+  if (use_fixed_layout) {
+    histograms_[0] = nullptr;
+    histograms_[1] = nullptr;
+    fixed_histograms_[0] = std::make_unique<FixedLayoutHistogram>();
+    fixed_histograms_[1] = std::make_unique<FixedLayoutHistogram>();
+  } else {
+    histograms_[0] = hist_alloc();
+    histograms_[1] = hist_alloc();
+  }
 }
 
 ThreadLocalHistogramImpl::~ThreadLocalHistogramImpl() {
   MetricImpl::clear(symbol_table_);
-  hist_free(histograms_[0]);
-  hist_free(histograms_[1]);
+  if (histograms_[0] != nullptr) {
+    hist_free(histograms_[0]);
+    hist_free(histograms_[1]);
+  }
 }
 
 void ThreadLocalHistogramImpl::recordValue(uint64_t value) {
   ASSERT(std::this_thread::get_id() == created_thread_id_);
-  hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  if (fixed_histograms_[0] != nullptr) {
+    fixed_histograms_[current_active_]->recordValue(value);
+  } else {
+    hist_insert_intscale(histograms_[current_active_], value, 0, 1);
+  }
+  active_histogram_dirty_ = true;
   used_ = true;
 }
 
@@ -823,26 +848,39 @@ void ThreadLocalHistogramImpl::merge(histogram_t* target) {
   histogram_t** other_histogram = &histograms_[otherHistogramIndex()];
   hist_accumulate(target, other_histogram, 1);
   hist_clear(*other_histogram);
+  other_histogram_dirty_ = false;
+}
+
+void ThreadLocalHistogramImpl::merge(FixedLayoutHistogram& target) {
+  FixedLayoutHistogram& other_histogram = *fixed_histograms_[otherHistogramIndex()];
+  target.merge(other_histogram);
+  other_histogram.clear();
+  other_histogram_dirty_ = false;
 }
 
 ParentHistogramImpl::ParentHistogramImpl(StatName name, Histogram::Unit unit,
                                          ThreadLocalStoreImpl& thread_local_store,
                                          StatName tag_extracted_name,
                                          const StatNameTagVector& stat_name_tags,
-                                         ConstSupportedBuckets& supported_buckets, uint64_t id)
+                                         ConstSupportedBuckets& supported_buckets,
+                                         bool use_fixed_layout, uint64_t id)
     : MetricImpl(name, tag_extracted_name, stat_name_tags, thread_local_store.symbolTable()),
-      unit_(unit), thread_local_store_(thread_local_store), interval_histogram_(hist_alloc()),
-      cumulative_histogram_(hist_alloc()),
-      interval_statistics_(interval_histogram_, unit, supported_buckets),
-      cumulative_statistics_(cumulative_histogram_, unit, supported_buckets), merged_(false),
-      id_(id) {}
+      unit_(unit), thread_local_store_(thread_local_store), use_fixed_layout_(use_fixed_layout),
+      interval_histogram_(use_fixed_layout ? nullptr : hist_alloc()),
+      cumulative_histogram_(use_fixed_layout ? nullptr : hist_alloc()),
+      interval_fixed_(use_fixed_layout ? std::make_unique<FixedLayoutHistogram>() : nullptr),
+      cumulative_fixed_(use_fixed_layout ? std::make_unique<FixedLayoutHistogram>() : nullptr),
+      interval_statistics_(unit, supported_buckets),
+      cumulative_statistics_(unit, supported_buckets), merged_(false), id_(id) {}
 
 ParentHistogramImpl::~ParentHistogramImpl() {
   thread_local_store_.releaseHistogramCrossThread(id_);
   ASSERT(ref_count_ == 0);
   MetricImpl::clear(thread_local_store_.symbolTable());
-  hist_free(interval_histogram_);
-  hist_free(cumulative_histogram_);
+  if (!use_fixed_layout_) {
+    hist_free(interval_histogram_);
+    hist_free(cumulative_histogram_);
+  }
 }
 
 void ParentHistogramImpl::incRefCount() { ++ref_count_; }
@@ -885,6 +923,7 @@ bool ThreadLocalStoreImpl::decHistogramRefCount(ParentHistogramImpl& hist,
       const size_t count = histogram_set_.erase(hist.statName());
       ASSERT(shutting_down_ || count == 1);
       sinked_histograms_.erase(&hist);
+      removeHistogramFromFamiliesLockHeld(hist);
     }
     return true;
   }
@@ -908,20 +947,50 @@ bool ParentHistogramImpl::used() const {
 
 void ParentHistogramImpl::merge() {
   Thread::ReleasableLockGuard lock(merge_lock_);
+  if (merged_ && !needsMergeLockHeld()) {
+    lock.release();
+    // No worker has recorded a value into this histogram since the last merge,
+    // so the cumulative statistics are already up to date; we only need to
+    // empty the interval statistics, and only if the previous interval had
+    // samples. This keeps the periodic flush cheap for the common case of
+    // large numbers of histograms that are written sporadically.
+    if (interval_statistics_.sampleCount() != 0) {
+      if (use_fixed_layout_) {
+        interval_fixed_->clear();
+        interval_statistics_.refresh(*interval_fixed_);
+      } else {
+        hist_clear(interval_histogram_);
+        interval_statistics_.refresh(interval_histogram_);
+      }
+    }
+    return;
+  }
   if (merged_ || usedLockHeld()) {
-    hist_clear(interval_histogram_);
     // Here we could copy all the pointers to TLS histograms in the tls_histogram_ list,
     // then release the lock before we do the actual merge. However it is not a big deal
     // because the tls_histogram merge is not that expensive as it is a single histogram
     // merge and adding TLS histograms is rare.
-    for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
-      tls_histogram->merge(interval_histogram_);
+    if (use_fixed_layout_) {
+      interval_fixed_->clear();
+      for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+        tls_histogram->merge(*interval_fixed_);
+      }
+      // Since TLS merge is done, we can release the lock here.
+      lock.release();
+      cumulative_fixed_->merge(*interval_fixed_);
+      cumulative_statistics_.refresh(*cumulative_fixed_);
+      interval_statistics_.refresh(*interval_fixed_);
+    } else {
+      hist_clear(interval_histogram_);
+      for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+        tls_histogram->merge(interval_histogram_);
+      }
+      // Since TLS merge is done, we can release the lock here.
+      lock.release();
+      hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
+      cumulative_statistics_.refresh(cumulative_histogram_);
+      interval_statistics_.refresh(interval_histogram_);
     }
-    // Since TLS merge is done, we can release the lock here.
-    lock.release();
-    hist_accumulate(cumulative_histogram_, &interval_histogram_, 1);
-    cumulative_statistics_.refresh(cumulative_histogram_);
-    interval_statistics_.refresh(interval_histogram_);
     merged_ = true;
   }
 }
@@ -972,6 +1041,15 @@ bool ParentHistogramImpl::usedLockHeld() const {
   return false;
 }
 
+bool ParentHistogramImpl::needsMergeLockHeld() const {
+  for (const TlsHistogramSharedPtr& tls_histogram : tls_histograms_) {
+    if (tls_histogram->needsMerge()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void ThreadLocalStoreImpl::forEachCounter(SizeFn f_size, StatFn<Counter> f_stat) const {
   alloc_.forEachCounter(f_size, f_stat);
 }
@@ -994,6 +1072,62 @@ void ThreadLocalStoreImpl::forEachHistogram(SizeFn f_size, StatFn<ParentHistogra
   }
 }
 
+void ThreadLocalStoreImpl::addHistogramToFamiliesLockHeld(ParentHistogramImpl& histogram) {
+  std::vector<ParentHistogramImpl*>& members =
+      histogram_families_.try_emplace(histogram.tagExtractedStatName()).first->second;
+  const auto pos =
+      std::lower_bound(members.begin(), members.end(), &histogram,
+                       [this](const ParentHistogramImpl* a, const ParentHistogramImpl* b) {
+                         return constSymbolTable().lessThan(a->statName(), b->statName());
+                       });
+  members.insert(pos, &histogram);
+}
+
+void ThreadLocalStoreImpl::removeHistogramFromFamiliesLockHeld(ParentHistogramImpl& histogram) {
+  auto family = histogram_families_.find(histogram.tagExtractedStatName());
+  if (family == histogram_families_.end()) {
+    return;
+  }
+  std::vector<ParentHistogramImpl*>& members = family->second;
+  const auto pos = std::find(members.begin(), members.end(), &histogram);
+  if (pos == members.end()) {
+    // Already removed from the index when the histogram was rejected by a
+    // late-arriving stats matcher; see setStatsMatcher.
+    return;
+  }
+  members.erase(pos);
+  if (members.empty()) {
+    histogram_families_.erase(family);
+    return;
+  }
+  // The map key may reference symbol storage owned by the histogram being
+  // removed, so re-key the family from a surviving member.
+  auto node = histogram_families_.extract(family);
+  node.key() = node.mapped().front()->tagExtractedStatName();
+  histogram_families_.insert(std::move(node));
+}
+
+void ThreadLocalStoreImpl::forEachHistogramFamily(
+    const FamilyIterateFn<ParentHistogram>& fn) const {
+  // As in AllocatorImpl::forEachCounterFamily, pin every family member under
+  // the lock and run the callbacks after releasing it: releasing a pinned
+  // reference re-acquires hist_mutex_ via decHistogramRefCount.
+  std::vector<std::vector<ParentHistogramSharedPtr>> snapshot;
+  {
+    Thread::LockGuard lock(hist_mutex_);
+    snapshot.reserve(histogram_families_.size());
+    for (const auto& family : histogram_families_) {
+      snapshot.emplace_back(family.second.begin(), family.second.end());
+    }
+  }
+  for (const std::vector<ParentHistogramSharedPtr>& members : snapshot) {
+    ASSERT(!members.empty());
+    if (!fn(members.front()->tagExtractedStatName(), members)) {
+      return;
+    }
+  }
+}
+
 void ThreadLocalStoreImpl::forEachScope(std::function<void(std::size_t)> f_size,
                                         StatFn<const Scope> f_scope) const {
   std::vector<ScopeSharedPtr> scopes;
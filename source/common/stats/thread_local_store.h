@@ -4,6 +4,7 @@
 #include <chrono>
 #include <cstdint>
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 
@@ -34,10 +35,12 @@ namespace Stats {
 class ThreadLocalHistogramImpl : public HistogramImplHelper {
 public:
   ThreadLocalHistogramImpl(StatName name, Histogram::Unit unit, StatName tag_extracted_name,
-                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table);
+                           const StatNameTagVector& stat_name_tags, SymbolTable& symbol_table,
+                           bool use_fixed_layout);
   ~ThreadLocalHistogramImpl() override;
 
   void merge(histogram_t* target);
+  void merge(FixedLayoutHistogram& target);
 
   /**
    * Called in the beginning of merge process. Swaps the histogram used for collection so that we do
@@ -47,8 +50,21 @@ public:
     // This switches the current_active_ between 1 and 0.
     ASSERT(std::this_thread::get_id() == created_thread_id_);
     current_active_ = otherHistogramIndex();
+    // Latch whether the histogram being handed off to the merge has unmerged
+    // values. recordValue() calls from here on land in the newly active
+    // histogram and are picked up by the next merge cycle.
+    other_histogram_dirty_ = active_histogram_dirty_;
+    active_histogram_dirty_ = false;
   }
 
+  /**
+   * @return whether the inactive histogram holds values that have not yet been
+   * merged into the parent. Like current_active_, the dirty flags are written
+   * only by the owning thread; reading this from the main thread is safe only
+   * during the merge process, after all workers have completed beginMerge().
+   */
+  bool needsMerge() const { return other_histogram_dirty_; }
+
   // Stats::Histogram
   Histogram::Unit unit() const override {
     // If at some point ThreadLocalHistogramImpl will hold a pointer to its parent we can just
@@ -65,7 +81,15 @@ private:
   Histogram::Unit unit_;
   uint64_t otherHistogramIndex() const { return 1 - current_active_; }
   uint64_t current_active_;
+  // Exactly one backend is populated, chosen at construction to match the
+  // parent histogram; see HistogramSettings::useFixedLayout().
   histogram_t* histograms_[2];
+  std::unique_ptr<FixedLayoutHistogram> fixed_histograms_[2];
+  // Whether the active (respectively inactive) histogram has values that have
+  // not yet been merged into the parent. These let the merge process skip
+  // histograms that have not been written since the last flush.
+  bool active_histogram_dirty_{false};
+  bool other_histogram_dirty_{false};
   std::atomic<bool> used_;
   std::thread::id created_thread_id_;
   SymbolTable& symbol_table_;
@@ -82,11 +106,16 @@ class ParentHistogramImpl : public MetricImpl<ParentHistogram> {
 public:
   ParentHistogramImpl(StatName name, Histogram::Unit unit, ThreadLocalStoreImpl& parent,
                       StatName tag_extracted_name, const StatNameTagVector& stat_name_tags,
-                      ConstSupportedBuckets& supported_buckets, uint64_t id);
+                      ConstSupportedBuckets& supported_buckets, bool use_fixed_layout,
+                      uint64_t id);
   ~ParentHistogramImpl() override;
 
   void addTlsHistogram(const TlsHistogramSharedPtr& hist_ptr);
 
+  // Whether this histogram (and the TLS histograms feeding it) uses the
+  // fixed-layout backend rather than circllhist.
+  bool usesFixedLayout() const { return use_fixed_layout_; }
+
   // Stats::Histogram
   Histogram::Unit unit() const override;
   void recordValue(uint64_t value) override;
@@ -121,11 +150,16 @@ public:
 
 private:
   bool usedLockHeld() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(merge_lock_);
+  bool needsMergeLockHeld() const ABSL_EXCLUSIVE_LOCKS_REQUIRED(merge_lock_);
 
   Histogram::Unit unit_;
   ThreadLocalStoreImpl& thread_local_store_;
+  const bool use_fixed_layout_;
+  // Exactly one backend pair is populated, per use_fixed_layout_.
   histogram_t* interval_histogram_;
   histogram_t* cumulative_histogram_;
+  std::unique_ptr<FixedLayoutHistogram> interval_fixed_;
+  std::unique_ptr<FixedLayoutHistogram> cumulative_fixed_;
   HistogramStatisticsImpl interval_statistics_;
   HistogramStatisticsImpl cumulative_statistics_;
   mutable Thread::MutexBasicLockable merge_lock_;
@@ -174,6 +208,17 @@ public:
   void forEachHistogram(SizeFn f_size, StatFn<ParentHistogram> f_stat) const override;
   void forEachScope(SizeFn f_size, StatFn<const Scope> f_stat) const override;
 
+  void forEachCounterFamily(const FamilyIterateFn<Counter>& fn) const override {
+    alloc_.forEachCounterFamily(fn);
+  }
+  void forEachGaugeFamily(const FamilyIterateFn<Gauge>& fn) const override {
+    alloc_.forEachGaugeFamily(fn);
+  }
+  void forEachTextReadoutFamily(const FamilyIterateFn<TextReadout>& fn) const override {
+    alloc_.forEachTextReadoutFamily(fn);
+  }
+  void forEachHistogramFamily(const FamilyIterateFn<ParentHistogram>& fn) const override;
+
   // Stats::StoreRoot
   void addSink(Sink& sink) override { timer_sinks_.push_back(sink); }
   void setTagProducer(TagProducerPtr&& tag_producer) override {
@@ -253,6 +298,14 @@ private:
     explicit CentralCacheEntry(SymbolTable& symbol_table) : symbol_table_(symbol_table) {}
     ~CentralCacheEntry();
 
+    // Guards the stat maps and the rejected-stat set below. Each scope's
+    // central cache has its own mutex so that TLS-cache misses in one scope
+    // (e.g. per-cluster stat creation during CDS churn) do not contend with
+    // misses in other scopes, or with scope bookkeeping done under the
+    // store-wide lock_. Lock ordering: when held together with lock_ this
+    // mutex is acquired second; when held together with hist_mutex_ it is
+    // acquired first.
+    mutable Thread::MutexBasicLockable mutex_;
     StatNameHashMap<CounterSharedPtr> counters_;
     StatNameHashMap<GaugeSharedPtr> gauges_;
     StatNameHashMap<ParentHistogramImplSharedPtr> histograms_;
@@ -309,33 +362,20 @@ private:
     }
 
     bool iterate(const IterateFn<Counter>& fn) const override {
-      Thread::LockGuard lock(parent_.lock_);
-      return iterateLockHeld(fn);
+      Thread::LockGuard lock(central_cache_->mutex_);
+      return iterHelper(fn, central_cache_->counters_);
     }
     bool iterate(const IterateFn<Gauge>& fn) const override {
-      Thread::LockGuard lock(parent_.lock_);
-      return iterateLockHeld(fn);
+      Thread::LockGuard lock(central_cache_->mutex_);
+      return iterHelper(fn, central_cache_->gauges_);
     }
     bool iterate(const IterateFn<Histogram>& fn) const override {
-      Thread::LockGuard lock(parent_.lock_);
-      return iterateLockHeld(fn);
+      Thread::LockGuard lock(central_cache_->mutex_);
+      return iterHelper(fn, central_cache_->histograms_);
     }
     bool iterate(const IterateFn<TextReadout>& fn) const override {
-      Thread::LockGuard lock(parent_.lock_);
-      return iterateLockHeld(fn);
-    }
-
-    bool iterateLockHeld(const IterateFn<Counter>& fn) const {
-      return iterHelper(fn, centralCacheLockHeld()->counters_);
-    }
-    bool iterateLockHeld(const IterateFn<Gauge>& fn) const {
-      return iterHelper(fn, centralCacheLockHeld()->gauges_);
-    }
-    bool iterateLockHeld(const IterateFn<Histogram>& fn) const {
-      return iterHelper(fn, centralCacheLockHeld()->histograms_);
-    }
-    bool iterateLockHeld(const IterateFn<TextReadout>& fn) const {
-      return iterHelper(fn, centralCacheLockHeld()->text_readouts_);
+      Thread::LockGuard lock(central_cache_->mutex_);
+      return iterHelper(fn, central_cache_->text_readouts_);
     }
     ThreadLocalStoreImpl& store() override { return parent_; }
     const ThreadLocalStoreImpl& constStore() const override { return parent_; }
@@ -361,6 +401,7 @@ private:
      * @param full_stat_name the full name of the stat with appended tags.
      * @param name_no_tags the full name of the stat (not tag extracted) without appended tags.
      * @param stat_name_tags the tags provided at creation time. If empty, tag extraction occurs.
+     * @param central_cache the scope's central cache entry; its mutex is taken on a TLS miss.
      * @param central_cache_map a map from name to the desired object in the central cache.
      * @param make_stat a function to generate the stat object, called if it's not in cache.
      * @param tls_ref possibly null reference to a cache entry for this stat, which will be
@@ -369,6 +410,7 @@ private:
     template <class StatType>
     StatType& safeMakeStat(StatName full_stat_name, StatName name_no_tags,
                            const absl::optional<StatNameTagVector>& stat_name_tags,
+                           CentralCacheEntry& central_cache,
                            StatNameHashMap<RefcountPtr<StatType>>& central_cache_map,
                            StatsMatcher::FastResult fast_reject_result,
                            StatNameStorageSet& central_rejected_stats,
@@ -401,32 +443,17 @@ private:
 
     StatName prefix() const override { return prefix_.statName(); }
 
-    // Returns the central cache, asserting that the parent lock is held.
-    //
-    // When a ThreadLocalStore method takes lock_ and then accesses
-    // scope->central_cache_, the analysis system cannot understand that the
-    // scope's parent_.lock_ is held, so we assert that here.
-    const CentralCacheEntrySharedPtr& centralCacheLockHeld() const
-        ABSL_ASSERT_EXCLUSIVE_LOCK(parent_.lock_) {
-      return central_cache_;
-    }
-
-    // Returns the central cache, bypassing thread analysis.
-    //
-    // This is used only when passing references to maps held in the central
-    // cache to safeMakeStat, which takes the lock only if those maps are
-    // actually referenced, due to the lookup missing the TLS cache.
-    const CentralCacheEntrySharedPtr&
-    centralCacheNoThreadAnalysis() const ABSL_NO_THREAD_SAFETY_ANALYSIS {
-      return central_cache_;
-    }
+    // Returns the central cache. The pointer itself is immutable after
+    // construction, so it can be read from any thread; the maps inside are
+    // guarded by central_cache_->mutex_.
+    const CentralCacheEntrySharedPtr& centralCache() const { return central_cache_; }
 
     const uint64_t scope_id_;
     ThreadLocalStoreImpl& parent_;
 
   private:
     StatNameStorage prefix_;
-    mutable CentralCacheEntrySharedPtr central_cache_ ABSL_GUARDED_BY(parent_.lock_);
+    const CentralCacheEntrySharedPtr central_cache_;
   };
 
   struct TlsCache : public ThreadLocal::ThreadLocalObject {
@@ -465,15 +492,21 @@ private:
   bool iterateScopesLockHeld(const std::function<bool(const ScopeImplSharedPtr&)> fn) const
       ABSL_EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
-  // The Store versions of iterate cover all the scopes in the store.
+  // The Store versions of iterate cover all the scopes in the store. lock_ is
+  // held only to pin the scope list; each scope takes its own central-cache
+  // mutex while its maps are scanned.
   template <class StatFn> bool iterHelper(StatFn fn) const {
     return iterateScopes(
-        [fn](const ScopeImplSharedPtr& scope) -> bool { return scope->iterateLockHeld(fn); });
+        [fn](const ScopeImplSharedPtr& scope) -> bool { return scope->iterate(fn); });
   }
 
   std::string getTagsForName(const std::string& name, TagVector& tags) const;
   void clearScopesFromCaches();
   void clearHistogramsFromCaches();
+  void addHistogramToFamiliesLockHeld(ParentHistogramImpl& histogram)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(hist_mutex_);
+  void removeHistogramFromFamiliesLockHeld(ParentHistogramImpl& histogram)
+      ABSL_EXCLUSIVE_LOCKS_REQUIRED(hist_mutex_);
   void releaseScopeCrossThread(ScopeImpl* scope);
   void mergeInternal(PostMergeCb merge_cb);
   bool slowRejects(StatsMatcher::FastResult fast_reject_result, StatName name) const;
@@ -523,6 +556,15 @@ private:
   StatSet<ParentHistogramImpl> histogram_set_ ABSL_GUARDED_BY(hist_mutex_);
   StatSet<ParentHistogramImpl> sinked_histograms_ ABSL_GUARDED_BY(hist_mutex_);
 
+  // Index of histogram families, keyed by tag-extracted name, with each
+  // family's members kept sorted by full stat name. Maintained incrementally
+  // alongside histogram_set_ so that forEachHistogramFamily can walk a
+  // prebuilt, already-ordered structure; the counter/gauge/text-readout
+  // equivalents live in AllocatorImpl. The key references symbol storage owned
+  // by the family's first member, and is re-keyed when that member is removed.
+  std::map<StatName, std::vector<ParentHistogramImpl*>, StatNameLessThan>
+      histogram_families_ ABSL_GUARDED_BY(hist_mutex_);
+
   // Retain storage for deleted stats; these are no longer in maps because the
   // matcher-pattern was established after they were created. Since the stats
   // are held by reference in code that expects them to be there, we can't
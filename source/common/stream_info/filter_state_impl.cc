@@ -28,24 +28,24 @@ void FilterStateImpl::setData(absl::string_view data_name, std::shared_ptr<Objec
     // We have another object with same data_name. Check for mutability
     // violations namely: readonly data cannot be overwritten, mutable data
     // cannot be overwritten by readonly data.
-    const FilterStateImpl::FilterObject* current = it->second.get();
-    if (current->state_type_ == FilterState::StateType::ReadOnly) {
+    const FilterStateImpl::FilterObject& current = it->second;
+    if (current.state_type_ == FilterState::StateType::ReadOnly) {
       IS_ENVOY_BUG("FilterStateAccessViolation: FilterState::setData<T> called twice on same "
                    "ReadOnly state.");
       return;
     }
 
-    if (current->state_type_ != state_type) {
+    if (current.state_type_ != state_type) {
       IS_ENVOY_BUG("FilterStateAccessViolation: FilterState::setData<T> called twice with "
                    "different state types.");
       return;
     }
   }
 
-  std::unique_ptr<FilterStateImpl::FilterObject> filter_object(new FilterStateImpl::FilterObject());
-  filter_object->data_ = data;
-  filter_object->state_type_ = state_type;
-  filter_object->stream_sharing_ = stream_sharing;
+  FilterStateImpl::FilterObject filter_object;
+  filter_object.data_ = std::move(data);
+  filter_object.state_type_ = state_type;
+  filter_object.stream_sharing_ = stream_sharing;
   data_storage_[data_name] = std::move(filter_object);
 }
 
@@ -64,8 +64,7 @@ FilterStateImpl::getDataReadOnlyGeneric(absl::string_view data_name) const {
     return nullptr;
   }
 
-  const FilterStateImpl::FilterObject* current = it->second.get();
-  return current->data_.get();
+  return it->second.data_.get();
 }
 
 FilterState::Object* FilterStateImpl::getDataMutableGeneric(absl::string_view data_name) {
@@ -83,14 +82,14 @@ FilterStateImpl::getDataSharedMutableGeneric(absl::string_view data_name) {
     return nullptr;
   }
 
-  FilterStateImpl::FilterObject* current = it->second.get();
-  if (current->state_type_ == FilterState::StateType::ReadOnly) {
+  FilterStateImpl::FilterObject& current = it->second;
+  if (current.state_type_ == FilterState::StateType::ReadOnly) {
     IS_ENVOY_BUG("FilterStateAccessViolation: FilterState accessed immutable data as mutable.");
     // To reduce the chances of a crash, allow the mutation in this case instead of returning a
     // nullptr.
   }
 
-  return current->data_;
+  return current.data_;
 }
 
 bool FilterStateImpl::hasDataAtOrAboveLifeSpan(FilterState::LifeSpan life_span) const {
@@ -104,13 +103,13 @@ FilterState::ObjectsPtr FilterStateImpl::objectsSharedWithUpstreamConnection() c
   auto objects = parent_ ? parent_->objectsSharedWithUpstreamConnection()
                          : std::make_unique<FilterState::Objects>();
   for (const auto& [name, object] : data_storage_) {
-    switch (object->stream_sharing_) {
+    switch (object.stream_sharing_) {
     case StreamSharingMayImpactPooling::SharedWithUpstreamConnection:
-      objects->push_back({object->data_, object->state_type_, object->stream_sharing_, name});
+      objects->push_back({object.data_, object.state_type_, object.stream_sharing_, name});
       break;
     case StreamSharingMayImpactPooling::SharedWithUpstreamConnectionOnce:
       objects->push_back(
-          {object->data_, object->state_type_, StreamSharingMayImpactPooling::None, name});
+          {object.data_, object.state_type_, StreamSharingMayImpactPooling::None, name});
       break;
     default:
       break;
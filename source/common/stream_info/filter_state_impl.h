@@ -63,7 +63,9 @@ private:
   absl::variant<FilterStateSharedPtr, LazyCreateAncestor> ancestor_;
   FilterStateSharedPtr parent_;
   const FilterState::LifeSpan life_span_;
-  absl::flat_hash_map<std::string, std::unique_ptr<FilterObject>> data_storage_;
+  // Objects are stored inline; FilterObject is a small value type and storing it directly avoids
+  // a heap allocation per object and a pointer chase per lookup.
+  absl::flat_hash_map<std::string, FilterObject> data_storage_;
 };
 
 } // namespace StreamInfo
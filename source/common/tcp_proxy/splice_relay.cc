@@ -0,0 +1,165 @@
+#include "source/common/tcp_proxy/splice_relay.h"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Envoy {
+namespace TcpProxy {
+
+namespace {
+// Upper bound for one splice call; the pipe itself is typically 64KB so larger requests simply
+// saturate it.
+constexpr size_t SpliceChunkSize = 1024 * 1024;
+} // namespace
+
+std::unique_ptr<SpliceRelay> SpliceRelay::create(Event::Dispatcher& dispatcher,
+                                                 Network::IoHandle& downstream,
+                                                 Network::IoHandle& upstream,
+                                                 DisengageCb disengage_cb) {
+#if defined(__linux__)
+  std::unique_ptr<SpliceRelay> relay(
+      new SpliceRelay(dispatcher, downstream, upstream, std::move(disengage_cb)));
+  if (!relay->initialize(dispatcher, downstream, upstream)) {
+    return nullptr;
+  }
+  return relay;
+#else
+  UNREFERENCED_PARAMETER(dispatcher);
+  UNREFERENCED_PARAMETER(downstream);
+  UNREFERENCED_PARAMETER(upstream);
+  UNREFERENCED_PARAMETER(disengage_cb);
+  return nullptr;
+#endif
+}
+
+SpliceRelay::SpliceRelay(Event::Dispatcher&, Network::IoHandle& downstream,
+                         Network::IoHandle& upstream, DisengageCb disengage_cb)
+    : disengage_cb_(std::move(disengage_cb)) {
+  down_to_up_.source_fd_ = downstream.fdDoNotUse();
+  down_to_up_.sink_fd_ = upstream.fdDoNotUse();
+  up_to_down_.source_fd_ = upstream.fdDoNotUse();
+  up_to_down_.sink_fd_ = downstream.fdDoNotUse();
+}
+
+SpliceRelay::~SpliceRelay() {
+#if defined(__linux__)
+  for (Direction* direction : {&down_to_up_, &up_to_down_}) {
+    for (int fd : direction->pipe_fds_) {
+      if (fd != -1) {
+        ::close(fd);
+      }
+    }
+  }
+#endif
+}
+
+uint64_t SpliceRelay::bytesToUpstream() const { return down_to_up_.bytes_relayed_; }
+uint64_t SpliceRelay::bytesToDownstream() const { return up_to_down_.bytes_relayed_; }
+
+#if defined(__linux__)
+
+bool SpliceRelay::initialize(Event::Dispatcher& dispatcher, Network::IoHandle&,
+                             Network::IoHandle&) {
+  for (Direction* direction : {&down_to_up_, &up_to_down_}) {
+    if (::pipe2(direction->pipe_fds_, O_NONBLOCK | O_CLOEXEC) != 0) {
+      return false;
+    }
+  }
+
+  // One event per socket; each socket is the source of one direction and the sink of the
+  // other, so any readiness change pumps both.
+  downstream_event_ = dispatcher.createFileEvent(
+      down_to_up_.source_fd_, [this](uint32_t) { onSocketReady(); }, Event::FileTriggerType::Edge,
+      Event::FileReadyType::Read | Event::FileReadyType::Write);
+  upstream_event_ = dispatcher.createFileEvent(
+      up_to_down_.source_fd_, [this](uint32_t) { onSocketReady(); }, Event::FileTriggerType::Edge,
+      Event::FileReadyType::Read | Event::FileReadyType::Write);
+
+  // Prime both directions; data may already be queued in the kernel.
+  onSocketReady();
+  return true;
+}
+
+void SpliceRelay::onSocketReady() {
+  pump(down_to_up_);
+  if (disengaged_) {
+    return;
+  }
+  pump(up_to_down_);
+  if (disengaged_) {
+    return;
+  }
+  if ((down_to_up_.terminal_ && down_to_up_.pipe_filled_ == 0) ||
+      (up_to_down_.terminal_ && up_to_down_.pipe_filled_ == 0)) {
+    // Hand control back so the buffered path observes the EOF/error through a normal read and
+    // runs the usual half-close/teardown handling.
+    disengage();
+  }
+}
+
+void SpliceRelay::pump(Direction& direction) {
+  while (true) {
+    // Drain the pipe into the sink first; parked bytes gate further reads.
+    while (direction.pipe_filled_ > 0) {
+      const ssize_t rc = ::splice(direction.pipe_fds_[0], nullptr, direction.sink_fd_, nullptr,
+                                  direction.pipe_filled_, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+      if (rc > 0) {
+        direction.pipe_filled_ -= rc;
+        direction.bytes_relayed_ += rc;
+      } else if (rc < 0 && errno == EAGAIN) {
+        // Sink is full; the sink socket's write event resumes this direction.
+        return;
+      } else {
+        direction.terminal_ = true;
+        direction.pipe_filled_ = 0;
+        return;
+      }
+    }
+    if (direction.terminal_) {
+      return;
+    }
+
+    const ssize_t rc = ::splice(direction.source_fd_, nullptr, direction.pipe_fds_[1], nullptr,
+                                SpliceChunkSize, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (rc > 0) {
+      direction.pipe_filled_ += rc;
+      continue;
+    }
+    if (rc < 0 && errno == EAGAIN) {
+      // Either no source data or the pipe is full with an unwilling sink; both resume via the
+      // corresponding event.
+      return;
+    }
+    // EOF or error: mark terminal and keep draining whatever is parked.
+    direction.terminal_ = true;
+  }
+}
+
+#else
+
+bool SpliceRelay::initialize(Event::Dispatcher&, Network::IoHandle&, Network::IoHandle&) {
+  return false;
+}
+void SpliceRelay::onSocketReady() {}
+void SpliceRelay::pump(Direction&) {}
+
+#endif // defined(__linux__)
+
+void SpliceRelay::disengage() {
+  if (disengaged_) {
+    return;
+  }
+  disengaged_ = true;
+  downstream_event_.reset();
+  upstream_event_.reset();
+  ENVOY_LOG(debug, "splice relay disengaging: {} bytes to upstream, {} bytes to downstream",
+            down_to_up_.bytes_relayed_, up_to_down_.bytes_relayed_);
+  if (disengage_cb_ != nullptr) {
+    disengage_cb_();
+  }
+}
+
+} // namespace TcpProxy
+} // namespace Envoy
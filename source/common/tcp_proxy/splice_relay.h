@@ -0,0 +1,86 @@
+#pragma once
+
+#include <memory>
+
+#include "envoy/common/platform.h"
+#include "envoy/event/deferred_deletable.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/network/io_handle.h"
+
+#include "source/common/common/logger.h"
+
+namespace Envoy {
+namespace TcpProxy {
+
+/**
+ * Kernel zero-copy relay between two established TCP connections. Each direction owns a pipe
+ * and ready payload is moved socket -> pipe -> socket with splice(2), never entering userspace.
+ * The pipe capacity bounds in-flight data per direction, taking the place of the userspace
+ * watermark buffers.
+ *
+ * The relay is engaged by the TcpProxy filter once both connections are established and
+ * eligible (plain TCP transport on both sides, no filters that need the payload). It takes over
+ * socket readiness with its own file events; the connections must be read-disabled while it is
+ * active. Whenever the relay sees something it cannot handle — EOF, a socket error, or a splice
+ * failure — it drains what is parked in the pipes, disengages and invokes the disengage
+ * callback, which re-enables the buffered path so the existing teardown and half-close logic
+ * observes the condition through a normal read.
+ */
+class SpliceRelay : public Event::DeferredDeletable, protected Logger::Loggable<Logger::Id::filter> {
+public:
+  using DisengageCb = std::function<void()>;
+
+  /**
+   * Creates and engages a relay between the two handles.
+   * @return nullptr when pipes cannot be created or the platform lacks splice support; the
+   *         caller then stays on the buffered path.
+   */
+  static std::unique_ptr<SpliceRelay> create(Event::Dispatcher& dispatcher,
+                                             Network::IoHandle& downstream,
+                                             Network::IoHandle& upstream,
+                                             DisengageCb disengage_cb);
+
+  ~SpliceRelay() override;
+
+  /**
+   * @return the bytes moved downstream->upstream and upstream->downstream so far.
+   */
+  uint64_t bytesToUpstream() const;
+  uint64_t bytesToDownstream() const;
+
+private:
+  struct Direction {
+    os_fd_t source_fd_{INVALID_SOCKET};
+    os_fd_t sink_fd_{INVALID_SOCKET};
+    int pipe_fds_[2]{-1, -1};
+    // Bytes parked in the pipe, already consumed from the source but not yet accepted by the
+    // sink.
+    uint64_t pipe_filled_{0};
+    uint64_t bytes_relayed_{0};
+    // Set when the source reported EOF or either side errored; the direction only drains from
+    // then on.
+    bool terminal_{false};
+  };
+
+  SpliceRelay(Event::Dispatcher& dispatcher, Network::IoHandle& downstream,
+              Network::IoHandle& upstream, DisengageCb disengage_cb);
+  bool initialize(Event::Dispatcher& dispatcher, Network::IoHandle& downstream,
+                  Network::IoHandle& upstream);
+
+  void onSocketReady();
+  // Moves as much as possible for one direction. Marks the direction terminal on EOF or error.
+  void pump(Direction& direction);
+  void disengage();
+
+  Direction down_to_up_;
+  Direction up_to_down_;
+  Event::FileEventPtr downstream_event_;
+  Event::FileEventPtr upstream_event_;
+  DisengageCb disengage_cb_;
+  bool disengaged_{false};
+};
+
+using SpliceRelayPtr = std::unique_ptr<SpliceRelay>;
+
+} // namespace TcpProxy
+} // namespace Envoy
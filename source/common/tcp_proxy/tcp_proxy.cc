@@ -26,12 +26,14 @@
 #include "source/common/config/utility.h"
 #include "source/common/config/well_known_names.h"
 #include "source/common/network/application_protocol.h"
+#include "source/common/network/connection_impl.h"
 #include "source/common/network/proxy_protocol_filter_state.h"
 #include "source/common/network/socket_option_factory.h"
 #include "source/common/network/transport_socket_options_impl.h"
 #include "source/common/network/upstream_server_name.h"
 #include "source/common/network/upstream_socket_options_filter_state.h"
 #include "source/common/router/metadatamatchcriteria_impl.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/stream_info/stream_id_provider_impl.h"
 
 namespace Envoy {
@@ -202,7 +204,7 @@ Filter::~Filter() {
 }
 
 TcpProxyStats Config::SharedConfig::generateStats(Stats::Scope& scope) {
-  return {ALL_TCP_PROXY_STATS(POOL_COUNTER(scope), POOL_GAUGE(scope))};
+  return {ALL_TCP_PROXY_STATS(POOL_COUNTER(scope), POOL_GAUGE(scope), POOL_HISTOGRAM(scope))};
 }
 
 void Filter::initializeReadFilterCallbacks(Network::ReadFilterCallbacks& callbacks) {
@@ -254,11 +256,21 @@ void Filter::readDisableUpstream(bool disable) {
     return;
   }
   if (disable) {
+    upstream_read_pause_start_ =
+        read_callbacks_->connection().dispatcher().timeSource().monotonicTime();
     read_callbacks_->upstreamHost()
         ->cluster()
         .trafficStats()
         ->upstream_flow_control_paused_reading_total_.inc();
   } else {
+    if (upstream_read_pause_start_.has_value()) {
+      config_->stats().upstream_flow_control_paused_reading_us_.recordValue(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              read_callbacks_->connection().dispatcher().timeSource().monotonicTime() -
+              *upstream_read_pause_start_)
+              .count());
+      upstream_read_pause_start_.reset();
+    }
     read_callbacks_->upstreamHost()
         ->cluster()
         .trafficStats()
@@ -276,8 +288,18 @@ void Filter::readDisableDownstream(bool disable) {
   read_callbacks_->connection().readDisable(disable);
 
   if (disable) {
+    downstream_read_pause_start_ =
+        read_callbacks_->connection().dispatcher().timeSource().monotonicTime();
     config_->stats().downstream_flow_control_paused_reading_total_.inc();
   } else {
+    if (downstream_read_pause_start_.has_value()) {
+      config_->stats().downstream_flow_control_paused_reading_us_.recordValue(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              read_callbacks_->connection().dispatcher().timeSource().monotonicTime() -
+              *downstream_read_pause_start_)
+              .count());
+      downstream_read_pause_start_.reset();
+    }
     config_->stats().downstream_flow_control_resumed_reading_total_.inc();
   }
 }
@@ -688,6 +710,8 @@ void Filter::onDownstreamEvent(Network::ConnectionEvent event) {
   if (event == Network::ConnectionEvent::LocalClose ||
       event == Network::ConnectionEvent::RemoteClose) {
     downstream_closed_ = true;
+    // Drop the relay before the socket goes away so its file events never outlive the fd.
+    splice_relay_.reset();
     // Cancel the potential odcds callback.
     cluster_discovery_handle_ = nullptr;
   }
@@ -739,6 +763,8 @@ void Filter::onUpstreamEvent(Network::ConnectionEvent event) {
 
   if (event == Network::ConnectionEvent::RemoteClose ||
       event == Network::ConnectionEvent::LocalClose) {
+    // Drop the relay before the socket goes away so its file events never outlive the fd.
+    splice_relay_.reset();
     upstream_.reset();
     disableIdleTimer();
 
@@ -801,6 +827,58 @@ void Filter::onUpstreamConnection() {
   }
 
   getStreamInfo().setStreamState(StreamInfo::StreamState::InProgress);
+
+  maybeEngageSpliceRelay();
+}
+
+void Filter::maybeEngageSpliceRelay() {
+  if (!Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tcp_proxy_use_splice")) {
+    return;
+  }
+  // Relayed bytes never pass through onData()/onUpstreamData(), so the idle timer would fire on
+  // an active session; sessions with an idle timeout stay on the buffered path.
+  if (upstream_ == nullptr || config_->idleTimeout()) {
+    return;
+  }
+  Network::Connection* upstream_connection = upstream_->connection();
+  if (upstream_connection == nullptr) {
+    return;
+  }
+  Network::Connection& downstream_connection = read_callbacks_->connection();
+  // The relay moves raw socket bytes, so both transports must be plaintext.
+  if (downstream_connection.ssl() != nullptr || upstream_connection->ssl() != nullptr) {
+    return;
+  }
+  auto* downstream_impl = dynamic_cast<Network::ConnectionImpl*>(&downstream_connection);
+  auto* upstream_impl = dynamic_cast<Network::ConnectionImpl*>(upstream_connection);
+  if (downstream_impl == nullptr || upstream_impl == nullptr) {
+    return;
+  }
+  splice_relay_ =
+      SpliceRelay::create(downstream_connection.dispatcher(), downstream_impl->ioHandle(),
+                          upstream_impl->ioHandle(), [this]() { onSpliceRelayDisengaged(); });
+  if (splice_relay_ == nullptr) {
+    return;
+  }
+  // The relay owns socket readiness while engaged; park the buffered paths.
+  downstream_connection.readDisable(true);
+  upstream_->readDisable(true);
+  config_->stats().splice_relay_engaged_total_.inc();
+  ENVOY_CONN_LOG(debug, "TCP:engaged splice relay", downstream_connection);
+}
+
+void Filter::onSpliceRelayDisengaged() {
+  getStreamInfo().getDownstreamBytesMeter()->addWireBytesReceived(splice_relay_->bytesToUpstream());
+  getStreamInfo().getUpstreamBytesMeter()->addWireBytesSent(splice_relay_->bytesToUpstream());
+  getStreamInfo().getUpstreamBytesMeter()->addWireBytesReceived(splice_relay_->bytesToDownstream());
+  getStreamInfo().getDownstreamBytesMeter()->addWireBytesSent(splice_relay_->bytesToDownstream());
+  // Deferred delete: this callback runs from the relay's own file events.
+  read_callbacks_->connection().dispatcher().deferredDelete(std::move(splice_relay_));
+  // Resume the buffered path so the pending EOF or error is observed through a normal read.
+  read_callbacks_->connection().readDisable(false);
+  if (upstream_) {
+    upstream_->readDisable(false);
+  }
 }
 
 void Filter::onIdleTimeout() {
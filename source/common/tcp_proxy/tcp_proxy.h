@@ -30,6 +30,7 @@
 #include "source/common/network/hash_policy.h"
 #include "source/common/network/utility.h"
 #include "source/common/stream_info/stream_info_impl.h"
+#include "source/common/tcp_proxy/splice_relay.h"
 #include "source/common/tcp_proxy/upstream.h"
 #include "source/common/upstream/load_balancer_impl.h"
 
@@ -41,7 +42,7 @@ namespace TcpProxy {
 /**
  * All tcp proxy stats. @see stats_macros.h
  */
-#define ALL_TCP_PROXY_STATS(COUNTER, GAUGE)                                                        \
+#define ALL_TCP_PROXY_STATS(COUNTER, GAUGE, HISTOGRAM)                                             \
   COUNTER(downstream_cx_no_route)                                                                  \
   COUNTER(downstream_cx_rx_bytes_total)                                                            \
   COUNTER(downstream_cx_total)                                                                     \
@@ -50,10 +51,13 @@ namespace TcpProxy {
   COUNTER(downstream_flow_control_resumed_reading_total)                                           \
   COUNTER(idle_timeout)                                                                            \
   COUNTER(max_downstream_connection_duration)                                                      \
+  COUNTER(splice_relay_engaged_total)                                                              \
   COUNTER(upstream_flush_total)                                                                    \
   GAUGE(downstream_cx_rx_bytes_buffered, Accumulate)                                               \
   GAUGE(downstream_cx_tx_bytes_buffered, Accumulate)                                               \
-  GAUGE(upstream_flush_active, Accumulate)
+  GAUGE(upstream_flush_active, Accumulate)                                                         \
+  HISTOGRAM(downstream_flow_control_paused_reading_us, Microseconds)                               \
+  HISTOGRAM(upstream_flow_control_paused_reading_us, Microseconds)
 
 /**
  * Tcp proxy stats for on-demand. These stats are generated only if the tcp proxy enables on demand.
@@ -68,7 +72,7 @@ namespace TcpProxy {
  * Struct definition for all tcp proxy stats. @see stats_macros.h
  */
 struct TcpProxyStats {
-  ALL_TCP_PROXY_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
+  ALL_TCP_PROXY_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT, GENERATE_HISTOGRAM_STRUCT)
 };
 
 /**
@@ -511,6 +515,8 @@ protected:
   void onAccessLogFlushInterval();
   void resetAccessLogFlushTimer();
   void disableAccessLogFlushTimer();
+  void maybeEngageSpliceRelay();
+  void onSpliceRelayDisengaged();
 
   const ConfigSharedPtr config_;
   Upstream::ClusterManager& cluster_manager_;
@@ -533,10 +539,17 @@ protected:
   // This will be non-null from when an upstream connection is attempted until
   // it either succeeds or fails.
   std::unique_ptr<GenericConnPool> generic_conn_pool_;
+  // Active kernel splice relay; non-null only while both sockets are being relayed in-kernel and
+  // the buffered path is read-disabled.
+  SpliceRelayPtr splice_relay_;
   RouteConstSharedPtr route_;
   Router::MetadataMatchCriteriaConstPtr metadata_match_criteria_;
   Network::TransportSocketOptionsConstSharedPtr transport_socket_options_;
   Network::Socket::OptionsSharedPtr upstream_options_;
+  // Set while flow control has paused reading in the respective direction; used to record the
+  // pause duration histograms when reading resumes.
+  absl::optional<MonotonicTime> downstream_read_pause_start_;
+  absl::optional<MonotonicTime> upstream_read_pause_start_;
   uint32_t connect_attempts_{};
   bool connecting_{};
   bool downstream_closed_{};
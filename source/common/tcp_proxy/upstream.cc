@@ -49,6 +49,10 @@ bool TcpUpstream::startUpstreamSecureTransport() {
              : upstream_conn_data_->connection().startSecureTransport();
 }
 
+Network::Connection* TcpUpstream::connection() {
+  return (upstream_conn_data_ == nullptr) ? nullptr : &upstream_conn_data_->connection();
+}
+
 Tcp::ConnectionPool::ConnectionData*
 TcpUpstream::onDownstreamEvent(Network::ConnectionEvent event) {
   if (event == Network::ConnectionEvent::RemoteClose) {
@@ -117,6 +117,7 @@ public:
   void addBytesSentCallback(Network::Connection::BytesSentCb cb) override;
   Tcp::ConnectionPool::ConnectionData* onDownstreamEvent(Network::ConnectionEvent event) override;
   bool startUpstreamSecureTransport() override;
+  Network::Connection* connection() override;
 
 private:
   Tcp::ConnectionPool::ConnectionDataPtr upstream_conn_data_;
@@ -1,5 +1,6 @@
 #include "source/common/upstream/cluster_manager_impl.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <functional>
@@ -99,6 +100,7 @@ void ClusterManagerInitHelper::addCluster(ClusterManagerCluster& cm_cluster) {
 
   const auto initialize_cb = [&cm_cluster, this] { onClusterInit(cm_cluster); };
   Cluster& cluster = cm_cluster.cluster();
+  warming_start_times_.insert_or_assign(cluster.info()->name(), time_source_.monotonicTime());
   if (cluster.initializePhase() == Cluster::InitializePhase::Primary) {
     // Remove the previous cluster before the cluster object is destroyed.
     primary_init_clusters_.insert_or_assign(cm_cluster.cluster().info()->name(), &cm_cluster);
@@ -120,6 +122,14 @@ void ClusterManagerInitHelper::addCluster(ClusterManagerCluster& cm_cluster) {
 
 void ClusterManagerInitHelper::onClusterInit(ClusterManagerCluster& cluster) {
   ASSERT(state_ != State::AllClustersInitialized);
+  const auto warming_it = warming_start_times_.find(cluster.cluster().info()->name());
+  if (warming_it != warming_start_times_.end()) {
+    warming_histogram_.recordValue(
+        std::chrono::duration_cast<std::chrono::milliseconds>(time_source_.monotonicTime() -
+                                                              warming_it->second)
+            .count());
+    warming_start_times_.erase(warming_it);
+  }
   per_cluster_init_callback_(cluster);
   removeCluster(cluster);
 }
@@ -146,6 +156,9 @@ void ClusterManagerInitHelper::removeCluster(ClusterManagerCluster& cluster) {
   auto iter = cluster_map->find(cluster.cluster().info()->name());
   if (iter != cluster_map->end() && iter->second == &cluster) {
     cluster_map->erase(iter);
+    // The cluster is going away without having initialized; drop its warming timestamp so a
+    // later cluster with the same name cannot report a bogus warm latency.
+    warming_start_times_.erase(cluster.cluster().info()->name());
   }
   ENVOY_LOG(debug, "cm init: init complete: cluster={} primary={} secondary={}",
             cluster.cluster().info()->name(), primary_init_clusters_.size(),
@@ -292,7 +305,8 @@ ClusterManagerImpl::ClusterManagerImpl(
                        ? absl::make_optional(bootstrap.cluster_manager().upstream_bind_config())
                        : absl::nullopt),
       local_info_(local_info), cm_stats_(generateStats(*stats.rootScope())),
-      init_helper_(*this, [this](ClusterManagerCluster& cluster) { onClusterInit(cluster); }),
+      init_helper_(*this, main_thread_dispatcher.timeSource(), cm_stats_.cluster_warming_ms_,
+                   [this](ClusterManagerCluster& cluster) { onClusterInit(cluster); }),
       time_source_(main_thread_dispatcher.timeSource()), dispatcher_(main_thread_dispatcher),
       http_context_(http_context), router_context_(router_context),
       cluster_stat_names_(stats.symbolTable()),
@@ -535,7 +549,8 @@ void ClusterManagerImpl::initializeSecondaryClusters(
 ClusterManagerStats ClusterManagerImpl::generateStats(Stats::Scope& scope) {
   const std::string final_prefix = "cluster_manager.";
   return {ALL_CLUSTER_MANAGER_STATS(POOL_COUNTER_PREFIX(scope, final_prefix),
-                                    POOL_GAUGE_PREFIX(scope, final_prefix))};
+                                    POOL_GAUGE_PREFIX(scope, final_prefix),
+                                    POOL_HISTOGRAM_PREFIX(scope, final_prefix))};
 }
 
 void ClusterManagerImpl::onClusterInit(ClusterManagerCluster& cm_cluster) {
@@ -973,6 +988,26 @@ void ClusterManagerImpl::maybePreconnect(
     return;
   }
 
+  // Estimate how many additional streams are likely to arrive on this worker while a connection
+  // initiated now would still be establishing, and fold that anticipated demand into the
+  // capacity checks below. This lets preconnect ramp ahead of a rising request rate instead of
+  // trailing it by one stream. Connections created here complete their transport (including TLS)
+  // handshake as part of becoming ready, so predicted capacity is usable when the demand lands.
+  const uint32_t anticipated_streams = cluster_entry.recordStreamArrivalForPreconnect();
+  float pool_preconnect_ratio = peekahead_ratio;
+  if (anticipated_streams > 0) {
+    // The per-pool preconnect interface takes a ratio rather than a stream count, so express the
+    // predicted arrivals as a proportional boost over current in-flight streams. Cap the boosted
+    // ratio at 3.0 (matching the API limit for configured preconnect ratios) but never below the
+    // configured ratio itself; any connection actually created remains subject to the cluster's
+    // max_connections circuit breaker.
+    const uint64_t in_flight = state.pending_streams_ + state.active_streams_;
+    pool_preconnect_ratio = std::min(
+        std::max<float>(3.0, peekahead_ratio),
+        static_cast<float>(peekahead_ratio *
+                           (1.0 + static_cast<float>(anticipated_streams) / (in_flight + 1))));
+  }
+
   // 3 here is arbitrary. Just as in ConnPoolImplBase::tryCreateNewConnections
   // we want to limit the work which can be done on any given preconnect attempt.
   for (int i = 0; i < 3; ++i) {
@@ -982,18 +1017,48 @@ void ClusterManagerImpl::maybePreconnect(
     // We anticipate the incoming stream here, because maybePreconnect is called
     // before a new stream is established.
     if (!ConnectionPool::ConnPoolImplBase::shouldConnect(
-            state.pending_streams_, state.active_streams_,
+            state.pending_streams_ + anticipated_streams, state.active_streams_,
             state.connecting_and_connected_stream_capacity_, peekahead_ratio, true)) {
       return;
     }
     ConnectionPool::Instance* preconnect_pool = pick_preconnect_pool();
-    if (!preconnect_pool || !preconnect_pool->maybePreconnect(peekahead_ratio)) {
+    if (!preconnect_pool || !preconnect_pool->maybePreconnect(pool_preconnect_ratio)) {
       // Given that the next preconnect pick may be entirely different, we could
       // opt to try again even if the first preconnect fails. Err on the side of
       // caution and wait for the next attempt.
       return;
     }
+    if (anticipated_streams > 0) {
+      cluster_entry.info()->trafficStats()->upstream_cx_preconnect_predictive_.inc();
+    }
+  }
+}
+
+uint32_t
+ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::recordStreamArrivalForPreconnect() {
+  // Smoothing factor for the arrival rate EWMA, and the horizon over which arrivals are
+  // predicted. The horizon approximates the time to establish a new upstream connection (TCP plus
+  // TLS handshakes); predicting further out is not useful because a connection started now would
+  // already be ready by then.
+  constexpr double kEwmaAlpha = 0.2;
+  constexpr double kPredictionHorizonMs = 250.0;
+  // Bound the prediction so a pathological burst cannot demand unbounded capacity.
+  constexpr uint32_t kMaxAnticipatedStreams = 16;
+
+  const MonotonicTime now = parent_.thread_local_dispatcher_.timeSource().monotonicTime();
+  if (preconnect_seen_stream_) {
+    const double interval_ms =
+        std::chrono::duration<double, std::milli>(now - preconnect_last_stream_time_).count();
+    // Clamp the instantaneous rate to one stream per millisecond so a batch of arrivals within
+    // the same event loop iteration does not blow up the average.
+    const double instant_rate = 1.0 / std::max(interval_ms, 1.0);
+    preconnect_streams_per_ms_ewma_ =
+        kEwmaAlpha * instant_rate + (1.0 - kEwmaAlpha) * preconnect_streams_per_ms_ewma_;
   }
+  preconnect_last_stream_time_ = now;
+  preconnect_seen_stream_ = true;
+  return std::min(kMaxAnticipatedStreams, static_cast<uint32_t>(preconnect_streams_per_ms_ewma_ *
+                                                                kPredictionHorizonMs));
 }
 
 absl::optional<HttpPoolData>
@@ -1693,6 +1758,23 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::httpConnPoolImp
     context->downstreamConnection()->hashKey(hash_key);
   }
 
+  // If the cluster's load balancer tracks connection lifetimes, an existing connection made
+  // to the same address under a compatible hash key (e.g. by another dynamic forward proxy
+  // host whose name resolved to the same address) may be reused instead of creating a new
+  // pool for this host.
+  OptRef<Http::ConnectionPool::ConnectionLifetimeCallbacks> lifetime_callbacks =
+      lb_->lifetimeCallbacks();
+  if (lifetime_callbacks.has_value() && context != nullptr) {
+    absl::optional<SelectedPoolAndConnection> existing =
+        lb_->selectExistingConnection(context, *host, hash_key);
+    if (existing.has_value()) {
+      // Only HTTP pools are tracked via the callbacks registered below, so the selected pool
+      // is always an HTTP pool.
+      ASSERT(dynamic_cast<Http::ConnectionPool::Instance*>(&existing->pool_) != nullptr);
+      return static_cast<Http::ConnectionPool::Instance*>(&existing->pool_);
+    }
+  }
+
   ConnPoolsContainer& container = *parent_.getHttpConnPoolsContainer(host, true);
 
   // Note: to simplify this, we assume that the factory is only called in the scope of this
@@ -1708,6 +1790,9 @@ ClusterManagerImpl::ThreadLocalClusterManagerImpl::ClusterEntry::httpConnPoolImp
         pool->addIdleCallback([&parent = parent_, host, priority, hash_key]() {
           parent.httpConnPoolIsIdle(host, priority, hash_key);
         });
+        if (lifetime_callbacks.has_value()) {
+          pool->setConnectionLifetimeCallbacks(hash_key, lifetime_callbacks->get());
+        }
 
         return pool;
       });
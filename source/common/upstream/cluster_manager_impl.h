@@ -156,13 +156,15 @@ public:
 class ClusterManagerInitHelper : Logger::Loggable<Logger::Id::upstream> {
 public:
   /**
+   * @param warming_histogram supplies the histogram recording per-cluster warm latency.
    * @param per_cluster_init_callback supplies the callback to call when a cluster has itself
    *        initialized. The cluster manager can use this for post-init processing.
    */
   ClusterManagerInitHelper(
-      ClusterManager& cm,
+      ClusterManager& cm, TimeSource& time_source, Stats::Histogram& warming_histogram,
       const std::function<void(ClusterManagerCluster&)>& per_cluster_init_callback)
-      : cm_(cm), per_cluster_init_callback_(per_cluster_init_callback) {}
+      : cm_(cm), time_source_(time_source), warming_histogram_(warming_histogram),
+        per_cluster_init_callback_(per_cluster_init_callback) {}
 
   enum class State {
     // Initial state. During this state all static clusters are loaded. Any primary clusters
@@ -207,8 +209,13 @@ private:
   void onClusterInit(ClusterManagerCluster& cluster);
 
   ClusterManager& cm_;
+  TimeSource& time_source_;
+  Stats::Histogram& warming_histogram_;
   std::function<void(ClusterManagerCluster& cluster)> per_cluster_init_callback_;
   CdsApi* cds_{};
+  // Warming start timestamp for each cluster currently initializing, keyed by cluster name; used
+  // to record per-cluster warm latency when initialization completes.
+  absl::flat_hash_map<std::string, MonotonicTime> warming_start_times_;
   ClusterManager::PrimaryClustersReadyCallback primary_clusters_initialized_callback_;
   ClusterManager::InitializationCompleteCallback initialized_callback_;
   absl::flat_hash_map<std::string, ClusterManagerCluster*> primary_init_clusters_;
@@ -220,7 +227,7 @@ private:
 /**
  * All cluster manager stats. @see stats_macros.h
  */
-#define ALL_CLUSTER_MANAGER_STATS(COUNTER, GAUGE)                                                  \
+#define ALL_CLUSTER_MANAGER_STATS(COUNTER, GAUGE, HISTOGRAM)                                       \
   COUNTER(cluster_added)                                                                           \
   COUNTER(cluster_modified)                                                                        \
   COUNTER(cluster_removed)                                                                         \
@@ -229,13 +236,15 @@ private:
   COUNTER(update_merge_cancelled)                                                                  \
   COUNTER(update_out_of_merge_window)                                                              \
   GAUGE(active_clusters, NeverImport)                                                              \
-  GAUGE(warming_clusters, NeverImport)
+  GAUGE(warming_clusters, NeverImport)                                                             \
+  HISTOGRAM(cluster_warming_ms, Milliseconds)
 
 /**
  * Struct definition for all cluster manager stats. @see stats_macros.h
  */
 struct ClusterManagerStats {
-  ALL_CLUSTER_MANAGER_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT)
+  ALL_CLUSTER_MANAGER_STATS(GENERATE_COUNTER_STRUCT, GENERATE_GAUGE_STRUCT,
+                            GENERATE_HISTOGRAM_STRUCT)
 };
 
 /**
@@ -560,6 +569,12 @@ private:
       HostConstSharedPtr chooseHost(LoadBalancerContext* context);
       HostConstSharedPtr peekAnotherHost(LoadBalancerContext* context);
 
+      // Records a new stream arrival for this worker and returns the number of additional
+      // streams predicted to arrive while a freshly initiated connection would still be
+      // establishing, based on an exponentially weighted moving average of the recent arrival
+      // rate. Used by maybePreconnect() to ramp capacity ahead of a rising request rate.
+      uint32_t recordStreamArrivalForPreconnect();
+
       ThreadLocalClusterManagerImpl& parent_;
       PrioritySetImpl priority_set_;
       // LB factory if applicable. Not all load balancer types have a factory. LB types that have
@@ -574,6 +589,12 @@ private:
       // be shared across its hosts.
       Http::PersistentQuicInfoPtr quic_info_;
 
+      // Predictive preconnect state: EWMA of the stream arrival rate observed on this worker, in
+      // streams per millisecond, and the arrival time of the most recent stream.
+      double preconnect_streams_per_ms_ewma_{0.0};
+      MonotonicTime preconnect_last_stream_time_{};
+      bool preconnect_seen_stream_{false};
+
       // Expected override host statues. Every bit in the HostStatusSet represent an enum value
       // of envoy::config::core::v3::HealthStatus. The specific correspondence is shown below:
       //
@@ -67,10 +67,14 @@ void HealthCheckEventLoggerImpl::createHealthCheckEvent(
   callback(event);
 
   // Make sure the type enums make it into the JSON
-  const auto json =
+  auto json =
       MessageUtil::getJsonStringFromMessageOrError(event, /* pretty_print */ false,
                                                    /* always_print_primitive_fields */ true);
-  file_->write(fmt::format("{}\n", json));
+  json.push_back('\n');
+  // The file is managed by the access log manager: write() only appends to an in-memory buffer
+  // which a background thread flushes on the flush interval, so event bursts do not block the
+  // main thread on disk I/O.
+  file_->write(json);
 }
 } // namespace Upstream
 } // namespace Envoy
@@ -1,5 +1,6 @@
 #include "source/common/upstream/load_balancer_impl.h"
 
+#include <algorithm>
 #include <atomic>
 #include <bitset>
 #include <cstdint>
@@ -14,6 +15,8 @@
 #include "source/common/common/assert.h"
 #include "source/common/common/logger.h"
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
+#include "source/common/upstream/wrsq_scheduler.h"
 
 #include "absl/container/fixed_array.h"
 
@@ -477,31 +480,41 @@ void ZoneAwareLoadBalancerBase::regenerateLocalityRoutingStructures() {
   // locality we should route. Percentage of requests routed cross locality to a specific locality
   // needed be proportional to the residual capacity upstream locality has.
   //
-  // residual_capacity contains capacity left in a given locality, we keep accumulating residual
-  // capacity to make search for sampled value easier.
   // For example, if we have the following upstream and local percentage:
-  // local_percentage: 40000 40000 20000
-  // upstream_percentage: 25000 50000 25000
-  // Residual capacity would look like: 0 10000 5000. Now we need to sample proportionally to
-  // bucket sizes (residual capacity). For simplicity of finding where specific
-  // sampled value is, we accumulate values in residual capacity. This is what it will look like:
-  // residual_capacity: 0 10000 15000
-  // Now to find a locality to route (bucket) we could simply iterate over residual_capacity
-  // searching where sampled value is placed.
-  state.residual_capacity_.resize(num_localities);
-
+  // local_percentage: 4000 4000 2000
+  // upstream_percentage: 2500 5000 2500
+  // Residual capacity would be 0 1000 500 and cross locality traffic should be sampled
+  // proportionally to those bucket sizes.
+  //
+  // Rather than sampling "stay local?" and "which locality gets the spillover?" with two
+  // independent draws per pick, both decisions are folded into one cumulative distribution that
+  // is regenerated here, once per host set update. Entry 0 carries the local share
+  // (local_percent_to_route_) scaled by the total residual capacity, and entry i > 0 accumulates
+  // the residual capacity of locality i scaled by the probability of routing cross-locality,
+  // which preserves the exact distribution of the two-draw scheme. Continuing the example with
+  // a local_percent_to_route_ of 6250 (total residual capacity 1500):
+  // cumulative_capacity_: 9375000 13125000 15000000
+  // The last entry always equals 10000 * total residual capacity, and a pick is one draw in that
+  // range plus one search for the bucket containing the sampled value.
+  absl::FixedArray<uint64_t> residual_capacity(num_localities);
+  uint64_t total_residual_capacity = 0;
   // Local locality (index 0) does not have residual capacity as we have routed all we could.
-  state.residual_capacity_[0] = 0;
+  residual_capacity[0] = 0;
   for (size_t i = 1; i < num_localities; ++i) {
     // Only route to the localities that have additional capacity.
-    if (upstream_percentage[i] > local_percentage[i]) {
-      state.residual_capacity_[i] =
-          state.residual_capacity_[i - 1] + upstream_percentage[i] - local_percentage[i];
-    } else {
-      // Locality with index "i" does not have residual capacity, but we keep accumulating previous
-      // values to make search easier on the next step.
-      state.residual_capacity_[i] = state.residual_capacity_[i - 1];
-    }
+    residual_capacity[i] = upstream_percentage[i] > local_percentage[i]
+                               ? upstream_percentage[i] - local_percentage[i]
+                               : 0;
+    total_residual_capacity += residual_capacity[i];
+  }
+
+  // If total_residual_capacity is zero every entry below is zero; tryChooseLocalLocalityHosts
+  // detects that and falls back to a uniformly random locality for cross locality traffic.
+  state.cumulative_capacity_.resize(num_localities);
+  state.cumulative_capacity_[0] = state.local_percent_to_route_ * total_residual_capacity;
+  for (size_t i = 1; i < num_localities; ++i) {
+    state.cumulative_capacity_[i] = state.cumulative_capacity_[i - 1] +
+                                    (10000 - state.local_percent_to_route_) * residual_capacity[i];
   }
 }
 
@@ -614,37 +627,34 @@ uint32_t ZoneAwareLoadBalancerBase::tryChooseLocalLocalityHosts(const HostSet& h
 
   ASSERT(state.locality_routing_state_ == LocalityRoutingState::LocalityResidual);
 
-  // If we cannot route all requests to the same locality, we already calculated how much we can
-  // push to the local locality, check if we can push to local locality on current iteration.
-  if (random_.random() % 10000 < state.local_percent_to_route_) {
-    stats_.lb_zone_routing_sampled_.inc();
-    return 0;
-  }
-
-  // At this point we must route cross locality as we cannot route to the local locality.
-  stats_.lb_zone_routing_cross_zone_.inc();
-
   // This is *extremely* unlikely but possible due to rounding errors when calculating
-  // locality percentages. In this case just select random locality.
-  if (state.residual_capacity_[number_of_localities - 1] == 0) {
+  // locality percentages. In this case sample the local share directly and select a random
+  // locality for the traffic that must go cross locality.
+  if (state.cumulative_capacity_[number_of_localities - 1] == 0) {
+    if (random_.random() % 10000 < state.local_percent_to_route_) {
+      stats_.lb_zone_routing_sampled_.inc();
+      return 0;
+    }
+    stats_.lb_zone_routing_cross_zone_.inc();
     stats_.lb_zone_no_capacity_left_.inc();
     return random_.random() % number_of_localities;
   }
 
-  // Random sampling to select specific locality for cross locality traffic based on the
-  // additional capacity in localities.
-  uint64_t threshold = random_.random() % state.residual_capacity_[number_of_localities - 1];
-
-  // This potentially can be optimized to be O(log(N)) where N is the number of localities.
-  // Linear scan should be faster for smaller N, in most of the scenarios N will be small.
-  // TODO(htuch): is there a bug here when threshold == 0? Seems like we pick
-  // local locality in that situation. Probably should start iterating at 1.
-  int i = 0;
-  while (threshold > state.residual_capacity_[i]) {
-    i++;
+  // A single draw against the cumulative distribution decides both whether the request stays in
+  // the local locality (entry 0) and, if not, which locality receives it proportionally to the
+  // residual capacity (entries 1..N-1); see regenerateLocalityRoutingStructures() for how the
+  // table is built. Bucket i covers [cumulative_capacity_[i - 1], cumulative_capacity_[i]), so
+  // zero-capacity localities are zero-width buckets that can never be sampled.
+  const uint64_t sample = random_.random() % state.cumulative_capacity_[number_of_localities - 1];
+  if (sample < state.cumulative_capacity_[0]) {
+    stats_.lb_zone_routing_sampled_.inc();
+    return 0;
   }
 
-  return i;
+  stats_.lb_zone_routing_cross_zone_.inc();
+  return static_cast<uint32_t>(std::upper_bound(state.cumulative_capacity_.begin(),
+                                                state.cumulative_capacity_.end(), sample) -
+                               state.cumulative_capacity_.begin());
 }
 
 absl::optional<ZoneAwareLoadBalancerBase::HostsSource>
@@ -839,23 +849,36 @@ void EdfLoadBalancerBase::refresh(uint32_t priority) {
     // case EDF creation is skipped. When all original weights are equal and no hosts are in slow
     // start mode we can rely on unweighted host pick to do optimal round robin and least-loaded
     // host selection with lower memory and CPU overhead.
-    if (hostWeightsAreEqual(hosts) && noHostsAreInSlowStart()) {
-      // Skip edf creation.
+    const bool host_weights_are_equal = hostWeightsAreEqual(hosts);
+    if (host_weights_are_equal && noHostsAreInSlowStart()) {
+      // Skip weighted scheduler creation.
       return;
     }
-    scheduler.edf_ = std::make_unique<EdfScheduler<const Host>>();
+    // If the weighted scheduler is needed only because of slow start, record that so that pick
+    // time can revert to unweighted selection as soon as the last slow start window elapses.
+    scheduler.weighted_only_for_slow_start_ = host_weights_are_equal;
+    // WRSQ pays O(1) insertion and a pick cost that scales with the number of unique weights
+    // rather than the number of hosts, which matters for very large host sets. It performs
+    // poorly when weights mutate with every pick, so slow start (which ramps weights over time)
+    // stays on EDF.
+    if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.lb_use_wrsq_scheduler") &&
+        !isSlowStartEnabled()) {
+      scheduler.weighted_scheduler_ = std::make_unique<WRSQScheduler<const Host>>(random_);
+    } else {
+      scheduler.weighted_scheduler_ = std::make_unique<EdfScheduler<const Host>>();
+    }
 
     // Populate scheduler with host list.
-    // TODO(mattklein123): We must build the EDF schedule even if all of the hosts are currently
-    // weighted 1. This is because currently we don't refresh host sets if only weights change.
-    // We should probably change this to refresh at all times. See the comment in
+    // TODO(mattklein123): We must build the weighted schedule even if all of the hosts are
+    // currently weighted 1. This is because currently we don't refresh host sets if only weights
+    // change. We should probably change this to refresh at all times. See the comment in
     // BaseDynamicClusterImpl::updateDynamicHostList about this.
     for (const auto& host : hosts) {
       // We use a fixed weight here. While the weight may change without
       // notification, this will only be stale until this host is next picked,
-      // at which point it is reinserted into the EdfScheduler with its new
+      // at which point it is reinserted into the scheduler with its new
       // weight in chooseHost().
-      scheduler.edf_->add(hostWeight(*host), host);
+      scheduler.weighted_scheduler_->add(hostWeight(*host), host);
     }
 
     // Cycle through hosts to achieve the intended offset behavior.
@@ -863,8 +886,8 @@ void EdfLoadBalancerBase::refresh(uint32_t priority) {
     // refreshes for the weighted case.
     if (!hosts.empty()) {
       for (uint32_t i = 0; i < seed_ % hosts.size(); ++i) {
-        auto host =
-            scheduler.edf_->pickAndAdd([this](const Host& host) { return hostWeight(host); });
+        auto host = scheduler.weighted_scheduler_->pickAndAdd(
+            [this](const Host& host) { return hostWeight(host); });
       }
     }
   };
@@ -923,10 +946,14 @@ HostConstSharedPtr EdfLoadBalancerBase::peekAnotherHost(LoadBalancerContext* con
 
   // As has been commented in both EdfLoadBalancerBase::refresh and
   // BaseDynamicClusterImpl::updateDynamicHostList, we must do a runtime pivot here to determine
-  // whether to use EDF or do unweighted (fast) selection. EDF is non-null iff the original
-  // weights of 2 or more hosts differ.
-  if (scheduler.edf_ != nullptr) {
-    return scheduler.edf_->peekAgain([this](const Host& host) { return hostWeight(host); });
+  // whether to use the weighted scheduler or do unweighted (fast) selection. The scheduler is
+  // non-null iff the original weights of 2 or more hosts differ or hosts were in slow start at
+  // the last refresh; in the latter case unweighted selection resumes as soon as the last slow
+  // start window elapses.
+  if (scheduler.weighted_scheduler_ != nullptr &&
+      !(scheduler.weighted_only_for_slow_start_ && noHostsAreInSlowStart())) {
+    return scheduler.weighted_scheduler_->peekAgain(
+        [this](const Host& host) { return hostWeight(host); });
   } else {
     const HostVector& hosts_to_use = hostSourceToHosts(*hosts_source);
     if (hosts_to_use.empty()) {
@@ -949,10 +976,14 @@ HostConstSharedPtr EdfLoadBalancerBase::chooseHostOnce(LoadBalancerContext* cont
 
   // As has been commented in both EdfLoadBalancerBase::refresh and
   // BaseDynamicClusterImpl::updateDynamicHostList, we must do a runtime pivot here to determine
-  // whether to use EDF or do unweighted (fast) selection. EDF is non-null iff the original
-  // weights of 2 or more hosts differ.
-  if (scheduler.edf_ != nullptr) {
-    auto host = scheduler.edf_->pickAndAdd([this](const Host& host) { return hostWeight(host); });
+  // whether to use the weighted scheduler or do unweighted (fast) selection. The scheduler is
+  // non-null iff the original weights of 2 or more hosts differ or hosts were in slow start at
+  // the last refresh; in the latter case unweighted selection resumes as soon as the last slow
+  // start window elapses.
+  if (scheduler.weighted_scheduler_ != nullptr &&
+      !(scheduler.weighted_only_for_slow_start_ && noHostsAreInSlowStart())) {
+    auto host = scheduler.weighted_scheduler_->pickAndAdd(
+        [this](const Host& host) { return hostWeight(host); });
     return host;
   } else {
     const HostVector& hosts_to_use = hostSourceToHosts(*hosts_source);
@@ -1054,22 +1085,26 @@ HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPeek(const HostVector
 HostConstSharedPtr LeastRequestLoadBalancer::unweightedHostPick(const HostVector& hosts_to_use,
                                                                 const HostsSource&) {
   HostSharedPtr candidate_host = nullptr;
+  uint64_t candidate_active_rq = 0;
 
+  // The rq_active gauge is shared across workers but is written once per request start/finish
+  // rather than per pick, so reading each sampled host's gauge exactly once per pick keeps the
+  // cross-core traffic of this loop proportional to choice_count_.
   for (uint32_t choice_idx = 0; choice_idx < choice_count_; ++choice_idx) {
     const int rand_idx = random_.random() % hosts_to_use.size();
     const HostSharedPtr& sampled_host = hosts_to_use[rand_idx];
 
     if (candidate_host == nullptr) {
-
       // Make a first choice to start the comparisons.
       candidate_host = sampled_host;
+      candidate_active_rq = candidate_host->stats().rq_active_.value();
       continue;
     }
 
-    const auto candidate_active_rq = candidate_host->stats().rq_active_.value();
     const auto sampled_active_rq = sampled_host->stats().rq_active_.value();
     if (sampled_active_rq < candidate_active_rq) {
       candidate_host = sampled_host;
+      candidate_active_rq = sampled_active_rq;
     }
   }
 
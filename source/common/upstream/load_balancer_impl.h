@@ -417,10 +417,12 @@ private:
     uint64_t local_percent_to_route_{};
     // Tracks the current state of locality based routing.
     LocalityRoutingState locality_routing_state_{LocalityRoutingState::NoLocalityRouting};
-    // When locality_routing_state_ == LocalityResidual this tracks the capacity
-    // for each of the non-local localities to determine what traffic should be
-    // routed where.
-    std::vector<uint64_t> residual_capacity_;
+    // When locality_routing_state_ == LocalityResidual this is the fixed-point cumulative
+    // distribution over localities sampled on each pick: entry 0 carries the share of traffic
+    // that stays in the local locality and entry i > 0 accumulates the scaled residual capacity
+    // of locality i, so a single random draw against the last entry decides both whether to stay
+    // local and where cross-locality traffic spills over.
+    std::vector<uint64_t> cumulative_capacity_;
   };
   using PerPriorityStatePtr = std::unique_ptr<PerPriorityState>;
   // Routing state broken out for each priority level in priority_set_.
@@ -475,10 +477,18 @@ public:
 
 protected:
   struct Scheduler {
-    // EdfScheduler for weighted LB. The edf_ is only created when the original
-    // host weights of 2 or more hosts differ. When not present, the
-    // implementation of chooseHostOnce falls back to unweightedHostPick.
-    std::unique_ptr<EdfScheduler<const Host>> edf_;
+    // Weighted scheduler, only created when the original host weights of 2 or
+    // more hosts differ. When not present, the implementation of
+    // chooseHostOnce falls back to unweightedHostPick. This is an EdfScheduler
+    // unless the lb_use_wrsq_scheduler runtime flag selects the WRSQ scheduler,
+    // which trades strict weighted round robin ordering for O(1) insertion and
+    // near-constant pick cost on very large host sets.
+    std::unique_ptr<Upstream::Scheduler<const Host>> weighted_scheduler_;
+    // True if the weighted scheduler exists only because hosts were in slow start while the
+    // original host weights were all equal. Slow start weights are evaluated lazily at pick
+    // time, so once every slow start window has elapsed such a source can fall back to the
+    // cheaper unweighted selection immediately instead of waiting for the next refresh.
+    bool weighted_only_for_slow_start_{};
   };
 
   void initialize();
@@ -179,6 +179,23 @@ void DetectorHostMonitorImpl::putResult(Result result, absl::optional<uint64_t>
   put_result_func_(this, result, code);
 }
 
+// Responses slower than the configured threshold are recorded as an additional failure
+// data point, so hosts which degrade latency-wise without erroring are subject to the same
+// ejection algorithms (and enforcement settings) as erroring hosts.
+void DetectorHostMonitorImpl::putResponseTime(std::chrono::milliseconds time) {
+  std::shared_ptr<DetectorImpl> detector = detector_.lock();
+  if (!detector) {
+    // It's possible for the cluster/detector to go away while we still have a host in use.
+    return;
+  }
+  const uint64_t threshold_ms = detector->runtime().snapshot().getInteger(
+      SlowRequestThresholdMsRuntime, detector->config().slowRequestThresholdMs());
+  if (threshold_ms == 0 || static_cast<uint64_t>(time.count()) < threshold_ms) {
+    return;
+  }
+  putResult(Result::ExtOriginRequestFailed, absl::nullopt);
+}
+
 void DetectorHostMonitorImpl::localOriginFailure() {
   std::shared_ptr<DetectorImpl> detector = detector_.lock();
   if (!detector) {
@@ -257,7 +274,9 @@ DetectorConfig::DetectorConfig(const envoy::config::cluster::v3::OutlierDetectio
           config, max_ejection_time,
           std::max(DEFAULT_MAX_EJECTION_TIME_MS, base_ejection_time_ms_)))),
       max_ejection_time_jitter_ms_(static_cast<uint64_t>(PROTOBUF_GET_MS_OR_DEFAULT(
-          config, max_ejection_time_jitter, DEFAULT_MAX_EJECTION_TIME_JITTER_MS))) {}
+          config, max_ejection_time_jitter, DEFAULT_MAX_EJECTION_TIME_JITTER_MS))),
+      slow_request_threshold_ms_(
+          static_cast<uint64_t>(PROTOBUF_GET_MS_OR_DEFAULT(config, slow_request_threshold, 0))) {}
 
 DetectorImpl::DetectorImpl(const Cluster& cluster,
                            const envoy::config::cluster::v3::OutlierDetection& config,
@@ -743,6 +762,14 @@ void DetectorImpl::onIntervalTimer() {
   MonotonicTime now = time_source_.monotonicTime();
 
   for (auto host : host_monitors_) {
+    // A host that is not ejected, has no ejection backoff left to unwind and saw no requests
+    // since the last sweep has nothing to age or recompute. Skipping it keeps the per-interval
+    // cost of large, mostly-idle clusters down to a pair of relaxed atomic reads per host.
+    if (!host.first->healthFlagGet(Host::HealthFlag::FAILED_OUTLIER_CHECK) &&
+        host.second->ejectTimeBackoff() == 0 && !host.second->hasPendingData()) {
+      continue;
+    }
+
     checkHostForUneject(host.first, host.second, now);
 
     // Need to update the writer bucket to keep the data valid.
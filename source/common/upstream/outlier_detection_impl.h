@@ -82,6 +82,17 @@ public:
    */
   absl::optional<std::pair<double, uint64_t>> getSuccessRateAndVolume();
 
+  /**
+   * @return true if either bucket holds requests that an interval sweep has not yet consumed.
+   * The relaxed reads may miss a concurrent increment from a worker; such a request is simply
+   * accounted for on the next sweep, just as one arriving right after a bucket swap would be.
+   */
+  bool hasPendingData() const {
+    return current_success_rate_bucket_->total_request_counter_.load(std::memory_order_relaxed) !=
+               0 ||
+           backup_success_rate_bucket_->total_request_counter_.load(std::memory_order_relaxed) != 0;
+  }
+
 private:
   std::unique_ptr<SuccessRateAccumulatorBucket> current_success_rate_bucket_;
   std::unique_ptr<SuccessRateAccumulatorBucket> backup_success_rate_bucket_;
@@ -100,6 +111,7 @@ public:
   void updateCurrentSuccessRateBucket() {
     success_rate_accumulator_bucket_.store(success_rate_accumulator_.updateCurrentWriter());
   }
+  bool hasPendingData() const { return success_rate_accumulator_.hasPendingData(); }
   void incTotalReqCounter() { success_rate_accumulator_bucket_.load()->total_request_counter_++; }
   void incSuccessReqCounter() {
     success_rate_accumulator_bucket_.load()->success_request_counter_++;
@@ -128,6 +140,12 @@ public:
 
   uint32_t& ejectTimeBackoff() { return eject_time_backoff_; }
 
+  // Returns true if either origin monitor has accumulated requests that the interval sweep has
+  // not yet consumed.
+  bool hasPendingData() const {
+    return external_origin_sr_monitor_.hasPendingData() || local_origin_sr_monitor_.hasPendingData();
+  }
+
   void resetConsecutive5xx() { consecutive_5xx_ = 0; }
   void resetConsecutiveGatewayFailure() { consecutive_gateway_failure_ = 0; }
   void resetConsecutiveLocalOriginFailure() { consecutive_local_origin_failure_ = 0; }
@@ -137,7 +155,7 @@ public:
   uint32_t numEjections() override { return num_ejections_; }
   void putHttpResponseCode(uint64_t response_code) override;
   void putResult(Result result, absl::optional<uint64_t> code) override;
-  void putResponseTime(std::chrono::milliseconds) override {}
+  void putResponseTime(std::chrono::milliseconds time) override;
   const absl::optional<MonotonicTime>& lastEjectionTime() override { return last_ejection_time_; }
   const absl::optional<MonotonicTime>& lastUnejectionTime() override {
     return last_unejection_time_;
@@ -277,6 +295,8 @@ constexpr absl::string_view FailurePercentageThresholdRuntime =
     "outlier_detection.failure_percentage_threshold";
 constexpr absl::string_view MaxEjectionTimeJitterMsRuntime =
     "outlier_detection.max_ejection_time_jitter_ms";
+constexpr absl::string_view SlowRequestThresholdMsRuntime =
+    "outlier_detection.slow_request_threshold_ms";
 
 /**
  * Configuration for the outlier detection.
@@ -313,6 +333,7 @@ public:
   uint64_t enforcingLocalOriginSuccessRate() const { return enforcing_local_origin_success_rate_; }
   uint64_t maxEjectionTimeMs() const { return max_ejection_time_ms_; }
   uint64_t maxEjectionTimeJitterMs() const { return max_ejection_time_jitter_ms_; }
+  uint64_t slowRequestThresholdMs() const { return slow_request_threshold_ms_; }
 
 private:
   const uint64_t interval_ms_;
@@ -337,6 +358,7 @@ private:
   const uint64_t enforcing_local_origin_success_rate_;
   const uint64_t max_ejection_time_ms_;
   const uint64_t max_ejection_time_jitter_ms_;
+  const uint64_t slow_request_threshold_ms_;
 
   static constexpr uint64_t DEFAULT_INTERVAL_MS = 10000;
   static constexpr uint64_t DEFAULT_BASE_EJECTION_TIME_MS = 30000;
@@ -8,6 +8,7 @@
 #include "envoy/runtime/runtime.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/hash.h"
 #include "source/common/config/metadata.h"
 #include "source/common/config/well_known_names.h"
 #include "source/common/protobuf/utility.h"
@@ -91,6 +92,11 @@ SubsetLoadBalancer::SubsetLoadBalancer(
       [this](uint32_t priority, const HostVector&, const HostVector&) {
         refreshSubsets(priority);
         purgeEmptySubsets(subsets_);
+        // Drop index entries for subsets purgeEmptySubsets() removed from the trie so a later
+        // recreation cannot alias a stale entry.
+        absl::erase_if(subset_index_, [](const auto& kv) {
+          return !kv.second->active() && !kv.second->hasChildren();
+        });
       });
 }
 
@@ -363,43 +369,22 @@ HostConstSharedPtr SubsetLoadBalancer::tryChooseHostFromContext(LoadBalancerCont
   return entry->lb_subset_->chooseHost(context);
 }
 
-// Iterates over the given metadata match criteria (which must be lexically sorted by key) and find
-// a matching LbSubsetEntryPtr, if any.
+// Finds the LbSubsetEntryPtr matching the given metadata match criteria (which must be lexically
+// sorted by key), if any.
 SubsetLoadBalancer::LbSubsetEntryPtr SubsetLoadBalancer::findSubset(
     const std::vector<Router::MetadataMatchCriterionConstSharedPtr>& match_criteria) {
-  const LbSubsetMap* subsets = &subsets_;
-
-  // Because the match_criteria and the host metadata used to populate subsets_ are sorted in the
-  // same order, we can iterate over the criteria and perform a lookup for each key and value,
-  // starting with the root LbSubsetMap and using the previous iteration's LbSubsetMap thereafter
-  // (tracked in subsets). If ever a criterion's key or value is not found, there is no subset for
-  // this criteria. If we reach the last criterion, we've found the LbSubsetEntry for the criteria,
-  // which may or may not have a subset attached to it.
-  for (uint32_t i = 0; i < match_criteria.size(); i++) {
-    const Router::MetadataMatchCriterion& match_criterion = *match_criteria[i];
-    const auto& subset_it = subsets->find(match_criterion.name());
-    if (subset_it == subsets->end()) {
-      // No subsets with this key (at this level in the hierarchy).
-      break;
-    }
-
-    const ValueSubsetMap& vs_map = subset_it->second;
-    const auto& vs_it = vs_map.find(match_criterion.value());
-    if (vs_it == vs_map.end()) {
-      // No subsets with this value.
-      break;
-    }
-
-    const LbSubsetEntryPtr& entry = vs_it->second;
-    if (i + 1 == match_criteria.size()) {
-      // We've reached the end of the criteria, and they all matched.
-      return entry;
-    }
-
-    subsets = &entry->children_;
+  if (match_criteria.empty()) {
+    return nullptr;
   }
 
-  return nullptr;
+  // Because the match_criteria and the keys used to populate subset_index_ are sorted in the same
+  // order, the full criteria vector is resolved with a single pre-hashed flat lookup rather than
+  // a walk of the nested key/value maps. The criteria values already carry their hashes
+  // (HashedValue), so no per-request value hashing occurs. An uninitialized entry (one created
+  // only as an interior trie node) is never indexed, which matches the old walk's behavior of
+  // returning an inactive entry for such criteria: both result in fallback.
+  const auto it = subset_index_.find(match_criteria);
+  return it != subset_index_.end() ? it->second : nullptr;
 }
 
 void SubsetLoadBalancer::updateFallbackSubset(uint32_t priority, const HostVector& all_hosts) {
@@ -634,13 +619,67 @@ SubsetLoadBalancer::findOrCreateLbSubsetEntry(LbSubsetMap& subsets, const Subset
 
   idx++;
   if (idx == kvs.size()) {
-    // We've matched all the key-values, return the entry.
+    // We've matched all the key-values. Index the full key path so the data path can resolve it
+    // with one flat lookup. insert_or_assign covers the case where an entry for these key-values
+    // was purged and recreated since the last update.
+    SubsetMetadataIndexKey index_key;
+    index_key.reserve(kvs.size());
+    for (const auto& kv : kvs) {
+      index_key.emplace_back(kv.first, HashedValue(kv.second));
+    }
+    subset_index_.insert_or_assign(std::move(index_key), entry);
     return entry;
   }
 
   return findOrCreateLbSubsetEntry(entry->children_, kvs, idx);
 }
 
+uint64_t SubsetLoadBalancer::SubsetIndexHash::operator()(const SubsetMetadataIndexKey& kvs) const {
+  uint64_t hash = kvs.size();
+  for (const auto& kv : kvs) {
+    hash = HashUtil::xxHash64(kv.first, hash);
+    const uint64_t value_hash = kv.second.hash();
+    hash = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(&value_hash), sizeof(value_hash)), hash);
+  }
+  return hash;
+}
+
+uint64_t
+SubsetLoadBalancer::SubsetIndexHash::operator()(const MetadataMatchCriteriaVector& criteria) const {
+  uint64_t hash = criteria.size();
+  for (const auto& criterion : criteria) {
+    hash = HashUtil::xxHash64(criterion->name(), hash);
+    const uint64_t value_hash = criterion->value().hash();
+    hash = HashUtil::xxHash64(
+        absl::string_view(reinterpret_cast<const char*>(&value_hash), sizeof(value_hash)), hash);
+  }
+  return hash;
+}
+
+bool SubsetLoadBalancer::SubsetIndexEqual::operator()(const SubsetMetadataIndexKey& lhs,
+                                                      const SubsetMetadataIndexKey& rhs) const {
+  return lhs == rhs;
+}
+
+bool SubsetLoadBalancer::SubsetIndexEqual::operator()(
+    const SubsetMetadataIndexKey& lhs, const MetadataMatchCriteriaVector& rhs) const {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < lhs.size(); i++) {
+    if (lhs[i].first != rhs[i]->name() || lhs[i].second != rhs[i]->value()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SubsetLoadBalancer::SubsetIndexEqual::operator()(const MetadataMatchCriteriaVector& lhs,
+                                                      const SubsetMetadataIndexKey& rhs) const {
+  return (*this)(rhs, lhs);
+}
+
 // Invokes cb for each LbSubsetEntryPtr in subsets.
 void SubsetLoadBalancer::forEachSubset(LbSubsetMap& subsets,
                                        std::function<void(LbSubsetEntryPtr&)> cb) {
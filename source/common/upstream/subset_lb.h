@@ -19,6 +19,7 @@
 #include "source/common/upstream/load_balancer_impl.h"
 #include "source/common/upstream/upstream_impl.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "absl/container/node_hash_map.h"
 #include "absl/types/optional.h"
 
@@ -144,6 +145,32 @@ private:
   using SubsetSelectorMapPtr = std::shared_ptr<SubsetSelectorMap>;
   using ValueSubsetMap = absl::node_hash_map<HashedValue, LbSubsetEntryPtr>;
   using LbSubsetMap = absl::node_hash_map<std::string, ValueSubsetMap>;
+
+  // A subset entry's full key path. Values are stored as HashedValue so each value's hash is
+  // computed once at update time and reused for every lookup.
+  using SubsetMetadataIndexKey = std::vector<std::pair<std::string, HashedValue>>;
+  using MetadataMatchCriteriaVector = std::vector<Router::MetadataMatchCriterionConstSharedPtr>;
+
+  // Heterogeneous hash/equality so a route's metadata match criteria can be looked up in the
+  // subset index directly, without materializing a SubsetMetadataIndexKey per request. Both index
+  // keys and criteria are lexically sorted by key name, so element-wise comparison suffices. See
+  // HeterogeneousStringHash for background on is_transparent.
+  struct SubsetIndexHash {
+    using is_transparent = void; // NOLINT(readability-identifier-naming)
+    uint64_t operator()(const SubsetMetadataIndexKey& kvs) const;
+    uint64_t operator()(const MetadataMatchCriteriaVector& criteria) const;
+  };
+  struct SubsetIndexEqual {
+    using is_transparent = void; // NOLINT(readability-identifier-naming)
+    bool operator()(const SubsetMetadataIndexKey& lhs, const SubsetMetadataIndexKey& rhs) const;
+    bool operator()(const SubsetMetadataIndexKey& lhs,
+                    const MetadataMatchCriteriaVector& rhs) const;
+    bool operator()(const MetadataMatchCriteriaVector& lhs,
+                    const SubsetMetadataIndexKey& rhs) const;
+  };
+  using LbSubsetIndex =
+      absl::flat_hash_map<SubsetMetadataIndexKey, LbSubsetEntryPtr, SubsetIndexHash,
+                          SubsetIndexEqual>;
   using SubsetSelectorFallbackParamsRef = std::reference_wrapper<SubsetSelectorFallbackParams>;
   using MetadataFallbacks = ProtobufWkt::RepeatedPtrField<ProtobufWkt::Value>;
 
@@ -419,6 +446,10 @@ private:
 
   // Forms a trie-like structure. Requires lexically sorted Host and Route metadata.
   LbSubsetMap subsets_;
+  // Flat, pre-hashed index from a full selector key path to its subset entry. This is the data
+  // path lookup structure; subsets_ is retained for hierarchical bookkeeping (creation,
+  // iteration and purging of entries).
+  LbSubsetIndex subset_index_;
   // Forms a trie-like structure of lexically sorted keys+fallback policy from subset
   // selectors configuration
   SubsetSelectorMapPtr selectors_;
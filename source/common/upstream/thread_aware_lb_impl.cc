@@ -1,5 +1,6 @@
 #include "source/common/upstream/thread_aware_lb_impl.h"
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -110,6 +111,16 @@ void ThreadAwareLoadBalancerBase::refresh() {
   auto degraded_per_priority_load =
       std::make_shared<DegradedLoad>(per_priority_load_.degraded_priority_load_);
 
+  // Priorities whose effective inputs are identical within this refresh (common when the same
+  // endpoints back several priorities) share one ring/table instead of carrying duplicates.
+  std::vector<std::pair<const NormalizedHostWeightVector*, HashingLoadBalancerSharedPtr>>
+      built_this_refresh;
+
+  // Size the cache up front so entries (and pointers into them) stay stable across the loop.
+  if (rebuild_cache_.size() < priority_set_.hostSetsPerPriority().size()) {
+    rebuild_cache_.resize(priority_set_.hostSetsPerPriority().size());
+  }
+
   for (const auto& host_set : priority_set_.hostSetsPerPriority()) {
     const uint32_t priority = host_set->priority();
     (*per_priority_state_vector)[priority] = std::make_unique<PerPriorityState>();
@@ -124,8 +135,40 @@ void ThreadAwareLoadBalancerBase::refresh() {
     double max_normalized_weight = 0.0;
     normalizeWeights(*host_set, per_priority_state->global_panic_, normalized_host_weights,
                      min_normalized_weight, max_normalized_weight, locality_weighted_balancing_);
-    per_priority_state->current_lb_ = createLoadBalancer(
-        std::move(normalized_host_weights), min_normalized_weight, max_normalized_weight);
+
+    // Ring/table construction is the expensive part of a refresh (e.g. a 65537-entry Maglev
+    // table), while many EDS-driven refreshes do not change the effective inputs for a given
+    // priority at all. Reuse the previous ring/table when the normalized weights and panic state
+    // are unchanged; host identity is compared by shared pointer so this is a cheap vector scan.
+    auto& cache = rebuild_cache_[priority];
+    if (cache.lb_ != nullptr && cache.global_panic_ == per_priority_state->global_panic_ &&
+        cache.normalized_host_weights_ == normalized_host_weights) {
+      ENVOY_LOG_MISC(debug, "reusing previous hashing LB for priority {}: inputs unchanged",
+                     priority);
+      per_priority_state->current_lb_ = cache.lb_;
+      built_this_refresh.emplace_back(&cache.normalized_host_weights_, cache.lb_);
+      continue;
+    }
+
+    // Check whether a lower priority in this refresh already built the same ring/table.
+    const auto shared_it = std::find_if(
+        built_this_refresh.begin(), built_this_refresh.end(),
+        [&normalized_host_weights](const auto& built) {
+          return *built.first == normalized_host_weights;
+        });
+    if (shared_it != built_this_refresh.end()) {
+      ENVOY_LOG_MISC(debug, "sharing hashing LB for priority {}: identical host weights",
+                     priority);
+      per_priority_state->current_lb_ = shared_it->second;
+    } else {
+      per_priority_state->current_lb_ = createLoadBalancer(
+          normalized_host_weights, min_normalized_weight, max_normalized_weight);
+    }
+    rebuild_cache_[priority] = {std::move(normalized_host_weights),
+                                per_priority_state->global_panic_,
+                                per_priority_state->current_lb_};
+    built_this_refresh.emplace_back(&rebuild_cache_[priority].normalized_host_weights_,
+                                    per_priority_state->current_lb_);
   }
 
   {
@@ -163,12 +163,23 @@ private:
     std::shared_ptr<DegradedLoad> degraded_per_priority_load_ ABSL_GUARDED_BY(mutex_);
   };
 
+  // Caches the inputs and output of the last createLoadBalancer() call for one priority so that
+  // refreshes which do not change the effective host weights (metadata-only EDS updates, health
+  // changes in other priorities) can reuse the previously built ring/table instead of
+  // reconstructing it.
+  struct PriorityRebuildCache {
+    NormalizedHostWeightVector normalized_host_weights_;
+    bool global_panic_{};
+    HashingLoadBalancerSharedPtr lb_;
+  };
+
   virtual HashingLoadBalancerSharedPtr
   createLoadBalancer(const NormalizedHostWeightVector& normalized_host_weights,
                      double min_normalized_weight, double max_normalized_weight) PURE;
   void refresh();
 
   std::shared_ptr<LoadBalancerFactoryImpl> factory_;
+  std::vector<PriorityRebuildCache> rebuild_cache_;
   const bool locality_weighted_balancing_{};
   Common::CallbackHandlePtr priority_update_cb_;
 };
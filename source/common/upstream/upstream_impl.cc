@@ -24,6 +24,7 @@
 #include "envoy/network/transport_socket.h"
 #include "envoy/secret/secret_manager.h"
 #include "envoy/server/filter_config.h"
+#include "envoy/singleton/manager.h"
 #include "envoy/server/transport_socket_config.h"
 #include "envoy/ssl/context_manager.h"
 #include "envoy/stats/scope.h"
@@ -48,6 +49,7 @@
 #include "source/common/router/config_utility.h"
 #include "source/common/runtime/runtime_features.h"
 #include "source/common/runtime/runtime_impl.h"
+#include "source/common/shared_pool/shared_pool.h"
 #include "source/common/upstream/cluster_factory_impl.h"
 #include "source/common/upstream/health_checker_impl.h"
 #include "source/extensions/filters/network/http_connection_manager/config.h"
@@ -58,8 +60,26 @@
 
 namespace Envoy {
 namespace Upstream {
+
+SINGLETON_MANAGER_REGISTRATION(common_lb_config_shared_pool);
+
 namespace {
 
+// Many clusters differ only in name and carry identical CommonLbConfig sub-messages. Intern
+// them in a process-wide shared pool so that all clusters with the same canonical config share
+// one immutable copy instead of each holding its own.
+std::shared_ptr<const envoy::config::cluster::v3::Cluster::CommonLbConfig>
+getCommonLbConfigShared(const envoy::config::cluster::v3::Cluster::CommonLbConfig& config,
+                        Server::Configuration::ServerFactoryContext& context) {
+  using CommonLbConfigSharedPool =
+      SharedPool::ObjectSharedPool<const envoy::config::cluster::v3::Cluster::CommonLbConfig,
+                                   MessageUtil, MessageUtil>;
+  auto pool = context.singletonManager().getTyped<CommonLbConfigSharedPool>(
+      SINGLETON_MANAGER_REGISTERED_NAME(common_lb_config_shared_pool),
+      [] { return std::make_shared<CommonLbConfigSharedPool>(); });
+  return pool->getObject(config);
+}
+
 std::string addressToString(Network::Address::InstanceConstSharedPtr address) {
   if (!address) {
     return "";
@@ -271,6 +291,10 @@ UpstreamLocalAddressSelectorImpl::buildBaseSocketOptions(
                                    Network::SocketOptionFactory::buildTcpKeepaliveOptions(
                                        parseTcpKeepaliveConfig(cluster_config)));
   }
+  if (cluster_config.upstream_connection_options().tcp_fast_open()) {
+    Network::Socket::appendOptions(
+        base_options, Network::SocketOptionFactory::buildTcpFastOpenConnectOptions());
+  }
 
   return base_options;
 }
@@ -996,6 +1020,16 @@ LBPolicyConfig::LBPolicyConfig(const envoy::config::cluster::v3::Cluster& config
   }
 }
 
+namespace {
+
+// Whether cluster stat blocks should defer instantiation until first access.
+bool deferredStatsEnabled() {
+  return Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.deferred_cluster_traffic_stats");
+}
+
+} // namespace
+
 ClusterInfoImpl::ClusterInfoImpl(
     Init::Manager& init_manager, Server::Configuration::ServerFactoryContext& server_context,
     const envoy::config::cluster::v3::Cluster& config,
@@ -1025,12 +1059,14 @@ ClusterInfoImpl::ClusterInfoImpl(
       peekahead_ratio_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config.preconnect_policy(),
                                                        predictive_preconnect_ratio, 0)),
       socket_matcher_(std::move(socket_matcher)), stats_scope_(std::move(stats_scope)),
-      traffic_stats_(
-          generateStats(*stats_scope_, factory_context.clusterManager().clusterStatNames())),
-      config_update_stats_(factory_context.clusterManager().clusterConfigUpdateStatNames(),
-                           *stats_scope_),
-      lb_stats_(factory_context.clusterManager().clusterLbStatNames(), *stats_scope_),
-      endpoint_stats_(factory_context.clusterManager().clusterEndpointStatNames(), *stats_scope_),
+      stat_names_(factory_context.clusterManager().clusterStatNames()),
+      config_update_stats_(stats_scope_,
+                           factory_context.clusterManager().clusterConfigUpdateStatNames(),
+                           deferredStatsEnabled()),
+      lb_stats_(stats_scope_, factory_context.clusterManager().clusterLbStatNames(),
+                deferredStatsEnabled()),
+      endpoint_stats_(stats_scope_, factory_context.clusterManager().clusterEndpointStatNames(),
+                      deferredStatsEnabled()),
       load_report_stats_store_(stats_scope_->symbolTable()),
       load_report_stats_(
           generateLoadReportStats(*load_report_stats_store_.rootScope(),
@@ -1060,7 +1096,7 @@ ClusterInfoImpl::ClusterInfoImpl(
       typed_metadata_(config.has_metadata()
                           ? std::make_unique<ClusterTypedMetadata>(config.metadata())
                           : nullptr),
-      common_lb_config_(config.common_lb_config()),
+      common_lb_config_(getCommonLbConfigShared(config.common_lb_config(), server_context)),
       cluster_type_(config.has_cluster_type()
                         ? std::make_unique<envoy::config::cluster::v3::Cluster::CustomClusterType>(
                               config.cluster_type())
@@ -1079,10 +1115,15 @@ ClusterInfoImpl::ClusterInfoImpl(
       connection_pool_per_downstream_connection_(
           config.connection_pool_per_downstream_connection()),
       warm_hosts_(!config.health_checks().empty() &&
-                  common_lb_config_.ignore_new_hosts_until_first_hc()),
+                  common_lb_config_->ignore_new_hosts_until_first_hc()),
       set_local_interface_name_on_upstream_connections_(
           config.upstream_connection_options().set_local_interface_name_on_upstream_connections()),
       added_via_api_(added_via_api), has_configured_http_filters_(false) {
+  if (!deferredStatsEnabled()) {
+    // Instantiate the traffic stats block eagerly, preserving the long-standing behavior that
+    // every cluster's stats exist (at zero) from the moment the cluster is added.
+    trafficStats();
+  }
 #ifdef WIN32
   if (set_local_interface_name_on_upstream_connections_) {
     throw EnvoyException("set_local_interface_name_on_upstream_connections_ cannot be set to true "
@@ -1191,7 +1232,7 @@ ClusterInfoImpl::ClusterInfoImpl(
   // TODO(htuch): Remove this temporary workaround when we have
   // https://github.com/bufbuild/protoc-gen-validate/issues/97 resolved. This just provides
   // early validation of sanity of fields that we should catch at config ingestion.
-  DurationUtil::durationToMilliseconds(common_lb_config_.update_merge_window());
+  DurationUtil::durationToMilliseconds(common_lb_config_->update_merge_window());
 
   // Create upstream filter factories
   const auto& filters = config.filters();
@@ -1359,7 +1400,7 @@ ClusterImplBase::ClusterImplBase(Server::Configuration::ServerFactoryContext& se
       local_cluster_(cluster_context.clusterManager().localClusterName().value_or("") ==
                      cluster.name()),
       const_metadata_shared_pool_(Config::Metadata::getConstMetadataSharedPool(
-          cluster_context.singletonManager(), cluster_context.mainThreadDispatcher())) {
+          cluster_context.singletonManager())) {
 
   auto stats_scope = generateStatsScope(cluster, cluster_context.stats());
   transport_factory_context_ =
@@ -1456,11 +1497,16 @@ ClusterImplBase::partitionHostList(const HostVector& hosts) {
   auto degraded_list = std::make_shared<DegradedHostVector>();
   auto excluded_list = std::make_shared<ExcludedHostVector>();
 
+  // In the common case nearly every host is healthy, so reserving up front avoids repeated
+  // growth copies on large clusters; degraded and excluded are typically small.
+  healthy_list->get().reserve(hosts.size());
+
   for (const auto& host : hosts) {
-    if (host->coarseHealth() == Host::Health::Healthy) {
+    // coarseHealth() folds several atomic flag reads, so compute it once per host.
+    const Host::Health health = host->coarseHealth();
+    if (health == Host::Health::Healthy) {
       healthy_list->get().emplace_back(host);
-    }
-    if (host->coarseHealth() == Host::Health::Degraded) {
+    } else if (health == Host::Health::Degraded) {
       degraded_list->get().emplace_back(host);
     }
     if (excludeBasedOnHealthFlag(*host)) {
@@ -1839,6 +1885,7 @@ void PriorityStateManager::initializePriorityFor(
 
 void PriorityStateManager::registerHostForPriority(
     const std::string& hostname, Network::Address::InstanceConstSharedPtr address,
+    const std::vector<Network::Address::InstanceConstSharedPtr>& address_list,
     const envoy::config::endpoint::v3::LocalityLbEndpoints& locality_lb_endpoint,
     const envoy::config::endpoint::v3::LbEndpoint& lb_endpoint, TimeSource& time_source) {
   auto metadata = lb_endpoint.has_metadata()
@@ -1848,6 +1895,10 @@ void PriorityStateManager::registerHostForPriority(
       parent_.info(), hostname, address, metadata, lb_endpoint.load_balancing_weight().value(),
       locality_lb_endpoint.locality(), lb_endpoint.endpoint().health_check_config(),
       locality_lb_endpoint.priority(), lb_endpoint.health_status(), time_source);
+  if (!address_list.empty()) {
+    ASSERT(*address_list.front() == *address);
+    host->setAddressList(address_list);
+  }
   registerHostForPriority(host, locality_lb_endpoint);
 }
 
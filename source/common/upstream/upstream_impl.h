@@ -55,6 +55,7 @@
 #include "source/common/init/manager_impl.h"
 #include "source/common/network/utility.h"
 #include "source/common/shared_pool/shared_pool.h"
+#include "source/common/stats/deferred_creation.h"
 #include "source/common/stats/isolated_store_impl.h"
 #include "source/common/upstream/load_balancer_impl.h"
 #include "source/common/upstream/resource_manager_impl.h"
@@ -64,6 +65,7 @@
 #include "source/extensions/upstreams/tcp/config.h"
 #include "source/server/transport_socket_config_impl.h"
 
+#include "absl/base/call_once.h"
 #include "absl/container/node_hash_set.h"
 #include "absl/synchronization/mutex.h"
 
@@ -794,7 +796,7 @@ public:
   }
   TypedLoadBalancerFactory* loadBalancerFactory() const override { return load_balancer_factory_; }
   const envoy::config::cluster::v3::Cluster::CommonLbConfig& lbConfig() const override {
-    return common_lb_config_;
+    return *common_lb_config_;
   }
   std::chrono::milliseconds connectTimeout() const override { return connect_timeout_; }
 
@@ -896,10 +898,19 @@ public:
   }
   ResourceManager& resourceManager(ResourcePriority priority) const override;
   TransportSocketMatcher& transportSocketMatcher() const override { return *socket_matcher_; }
-  LazyClusterTrafficStats& trafficStats() const override { return traffic_stats_; }
-  ClusterConfigUpdateStats& configUpdateStats() const override { return config_update_stats_; }
-  ClusterLbStats& lbStats() const override { return lb_stats_; }
-  ClusterEndpointStats& endpointStats() const override { return endpoint_stats_; }
+  LazyClusterTrafficStats& trafficStats() const override {
+    // With envoy.reloadable_features.deferred_cluster_traffic_stats enabled the stats block is
+    // only allocated on first use, so clusters that never receive traffic never pay for it.
+    // After the first call this is a single atomic load.
+    absl::call_once(traffic_stats_once_,
+                    [this] { traffic_stats_ = generateStats(*stats_scope_, stat_names_); });
+    return traffic_stats_;
+  }
+  ClusterConfigUpdateStats& configUpdateStats() const override {
+    return config_update_stats_.get();
+  }
+  ClusterLbStats& lbStats() const override { return lb_stats_.get(); }
+  ClusterEndpointStats& endpointStats() const override { return endpoint_stats_.get(); }
   Stats::Scope& statsScope() const override { return *stats_scope_; }
 
   ClusterRequestResponseSizeStatsOptRef requestResponseSizeStats() const override {
@@ -1037,10 +1048,14 @@ private:
   const float peekahead_ratio_;
   TransportSocketMatcherPtr socket_matcher_;
   Stats::ScopeSharedPtr stats_scope_;
+  const ClusterTrafficStatNames& stat_names_;
+  mutable absl::once_flag traffic_stats_once_;
   mutable LazyClusterTrafficStats traffic_stats_;
-  mutable ClusterConfigUpdateStats config_update_stats_;
-  mutable ClusterLbStats lb_stats_;
-  mutable ClusterEndpointStats endpoint_stats_;
+  // These blocks follow the same deferred-creation policy as traffic_stats_ above: with the
+  // runtime guard enabled they are only instantiated on first access.
+  mutable Stats::DeferredCreationCompatibleStats<ClusterConfigUpdateStats> config_update_stats_;
+  mutable Stats::DeferredCreationCompatibleStats<ClusterLbStats> lb_stats_;
+  mutable Stats::DeferredCreationCompatibleStats<ClusterEndpointStats> endpoint_stats_;
   Stats::IsolatedStoreImpl load_report_stats_store_;
   mutable ClusterLoadReportStats load_report_stats_;
   const std::unique_ptr<OptionalClusterStats> optional_cluster_stats_;
@@ -1055,7 +1070,9 @@ private:
   std::unique_ptr<ClusterTypedMetadata> typed_metadata_;
   ProtobufTypes::MessagePtr load_balancing_policy_;
   TypedLoadBalancerFactory* load_balancer_factory_ = nullptr;
-  const envoy::config::cluster::v3::Cluster::CommonLbConfig common_lb_config_;
+  // Shared with all other clusters that carry an identical CommonLbConfig, via a process-wide
+  // ObjectSharedPool keyed on the canonical (deterministically hashed) form of the message.
+  std::shared_ptr<const envoy::config::cluster::v3::Cluster::CommonLbConfig> common_lb_config_;
   absl::optional<std::string> eds_service_name_;
   std::unique_ptr<const envoy::config::cluster::v3::Cluster::CustomClusterType> cluster_type_;
   const std::unique_ptr<Server::Configuration::CommonFactoryContext> factory_context_;
@@ -1230,8 +1247,13 @@ public:
   //
   // The specified health_checker_flag is used to set the registered-host's health-flag when the
   // lb_endpoint health status is unhealthy, draining or timeout.
+  //
+  // `address_list` is either empty, or the list of all the addresses of the endpoint with
+  // `address` as its first entry. When it has more than one entry, new connections race the
+  // addresses happy-eyeballs style and adopt the first one to connect.
   void registerHostForPriority(
       const std::string& hostname, Network::Address::InstanceConstSharedPtr address,
+      const std::vector<Network::Address::InstanceConstSharedPtr>& address_list,
       const envoy::config::endpoint::v3::LocalityLbEndpoints& locality_lb_endpoint,
       const envoy::config::endpoint::v3::LbEndpoint& lb_endpoint, TimeSource& time_source);
 
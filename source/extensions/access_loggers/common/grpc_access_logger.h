@@ -202,7 +202,8 @@ public:
  */
 #define ALL_GRPC_ACCESS_LOGGER_STATS(COUNTER)                                                      \
   COUNTER(logs_written)                                                                            \
-  COUNTER(logs_dropped)
+  COUNTER(logs_dropped)                                                                            \
+  COUNTER(critical_logs_dropped)
 
 /**
  * Wrapper struct for the access log stats. @see stats_macros.h
@@ -245,7 +246,7 @@ public:
   }
 
   void log(HttpLogProto&& entry) override {
-    if (!canLogMore()) {
+    if (!canLogMore(isCriticalEntry(entry))) {
       return;
     }
     approximate_message_size_bytes_ += entry.ByteSizeLong();
@@ -256,6 +257,9 @@ public:
   }
 
   void log(TcpLogProto&& entry) override {
+    if (!canLogMore(isCriticalEntry(entry))) {
+      return;
+    }
     approximate_message_size_bytes_ += entry.ByteSizeLong();
     addEntry(std::move(entry));
     if (approximate_message_size_bytes_ >= max_buffer_size_bytes_) {
@@ -274,6 +278,12 @@ private:
   virtual void addEntry(TcpLogProto&& entry) PURE;
   virtual void clearMessage() { message_.Clear(); }
 
+  // Whether the entry records a failure that should survive shedding when the collector applies
+  // back-pressure. Critical entries are granted extra buffer headroom so that sampled successes
+  // are dropped first. Concrete loggers override this for the entry types they understand.
+  virtual bool isCriticalEntry(const HttpLogProto&) { return false; }
+  virtual bool isCriticalEntry(const TcpLogProto&) { return false; }
+
   void flush() {
     if (isEmpty()) {
       // Nothing to flush.
@@ -291,7 +301,7 @@ private:
     }
   }
 
-  bool canLogMore() {
+  bool canLogMore(bool critical) {
     if (max_buffer_size_bytes_ == 0 || approximate_message_size_bytes_ < max_buffer_size_bytes_) {
       stats_.logs_written_.inc();
       return true;
@@ -301,7 +311,17 @@ private:
       stats_.logs_written_.inc();
       return true;
     }
+    // The buffer can only stay full here when the stream is above its flow-control watermark or
+    // the collector is down. Entries that record failures get twice the configured headroom so
+    // that sampled successes are shed first during collector incidents.
+    if (critical && approximate_message_size_bytes_ < 2 * max_buffer_size_bytes_) {
+      stats_.logs_written_.inc();
+      return true;
+    }
     stats_.logs_dropped_.inc();
+    if (critical) {
+      stats_.critical_logs_dropped_.inc();
+    }
     return false;
   }
 
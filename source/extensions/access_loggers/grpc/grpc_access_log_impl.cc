@@ -36,6 +36,14 @@ bool GrpcAccessLoggerImpl::isEmpty() {
   return !message_.has_http_logs() && !message_.has_tcp_logs();
 }
 
+bool GrpcAccessLoggerImpl::isCriticalEntry(
+    const envoy::data::accesslog::v3::HTTPAccessLogEntry& entry) {
+  // Failed requests are what operators need most during a collector incident: requests that never
+  // completed and 5xx responses are retained in preference to sampled successes.
+  return !entry.has_response() || !entry.response().has_response_code() ||
+         entry.response().response_code().value() >= 500;
+}
+
 void GrpcAccessLoggerImpl::initMessage() {
   auto* identifier = message_.mutable_identifier();
   *identifier->mutable_node() = local_info_.node();
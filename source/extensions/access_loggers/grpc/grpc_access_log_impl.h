@@ -34,6 +34,7 @@ private:
   void addEntry(envoy::data::accesslog::v3::TCPAccessLogEntry&& entry) override;
   bool isEmpty() override;
   void initMessage() override;
+  bool isCriticalEntry(const envoy::data::accesslog::v3::HTTPAccessLogEntry& entry) override;
 
   const std::string log_name_;
   const LocalInfo::LocalInfo& local_info_;
@@ -163,13 +163,11 @@ AggregateClusterLoadBalancer::LoadBalancerImpl::chooseHost(Upstream::LoadBalance
       choosePriority(random_.random(), priority_loads->healthy_priority_load_,
                      priority_loads->degraded_priority_load_);
 
-  AggregateLoadBalancerContext aggregate_context(
-      context, priority_pair.second,
-      priority_context_.priority_to_cluster_[priority_pair.first].first);
+  const auto& cluster_and_priority = priority_context_.priority_to_cluster_[priority_pair.first];
+  AggregateLoadBalancerContext aggregate_context(context, priority_pair.second,
+                                                 cluster_and_priority.first);
 
-  Upstream::ThreadLocalCluster* cluster =
-      priority_context_.priority_to_cluster_[priority_pair.first].second;
-  return cluster->loadBalancer().chooseHost(&aggregate_context);
+  return cluster_and_priority.second->loadBalancer().chooseHost(&aggregate_context);
 }
 
 Upstream::HostConstSharedPtr
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string>
 
 #include "envoy/config/cluster/v3/cluster.pb.h"
@@ -124,14 +125,10 @@ private:
     const std::shared_ptr<OriginalDstCluster> cluster_;
   };
 
-  HostMultiMapConstSharedPtr getCurrentHostMap() {
-    absl::ReaderMutexLock lock(&host_map_lock_);
-    return host_map_;
-  }
+  HostMultiMapConstSharedPtr getCurrentHostMap() { return std::atomic_load(&host_map_); }
 
   void setHostMap(const HostMultiMapConstSharedPtr& new_host_map) {
-    absl::WriterMutexLock lock(&host_map_lock_);
-    host_map_ = new_host_map;
+    std::atomic_store(&host_map_, new_host_map);
   }
 
   void addHost(HostSharedPtr&);
@@ -144,8 +141,11 @@ private:
   const std::chrono::milliseconds cleanup_interval_ms_;
   Event::TimerPtr cleanup_timer_;
 
-  absl::Mutex host_map_lock_;
-  HostMultiMapConstSharedPtr host_map_ ABSL_GUARDED_BY(host_map_lock_);
+  // Immutable snapshot published copy-on-write: workers read it with std::atomic_load when
+  // (re)building their load balancers and never take a lock on the per-flow lookup path, while
+  // addHost()/cleanup() replace it wholesale with std::atomic_store. Both writers run on the main
+  // dispatcher, so writes never race each other.
+  HostMultiMapConstSharedPtr host_map_;
   absl::optional<Http::LowerCaseString> http_header_name_;
   absl::optional<uint32_t> port_override_;
   friend class OriginalDstClusterFactory;
@@ -31,9 +31,17 @@ StaticClusterImpl::StaticClusterImpl(Server::Configuration::ServerFactoryContext
                       cluster.name()));
     }
     for (const auto& lb_endpoint : locality_lb_endpoint.lb_endpoints()) {
-      priority_state_manager_->registerHostForPriority(
-          lb_endpoint.endpoint().hostname(), resolveProtoAddress(lb_endpoint.endpoint().address()),
-          locality_lb_endpoint, lb_endpoint, dispatcher.timeSource());
+      const auto address = resolveProtoAddress(lb_endpoint.endpoint().address());
+      std::vector<Network::Address::InstanceConstSharedPtr> address_list;
+      if (!lb_endpoint.endpoint().additional_addresses().empty()) {
+        address_list.push_back(address);
+        for (const auto& additional_address : lb_endpoint.endpoint().additional_addresses()) {
+          address_list.emplace_back(resolveProtoAddress(additional_address.address()));
+        }
+      }
+      priority_state_manager_->registerHostForPriority(lb_endpoint.endpoint().hostname(), address,
+                                                       address_list, locality_lb_endpoint,
+                                                       lb_endpoint, dispatcher.timeSource());
     }
   }
 }
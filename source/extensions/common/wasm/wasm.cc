@@ -47,14 +47,46 @@ private:
   std::unique_ptr<Config::DataFetcher::RemoteDataFetcher> fetcher_;
 };
 
+// Keeps a successfully compiled base VM alive for a while after the last config referencing it
+// is gone. The proxy-wasm host library deduplicates base VMs by vm key but only holds weak
+// references, so without this a config update that momentarily drops the last strong reference
+// recompiles the module from scratch. Entries are refreshed on reuse and pruned by TTL.
+struct BaseWasmCacheEntry {
+  WasmHandleSharedPtr handle;
+  MonotonicTime use_time;
+};
+
 const std::string INLINE_STRING = "<inline>";
 const int CODE_CACHE_SECONDS_NEGATIVE_CACHING = 10;
 const int CODE_CACHE_SECONDS_CACHING_TTL = 24 * 3600; // 24 hours.
+const int BASE_WASM_CACHE_SECONDS_CACHING_TTL = 300;  // 5 minutes.
 MonotonicTime::duration cache_time_offset_for_testing{};
 
 std::mutex code_cache_mutex;
 absl::flat_hash_map<std::string, CodeCacheEntry>* code_cache = nullptr;
 
+std::mutex base_wasm_cache_mutex;
+absl::flat_hash_map<std::string, BaseWasmCacheEntry>* base_wasm_cache = nullptr;
+
+void cacheBaseWasm(const std::string& vm_key, const WasmHandleSharedPtr& handle,
+                   MonotonicTime now) {
+  std::lock_guard<std::mutex> guard(base_wasm_cache_mutex);
+  if (!base_wasm_cache) {
+    base_wasm_cache = new std::remove_reference<decltype(*base_wasm_cache)>::type;
+  }
+  for (auto it = base_wasm_cache->begin(); it != base_wasm_cache->end();) {
+    if (now - it->second.use_time > std::chrono::seconds(BASE_WASM_CACHE_SECONDS_CACHING_TTL) &&
+        it->first != vm_key) {
+      base_wasm_cache->erase(it++);
+    } else {
+      ++it;
+    }
+  }
+  auto& entry = (*base_wasm_cache)[vm_key];
+  entry.handle = handle;
+  entry.use_time = now;
+}
+
 // Downcast WasmBase to the actual Wasm.
 inline Wasm* getWasm(WasmHandleSharedPtr& base_wasm_handle) {
   return static_cast<Wasm*>(base_wasm_handle->wasm().get());
@@ -240,10 +272,19 @@ void Wasm::onStatsUpdate(const PluginSharedPtr& plugin, Envoy::Stats::MetricSnap
 }
 
 void clearCodeCacheForTesting() {
-  std::lock_guard<std::mutex> guard(code_cache_mutex);
-  if (code_cache) {
-    delete code_cache;
-    code_cache = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(code_cache_mutex);
+    if (code_cache) {
+      delete code_cache;
+      code_cache = nullptr;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> guard(base_wasm_cache_mutex);
+    if (base_wasm_cache) {
+      delete base_wasm_cache;
+      base_wasm_cache = nullptr;
+    }
   }
   getCreateStatsHandler().resetStatsForTesting();
 }
@@ -405,7 +446,12 @@ bool createWasm(const PluginSharedPtr& plugin, const Stats::ScopeSharedPtr& scop
       cb(nullptr);
       return false;
     }
-    cb(std::static_pointer_cast<WasmHandle>(wasm));
+    auto handle = std::static_pointer_cast<WasmHandle>(wasm);
+    // Pin the compiled base VM so that config updates which reference the same module reuse it
+    // rather than recompiling, even if the previous config is drained first.
+    cacheBaseWasm(vm_key, handle,
+                  dispatcher.timeSource().monotonicTime() + cache_time_offset_for_testing);
+    cb(handle);
     return true;
   };
 
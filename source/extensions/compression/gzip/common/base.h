@@ -12,6 +12,8 @@ namespace Compression {
 namespace Gzip {
 namespace Common {
 
+using ZstreamPtr = std::unique_ptr<z_stream, std::function<void(z_stream*)>>;
+
 /**
  * Shared code between the compressor and the decompressor.
  */
@@ -19,6 +21,12 @@ class Base {
 public:
   Base(uint64_t chunk_size, std::function<void(z_stream*)> zstream_deleter);
 
+  /**
+   * Constructor taking ownership of an existing stream, e.g. one recycled through the per-thread
+   * inflate context cache.
+   */
+  Base(uint64_t chunk_size, ZstreamPtr zstream);
+
   /**
    * It returns the checksum of all output produced so far. Compressor's checksum at the end of
    * the stream has to match decompressor's checksum produced at the end of the decompression.
@@ -36,7 +44,7 @@ protected:
   bool initialized_{false};
 
   const std::unique_ptr<unsigned char[]> chunk_char_ptr_;
-  const std::unique_ptr<z_stream, std::function<void(z_stream*)>> zstream_ptr_;
+  const ZstreamPtr zstream_ptr_;
 };
 
 } // namespace Common
@@ -0,0 +1,53 @@
+#include "source/extensions/compression/gzip/common/inflate_context_cache.h"
+
+#include <vector>
+
+namespace Envoy {
+namespace Extensions {
+namespace Compression {
+namespace Gzip {
+namespace Common {
+namespace {
+
+// Upper bound on idle inflate streams retained per thread. Each stream holds up to a 32 KiB
+// sliding window plus inflate state, so the cache is kept small.
+constexpr size_t MaxCachedStreamsPerThread = 8;
+
+void destroyInflateContext(z_stream* zstream) {
+  inflateEnd(zstream);
+  delete zstream;
+}
+
+std::vector<ZstreamPtr>& inflateContextCache() {
+  static thread_local std::vector<ZstreamPtr> cache;
+  return cache;
+}
+
+void releaseInflateContext(z_stream* zstream) {
+  std::vector<ZstreamPtr>& cache = inflateContextCache();
+  // inflateReset() both rewinds the stream for reuse and rejects streams that were never
+  // successfully initialized, which must not be recycled.
+  if (cache.size() >= MaxCachedStreamsPerThread || inflateReset(zstream) != Z_OK) {
+    destroyInflateContext(zstream);
+    return;
+  }
+  cache.emplace_back(zstream, &destroyInflateContext);
+}
+
+} // namespace
+
+InflateContext acquireInflateContext() {
+  std::vector<ZstreamPtr>& cache = inflateContextCache();
+  if (!cache.empty()) {
+    ZstreamPtr stream(cache.back().release(), &releaseInflateContext);
+    cache.pop_back();
+    return {std::move(stream), true};
+  }
+  return {ZstreamPtr(new z_stream(), &releaseInflateContext), false};
+}
+
+} // namespace Common
+} // namespace Gzip
+} // namespace Compression
+} // namespace Extensions
+} // namespace Envoy
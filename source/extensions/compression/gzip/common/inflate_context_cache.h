@@ -0,0 +1,35 @@
+#pragma once
+
+#include "source/extensions/compression/gzip/common/base.h"
+
+#include "zlib.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Compression {
+namespace Gzip {
+namespace Common {
+
+/**
+ * An inflate stream paired with a flag telling whether it was recycled from the calling thread's
+ * cache. Recycled streams already hold allocated inflate state and must be re-armed with
+ * inflateReset2() rather than initialized with inflateInit2().
+ */
+struct InflateContext {
+  ZstreamPtr stream_;
+  bool recycled_{false};
+};
+
+/**
+ * Returns an inflate stream for the calling thread. Streams are recycled through a small
+ * per-thread cache when their owning decompressor is destroyed, so the allocations done by
+ * inflateInit2() (inflate state plus sliding window) are not repeated for every decompressed
+ * stream. The returned pointer's deleter performs the recycling; no explicit release is needed.
+ */
+InflateContext acquireInflateContext();
+
+} // namespace Common
+} // namespace Gzip
+} // namespace Compression
+} // namespace Extensions
+} // namespace Envoy
@@ -19,22 +19,32 @@ namespace Decompressor {
 
 ZlibDecompressorImpl::ZlibDecompressorImpl(Stats::Scope& scope, const std::string& stats_prefix,
                                            uint64_t chunk_size, uint64_t max_inflate_ratio)
-    : Common::Base(chunk_size,
-                   [](z_stream* z) {
-                     inflateEnd(z);
-                     delete z;
-                   }),
-      stats_(generateStats(stats_prefix, scope)), max_inflate_ratio_(max_inflate_ratio) {
-  zstream_ptr_->zalloc = Z_NULL;
-  zstream_ptr_->zfree = Z_NULL;
-  zstream_ptr_->opaque = Z_NULL;
+    : ZlibDecompressorImpl(scope, stats_prefix, chunk_size, max_inflate_ratio,
+                           Common::acquireInflateContext()) {}
+
+ZlibDecompressorImpl::ZlibDecompressorImpl(Stats::Scope& scope, const std::string& stats_prefix,
+                                           uint64_t chunk_size, uint64_t max_inflate_ratio,
+                                           Common::InflateContext context)
+    : Common::Base(chunk_size, std::move(context.stream_)),
+      stats_(generateStats(stats_prefix, scope)), max_inflate_ratio_(max_inflate_ratio),
+      recycled_context_(context.recycled_) {
+  // Recycled streams keep the allocator fields that inflateInit2() installed; resetting those
+  // would leave the initialized inflate state without a working allocator.
+  if (!recycled_context_) {
+    zstream_ptr_->zalloc = Z_NULL;
+    zstream_ptr_->zfree = Z_NULL;
+    zstream_ptr_->opaque = Z_NULL;
+  }
   zstream_ptr_->avail_out = chunk_size_;
   zstream_ptr_->next_out = chunk_char_ptr_.get();
 }
 
 void ZlibDecompressorImpl::init(int64_t window_bits) {
   ASSERT(initialized_ == false);
-  const int result = inflateInit2(zstream_ptr_.get(), window_bits);
+  // Recycled streams already hold allocated inflate state; inflateReset2() rewinds it and applies
+  // window_bits without repeating the allocations done by inflateInit2().
+  const int result = recycled_context_ ? inflateReset2(zstream_ptr_.get(), window_bits)
+                                       : inflateInit2(zstream_ptr_.get(), window_bits);
   RELEASE_ASSERT(result >= 0, "");
   initialized_ = true;
 }
@@ -6,6 +6,7 @@
 
 #include "source/common/common/logger.h"
 #include "source/extensions/compression/gzip/common/base.h"
+#include "source/extensions/compression/gzip/common/inflate_context_cache.h"
 
 #include "zlib.h"
 
@@ -67,6 +68,9 @@ public:
   int decompression_error_{0};
 
 private:
+  ZlibDecompressorImpl(Stats::Scope& scope, const std::string& stats_prefix, uint64_t chunk_size,
+                       uint64_t max_inflate_ratio, Common::InflateContext context);
+
   // TODO: clean up friend class. This is here to allow coverage of chargeErrorStats as it isn't
   // completely straightforward
   // to cause zlib's inflate function to return all the error codes necessary to hit all the cases
@@ -81,6 +85,9 @@ private:
 
   const ZlibDecompressorStats stats_;
   const uint64_t max_inflate_ratio_;
+  // Whether zstream_ptr_ came out of the per-thread inflate context cache, in which case init()
+  // resets the already-allocated inflate state instead of initializing it from scratch.
+  const bool recycled_context_;
 };
 
 } // namespace Decompressor
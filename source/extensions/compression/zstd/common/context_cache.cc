@@ -0,0 +1,71 @@
+#include "source/extensions/compression/zstd/common/context_cache.h"
+
+#include <vector>
+
+namespace Envoy {
+namespace Extensions {
+namespace Compression {
+namespace Zstd {
+namespace Common {
+namespace {
+
+// Upper bound on idle contexts retained per thread and per context type. Zstd recommends reusing
+// contexts across streams; the bound keeps the retained workspaces small.
+constexpr size_t MaxCachedContextsPerThread = 8;
+
+template <class Context> struct ContextOps {};
+
+template <> struct ContextOps<ZSTD_CCtx> {
+  static ZSTD_CCtx* create() { return ZSTD_createCCtx(); }
+  static void destroy(ZSTD_CCtx* ctx) { ZSTD_freeCCtx(ctx); }
+  static size_t reset(ZSTD_CCtx* ctx) {
+    return ZSTD_CCtx_reset(ctx, ZSTD_reset_session_and_parameters);
+  }
+};
+
+template <> struct ContextOps<ZSTD_DCtx> {
+  static ZSTD_DCtx* create() { return ZSTD_createDCtx(); }
+  static void destroy(ZSTD_DCtx* ctx) { ZSTD_freeDCtx(ctx); }
+  static size_t reset(ZSTD_DCtx* ctx) {
+    return ZSTD_DCtx_reset(ctx, ZSTD_reset_session_and_parameters);
+  }
+};
+
+template <class Context> using CachedContextPtr = std::unique_ptr<Context, void (*)(Context*)>;
+
+template <class Context> std::vector<CachedContextPtr<Context>>& contextCache() {
+  static thread_local std::vector<CachedContextPtr<Context>> cache;
+  return cache;
+}
+
+template <class Context> void releaseContext(Context* ctx) {
+  auto& cache = contextCache<Context>();
+  // A context that fails to reset cannot be reused safely.
+  if (cache.size() >= MaxCachedContextsPerThread || ZSTD_isError(ContextOps<Context>::reset(ctx))) {
+    ContextOps<Context>::destroy(ctx);
+    return;
+  }
+  cache.emplace_back(ctx, &ContextOps<Context>::destroy);
+}
+
+template <class Context> CachedContextPtr<Context> acquireContext() {
+  auto& cache = contextCache<Context>();
+  if (!cache.empty()) {
+    CachedContextPtr<Context> ctx(cache.back().release(), &releaseContext<Context>);
+    cache.pop_back();
+    return ctx;
+  }
+  return {ContextOps<Context>::create(), &releaseContext<Context>};
+}
+
+} // namespace
+
+CCtxPtr acquireCompressionContext() { return acquireContext<ZSTD_CCtx>(); }
+
+DCtxPtr acquireDecompressionContext() { return acquireContext<ZSTD_DCtx>(); }
+
+} // namespace Common
+} // namespace Zstd
+} // namespace Compression
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include "zstd.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Compression {
+namespace Zstd {
+namespace Common {
+
+using CCtxPtr = std::unique_ptr<ZSTD_CCtx, void (*)(ZSTD_CCtx*)>;
+using DCtxPtr = std::unique_ptr<ZSTD_DCtx, void (*)(ZSTD_DCtx*)>;
+
+/**
+ * Returns a compression context for the calling thread, recycled through a small per-thread
+ * cache when available. Recycled contexts have been reset with
+ * ZSTD_reset_session_and_parameters, so they behave like freshly created ones while keeping
+ * their internal workspace allocations. The returned pointer's deleter performs the recycling;
+ * no explicit release is needed.
+ */
+CCtxPtr acquireCompressionContext();
+
+/**
+ * Decompression counterpart of acquireCompressionContext().
+ */
+DCtxPtr acquireDecompressionContext();
+
+} // namespace Common
+} // namespace Zstd
+} // namespace Compression
+} // namespace Extensions
+} // namespace Envoy
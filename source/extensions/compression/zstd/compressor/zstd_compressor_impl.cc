@@ -11,7 +11,7 @@ namespace Compressor {
 ZstdCompressorImpl::ZstdCompressorImpl(uint32_t compression_level, bool enable_checksum,
                                        uint32_t strategy, const ZstdCDictManagerPtr& cdict_manager,
                                        uint32_t chunk_size)
-    : Common::Base(chunk_size), cctx_(ZSTD_createCCtx(), &ZSTD_freeCCtx),
+    : Common::Base(chunk_size), cctx_(Common::acquireCompressionContext()),
       cdict_manager_(cdict_manager), compression_level_(compression_level) {
   size_t result;
   result = ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_checksumFlag, enable_checksum);
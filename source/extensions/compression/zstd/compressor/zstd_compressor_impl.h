@@ -3,6 +3,7 @@
 #include "envoy/compression/compressor/compressor.h"
 
 #include "source/extensions/compression/zstd/common/base.h"
+#include "source/extensions/compression/zstd/common/context_cache.h"
 #include "source/extensions/compression/zstd/common/dictionary_manager.h"
 
 namespace Envoy {
@@ -31,7 +32,7 @@ public:
 private:
   void process(Buffer::Instance& output_buffer, ZSTD_EndDirective mode);
 
-  std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> cctx_;
+  Common::CCtxPtr cctx_;
   const ZstdCDictManagerPtr& cdict_manager_;
   const uint32_t compression_level_;
 };
@@ -0,0 +1,142 @@
+#include "source/extensions/config/kv_store_xds_delegate.h"
+
+#include "envoy/extensions/config/v3/kv_store_xds_delegate_config.pb.h"
+#include "envoy/extensions/config/v3/kv_store_xds_delegate_config.pb.validate.h"
+#include "envoy/registry/registry.h"
+
+#include "source/common/config/utility.h"
+#include "source/common/protobuf/utility.h"
+
+#include "absl/strings/match.h"
+#include "absl/strings/str_cat.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Config {
+namespace {
+
+constexpr absl::string_view ResourceKeyDelimiter = "+";
+
+std::string constructKey(const Envoy::Config::XdsSourceId& source_id,
+                         const std::string& resource_name) {
+  return absl::StrCat(source_id.toKey(), ResourceKeyDelimiter, resource_name);
+}
+
+absl::optional<envoy::service::discovery::v3::Resource>
+parseResource(const std::string& key, absl::string_view serialized_resource) {
+  envoy::service::discovery::v3::Resource resource;
+  if (!resource.ParseFromArray(serialized_resource.data(), serialized_resource.size())) {
+    ENVOY_LOG_MISC(warn, "Unable to parse persisted xDS resource with key {}", key);
+    return absl::nullopt;
+  }
+  return resource;
+}
+
+} // namespace
+
+KeyValueStoreXdsDelegate::KeyValueStoreXdsDelegate(KeyValueStorePtr&& xds_config_store)
+    : xds_config_store_(std::move(xds_config_store)) {}
+
+std::vector<envoy::service::discovery::v3::Resource> KeyValueStoreXdsDelegate::getResources(
+    const Envoy::Config::XdsSourceId& source_id,
+    const absl::flat_hash_set<std::string>& resource_names) const {
+  if (resource_names.empty()) {
+    // An empty set means the subscription is a wildcard, so all the persisted resources for the
+    // source are returned.
+    return getAllResources(source_id.toKey());
+  }
+
+  std::vector<envoy::service::discovery::v3::Resource> resources;
+  resources.reserve(resource_names.size());
+  for (const std::string& resource_name : resource_names) {
+    const std::string key = constructKey(source_id, resource_name);
+    if (const auto serialized_resource = xds_config_store_->get(key);
+        serialized_resource.has_value()) {
+      if (auto resource = parseResource(key, *serialized_resource); resource.has_value()) {
+        resources.push_back(std::move(*resource));
+      }
+    }
+  }
+  return resources;
+}
+
+std::vector<envoy::service::discovery::v3::Resource>
+KeyValueStoreXdsDelegate::getAllResources(const std::string& source_key) const {
+  std::vector<envoy::service::discovery::v3::Resource> resources;
+  const std::string key_prefix = absl::StrCat(source_key, ResourceKeyDelimiter);
+  xds_config_store_->iterate([&key_prefix, &resources](const std::string& key,
+                                                       const std::string& serialized_resource) {
+    if (absl::StartsWith(key, key_prefix)) {
+      if (auto resource = parseResource(key, serialized_resource); resource.has_value()) {
+        resources.push_back(std::move(*resource));
+      }
+    }
+    return KeyValueStore::Iterate::Continue;
+  });
+  return resources;
+}
+
+void KeyValueStoreXdsDelegate::onConfigUpdated(
+    const Envoy::Config::XdsSourceId& source_id,
+    const std::vector<Envoy::Config::DecodedResourceRef>& resources) {
+  for (const auto& resource_ref : resources) {
+    const auto& decoded_resource = resource_ref.get();
+    // Heartbeat resources have no body to persist; the previously stored entry remains valid.
+    if (!decoded_resource.hasResource()) {
+      continue;
+    }
+    envoy::service::discovery::v3::Resource resource;
+    resource.set_name(decoded_resource.name());
+    resource.set_version(decoded_resource.version());
+    resource.mutable_resource()->PackFrom(decoded_resource.resource());
+    absl::optional<std::chrono::seconds> ttl;
+    if (decoded_resource.ttl().has_value()) {
+      resource.mutable_ttl()->CopyFrom(
+          Protobuf::util::TimeUtil::MillisecondsToDuration(decoded_resource.ttl()->count()));
+      const auto ttl_seconds =
+          std::chrono::duration_cast<std::chrono::seconds>(*decoded_resource.ttl());
+      if (ttl_seconds.count() > 0) {
+        ttl = ttl_seconds;
+      }
+    }
+    xds_config_store_->addOrUpdate(constructKey(source_id, decoded_resource.name()),
+                                   resource.SerializeAsString(), ttl);
+  }
+}
+
+void KeyValueStoreXdsDelegate::onResourceLoadFailed(
+    const Envoy::Config::XdsSourceId& source_id, const std::string& resource_name,
+    const absl::optional<EnvoyException>& exception) {
+  ENVOY_LOG(warn, "Failed to load persisted xDS resource {} for source {}{}", resource_name,
+            source_id.toKey(),
+            exception.has_value() ? absl::StrCat(": ", exception->what()) : "");
+  // Remove the invalid entry so it isn't reloaded on subsequent startups.
+  xds_config_store_->remove(constructKey(source_id, resource_name));
+}
+
+ProtobufTypes::MessagePtr KeyValueStoreXdsDelegateFactory::createEmptyConfigProto() {
+  return std::make_unique<envoy::extensions::config::v3::KeyValueStoreXdsDelegateConfig>();
+}
+
+std::string KeyValueStoreXdsDelegateFactory::name() const {
+  return "envoy.xds_delegates.kv_store";
+};
+
+Envoy::Config::XdsResourcesDelegatePtr KeyValueStoreXdsDelegateFactory::createXdsResourcesDelegate(
+    const ProtobufWkt::Any& config, ProtobufMessage::ValidationVisitor& validation_visitor,
+    Api::Api& api, Event::Dispatcher& dispatcher) {
+  const auto delegate_config = MessageUtil::anyConvertAndValidate<
+      envoy::extensions::config::v3::KeyValueStoreXdsDelegateConfig>(config, validation_visitor);
+  const auto& kv_store_config = delegate_config.key_value_store_config();
+  auto& kv_store_factory =
+      Envoy::Config::Utility::getAndCheckFactory<KeyValueStoreFactory>(kv_store_config.config());
+  auto kv_store = kv_store_factory.createStore(kv_store_config, validation_visitor, dispatcher,
+                                               api.fileSystem());
+  return std::make_unique<KeyValueStoreXdsDelegate>(std::move(kv_store));
+}
+
+REGISTER_FACTORY(KeyValueStoreXdsDelegateFactory, Envoy::Config::XdsResourcesDelegateFactory);
+
+} // namespace Config
+} // namespace Extensions
+} // namespace Envoy
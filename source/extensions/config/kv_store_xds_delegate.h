@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "envoy/common/key_value_store.h"
+#include "envoy/config/xds_resources_delegate.h"
+#include "envoy/service/discovery/v3/discovery.pb.h"
+
+#include "source/common/common/logger.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace Config {
+
+// An implementation of the XdsResourcesDelegate interface that persists accepted xDS resources
+// to the configured KeyValueStore, and serves them back to subscriptions when the xDS servers
+// are unreachable (e.g. an Envoy restart during a management server outage). The persisted
+// resources are used until connectivity is established with the xDS server and the current
+// configuration is delivered.
+class KeyValueStoreXdsDelegate : public Envoy::Config::XdsResourcesDelegate,
+                                 Logger::Loggable<Logger::Id::config> {
+public:
+  explicit KeyValueStoreXdsDelegate(KeyValueStorePtr&& xds_config_store);
+
+  // Envoy::Config::XdsResourcesDelegate
+  std::vector<envoy::service::discovery::v3::Resource>
+  getResources(const Envoy::Config::XdsSourceId& source_id,
+               const absl::flat_hash_set<std::string>& resource_names) const override;
+  void onConfigUpdated(const Envoy::Config::XdsSourceId& source_id,
+                       const std::vector<Envoy::Config::DecodedResourceRef>& resources) override;
+  void onResourceLoadFailed(const Envoy::Config::XdsSourceId& source_id,
+                            const std::string& resource_name,
+                            const absl::optional<EnvoyException>& exception) override;
+
+private:
+  // Retrieves all persisted resources for the given source, regardless of resource name. This
+  // is the behavior for wildcard subscriptions (e.g. CDS and LDS).
+  std::vector<envoy::service::discovery::v3::Resource>
+  getAllResources(const std::string& source_key) const;
+
+  KeyValueStorePtr xds_config_store_;
+};
+
+class KeyValueStoreXdsDelegateFactory : public Envoy::Config::XdsResourcesDelegateFactory {
+public:
+  // Envoy::Config::XdsResourcesDelegateFactory
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override;
+  std::string name() const override;
+  Envoy::Config::XdsResourcesDelegatePtr
+  createXdsResourcesDelegate(const ProtobufWkt::Any& config,
+                             ProtobufMessage::ValidationVisitor& validation_visitor, Api::Api& api,
+                             Event::Dispatcher& dispatcher) override;
+};
+
+} // namespace Config
+} // namespace Extensions
+} // namespace Envoy
@@ -319,6 +319,12 @@ EXTENSIONS = {
 
     "envoy.tls.cert_validator.spiffe":                  "//source/extensions/transport_sockets/tls/cert_validator/spiffe:config",
 
+    #
+    # TLS private key providers
+    #
+
+    "envoy.tls.key_providers.offload":                  "//source/extensions/private_key_providers/offload:config",
+
     #
     # HTTP header formatters
     #
@@ -374,6 +380,12 @@ EXTENSIONS = {
 
     "envoy.key_value.file_based":     "//source/extensions/key_value/file_based:config_lib",
 
+    #
+    # xDS delegates
+    #
+
+    "envoy.xds_delegates.kv_store":   "//source/extensions/config:kv_store_xds_delegate_lib",
+
     #
     # RBAC matchers
     #
@@ -390,6 +402,8 @@ EXTENSIONS = {
     "envoy.network.dns_resolver.apple":                "//source/extensions/network/dns_resolver/apple:config",
     # getaddrinfo DNS resolver extension can be used when the system resolver is desired (e.g., Android)
     "envoy.network.dns_resolver.getaddrinfo":          "//source/extensions/network/dns_resolver/getaddrinfo:config",
+    # caching DNS resolver extension wraps another resolver with a process-wide result cache.
+    "envoy.network.dns_resolver.caching":              "//source/extensions/network/dns_resolver/caching:config",
 
     #
     # Custom matchers
@@ -42,30 +42,56 @@ absl::optional<CelValue> StreamActivation::FindValue(absl::string_view name,
   if (token == tokens.end()) {
     return {};
   }
+
+  // The wrappers are arena-allocated, so cached values are only valid for the arena they were
+  // created on.
+  if (arena != cached_arena_) {
+    cached_arena_ = arena;
+    cached_values_.clear();
+  }
+  const int token_index = static_cast<int>(token->second);
+  const auto cached = cached_values_.find(token_index);
+  if (cached != cached_values_.end()) {
+    return cached->second;
+  }
+
+  absl::optional<CelValue> value;
   switch (token->second) {
   case ActivationToken::Request:
-    return CelValue::CreateMap(
+    value = CelValue::CreateMap(
         Protobuf::Arena::Create<RequestWrapper>(arena, *arena, activation_request_headers_, info));
+    break;
   case ActivationToken::Response:
-    return CelValue::CreateMap(Protobuf::Arena::Create<ResponseWrapper>(
+    value = CelValue::CreateMap(Protobuf::Arena::Create<ResponseWrapper>(
         arena, *arena, activation_response_headers_, activation_response_trailers_, info));
+    break;
   case ActivationToken::Connection:
-    return CelValue::CreateMap(Protobuf::Arena::Create<ConnectionWrapper>(arena, *arena, info));
+    value = CelValue::CreateMap(Protobuf::Arena::Create<ConnectionWrapper>(arena, *arena, info));
+    break;
   case ActivationToken::Upstream:
-    return CelValue::CreateMap(Protobuf::Arena::Create<UpstreamWrapper>(arena, *arena, info));
+    value = CelValue::CreateMap(Protobuf::Arena::Create<UpstreamWrapper>(arena, *arena, info));
+    break;
   case ActivationToken::Source:
-    return CelValue::CreateMap(Protobuf::Arena::Create<PeerWrapper>(arena, *arena, info, false));
+    value = CelValue::CreateMap(Protobuf::Arena::Create<PeerWrapper>(arena, *arena, info, false));
+    break;
   case ActivationToken::Destination:
-    return CelValue::CreateMap(Protobuf::Arena::Create<PeerWrapper>(arena, *arena, info, true));
+    value = CelValue::CreateMap(Protobuf::Arena::Create<PeerWrapper>(arena, *arena, info, true));
+    break;
   case ActivationToken::Metadata:
-    return CelProtoWrapper::CreateMessage(&info.dynamicMetadata(), arena);
+    value = CelProtoWrapper::CreateMessage(&info.dynamicMetadata(), arena);
+    break;
   case ActivationToken::FilterState:
-    return CelValue::CreateMap(
+    value = CelValue::CreateMap(
         Protobuf::Arena::Create<FilterStateWrapper>(arena, *arena, info.filterState()));
+    break;
   case ActivationToken::XDS:
-    return CelValue::CreateMap(Protobuf::Arena::Create<XDSWrapper>(arena, *arena, info));
+    value = CelValue::CreateMap(Protobuf::Arena::Create<XDSWrapper>(arena, *arena, info));
+    break;
   };
-  return {};
+  if (value.has_value()) {
+    cached_values_.emplace(token_index, *value);
+  }
+  return value;
 }
 
 void StreamActivation::resetActivation() const {
@@ -73,6 +99,8 @@ void StreamActivation::resetActivation() const {
   activation_request_headers_ = nullptr;
   activation_response_headers_ = nullptr;
   activation_response_trailers_ = nullptr;
+  cached_arena_ = nullptr;
+  cached_values_.clear();
 }
 
 ActivationPtr createActivation(const StreamInfo::StreamInfo& info,
@@ -125,8 +153,10 @@ absl::optional<CelValue> evaluate(const Expression& expr, Protobuf::Arena& arena
                                   const Http::RequestHeaderMap* request_headers,
                                   const Http::ResponseHeaderMap* response_headers,
                                   const Http::ResponseTrailerMap* response_trailers) {
-  auto activation = createActivation(info, request_headers, response_headers, response_trailers);
-  auto eval_status = expr.Evaluate(*activation, &arena);
+  // The activation is cheap enough to live on the stack; this avoids a heap allocation per
+  // evaluated expression, which adds up for filters that evaluate many expressions per request.
+  StreamActivation activation(info, request_headers, response_headers, response_trailers);
+  auto eval_status = expr.Evaluate(activation, &arena);
   if (!eval_status.ok()) {
     return {};
   }
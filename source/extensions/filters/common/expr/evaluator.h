@@ -6,6 +6,7 @@
 #include "source/common/protobuf/protobuf.h"
 #include "source/extensions/filters/common/expr/context.h"
 
+#include "absl/container/flat_hash_map.h"
 #include "eval/public/activation.h"
 #include "eval/public/cel_expression.h"
 #include "eval/public/cel_value.h"
@@ -48,6 +49,14 @@ protected:
   mutable const Http::RequestHeaderMap* activation_request_headers_{nullptr};
   mutable const Http::ResponseHeaderMap* activation_response_headers_{nullptr};
   mutable const Http::ResponseTrailerMap* activation_response_trailers_{nullptr};
+
+private:
+  // Root attributes are usually referenced several times during a single evaluation, so the
+  // arena-allocated wrappers are memoized per activation. The cache is keyed by the activation
+  // token and tied to the evaluation arena; it is dropped when the arena changes or the
+  // activation is reset.
+  mutable Protobuf::Arena* cached_arena_{nullptr};
+  mutable absl::flat_hash_map<int, CelValue> cached_values_;
 };
 
 // Creates an activation providing the common context attributes.
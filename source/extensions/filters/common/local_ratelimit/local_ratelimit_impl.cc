@@ -17,11 +17,13 @@ LocalRateLimiterImpl::LocalRateLimiterImpl(
     const std::chrono::milliseconds fill_interval, const uint32_t max_tokens,
     const uint32_t tokens_per_fill, Event::Dispatcher& dispatcher,
     const Protobuf::RepeatedPtrField<
-        envoy::extensions::common::ratelimit::v3::LocalRateLimitDescriptor>& descriptors)
+        envoy::extensions::common::ratelimit::v3::LocalRateLimitDescriptor>& descriptors,
+    uint32_t num_stripes)
     : fill_timer_(fill_interval > std::chrono::milliseconds(0)
                       ? dispatcher.createTimer([this] { onFillTimer(); })
                       : nullptr),
-      time_source_(dispatcher.timeSource()) {
+      time_source_(dispatcher.timeSource()), num_stripes_(std::max(num_stripes, 1U)),
+      tokens_(num_stripes_) {
   if (fill_timer_ && fill_interval < std::chrono::milliseconds(50)) {
     throw EnvoyException("local rate limit token bucket fill timer must be >= 50ms");
   }
@@ -29,7 +31,7 @@ LocalRateLimiterImpl::LocalRateLimiterImpl(
   token_bucket_.max_tokens_ = max_tokens;
   token_bucket_.tokens_per_fill_ = tokens_per_fill;
   token_bucket_.fill_interval_ = absl::FromChrono(fill_interval);
-  tokens_.tokens_ = max_tokens;
+  tokens_.seed(max_tokens);
   tokens_.fill_time_ = time_source_.monotonicTime();
 
   if (fill_timer_) {
@@ -57,8 +59,8 @@ LocalRateLimiterImpl::LocalRateLimiterImpl(
         PROTOBUF_GET_WRAPPED_OR_DEFAULT(descriptor.token_bucket(), tokens_per_fill, 1);
     new_descriptor.token_bucket_ = per_descriptor_token_bucket;
 
-    auto token_state = std::make_shared<TokenState>();
-    token_state->tokens_ = per_descriptor_token_bucket.max_tokens_;
+    auto token_state = std::make_shared<TokenState>(num_stripes_);
+    token_state->seed(per_descriptor_token_bucket.max_tokens_);
     token_state->fill_time_ = time_source_.monotonicTime();
     new_descriptor.token_state_ = token_state;
 
@@ -103,20 +105,35 @@ void LocalRateLimiterImpl::onFillTimer() {
 
 void LocalRateLimiterImpl::onFillTimerHelper(TokenState& tokens,
                                              const RateLimit::TokenBucket& bucket) {
-  // Relaxed consistency is used for all operations because we don't care about ordering, just the
-  // final atomic correctness.
-  uint32_t expected_tokens = tokens.tokens_.load(std::memory_order_relaxed);
-  uint32_t new_tokens_value;
-  do {
-    // expected_tokens is either initialized above or reloaded during the CAS failure below.
-    new_tokens_value = std::min(bucket.max_tokens_, expected_tokens + bucket.tokens_per_fill_);
+  // Each stripe is capped at its share of max_tokens so the bucket as a whole never exceeds the
+  // configured maximum. The fill is handed out greedily starting at a rotating stripe so that
+  // fills smaller than the stripe count do not always land on the same stripe.
+  const uint32_t num_stripes = tokens.stripes_.size();
+  uint32_t remaining_fill = bucket.tokens_per_fill_;
+  for (uint32_t i = 0; i < num_stripes && remaining_fill > 0; ++i) {
+    const uint32_t index = (refill_counter_ + i) % num_stripes;
+    const uint32_t stripe_max =
+        bucket.max_tokens_ / num_stripes + (index < bucket.max_tokens_ % num_stripes ? 1 : 0);
+    auto& stripe_tokens = tokens.stripes_[index].tokens_;
 
-    // Testing hook.
-    synchronizer_.syncPoint("on_fill_timer_pre_cas");
+    // Relaxed consistency is used for all operations because we don't care about ordering, just
+    // the final atomic correctness.
+    uint32_t expected_tokens = stripe_tokens.load(std::memory_order_relaxed);
+    uint32_t new_tokens_value;
+    do {
+      // expected_tokens is either initialized above or reloaded during the CAS failure below.
+      new_tokens_value = std::min(stripe_max, expected_tokens + remaining_fill);
 
-    // Loop while the weak CAS fails trying to update the tokens value.
-  } while (!tokens.tokens_.compare_exchange_weak(expected_tokens, new_tokens_value,
-                                                 std::memory_order_relaxed));
+      // Testing hook.
+      synchronizer_.syncPoint("on_fill_timer_pre_cas");
+
+      // Loop while the weak CAS fails trying to update the tokens value.
+    } while (!stripe_tokens.compare_exchange_weak(expected_tokens, new_tokens_value,
+                                                  std::memory_order_relaxed));
+
+    // On success the CAS leaves the pre-update value in expected_tokens.
+    remaining_fill -= new_tokens_value - expected_tokens;
+  }
 
   // Update fill time at last.
   tokens.fill_time_ = time_source_.monotonicTime();
@@ -134,10 +151,10 @@ void LocalRateLimiterImpl::onFillTimerDescriptorHelper() {
   }
 }
 
-bool LocalRateLimiterImpl::requestAllowedHelper(const TokenState& tokens) const {
+bool LocalRateLimiterImpl::tryTakeToken(const TokenStripe& stripe) const {
   // Relaxed consistency is used for all operations because we don't care about ordering, just the
   // final atomic correctness.
-  uint32_t expected_tokens = tokens.tokens_.load(std::memory_order_relaxed);
+  uint32_t expected_tokens = stripe.tokens_.load(std::memory_order_relaxed);
   do {
     // expected_tokens is either initialized above or reloaded during the CAS failure below.
     if (expected_tokens == 0) {
@@ -148,13 +165,35 @@ bool LocalRateLimiterImpl::requestAllowedHelper(const TokenState& tokens) const
     synchronizer_.syncPoint("allowed_pre_cas");
 
     // Loop while the weak CAS fails trying to subtract 1 from expected.
-  } while (!tokens.tokens_.compare_exchange_weak(expected_tokens, expected_tokens - 1,
+  } while (!stripe.tokens_.compare_exchange_weak(expected_tokens, expected_tokens - 1,
                                                  std::memory_order_relaxed));
 
   // We successfully decremented the counter by 1.
   return true;
 }
 
+uint32_t LocalRateLimiterImpl::stripeIndex() const {
+  // Threads are assigned stripe slots round-robin on first use. With one stripe per worker, each
+  // worker's common-case check lands on its own cache line.
+  static std::atomic<uint32_t> next_assignment{0};
+  static thread_local const uint32_t assignment =
+      next_assignment.fetch_add(1, std::memory_order_relaxed);
+  return assignment;
+}
+
+bool LocalRateLimiterImpl::requestAllowedHelper(const TokenState& tokens) const {
+  // Start with this worker's stripe; when it is empty, steal from the other stripes so that
+  // unused capacity elsewhere still admits the request and the global limit is preserved.
+  const uint32_t num_stripes = tokens.stripes_.size();
+  const uint32_t start = stripeIndex() % num_stripes;
+  for (uint32_t i = 0; i < num_stripes; ++i) {
+    if (tryTakeToken(tokens.stripes_[(start + i) % num_stripes])) {
+      return true;
+    }
+  }
+  return false;
+}
+
 OptRef<const LocalRateLimiterImpl::LocalDescriptorImpl> LocalRateLimiterImpl::descriptorHelper(
     absl::Span<const RateLimit::LocalDescriptor> request_descriptors) const {
   if (!descriptors_.empty() && !request_descriptors.empty()) {
@@ -211,9 +250,8 @@ uint32_t LocalRateLimiterImpl::remainingTokens(
     absl::Span<const RateLimit::LocalDescriptor> request_descriptors) const {
   auto descriptor = descriptorHelper(request_descriptors);
 
-  return descriptor.has_value()
-             ? descriptor.value().get().token_state_->tokens_.load(std::memory_order_relaxed)
-             : tokens_.tokens_.load(std::memory_order_relaxed);
+  return descriptor.has_value() ? descriptor.value().get().token_state_->total()
+                                : tokens_.total();
 }
 
 int64_t LocalRateLimiterImpl::remainingFillInterval(
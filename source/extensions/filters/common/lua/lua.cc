@@ -17,6 +17,19 @@ namespace Lua {
 Coroutine::Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state)
     : coroutine_state_(new_thread_state, false) {}
 
+Coroutine::~Coroutine() {
+  // If this coroutine's thread is in a reusable state (either never started or finished cleanly,
+  // which lua_status() reports as 0), hand the registry ref back to the worker's free list so
+  // createCoroutine() can reuse the thread instead of allocating a new one. Threads that yielded
+  // or errored are left to the GC as before.
+  lua_State* thread = coroutine_state_.get();
+  if (pool_ != nullptr && thread != nullptr && lua_status(thread) == 0 &&
+      pool_->size() < MaxPoolSize) {
+    lua_settop(thread, 0);
+    pool_->push_back(coroutine_state_.release());
+  }
+}
+
 void Coroutine::start(int function_ref, int num_args, const std::function<void()>& yield_callback) {
   ASSERT(state_ == State::NotStarted);
 
@@ -54,17 +67,36 @@ void Coroutine::resume(int num_args, const std::function<void()>& yield_callback
 ThreadLocalState::ThreadLocalState(const std::string& code, ThreadLocal::SlotAllocator& tls)
     : tls_slot_(ThreadLocal::TypedSlot<LuaThreadLocal>::makeUnique(tls)) {
 
-  // First verify that the supplied code can be parsed.
+  // Compile the supplied code once on the main thread. This both verifies that the script parses
+  // and produces bytecode that each worker can load without re-parsing the source.
   CSmartPtr<lua_State, lua_close> state(luaL_newstate());
   RELEASE_ASSERT(state.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state.get());
 
-  if (0 != luaL_dostring(state.get(), code.c_str())) {
+  if (0 != luaL_loadstring(state.get(), code.c_str())) {
+    throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
+  }
+
+  std::string bytecode;
+  const int rc = lua_dump(
+      state.get(),
+      [](lua_State*, const void* data, size_t size, void* out) -> int {
+        static_cast<std::string*>(out)->append(static_cast<const char*>(data), size);
+        return 0;
+      },
+      &bytecode);
+  RELEASE_ASSERT(rc == 0, "unable to dump compiled Lua script");
+
+  // Run the compiled chunk once to verify that top level execution succeeds. The chunk name is
+  // baked into the bytecode by luaL_loadstring() above, so runtime error messages are unchanged
+  // from when the source was parsed per thread.
+  if (0 != lua_pcall(state.get(), 0, 0, 0)) {
     throw LuaException(fmt::format("script load error: {}", lua_tostring(state.get(), -1)));
   }
 
-  // Now initialize on all threads.
-  tls_slot_->set([code](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(code); });
+  // Now initialize on all threads from the precompiled bytecode.
+  tls_slot_->set(
+      [bytecode](Event::Dispatcher&) { return std::make_shared<LuaThreadLocal>(bytecode); });
 }
 
 int ThreadLocalState::getGlobalRef(uint64_t slot) {
@@ -93,16 +125,38 @@ uint64_t ThreadLocalState::registerGlobal(const std::string& global,
 }
 
 CoroutinePtr ThreadLocalState::createCoroutine() {
-  lua_State* state = tlsState().get();
-  return std::make_unique<Coroutine>(std::make_pair(lua_newthread(state), state));
+  LuaThreadLocal& tls = **tls_slot_;
+  lua_State* state = tls.state_.get();
+  lua_State* thread;
+  if (!tls.free_coroutines_.empty()) {
+    // Reuse a previously finished coroutine thread instead of allocating a new one. The thread is
+    // pushed onto the stack before the old ref is released so that it stays protected from GC;
+    // the Coroutine's LuaRef then takes a fresh ref and pops it.
+    const int ref = tls.free_coroutines_.back();
+    tls.free_coroutines_.pop_back();
+    lua_rawgeti(state, LUA_REGISTRYINDEX, ref);
+    luaL_unref(state, LUA_REGISTRYINDEX, ref);
+    thread = lua_tothread(state, -1);
+    ASSERT(thread != nullptr);
+  } else {
+    thread = lua_newthread(state);
+  }
+
+  auto coroutine = std::make_unique<Coroutine>(std::make_pair(thread, state));
+  coroutine->pool_ = &tls.free_coroutines_;
+  return coroutine;
 }
 
-ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& code)
+ThreadLocalState::LuaThreadLocal::LuaThreadLocal(const std::string& bytecode)
     : state_(luaL_newstate()) {
 
   RELEASE_ASSERT(state_.get() != nullptr, "unable to create new Lua state object");
   luaL_openlibs(state_.get());
-  int rc = luaL_dostring(state_.get(), code.c_str());
+  // The bytecode was compiled and verified on the main thread, so loading and running it here
+  // cannot fail.
+  int rc = luaL_loadbuffer(state_.get(), bytecode.data(), bytecode.size(), "<precompiled>");
+  ASSERT(rc == 0);
+  rc = lua_pcall(state_.get(), 0, 0, 0);
   ASSERT(rc == 0);
 }
 
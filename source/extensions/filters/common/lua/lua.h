@@ -290,6 +290,17 @@ public:
     ref_ = LUA_NOREF;
   }
 
+  /**
+   * Give up ownership of the reference without unreferencing it, returning the raw registry ref.
+   * The caller becomes responsible for eventually calling luaL_unref() on it.
+   */
+  int release() {
+    const int ref = ref_;
+    object_ = std::pair<T*, lua_State*>{};
+    ref_ = LUA_NOREF;
+    return ref;
+  }
+
   /**
    * Push the referenced object back onto the stack.
    */
@@ -352,6 +363,7 @@ public:
   enum class State { NotStarted, Yielded, Finished };
 
   Coroutine(const std::pair<lua_State*, lua_State*>& new_thread_state);
+  ~Coroutine();
   lua_State* luaState() { return coroutine_state_.get(); }
   State state() { return state_; }
 
@@ -374,8 +386,17 @@ public:
   void resume(int num_args, const std::function<void()>& yield_callback);
 
 private:
+  friend class ThreadLocalState;
+
+  // Maximum number of finished coroutine threads kept around per worker for reuse.
+  static constexpr size_t MaxPoolSize = 32;
+
   LuaRef<lua_State> coroutine_state_;
   State state_{State::NotStarted};
+  // If set, points at the owning worker's free list. On destruction, a coroutine whose thread
+  // finished cleanly returns its thread to this list so that createCoroutine() can reuse it
+  // instead of allocating a new one.
+  std::vector<int>* pool_{nullptr};
 };
 
 using CoroutinePtr = std::unique_ptr<Coroutine>;
@@ -436,10 +457,13 @@ public:
 
 private:
   struct LuaThreadLocal : public ThreadLocal::ThreadLocalObject {
-    LuaThreadLocal(const std::string& code);
+    LuaThreadLocal(const std::string& bytecode);
 
     CSmartPtr<lua_State, lua_close> state_;
     std::vector<int> global_slots_;
+    // Registry refs to coroutine threads that finished cleanly and can be reused. See
+    // createCoroutine() and ~Coroutine().
+    std::vector<int> free_coroutines_;
   };
 
   CSmartPtr<lua_State, lua_close>& tlsState() { return (*tls_slot_)->state_; }
@@ -89,6 +89,20 @@ public:
   virtual void limit(RequestCallbacks& callbacks, const std::string& domain,
                      const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
                      Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info) PURE;
+
+  /**
+   * As above, but additionally requests hits_addend units of quota in a single call. This is used
+   * by callers that prefetch quota in batches; implementations that do not support batching may
+   * ignore hits_addend, which the rate limit service treats as a request for one unit.
+   * @param hits_addend the number of units this call should add to the matched limits. A value of
+   *                    zero leaves the decision to the rate limit service (it defaults to one).
+   */
+  virtual void limit(RequestCallbacks& callbacks, const std::string& domain,
+                     const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                     Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+                     uint32_t /*hits_addend*/) {
+    limit(callbacks, domain, descriptors, parent_span, stream_info);
+  }
 };
 
 using ClientPtr = std::unique_ptr<Client>;
@@ -35,8 +35,12 @@ void GrpcClientImpl::cancel() {
 
 void GrpcClientImpl::createRequest(envoy::service::ratelimit::v3::RateLimitRequest& request,
                                    const std::string& domain,
-                                   const std::vector<Envoy::RateLimit::Descriptor>& descriptors) {
+                                   const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                                   uint32_t hits_addend) {
   request.set_domain(domain);
+  if (hits_addend != 0) {
+    request.set_hits_addend(hits_addend);
+  }
   for (const Envoy::RateLimit::Descriptor& descriptor : descriptors) {
     envoy::extensions::common::ratelimit::v3::RateLimitDescriptor* new_descriptor =
         request.add_descriptors();
@@ -58,11 +62,18 @@ void GrpcClientImpl::createRequest(envoy::service::ratelimit::v3::RateLimitReque
 void GrpcClientImpl::limit(RequestCallbacks& callbacks, const std::string& domain,
                            const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
                            Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info) {
+  limit(callbacks, domain, descriptors, parent_span, stream_info, 0);
+}
+
+void GrpcClientImpl::limit(RequestCallbacks& callbacks, const std::string& domain,
+                           const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                           Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+                           uint32_t hits_addend) {
   ASSERT(callbacks_ == nullptr);
   callbacks_ = &callbacks;
 
   envoy::service::ratelimit::v3::RateLimitRequest request;
-  createRequest(request, domain, descriptors);
+  createRequest(request, domain, descriptors, hits_addend);
 
   request_ =
       async_client_->send(service_method_, request, *this, parent_span,
@@ -50,13 +50,18 @@ public:
 
   static void createRequest(envoy::service::ratelimit::v3::RateLimitRequest& request,
                             const std::string& domain,
-                            const std::vector<Envoy::RateLimit::Descriptor>& descriptors);
+                            const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                            uint32_t hits_addend);
 
   // Filters::Common::RateLimit::Client
   void cancel() override;
   void limit(RequestCallbacks& callbacks, const std::string& domain,
              const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
              Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info) override;
+  void limit(RequestCallbacks& callbacks, const std::string& domain,
+             const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+             uint32_t hits_addend) override;
 
   // Grpc::AsyncRequestCallbacks
   void onCreateInitialMetadata(Http::RequestHeaderMap&) override {}
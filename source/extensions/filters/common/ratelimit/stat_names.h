@@ -15,12 +15,16 @@ struct StatNames {
   explicit StatNames(Stats::SymbolTable& symbol_table)
       : pool_(symbol_table), ok_(pool_.add("ratelimit.ok")), error_(pool_.add("ratelimit.error")),
         failure_mode_allowed_(pool_.add("ratelimit.failure_mode_allowed")),
-        over_limit_(pool_.add("ratelimit.over_limit")) {}
+        over_limit_(pool_.add("ratelimit.over_limit")),
+        quota_hit_(pool_.add("ratelimit.quota_hit")),
+        quota_miss_(pool_.add("ratelimit.quota_miss")) {}
   Stats::StatNamePool pool_;
   Stats::StatName ok_;
   Stats::StatName error_;
   Stats::StatName failure_mode_allowed_;
   Stats::StatName over_limit_;
+  Stats::StatName quota_hit_;
+  Stats::StatName quota_miss_;
 };
 
 } // namespace RateLimit
@@ -50,8 +50,7 @@ GradientController::GradientController(GradientControllerConfig config,
     : config_(std::move(config)), dispatcher_(dispatcher), scope_(scope),
       stats_(generateStats(scope_, stats_prefix)), random_(random), time_source_(time_source),
       deferred_limit_value_(0), num_rq_outstanding_(0),
-      concurrency_limit_(config_.minConcurrency()),
-      latency_sample_hist_(hist_fast_alloc(), hist_free) {
+      concurrency_limit_(config_.minConcurrency()) {
   min_rtt_calc_timer_ = dispatcher_.createTimer([this]() -> void { enterMinRTTSamplingWindow(); });
 
   sample_reset_timer_ = dispatcher_.createTimer([this]() -> void {
@@ -102,7 +101,7 @@ void GradientController::enterMinRTTSamplingWindow() {
 
   // Throw away any latency samples from before the recalculation window as it may not represent
   // the minRTT.
-  hist_clear(latency_sample_hist_.get());
+  clearLatencySamples();
 
   min_rtt_epoch_ = time_source_.monotonicTime();
 }
@@ -110,8 +109,7 @@ void GradientController::enterMinRTTSamplingWindow() {
 void GradientController::updateMinRTT() {
   // Only update minRTT when it is in minRTT sampling window and
   // number of samples is greater than or equal to the minRTTAggregateRequestCount.
-  if (!inMinRTTSamplingWindow() ||
-      hist_sample_count(latency_sample_hist_.get()) < config_.minRTTAggregateRequestCount()) {
+  if (!inMinRTTSamplingWindow() || sample_count_.load() < config_.minRTTAggregateRequestCount()) {
     return;
   }
 
@@ -141,7 +139,7 @@ void GradientController::resetSampleWindow() {
   // The sampling window must not be reset while sampling for the new minRTT value.
   ASSERT(!inMinRTTSamplingWindow());
 
-  if (hist_sample_count(latency_sample_hist_.get()) == 0) {
+  if (sample_count_.load() == 0) {
     return;
   }
 
@@ -152,10 +150,20 @@ void GradientController::resetSampleWindow() {
 }
 
 std::chrono::microseconds GradientController::processLatencySamplesAndClear() {
+  // Merge the shard histograms into a single histogram before calculating the quantile. The merge
+  // is lossless since all shards share the same bucketing.
+  std::unique_ptr<histogram_t, decltype(&hist_free)> merged(hist_fast_alloc(), hist_free);
+  for (SampleShard& shard : sample_shards_) {
+    absl::MutexLock ml(&shard.mtx);
+    histogram_t* shard_hist = shard.hist.get();
+    hist_accumulate(merged.get(), &shard_hist, 1);
+    hist_clear(shard_hist);
+  }
+  sample_count_.store(0);
+
   const std::array<double, 1> quantile{config_.sampleAggregatePercentile()};
   std::array<double, 1> calculated_quantile;
-  hist_approx_quantile(latency_sample_hist_.get(), quantile.data(), 1, calculated_quantile.data());
-  hist_clear(latency_sample_hist_.get());
+  hist_approx_quantile(merged.get(), quantile.data(), 1, calculated_quantile.data());
   return std::chrono::microseconds(static_cast<int>(calculated_quantile[0]));
 }
 
@@ -211,12 +219,35 @@ void GradientController::recordLatencySample(MonotonicTime rq_send_time) {
                                                             rq_send_time);
   synchronizer_.syncPoint("pre_hist_insert");
   {
+    SampleShard& shard = currentShard();
+    absl::MutexLock ml(&shard.mtx);
+    hist_insert(shard.hist.get(), rq_latency.count(), 1);
+  }
+  sample_count_.fetch_add(1);
+
+  // Only take the controller-wide mutex when this sample may complete a minRTT measurement;
+  // updateMinRTT() re-checks the window state under the lock, so concurrent samplers racing here
+  // perform the recalculation exactly once.
+  if (inMinRTTSamplingWindow() && sample_count_.load() >= config_.minRTTAggregateRequestCount()) {
     absl::MutexLock ml(&sample_mutation_mtx_);
-    hist_insert(latency_sample_hist_.get(), rq_latency.count(), 1);
     updateMinRTT();
   }
 }
 
+GradientController::SampleShard& GradientController::currentShard() {
+  static std::atomic<uint32_t> next_shard{0};
+  static thread_local const uint32_t shard_index = next_shard.fetch_add(1) % NumSampleShards;
+  return sample_shards_[shard_index];
+}
+
+void GradientController::clearLatencySamples() {
+  for (SampleShard& shard : sample_shards_) {
+    absl::MutexLock ml(&shard.mtx);
+    hist_clear(shard.hist.get());
+  }
+  sample_count_.store(0);
+}
+
 void GradientController::cancelLatencySample() {
   ASSERT(num_rq_outstanding_.load() > 0);
   --num_rq_outstanding_;
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <chrono>
 #include <vector>
 
@@ -208,6 +209,12 @@ using GradientControllerConfigSharedPtr = std::shared_ptr<GradientControllerConf
  * prevent the overlap of these windows. It is necessary for a worker thread to know specifically if
  * the controller is inside of a minRTT recalculation window during the recording of a latency
  * sample, so this extra bit of information is stored in inMinRTTSamplingWindow().
+ *
+ * Latency samples themselves are recorded into per-shard histograms, each with its own mutex, so
+ * that worker threads sampling concurrently contend only on their shard rather than on the
+ * controller-wide mutex. The sample mutation mutex is only acquired on the sample path to finish a
+ * minRTT measurement once enough samples have accumulated; window transitions merge the shards
+ * (losslessly, since all shards share the same bucketing) under that mutex.
  */
 class GradientController : public ConcurrencyController {
 public:
@@ -248,9 +255,9 @@ private:
   Random::RandomGenerator& random_;
   TimeSource& time_source_;
 
-  // Protects data related to latency sampling and RTT values. In addition to protecting the latency
-  // sample histogram, the mutex ensures that the minRTT calculation window and the sample window
-  // (where the new concurrency limit is determined) do not overlap.
+  // Protects data related to latency sampling and RTT values. The mutex ensures that the minRTT
+  // calculation window and the sample window (where the new concurrency limit is determined) do not
+  // overlap. Individual latency samples are protected by the per-shard mutexes below.
   absl::Mutex sample_mutation_mtx_;
 
   // Stores the value of the concurrency limit prior to entering the minRTT update window. If this
@@ -273,10 +280,33 @@ private:
   // make the forwarding decision without locking.
   std::atomic<uint32_t> concurrency_limit_;
 
+  // The number of independently locked histograms that latency samples are spread across. Chosen to
+  // comfortably exceed typical worker concurrency on the sample path without bloating the merge
+  // performed at window transitions.
+  static constexpr uint32_t NumSampleShards = 8;
+
+  // A latency sample histogram fragment with its own mutex. Worker threads hash to a shard when
+  // recording samples, so concurrent samplers only contend when they collide on a shard.
+  struct SampleShard {
+    absl::Mutex mtx;
+    std::unique_ptr<histogram_t, decltype(&hist_free)> hist ABSL_GUARDED_BY(mtx){hist_fast_alloc(),
+                                                                                 hist_free};
+  };
+
+  // Returns the shard the calling thread records its latency samples into.
+  SampleShard& currentShard();
+
+  // Clears all shard histograms and the aggregate sample counter.
+  void clearLatencySamples();
+
   // Stores all sampled latencies and provides percentile estimations when using the sampled data to
-  // calculate a new concurrency limit.
-  std::unique_ptr<histogram_t, decltype(&hist_free)>
-      latency_sample_hist_ ABSL_GUARDED_BY(sample_mutation_mtx_);
+  // calculate a new concurrency limit. The shards are merged under the sample mutation mutex before
+  // quantiles are calculated.
+  std::array<SampleShard, NumSampleShards> sample_shards_;
+
+  // The total number of samples recorded across all shards since the last clear. Kept separately so
+  // the sample path can detect minRTT window completion without visiting every shard.
+  std::atomic<uint64_t> sample_count_{0};
 
   // Tracks the number of consecutive times that the concurrency limit is set to the minimum. This
   // is used to determine whether the controller should trigger an additional minRTT measurement
@@ -14,9 +14,9 @@ namespace BandwidthLimitFilter {
 
 Http::FilterFactoryCb BandwidthLimitFilterConfig::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& proto_config,
-    const std::string&, Server::Configuration::FactoryContext& context) {
+    const std::string&, DualInfo info, Server::Configuration::ServerFactoryContext& context) {
   FilterConfigSharedPtr filter_config = std::make_shared<FilterConfig>(
-      proto_config, context.scope(), context.runtime(), context.timeSource());
+      proto_config, info.scope, context.runtime(), context.timeSource());
   return [filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<BandwidthLimiter>(filter_config));
   };
@@ -36,6 +36,9 @@ BandwidthLimitFilterConfig::createRouteSpecificFilterConfigTyped(
 LEGACY_REGISTER_FACTORY(BandwidthLimitFilterConfig,
                         Server::Configuration::NamedHttpFilterConfigFactory,
                         "envoy.bandwidth_limit");
+LEGACY_REGISTER_FACTORY(UpstreamBandwidthLimitFilterConfig,
+                        Server::Configuration::UpstreamHttpFilterConfigFactory,
+                        "envoy.bandwidth_limit");
 
 } // namespace BandwidthLimitFilter
 } // namespace HttpFilters
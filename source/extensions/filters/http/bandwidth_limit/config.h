@@ -11,24 +11,33 @@ namespace HttpFilters {
 namespace BandwidthLimitFilter {
 
 /**
- * Config registration for the bandwidth limit filter. @see NamedHttpFilterConfigFactory.
+ * Config registration for the bandwidth limit filter. @see NamedHttpFilterConfigFactory. The
+ * filter is registered as a dual factory so it can also run in upstream (per-cluster) filter
+ * chains, where the shared token bucket shapes the aggregate bandwidth of all streams to a
+ * cluster rather than per listener.
  */
 class BandwidthLimitFilterConfig
-    : public Common::FactoryBase<
+    : public Common::DualFactoryBase<
           envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit> {
 public:
-  BandwidthLimitFilterConfig() : FactoryBase("envoy.filters.http.bandwidth_limit") {}
+  BandwidthLimitFilterConfig() : DualFactoryBase("envoy.filters.http.bandwidth_limit") {}
 
 private:
   Http::FilterFactoryCb createFilterFactoryFromProtoTyped(
       const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& proto_config,
-      const std::string& stats_prefix, Server::Configuration::FactoryContext& context) override;
+      const std::string& stats_prefix, DualInfo info,
+      Server::Configuration::ServerFactoryContext& context) override;
 
   Router::RouteSpecificFilterConfigConstSharedPtr createRouteSpecificFilterConfigTyped(
       const envoy::extensions::filters::http::bandwidth_limit::v3::BandwidthLimit& proto_config,
       Server::Configuration::ServerFactoryContext&, ProtobufMessage::ValidationVisitor&) override;
 };
 
+using UpstreamBandwidthLimitFilterConfig = BandwidthLimitFilterConfig;
+
+DECLARE_FACTORY(BandwidthLimitFilterConfig);
+DECLARE_FACTORY(UpstreamBandwidthLimitFilterConfig);
+
 } // namespace BandwidthLimitFilter
 } // namespace HttpFilters
 } // namespace Extensions
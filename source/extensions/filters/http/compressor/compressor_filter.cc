@@ -1,8 +1,10 @@
 #include "source/extensions/filters/http/compressor/compressor_filter.h"
 
 #include "source/common/buffer/buffer_impl.h"
+#include "source/common/config/utility.h"
 #include "source/common/http/header_map_impl.h"
 #include "source/common/http/utility.h"
+#include "source/common/protobuf/utility.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -166,8 +168,28 @@ Envoy::Compression::Compressor::CompressorPtr CompressorFilterConfig::makeCompre
 CompressorFilter::CompressorFilter(const CompressorFilterConfigSharedPtr config)
     : config_(std::move(config)) {}
 
+Envoy::Compression::Compressor::CompressorFactoryPtr
+createCompressorFactory(const envoy::config::core::v3::TypedExtensionConfig& library_config,
+                        Server::Configuration::ServerFactoryContext& context,
+                        ProtobufMessage::ValidationVisitor& validation_visitor) {
+  const std::string type{
+      TypeUtil::typeUrlToDescriptorFullName(library_config.typed_config().type_url())};
+  Compression::Compressor::NamedCompressorLibraryConfigFactory* const config_factory =
+      Registry::FactoryRegistry<
+          Compression::Compressor::NamedCompressorLibraryConfigFactory>::getFactoryByType(type);
+  if (config_factory == nullptr) {
+    throw EnvoyException(
+        fmt::format("Didn't find a registered implementation for type: '{}'", type));
+  }
+  ProtobufTypes::MessagePtr message = Config::Utility::translateAnyToFactoryConfig(
+      library_config.typed_config(), validation_visitor, *config_factory);
+  return config_factory->createCompressorFactoryFromProto(*message, context);
+}
+
 CompressorPerRouteFilterConfig::CompressorPerRouteFilterConfig(
-    const envoy::extensions::filters::http::compressor::v3::CompressorPerRoute& config) {
+    const envoy::extensions::filters::http::compressor::v3::CompressorPerRoute& config,
+    Server::Configuration::ServerFactoryContext& context,
+    ProtobufMessage::ValidationVisitor& validation_visitor) {
   switch (config.override_case()) {
   case CompressorPerRoute::kDisabled:
     response_compression_enabled_ = false;
@@ -179,6 +201,11 @@ CompressorPerRouteFilterConfig::CompressorPerRouteFilterConfig(
       // Consequently, if `response_direction_config.common_direction_config.enabled` ever gets
       // added, its absence must enable compression.
       response_compression_enabled_ = true;
+      if (config.overrides().response_direction_config().has_compressor_library()) {
+        response_compressor_factory_ = createCompressorFactory(
+            config.overrides().response_direction_config().compressor_library(), context,
+            validation_visitor);
+      }
     }
     break;
   case CompressorPerRoute::OVERRIDE_NOT_SET:
@@ -282,7 +309,7 @@ Http::FilterHeadersStatus CompressorFilter::encodeHeaders(Http::ResponseHeaderMa
     headers.setInline(response_content_encoding_handle.handle(), config_->contentEncoding());
     config.stats().compressed_.inc();
     // Finally instantiate the compressor.
-    response_compressor_ = config_->makeCompressor();
+    response_compressor_ = makeResponseCompressor();
   } else {
     config.stats().not_compressed_.inc();
   }
@@ -628,6 +655,22 @@ void CompressorFilter::sanitizeEtagHeader(Http::ResponseHeaderMap& headers) {
   }
 }
 
+// Instantiates a compressor for the response, preferring a per-route compressor library when one
+// is configured. A per-route library whose content encoding differs from the filter-level one is
+// ignored: encoding negotiation and the content-encoding header use the filter-level library, so
+// honoring such an override would mislabel the response.
+Envoy::Compression::Compressor::CompressorPtr CompressorFilter::makeResponseCompressor() const {
+  const CompressorPerRouteFilterConfig* per_route_config =
+      Http::Utility::resolveMostSpecificPerFilterConfig<CompressorPerRouteFilterConfig>(
+          decoder_callbacks_);
+  if (per_route_config != nullptr && per_route_config->responseCompressorFactory() != nullptr &&
+      absl::EqualsIgnoreCase(per_route_config->responseCompressorFactory()->contentEncoding(),
+                             config_->contentEncoding())) {
+    return per_route_config->responseCompressorFactory()->createCompressor();
+  }
+  return config_->makeCompressor();
+}
+
 // True if response compression is enabled.
 bool CompressorFilter::compressionEnabled(
     const CompressorFilterConfig::ResponseDirectionConfig& config) const {
@@ -1,7 +1,10 @@
 #pragma once
 
+#include "envoy/compression/compressor/config.h"
 #include "envoy/compression/compressor/factory.h"
+#include "envoy/config/core/v3/extension.pb.h"
 #include "envoy/extensions/filters/http/compressor/v3/compressor.pb.h"
+#include "envoy/server/factory_context.h"
 #include "envoy/stats/stats_macros.h"
 
 #include "source/common/protobuf/protobuf.h"
@@ -162,17 +165,35 @@ private:
 };
 using CompressorFilterConfigSharedPtr = std::shared_ptr<CompressorFilterConfig>;
 
+/**
+ * Creates a compressor factory from a ``compressor_library`` extension config.
+ * Throws EnvoyException if no implementation is registered for the config's type.
+ */
+Envoy::Compression::Compressor::CompressorFactoryPtr
+createCompressorFactory(const envoy::config::core::v3::TypedExtensionConfig& library_config,
+                        Server::Configuration::ServerFactoryContext& context,
+                        ProtobufMessage::ValidationVisitor& validation_visitor);
+
 class CompressorPerRouteFilterConfig : public Router::RouteSpecificFilterConfig {
 public:
   CompressorPerRouteFilterConfig(
-      const envoy::extensions::filters::http::compressor::v3::CompressorPerRoute& config);
+      const envoy::extensions::filters::http::compressor::v3::CompressorPerRoute& config,
+      Server::Configuration::ServerFactoryContext& context,
+      ProtobufMessage::ValidationVisitor& validation_visitor);
 
   // If a value is present, that value overrides
   // ResponseDirectionConfig::compressionEnabled.
   absl::optional<bool> responseCompressionEnabled() const { return response_compression_enabled_; }
 
+  // If non-null, this factory overrides the filter-level one when instantiating a compressor for
+  // responses on this route.
+  const Envoy::Compression::Compressor::CompressorFactoryPtr& responseCompressorFactory() const {
+    return response_compressor_factory_;
+  }
+
 private:
   absl::optional<bool> response_compression_enabled_;
+  Envoy::Compression::Compressor::CompressorFactoryPtr response_compressor_factory_;
 };
 
 /**
@@ -225,6 +246,7 @@ private:
 
   std::unique_ptr<EncodingDecision> chooseEncoding(const Http::ResponseHeaderMap& headers) const;
   bool shouldCompress(const EncodingDecision& decision) const;
+  Envoy::Compression::Compressor::CompressorPtr makeResponseCompressor() const;
 
   Envoy::Compression::Compressor::CompressorPtr response_compressor_;
   Envoy::Compression::Compressor::CompressorPtr request_compressor_;
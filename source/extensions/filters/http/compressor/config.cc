@@ -13,20 +13,9 @@ namespace Compressor {
 Http::FilterFactoryCb CompressorFilterFactory::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::compressor::v3::Compressor& proto_config,
     const std::string& stats_prefix, Server::Configuration::FactoryContext& context) {
-  const std::string type{TypeUtil::typeUrlToDescriptorFullName(
-      proto_config.compressor_library().typed_config().type_url())};
-  Compression::Compressor::NamedCompressorLibraryConfigFactory* const config_factory =
-      Registry::FactoryRegistry<
-          Compression::Compressor::NamedCompressorLibraryConfigFactory>::getFactoryByType(type);
-  if (config_factory == nullptr) {
-    throw EnvoyException(
-        fmt::format("Didn't find a registered implementation for type: '{}'", type));
-  }
-  ProtobufTypes::MessagePtr message = Config::Utility::translateAnyToFactoryConfig(
-      proto_config.compressor_library().typed_config(), context.messageValidationVisitor(),
-      *config_factory);
   Compression::Compressor::CompressorFactoryPtr compressor_factory =
-      config_factory->createCompressorFactoryFromProto(*message, context);
+      createCompressorFactory(proto_config.compressor_library(), context.getServerFactoryContext(),
+                              context.messageValidationVisitor());
   CompressorFilterConfigSharedPtr config =
       std::make_shared<CompressorFilterConfig>(proto_config, stats_prefix, context.scope(),
                                                context.runtime(), std::move(compressor_factory));
@@ -38,8 +27,10 @@ Http::FilterFactoryCb CompressorFilterFactory::createFilterFactoryFromProtoTyped
 Router::RouteSpecificFilterConfigConstSharedPtr
 CompressorFilterFactory::createRouteSpecificFilterConfigTyped(
     const envoy::extensions::filters::http::compressor::v3::CompressorPerRoute& proto_config,
-    Server::Configuration::ServerFactoryContext&, ProtobufMessage::ValidationVisitor&) {
-  return std::make_shared<CompressorPerRouteFilterConfig>(proto_config);
+    Server::Configuration::ServerFactoryContext& context,
+    ProtobufMessage::ValidationVisitor& validation_visitor) {
+  return std::make_shared<CompressorPerRouteFilterConfig>(proto_config, context,
+                                                          validation_visitor);
 }
 
 /**
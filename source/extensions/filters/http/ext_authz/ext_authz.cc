@@ -15,6 +15,45 @@ namespace Extensions {
 namespace HttpFilters {
 namespace ExtAuthz {
 
+absl::optional<Filters::Common::ExtAuthz::Response>
+FilterConfig::lookupCachedDecision(const std::string& key, MonotonicTime now) {
+  ASSERT(decision_cache_slot_ != nullptr);
+  OptRef<ThreadLocalDecisionCache> cache = decision_cache_slot_->get();
+  if (!cache.has_value()) {
+    return absl::nullopt;
+  }
+  const auto it = cache->entries.find(key);
+  if (it == cache->entries.end() || now >= it->second.expires_at) {
+    // Expired entries are left in place; they are refreshed on the next store for this key or
+    // eventually evicted in insertion order.
+    return absl::nullopt;
+  }
+  return it->second.response;
+}
+
+void FilterConfig::storeCachedDecision(const std::string& key,
+                                       const Filters::Common::ExtAuthz::Response& response,
+                                       MonotonicTime now) {
+  ASSERT(decision_cache_slot_ != nullptr);
+  OptRef<ThreadLocalDecisionCache> cache = decision_cache_slot_->get();
+  if (!cache.has_value()) {
+    return;
+  }
+  const MonotonicTime expires_at = now + decision_cache_ttl_;
+  const auto it = cache->entries.find(key);
+  if (it != cache->entries.end()) {
+    it->second.response = response;
+    it->second.expires_at = expires_at;
+    return;
+  }
+  while (cache->entries.size() >= decision_cache_max_size_ && !cache->insertion_order.empty()) {
+    cache->entries.erase(cache->insertion_order.front());
+    cache->insertion_order.pop_front();
+  }
+  cache->entries.emplace(key, ThreadLocalDecisionCache::Entry{response, expires_at});
+  cache->insertion_order.push_back(key);
+}
+
 void FilterConfigPerRoute::merge(const FilterConfigPerRoute& other) {
   // We only merge context extensions here, and leave boolean flags untouched since those flags are
   // not used from the merged config.
@@ -109,6 +148,31 @@ Http::FilterHeadersStatus Filter::decodeHeaders(Http::RequestHeaderMap& headers,
   }
 
   request_headers_ = &headers;
+
+  if (config_->decisionCacheEnabled()) {
+    cache_key_ = buildDecisionCacheKey(headers, *route);
+    if (cache_key_.has_value()) {
+      auto cached_response = config_->lookupCachedDecision(
+          *cache_key_, decoder_callbacks_->dispatcher().timeSource().monotonicTime());
+      if (cached_response.has_value()) {
+        ENVOY_STREAM_LOG(trace, "ext_authz filter replaying cached authorization decision",
+                         *decoder_callbacks_);
+        stats_.cache_hit_.inc();
+        from_cache_ = true;
+        cluster_ = decoder_callbacks_->clusterInfo();
+        filter_return_ = FilterReturn::StopDecoding;
+        initiating_call_ = true;
+        onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(
+            std::move(cached_response.value())));
+        initiating_call_ = false;
+        return filter_return_ == FilterReturn::StopDecoding
+                   ? Http::FilterHeadersStatus::StopIteration
+                   : Http::FilterHeadersStatus::Continue;
+      }
+      stats_.cache_miss_.inc();
+    }
+  }
+
   buffer_data_ = config_->withRequestBody() && !per_route_flags.skip_request_body_buffering_ &&
                  !(end_stream || Http::Utility::isWebSocketUpgradeRequest(headers) ||
                    Http::Utility::isH2UpgradeRequest(headers));
@@ -226,6 +290,15 @@ void Filter::onComplete(Filters::Common::ExtAuthz::ResponsePtr&& response) {
   using Filters::Common::ExtAuthz::CheckStatus;
   Stats::StatName empty_stat_name;
 
+  // Store the decision before any of the response mutations below are applied or moved out.
+  // Errors are never cached so that transient authorization server failures are retried.
+  if (!from_cache_ && cache_key_.has_value() &&
+      (response->status == CheckStatus::OK ||
+       (response->status == CheckStatus::Denied && config_->cacheDeniedResponses()))) {
+    config_->storeCachedDecision(*cache_key_, *response,
+                                 decoder_callbacks_->dispatcher().timeSource().monotonicTime());
+  }
+
   if (!response->dynamic_metadata.fields().empty()) {
     // Add duration of call to dynamic metadata if applicable
     if (start_time_.has_value() && response->status == CheckStatus::OK) {
@@ -427,6 +500,39 @@ void Filter::onComplete(Filters::Common::ExtAuthz::ResponsePtr&& response) {
   }
 }
 
+absl::optional<std::string> Filter::buildDecisionCacheKey(const Http::RequestHeaderMap& headers,
+                                                          const Router::Route& route) const {
+  const Router::RouteEntry* route_entry = route.routeEntry();
+  if (route_entry == nullptr) {
+    // Direct response routes never reach the authorization server, so there is nothing to cache.
+    return absl::nullopt;
+  }
+  if (route_entry->routeName().empty()) {
+    // Unnamed routes would all collapse into one cache key per virtual host, replaying a
+    // decision cached for one route (and its per-route settings) for a different one. Only
+    // named routes participate in the cache.
+    return absl::nullopt;
+  }
+  std::string key = route_entry->virtualHost().name();
+  key.push_back('\0');
+  key.append(route_entry->routeName());
+  for (const Http::LowerCaseString& header_name : config_->decisionCacheKeyHeaders()) {
+    const auto values = headers.get(header_name);
+    if (values.empty()) {
+      return absl::nullopt;
+    }
+    // '\0' cannot appear in a header value, so it unambiguously separates the key components.
+    key.push_back('\0');
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (i > 0) {
+        key.push_back(',');
+      }
+      absl::StrAppend(&key, values[i]->value().getStringView());
+    }
+  }
+  return key;
+}
+
 bool Filter::isBufferFull() const {
   const auto* buffer = decoder_callbacks_->decodingBuffer();
   if (config_->allowPartialMessage() && buffer != nullptr) {
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <string>
 #include <vector>
@@ -11,6 +13,7 @@
 #include "envoy/service/auth/v3/external_auth.pb.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats_macros.h"
+#include "envoy/thread_local/thread_local.h"
 #include "envoy/upstream/cluster_manager.h"
 
 #include "source/common/common/assert.h"
@@ -19,12 +22,15 @@
 #include "source/common/common/utility.h"
 #include "source/common/http/codes.h"
 #include "source/common/http/header_map_impl.h"
+#include "source/common/protobuf/utility.h"
 #include "source/common/runtime/runtime_protos.h"
 #include "source/extensions/filters/common/ext_authz/check_request_utils.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz_grpc_impl.h"
 #include "source/extensions/filters/common/ext_authz/ext_authz_http_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -39,7 +45,9 @@ namespace ExtAuthz {
   COUNTER(denied)                                                                                  \
   COUNTER(error)                                                                                   \
   COUNTER(disabled)                                                                                \
-  COUNTER(failure_mode_allowed)
+  COUNTER(failure_mode_allowed)                                                                    \
+  COUNTER(cache_hit)                                                                               \
+  COUNTER(cache_miss)
 
 /**
  * Wrapper struct for ext_authz filter stats. @see stats_macros.h
@@ -48,6 +56,21 @@ struct ExtAuthzFilterStats {
   ALL_EXT_AUTHZ_FILTER_STATS(GENERATE_COUNTER_STRUCT)
 };
 
+/**
+ * Per-worker cache of authorization decisions, keyed by the matched route name and the values of
+ * the configured key headers. Each worker owns its own cache so no locking is needed; entries are
+ * evicted in insertion order once the configured size limit is reached.
+ */
+struct ThreadLocalDecisionCache : public ThreadLocal::ThreadLocalObject {
+  struct Entry {
+    Filters::Common::ExtAuthz::Response response;
+    MonotonicTime expires_at;
+  };
+
+  absl::flat_hash_map<std::string, Entry> entries;
+  std::deque<std::string> insertion_order;
+};
+
 /**
  * Configuration for the External Authorization (ext_authz) filter.
  */
@@ -55,9 +78,12 @@ class FilterConfig {
   using LabelsMap = Protobuf::Map<std::string, std::string>;
 
 public:
+  static constexpr uint32_t DefaultDecisionCacheSize = 1024;
+
   FilterConfig(const envoy::extensions::filters::http::ext_authz::v3::ExtAuthz& config,
                Stats::Scope& scope, Runtime::Loader& runtime, Http::Context& http_context,
-               const std::string& stats_prefix, envoy::config::bootstrap::v3::Bootstrap& bootstrap)
+               const std::string& stats_prefix, envoy::config::bootstrap::v3::Bootstrap& bootstrap,
+               ThreadLocal::SlotAllocator& tls)
       : allow_partial_message_(config.with_request_body().allow_partial_message()),
         failure_mode_allow_(config.failure_mode_allow()),
         clear_route_cache_(config.clear_route_cache()),
@@ -84,6 +110,11 @@ public:
                                            config.typed_metadata_context_namespaces().end()),
         include_peer_certificate_(config.include_peer_certificate()),
         include_tls_session_(config.include_tls_session()),
+        decision_cache_ttl_(std::chrono::milliseconds(
+            PROTOBUF_GET_MS_OR_DEFAULT(config.decision_cache(), ttl, 0))),
+        decision_cache_max_size_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(
+            config.decision_cache(), max_cache_size, DefaultDecisionCacheSize)),
+        cache_denied_responses_(config.decision_cache().cache_denied_responses()),
         stats_(generateStats(stats_prefix, config.stat_prefix(), scope)),
         ext_authz_ok_(pool_.add(createPoolStatName(config.stat_prefix(), "ok"))),
         ext_authz_denied_(pool_.add(createPoolStatName(config.stat_prefix(), "denied"))),
@@ -120,6 +151,15 @@ public:
             config.allowed_headers(), true);
       }
     }
+
+    if (config.has_decision_cache()) {
+      for (const auto& header_name : config.decision_cache().key_headers()) {
+        decision_cache_key_headers_.emplace_back(header_name);
+      }
+      decision_cache_slot_ = ThreadLocal::TypedSlot<ThreadLocalDecisionCache>::makeUnique(tls);
+      decision_cache_slot_->set(
+          [](Event::Dispatcher&) { return std::make_shared<ThreadLocalDecisionCache>(); });
+    }
   }
 
   bool allowPartialMessage() const { return allow_partial_message_; }
@@ -173,6 +213,26 @@ public:
     return request_header_matchers_;
   }
 
+  bool decisionCacheEnabled() const { return decision_cache_slot_ != nullptr; }
+  bool cacheDeniedResponses() const { return cache_denied_responses_; }
+  const std::vector<Http::LowerCaseString>& decisionCacheKeyHeaders() const {
+    return decision_cache_key_headers_;
+  }
+
+  /**
+   * @return the cached authorization decision for the given key if one is present and has not
+   *         expired, or absl::nullopt otherwise.
+   */
+  absl::optional<Filters::Common::ExtAuthz::Response>
+  lookupCachedDecision(const std::string& key, MonotonicTime now);
+
+  /**
+   * Stores an authorization decision in this worker's cache, evicting the oldest entries if the
+   * cache is at its configured size limit.
+   */
+  void storeCachedDecision(const std::string& key,
+                           const Filters::Common::ExtAuthz::Response& response, MonotonicTime now);
+
 private:
   static Http::Code toErrorCode(uint64_t status) {
     const auto code = static_cast<Http::Code>(status);
@@ -222,6 +282,13 @@ private:
   const bool include_peer_certificate_;
   const bool include_tls_session_;
 
+  const std::chrono::milliseconds decision_cache_ttl_;
+  const uint32_t decision_cache_max_size_;
+  const bool cache_denied_responses_;
+  std::vector<Http::LowerCaseString> decision_cache_key_headers_;
+  // Only allocated when the decision cache is configured.
+  ThreadLocal::TypedSlotPtr<ThreadLocalDecisionCache> decision_cache_slot_;
+
   // The stats for the filter.
   ExtAuthzFilterStats stats_;
 
@@ -316,6 +383,12 @@ private:
   void continueDecoding();
   bool isBufferFull() const;
 
+  // Builds the decision cache key for this request from the matched route name and the values of
+  // the configured key headers. Returns absl::nullopt if any key header is missing, in which case
+  // the request bypasses the cache entirely.
+  absl::optional<std::string> buildDecisionCacheKey(const Http::RequestHeaderMap& headers,
+                                                    const Router::Route& route) const;
+
   // This holds a set of flags defined in per-route configuration.
   struct PerRouteFlags {
     const bool skip_check_;
@@ -351,6 +424,10 @@ private:
   bool initiating_call_{};
   bool buffer_data_{};
   bool skip_check_{false};
+  // Set when the decision cache is enabled and all key headers are present on the request.
+  absl::optional<std::string> cache_key_;
+  // True when onComplete() is replaying a cached decision, so that it is not stored again.
+  bool from_cache_{false};
   envoy::service::auth::v3::CheckRequest check_request_{};
 };
 
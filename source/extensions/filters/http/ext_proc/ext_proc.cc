@@ -576,16 +576,17 @@ void Filter::onReceiveMessage(std::unique_ptr<ProcessingResponse>&& r) {
   absl::Status processing_status;
   switch (response->response_case()) {
   case ProcessingResponse::ResponseCase::kRequestHeaders:
-    processing_status = decoding_state_.handleHeadersResponse(response->request_headers());
+    processing_status = decoding_state_.handleHeadersResponse(*response->mutable_request_headers());
     break;
   case ProcessingResponse::ResponseCase::kResponseHeaders:
-    processing_status = encoding_state_.handleHeadersResponse(response->response_headers());
+    processing_status =
+        encoding_state_.handleHeadersResponse(*response->mutable_response_headers());
     break;
   case ProcessingResponse::ResponseCase::kRequestBody:
-    processing_status = decoding_state_.handleBodyResponse(response->request_body());
+    processing_status = decoding_state_.handleBodyResponse(*response->mutable_request_body());
     break;
   case ProcessingResponse::ResponseCase::kResponseBody:
-    processing_status = encoding_state_.handleBodyResponse(response->response_body());
+    processing_status = encoding_state_.handleBodyResponse(*response->mutable_response_body());
     break;
   case ProcessingResponse::ResponseCase::kRequestTrailers:
     processing_status = decoding_state_.handleTrailersResponse(response->request_trailers());
@@ -92,7 +92,26 @@ absl::Status MutationUtils::applyHeaderMutations(const HeaderMutation& mutation,
   return absl::OkStatus();
 }
 
-void MutationUtils::applyBodyMutations(const BodyMutation& mutation, Buffer::Instance& buffer) {
+namespace {
+
+// A self-deleting buffer fragment that owns a body string moved out of a BodyMutation, so that
+// the replacement body can be added to the buffer without copying it.
+class BodyStringFragment : public Buffer::BufferFragment {
+public:
+  explicit BodyStringFragment(std::string&& body) : body_(std::move(body)) {}
+
+  // Buffer::BufferFragment
+  const void* data() const override { return body_.data(); }
+  size_t size() const override { return body_.size(); }
+  void done() override { delete this; }
+
+private:
+  const std::string body_;
+};
+
+} // namespace
+
+void MutationUtils::applyBodyMutations(BodyMutation& mutation, Buffer::Instance& buffer) {
   switch (mutation.mutation_case()) {
   case BodyMutation::MutationCase::kClearBody:
     if (mutation.clear_body()) {
@@ -104,7 +123,11 @@ void MutationUtils::applyBodyMutations(const BodyMutation& mutation, Buffer::Ins
     ENVOY_LOG(trace, "Replacing body of {} bytes with new body of {} bytes", buffer.length(),
               mutation.body().size());
     buffer.drain(buffer.length());
-    buffer.add(mutation.body());
+    if (!mutation.body().empty()) {
+      // Take ownership of the replacement body instead of copying it; rewritten bodies from the
+      // processor can be large and the chunk is about to be discarded anyway.
+      buffer.addBufferFragment(*new BodyStringFragment(std::move(*mutation.mutable_body())));
+    }
     break;
   default:
     // Nothing to do on default
@@ -32,8 +32,10 @@ public:
                        const Filters::Common::MutationRules::Checker& rule_checker,
                        Stats::Counter& rejected_mutations);
 
-  // Modify a buffer based on a set of mutations from a protobuf
-  static void applyBodyMutations(const envoy::service::ext_proc::v3::BodyMutation& mutation,
+  // Modify a buffer based on a set of mutations from a protobuf. A replacement
+  // body is moved out of the mutation into the buffer rather than copied, so
+  // the mutation must not be reused afterwards.
+  static void applyBodyMutations(envoy::service::ext_proc::v3::BodyMutation& mutation,
                                  Buffer::Instance& buffer);
 
   // Determine if a particular HTTP status code is valid.
@@ -77,11 +77,11 @@ bool ProcessorState::restartMessageTimer(const uint32_t message_timeout_ms) {
   }
 }
 
-absl::Status ProcessorState::handleHeadersResponse(const HeadersResponse& response) {
+absl::Status ProcessorState::handleHeadersResponse(HeadersResponse& response) {
   if (callback_state_ == CallbackState::HeadersCallback) {
     ENVOY_LOG(debug, "applying headers response. body mode = {}",
               ProcessingMode::BodySendMode_Name(body_mode_));
-    const auto& common_response = response.response();
+    auto& common_response = *response.mutable_response();
     if (common_response.has_header_mutation()) {
       const auto mut_status = MutationUtils::applyHeaderMutations(
           common_response.header_mutation(), *headers_,
@@ -106,11 +106,11 @@ absl::Status ProcessorState::handleHeadersResponse(const HeadersResponse& respon
         body_replaced_ = true;
         if (bufferedData() == nullptr) {
           Buffer::OwnedImpl new_body;
-          MutationUtils::applyBodyMutations(common_response.body_mutation(), new_body);
+          MutationUtils::applyBodyMutations(*common_response.mutable_body_mutation(), new_body);
           addBufferedData(new_body);
         } else {
           modifyBufferedData([&common_response](Buffer::Instance& buf) {
-            MutationUtils::applyBodyMutations(common_response.body_mutation(), buf);
+            MutationUtils::applyBodyMutations(*common_response.mutable_body_mutation(), buf);
           });
         }
       }
@@ -202,9 +202,9 @@ absl::Status ProcessorState::handleHeadersResponse(const HeadersResponse& respon
   return absl::FailedPreconditionError("spurious message");
 }
 
-absl::Status ProcessorState::handleBodyResponse(const BodyResponse& response) {
+absl::Status ProcessorState::handleBodyResponse(BodyResponse& response) {
   bool should_continue = false;
-  const auto& common_response = response.response();
+  auto& common_response = *response.mutable_response();
   if (callback_state_ == CallbackState::BufferedBodyCallback ||
       callback_state_ == CallbackState::StreamedBodyCallback ||
       callback_state_ == CallbackState::StreamedBodyCallbackFinishing ||
@@ -233,7 +233,7 @@ absl::Status ProcessorState::handleBodyResponse(const BodyResponse& response) {
           headers_->removeContentLength();
         }
         modifyBufferedData([&common_response](Buffer::Instance& data) {
-          MutationUtils::applyBodyMutations(common_response.body_mutation(), data);
+          MutationUtils::applyBodyMutations(*common_response.mutable_body_mutation(), data);
         });
       }
       clearWatermark();
@@ -250,7 +250,8 @@ absl::Status ProcessorState::handleBodyResponse(const BodyResponse& response) {
           if (common_response.has_body_mutation()) {
             ENVOY_LOG(debug, "Applying body response to chunk of data. Size = {}",
                       chunk->data.length());
-            MutationUtils::applyBodyMutations(common_response.body_mutation(), chunk->data);
+            MutationUtils::applyBodyMutations(*common_response.mutable_body_mutation(),
+                                              chunk->data);
           }
           delivered_one = true;
           // After we have delivered one chunk, don't process anything
@@ -294,7 +295,7 @@ absl::Status ProcessorState::handleBodyResponse(const BodyResponse& response) {
           // Always reset the content length here to prevent later problems.
           headers_->removeContentLength();
         }
-        MutationUtils::applyBodyMutations(common_response.body_mutation(), chunk->data);
+        MutationUtils::applyBodyMutations(*common_response.mutable_body_mutation(), chunk->data);
       }
       if (chunk->data.length() > 0) {
         ENVOY_LOG(trace, "Injecting {} bytes of processed data to filter stream",
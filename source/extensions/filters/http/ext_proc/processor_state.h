@@ -127,8 +127,10 @@ public:
   virtual void requestWatermark() PURE;
   virtual void clearWatermark() PURE;
 
-  absl::Status handleHeadersResponse(const envoy::service::ext_proc::v3::HeadersResponse& response);
-  absl::Status handleBodyResponse(const envoy::service::ext_proc::v3::BodyResponse& response);
+  // The headers and body responses are taken by mutable reference so that any replacement body
+  // they carry can be moved into the filter's buffers instead of copied.
+  absl::Status handleHeadersResponse(envoy::service::ext_proc::v3::HeadersResponse& response);
+  absl::Status handleBodyResponse(envoy::service::ext_proc::v3::BodyResponse& response);
   absl::Status
   handleTrailersResponse(const envoy::service::ext_proc::v3::TrailersResponse& response);
 
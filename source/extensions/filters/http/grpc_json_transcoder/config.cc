@@ -3,6 +3,7 @@
 #include "envoy/extensions/filters/http/grpc_json_transcoder/v3/transcoder.pb.h"
 #include "envoy/extensions/filters/http/grpc_json_transcoder/v3/transcoder.pb.validate.h"
 #include "envoy/registry/registry.h"
+#include "envoy/singleton/manager.h"
 
 #include "source/extensions/filters/http/grpc_json_transcoder/json_transcoder_filter.h"
 
@@ -11,12 +12,24 @@ namespace Extensions {
 namespace HttpFilters {
 namespace GrpcJsonTranscoder {
 
+SINGLETON_MANAGER_REGISTRATION(grpc_json_transcoder_descriptor_pool_registry);
+
+namespace {
+
+DescriptorPoolRegistrySharedPtr descriptorPoolRegistry(Singleton::Manager& singleton_manager) {
+  return singleton_manager.getTyped<DescriptorPoolRegistry>(
+      SINGLETON_MANAGER_REGISTERED_NAME(grpc_json_transcoder_descriptor_pool_registry),
+      [] { return std::make_shared<DescriptorPoolRegistry>(); });
+}
+
+} // namespace
+
 Http::FilterFactoryCb GrpcJsonTranscoderFilterConfig::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder&
         proto_config,
     const std::string&, Server::Configuration::FactoryContext& context) {
-  JsonTranscoderConfigSharedPtr filter_config =
-      std::make_shared<JsonTranscoderConfig>(proto_config, context.api());
+  JsonTranscoderConfigSharedPtr filter_config = std::make_shared<JsonTranscoderConfig>(
+      proto_config, context.api(), descriptorPoolRegistry(context.singletonManager()));
 
   return [filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<JsonTranscoderFilter>(*filter_config));
@@ -29,7 +42,8 @@ GrpcJsonTranscoderFilterConfig::createRouteSpecificFilterConfigTyped(
         proto_config,
     Server::Configuration::ServerFactoryContext& context, ProtobufMessage::ValidationVisitor&) {
 
-  return std::make_shared<JsonTranscoderConfig>(proto_config, context.api());
+  return std::make_shared<JsonTranscoderConfig>(proto_config, context.api(),
+                                                descriptorPoolRegistry(context.singletonManager()));
 }
 
 /**
@@ -9,6 +9,7 @@
 
 #include "source/common/common/assert.h"
 #include "source/common/common/enum_to_int.h"
+#include "source/common/common/hash.h"
 #include "source/common/common/utility.h"
 #include "source/common/grpc/common.h"
 #include "source/common/http/headers.h"
@@ -104,52 +105,114 @@ private:
   TranscoderInputStreamPtr response_stream_;
 };
 
+void addFileDescriptor(Protobuf::DescriptorPool& pool, const Protobuf::FileDescriptorProto& file) {
+  if (pool.BuildFile(file) == nullptr) {
+    throw EnvoyException("transcoding_filter: Unable to build proto descriptor pool");
+  }
+}
+
+void addBuiltinSymbolDescriptor(Protobuf::DescriptorPool& pool, const std::string& symbol_name) {
+  if (pool.FindFileContainingSymbol(symbol_name) != nullptr) {
+    return;
+  }
+
+  auto* builtin_pool = Protobuf::DescriptorPool::generated_pool();
+  if (!builtin_pool) {
+    return;
+  }
+
+  Protobuf::DescriptorPoolDatabase pool_database(*builtin_pool);
+  Protobuf::FileDescriptorProto file_proto;
+  pool_database.FindFileContainingSymbol(symbol_name, &file_proto);
+  addFileDescriptor(pool, file_proto);
+}
+
+std::shared_ptr<const Protobuf::DescriptorPool>
+buildDescriptorPool(const std::string& descriptor_bytes, bool convert_grpc_status) {
+  FileDescriptorSet descriptor_set;
+  if (!descriptor_set.ParseFromString(descriptor_bytes)) {
+    throw EnvoyException("transcoding_filter: Unable to parse proto descriptor");
+  }
+
+  auto pool = std::make_shared<Protobuf::DescriptorPool>();
+  for (const auto& file : descriptor_set.file()) {
+    addFileDescriptor(*pool, file);
+  }
+
+  if (convert_grpc_status) {
+    addBuiltinSymbolDescriptor(*pool, "google.protobuf.Any");
+    addBuiltinSymbolDescriptor(*pool, "google.rpc.Status");
+  }
+  return pool;
+}
+
 } // namespace
 
+DescriptorPoolRegistry::PoolSharedPtr
+DescriptorPoolRegistry::getOrCreate(uint64_t hash, const PoolFactory& create_fn) {
+  absl::MutexLock lock(&mutex_);
+  auto it = pools_.find(hash);
+  if (it != pools_.end()) {
+    if (PoolSharedPtr existing = it->second.lock(); existing != nullptr) {
+      return existing;
+    }
+  }
+  PoolSharedPtr pool = create_fn();
+  pools_[hash] = pool;
+  // Drop stale entries left behind by configs that have been fully drained.
+  for (auto entry = pools_.begin(); entry != pools_.end();) {
+    if (entry->second.expired()) {
+      pools_.erase(entry++);
+    } else {
+      ++entry;
+    }
+  }
+  return pool;
+}
+
 JsonTranscoderConfig::JsonTranscoderConfig(
     const envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder&
         proto_config,
-    Api::Api& api) {
+    Api::Api& api, DescriptorPoolRegistrySharedPtr pool_registry) {
 
   disabled_ = proto_config.services().empty();
   if (disabled_) {
     return;
   }
 
-  FileDescriptorSet descriptor_set;
-
+  std::string descriptor_bytes;
   switch (proto_config.descriptor_set_case()) {
   case envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder::
       DescriptorSetCase::kProtoDescriptor:
-    if (!descriptor_set.ParseFromString(
-            api.fileSystem().fileReadToEnd(proto_config.proto_descriptor()))) {
-      throw EnvoyException("transcoding_filter: Unable to parse proto descriptor");
-    }
+    descriptor_bytes = api.fileSystem().fileReadToEnd(proto_config.proto_descriptor());
     break;
   case envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder::
       DescriptorSetCase::kProtoDescriptorBin:
-    if (!descriptor_set.ParseFromString(proto_config.proto_descriptor_bin())) {
-      throw EnvoyException("transcoding_filter: Unable to parse proto descriptor");
-    }
+    descriptor_bytes = proto_config.proto_descriptor_bin();
     break;
   case envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder::
       DescriptorSetCase::DESCRIPTOR_SET_NOT_SET:
     throw EnvoyException("transcoding_filter: descriptor not set");
   }
 
-  for (const auto& file : descriptor_set.file()) {
-    addFileDescriptor(file);
-  }
-
   convert_grpc_status_ = proto_config.convert_grpc_status();
-  if (convert_grpc_status_) {
-    addBuiltinSymbolDescriptor("google.protobuf.Any");
-    addBuiltinSymbolDescriptor("google.rpc.Status");
+  const bool convert_grpc_status = convert_grpc_status_;
+  if (pool_registry != nullptr) {
+    // Key on the descriptor content rather than the file path so that configs pointing at
+    // different copies of the same descriptor set still share one pool. convert_grpc_status
+    // is folded into the hash because it pulls extra builtin files into the pool.
+    descriptor_pool_ = pool_registry->getOrCreate(
+        HashUtil::xxHash64(descriptor_bytes, convert_grpc_status ? 1 : 0),
+        [&descriptor_bytes, convert_grpc_status]() {
+          return buildDescriptorPool(descriptor_bytes, convert_grpc_status);
+        });
+  } else {
+    descriptor_pool_ = buildDescriptorPool(descriptor_bytes, convert_grpc_status);
   }
 
   type_helper_ = std::make_unique<google::grpc::transcoding::TypeHelper>(
       Protobuf::util::NewTypeResolverForDescriptorPool(Grpc::Common::typeUrlPrefix(),
-                                                       &descriptor_pool_));
+                                                       descriptor_pool_.get()));
 
   PathMatcherBuilder<MethodInfoSharedPtr> pmb;
   // clang-format off
@@ -162,7 +225,7 @@ JsonTranscoderConfig::JsonTranscoderConfig(
   }
 
   for (const auto& service_name : proto_config.services()) {
-    auto service = descriptor_pool_.FindServiceByName(service_name);
+    auto service = descriptor_pool_->FindServiceByName(service_name);
     if (service == nullptr) {
       throw EnvoyException("transcoding_filter: Could not find '" + service_name +
                            "' in the proto descriptor");
@@ -237,28 +300,6 @@ JsonTranscoderConfig::JsonTranscoderConfig(
   }
 }
 
-void JsonTranscoderConfig::addFileDescriptor(const Protobuf::FileDescriptorProto& file) {
-  if (descriptor_pool_.BuildFile(file) == nullptr) {
-    throw EnvoyException("transcoding_filter: Unable to build proto descriptor pool");
-  }
-}
-
-void JsonTranscoderConfig::addBuiltinSymbolDescriptor(const std::string& symbol_name) {
-  if (descriptor_pool_.FindFileContainingSymbol(symbol_name) != nullptr) {
-    return;
-  }
-
-  auto* builtin_pool = Protobuf::DescriptorPool::generated_pool();
-  if (!builtin_pool) {
-    return;
-  }
-
-  Protobuf::DescriptorPoolDatabase pool_database(*builtin_pool);
-  Protobuf::FileDescriptorProto file_proto;
-  pool_database.FindFileContainingSymbol(symbol_name, &file_proto);
-  addFileDescriptor(file_proto);
-}
-
 Status JsonTranscoderConfig::resolveField(const Protobuf::Descriptor* descriptor,
                                           const std::string& field_path_str,
                                           std::vector<const ProtobufWkt::Field*>* field_path,
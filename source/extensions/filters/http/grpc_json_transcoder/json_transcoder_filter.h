@@ -5,6 +5,7 @@
 #include "envoy/extensions/filters/http/grpc_json_transcoder/v3/transcoder.pb.h"
 #include "envoy/http/filter.h"
 #include "envoy/http/header_map.h"
+#include "envoy/singleton/instance.h"
 
 #include "source/common/buffer/buffer_impl.h"
 #include "source/common/common/logger.h"
@@ -12,6 +13,8 @@
 #include "source/common/protobuf/protobuf.h"
 #include "source/extensions/filters/http/grpc_json_transcoder/transcoder_input_stream_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
 #include "google/api/http.pb.h"
 #include "grpc_transcoding/path_matcher.h"
 #include "grpc_transcoding/request_message_translator.h"
@@ -50,6 +53,29 @@ struct MethodInfo {
 };
 using MethodInfoSharedPtr = std::shared_ptr<MethodInfo>;
 
+/**
+ * A process-wide cache of built descriptor pools, keyed by a hash of the raw descriptor set bytes
+ * and the options that affect pool contents. Many routes or filter chains typically point at the
+ * same (often multi-megabyte) descriptor file; interning the pool avoids parsing and building it
+ * once per filter config.
+ */
+class DescriptorPoolRegistry : public Singleton::Instance {
+public:
+  using PoolSharedPtr = std::shared_ptr<const Protobuf::DescriptorPool>;
+  using PoolFactory = std::function<PoolSharedPtr()>;
+
+  /**
+   * @return the descriptor pool interned under hash, built with create_fn if absent.
+   */
+  PoolSharedPtr getOrCreate(uint64_t hash, const PoolFactory& create_fn);
+
+private:
+  absl::Mutex mutex_;
+  absl::flat_hash_map<uint64_t, std::weak_ptr<const Protobuf::DescriptorPool>>
+      pools_ ABSL_GUARDED_BY(mutex_);
+};
+using DescriptorPoolRegistrySharedPtr = std::shared_ptr<DescriptorPoolRegistry>;
+
 /**
  * Global configuration for the gRPC JSON transcoder filter. Factory for the Transcoder interface.
  */
@@ -64,7 +90,7 @@ public:
   JsonTranscoderConfig(
       const envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder&
           proto_config,
-      Api::Api& api);
+      Api::Api& api, DescriptorPoolRegistrySharedPtr pool_registry = nullptr);
 
   /**
    * Create an instance of Transcoder interface based on incoming request.
@@ -111,8 +137,6 @@ public:
   absl::optional<uint32_t> max_request_body_size_;
   absl::optional<uint32_t> max_response_body_size_;
 
-  void addBuiltinSymbolDescriptor(const std::string& symbol_name);
-
 private:
   /**
    * Convert method descriptor to RequestInfo that needed for transcoding library
@@ -120,7 +144,6 @@ private:
   ProtobufUtil::Status methodToRequestInfo(const MethodInfoSharedPtr& method_info,
                                            google::grpc::transcoding::RequestInfo* info) const;
 
-  void addFileDescriptor(const Protobuf::FileDescriptorProto& file);
   ProtobufUtil::Status resolveField(const Protobuf::Descriptor* descriptor,
                                     const std::string& field_path_str,
                                     std::vector<const ProtobufWkt::Field*>* field_path,
@@ -129,7 +152,7 @@ private:
                                         const google::api::HttpRule& http_rule,
                                         MethodInfoSharedPtr& method_info);
 
-  Protobuf::DescriptorPool descriptor_pool_;
+  std::shared_ptr<const Protobuf::DescriptorPool> descriptor_pool_;
   google::grpc::transcoding::PathMatcherPtr<MethodInfoSharedPtr> path_matcher_;
   std::unique_ptr<google::grpc::transcoding::TypeHelper> type_helper_;
   google::grpc::transcoding::JsonResponseTranslateOptions response_translate_options_;
@@ -196,15 +196,10 @@ bool HeaderToMetadataFilter::addMetadata(StructMap& map, const std::string& meta
   }
   }
 
-  // Have we seen this namespace before?
-  auto namespace_iter = map.find(meta_namespace);
-  if (namespace_iter == map.end()) {
-    map[meta_namespace] = ProtobufWkt::Struct();
-    namespace_iter = map.find(meta_namespace);
-  }
-
-  auto& keyval = namespace_iter->second;
-  (*keyval.mutable_fields())[key] = val;
+  // operator[] default-constructs the Struct the first time a namespace is seen, so a single
+  // lookup covers both the new and existing namespace cases.
+  auto& keyval = map[meta_namespace];
+  (*keyval.mutable_fields())[key] = std::move(val);
 
   return true;
 }
@@ -227,7 +222,7 @@ void HeaderToMetadataFilter::applyKeyValue(std::string&& value, const Rule& rule
   }
   if (!value.empty()) {
     const auto& nspace = decideNamespace(keyval.metadata_namespace());
-    addMetadata(np, nspace, keyval.key(), value, keyval.type(), keyval.encode());
+    addMetadata(np, nspace, keyval.key(), std::move(value), keyval.type(), keyval.encode());
   } else {
     ENVOY_LOG(debug, "value is empty, not adding metadata");
   }
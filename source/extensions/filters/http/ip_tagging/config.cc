@@ -3,6 +3,7 @@
 #include "envoy/extensions/filters/http/ip_tagging/v3/ip_tagging.pb.h"
 #include "envoy/extensions/filters/http/ip_tagging/v3/ip_tagging.pb.validate.h"
 #include "envoy/registry/registry.h"
+#include "envoy/singleton/manager.h"
 
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/filters/http/ip_tagging/ip_tagging_filter.h"
@@ -12,12 +13,19 @@ namespace Extensions {
 namespace HttpFilters {
 namespace IpTagging {
 
+SINGLETON_MANAGER_REGISTRATION(ip_tagging_trie_registry);
+
 Http::FilterFactoryCb IpTaggingFilterFactory::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::ip_tagging::v3::IPTagging& proto_config,
     const std::string& stat_prefix, Server::Configuration::FactoryContext& context) {
 
-  IpTaggingFilterConfigSharedPtr config(
-      new IpTaggingFilterConfig(proto_config, stat_prefix, context.scope(), context.runtime()));
+  IpTagTrieRegistrySharedPtr trie_registry =
+      context.singletonManager().getTyped<IpTagTrieRegistry>(
+          SINGLETON_MANAGER_REGISTERED_NAME(ip_tagging_trie_registry),
+          [] { return std::make_shared<IpTagTrieRegistry>(); });
+
+  IpTaggingFilterConfigSharedPtr config(new IpTaggingFilterConfig(
+      proto_config, stat_prefix, context.scope(), context.runtime(), std::move(trie_registry)));
 
   return [config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamDecoderFilter(std::make_shared<IpTaggingFilter>(config));
@@ -5,6 +5,7 @@
 
 #include "source/common/http/header_map_impl.h"
 #include "source/common/http/headers.h"
+#include "source/common/protobuf/utility.h"
 
 #include "absl/strings/str_join.h"
 
@@ -13,9 +14,32 @@ namespace Extensions {
 namespace HttpFilters {
 namespace IpTagging {
 
+IpTagTrieRegistry::TrieSharedPtr IpTagTrieRegistry::getOrCreate(uint64_t hash,
+                                                                const TrieFactory& create_fn) {
+  absl::MutexLock lock(&mutex_);
+  auto it = tries_.find(hash);
+  if (it != tries_.end()) {
+    if (TrieSharedPtr existing = it->second.lock(); existing != nullptr) {
+      return existing;
+    }
+  }
+  TrieSharedPtr trie = create_fn();
+  tries_[hash] = trie;
+  // Opportunistically drop entries whose tries are no longer referenced by any filter config.
+  for (auto entry = tries_.begin(); entry != tries_.end();) {
+    if (entry->second.expired()) {
+      tries_.erase(entry++);
+    } else {
+      ++entry;
+    }
+  }
+  return trie;
+}
+
 IpTaggingFilterConfig::IpTaggingFilterConfig(
     const envoy::extensions::filters::http::ip_tagging::v3::IPTagging& config,
-    const std::string& stat_prefix, Stats::Scope& scope, Runtime::Loader& runtime)
+    const std::string& stat_prefix, Stats::Scope& scope, Runtime::Loader& runtime,
+    IpTagTrieRegistrySharedPtr trie_registry)
     : request_type_(requestTypeEnum(config.request_type())), scope_(scope), runtime_(runtime),
       stat_name_set_(scope.symbolTable().makeSet("IpTagging")),
       stats_prefix_(stat_name_set_->add(stat_prefix + "ip_tagging")),
@@ -52,7 +76,19 @@ IpTaggingFilterConfig::IpTaggingFilterConfig(
     tag_data.emplace_back(ip_tag.ip_tag_name(), cidr_set);
     stat_name_set_->rememberBuiltin(absl::StrCat(ip_tag.ip_tag_name(), ".hit"));
   }
-  trie_ = std::make_unique<Network::LcTrie::LcTrie<std::string>>(tag_data);
+
+  if (trie_registry != nullptr) {
+    // Intern the trie on the tag data so that identical tables across filter instances and
+    // config generations are built only once. Hashing only the ip_tags field keeps unrelated
+    // settings such as the request type from defeating sharing.
+    envoy::extensions::filters::http::ip_tagging::v3::IPTagging tags_only;
+    *tags_only.mutable_ip_tags() = config.ip_tags();
+    trie_ = trie_registry->getOrCreate(MessageUtil::hash(tags_only), [&tag_data]() {
+      return std::make_shared<const Network::LcTrie::LcTrie<std::string>>(tag_data);
+    });
+  } else {
+    trie_ = std::make_shared<const Network::LcTrie::LcTrie<std::string>>(tag_data);
+  }
 }
 
 void IpTaggingFilterConfig::incCounter(Stats::StatName name) {
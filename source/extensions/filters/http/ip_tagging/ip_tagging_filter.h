@@ -10,6 +10,7 @@
 #include "envoy/extensions/filters/http/ip_tagging/v3/ip_tagging.pb.h"
 #include "envoy/http/filter.h"
 #include "envoy/runtime/runtime.h"
+#include "envoy/singleton/instance.h"
 #include "envoy/stats/scope.h"
 
 #include "source/common/network/cidr_range.h"
@@ -26,6 +27,29 @@ namespace IpTagging {
  */
 enum class FilterRequestType { INTERNAL, EXTERNAL, BOTH };
 
+/**
+ * A process-wide registry that interns LC tries by a hash of their tag data. Filter instances
+ * configured with identical ``ip_tags`` (e.g. the same large geo table on many listeners) share
+ * one trie, and config updates that leave the tag data unchanged reuse the existing trie instead
+ * of rebuilding it.
+ */
+class IpTagTrieRegistry : public Singleton::Instance {
+public:
+  using TrieSharedPtr = std::shared_ptr<const Network::LcTrie::LcTrie<std::string>>;
+  using TrieFactory = std::function<TrieSharedPtr()>;
+
+  /**
+   * @return the trie interned under hash, created with create_fn if absent.
+   */
+  TrieSharedPtr getOrCreate(uint64_t hash, const TrieFactory& create_fn);
+
+private:
+  absl::Mutex mutex_;
+  absl::flat_hash_map<uint64_t, std::weak_ptr<const Network::LcTrie::LcTrie<std::string>>>
+      tries_ ABSL_GUARDED_BY(mutex_);
+};
+using IpTagTrieRegistrySharedPtr = std::shared_ptr<IpTagTrieRegistry>;
+
 /**
  * Configuration for the HTTP IP Tagging filter.
  */
@@ -33,7 +57,8 @@ class IpTaggingFilterConfig {
 public:
   IpTaggingFilterConfig(const envoy::extensions::filters::http::ip_tagging::v3::IPTagging& config,
                         const std::string& stat_prefix, Stats::Scope& scope,
-                        Runtime::Loader& runtime);
+                        Runtime::Loader& runtime,
+                        IpTagTrieRegistrySharedPtr trie_registry = nullptr);
 
   Runtime::Loader& runtime() { return runtime_; }
   FilterRequestType requestType() const { return request_type_; }
@@ -70,7 +95,7 @@ private:
   const Stats::StatName no_hit_;
   const Stats::StatName total_;
   const Stats::StatName unknown_tag_;
-  std::unique_ptr<Network::LcTrie::LcTrie<std::string>> trie_;
+  std::shared_ptr<const Network::LcTrie::LcTrie<std::string>> trie_;
 };
 
 using IpTaggingFilterConfigSharedPtr = std::shared_ptr<IpTaggingFilterConfig>;
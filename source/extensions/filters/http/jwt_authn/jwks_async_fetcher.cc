@@ -21,6 +21,10 @@ constexpr std::chrono::seconds RefetchBeforeExpiredSec{5};
 // Default number of seconds to refetch after a failed fetch.
 constexpr std::chrono::seconds DefaultRefetchAfterFailedSec{1};
 
+// Maximum fraction of a refetch duration used as random jitter, as a divisor; the refetch fires
+// up to 1/10 of the duration early.
+constexpr uint64_t RefetchJitterDivisor = 10;
+
 std::chrono::milliseconds getFailedRefetchDuration(const JwksAsyncFetch& async_fetch) {
   if (async_fetch.has_failed_refetch_duration()) {
     // Use `durationToMilliseconds` as it has stricter max boundary to the `seconds` value to avoid
@@ -77,6 +81,18 @@ std::chrono::seconds JwksAsyncFetcher::getCacheDuration(const RemoteJwks& remote
   return DefaultCacheExpirationSec;
 }
 
+std::chrono::milliseconds
+JwksAsyncFetcher::jitteredDuration(std::chrono::milliseconds duration) const {
+  // Subtract up to 10% of the duration at random so that a fleet of proxies configured with the
+  // same cache_duration does not refetch the JWKS endpoint in lockstep after a key rotation.
+  const uint64_t jitter_window = duration.count() / RefetchJitterDivisor;
+  if (jitter_window == 0) {
+    return duration;
+  }
+  return duration -
+         std::chrono::milliseconds(context_.api().randomGenerator().random() % jitter_window);
+}
+
 void JwksAsyncFetcher::fetch() {
   if (fetcher_) {
     fetcher_->cancel();
@@ -97,7 +113,7 @@ void JwksAsyncFetcher::handleFetchDone() {
 void JwksAsyncFetcher::onJwksSuccess(google::jwt_verify::JwksPtr&& jwks) {
   done_fn_(std::move(jwks));
   handleFetchDone();
-  refetch_timer_->enableTimer(good_refetch_duration_);
+  refetch_timer_->enableTimer(jitteredDuration(good_refetch_duration_));
   stats_.jwks_fetch_success_.inc();
 
   // Note: not to free fetcher_ within onJwksSuccess or onJwksError function.
@@ -113,7 +129,7 @@ void JwksAsyncFetcher::onJwksSuccess(google::jwt_verify::JwksPtr&& jwks) {
 void JwksAsyncFetcher::onJwksError(Failure) {
   ENVOY_LOG(warn, "{}: failed", debug_name_);
   handleFetchDone();
-  refetch_timer_->enableTimer(failed_refetch_duration_);
+  refetch_timer_->enableTimer(jitteredDuration(failed_refetch_duration_));
   stats_.jwks_fetch_failed_.inc();
 
   // Note: not to free fetcher_ in this function. Please see comment at onJwksSuccess.
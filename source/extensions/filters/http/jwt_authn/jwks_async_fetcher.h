@@ -46,6 +46,8 @@ private:
   void fetch();
   // Handle fetch done.
   void handleFetchDone();
+  // Apply random jitter to a refetch duration to stagger fetches across a fleet.
+  std::chrono::milliseconds jitteredDuration(std::chrono::milliseconds duration) const;
 
   // Override the functions from Common::JwksFetcher::JwksReceiver
   void onJwksSuccess(google::jwt_verify::JwksPtr&& jwks) override;
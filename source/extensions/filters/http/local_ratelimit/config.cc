@@ -17,7 +17,8 @@ Http::FilterFactoryCb LocalRateLimitFilterConfig::createFilterFactoryFromProtoTy
     const std::string&, Server::Configuration::FactoryContext& context) {
   FilterConfigSharedPtr filter_config = std::make_shared<FilterConfig>(
       proto_config, context.localInfo(), context.mainThreadDispatcher(), context.scope(),
-      context.runtime());
+      context.runtime(), false,
+      context.getServerFactoryContext().options().concurrency());
   return [filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<Filter>(filter_config));
   };
@@ -29,7 +30,8 @@ LocalRateLimitFilterConfig::createRouteSpecificFilterConfigTyped(
     Server::Configuration::ServerFactoryContext& context, ProtobufMessage::ValidationVisitor&) {
   return std::make_shared<const FilterConfig>(proto_config, context.localInfo(),
                                               context.mainThreadDispatcher(), context.scope(),
-                                              context.runtime(), true);
+                                              context.runtime(), true,
+                                              context.options().concurrency());
 }
 
 /**
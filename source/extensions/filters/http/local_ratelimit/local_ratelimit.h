@@ -69,9 +69,12 @@ private:
  */
 class FilterConfig : public Router::RouteSpecificFilterConfig {
 public:
+  // `num_stripes` is passed through to the token bucket; pass the server concurrency so that each
+  // worker gets its own bucket stripe. See LocalRateLimiterImpl for details.
   FilterConfig(const envoy::extensions::filters::http::local_ratelimit::v3::LocalRateLimit& config,
                const LocalInfo::LocalInfo& local_info, Event::Dispatcher& dispatcher,
-               Stats::Scope& scope, Runtime::Loader& runtime, bool per_route = false);
+               Stats::Scope& scope, Runtime::Loader& runtime, bool per_route = false,
+               uint32_t num_stripes = 1);
   ~FilterConfig() override {
     // Ensure that the LocalRateLimiterImpl instance will be destroyed on the thread where its inner
     // timer is created and running.
@@ -10,6 +10,7 @@
 #include "source/common/config/utility.h"
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/filters/common/ratelimit/ratelimit_impl.h"
+#include "source/extensions/filters/http/ratelimit/quota_cache.h"
 #include "source/extensions/filters/http/ratelimit/ratelimit.h"
 
 namespace Envoy {
@@ -21,13 +22,25 @@ Http::FilterFactoryCb RateLimitFilterConfig::createFilterFactoryFromProtoTyped(
     const envoy::extensions::filters::http::ratelimit::v3::RateLimit& proto_config,
     const std::string&, Server::Configuration::FactoryContext& context) {
   ASSERT(!proto_config.domain().empty());
-  FilterConfigSharedPtr filter_config(new FilterConfig(proto_config, context.localInfo(),
-                                                       context.scope(), context.runtime(),
-                                                       context.httpContext()));
   const std::chrono::milliseconds timeout =
       std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(proto_config, timeout, 20));
 
   Config::Utility::checkTransportVersion(proto_config.rate_limit_service());
+
+  QuotaCacheSharedPtr quota_cache;
+  if (proto_config.has_quota_prefetch()) {
+    quota_cache = std::make_shared<QuotaCache>(
+        proto_config.quota_prefetch(), proto_config.domain(),
+        [&context, grpc_service = proto_config.rate_limit_service().grpc_service(), timeout]() {
+          return Filters::Common::RateLimit::rateLimitClient(context, grpc_service, timeout);
+        },
+        context.threadLocal(), context.timeSource());
+  }
+
+  FilterConfigSharedPtr filter_config(new FilterConfig(proto_config, context.localInfo(),
+                                                       context.scope(), context.runtime(),
+                                                       context.httpContext(),
+                                                       std::move(quota_cache)));
   return [proto_config, &context, timeout,
           filter_config](Http::FilterChainFactoryCallbacks& callbacks) -> void {
     callbacks.addStreamFilter(std::make_shared<Filter>(
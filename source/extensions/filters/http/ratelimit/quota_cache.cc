@@ -0,0 +1,171 @@
+#include "source/extensions/filters/http/ratelimit/quota_cache.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "source/common/common/assert.h"
+#include "source/common/protobuf/utility.h"
+
+#include "absl/strings/str_cat.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace RateLimitFilter {
+
+QuotaCache::QuotaCache(const envoy::extensions::filters::http::ratelimit::v3::QuotaPrefetch& config,
+                       const std::string& domain, ClientFactory client_factory,
+                       ThreadLocal::SlotAllocator& tls, TimeSource& time_source)
+    : domain_(domain), client_factory_(std::move(client_factory)),
+      fetch_units_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, units, DefaultFetchUnits)),
+      window_(PROTOBUF_GET_MS_REQUIRED(config, window)), time_source_(time_source),
+      tls_slot_(ThreadLocal::TypedSlot<ThreadLocalCache>::makeUnique(tls)) {
+  tls_slot_->set([](Event::Dispatcher&) { return std::make_shared<ThreadLocalCache>(); });
+}
+
+std::string
+QuotaCache::descriptorsKey(const std::vector<Envoy::RateLimit::Descriptor>& descriptors) {
+  std::string key;
+  for (const auto& descriptor : descriptors) {
+    for (const auto& entry : descriptor.entries_) {
+      key.append(entry.key_);
+      key.push_back('\0');
+      key.append(entry.value_);
+      key.push_back('\0');
+    }
+    if (descriptor.limit_.has_value()) {
+      absl::StrAppend(&key, descriptor.limit_->requests_per_unit_, "/",
+                      static_cast<int>(descriptor.limit_->unit_));
+    }
+    key.push_back('\1');
+  }
+  return key;
+}
+
+QuotaCache::Bucket&
+QuotaCache::getBucket(const std::string& key,
+                      const std::vector<Envoy::RateLimit::Descriptor>& descriptors) {
+  ThreadLocalCache& cache = **tls_slot_;
+  auto it = cache.buckets_.find(key);
+  if (it != cache.buckets_.end()) {
+    return *it->second;
+  }
+
+  // Evict the oldest bucket without waiters. Buckets with waiters cannot be evicted because the
+  // waiting filters hold on to them; they are rotated to the back and reconsidered later.
+  for (size_t attempts = cache.insertion_order_.size();
+       cache.buckets_.size() >= MaxBuckets && attempts > 0; --attempts) {
+    std::string candidate = std::move(cache.insertion_order_.front());
+    cache.insertion_order_.pop_front();
+    auto candidate_it = cache.buckets_.find(candidate);
+    ASSERT(candidate_it != cache.buckets_.end());
+    if (candidate_it->second->waiters_.empty()) {
+      cache.buckets_.erase(candidate_it);
+    } else {
+      cache.insertion_order_.push_back(std::move(candidate));
+    }
+  }
+
+  it = cache.buckets_.emplace(key, std::make_unique<Bucket>(*this, descriptors)).first;
+  cache.insertion_order_.push_back(key);
+  return *it->second;
+}
+
+void QuotaCache::admit(const std::string& key,
+                       const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+                       Callbacks& callbacks, Tracing::Span& parent_span,
+                       const StreamInfo::StreamInfo& stream_info) {
+  Bucket& bucket = getBucket(key, descriptors);
+  if (bucket.tokens_ > 0 && time_source_.monotonicTime() >= bucket.window_end_) {
+    // Cached quota is only valid within the configured window; after that it must be requested
+    // from the rate limit service again.
+    bucket.tokens_ = 0;
+  }
+
+  if (bucket.tokens_ > 0) {
+    bucket.tokens_--;
+    callbacks.onQuotaResult(Filters::Common::RateLimit::LimitStatus::OK, true);
+    // Refresh ahead of exhaustion so that a steady stream of requests never has to wait: top up
+    // once a quarter or less of a batch remains.
+    if (bucket.in_flight_units_ == 0 && bucket.tokens_ * 4 <= bucket.fetch_units_) {
+      bucket.startFetch(parent_span, stream_info);
+    }
+    return;
+  }
+
+  bucket.waiters_.push_back({&callbacks, &parent_span, &stream_info});
+  if (bucket.in_flight_units_ == 0) {
+    bucket.startFetch(parent_span, stream_info);
+  }
+}
+
+void QuotaCache::cancel(const std::string& key, Callbacks& callbacks) {
+  ThreadLocalCache& cache = **tls_slot_;
+  auto it = cache.buckets_.find(key);
+  if (it == cache.buckets_.end()) {
+    return;
+  }
+  auto& waiters = it->second->waiters_;
+  waiters.erase(std::remove_if(waiters.begin(), waiters.end(),
+                               [&callbacks](const Bucket::Waiter& waiter) {
+                                 return waiter.callbacks_ == &callbacks;
+                               }),
+                waiters.end());
+  // An in-flight fetch with no remaining waiters is left alone; its result is cached on arrival.
+}
+
+void QuotaCache::Bucket::startFetch(Tracing::Span& parent_span,
+                                    const StreamInfo::StreamInfo& stream_info) {
+  ASSERT(in_flight_units_ == 0);
+  // Ask for at least one unit per coalesced waiter so that a single response can serve them all.
+  in_flight_units_ = std::max(fetch_units_, static_cast<uint32_t>(waiters_.size()));
+  client_->limit(*this, parent_.domain_, descriptors_, parent_span, stream_info,
+                 in_flight_units_);
+}
+
+void QuotaCache::Bucket::complete(Filters::Common::RateLimit::LimitStatus status,
+                                  Filters::Common::RateLimit::DescriptorStatusListPtr&&,
+                                  Http::ResponseHeaderMapPtr&&, Http::RequestHeaderMapPtr&&,
+                                  const std::string&,
+                                  Filters::Common::RateLimit::DynamicMetadataPtr&&) {
+  const uint32_t granted = in_flight_units_;
+  in_flight_units_ = 0;
+
+  switch (status) {
+  case Filters::Common::RateLimit::LimitStatus::OK:
+    tokens_ += granted;
+    window_end_ = parent_.time_source_.monotonicTime() + parent_.window_;
+    fetch_units_ = std::min(fetch_units_ * 2, parent_.fetch_units_);
+    break;
+  case Filters::Common::RateLimit::LimitStatus::OverLimit:
+    // The whole batch was rejected; nothing is cached. Halve the batch so that a hard over-limit
+    // state converges to one service call per request, which is exact.
+    fetch_units_ = std::max(fetch_units_ / 2, 1u);
+    break;
+  case Filters::Common::RateLimit::LimitStatus::Error:
+    break;
+  }
+
+  // Hand out the result one waiter at a time; a waiter's callback may cancel other waiters, so
+  // the list must stay consistent between invocations.
+  while (!waiters_.empty()) {
+    if (status == Filters::Common::RateLimit::LimitStatus::OK && tokens_ == 0) {
+      // More waiters arrived during the fetch than were granted; fetch another batch for them
+      // using the context of the first one still waiting.
+      startFetch(*waiters_.front().parent_span_, *waiters_.front().stream_info_);
+      return;
+    }
+    const Waiter waiter = waiters_.front();
+    waiters_.erase(waiters_.begin());
+    if (status == Filters::Common::RateLimit::LimitStatus::OK) {
+      tokens_--;
+    }
+    waiter.callbacks_->onQuotaResult(status, false);
+  }
+}
+
+} // namespace RateLimitFilter
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "envoy/common/time.h"
+#include "envoy/extensions/filters/http/ratelimit/v3/rate_limit.pb.h"
+#include "envoy/ratelimit/ratelimit.h"
+#include "envoy/thread_local/thread_local.h"
+
+#include "source/common/common/logger.h"
+#include "source/extensions/filters/common/ratelimit/ratelimit.h"
+
+#include "absl/container/flat_hash_map.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace HttpFilters {
+namespace RateLimitFilter {
+
+/**
+ * Per-worker cache of quota granted by the rate limit service. Requests whose descriptor set has
+ * cached quota are admitted locally; requests without cached quota are coalesced onto a single
+ * ShouldRateLimit call that asks for a batch of units via hits_addend. The batch size adapts to
+ * the service's answers so that a hard over-limit state degrades to one call per request. All
+ * state is thread local, so no locks are taken on the request path.
+ */
+class QuotaCache : Logger::Loggable<Logger::Id::filter> {
+public:
+  /**
+   * Callbacks used to hand the result of an admission attempt back to the filter.
+   */
+  class Callbacks {
+  public:
+    virtual ~Callbacks() = default;
+
+    /**
+     * Called exactly once per admit() call, possibly on the same stack frame.
+     * @param status the admission decision for this request.
+     * @param from_cache true if the request was served from cached quota without waiting for a
+     *        rate limit service call.
+     */
+    virtual void onQuotaResult(Filters::Common::RateLimit::LimitStatus status,
+                               bool from_cache) PURE;
+  };
+
+  // Creates the rate limit client used to fetch quota. Invoked once per worker and descriptor
+  // set, on the worker's thread.
+  using ClientFactory = std::function<Filters::Common::RateLimit::ClientPtr()>;
+
+  QuotaCache(const envoy::extensions::filters::http::ratelimit::v3::QuotaPrefetch& config,
+             const std::string& domain, ClientFactory client_factory,
+             ThreadLocal::SlotAllocator& tls, TimeSource& time_source);
+
+  /**
+   * @return the cache key for a descriptor set, suitable for passing to admit() and cancel().
+   */
+  static std::string descriptorsKey(const std::vector<Envoy::RateLimit::Descriptor>& descriptors);
+
+  /**
+   * Attempts to admit a request. The callbacks are invoked exactly once, either on this stack
+   * frame (cached quota or an immediate client failure) or when the in-flight quota fetch for the
+   * descriptor set completes. A caller that is still waiting must call cancel() before it is
+   * destroyed.
+   */
+  void admit(const std::string& key, const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Callbacks& callbacks, Tracing::Span& parent_span,
+             const StreamInfo::StreamInfo& stream_info);
+
+  /**
+   * Cancels a pending admit() call. No-op if the callbacks are not waiting.
+   */
+  void cancel(const std::string& key, Callbacks& callbacks);
+
+  static constexpr uint32_t DefaultFetchUnits = 16;
+  // Upper bound on the number of descriptor sets tracked per worker; the least recently created
+  // bucket is evicted first.
+  static constexpr size_t MaxBuckets = 1024;
+
+private:
+  struct Bucket : public Filters::Common::RateLimit::RequestCallbacks {
+    Bucket(QuotaCache& parent, std::vector<Envoy::RateLimit::Descriptor> descriptors)
+        : parent_(parent), descriptors_(std::move(descriptors)),
+          fetch_units_(parent.fetch_units_), client_(parent.client_factory_()) {}
+    ~Bucket() override {
+      if (in_flight_units_ > 0) {
+        client_->cancel();
+      }
+    }
+
+    // Issues a quota fetch for this bucket's descriptor set. May complete inline on failure.
+    void startFetch(Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info);
+
+    // Filters::Common::RateLimit::RequestCallbacks
+    void complete(Filters::Common::RateLimit::LimitStatus status,
+                  Filters::Common::RateLimit::DescriptorStatusListPtr&& descriptor_statuses,
+                  Http::ResponseHeaderMapPtr&& response_headers_to_add,
+                  Http::RequestHeaderMapPtr&& request_headers_to_add,
+                  const std::string& response_body,
+                  Filters::Common::RateLimit::DynamicMetadataPtr&& dynamic_metadata) override;
+
+    struct Waiter {
+      Callbacks* callbacks_;
+      Tracing::Span* parent_span_;
+      const StreamInfo::StreamInfo* stream_info_;
+    };
+
+    QuotaCache& parent_;
+    const std::vector<Envoy::RateLimit::Descriptor> descriptors_;
+    uint32_t tokens_{0};
+    MonotonicTime window_end_{};
+    // Adaptive batch size, in [1, parent_.fetch_units_].
+    uint32_t fetch_units_;
+    // Units requested by the in-flight fetch; 0 if no fetch is in flight.
+    uint32_t in_flight_units_{0};
+    std::vector<Waiter> waiters_;
+    Filters::Common::RateLimit::ClientPtr client_;
+  };
+  using BucketPtr = std::unique_ptr<Bucket>;
+
+  struct ThreadLocalCache : public ThreadLocal::ThreadLocalObject {
+    absl::flat_hash_map<std::string, BucketPtr> buckets_;
+    std::deque<std::string> insertion_order_;
+  };
+
+  Bucket& getBucket(const std::string& key,
+                    const std::vector<Envoy::RateLimit::Descriptor>& descriptors);
+
+  const std::string domain_;
+  const ClientFactory client_factory_;
+  const uint32_t fetch_units_;
+  const std::chrono::milliseconds window_;
+  TimeSource& time_source_;
+  ThreadLocal::TypedSlotPtr<ThreadLocalCache> tls_slot_;
+};
+
+using QuotaCacheSharedPtr = std::shared_ptr<QuotaCache>;
+
+} // namespace RateLimitFilter
+} // namespace HttpFilters
+} // namespace Extensions
+} // namespace Envoy
@@ -6,6 +6,7 @@
 #include "envoy/http/codes.h"
 
 #include "source/common/common/assert.h"
+#include "source/common/common/empty_string.h"
 #include "source/common/common/enum_to_int.h"
 #include "source/common/common/fmt.h"
 #include "source/common/http/codes.h"
@@ -69,8 +70,14 @@ void Filter::initiateCall(const Http::RequestHeaderMap& headers) {
   if (!descriptors.empty()) {
     state_ = State::Calling;
     initiating_call_ = true;
-    client_->limit(*this, config_->domain(), descriptors, callbacks_->activeSpan(),
-                   callbacks_->streamInfo());
+    if (config_->quotaCache() != nullptr) {
+      quota_cache_key_ = QuotaCache::descriptorsKey(descriptors);
+      config_->quotaCache()->admit(*quota_cache_key_, descriptors, *this,
+                                   callbacks_->activeSpan(), callbacks_->streamInfo());
+    } else {
+      client_->limit(*this, config_->domain(), descriptors, callbacks_->activeSpan(),
+                     callbacks_->streamInfo());
+    }
     initiating_call_ = false;
   }
 }
@@ -132,10 +139,24 @@ void Filter::setEncoderFilterCallbacks(Http::StreamEncoderFilterCallbacks&) {}
 void Filter::onDestroy() {
   if (state_ == State::Calling) {
     state_ = State::Complete;
-    client_->cancel();
+    if (quota_cache_key_.has_value()) {
+      config_->quotaCache()->cancel(*quota_cache_key_, *this);
+    } else {
+      client_->cancel();
+    }
   }
 }
 
+void Filter::onQuotaResult(Filters::Common::RateLimit::LimitStatus status, bool from_cache) {
+  Filters::Common::RateLimit::StatNames& stat_names = config_->statNames();
+  cluster_->statsScope()
+      .counterFromStatName(from_cache ? stat_names.quota_hit_ : stat_names.quota_miss_)
+      .inc();
+  // Quota served through the cache cannot carry per-request data from the rate limit service
+  // (headers to append, dynamic metadata, response body); only the admission decision applies.
+  complete(status, nullptr, nullptr, nullptr, EMPTY_STRING, nullptr);
+}
+
 void Filter::complete(Filters::Common::RateLimit::LimitStatus status,
                       Filters::Common::RateLimit::DescriptorStatusListPtr&& descriptor_statuses,
                       Http::ResponseHeaderMapPtr&& response_headers_to_add,
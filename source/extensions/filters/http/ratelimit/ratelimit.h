@@ -19,6 +19,7 @@
 #include "source/common/router/header_parser.h"
 #include "source/extensions/filters/common/ratelimit/ratelimit.h"
 #include "source/extensions/filters/common/ratelimit/stat_names.h"
+#include "source/extensions/filters/http/ratelimit/quota_cache.h"
 
 namespace Envoy {
 namespace Extensions {
@@ -42,8 +43,10 @@ class FilterConfig {
 public:
   FilterConfig(const envoy::extensions::filters::http::ratelimit::v3::RateLimit& config,
                const LocalInfo::LocalInfo& local_info, Stats::Scope& scope,
-               Runtime::Loader& runtime, Http::Context& http_context)
-      : domain_(config.domain()), stage_(static_cast<uint64_t>(config.stage())),
+               Runtime::Loader& runtime, Http::Context& http_context,
+               QuotaCacheSharedPtr quota_cache = nullptr)
+      : quota_cache_(std::move(quota_cache)), domain_(config.domain()),
+        stage_(static_cast<uint64_t>(config.stage())),
         request_type_(config.request_type().empty() ? stringToType("both")
                                                     : stringToType(config.request_type())),
         local_info_(local_info), scope_(scope), runtime_(runtime),
@@ -76,6 +79,8 @@ public:
   Filters::Common::RateLimit::StatNames& statNames() { return stat_names_; }
   Http::Code rateLimitedStatus() { return rate_limited_status_; }
   const Router::HeaderParser& responseHeadersParser() const { return *response_headers_parser_; }
+  // May be nullptr when quota prefetching is not configured.
+  const QuotaCacheSharedPtr& quotaCache() const { return quota_cache_; }
 
 private:
   static FilterRequestType stringToType(const std::string& request_type) {
@@ -97,6 +102,7 @@ private:
     return Http::Code::TooManyRequests;
   }
 
+  const QuotaCacheSharedPtr quota_cache_;
   const std::string domain_;
   const uint64_t stage_;
   const FilterRequestType request_type_;
@@ -135,7 +141,9 @@ private:
  * HTTP rate limit filter. Depending on the route configuration, this filter calls the global
  * rate limiting service before allowing further filter iteration.
  */
-class Filter : public Http::StreamFilter, public Filters::Common::RateLimit::RequestCallbacks {
+class Filter : public Http::StreamFilter,
+               public Filters::Common::RateLimit::RequestCallbacks,
+               public QuotaCache::Callbacks {
 public:
   Filter(FilterConfigSharedPtr config, Filters::Common::RateLimit::ClientPtr&& client)
       : config_(config), client_(std::move(client)) {}
@@ -167,6 +175,9 @@ public:
                 const std::string& response_body,
                 Filters::Common::RateLimit::DynamicMetadataPtr&& dynamic_metadata) override;
 
+  // QuotaCache::Callbacks
+  void onQuotaResult(Filters::Common::RateLimit::LimitStatus status, bool from_cache) override;
+
 private:
   void initiateCall(const Http::RequestHeaderMap& headers);
   void populateRateLimitDescriptors(const Router::RateLimitPolicy& rate_limit_policy,
@@ -189,6 +200,8 @@ private:
   bool initiating_call_{};
   Http::ResponseHeaderMapPtr response_headers_to_add_;
   Http::RequestHeaderMap* request_headers_{};
+  // Set when this request is waiting on (or was served by) the quota cache.
+  absl::optional<std::string> quota_cache_key_;
 };
 
 } // namespace RateLimitFilter
@@ -246,7 +246,14 @@ UdpProxyFilter::ActiveSession::ActiveSession(ClusterInfo& cluster,
           [this] { onIdleTimer(); })),
       // NOTE: The socket call can only fail due to memory/fd exhaustion. No local ephemeral port
       //       is bound until the first packet is sent to the upstream host.
-      socket_(cluster.filter_.createSocket(host)) {
+      socket_(cluster.filter_.createSocket(host)),
+      udp_packet_writer_(
+          cluster_.filter_.config_->upstreamPacketWriterFactory().createUdpPacketWriter(
+              socket_->ioHandle(), cluster_.filter_.config_->scope())),
+      flush_timer_(udp_packet_writer_->isBatchMode()
+                       ? cluster.filter_.read_callbacks_->udpListener().dispatcher().createTimer(
+                             [this] { onFlushTimer(); })
+                       : nullptr) {
   if (!cluster_.filter_.config_->sessionAccessLogs().empty()) {
     udp_session_stats_.emplace(
         StreamInfo::StreamInfoImpl(cluster_.filter_.config_->timeSource(), nullptr));
@@ -401,13 +408,25 @@ void UdpProxyFilter::ActiveSession::write(const Buffer::Instance& buffer) {
 
     skip_connect_ = true;
   }
-  Api::IoCallUint64Result rc =
-      Network::Utility::writeToSocket(socket_->ioHandle(), buffer, local_ip, *host_->address());
+  Api::IoCallUint64Result rc = udp_packet_writer_->writePacket(buffer, local_ip, *host_->address());
   if (!rc.ok()) {
     cluster_.cluster_stats_.sess_tx_errors_.inc();
   } else {
     cluster_.cluster_stats_.sess_tx_datagrams_.inc();
     cluster_.cluster_.info()->trafficStats()->upstream_cx_tx_bytes_total_.add(buffer_length);
+    if (flush_timer_ != nullptr && !flush_timer_->enabled()) {
+      // A batching writer may still be holding this datagram. A zero timeout runs the flush
+      // after the rest of the current downstream read burst has been forwarded, bounding the
+      // batching window to one event loop iteration.
+      flush_timer_->enableTimer(std::chrono::milliseconds(0));
+    }
+  }
+}
+
+void UdpProxyFilter::ActiveSession::onFlushTimer() {
+  const Api::IoCallUint64Result rc = udp_packet_writer_->flush();
+  if (!rc.ok()) {
+    cluster_.cluster_stats_.sess_tx_errors_.inc();
   }
 }
 
@@ -6,6 +6,7 @@
 #include "envoy/event/timer.h"
 #include "envoy/extensions/filters/udp/udp_proxy/v3/udp_proxy.pb.h"
 #include "envoy/network/filter.h"
+#include "envoy/network/udp_packet_writer_handler.h"
 #include "envoy/stream_info/stream_info.h"
 #include "envoy/upstream/cluster_manager.h"
 
@@ -13,8 +14,10 @@
 #include "source/common/api/os_sys_calls_impl.h"
 #include "source/common/common/empty_string.h"
 #include "source/common/common/random_generator.h"
+#include "source/common/config/utility.h"
 #include "source/common/network/socket_impl.h"
 #include "source/common/network/socket_interface.h"
+#include "source/common/network/udp_packet_writer_handler_impl.h"
 #include "source/common/network/utility.h"
 #include "source/common/protobuf/utility.h"
 #include "source/common/stream_info/stream_info_impl.h"
@@ -81,7 +84,16 @@ public:
         stats_(generateStats(config.stat_prefix(), context.scope())),
         // Default prefer_gro to true for upstream client traffic.
         upstream_socket_config_(config.upstream_socket_config(), true),
-        random_(context.api().randomGenerator()) {
+        random_(context.api().randomGenerator()), scope_(context.scope()) {
+    if (config.has_upstream_udp_packet_writer_config()) {
+      auto& factory_factory = Config::Utility::getAndCheckFactory<
+          Network::UdpPacketWriterFactoryFactory>(config.upstream_udp_packet_writer_config());
+      upstream_packet_writer_factory_ =
+          factory_factory.createUdpPacketWriterFactory(config.upstream_udp_packet_writer_config());
+    } else {
+      upstream_packet_writer_factory_ = std::make_unique<Network::UdpDefaultWriterFactory>();
+    }
+
     if (use_original_src_ip_ && !Api::OsSysCallsSingleton::get().supportsIpTransparent()) {
       ExceptionUtil::throwEnvoyException(
           "The platform does not support either IP_TRANSPARENT or IPV6_TRANSPARENT. Or the envoy "
@@ -120,6 +132,10 @@ public:
   const Network::ResolvedUdpSocketConfig& upstreamSocketConfig() const {
     return upstream_socket_config_;
   }
+  const Network::UdpPacketWriterFactory& upstreamPacketWriterFactory() const {
+    return *upstream_packet_writer_factory_;
+  }
+  Stats::Scope& scope() const { return scope_; }
   const std::vector<AccessLog::InstanceSharedPtr>& sessionAccessLogs() const {
     return session_access_logs_;
   }
@@ -147,6 +163,8 @@ private:
   std::vector<AccessLog::InstanceSharedPtr> session_access_logs_;
   std::vector<AccessLog::InstanceSharedPtr> proxy_access_logs_;
   Random::RandomGenerator& random_;
+  Stats::Scope& scope_;
+  Network::UdpPacketWriterFactoryPtr upstream_packet_writer_factory_;
 };
 
 using UdpProxyFilterConfigSharedPtr = std::shared_ptr<const UdpProxyFilterConfig>;
@@ -203,6 +221,7 @@ private:
 
   private:
     void onIdleTimer();
+    void onFlushTimer();
     void onReadReady();
     void fillSessionStreamInfo();
 
@@ -247,6 +266,13 @@ private:
     // packets from the upstream host. Note that a a local ephemeral port is bound on the first
     // write to the upstream host.
     const Network::SocketPtr socket_;
+    // Writer for the upstream send path. The default writer issues one sendmsg() per datagram;
+    // a batching writer (e.g. UDP GSO) buffers consecutive datagrams and is flushed by
+    // flush_timer_ at the end of the event loop iteration that filled it.
+    const Network::UdpPacketWriterPtr udp_packet_writer_;
+    // Only created when udp_packet_writer_ batches; enabled with a zero timeout on the first
+    // buffered write so the flush runs once the current read burst has been forwarded.
+    const Event::TimerPtr flush_timer_;
     // The socket should be connected to avoid port exhaustion unless runtime guard
     // envoy.reloadable_features.udp_proxy_connect is unset or use_original_src_ip_ is set. If it
     // is true, there will be no calling `connect()` on the socket.
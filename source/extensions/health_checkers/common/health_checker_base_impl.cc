@@ -6,7 +6,9 @@
 #include "envoy/stats/scope.h"
 
 #include "source/common/network/utility.h"
+#include "source/common/protobuf/utility.h"
 #include "source/common/router/router.h"
+#include "source/common/runtime/runtime_features.h"
 
 namespace Envoy {
 namespace Upstream {
@@ -24,7 +26,8 @@ HealthCheckerImplBase::HealthCheckerImplBase(const Cluster& cluster,
       healthy_threshold_(PROTOBUF_GET_WRAPPED_REQUIRED(config, healthy_threshold)),
       stats_(generateStats(cluster.info()->statsScope())), runtime_(runtime), random_(random),
       reuse_connection_(PROTOBUF_GET_WRAPPED_OR_DEFAULT(config, reuse_connection, true)),
-      event_logger_(std::move(event_logger)), interval_(PROTOBUF_GET_MS_REQUIRED(config, interval)),
+      event_logger_(std::move(event_logger)), config_hash_(MessageUtil::hash(config)),
+      interval_(PROTOBUF_GET_MS_REQUIRED(config, interval)),
       no_traffic_interval_(PROTOBUF_GET_MS_OR_DEFAULT(config, no_traffic_interval, 60000)),
       no_traffic_healthy_interval_(PROTOBUF_GET_MS_OR_DEFAULT(config, no_traffic_healthy_interval,
                                                               no_traffic_interval_.count())),
@@ -276,10 +279,49 @@ void HealthCheckerImplBase::ActiveHealthCheckSession::onDeferredDeleteBase() {
   }
 }
 
+HealthCheckerImplBase::SharedProbeResultCache& HealthCheckerImplBase::sharedProbeResultCache() {
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(SharedProbeResultCache);
+}
+
+const HealthCheckerImplBase::CachedProbeResult*
+HealthCheckerImplBase::findFreshSharedProbeResult(const Host& host) const {
+  const SharedProbeResultCache& cache = sharedProbeResultCache();
+  const auto it = cache.find(std::make_pair(host.address()->asString(), config_hash_));
+  if (it == cache.end() ||
+      dispatcher_.timeSource().monotonicTime() - it->second.time_ > interval_) {
+    // No result, or the result is older than one check interval; probe as usual.
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void HealthCheckerImplBase::publishSharedProbeResult(
+    const Host& host, bool failed, bool degraded,
+    envoy::data::core::v3::HealthCheckFailureType type) {
+  SharedProbeResultCache& cache = sharedProbeResultCache();
+  const MonotonicTime now = dispatcher_.timeSource().monotonicTime();
+  // Bound the cache under endpoint churn: once it grows past a threshold, drop entries which are
+  // too old for any session to consume.
+  constexpr size_t SweepThreshold = 16384;
+  constexpr std::chrono::minutes StaleHorizon{5};
+  if (cache.size() >= SweepThreshold) {
+    absl::erase_if(cache, [now](const auto& kv) { return now - kv.second.time_ > StaleHorizon; });
+  }
+  cache.insert_or_assign(std::make_pair(host.address()->asString(), config_hash_),
+                         CachedProbeResult{failed, degraded, type, now});
+}
+
 void HealthCheckerImplBase::ActiveHealthCheckSession::handleSuccess(bool degraded) {
   // If we are healthy, reset the # of unhealthy to zero.
   num_unhealthy_ = 0;
 
+  const bool shared_result = consuming_shared_result_;
+  consuming_shared_result_ = false;
+  if (!shared_result && Runtime::runtimeFeatureEnabled(
+                            "envoy.reloadable_features.health_check_share_probe_results")) {
+    parent_.publishSharedProbeResult(*host_, false, degraded, envoy::data::core::v3::ACTIVE);
+  }
+
   HealthTransition changed_state = HealthTransition::Unchanged;
 
   if (host_->healthFlagGet(Host::HealthFlag::FAILED_ACTIVE_HC)) {
@@ -350,6 +392,15 @@ HealthTransition HealthCheckerImplBase::ActiveHealthCheckSession::setUnhealthy(
   // If we are unhealthy, reset the # of healthy to zero.
   num_healthy_ = 0;
 
+  const bool shared_result = consuming_shared_result_;
+  consuming_shared_result_ = false;
+  // Passive failures are observations of this cluster's own traffic and are not shared.
+  if (!shared_result && type != envoy::data::core::v3::PASSIVE &&
+      Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.health_check_share_probe_results")) {
+    parent_.publishSharedProbeResult(*host_, true, false, type);
+  }
+
   HealthTransition changed_state = HealthTransition::Unchanged;
   if (!host_->healthFlagGet(Host::HealthFlag::FAILED_ACTIVE_HC)) {
     if ((!networkHealthCheckFailureType(type) && !retriable) ||
@@ -419,6 +470,25 @@ HealthCheckerImplBase::ActiveHealthCheckSession::clearPendingFlag(HealthTransiti
 }
 
 void HealthCheckerImplBase::ActiveHealthCheckSession::onIntervalBase() {
+  if (Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.health_check_share_probe_results")) {
+    const CachedProbeResult* shared = parent_.findFreshSharedProbeResult(*host_);
+    if (shared != nullptr) {
+      // Another cluster recently probed this endpoint with an identical health check
+      // configuration; consume its outcome instead of sending a redundant probe. Healthy and
+      // unhealthy thresholds are still applied by this session, so per-cluster interpretation
+      // of the shared result is unchanged. Note: the handlers below may defer delete this
+      // session via callbacks, so nothing may run after them.
+      parent_.stats_.attempt_.inc();
+      consuming_shared_result_ = true;
+      if (shared->failed_) {
+        handleFailure(shared->failure_type_);
+      } else {
+        handleSuccess(shared->degraded_);
+      }
+      return;
+    }
+  }
   onInterval();
   timeout_timer_->enableTimer(parent_.timeout_);
   parent_.stats_.attempt_.inc();
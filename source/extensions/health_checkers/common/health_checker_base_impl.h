@@ -15,6 +15,8 @@
 #include "source/common/common/matchers.h"
 #include "source/common/network/transport_socket_options_impl.h"
 
+#include "absl/container/flat_hash_map.h"
+
 namespace Envoy {
 namespace Upstream {
 
@@ -91,6 +93,10 @@ protected:
     uint32_t num_unhealthy_{};
     uint32_t num_healthy_{};
     bool first_check_{true};
+    // Set when the session is about to consume a probe result published by another cluster's
+    // session; read and cleared by handleSuccess()/setUnhealthy() to suppress re-publication of
+    // a result that did not come from a probe this session sent.
+    bool consuming_shared_result_{false};
     TimeSource& time_source_;
   };
 
@@ -129,6 +135,26 @@ private:
     std::weak_ptr<Host> host_;
   };
 
+  // A recent probe outcome published for one endpoint + health check configuration, shared
+  // across all clusters which health check that endpoint with an identical configuration.
+  struct CachedProbeResult {
+    bool failed_{};
+    bool degraded_{};
+    envoy::data::core::v3::HealthCheckFailureType failure_type_{};
+    MonotonicTime time_;
+  };
+  // Keyed by endpoint address and a hash of the HealthCheck proto configuration. All active
+  // health checking runs on the main thread, so no synchronization is required.
+  using SharedProbeResultCache =
+      absl::flat_hash_map<std::pair<std::string, uint64_t>, CachedProbeResult>;
+  static SharedProbeResultCache& sharedProbeResultCache();
+
+  // Returns a probe result for the given host published by another cluster's session within the
+  // last check interval, or nullptr if none exists (in which case the caller probes as usual).
+  const CachedProbeResult* findFreshSharedProbeResult(const Host& host) const;
+  void publishSharedProbeResult(const Host& host, bool failed, bool degraded,
+                                envoy::data::core::v3::HealthCheckFailureType type);
+
   void addHosts(const HostVector& hosts);
   void decHealthy();
   void decDegraded();
@@ -149,6 +175,7 @@ private:
 
   static const std::chrono::milliseconds NO_TRAFFIC_INTERVAL;
 
+  const uint64_t config_hash_;
   std::list<HostStatusCb> callbacks_;
   const std::chrono::milliseconds interval_;
   const std::chrono::milliseconds no_traffic_interval_;
@@ -18,6 +18,10 @@ namespace {
 bool isCacheFile(const Filesystem::DirectoryEntry& entry) {
   return entry.type_ == Filesystem::FileType::Regular && absl::StartsWith(entry.name_, "cache-");
 }
+
+bool isCacheSubdirectory(const Filesystem::DirectoryEntry& entry) {
+  return entry.type_ == Filesystem::FileType::Directory && absl::StartsWith(entry.name_, "cache-");
+}
 } // namespace
 
 CacheEvictionThread::CacheEvictionThread(Thread::ThreadFactory& thread_factory)
@@ -68,6 +72,44 @@ bool CacheEvictionThread::waitForSignal() {
   return !terminating_;
 }
 
+void CacheShared::forEachCacheFile(
+    std::function<void(std::string&&, const Filesystem::DirectoryEntry&)> cb) {
+  auto os_sys_calls = Api::OsSysCallsSingleton::get();
+  for (const Filesystem::DirectoryEntry& entry : Filesystem::Directory(std::string{cachePath()})) {
+    if (isCacheFile(entry)) {
+      const absl::optional<std::string> expected_subdirectory =
+          subdirectoryForFilename(entry.name_);
+      if (!expected_subdirectory.has_value() || expected_subdirectory.value().empty()) {
+        // The file belongs directly in the cache path (or has no parseable hash, in which
+        // case it is left where it is).
+        cb(std::string(entry.name_), entry);
+      } else {
+        // A flat-layout leftover from before cache_subdivisions was configured.
+        os_sys_calls.unlink(absl::StrCat(cachePath(), entry.name_).c_str());
+      }
+    } else if (isCacheSubdirectory(entry)) {
+      const std::string subdirectory = absl::StrCat(entry.name_, "/");
+      for (const Filesystem::DirectoryEntry& sub_entry :
+           Filesystem::Directory(absl::StrCat(cachePath(), entry.name_))) {
+        if (!isCacheFile(sub_entry)) {
+          continue;
+        }
+        std::string relative_name = absl::StrCat(subdirectory, sub_entry.name_);
+        const absl::optional<std::string> expected_subdirectory =
+            subdirectoryForFilename(sub_entry.name_);
+        if (!expected_subdirectory.has_value() || expected_subdirectory.value() == subdirectory) {
+          cb(std::move(relative_name), sub_entry);
+        } else {
+          // The entry's hash maps to a different subdirectory, as happens when
+          // cache_subdivisions is reconfigured; per the cache design such entries are
+          // simply removed.
+          os_sys_calls.unlink(absl::StrCat(cachePath(), relative_name).c_str());
+        }
+      }
+    }
+  }
+}
+
 void CacheShared::initStats() {
   if (config_.has_max_cache_size_bytes()) {
     stats_.size_limit_bytes_.set(config_.max_cache_size_bytes().value());
@@ -75,14 +117,10 @@ void CacheShared::initStats() {
   if (config_.has_max_cache_entry_count()) {
     stats_.size_limit_count_.set(config_.max_cache_entry_count().value());
   }
-  // TODO(ravenblack): Add support for directory tree structure.
-  for (const Filesystem::DirectoryEntry& entry : Filesystem::Directory(std::string{cachePath()})) {
-    if (!isCacheFile(entry)) {
-      continue;
-    }
+  forEachCacheFile([this](std::string&&, const Filesystem::DirectoryEntry& entry) {
     size_count_++;
     size_bytes_ += entry.size_bytes_.value_or(0);
-  }
+  });
   stats_.size_count_.set(size_count_);
   stats_.size_bytes_.set(size_bytes_);
   needs_init_ = false;
@@ -100,15 +138,12 @@ void CacheShared::evict() {
   };
   std::vector<CacheFile> cache_files;
 
-  // TODO(ravenblack): Add support for directory tree structure.
-  for (const Filesystem::DirectoryEntry& entry : Filesystem::Directory(std::string{cachePath()})) {
-    if (!isCacheFile(entry)) {
-      continue;
-    }
+  forEachCacheFile([&, this](std::string&& relative_name, const Filesystem::DirectoryEntry& entry) {
     count++;
     size += entry.size_bytes_.value_or(0);
     struct stat s;
-    if (os_sys_calls.stat(absl::StrCat(cachePath(), entry.name_).c_str(), &s).return_value_ != -1) {
+    if (os_sys_calls.stat(absl::StrCat(cachePath(), relative_name).c_str(), &s).return_value_ !=
+        -1) {
 #ifdef _DARWIN_FEATURE_64_BIT_INODE
       Envoy::SystemTime last_touch =
           std::max(timespecToChrono(s.st_atimespec), timespecToChrono(s.st_ctimespec));
@@ -117,9 +152,10 @@ void CacheShared::evict() {
           std::max(timespecToChrono(s.st_atim), timespecToChrono(s.st_ctim));
 #endif
 
-      cache_files.push_back(CacheFile{entry.name_, entry.size_bytes_.value_or(0), last_touch});
+      cache_files.push_back(
+          CacheFile{std::move(relative_name), entry.size_bytes_.value_or(0), last_touch});
     }
-  }
+  });
   // Sort the vector by last-touch timestamp, highest (i.e. youngest) first.
   std::sort(cache_files.begin(), cache_files.end(), [](CacheFile& a, CacheFile& b) {
     return std::tie(a.last_touch_, a.name_) > std::tie(b.last_touch_, b.name_);
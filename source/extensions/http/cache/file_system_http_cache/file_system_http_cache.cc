@@ -2,6 +2,7 @@
 
 #include <chrono>
 
+#include "source/common/api/os_sys_calls_impl.h"
 #include "source/common/filesystem/directory.h"
 #include "source/common/http/header_map_impl.h"
 #include "source/extensions/http/cache/file_system_http_cache/cache_eviction_thread.h"
@@ -11,6 +12,10 @@
 #include "source/extensions/http/cache/file_system_http_cache/lookup_context.h"
 #include "source/extensions/http/cache/file_system_http_cache/stats.h"
 
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_format.h"
+#include "absl/strings/strip.h"
+
 namespace Envoy {
 namespace Extensions {
 namespace HttpFilters {
@@ -83,6 +88,15 @@ FileSystemHttpCache::FileSystemHttpCache(
     : owner_(owner), async_file_manager_(async_file_manager),
       shared_(std::make_shared<CacheShared>(config, stats_scope)),
       cache_eviction_thread_(cache_eviction_thread) {
+  if (shared_->subdivisions() > 1) {
+    // Ensure the subdirectories exist before any cache file is linked into them. Failure
+    // here is intentionally not an error - directories typically already exist from a
+    // previous run, and any other problem will surface when cache writes fail.
+    auto& os_sys_calls = Api::OsSysCallsSingleton::get();
+    for (uint32_t i = 0; i < shared_->subdivisions(); i++) {
+      os_sys_calls.mkdir(absl::StrCat(cachePath(), shared_->subdirectoryForHash(i)).c_str(), 0755);
+    }
+  }
   cache_eviction_thread_.addCache(shared_);
 }
 
@@ -334,8 +348,25 @@ FileSystemHttpCache::setCacheEntryToVary(const Key& key,
 }
 
 std::string FileSystemHttpCache::generateFilename(const Key& key) const {
-  // TODO(ravenblack): Add support for directory tree structure.
-  return absl::StrCat("cache-", stableHashKey(key));
+  const uint64_t hash = stableHashKey(key);
+  return absl::StrCat(shared_->subdirectoryForHash(hash), "cache-", hash);
+}
+
+uint32_t CacheShared::subdivisions() const { return std::max(1u, config_.cache_subdivisions()); }
+
+std::string CacheShared::subdirectoryForHash(uint64_t hash) const {
+  if (subdivisions() <= 1) {
+    return "";
+  }
+  return absl::StrFormat("cache-%04x/", hash % subdivisions());
+}
+
+absl::optional<std::string> CacheShared::subdirectoryForFilename(absl::string_view filename) const {
+  uint64_t hash;
+  if (!absl::ConsumePrefix(&filename, "cache-") || !absl::SimpleAtoi(filename, &hash)) {
+    return absl::nullopt;
+  }
+  return subdirectoryForHash(hash);
 }
 
 InsertContextPtr FileSystemHttpCache::makeInsertContext(LookupContextPtr&& lookup_context,
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include "envoy/extensions/http/cache/file_system_http_cache/v3/file_system_http_cache.pb.h"
+#include "envoy/filesystem/filesystem.h"
 
 #include "source/common/common/logger.h"
 #include "source/extensions/common/async_files/async_file_manager.h"
@@ -257,6 +258,39 @@ struct CacheShared {
    */
   absl::string_view cachePath() const { return config_.cache_path(); }
 
+  /**
+   * @return the number of subdirectories the cache is divided into. 1 means a flat layout
+   *     with cache entry files directly in the cache path.
+   */
+  uint32_t subdivisions() const;
+
+  /**
+   * Returns the relative subdirectory, including a trailing path-separator, in which the
+   * cache entry file for the given key hash belongs; empty string for a flat layout.
+   * @param hash the stable hash key of the cache entry.
+   * @return the subdirectory for that entry.
+   */
+  std::string subdirectoryForHash(uint64_t hash) const;
+
+  /**
+   * Returns the relative subdirectory in which a cache file with the given name belongs,
+   * per the hash embedded in the name, or nullopt if no hash can be parsed from the name,
+   * in which case the file is left where it is.
+   * @param filename the name of the cache file, without any path.
+   * @return the subdirectory the file belongs in, or nullopt.
+   */
+  absl::optional<std::string> subdirectoryForFilename(absl::string_view filename) const;
+
+  /**
+   * Calls cb for each correctly placed cache entry file, with the file's path relative to
+   * the cache path and its directory entry. Cache entry files found in the wrong place,
+   * e.g. left over after ``cache_subdivisions`` was reconfigured, are removed rather than
+   * visited. Runs in the CacheEvictionThread.
+   * @param cb the callback to call for each cache entry file.
+   */
+  void forEachCacheFile(
+      std::function<void(std::string&&, const Filesystem::DirectoryEntry&)> cb);
+
   /**
    * Updates stats (size and count) to reflect that a file has been added to the cache.
    * @param file_size The size in bytes of the file that was added.
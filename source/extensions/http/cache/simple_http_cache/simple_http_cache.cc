@@ -31,6 +31,24 @@ absl::optional<Key> variedRequestKey(const LookupRequest& request,
   return varied_request_key;
 }
 
+// Serves a range of a shared cached body without copying it. The fragment keeps the body
+// alive until the buffer it was added to releases it.
+class SharedBodyFragment : public Buffer::BufferFragment {
+public:
+  SharedBodyFragment(std::shared_ptr<const std::string> body, const AdjustedByteRange& range)
+      : body_(std::move(body)), view_(absl::string_view(*body_).substr(
+                                    range.begin(), static_cast<size_t>(range.length()))) {}
+
+  // Buffer::BufferFragment
+  const void* data() const override { return view_.data(); }
+  size_t size() const override { return view_.size(); }
+  void done() override { delete this; }
+
+private:
+  const std::shared_ptr<const std::string> body_;
+  const absl::string_view view_;
+};
+
 class SimpleLookupContext : public LookupContext {
 public:
   SimpleLookupContext(SimpleHttpCache& cache, LookupRequest&& request)
@@ -40,15 +58,19 @@ public:
     auto entry = cache_.lookup(request_);
     body_ = std::move(entry.body_);
     trailers_ = std::move(entry.trailers_);
-    cb(entry.response_headers_ ? request_.makeLookupResult(std::move(entry.response_headers_),
-                                                           std::move(entry.metadata_), body_.size(),
-                                                           trailers_ != nullptr)
-                               : LookupResult{});
+    cb(entry.response_headers_
+           ? request_.makeLookupResult(std::move(entry.response_headers_),
+                                       std::move(entry.metadata_), body_ ? body_->size() : 0,
+                                       trailers_ != nullptr)
+           : LookupResult{});
   }
 
   void getBody(const AdjustedByteRange& range, LookupBodyCallback&& cb) override {
-    ASSERT(range.end() <= body_.length(), "Attempt to read past end of body.");
-    cb(std::make_unique<Buffer::OwnedImpl>(&body_[range.begin()], range.length()));
+    ASSERT(body_ != nullptr);
+    ASSERT(range.end() <= body_->length(), "Attempt to read past end of body.");
+    auto buffer = std::make_unique<Buffer::OwnedImpl>();
+    buffer->addBufferFragment(*new SharedBodyFragment(body_, range));
+    cb(std::move(buffer));
   }
 
   // The cache must call cb with the cached trailers.
@@ -63,7 +85,7 @@ public:
 private:
   SimpleHttpCache& cache_;
   const LookupRequest request_;
-  std::string body_;
+  std::shared_ptr<const std::string> body_;
   Http::ResponseTrailerMapPtr trailers_;
 };
 
@@ -137,6 +159,10 @@ private:
 };
 } // namespace
 
+SimpleHttpCache::Shard& SimpleHttpCache::shardForKey(const Key& key) {
+  return shards_[stableHashKey(key) % ShardCount];
+}
+
 LookupContextPtr SimpleHttpCache::makeLookupContext(LookupRequest&& request,
                                                     Http::StreamDecoderFilterCallbacks&) {
   return std::make_unique<SimpleLookupContext>(*this, std::move(request));
@@ -147,26 +173,37 @@ void SimpleHttpCache::updateHeaders(const LookupContext& lookup_context,
                                     const ResponseMetadata& metadata,
                                     std::function<void(bool)> on_complete) {
   const auto& simple_lookup_context = static_cast<const SimpleLookupContext&>(lookup_context);
-  const Key& key = simple_lookup_context.request().key();
-  absl::WriterMutexLock lock(&mutex_);
-  auto iter = map_.find(key);
-  if (iter == map_.end() || !iter->second.response_headers_) {
-    on_complete(false);
-    return;
-  }
-  if (VaryHeaderUtils::hasVary(*iter->second.response_headers_)) {
-    absl::optional<Key> varied_key =
-        variedRequestKey(simple_lookup_context.request(), *iter->second.response_headers_);
-    if (!varied_key.has_value()) {
+  Key key = simple_lookup_context.request().key();
+
+  // If the response was varied, the entry to update lives under the varied key, which may be
+  // in a different shard. Resolve it before taking the target shard's lock; shard locks are
+  // never held across shards.
+  {
+    Shard& shard = shardForKey(key);
+    absl::ReaderMutexLock lock(&shard.mutex_);
+    auto iter = shard.map_.find(key);
+    if (iter == shard.map_.end() || !iter->second.response_headers_) {
       on_complete(false);
       return;
     }
-    iter = map_.find(varied_key.value());
-    if (iter == map_.end() || !iter->second.response_headers_) {
-      on_complete(false);
-      return;
+    if (VaryHeaderUtils::hasVary(*iter->second.response_headers_)) {
+      absl::optional<Key> varied_key =
+          variedRequestKey(simple_lookup_context.request(), *iter->second.response_headers_);
+      if (!varied_key.has_value()) {
+        on_complete(false);
+        return;
+      }
+      key = std::move(varied_key.value());
     }
   }
+
+  Shard& shard = shardForKey(key);
+  absl::WriterMutexLock lock(&shard.mutex_);
+  auto iter = shard.map_.find(key);
+  if (iter == shard.map_.end() || !iter->second.response_headers_) {
+    on_complete(false);
+    return;
+  }
   Entry& entry = iter->second;
 
   applyHeaderUpdate(response_headers, *entry.response_headers_);
@@ -175,49 +212,41 @@ void SimpleHttpCache::updateHeaders(const LookupContext& lookup_context,
 }
 
 SimpleHttpCache::Entry SimpleHttpCache::lookup(const LookupRequest& request) {
-  absl::ReaderMutexLock lock(&mutex_);
-  auto iter = map_.find(request.key());
-  if (iter == map_.end()) {
-    return Entry{};
-  }
-  ASSERT(iter->second.response_headers_);
+  absl::optional<Key> varied_key;
+  {
+    Shard& shard = shardForKey(request.key());
+    absl::ReaderMutexLock lock(&shard.mutex_);
+    auto iter = shard.map_.find(request.key());
+    if (iter == shard.map_.end()) {
+      return Entry{};
+    }
+    ASSERT(iter->second.response_headers_);
+
+    if (!VaryHeaderUtils::hasVary(*iter->second.response_headers_)) {
+      Http::ResponseTrailerMapPtr trailers_map;
+      if (iter->second.trailers_) {
+        trailers_map = Http::createHeaderMap<Http::ResponseTrailerMapImpl>(*iter->second.trailers_);
+      }
+      return SimpleHttpCache::Entry{
+          Http::createHeaderMap<Http::ResponseHeaderMapImpl>(*iter->second.response_headers_),
+          iter->second.metadata_, iter->second.body_, std::move(trailers_map)};
+    }
 
-  if (VaryHeaderUtils::hasVary(*iter->second.response_headers_)) {
-    return varyLookup(request, iter->second.response_headers_);
-  } else {
-    Http::ResponseTrailerMapPtr trailers_map;
-    if (iter->second.trailers_) {
-      trailers_map = Http::createHeaderMap<Http::ResponseTrailerMapImpl>(*iter->second.trailers_);
+    // Varied response: resolve the varied key while the base entry's vary header is available,
+    // then look it up in its own shard after releasing this shard's lock.
+    varied_key = variedRequestKey(request, *iter->second.response_headers_);
+    if (!varied_key.has_value()) {
+      return SimpleHttpCache::Entry{};
     }
-    return SimpleHttpCache::Entry{
-        Http::createHeaderMap<Http::ResponseHeaderMapImpl>(*iter->second.response_headers_),
-        iter->second.metadata_, iter->second.body_, std::move(trailers_map)};
   }
+  return lookupEntry(varied_key.value());
 }
 
-bool SimpleHttpCache::insert(const Key& key, Http::ResponseHeaderMapPtr&& response_headers,
-                             ResponseMetadata&& metadata, std::string&& body,
-                             Http::ResponseTrailerMapPtr&& trailers) {
-  absl::WriterMutexLock lock(&mutex_);
-  map_[key] = SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
-                                     std::move(body), std::move(trailers)};
-  return true;
-}
-
-SimpleHttpCache::Entry
-SimpleHttpCache::varyLookup(const LookupRequest& request,
-                            const Http::ResponseHeaderMapPtr& response_headers) {
-  // This method should be called from lookup, which holds the mutex for reading.
-  mutex_.AssertReaderHeld();
-
-  absl::optional<Key> varied_key = variedRequestKey(request, *response_headers);
-  if (!varied_key.has_value()) {
-    return SimpleHttpCache::Entry{};
-  }
-  Key& varied_request_key = varied_key.value();
-
-  auto iter = map_.find(varied_request_key);
-  if (iter == map_.end()) {
+SimpleHttpCache::Entry SimpleHttpCache::lookupEntry(const Key& key) {
+  Shard& shard = shardForKey(key);
+  absl::ReaderMutexLock lock(&shard.mutex_);
+  auto iter = shard.map_.find(key);
+  if (iter == shard.map_.end()) {
     return SimpleHttpCache::Entry{};
   }
   ASSERT(iter->second.response_headers_);
@@ -231,19 +260,28 @@ SimpleHttpCache::varyLookup(const LookupRequest& request,
       iter->second.metadata_, iter->second.body_, std::move(trailers_map)};
 }
 
+bool SimpleHttpCache::insert(const Key& key, Http::ResponseHeaderMapPtr&& response_headers,
+                             ResponseMetadata&& metadata, std::string&& body,
+                             Http::ResponseTrailerMapPtr&& trailers) {
+  Shard& shard = shardForKey(key);
+  absl::WriterMutexLock lock(&shard.mutex_);
+  shard.map_[key] =
+      SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
+                             std::make_shared<const std::string>(std::move(body)),
+                             std::move(trailers)};
+  return true;
+}
+
 bool SimpleHttpCache::varyInsert(const Key& request_key,
                                  Http::ResponseHeaderMapPtr&& response_headers,
                                  ResponseMetadata&& metadata, std::string&& body,
                                  const Http::RequestHeaderMap& request_headers,
                                  const VaryAllowList& vary_allow_list,
                                  Http::ResponseTrailerMapPtr&& trailers) {
-  absl::WriterMutexLock lock(&mutex_);
-
   absl::btree_set<absl::string_view> vary_header_values =
       VaryHeaderUtils::getVaryValues(*response_headers);
   ASSERT(!vary_header_values.empty());
 
-  // Insert the varied response.
   Key varied_request_key = request_key;
   const absl::optional<std::string> vary_identifier =
       VaryHeaderUtils::createVaryIdentifier(vary_allow_list, vary_header_values, request_headers);
@@ -251,25 +289,36 @@ bool SimpleHttpCache::varyInsert(const Key& request_key,
     // Skip the insert if we are unable to create a vary key.
     return false;
   }
-
   varied_request_key.add_custom_fields(vary_identifier.value());
-  map_[varied_request_key] = SimpleHttpCache::Entry{
-      std::move(response_headers), std::move(metadata), std::move(body), std::move(trailers)};
+
+  // Build the vary-only marker entry before taking any locks; the vary values point into
+  // response_headers, which is moved during the varied insert below.
+  Envoy::Http::ResponseHeaderMapPtr vary_only_map =
+      Envoy::Http::createHeaderMap<Envoy::Http::ResponseHeaderMapImpl>({});
+  vary_only_map->setCopy(Envoy::Http::CustomHeaders::get().Vary,
+                         absl::StrJoin(vary_header_values, ","));
+
+  // Insert the varied response.
+  {
+    Shard& shard = shardForKey(varied_request_key);
+    absl::WriterMutexLock lock(&shard.mutex_);
+    shard.map_[varied_request_key] =
+        SimpleHttpCache::Entry{std::move(response_headers), std::move(metadata),
+                               std::make_shared<const std::string>(std::move(body)),
+                               std::move(trailers)};
+  }
 
   // Add a special entry to flag that this request generates varied responses.
-  auto iter = map_.find(request_key);
-  if (iter == map_.end()) {
-    Envoy::Http::ResponseHeaderMapPtr vary_only_map =
-        Envoy::Http::createHeaderMap<Envoy::Http::ResponseHeaderMapImpl>({});
-    vary_only_map->setCopy(Envoy::Http::CustomHeaders::get().Vary,
-                           absl::StrJoin(vary_header_values, ","));
+  Shard& shard = shardForKey(request_key);
+  absl::WriterMutexLock lock(&shard.mutex_);
+  auto iter = shard.map_.find(request_key);
+  if (iter == shard.map_.end()) {
     // TODO(cbdm): In a cache that evicts entries, we could maintain a list of the "varykey"s that
     // we have inserted as the body for this first lookup. This way, we would know which keys we
     // have inserted for that resource. For the first entry simply use vary_identifier as the
     // entry_list; for future entries append vary_identifier to existing list.
-    std::string entry_list;
-    map_[request_key] =
-        SimpleHttpCache::Entry{std::move(vary_only_map), {}, std::move(entry_list), {}};
+    shard.map_[request_key] = SimpleHttpCache::Entry{
+        std::move(vary_only_map), {}, std::make_shared<const std::string>(), {}};
   }
   return true;
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "source/common/protobuf/utility.h"
 #include "source/extensions/filters/http/cache/http_cache.h"
 
@@ -18,13 +20,24 @@ private:
   struct Entry {
     Http::ResponseHeaderMapPtr response_headers_;
     ResponseMetadata metadata_;
-    std::string body_;
+    // Bodies are shared with lookup contexts so that cached responses can be served as
+    // zero-copy buffer fragments rather than copied per request.
+    std::shared_ptr<const std::string> body_;
     Http::ResponseTrailerMapPtr trailers_;
   };
 
-  // Looks for a response that has been varied. Only called from lookup.
-  Entry varyLookup(const LookupRequest& request,
-                   const Http::ResponseHeaderMapPtr& response_headers);
+  // The key space is sharded to reduce lock contention between worker threads; each shard
+  // has its own mutex and map. Shards are selected by stableHashKey.
+  struct Shard {
+    absl::Mutex mutex_;
+    absl::flat_hash_map<Key, Entry, MessageUtil, MessageUtil> map_ ABSL_GUARDED_BY(mutex_);
+  };
+  static constexpr size_t ShardCount = 64;
+
+  Shard& shardForKey(const Key& key);
+
+  // Returns a copy of the entry stored under key, or an empty entry if absent.
+  Entry lookupEntry(const Key& key);
 
   // A list of headers that we do not want to update upon validation
   // We skip these headers because either it's updated by other application logic
@@ -55,8 +68,8 @@ public:
                   const Http::RequestHeaderMap& request_headers,
                   const VaryAllowList& vary_allow_list, Http::ResponseTrailerMapPtr&& trailers);
 
-  absl::Mutex mutex_;
-  absl::flat_hash_map<Key, Entry, MessageUtil, MessageUtil> map_ ABSL_GUARDED_BY(mutex_);
+private:
+  std::array<Shard, ShardCount> shards_;
 };
 
 } // namespace Cache
@@ -12,6 +12,7 @@
 #include "source/common/network/socket_interface.h"
 #include "source/common/network/utility.h"
 #include "source/common/protobuf/utility.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/server/configuration_impl.h"
 
 #include "absl/container/node_hash_map.h"
@@ -210,7 +211,10 @@ void FilterChainManagerImpl::addFilterChains(
     const envoy::config::listener::v3::FilterChain* default_filter_chain,
     FilterChainFactoryBuilder& filter_chain_factory_builder,
     FilterChainFactoryContextCreator& context_creator) {
-  Cleanup cleanup([this]() { origin_ = absl::nullopt; });
+  Cleanup cleanup([this]() {
+    origin_ = absl::nullopt;
+    origin_ignoring_match_index_.reset();
+  });
   absl::node_hash_map<envoy::config::listener::v3::FilterChainMatch, std::string, MessageUtil,
                       MessageUtil>
       filter_chains;
@@ -617,7 +621,9 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForDestinatio
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName(
     const ServerNamesMap& server_names_map, const Network::ConnectionSocket& socket) const {
   ASSERT(absl::AsciiStrToLower(socket.requestedServerName()) == socket.requestedServerName());
-  const std::string server_name(socket.requestedServerName());
+  // Heterogeneous lookups keep this hot path allocation free; probing per label suffix touches
+  // only the hash table, never materializing substrings.
+  const absl::string_view server_name = socket.requestedServerName();
 
   // Match on exact server name, i.e. "www.example.com" for "www.example.com".
   const auto server_name_exact_match = server_names_map.find(server_name);
@@ -627,8 +633,8 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 
   // Match on all wildcard domains, i.e. ".example.com" and ".com" for "www.example.com".
   size_t pos = server_name.find('.', 1);
-  while (pos < server_name.size() - 1 && pos != std::string::npos) {
-    const std::string wildcard = server_name.substr(pos);
+  while (pos < server_name.size() - 1 && pos != absl::string_view::npos) {
+    const absl::string_view wildcard = server_name.substr(pos);
     const auto server_name_wildcard_match = server_names_map.find(wildcard);
     if (server_name_wildcard_match != server_names_map.end()) {
       return findFilterChainForTransportProtocol(server_name_wildcard_match->second, socket);
@@ -648,10 +654,9 @@ const Network::FilterChain* FilterChainManagerImpl::findFilterChainForServerName
 const Network::FilterChain* FilterChainManagerImpl::findFilterChainForTransportProtocol(
     const TransportProtocolsMap& transport_protocols_map,
     const Network::ConnectionSocket& socket) const {
-  const std::string transport_protocol(socket.detectedTransportProtocol());
-
   // Match on exact transport protocol, e.g. "tls".
-  const auto transport_protocol_match = transport_protocols_map.find(transport_protocol);
+  const auto transport_protocol_match =
+      transport_protocols_map.find(socket.detectedTransportProtocol());
   if (transport_protocol_match != transport_protocols_map.end()) {
     return findFilterChainForApplicationProtocols(transport_protocol_match->second, socket);
   }
@@ -839,6 +844,29 @@ Network::DrainableFilterChainSharedPtr FilterChainManagerImpl::findExistingFilte
     fc_contexts_.emplace(filter_chain_message, iter->second);
     return iter->second;
   }
+  if (Runtime::runtimeFeatureEnabled(
+          "envoy.reloadable_features.reuse_filter_chain_on_match_only_change")) {
+    // The built filter chain does not depend on the filter chain match, so a filter chain whose
+    // only delta against the origin is its match can reuse the existing filter chain instead of
+    // being rebuilt (and the origin one drained). The match-insensitive index over the origin is
+    // built lazily on the first exact-lookup miss and lives only for the duration of
+    // addFilterChains().
+    if (!origin_ignoring_match_index_.has_value()) {
+      origin_ignoring_match_index_.emplace();
+      for (const auto& [message, filter_chain] : origin->fc_contexts_) {
+        envoy::config::listener::v3::FilterChain stripped_message = message;
+        stripped_message.clear_filter_chain_match();
+        origin_ignoring_match_index_->try_emplace(std::move(stripped_message), filter_chain);
+      }
+    }
+    envoy::config::listener::v3::FilterChain stripped_message = filter_chain_message;
+    stripped_message.clear_filter_chain_match();
+    auto stripped_iter = origin_ignoring_match_index_->find(stripped_message);
+    if (stripped_iter != origin_ignoring_match_index_->end()) {
+      fc_contexts_.emplace(filter_chain_message, stripped_iter->second);
+      return stripped_iter->second;
+    }
+  }
   return nullptr;
 }
 
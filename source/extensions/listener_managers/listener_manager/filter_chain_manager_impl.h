@@ -342,6 +342,12 @@ private:
   // Caution: only during warm up could the optional have value.
   absl::optional<const FilterChainManagerImpl*> origin_{nullptr};
 
+  // Index over the origin's filter chains keyed by their message with the filter chain match
+  // cleared, so that a filter chain differing from the origin only in its match can reuse the
+  // existing filter chain. Built lazily by findExistingFilterChain() and, like origin_, only has
+  // a value while addFilterChains() is running.
+  absl::optional<FcContextMap> origin_ignoring_match_index_;
+
   // For FilterChainFactoryContextCreator
   // init manager owned by the corresponding listener. The reference is valid when building the
   // filter chain.
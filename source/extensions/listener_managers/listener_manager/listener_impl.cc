@@ -17,6 +17,8 @@
 #include "source/common/access_log/access_log_impl.h"
 #include "source/common/api/os_sys_calls_impl.h"
 #include "source/common/common/assert.h"
+#include "source/common/common/cpu_affinity.h"
+#include "source/common/common/utility.h"
 #include "source/common/config/utility.h"
 #include "source/common/network/connection_balancer_impl.h"
 #include "source/common/network/resolver_impl.h"
@@ -77,10 +79,12 @@ ListenSocketFactoryImpl::ListenSocketFactoryImpl(
     Network::Socket::Type socket_type, const Network::Socket::OptionsSharedPtr& options,
     const std::string& listener_name, uint32_t tcp_backlog_size,
     ListenerComponentFactory::BindType bind_type,
-    const Network::SocketCreationOptions& creation_options, uint32_t num_sockets)
+    const Network::SocketCreationOptions& creation_options, uint32_t num_sockets,
+    bool steer_to_pinned_worker_cpus)
     : factory_(factory), local_address_(address), socket_type_(socket_type), options_(options),
       listener_name_(listener_name), tcp_backlog_size_(tcp_backlog_size), bind_type_(bind_type),
-      socket_creation_options_(creation_options) {
+      socket_creation_options_(creation_options),
+      steer_to_pinned_worker_cpus_(steer_to_pinned_worker_cpus) {
 
   if (local_address_->type() == Network::Address::Type::Ip) {
     if (socket_type == Network::Socket::Type::Datagram) {
@@ -125,7 +129,8 @@ ListenSocketFactoryImpl::ListenSocketFactoryImpl(const ListenSocketFactoryImpl&
       listener_name_(factory_to_clone.listener_name_),
       tcp_backlog_size_(factory_to_clone.tcp_backlog_size_),
       bind_type_(factory_to_clone.bind_type_),
-      socket_creation_options_(factory_to_clone.socket_creation_options_) {
+      socket_creation_options_(factory_to_clone.socket_creation_options_),
+      steer_to_pinned_worker_cpus_(factory_to_clone.steer_to_pinned_worker_cpus_) {
   for (auto& socket : factory_to_clone.sockets_) {
     // In the cloning case we always duplicate() the socket. This makes sure that during listener
     // update/drain we don't lose any incoming connections when using reuse_port. Specifically on
@@ -170,9 +175,34 @@ Network::SocketSharedPtr ListenSocketFactoryImpl::createListenSocketAndApplyOpti
     // set after listen() is called and immediately before the workers start running.
     socket->addOptions(options_);
   }
+  if (socket != nullptr && steer_to_pinned_worker_cpus_) {
+    applyIncomingCpuOption(*socket, worker_index);
+  }
   return socket;
 }
 
+void ListenSocketFactoryImpl::applyIncomingCpuOption(Network::Socket& socket,
+                                                     uint32_t worker_index) {
+  if (!ENVOY_SOCKET_SO_INCOMING_CPU.hasValue()) {
+    return;
+  }
+  const absl::optional<int32_t> cpu = Thread::pinnedCpuForWorker(worker_index);
+  if (!cpu.has_value()) {
+    return;
+  }
+  const int value = *cpu;
+  const Api::SysCallIntResult result =
+      socket.setSocketOption(ENVOY_SOCKET_SO_INCOMING_CPU.level(),
+                             ENVOY_SOCKET_SO_INCOMING_CPU.option(), &value, sizeof(value));
+  if (result.return_value_ != 0) {
+    ENVOY_LOG(warn, "{}: Setting SO_INCOMING_CPU to {} failed: {}", listener_name_, value,
+              errorDetails(result.errno_));
+  } else {
+    ENVOY_LOG(debug, "{}: Set SO_INCOMING_CPU to {} for worker {}", listener_name_, value,
+              worker_index);
+  }
+}
+
 Network::SocketSharedPtr ListenSocketFactoryImpl::getListenSocket(uint32_t worker_index) {
   // Per the TODO above, sockets at this point can never be null. That only happens in the
   // config validation path.
@@ -773,8 +803,16 @@ void ListenerImpl::buildConnectionBalancer(const Network::Address::Instance& add
     if (config_.has_connection_balance_config()) {
       switch (config_.connection_balance_config().balance_type_case()) {
       case envoy::config::listener::v3::Listener_ConnectionBalanceConfig::kExactBalance:
-        connection_balancers_.emplace(address.asString(),
-                                      std::make_shared<Network::ExactConnectionBalancerImpl>());
+        // The least-loaded balancer steers by live worker load without the per-accept lock the
+        // exact balancer holds, trading exactness for accept throughput on busy listeners.
+        if (Runtime::runtimeFeatureEnabled(
+                "envoy.reloadable_features.listener_least_loaded_connection_balance")) {
+          connection_balancers_.emplace(
+              address.asString(), std::make_shared<Network::LeastLoadedConnectionBalancerImpl>());
+        } else {
+          connection_balancers_.emplace(address.asString(),
+                                        std::make_shared<Network::ExactConnectionBalancerImpl>());
+        }
         break;
       case envoy::config::listener::v3::Listener_ConnectionBalanceConfig::kExtendBalance: {
         const std::string connection_balance_library_type{TypeUtil::typeUrlToDescriptorFullName(
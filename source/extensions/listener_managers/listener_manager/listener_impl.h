@@ -70,7 +70,7 @@ public:
                           const std::string& listener_name, uint32_t tcp_backlog_size,
                           ListenerComponentFactory::BindType bind_type,
                           const Network::SocketCreationOptions& creation_options,
-                          uint32_t num_sockets);
+                          uint32_t num_sockets, bool steer_to_pinned_worker_cpus = false);
 
   // Network::ListenSocketFactory
   Network::Socket::Type socketType() const override { return socket_type_; }
@@ -95,6 +95,11 @@ private:
                                                              Network::Socket::Type socket_type,
                                                              uint32_t worker_index);
 
+  // Sets SO_INCOMING_CPU on the given per-worker socket to the CPU its worker is pinned to, so
+  // the kernel steers each accepted connection's packets to the CPU running the owning
+  // dispatcher. Best effort: a no-op on platforms without the option.
+  void applyIncomingCpuOption(Network::Socket& socket, uint32_t worker_index);
+
   ListenerComponentFactory& factory_;
   // Initially, its port number might be 0. Once a socket is created, its port
   // will be set to the binding port.
@@ -105,6 +110,9 @@ private:
   const uint32_t tcp_backlog_size_;
   ListenerComponentFactory::BindType bind_type_;
   const Network::SocketCreationOptions socket_creation_options_;
+  // Whether per-worker sockets should carry SO_INCOMING_CPU matching the worker's pinned CPU.
+  // Only set for reuse-port listeners when bootstrap pin_worker_threads is enabled.
+  const bool steer_to_pinned_worker_cpus_;
   // One socket for each worker, pre-created before the workers fetch the sockets. There are
   // 3 different cases:
   // 1) All are null when doing config validation.
@@ -1103,7 +1103,9 @@ void ListenerManagerImpl::createListenSocketFactory(ListenerImpl& listener) {
       listener.addSocketFactory(std::make_unique<ListenSocketFactoryImpl>(
           *factory_, listener.addresses()[i], socket_type, listener.listenSocketOptions(i),
           listener.name(), listener.tcpBacklogSize(), bind_type, creation_options,
-          server_.options().concurrency()));
+          server_.options().concurrency(),
+          bind_type == ListenerComponentFactory::BindType::ReusePort &&
+              server_.bootstrap().pin_worker_threads()));
     }
   }
   END_TRY
@@ -0,0 +1,257 @@
+#include "source/extensions/network/dns_resolver/caching/caching.h"
+
+#include <chrono>
+#include <list>
+#include <memory>
+#include <utility>
+
+#include "envoy/extensions/network/dns_resolver/caching/v3/caching_dns_resolver.pb.h"
+#include "envoy/network/dns_resolver.h"
+
+#include "source/common/network/dns_resolver/dns_factory_util.h"
+#include "source/common/protobuf/utility.h"
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/synchronization/mutex.h"
+
+namespace Envoy {
+namespace Network {
+
+using CachingConfig =
+    envoy::extensions::network::dns_resolver::caching::v3::CachingDnsResolverConfig;
+
+// A resolver decorator which caches results from an underlying resolver and coalesces
+// concurrent resolutions of the same name into a single underlying query. All state is
+// accessed only on the dispatcher thread the resolver was created on, matching the
+// threading model of the resolvers it wraps.
+class CachingDnsResolver : public DnsResolver, public Logger::Loggable<Logger::Id::dns> {
+public:
+  CachingDnsResolver(const CachingConfig& config, Event::Dispatcher& dispatcher, Api::Api& api)
+      : time_source_(api.timeSource()),
+        refresh_ahead_ratio_(config.has_refresh_ahead_ratio() ? config.refresh_ahead_ratio().value()
+                                                              : DefaultRefreshAheadRatio),
+        max_stale_(config.has_max_stale()
+                       ? absl::optional<std::chrono::milliseconds>(std::chrono::milliseconds(
+                             DurationUtil::durationToMilliseconds(config.max_stale())))
+                       : absl::nullopt),
+        resolver_(createDnsResolverFactoryFromTypedConfig(config.dns_resolver_config())
+                      .createDnsResolver(dispatcher, api, config.dns_resolver_config())) {}
+
+  // DnsResolver
+  ActiveDnsQuery* resolve(const std::string& dns_name, DnsLookupFamily dns_lookup_family,
+                          ResolveCb callback) override {
+    const CacheKey key(dns_name, dns_lookup_family);
+    const MonotonicTime now = time_source_.monotonicTime();
+    auto cache_it = cache_.find(key);
+    if (cache_it != cache_.end() && now < cache_it->second.expiry_) {
+      // Copy the responses up front; a refresh completing inline below may mutate the
+      // cache and invalidate the iterator.
+      std::list<DnsResponse> responses(cache_it->second.responses_);
+      if (now >= cache_it->second.refresh_at_ && !pending_.contains(key)) {
+        ENVOY_LOG(debug, "refreshing DNS entry for {} ahead of expiry", dns_name);
+        // Register an empty pending resolution so further accesses do not trigger
+        // duplicate refreshes while this one is in flight.
+        pending_.emplace(key, std::make_unique<PendingResolution>());
+        startResolve(key);
+      }
+      ENVOY_LOG(debug, "answering resolution of {} from cache", dns_name);
+      callback(ResolutionStatus::Success, std::move(responses));
+      return nullptr;
+    }
+    auto pending_it = pending_.find(key);
+    const bool new_flight = pending_it == pending_.end();
+    if (new_flight) {
+      pending_it = pending_.emplace(key, std::make_unique<PendingResolution>()).first;
+    } else {
+      ENVOY_LOG(debug, "coalescing resolution of {} onto the in-flight query", dns_name);
+    }
+    PendingResolution* pending = pending_it->second.get();
+    pending->callers_.push_back(std::make_unique<ActiveQuery>(*pending, std::move(callback)));
+    ActiveQuery* query = pending->callers_.back().get();
+    if (new_flight) {
+      startResolve(key);
+      // The underlying resolver may have completed inline, in which case the callback has
+      // already run and, per the interface contract, no handle may be returned.
+      auto completed_it = pending_.find(key);
+      if (completed_it == pending_.end() || completed_it->second.get() != pending) {
+        return nullptr;
+      }
+    }
+    return query;
+  }
+
+  void resetNetworking() override {
+    // Addresses resolved on the previous network may no longer be reachable.
+    cache_.clear();
+    resolver_->resetNetworking();
+  }
+
+private:
+  using CacheKey = std::pair<std::string, DnsLookupFamily>;
+
+  struct PendingResolution;
+
+  class ActiveQuery : public ActiveDnsQuery {
+  public:
+    ActiveQuery(PendingResolution& parent, ResolveCb callback)
+        : parent_(parent), callback_(std::move(callback)) {}
+
+    void cancel(CancelReason) override {
+      for (auto it = parent_.callers_.begin(); it != parent_.callers_.end(); ++it) {
+        if (it->get() == this) {
+          // Deletes this; nothing may be touched afterwards.
+          parent_.callers_.erase(it);
+          return;
+        }
+      }
+    }
+
+    PendingResolution& parent_;
+    ResolveCb callback_;
+  };
+
+  struct PendingResolution {
+    // The callers waiting on the in-flight query. The underlying query is intentionally
+    // not cancelled when every caller cancels; letting it complete populates the cache
+    // for future resolutions.
+    std::list<std::unique_ptr<ActiveQuery>> callers_;
+  };
+
+  struct CacheEntry {
+    std::list<DnsResponse> responses_;
+    MonotonicTime expiry_;
+    MonotonicTime refresh_at_;
+  };
+
+  void startResolve(const CacheKey& key) {
+    // The returned handle is deliberately unused; see PendingResolution.
+    resolver_->resolve(key.first, key.second,
+                       [this, key](ResolutionStatus status, std::list<DnsResponse>&& response) {
+                         onResolveComplete(key, status, std::move(response));
+                       });
+  }
+
+  void onResolveComplete(const CacheKey& key, ResolutionStatus status,
+                         std::list<DnsResponse>&& response) {
+    std::list<std::unique_ptr<ActiveQuery>> callers;
+    auto pending_it = pending_.find(key);
+    if (pending_it != pending_.end()) {
+      callers = std::move(pending_it->second->callers_);
+      pending_.erase(pending_it);
+    }
+    const MonotonicTime now = time_source_.monotonicTime();
+    if (status == ResolutionStatus::Success) {
+      CacheEntry& entry = cache_[key];
+      entry.responses_ = std::move(response);
+      const std::chrono::seconds ttl = cacheTtl(entry.responses_);
+      entry.expiry_ = now + ttl;
+      entry.refresh_at_ =
+          now + std::chrono::duration_cast<MonotonicTime::duration>(ttl * refresh_ahead_ratio_);
+      finishCallers(std::move(callers), ResolutionStatus::Success, entry.responses_);
+      return;
+    }
+    auto cache_it = cache_.find(key);
+    if (cache_it != cache_.end()) {
+      const bool fresh = now < cache_it->second.expiry_;
+      if (fresh ||
+          (max_stale_.has_value() && now < cache_it->second.expiry_ + max_stale_.value())) {
+        // A failed refresh-ahead leaves the still-fresh entry in place, and an expired
+        // entry within the max_stale window is served with a success status rather than
+        // propagating the failure, so a resolver outage does not tear down hosts that
+        // were previously resolving correctly. The entry's expiry is left unchanged, so
+        // a later resolution will retry the underlying resolver.
+        if (!fresh) {
+          ENVOY_LOG(debug, "serving stale DNS entry for {} after resolution failure", key.first);
+        }
+        finishCallers(std::move(callers), ResolutionStatus::Success, cache_it->second.responses_);
+        return;
+      }
+      cache_.erase(cache_it);
+    }
+    finishCallers(std::move(callers), ResolutionStatus::Failure, response);
+  }
+
+  void finishCallers(std::list<std::unique_ptr<ActiveQuery>> callers, ResolutionStatus status,
+                     const std::list<DnsResponse>& responses) {
+    for (std::unique_ptr<ActiveQuery>& caller : callers) {
+      caller->callback_(status, std::list<DnsResponse>(responses));
+    }
+  }
+
+  std::chrono::seconds cacheTtl(const std::list<DnsResponse>& responses) const {
+    if (responses.empty()) {
+      return MinTtl;
+    }
+    std::chrono::seconds ttl = std::chrono::seconds::max();
+    for (const DnsResponse& response : responses) {
+      ttl = std::min(ttl, response.addrInfo().ttl_);
+    }
+    return std::max(ttl, MinTtl);
+  }
+
+  // Lower bound applied to cached TTLs, and used for successful responses with no
+  // addresses, so that a zero TTL does not defeat query coalescing entirely.
+  static constexpr std::chrono::seconds MinTtl{5};
+  static constexpr double DefaultRefreshAheadRatio{0.75};
+
+  TimeSource& time_source_;
+  const double refresh_ahead_ratio_;
+  const absl::optional<std::chrono::milliseconds> max_stale_;
+  absl::flat_hash_map<CacheKey, CacheEntry> cache_;
+  absl::flat_hash_map<CacheKey, std::unique_ptr<PendingResolution>> pending_;
+  // Declared last so it is destroyed first and cannot invoke completion callbacks into
+  // the maps above while they are being torn down.
+  const DnsResolverSharedPtr resolver_;
+};
+
+// caching DNS resolver factory
+class CachingDnsResolverFactory : public DnsResolverFactory,
+                                  public Logger::Loggable<Logger::Id::dns> {
+public:
+  std::string name() const override { return {"envoy.network.dns_resolver.caching"}; }
+
+  ProtobufTypes::MessagePtr createEmptyConfigProto() override {
+    return ProtobufTypes::MessagePtr{new CachingConfig()};
+  }
+
+  DnsResolverSharedPtr
+  createDnsResolver(Event::Dispatcher& dispatcher, Api::Api& api,
+                    const envoy::config::core::v3::TypedExtensionConfig& typed_dns_resolver_config)
+      const override {
+    ASSERT(dispatcher.isThreadSafe());
+    CachingConfig config;
+    Envoy::MessageUtil::unpackTo(typed_dns_resolver_config.typed_config(), config);
+    // Resolvers created from identical configurations on the same dispatcher share one
+    // instance, and with it one cache, so resolutions of the same hostname from different
+    // clusters coalesce process-wide.
+    const std::pair<uint64_t, Event::Dispatcher*> key(
+        MessageUtil::hash(typed_dns_resolver_config.typed_config()), &dispatcher);
+    absl::MutexLock lock(&mutex_);
+    std::weak_ptr<DnsResolver>& weak = resolvers_[key];
+    DnsResolverSharedPtr resolver = weak.lock();
+    if (resolver == nullptr) {
+      resolver = std::make_shared<CachingDnsResolver>(config, dispatcher, api);
+      weak = resolver;
+      // Opportunistically prune entries whose resolvers are no longer alive.
+      for (auto entry = resolvers_.begin(); entry != resolvers_.end();) {
+        if (entry->second.expired()) {
+          resolvers_.erase(entry++);
+        } else {
+          ++entry;
+        }
+      }
+    }
+    return resolver;
+  }
+
+private:
+  mutable absl::Mutex mutex_;
+  mutable absl::flat_hash_map<std::pair<uint64_t, Event::Dispatcher*>, std::weak_ptr<DnsResolver>>
+      resolvers_ ABSL_GUARDED_BY(mutex_);
+};
+
+// Register the CachingDnsResolverFactory
+REGISTER_FACTORY(CachingDnsResolverFactory, DnsResolverFactory);
+
+} // namespace Network
+} // namespace Envoy
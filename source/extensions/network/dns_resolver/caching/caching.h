@@ -0,0 +1,11 @@
+#pragma once
+
+#include "envoy/registry/registry.h"
+
+namespace Envoy {
+namespace Network {
+
+DECLARE_FACTORY(CachingDnsResolverFactory);
+
+} // namespace Network
+} // namespace Envoy
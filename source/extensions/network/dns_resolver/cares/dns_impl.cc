@@ -171,6 +171,7 @@ void DnsResolverImpl::AddrInfoPendingResolution::onAresGetAddrInfoCallback(
 
     // Nothing can follow a call to finishResolve due to the deletion of this object upon
     // finishResolve().
+    completeMergedResolutions();
     finishResolve();
     return;
   }
@@ -243,6 +244,7 @@ void DnsResolverImpl::AddrInfoPendingResolution::onAresGetAddrInfoCallback(
   }
 
   if (completed_) {
+    completeMergedResolutions();
     finishResolve();
     // Nothing can follow a call to finishResolve due to the deletion of this object upon
     // finishResolve().
@@ -357,6 +359,18 @@ ActiveDnsQuery* DnsResolverImpl::resolve(const std::string& dns_name,
   // failed initial call to getAddrInfo followed by a synchronous IPv4
   // resolution.
 
+  const bool merge_concurrent_resolutions = Runtime::runtimeFeatureEnabled(
+      "envoy.reloadable_features.cares_merge_concurrent_resolutions");
+  if (merge_concurrent_resolutions) {
+    const auto it = in_flight_resolutions_.find(std::make_pair(dns_name, dns_lookup_family));
+    if (it != in_flight_resolutions_.end()) {
+      ENVOY_LOG_EVENT(debug, "cares_dns_resolution_merged",
+                      "dns resolution for {} merged into identical in-flight resolution", dns_name);
+      stats_.resolutions_merged_.inc();
+      return it->second->addMergedResolution(callback);
+    }
+  }
+
   // @see DnsResolverImpl::PendingResolution::onAresGetAddrInfoCallback for why this is done.
   if (dirty_channel_) {
     ares_destroy(channel_);
@@ -375,6 +389,12 @@ ActiveDnsQuery* DnsResolverImpl::resolve(const std::string& dns_name,
     // Enable timer to wake us up if the request times out.
     updateAresTimer();
 
+    if (merge_concurrent_resolutions) {
+      in_flight_resolutions_.emplace(std::make_pair(dns_name, dns_lookup_family),
+                                     pending_resolution.get());
+      pending_resolution->in_flight_registered_ = true;
+    }
+
     // The PendingResolution will self-delete when the request completes (including if cancelled or
     // if ~DnsResolverImpl() happens via ares_destroy() and subsequent handling of ARES_EDESTRUCTION
     // in DnsResolverImpl::PendingResolution::onAresGetAddrInfoCallback()).
@@ -430,6 +450,45 @@ DnsResolverImpl::AddrInfoPendingResolution::~AddrInfoPendingResolution() {
 
 void DnsResolverImpl::AddrInfoPendingResolution::startResolution() { startResolutionImpl(family_); }
 
+ActiveDnsQuery*
+DnsResolverImpl::AddrInfoPendingResolution::addMergedResolution(ResolveCb callback) {
+  ASSERT(in_flight_registered_);
+  merged_resolutions_.emplace_back(std::make_unique<MergedPendingResolution>(callback));
+  return merged_resolutions_.back().get();
+}
+
+void DnsResolverImpl::AddrInfoPendingResolution::completeMergedResolutions() {
+  if (in_flight_registered_) {
+    parent_.in_flight_resolutions_.erase(std::make_pair(dns_name_, dns_lookup_family_));
+    in_flight_registered_ = false;
+  }
+  if (merged_resolutions_.empty()) {
+    return;
+  }
+
+  ENVOY_LOG_EVENT(debug, "cares_dns_merged_resolutions_complete",
+                  "dns resolution for {} shared with {} merged resolutions", dns_name_,
+                  merged_resolutions_.size());
+  for (const auto& merged : merged_resolutions_) {
+    if (merged->cancelled_) {
+      continue;
+    }
+    // Each merged resolution receives its own copy; finishResolve() consumes the original.
+    std::list<DnsResponse> address_list = pending_response_.address_list_;
+    // @see PendingResolution::finishResolve for why exceptions are caught here.
+    TRY_NEEDS_AUDIT { merged->callback_(pending_response_.status_, std::move(address_list)); }
+    catch (const std::exception& e) {
+      ENVOY_LOG(critical, "Exception in c-ares merged resolution callback: {}", e.what());
+      dispatcher_.post([s = std::string(e.what())] { throw EnvoyException(s); });
+    }
+    catch (...) {
+      ENVOY_LOG(critical, "Unknown exception in c-ares merged resolution callback");
+      dispatcher_.post([] { throw EnvoyException("unknown"); });
+    }
+  }
+  merged_resolutions_.clear();
+}
+
 void DnsResolverImpl::AddrInfoPendingResolution::startResolutionImpl(int family) {
   pending_resolutions_++;
   parent_.stats_.pending_resolutions_.inc();
@@ -28,7 +28,8 @@ namespace Network {
   GAUGE(pending_resolutions, NeverImport)                                                          \
   COUNTER(not_found)                                                                               \
   COUNTER(get_addr_failure)                                                                        \
-  COUNTER(timeouts)
+  COUNTER(timeouts)                                                                                \
+  COUNTER(resolutions_merged)
 
 /**
  * Struct definition for all DNS stats. @see stats_macros.h
@@ -64,6 +65,21 @@ public:
 
 private:
   friend class DnsResolverImplPeer;
+
+  // A resolution that was merged into an identical concurrent resolution rather than issuing its
+  // own c-ares query. It only holds the caller's callback; the resolution that owns it invokes
+  // the callback (with a copy of the shared result) on completion.
+  class MergedPendingResolution : public ActiveDnsQuery {
+  public:
+    MergedPendingResolution(ResolveCb callback) : callback_(callback) {}
+
+    // Network::ActiveDnsQuery
+    void cancel(CancelReason) override { cancelled_ = true; }
+
+    const ResolveCb callback_;
+    bool cancelled_ = false;
+  };
+
   class PendingResolution : public ActiveDnsQuery {
   public:
     void cancel(CancelReason reason) override {
@@ -134,7 +150,21 @@ private:
      */
     void startResolution();
 
+    /**
+     * Attach a resolution for the same name and lookup family to this in-flight resolution.
+     * @param callback the merged caller's completion callback.
+     * @return the ActiveDnsQuery handle for the merged resolution, owned by this resolution.
+     */
+    ActiveDnsQuery* addMergedResolution(ResolveCb callback);
+
+    // Is this resolution registered in the parent's in-flight map? @see in_flight_resolutions_.
+    bool in_flight_registered_ = false;
+
   private:
+    // Deregister from the parent's in-flight map and invoke the callbacks of any merged
+    // resolutions with a copy of the pending response. Must be called before finishResolve()
+    // consumes the response.
+    void completeMergedResolutions();
     void startResolutionImpl(int family);
     bool isResponseWithNoRecords(int status);
 
@@ -161,6 +191,9 @@ private:
     const DnsLookupFamily dns_lookup_family_;
     // Queried for at construction time.
     const AvailableInterfaces available_interfaces_;
+    // Resolutions for the same name and lookup family that were merged into this one instead of
+    // issuing their own queries.
+    std::list<std::unique_ptr<MergedPendingResolution>> merged_resolutions_;
   };
 
   struct AresOptions {
@@ -194,6 +227,11 @@ private:
   envoy::config::core::v3::DnsResolverOptions dns_resolver_options_;
 
   absl::node_hash_map<int, Event::FileEventPtr> events_;
+  // In-flight asynchronous resolutions by name and lookup family. Concurrent resolve() calls for
+  // a key already present are merged into the existing resolution instead of issuing duplicate
+  // queries.
+  absl::node_hash_map<std::pair<std::string, DnsLookupFamily>, AddrInfoPendingResolution*>
+      in_flight_resolutions_;
   const bool use_resolvers_as_fallback_;
   const absl::optional<std::string> resolvers_csv_;
   const bool filter_unroutable_families_;
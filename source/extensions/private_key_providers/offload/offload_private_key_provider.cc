@@ -0,0 +1,406 @@
+#include "source/extensions/private_key_providers/offload/offload_private_key_provider.h"
+
+#include <memory>
+#include <thread>
+
+#include "envoy/registry/registry.h"
+#include "envoy/server/transport_socket_config.h"
+
+#include "source/common/common/lock_guard.h"
+#include "source/common/config/datasource.h"
+
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+OffloadContext::OffloadContext(Operation operation, bssl::UniquePtr<EVP_PKEY> pkey,
+                               uint16_t signature_algorithm, const uint8_t* in, size_t in_len,
+                               Event::Dispatcher& dispatcher, Ssl::PrivateKeyConnectionCallbacks& cb,
+                               std::shared_ptr<bool> alive)
+    : operation_(operation), pkey_(std::move(pkey)), signature_algorithm_(signature_algorithm),
+      in_(in, in + in_len), dispatcher_(dispatcher), cb_(cb), alive_(std::move(alive)) {}
+
+void OffloadContext::scheduleCallback(RequestStatus status) {
+  // Posting is the only thread-safe dispatcher operation, so the pool thread
+  // hands the result over with it. The status can't be set beforehand, because
+  // the callback asserts if someone else races to call doHandshake() and the
+  // status goes to HandshakeComplete.
+  dispatcher_.post([context = shared_from_this(), status]() {
+    context->status_ = status;
+    if (*context->alive_) {
+      context->cb_.onPrivateKeyMethodComplete();
+    }
+  });
+}
+
+RequestStatus OffloadContext::execute() {
+  switch (operation_) {
+  case Operation::RsaSign:
+    return rsaSign();
+  case Operation::RsaDecrypt:
+    return rsaDecrypt();
+  case Operation::EcdsaSign:
+    return ecdsaSign();
+  }
+  return RequestStatus::Error;
+}
+
+namespace {
+
+int calculateDigest(const EVP_MD* md, const uint8_t* in, size_t in_len, unsigned char* hash,
+                    unsigned int* hash_len) {
+  bssl::ScopedEVP_MD_CTX ctx;
+
+  // Calculate the message digest for signing.
+  if (!EVP_DigestInit_ex(ctx.get(), md, nullptr) || !EVP_DigestUpdate(ctx.get(), in, in_len) ||
+      !EVP_DigestFinal_ex(ctx.get(), hash, hash_len)) {
+    return 0;
+  }
+  return 1;
+}
+
+} // namespace
+
+RequestStatus OffloadContext::rsaSign() {
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey_.get());
+  if (rsa == nullptr) {
+    return RequestStatus::Error;
+  }
+
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(signature_algorithm_);
+  if (md == nullptr) {
+    return RequestStatus::Error;
+  }
+
+  unsigned char hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len;
+  if (!calculateDigest(md, in_.data(), in_.size(), hash, &hash_len)) {
+    return RequestStatus::Error;
+  }
+
+  out_.resize(RSA_size(rsa));
+
+  // `PSS` and `PKCS#1` v1.5 padding schemes are supported.
+  if (SSL_is_signature_algorithm_rsa_pss(signature_algorithm_)) {
+    size_t out_len;
+    if (!RSA_sign_pss_mgf1(rsa, &out_len, out_.data(), out_.size(), hash, hash_len, md, nullptr,
+                           -1)) {
+      return RequestStatus::Error;
+    }
+    out_.resize(out_len);
+  } else {
+    unsigned int out_len;
+    if (!RSA_sign(EVP_MD_type(md), hash, hash_len, out_.data(), &out_len, rsa)) {
+      return RequestStatus::Error;
+    }
+    out_.resize(out_len);
+  }
+  return RequestStatus::Success;
+}
+
+RequestStatus OffloadContext::rsaDecrypt() {
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey_.get());
+  if (rsa == nullptr) {
+    return RequestStatus::Error;
+  }
+
+  // The private key method contract requires a raw RSA decryption; BoringSSL
+  // checks the padding itself in constant time.
+  size_t out_len;
+  out_.resize(RSA_size(rsa));
+  if (!RSA_decrypt(rsa, &out_len, out_.data(), out_.size(), in_.data(), in_.size(),
+                   RSA_NO_PADDING)) {
+    return RequestStatus::Error;
+  }
+  out_.resize(out_len);
+  return RequestStatus::Success;
+}
+
+RequestStatus OffloadContext::ecdsaSign() {
+  EC_KEY* ec_key = EVP_PKEY_get0_EC_KEY(pkey_.get());
+  if (ec_key == nullptr) {
+    return RequestStatus::Error;
+  }
+
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(signature_algorithm_);
+  if (md == nullptr) {
+    return RequestStatus::Error;
+  }
+
+  unsigned char hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len;
+  if (!calculateDigest(md, in_.data(), in_.size(), hash, &hash_len)) {
+    return RequestStatus::Error;
+  }
+
+  unsigned int out_len;
+  out_.resize(ECDSA_size(ec_key));
+  if (!ECDSA_sign(0, hash, hash_len, out_.data(), &out_len, ec_key)) {
+    return RequestStatus::Error;
+  }
+  out_.resize(out_len);
+  return RequestStatus::Success;
+}
+
+OffloadThreadPool::OffloadThreadPool(Api::Api& api, uint32_t pool_size) {
+  ASSERT(pool_size >= 1);
+  ENVOY_LOG(debug, "Creating TLS handshake offload pool with {} threads", pool_size);
+  threads_.reserve(pool_size);
+  for (uint32_t i = 0; i < pool_size; i++) {
+    // Linux thread names are limited to 15 characters.
+    Thread::Options options{fmt::format("tls_offload_{}", i)};
+    threads_.push_back(
+        api.threadFactory().createThread([this]() { workerLoop(); }, options));
+  }
+}
+
+OffloadThreadPool::~OffloadThreadPool() {
+  {
+    Thread::LockGuard lock(mutex_);
+    shutdown_ = true;
+  }
+  work_available_.notifyAll();
+  for (Thread::ThreadPtr& thread : threads_) {
+    thread->join();
+  }
+  // Fail any operations which were still queued, so that pending handshakes
+  // are completed rather than left hanging. The registered connections hold
+  // the provider (and thus the pool) through their transport socket factory,
+  // so in practice the queue is empty by the time the pool is destroyed.
+  std::deque<OffloadContextSharedPtr> leftover;
+  {
+    Thread::LockGuard lock(mutex_);
+    leftover.swap(queue_);
+  }
+  for (const OffloadContextSharedPtr& context : leftover) {
+    context->scheduleCallback(RequestStatus::Error);
+  }
+}
+
+void OffloadThreadPool::post(OffloadContextSharedPtr context) {
+  {
+    Thread::LockGuard lock(mutex_);
+    queue_.push_back(std::move(context));
+  }
+  work_available_.notifyOne();
+}
+
+void OffloadThreadPool::workerLoop() {
+  while (true) {
+    OffloadContextSharedPtr context;
+    {
+      Thread::LockGuard lock(mutex_);
+      while (!shutdown_ && queue_.empty()) {
+        work_available_.wait(mutex_);
+      }
+      if (shutdown_) {
+        return;
+      }
+      context = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    context->scheduleCallback(context->execute());
+  }
+}
+
+OffloadPrivateKeyConnection::OffloadPrivateKeyConnection(Ssl::PrivateKeyConnectionCallbacks& cb,
+                                                         Event::Dispatcher& dispatcher,
+                                                         bssl::UniquePtr<EVP_PKEY> pkey,
+                                                         OffloadThreadPool& pool)
+    : dispatcher_(dispatcher), cb_(cb), alive_(std::make_shared<bool>(true)), pool_(pool),
+      pkey_(std::move(pkey)) {}
+
+void OffloadPrivateKeyConnection::offload(OffloadContextSharedPtr context) {
+  context_ = context;
+  pool_.post(std::move(context));
+}
+
+namespace {
+
+ssl_private_key_result_t privateKeySignInternal(OffloadPrivateKeyConnection* ops,
+                                                uint16_t signature_algorithm, const uint8_t* in,
+                                                size_t in_len) {
+  if (ops == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  bssl::UniquePtr<EVP_PKEY> pkey = ops->getPrivateKey();
+
+  // Check if the SSL instance has correct data attached to it.
+  if (pkey == nullptr ||
+      EVP_PKEY_id(pkey.get()) != SSL_get_signature_algorithm_key_type(signature_algorithm)) {
+    return ssl_private_key_failure;
+  }
+
+  const OffloadContext::Operation operation = EVP_PKEY_id(pkey.get()) == EVP_PKEY_RSA
+                                                  ? OffloadContext::Operation::RsaSign
+                                                  : OffloadContext::Operation::EcdsaSign;
+  OffloadContextSharedPtr context =
+      std::make_shared<OffloadContext>(operation, std::move(pkey), signature_algorithm, in, in_len,
+                                       ops->dispatcher_, ops->cb_, ops->alive_);
+  ops->offload(std::move(context));
+  return ssl_private_key_retry;
+}
+
+ssl_private_key_result_t privateKeySign(SSL* ssl, uint8_t*, size_t*, size_t,
+                                        uint16_t signature_algorithm, const uint8_t* in,
+                                        size_t in_len) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeySignInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              signature_algorithm, in, in_len);
+}
+
+ssl_private_key_result_t privateKeyDecryptInternal(OffloadPrivateKeyConnection* ops,
+                                                   const uint8_t* in, size_t in_len) {
+  if (ops == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  bssl::UniquePtr<EVP_PKEY> pkey = ops->getPrivateKey();
+
+  // Only RSA keys get decryption requests.
+  if (pkey == nullptr || EVP_PKEY_id(pkey.get()) != EVP_PKEY_RSA) {
+    return ssl_private_key_failure;
+  }
+
+  OffloadContextSharedPtr context = std::make_shared<OffloadContext>(
+      OffloadContext::Operation::RsaDecrypt, std::move(pkey), 0, in, in_len, ops->dispatcher_,
+      ops->cb_, ops->alive_);
+  ops->offload(std::move(context));
+  return ssl_private_key_retry;
+}
+
+ssl_private_key_result_t privateKeyDecrypt(SSL* ssl, uint8_t*, size_t*, size_t, const uint8_t* in,
+                                           size_t in_len) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeyDecryptInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              in, in_len);
+}
+
+ssl_private_key_result_t privateKeyCompleteInternal(OffloadPrivateKeyConnection* ops, uint8_t* out,
+                                                    size_t* out_len, size_t max_out) {
+  if (ops == nullptr || ops->context_ == nullptr) {
+    return ssl_private_key_failure;
+  }
+
+  // Check if the operation is ready yet. This can happen if someone calls
+  // the top-level SSL function too early. The op status is only set from this
+  // thread.
+  if (ops->context_->getStatus() == RequestStatus::Retry) {
+    return ssl_private_key_retry;
+  }
+
+  // If this point is reached, the pool processing must be complete.
+  if (ops->context_->getStatus() != RequestStatus::Success) {
+    return ssl_private_key_failure;
+  }
+
+  const std::vector<uint8_t>& output = ops->context_->output();
+  if (output.size() > max_out) {
+    return ssl_private_key_failure;
+  }
+
+  *out_len = output.size();
+  memcpy(out, output.data(), output.size()); // NOLINT(safe-memcpy)
+
+  return ssl_private_key_success;
+}
+
+ssl_private_key_result_t privateKeyComplete(SSL* ssl, uint8_t* out, size_t* out_len,
+                                            size_t max_out) {
+  return ssl == nullptr ? ssl_private_key_failure
+                        : privateKeyCompleteInternal(
+                              static_cast<OffloadPrivateKeyConnection*>(SSL_get_ex_data(
+                                  ssl, OffloadPrivateKeyMethodProvider::connectionIndex())),
+                              out, out_len, max_out);
+}
+
+} // namespace
+
+void OffloadPrivateKeyMethodProvider::registerPrivateKeyMethod(
+    SSL* ssl, Ssl::PrivateKeyConnectionCallbacks& cb, Event::Dispatcher& dispatcher) {
+  if (SSL_get_ex_data(ssl, OffloadPrivateKeyMethodProvider::connectionIndex()) != nullptr) {
+    throw EnvoyException("Not registering the offload provider twice for same context");
+  }
+
+  OffloadPrivateKeyConnection* ops =
+      new OffloadPrivateKeyConnection(cb, dispatcher, bssl::UpRef(pkey_), *thread_pool_);
+  SSL_set_ex_data(ssl, OffloadPrivateKeyMethodProvider::connectionIndex(), ops);
+}
+
+void OffloadPrivateKeyMethodProvider::unregisterPrivateKeyMethod(SSL* ssl) {
+  OffloadPrivateKeyConnection* ops = static_cast<OffloadPrivateKeyConnection*>(
+      SSL_get_ex_data(ssl, OffloadPrivateKeyMethodProvider::connectionIndex()));
+  SSL_set_ex_data(ssl, OffloadPrivateKeyMethodProvider::connectionIndex(), nullptr);
+  delete ops;
+}
+
+bool OffloadPrivateKeyMethodProvider::checkFips() {
+  // The provider uses regular BoringSSL operations, so the answer depends only
+  // on how BoringSSL was built; be conservative and match the behavior of the
+  // other providers.
+  return false;
+}
+
+Ssl::BoringSslPrivateKeyMethodSharedPtr
+OffloadPrivateKeyMethodProvider::getBoringSslPrivateKeyMethod() {
+  return method_;
+}
+
+// The OffloadPrivateKeyMethodProvider is created on config.
+OffloadPrivateKeyMethodProvider::OffloadPrivateKeyMethodProvider(
+    const envoy::extensions::private_key_providers::offload::v3::OffloadPrivateKeyMethodConfig&
+        conf,
+    Server::Configuration::TransportSocketFactoryContext& factory_context) {
+  std::string private_key =
+      Config::DataSource::read(conf.private_key(), false, factory_context.api());
+
+  bssl::UniquePtr<BIO> bio(
+      BIO_new_mem_buf(const_cast<char*>(private_key.data()), private_key.size()));
+
+  bssl::UniquePtr<EVP_PKEY> pkey(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr));
+  if (pkey == nullptr) {
+    throw EnvoyException("Failed to read private key.");
+  }
+
+  const int key_type = EVP_PKEY_id(pkey.get());
+  if (key_type != EVP_PKEY_RSA && key_type != EVP_PKEY_EC) {
+    throw EnvoyException("Not supported key type, only EC and RSA are supported.");
+  }
+
+  method_ = std::make_shared<SSL_PRIVATE_KEY_METHOD>();
+  method_->sign = privateKeySign;
+  method_->decrypt = privateKeyDecrypt;
+  method_->complete = privateKeyComplete;
+
+  pkey_ = std::move(pkey);
+
+  uint32_t pool_size = conf.has_thread_pool_size()
+                           ? conf.thread_pool_size().value()
+                           : std::max(1U, std::thread::hardware_concurrency() / 2);
+  thread_pool_ = std::make_unique<OffloadThreadPool>(factory_context.api(), pool_size);
+}
+
+namespace {
+int createIndex() {
+  int index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  RELEASE_ASSERT(index >= 0, "Failed to get SSL user data index.");
+  return index;
+}
+} // namespace
+
+int OffloadPrivateKeyMethodProvider::connectionIndex() {
+  CONSTRUCT_ON_FIRST_USE(int, createIndex());
+}
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
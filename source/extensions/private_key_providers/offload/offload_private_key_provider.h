@@ -0,0 +1,145 @@
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "envoy/api/api.h"
+#include "envoy/event/dispatcher.h"
+#include "envoy/extensions/private_key_providers/offload/v3/offload.pb.h"
+#include "envoy/ssl/private_key/private_key.h"
+#include "envoy/ssl/private_key/private_key_config.h"
+
+#include "source/common/common/logger.h"
+#include "source/common/common/thread.h"
+
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+
+enum class RequestStatus { Retry, Success, Error };
+
+// OffloadContext holds one private key operation while it travels from the
+// worker thread to the handshake thread pool and back. It owns copies of all
+// inputs (including its own reference to the key), so it has no lifetime
+// dependency on the provider or the SSL connection while the pool works on it.
+class OffloadContext : public std::enable_shared_from_this<OffloadContext> {
+public:
+  enum class Operation { RsaSign, RsaDecrypt, EcdsaSign };
+
+  OffloadContext(Operation operation, bssl::UniquePtr<EVP_PKEY> pkey, uint16_t signature_algorithm,
+                 const uint8_t* in, size_t in_len, Event::Dispatcher& dispatcher,
+                 Ssl::PrivateKeyConnectionCallbacks& cb, std::shared_ptr<bool> alive);
+
+  // Performs the cryptographic operation. Called on a pool thread; touches
+  // only data owned by the context.
+  RequestStatus execute();
+
+  // Posts completion to the worker dispatcher. The callback is only invoked
+  // if the connection is still registered, checked on the worker thread via
+  // the `alive` flag shared with OffloadPrivateKeyConnection.
+  void scheduleCallback(RequestStatus status);
+
+  RequestStatus getStatus() const { return status_; }
+
+  const std::vector<uint8_t>& output() const { return out_; }
+
+private:
+  RequestStatus rsaSign();
+  RequestStatus rsaDecrypt();
+  RequestStatus ecdsaSign();
+
+  const Operation operation_;
+  bssl::UniquePtr<EVP_PKEY> pkey_;
+  const uint16_t signature_algorithm_;
+  std::vector<uint8_t> in_;
+  std::vector<uint8_t> out_;
+  // Only read on the worker thread, and only written from the posted
+  // completion callback which also runs on the worker thread.
+  RequestStatus status_{RequestStatus::Retry};
+
+  Event::Dispatcher& dispatcher_;
+  Ssl::PrivateKeyConnectionCallbacks& cb_;
+  std::shared_ptr<bool> alive_;
+};
+
+using OffloadContextSharedPtr = std::shared_ptr<OffloadContext>;
+
+// OffloadThreadPool runs private key operations on dedicated threads so that
+// worker event loops stay responsive during handshake storms. The pool is
+// shared by all workers; completions are posted back to the originating
+// worker's dispatcher.
+class OffloadThreadPool : public Logger::Loggable<Logger::Id::connection> {
+public:
+  OffloadThreadPool(Api::Api& api, uint32_t pool_size);
+  ~OffloadThreadPool();
+
+  // Enqueues an operation; a pool thread will execute it and schedule its
+  // completion callback. Thread-safe.
+  void post(OffloadContextSharedPtr context);
+
+private:
+  void workerLoop();
+
+  Thread::MutexBasicLockable mutex_;
+  Thread::CondVar work_available_;
+  std::deque<OffloadContextSharedPtr> queue_ ABSL_GUARDED_BY(mutex_);
+  bool shutdown_ ABSL_GUARDED_BY(mutex_) = false;
+  std::vector<Thread::ThreadPtr> threads_;
+};
+
+// OffloadPrivateKeyConnection maintains the data needed by a given SSL
+// connection.
+class OffloadPrivateKeyConnection {
+public:
+  OffloadPrivateKeyConnection(Ssl::PrivateKeyConnectionCallbacks& cb, Event::Dispatcher& dispatcher,
+                              bssl::UniquePtr<EVP_PKEY> pkey, OffloadThreadPool& pool);
+  ~OffloadPrivateKeyConnection() { *alive_ = false; }
+
+  bssl::UniquePtr<EVP_PKEY> getPrivateKey() { return bssl::UpRef(pkey_); }
+  void offload(OffloadContextSharedPtr context);
+
+  Event::Dispatcher& dispatcher_;
+  Ssl::PrivateKeyConnectionCallbacks& cb_;
+  OffloadContextSharedPtr context_{};
+  // Cleared on destruction so that an in-flight completion, which runs on the
+  // same worker thread, does not invoke callbacks of an unregistered
+  // connection.
+  std::shared_ptr<bool> alive_;
+
+private:
+  OffloadThreadPool& pool_;
+  bssl::UniquePtr<EVP_PKEY> pkey_;
+};
+
+// OffloadPrivateKeyMethodProvider handles the private key method operations
+// for an SSL socket, shipping the CPU-heavy work to the handshake thread pool.
+class OffloadPrivateKeyMethodProvider : public virtual Ssl::PrivateKeyMethodProvider,
+                                        public Logger::Loggable<Logger::Id::connection> {
+public:
+  OffloadPrivateKeyMethodProvider(
+      const envoy::extensions::private_key_providers::offload::v3::OffloadPrivateKeyMethodConfig&
+          config,
+      Server::Configuration::TransportSocketFactoryContext& factory_context);
+
+  // Ssl::PrivateKeyMethodProvider
+  void registerPrivateKeyMethod(SSL* ssl, Ssl::PrivateKeyConnectionCallbacks& cb,
+                                Event::Dispatcher& dispatcher) override;
+  void unregisterPrivateKeyMethod(SSL* ssl) override;
+  bool checkFips() override;
+  Ssl::BoringSslPrivateKeyMethodSharedPtr getBoringSslPrivateKeyMethod() override;
+
+  static int connectionIndex();
+
+private:
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method_{};
+  bssl::UniquePtr<EVP_PKEY> pkey_;
+  std::unique_ptr<OffloadThreadPool> thread_pool_;
+};
+
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
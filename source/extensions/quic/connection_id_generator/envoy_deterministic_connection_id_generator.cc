@@ -64,9 +64,16 @@ EnvoyDeterministicConnectionIdGeneratorFactory::createCompatibleLinuxBpfSocketOp
       {0x05, 0, 0, 0x00000001}, //                   ja return
       {0x20, 0, 0,              // packet_too_short: ld rxhash
        static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_RXHASH)},
-      {0x94, 0, 0, concurrency}, // return:         mod #socket_count
-      {0x16, 0, 0, 0000000000},  //                 ret a
   };
+  if ((concurrency & (concurrency - 1)) == 0) {
+    // Concurrency is a power of two (the common case, since the default is the number of
+    // hardware threads): mask instead of the division below, which the kernel would
+    // otherwise run for every received packet.
+    filter_.push_back({0x54, 0, 0, concurrency - 1}); // return: and #socket_count - 1
+  } else {
+    filter_.push_back({0x94, 0, 0, concurrency}); //     return: mod #socket_count
+  }
+  filter_.push_back({0x16, 0, 0, 0000000000}); //                ret a
   // SPELLCHECKER(on)
 
   // Note that this option refers to the BPF program data above, which must live until the
@@ -60,14 +60,17 @@ void UdpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   Writer& writer = tls_->getTyped<Writer>();
   Buffer::OwnedImpl buffer;
 
-  for (const auto& counter : snapshot.counters()) {
+  // Only metrics that changed since the previous flush are re-serialized; the
+  // server periodically produces a full-sync snapshot so any missed datagrams
+  // are repaired.
+  for (const auto& counter : snapshot.changedCounters()) {
     if (counter.counter_.get().used()) {
       const std::string counter_str = buildMessage(counter.counter_.get(), counter.delta_, "|c");
       writeBuffer(buffer, writer, counter_str);
     }
   }
 
-  for (const auto& gauge : snapshot.gauges()) {
+  for (const auto& gauge : snapshot.changedGauges()) {
     if (gauge.get().used()) {
       const std::string gauge_str = buildMessage(gauge.get(), gauge.get().value(), "|g");
       writeBuffer(buffer, writer, gauge_str);
@@ -195,13 +198,15 @@ TcpStatsdSink::TcpStatsdSink(const LocalInfo::LocalInfo& local_info,
 void TcpStatsdSink::flush(Stats::MetricSnapshot& snapshot) {
   TlsSink& tls_sink = tls_->getTyped<TlsSink>();
   tls_sink.beginFlush(true);
-  for (const auto& counter : snapshot.counters()) {
+  // See UdpStatsdSink::flush: unchanged metrics are skipped between the
+  // server's periodic full-sync snapshots.
+  for (const auto& counter : snapshot.changedCounters()) {
     if (counter.counter_.get().used()) {
       tls_sink.flushCounter(counter.counter_.get().name(), counter.delta_);
     }
   }
 
-  for (const auto& gauge : snapshot.gauges()) {
+  for (const auto& gauge : snapshot.changedGauges()) {
     if (gauge.get().used()) {
       tls_sink.flushGauge(gauge.get().name(), gauge.get().value());
     }
@@ -49,7 +49,9 @@ void Span::finishSpan() {
   span_.set_end_time_unix_nano(
       std::chrono::nanoseconds(time_source_.systemTime().time_since_epoch()).count());
   if (sampled()) {
-    parent_tracer_.sendSpan(span_);
+    // The span is done at this point; hand the proto off to the tracer's buffer rather than
+    // copying it.
+    parent_tracer_.sendSpan(std::move(span_));
   }
 }
 
@@ -81,14 +83,9 @@ void Span::setTag(absl::string_view name, absl::string_view value) {
     }
   }
   // If we haven't found an existing match already, we can add a new key/value.
-  opentelemetry::proto::common::v1::KeyValue key_value =
-      opentelemetry::proto::common::v1::KeyValue();
-  opentelemetry::proto::common::v1::AnyValue value_proto =
-      opentelemetry::proto::common::v1::AnyValue();
-  value_proto.set_string_value(std::string{value});
-  key_value.set_key(std::string{name});
-  *key_value.mutable_value() = value_proto;
-  *span_.add_attributes() = key_value;
+  opentelemetry::proto::common::v1::KeyValue* key_value = span_.add_attributes();
+  key_value->set_key(std::string{name});
+  key_value->mutable_value()->set_string_value(std::string{value});
 }
 
 Tracer::Tracer(OpenTelemetryGrpcTraceExporterPtr exporter, Envoy::TimeSource& time_source,
@@ -118,17 +115,15 @@ void Tracer::flushSpans() {
   ExportTraceServiceRequest request;
   // A request consists of ResourceSpans.
   ::opentelemetry::proto::trace::v1::ResourceSpans* resource_span = request.add_resource_spans();
-  opentelemetry::proto::common::v1::KeyValue key_value =
-      opentelemetry::proto::common::v1::KeyValue();
-  opentelemetry::proto::common::v1::AnyValue value_proto =
-      opentelemetry::proto::common::v1::AnyValue();
-  value_proto.set_string_value(std::string{service_name_});
-  key_value.set_key(std::string{kServiceNameKey});
-  *key_value.mutable_value() = value_proto;
-  (*resource_span->mutable_resource()->add_attributes()) = key_value;
+  opentelemetry::proto::common::v1::KeyValue* key_value =
+      resource_span->mutable_resource()->add_attributes();
+  key_value->set_key(std::string{kServiceNameKey});
+  key_value->mutable_value()->set_string_value(service_name_);
   ::opentelemetry::proto::trace::v1::ScopeSpans* scope_span = resource_span->add_scope_spans();
-  for (const auto& pending_span : span_buffer_) {
-    (*scope_span->add_spans()) = pending_span;
+  // Move the buffered spans into the request so the spans are serialized at most once.
+  scope_span->mutable_spans()->Reserve(span_buffer_.size());
+  for (auto& pending_span : span_buffer_) {
+    *scope_span->add_spans() = std::move(pending_span);
   }
   if (exporter_) {
     tracing_stats_.spans_sent_.add(span_buffer_.size());
@@ -142,8 +137,8 @@ void Tracer::flushSpans() {
   span_buffer_.clear();
 }
 
-void Tracer::sendSpan(::opentelemetry::proto::trace::v1::Span& span) {
-  span_buffer_.push_back(span);
+void Tracer::sendSpan(::opentelemetry::proto::trace::v1::Span&& span) {
+  span_buffer_.push_back(std::move(span));
   const uint64_t min_flush_spans =
       runtime_.snapshot().getInteger("tracing.opentelemetry.min_flush_spans", 5U);
   if (span_buffer_.size() >= min_flush_spans) {
@@ -155,35 +150,33 @@ Tracing::SpanPtr Tracer::startSpan(const Tracing::Config& config, const std::str
                                    SystemTime start_time,
                                    const Tracing::Decision tracing_decision) {
   // Create an Tracers::OpenTelemetry::Span class that will contain the OTel span.
-  Span new_span = Span(config, operation_name, start_time, time_source_, *this);
-  new_span.setSampled(tracing_decision.traced);
+  auto new_span = std::make_unique<Span>(config, operation_name, start_time, time_source_, *this);
+  new_span->setSampled(tracing_decision.traced);
   uint64_t trace_id_high = random_.random();
   uint64_t trace_id = random_.random();
-  new_span.setTraceId(absl::StrCat(Hex::uint64ToHex(trace_id_high), Hex::uint64ToHex(trace_id)));
+  new_span->setTraceId(absl::StrCat(Hex::uint64ToHex(trace_id_high), Hex::uint64ToHex(trace_id)));
   uint64_t span_id = random_.random();
-  new_span.setId(Hex::uint64ToHex(span_id));
-  return std::make_unique<Span>(new_span);
+  new_span->setId(Hex::uint64ToHex(span_id));
+  return new_span;
 }
 
 Tracing::SpanPtr Tracer::startSpan(const Tracing::Config& config, const std::string& operation_name,
                                    SystemTime start_time,
                                    const SpanContext& previous_span_context) {
   // Create a new span and populate details from the span context.
-  Span new_span = Span(config, operation_name, start_time, time_source_, *this);
-  new_span.setSampled(previous_span_context.sampled());
-  new_span.setTraceId(previous_span_context.traceId());
+  auto new_span = std::make_unique<Span>(config, operation_name, start_time, time_source_, *this);
+  new_span->setSampled(previous_span_context.sampled());
+  new_span->setTraceId(previous_span_context.traceId());
   if (!previous_span_context.parentId().empty()) {
-    new_span.setParentId(previous_span_context.parentId());
+    new_span->setParentId(previous_span_context.parentId());
   }
   // Generate a new identifier for the span id.
   uint64_t span_id = random_.random();
-  new_span.setId(Hex::uint64ToHex(span_id));
-  // Respect the previous span's sampled flag.
-  new_span.setSampled(previous_span_context.sampled());
+  new_span->setId(Hex::uint64ToHex(span_id));
   if (!previous_span_context.tracestate().empty()) {
-    new_span.setTracestate(std::string{previous_span_context.tracestate()});
+    new_span->setTracestate(std::string{previous_span_context.tracestate()});
   }
-  return std::make_unique<Span>(new_span);
+  return new_span;
 }
 
 } // namespace OpenTelemetry
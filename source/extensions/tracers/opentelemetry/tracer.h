@@ -37,7 +37,7 @@ public:
          Random::RandomGenerator& random, Runtime::Loader& runtime, Event::Dispatcher& dispatcher,
          OpenTelemetryTracerStats tracing_stats, const std::string& service_name);
 
-  void sendSpan(::opentelemetry::proto::trace::v1::Span& span);
+  void sendSpan(::opentelemetry::proto::trace::v1::Span&& span);
 
   Tracing::SpanPtr startSpan(const Tracing::Config& config, const std::string& operation_name,
                              SystemTime start_time, const Tracing::Decision tracing_decision);
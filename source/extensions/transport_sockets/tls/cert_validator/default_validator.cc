@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <deque>
 #include <functional>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,6 +18,7 @@
 #include "source/common/common/base64.h"
 #include "source/common/common/fmt.h"
 #include "source/common/common/hex.h"
+#include "source/common/common/macros.h"
 #include "source/common/common/matchers.h"
 #include "source/common/common/utility.h"
 #include "source/common/config/utility.h"
@@ -40,6 +42,63 @@ namespace Extensions {
 namespace TransportSockets {
 namespace Tls {
 
+namespace {
+
+// A small process-wide cache of parsed CA bundles. When one SDS validation context is
+// shared by many clusters, a CA rotation rebuilds every referencing SSL context on the
+// main thread back to back; all rebuilds after the first reuse the parsed bundle (the
+// X509 objects are refcounted) instead of re-parsing the same PEM per cluster.
+class CaCertBundleCache {
+public:
+  using Bundle = std::shared_ptr<STACK_OF(X509_INFO)>;
+
+  static CaCertBundleCache& singleton() { MUTABLE_CONSTRUCT_ON_FIRST_USE(CaCertBundleCache); }
+
+  /**
+   * @return the parsed bundle for the given PEM content, or nullptr if it does not parse.
+   *         Parse failures are not cached.
+   */
+  Bundle get(const std::string& pem) {
+    {
+      absl::MutexLock l(&mutex_);
+      for (const Entry& entry : entries_) {
+        if (entry.pem_ == pem) {
+          return entry.bundle_;
+        }
+      }
+    }
+    bssl::UniquePtr<BIO> bio(BIO_new_mem_buf(const_cast<char*>(pem.data()), pem.size()));
+    RELEASE_ASSERT(bio != nullptr, "");
+    // Based on BoringSSL's X509_load_cert_crl_file().
+    Bundle bundle(PEM_X509_INFO_read_bio(bio.get(), nullptr, nullptr, nullptr),
+                  [](STACK_OF(X509_INFO)* list) { sk_X509_INFO_pop_free(list, X509_INFO_free); });
+    if (bundle == nullptr) {
+      return nullptr;
+    }
+    absl::MutexLock l(&mutex_);
+    if (entries_.size() == MaxEntries) {
+      entries_.pop_back();
+    }
+    entries_.insert(entries_.begin(), Entry{pem, bundle});
+    return bundle;
+  }
+
+private:
+  struct Entry {
+    std::string pem_;
+    Bundle bundle_;
+  };
+
+  // Only the bundles from the most recent rotations are useful; a rotation touches all
+  // referencing contexts consecutively, so a few entries give a near-perfect hit rate.
+  static constexpr size_t MaxEntries = 8;
+
+  absl::Mutex mutex_;
+  std::vector<Entry> entries_ ABSL_GUARDED_BY(mutex_);
+};
+
+} // namespace
+
 DefaultCertValidator::DefaultCertValidator(
     const Envoy::Ssl::CertificateValidationContextConfig* config, SslStats& stats,
     TimeSource& time_source)
@@ -70,12 +129,7 @@ int DefaultCertValidator::initializeSslContexts(std::vector<SSL_CTX*> contexts,
 
   if (config_ != nullptr && !config_->caCert().empty() && !provides_certificates) {
     ca_file_path_ = config_->caCertPath();
-    bssl::UniquePtr<BIO> bio(
-        BIO_new_mem_buf(const_cast<char*>(config_->caCert().data()), config_->caCert().size()));
-    RELEASE_ASSERT(bio != nullptr, "");
-    // Based on BoringSSL's X509_load_cert_crl_file().
-    bssl::UniquePtr<STACK_OF(X509_INFO)> list(
-        PEM_X509_INFO_read_bio(bio.get(), nullptr, nullptr, nullptr));
+    const CaCertBundleCache::Bundle list = CaCertBundleCache::singleton().get(config_->caCert());
     if (list == nullptr) {
       throw EnvoyException(
           absl::StrCat("Failed to load trusted CA certificates from ", config_->caCertPath()));
@@ -27,6 +27,7 @@
 #include "source/common/runtime/runtime_features.h"
 #include "source/common/stats/utility.h"
 #include "source/extensions/transport_sockets/tls/cert_validator/factory.h"
+#include "source/extensions/transport_sockets/tls/server_session_cache.h"
 #include "source/extensions/transport_sockets/tls/stats.h"
 #include "source/extensions/transport_sockets/tls/utility.h"
 
@@ -657,7 +658,7 @@ ClientContextImpl::ClientContextImpl(Stats::Scope& scope,
               static_cast<ContextImpl*>(SSL_CTX_get_app_data(SSL_get_SSL_CTX(ssl)));
           ClientContextImpl* client_context_impl = dynamic_cast<ClientContextImpl*>(context_impl);
           RELEASE_ASSERT(client_context_impl != nullptr, ""); // for Coverity
-          return client_context_impl->newSessionKey(session);
+          return client_context_impl->newSessionKey(ssl, session);
         });
   }
 }
@@ -717,23 +718,25 @@ ClientContextImpl::newSsl(const Network::TransportSocketOptionsConstSharedPtr& o
     if (session_keys_single_use_) {
       // Stored single-use session keys, use write/write locks.
       absl::WriterMutexLock l(&session_keys_mu_);
-      if (!session_keys_.empty()) {
+      const auto it = session_keys_.find(server_name_indication);
+      if (it != session_keys_.end() && !it->second.empty()) {
         // Use the most recently stored session key, since it has the highest
         // probability of still being recognized/accepted by the server.
-        SSL_SESSION* session = session_keys_.front().get();
+        SSL_SESSION* session = it->second.front().get();
         SSL_set_session(ssl_con.get(), session);
         // Remove single-use session key (TLS 1.3) after first use.
         if (SSL_SESSION_should_be_single_use(session)) {
-          session_keys_.pop_front();
+          it->second.pop_front();
         }
       }
     } else {
       // Never stored single-use session keys, use read/write locks.
       absl::ReaderMutexLock l(&session_keys_mu_);
-      if (!session_keys_.empty()) {
+      const auto it = session_keys_.find(server_name_indication);
+      if (it != session_keys_.end() && !it->second.empty()) {
         // Use the most recently stored session key, since it has the highest
         // probability of still being recognized/accepted by the server.
-        SSL_SESSION* session = session_keys_.front().get();
+        SSL_SESSION* session = it->second.front().get();
         SSL_set_session(ssl_con.get(), session);
       }
     }
@@ -742,19 +745,29 @@ ClientContextImpl::newSsl(const Network::TransportSocketOptionsConstSharedPtr& o
   return ssl_con;
 }
 
-int ClientContextImpl::newSessionKey(SSL_SESSION* session) {
+int ClientContextImpl::newSessionKey(SSL* ssl, SSL_SESSION* session) {
   // In case we ever store single-use session key (TLS 1.3),
   // we need to switch to using write/write locks.
   if (SSL_SESSION_should_be_single_use(session)) {
     session_keys_single_use_ = true;
   }
+  // Cache the session under the SNI it was established for; newSsl() resolves the same SNI
+  // (configured or auto_sni override) when offering sessions for resumption.
+  const char* hostname = SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+  const std::string sni = hostname != nullptr ? hostname : "";
   absl::WriterMutexLock l(&session_keys_mu_);
+  if (session_keys_.size() >= MaxSessionKeySnis && !session_keys_.contains(sni)) {
+    // Bound the number of tracked SNIs; evicting an arbitrary entry is fine since a lost
+    // session key only costs one full handshake.
+    session_keys_.erase(session_keys_.begin());
+  }
+  auto& keys = session_keys_[sni];
   // Evict oldest entries.
-  while (session_keys_.size() >= max_session_keys_) {
-    session_keys_.pop_back();
+  while (keys.size() >= max_session_keys_) {
+    keys.pop_back();
   }
   // Add new session key at the front of the queue, so that it's used first.
-  session_keys_.push_front(bssl::UniquePtr<SSL_SESSION>(session));
+  keys.push_front(bssl::UniquePtr<SSL_SESSION>(session));
   return 1; // Tell BoringSSL that we took ownership of the session.
 }
 
@@ -773,6 +786,11 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
     if (ctx.cert_chain_ == nullptr) {
       continue;
     }
+    if (ctx.is_ecdsa_) {
+      ecdsa_contexts_.emplace_back(ctx);
+    } else {
+      rsa_contexts_.emplace_back(ctx);
+    }
     bssl::UniquePtr<EVP_PKEY> public_key(X509_get_pubkey(ctx.cert_chain_.get()));
     const int pkey_id = EVP_PKEY_id(public_key.get());
     // Load DNS SAN entries and Subject Common Name as server name patterns after certificate
@@ -841,6 +859,29 @@ ServerContextImpl::ServerContextImpl(Stats::Scope& scope,
       SSL_CTX_set_timeout(ctx.ssl_ctx_.get(), uint32_t(timeout));
     }
 
+    if (!config.capabilities().handles_session_resumption) {
+      // Replace BoringSSL's internal session cache, which serializes every lookup and
+      // store from all workers behind a single SSL_CTX lock, with the process-wide
+      // sharded cache. Sessions stored there also survive re-creation of this context.
+      SSL_CTX_set_session_cache_mode(ctx.ssl_ctx_.get(),
+                                     SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_NO_INTERNAL);
+      SSL_CTX_sess_set_new_cb(ctx.ssl_ctx_.get(), [](SSL*, SSL_SESSION* session) -> int {
+        return ServerSessionCache::singleton().store(session);
+      });
+      SSL_CTX_sess_set_get_cb(
+          ctx.ssl_ctx_.get(),
+          [](SSL*, const uint8_t* id, int id_len, int* out_copy) -> SSL_SESSION* {
+            // Ownership of the returned reference transfers to the caller.
+            *out_copy = 0;
+            return ServerSessionCache::singleton()
+                .find({reinterpret_cast<const char*>(id), static_cast<size_t>(id_len)})
+                .release();
+          });
+      SSL_CTX_sess_set_remove_cb(ctx.ssl_ctx_.get(), [](SSL_CTX*, SSL_SESSION* session) {
+        ServerSessionCache::singleton().remove(session);
+      });
+    }
+
     int rc =
         SSL_CTX_set_session_id_context(ctx.ssl_ctx_.get(), session_id.data(), session_id.size());
     RELEASE_ASSERT(rc == 1, Utility::getLastCryptoError().value_or(""));
@@ -1285,15 +1326,24 @@ ServerContextImpl::selectTlsContext(const SSL_CLIENT_HELLO* ssl_client_hello) {
     }
     tail_select(full_scan_certs_on_sni_mismatch_);
   }
-  // Full scan certs if SNI is not provided by client;
-  // Full scan certs if client provides SNI but no cert matches to it,
+  // Scan certs if SNI is not provided by client;
+  // Scan certs if client provides SNI but no cert matches to it,
   // it requires full_scan_certs_on_sni_mismatch is enabled.
   if (selected_ctx == nullptr) {
     candicate_ctx = nullptr;
-    // Skip loop when there is no cert compatible to key type
-    if (client_ecdsa_capable || (!client_ecdsa_capable && has_rsa_)) {
-      for (const auto& ctx : tls_contexts_) {
-        if (selected(ctx)) {
+    // Only scan the per-key-type index built at context load: an exact match can only come
+    // from a context of the client-compatible key type, so contexts of the other type never
+    // need to be visited. For ECDSA-capable clients the RSA index is consulted only when no
+    // usable ECDSA certificate exists, mirroring the candidate preference above.
+    for (const TlsContext& ctx : client_ecdsa_capable ? ecdsa_contexts_ : rsa_contexts_) {
+      if (selected(ctx)) {
+        break;
+      }
+    }
+    if (selected_ctx == nullptr && client_ecdsa_capable) {
+      for (const TlsContext& ctx : rsa_contexts_) {
+        selected(ctx);
+        if (candicate_ctx != nullptr) {
           break;
         }
       }
@@ -173,13 +173,21 @@ public:
   newSsl(const Network::TransportSocketOptionsConstSharedPtr& options) override;
 
 private:
-  int newSessionKey(SSL_SESSION* session);
+  int newSessionKey(SSL* ssl, SSL_SESSION* session);
+
+  // Upper bound on the number of distinct SNI values the session key cache tracks. Keeps memory
+  // bounded when auto_sni fans a single context out over many server names.
+  static constexpr size_t MaxSessionKeySnis = 256;
 
   const std::string server_name_indication_;
   const bool allow_renegotiation_;
   const size_t max_session_keys_;
   absl::Mutex session_keys_mu_;
-  std::deque<bssl::UniquePtr<SSL_SESSION>> session_keys_ ABSL_GUARDED_BY(session_keys_mu_);
+  // Session keys are cached per SNI: a TLS session only resumes against the server it was
+  // established with, so with auto_sni a single shared queue would thrash across server names
+  // and offer sessions the peer cannot accept.
+  absl::flat_hash_map<std::string, std::deque<bssl::UniquePtr<SSL_SESSION>>>
+      session_keys_ ABSL_GUARDED_BY(session_keys_mu_);
   bool session_keys_single_use_{false};
 };
 
@@ -221,6 +229,11 @@ private:
   const std::vector<Envoy::Ssl::ServerContextConfig::SessionTicketKey> session_ticket_keys_;
   const Ssl::ServerContextConfig::OcspStaplePolicy ocsp_staple_policy_;
   ServerNamesMap server_names_map_;
+  // Per-key-type views of tls_contexts_, in configuration order, built at context load so
+  // that handshakes without a usable SNI match only scan contexts of a key type the client
+  // can use instead of every configured certificate.
+  std::vector<std::reference_wrapper<const TlsContext>> ecdsa_contexts_;
+  std::vector<std::reference_wrapper<const TlsContext>> rsa_contexts_;
   bool has_rsa_;
   bool full_scan_certs_on_sni_mismatch_;
 };
@@ -0,0 +1,98 @@
+#include "source/extensions/transport_sockets/tls/ktls.h"
+
+#include <cstring>
+
+#include "absl/strings/str_cat.h"
+#include "openssl/hkdf.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+bool kernelTlsVersionAndCipherSupported(int version, uint32_t cipher_id) {
+  return version == TLS1_3_VERSION && cipher_id == TLS1_3_CK_AES_128_GCM_SHA256;
+}
+
+#if defined(__linux__) && defined(TLS_1_3_VERSION)
+
+bool hkdfExpandLabel(const EVP_MD* digest, absl::Span<const uint8_t> secret,
+                     absl::string_view label, uint8_t* out, size_t out_len) {
+  const std::string full_label = absl::StrCat("tls13 ", label);
+  std::vector<uint8_t> hkdf_label;
+  hkdf_label.push_back(static_cast<uint8_t>(out_len >> 8));
+  hkdf_label.push_back(static_cast<uint8_t>(out_len & 0xff));
+  hkdf_label.push_back(static_cast<uint8_t>(full_label.size()));
+  hkdf_label.insert(hkdf_label.end(), full_label.begin(), full_label.end());
+  hkdf_label.push_back(0);
+  return HKDF_expand(out, out_len, digest, secret.data(), secret.size(), hkdf_label.data(),
+                     hkdf_label.size()) == 1;
+}
+
+bool makeCryptoInfo(tls12_crypto_info_aes_gcm_128& crypto_info, absl::Span<const uint8_t> secret,
+                    uint64_t sequence) {
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  crypto_info.info.version = TLS_1_3_VERSION;
+  crypto_info.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+
+  uint8_t iv[TLS_CIPHER_AES_GCM_128_SALT_SIZE + TLS_CIPHER_AES_GCM_128_IV_SIZE];
+  if (!hkdfExpandLabel(EVP_sha256(), secret, "key", crypto_info.key,
+                       TLS_CIPHER_AES_GCM_128_KEY_SIZE) ||
+      !hkdfExpandLabel(EVP_sha256(), secret, "iv", iv, sizeof(iv))) {
+    return false;
+  }
+  memcpy(crypto_info.salt, iv, TLS_CIPHER_AES_GCM_128_SALT_SIZE);
+  memcpy(crypto_info.iv, iv + TLS_CIPHER_AES_GCM_128_SALT_SIZE, TLS_CIPHER_AES_GCM_128_IV_SIZE);
+  for (size_t i = 0; i < TLS_CIPHER_AES_GCM_128_REC_SEQ_SIZE; i++) {
+    crypto_info.rec_seq[i] = static_cast<uint8_t>(sequence >> (8 * (7 - i)));
+  }
+  return true;
+}
+
+KernelTlsStatus tryEnableKernelTls(SSL* ssl, Network::IoHandle& io_handle) {
+  KernelTlsStatus status;
+  const SSL_CIPHER* cipher = SSL_get_current_cipher(ssl);
+  if (cipher == nullptr ||
+      !kernelTlsVersionAndCipherSupported(SSL_version(ssl), SSL_CIPHER_get_id(cipher))) {
+    return status;
+  }
+
+  bssl::Span<const uint8_t> read_secret;
+  bssl::Span<const uint8_t> write_secret;
+  if (!SSL_get_traffic_secrets(ssl, &read_secret, &write_secret)) {
+    return status;
+  }
+
+  // Attach the tls upper layer protocol to the socket; EEXIST means another component already
+  // did so, which is fine.
+  const Api::SysCallIntResult ulp_result =
+      io_handle.setOption(IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls"));
+  if (ulp_result.return_value_ != 0 && ulp_result.errno_ != EEXIST) {
+    return status;
+  }
+
+  tls12_crypto_info_aes_gcm_128 crypto_info;
+  if (makeCryptoInfo(crypto_info, {write_secret.data(), write_secret.size()},
+                     SSL_get_write_sequence(ssl)) &&
+      io_handle.setOption(SOL_TLS, TLS_TX, &crypto_info, sizeof(crypto_info)).return_value_ == 0) {
+    status.tx_enabled_ = true;
+  }
+  if (makeCryptoInfo(crypto_info, {read_secret.data(), read_secret.size()},
+                     SSL_get_read_sequence(ssl)) &&
+      io_handle.setOption(SOL_TLS, TLS_RX, &crypto_info, sizeof(crypto_info)).return_value_ == 0) {
+    status.rx_enabled_ = true;
+  }
+  memset(&crypto_info, 0, sizeof(crypto_info));
+  return status;
+}
+
+#else
+
+KernelTlsStatus tryEnableKernelTls(SSL*, Network::IoHandle&) { return {}; }
+
+#endif // defined(__linux__) && defined(TLS_1_3_VERSION)
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "envoy/network/io_handle.h"
+
+#include "absl/strings/string_view.h"
+#include "absl/types/span.h"
+#include "openssl/ssl.h"
+
+#if defined(__linux__)
+#include <linux/tls.h>
+#include <netinet/tcp.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS 282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP 31
+#endif
+#endif // defined(__linux__)
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+/**
+ * Outcome of a kernel TLS offload attempt; each direction can succeed independently.
+ */
+struct KernelTlsStatus {
+  bool tx_enabled_{false};
+  bool rx_enabled_{false};
+};
+
+/**
+ * Attempts to install the connection's TLS traffic keys into the kernel via
+ * setsockopt(TLS_TX/TLS_RX), so record framing and AEAD are performed by the kernel and the
+ * socket can subsequently be driven with plain writev/readv (enabling sendfile/splice style
+ * paths). Supported only on Linux with the tls ULP available, for TLS 1.3 with
+ * TLS_AES_128_GCM_SHA256; every other combination returns with both directions disabled and
+ * the userspace record path stays in effect.
+ *
+ * Must be called directly after handshake completion, before any application data has been
+ * read or written, so the record sequence numbers handed to the kernel are current.
+ */
+KernelTlsStatus tryEnableKernelTls(SSL* ssl, Network::IoHandle& io_handle);
+
+/**
+ * True if the negotiated protocol version and cipher suite are offloadable. Exposed for testing.
+ */
+bool kernelTlsVersionAndCipherSupported(int version, uint32_t cipher_id);
+
+#if defined(__linux__) && defined(TLS_1_3_VERSION)
+
+/**
+ * HKDF-Expand-Label from RFC 8446 section 7.1, with the "tls13 " label prefix and an empty
+ * context, as used to derive the per-direction record key and IV from a traffic secret.
+ * Exposed for testing.
+ */
+bool hkdfExpandLabel(const EVP_MD* digest, absl::Span<const uint8_t> secret,
+                     absl::string_view label, uint8_t* out, size_t out_len);
+
+/**
+ * Fills in the kernel crypto descriptor for one direction. The TLS 1.3 per-record nonce is
+ * the 12-byte IV XORed with the sequence number; the kernel splits it into a 4-byte salt and
+ * an 8-byte IV field. Exposed for testing.
+ */
+bool makeCryptoInfo(tls12_crypto_info_aes_gcm_128& crypto_info, absl::Span<const uint8_t> secret,
+                    uint64_t sequence);
+
+#endif // defined(__linux__) && defined(TLS_1_3_VERSION)
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,94 @@
+#include "source/extensions/transport_sockets/tls/server_session_cache.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/common/macros.h"
+
+#include "absl/hash/hash.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+namespace {
+
+absl::string_view sessionId(SSL_SESSION* session) {
+  unsigned int id_len;
+  const uint8_t* id = SSL_SESSION_get_id(session, &id_len);
+  return {reinterpret_cast<const char*>(id), id_len};
+}
+
+bool sessionExpired(const SSL_SESSION* session, uint64_t now) {
+  return SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session) < now;
+}
+
+} // namespace
+
+ServerSessionCache& ServerSessionCache::singleton() {
+  MUTABLE_CONSTRUCT_ON_FIRST_USE(ServerSessionCache);
+}
+
+ServerSessionCache::Shard& ServerSessionCache::shardFor(absl::string_view session_id) {
+  static_assert((NumShards & (NumShards - 1)) == 0, "shard count must be a power of two");
+  return shards_[absl::HashOf(session_id) & (NumShards - 1)];
+}
+
+int ServerSessionCache::store(SSL_SESSION* session) {
+  const absl::string_view id = sessionId(session);
+  if (id.empty()) {
+    return 0;
+  }
+  Shard& shard = shardFor(id);
+  absl::WriterMutexLock l(&shard.mutex_);
+  auto it = shard.sessions_.find(id);
+  if (it != shard.sessions_.end()) {
+    // Re-keyed session; replace in place without growing the eviction queue.
+    it->second.reset(session);
+    return 1;
+  }
+  if (shard.sessions_.size() >= MaxSessionsPerShard) {
+    // Reap expired sessions first; fall back to evicting in insertion order.
+    const uint64_t now = SSL_SESSION_get_time(session);
+    absl::erase_if(shard.sessions_, [now](const auto& entry) {
+      return sessionExpired(entry.second.get(), now);
+    });
+    while (shard.sessions_.size() >= MaxSessionsPerShard && !shard.eviction_queue_.empty()) {
+      shard.sessions_.erase(shard.eviction_queue_.front());
+      shard.eviction_queue_.pop_front();
+    }
+  }
+  shard.eviction_queue_.emplace_back(id);
+  shard.sessions_.emplace(std::string(id), bssl::UniquePtr<SSL_SESSION>(session));
+  return 1;
+}
+
+bssl::UniquePtr<SSL_SESSION> ServerSessionCache::find(absl::string_view session_id) {
+  Shard& shard = shardFor(session_id);
+  absl::ReaderMutexLock l(&shard.mutex_);
+  auto it = shard.sessions_.find(session_id);
+  if (it == shard.sessions_.end()) {
+    return nullptr;
+  }
+  SSL_SESSION_up_ref(it->second.get());
+  return bssl::UniquePtr<SSL_SESSION>(it->second.get());
+}
+
+void ServerSessionCache::remove(SSL_SESSION* session) {
+  const absl::string_view id = sessionId(session);
+  if (id.empty()) {
+    return;
+  }
+  Shard& shard = shardFor(id);
+  absl::WriterMutexLock l(&shard.mutex_);
+  auto it = shard.sessions_.find(id);
+  // Only drop the entry if it is the same session object; a session with this ID
+  // may have been re-stored since the removal was queued.
+  if (it != shard.sessions_.end() && it->second.get() == session) {
+    shard.sessions_.erase(it);
+  }
+}
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
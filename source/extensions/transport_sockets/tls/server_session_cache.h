@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <deque>
+#include <string>
+
+#include "absl/container/flat_hash_map.h"
+#include "absl/strings/string_view.h"
+#include "absl/synchronization/mutex.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+
+/**
+ * Process-wide cache of server-side TLS sessions, replacing BoringSSL's built-in
+ * per-SSL_CTX cache. The built-in cache serializes every lookup and store behind a
+ * single SSL_CTX lock, which all workers contend on; this cache shards sessions by
+ * session ID so that concurrent handshakes rarely touch the same lock, and the hit
+ * path takes only a shard reader lock. Because the cache outlives any individual
+ * ServerContextImpl, sessions also survive context re-creation (e.g. SDS certificate
+ * rotation); BoringSSL's session ID context check still prevents resumption across
+ * incompatible server configurations.
+ *
+ * Only TLS 1.2 and earlier session-ID resumption goes through this cache; TLS 1.3
+ * (and ticket-based TLS 1.2) resumption is stateless via session tickets.
+ */
+class ServerSessionCache {
+public:
+  /**
+   * @return the process-wide cache instance shared by all server contexts.
+   */
+  static ServerSessionCache& singleton();
+
+  /**
+   * Stores a new session, evicting expired or oldest entries when the owning shard
+   * is full. Matches the SSL_CTX_sess_set_new_cb() contract.
+   * @return 1 if the cache took ownership of the session's reference, 0 otherwise.
+   */
+  int store(SSL_SESSION* session);
+
+  /**
+   * Looks up a session by ID, taking only a shard reader lock. Expired entries are
+   * left in place for store() to reap; BoringSSL rejects them after the lookup.
+   * @return a new reference to the cached session, or nullptr on miss.
+   */
+  bssl::UniquePtr<SSL_SESSION> find(absl::string_view session_id);
+
+  /**
+   * Removes a session, e.g. when BoringSSL invalidates it after a fatal alert.
+   * Matches the SSL_CTX_sess_set_remove_cb() contract.
+   */
+  void remove(SSL_SESSION* session);
+
+  // Shard count trades lock granularity against fixed footprint; must be a power
+  // of two. The total capacity matches BoringSSL's internal cache default
+  // (SSL_SESSION_CACHE_MAX_SIZE_DEFAULT).
+  static constexpr size_t NumShards = 16;
+  static constexpr size_t MaxSessionsPerShard = (1024 * 20) / NumShards;
+
+private:
+  struct Shard {
+    absl::Mutex mutex_;
+    absl::flat_hash_map<std::string, bssl::UniquePtr<SSL_SESSION>>
+        sessions_ ABSL_GUARDED_BY(mutex_);
+    // Insertion order, for FIFO eviction when the shard is full. Entries removed
+    // out of band via remove() are skipped lazily at eviction time.
+    std::deque<std::string> eviction_queue_ ABSL_GUARDED_BY(mutex_);
+  };
+
+  Shard& shardFor(absl::string_view session_id);
+
+  std::array<Shard, NumShards> shards_;
+};
+
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
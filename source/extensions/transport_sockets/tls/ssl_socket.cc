@@ -8,6 +8,7 @@
 #include "source/common/http/headers.h"
 #include "source/common/runtime/runtime_features.h"
 #include "source/extensions/transport_sockets/tls/io_handle_bio.h"
+#include "source/extensions/transport_sockets/tls/ktls.h"
 #include "source/extensions/transport_sockets/tls/ssl_handshaker.h"
 #include "source/extensions/transport_sockets/tls/utility.h"
 
@@ -110,6 +111,10 @@ Network::IoResult SslSocket::doRead(Buffer::Instance& read_buffer) {
     }
   }
 
+  if (ktls_rx_) {
+    return doReadKernelTls(read_buffer);
+  }
+
   bool keep_reading = true;
   bool end_stream = false;
   PostIoAction action = PostIoAction::KeepOpen;
@@ -194,9 +199,73 @@ void SslSocket::onSuccess(SSL* ssl) {
     callbacks_->connection().streamInfo().downstreamTiming().onDownstreamHandshakeComplete(
         callbacks_->connection().dispatcher().timeSource());
   }
+  if (Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_enable_kernel_offload")) {
+    const KernelTlsStatus status = tryEnableKernelTls(ssl, callbacks_->ioHandle());
+    ktls_tx_ = status.tx_enabled_;
+    ktls_rx_ = status.rx_enabled_;
+    if (ktls_tx_ || ktls_rx_) {
+      ENVOY_CONN_LOG(debug, "kernel TLS offload enabled: tx={} rx={}", callbacks_->connection(),
+                     ktls_tx_, ktls_rx_);
+    }
+  }
   callbacks_->raiseEvent(Network::ConnectionEvent::Connected);
 }
 
+Network::IoResult SslSocket::doReadKernelTls(Buffer::Instance& read_buffer) {
+  // The kernel decrypts and strips record framing, so this mirrors the raw buffer socket read
+  // loop. Control records (alerts, post-handshake messages) surface as read errors and close
+  // the connection; we do not fall back to the userspace record path once keys are installed.
+  PostIoAction action = PostIoAction::KeepOpen;
+  uint64_t bytes_read = 0;
+  bool end_stream = false;
+  do {
+    Api::IoCallUint64Result result = callbacks_->ioHandle().read(read_buffer, absl::nullopt);
+    if (result.ok()) {
+      ENVOY_CONN_LOG(trace, "ktls read returns: {}", callbacks_->connection(),
+                     result.return_value_);
+      if (result.return_value_ == 0) {
+        end_stream = true;
+        break;
+      }
+      bytes_read += result.return_value_;
+      if (callbacks_->shouldDrainReadBuffer()) {
+        callbacks_->setTransportSocketIsReadable();
+        break;
+      }
+    } else {
+      ENVOY_CONN_LOG(trace, "ktls read error: {}", callbacks_->connection(),
+                     result.err_->getErrorDetails());
+      if (result.err_->getErrorCode() != Api::IoError::IoErrorCode::Again) {
+        action = PostIoAction::Close;
+      }
+      break;
+    }
+  } while (true);
+
+  return {action, bytes_read, end_stream};
+}
+
+Network::IoResult SslSocket::doWriteKernelTls(Buffer::Instance& write_buffer, bool end_stream) {
+  PostIoAction action = PostIoAction::KeepOpen;
+  uint64_t bytes_written = 0;
+  if (write_buffer.length() > 0) {
+    Api::IoCallUint64Result result = callbacks_->ioHandle().write(write_buffer);
+    ENVOY_CONN_LOG(trace, "ktls write returns: {}", callbacks_->connection(),
+                   result.return_value_);
+    if (result.ok()) {
+      bytes_written = result.return_value_;
+    } else if (result.err_->getErrorCode() != Api::IoError::IoErrorCode::Again) {
+      action = PostIoAction::Close;
+    }
+  }
+  if (write_buffer.length() == 0 && end_stream) {
+    // SSL_shutdown cannot frame a close_notify once the kernel owns the TX keys, so signal
+    // half-close at the TCP layer instead.
+    shutdownBasic();
+  }
+  return {action, bytes_written, false};
+}
+
 void SslSocket::onFailure() { drainErrorQueue(); }
 
 PostIoAction SslSocket::doHandshake() { return info_->doHandshake(); }
@@ -248,6 +317,10 @@ Network::IoResult SslSocket::doWrite(Buffer::Instance& write_buffer, bool end_st
     }
   }
 
+  if (ktls_tx_) {
+    return doWriteKernelTls(write_buffer, end_stream);
+  }
+
   uint64_t bytes_to_write;
   if (bytes_to_retry_) {
     bytes_to_write = bytes_to_retry_;
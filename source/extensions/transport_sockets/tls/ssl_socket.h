@@ -86,6 +86,8 @@ private:
   ReadResult sslReadIntoSlice(Buffer::RawSlice& slice);
 
   Network::PostIoAction doHandshake();
+  Network::IoResult doReadKernelTls(Buffer::Instance& read_buffer);
+  Network::IoResult doWriteKernelTls(Buffer::Instance& write_buffer, bool end_stream);
   void drainErrorQueue();
   void shutdownSsl();
   void shutdownBasic();
@@ -96,6 +98,10 @@ private:
   ContextImplSharedPtr ctx_;
   uint64_t bytes_to_retry_{};
   std::string failure_reason_;
+  // Set after the handshake when the corresponding traffic keys were installed into the kernel;
+  // the affected direction then bypasses userspace record framing entirely.
+  bool ktls_tx_{false};
+  bool ktls_rx_{false};
 
   SslHandshakerImplSharedPtr info_;
 };
@@ -33,6 +33,7 @@ ProfileAction::ProfileAction(
       duration_(
           std::chrono::milliseconds(PROTOBUF_GET_MS_OR_DEFAULT(config, profile_duration, 5000))),
       max_profiles_(config.max_profiles() == 0 ? DefaultMaxProfiles : config.max_profiles()),
+      capture_heap_sample_(config.capture_heap_sample()),
       profiles_attempted_(context.stats_.counterFromStatName(
           Stats::StatNameManagedStorage(
               absl::StrCat(context.guarddog_name_, ".profile_action.attempted"),
@@ -44,6 +45,10 @@ ProfileAction::ProfileAction(
               context.stats_.symbolTable())
               .statName())),
       context_(context), timer_cb_(context_.dispatcher_.createTimer([this] {
+        if (running_heap_profile_) {
+          Profiler::Heap::stopProfiler();
+          running_heap_profile_ = false;
+        }
         if (Profiler::Cpu::profilerEnabled()) {
           Profiler::Cpu::stopProfiler();
           running_profile_ = false;
@@ -97,6 +102,15 @@ void ProfileAction::run(
       running_profile_ = true;
       ++profiles_started_;
 
+      // Capture a heap sample over the same window, if configured and the heap profiler is both
+      // present in the build and not already in use.
+      if (capture_heap_sample_ && !Profiler::Heap::isProfilerStarted()) {
+        running_heap_profile_ = Profiler::Heap::startProfiler(profile_filename_ + ".heap");
+        if (!running_heap_profile_) {
+          ENVOY_LOG_MISC(warn, "Profile Action failed to start the heap profiler.");
+        }
+      }
+
       // Schedule callback to stop
       timer_cb_->enableTimer(duration_);
     } else {
@@ -29,7 +29,9 @@ private:
   const std::string path_;
   const std::chrono::milliseconds duration_;
   const uint64_t max_profiles_;
+  const bool capture_heap_sample_;
   bool running_profile_ = false;
+  bool running_heap_profile_ = false;
   std::string profile_filename_;
   Stats::Counter& profiles_attempted_;
   Stats::Counter& profiles_successfully_captured_;
@@ -105,11 +105,11 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
           makeHandler("/", "Admin home page", MAKE_ADMIN_HANDLER(handlerAdminHome), false, false),
           makeHandler("/certs", "print certs on machine",
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerCerts), false, false),
-          makeHandler("/clusters", "upstream cluster status",
-                      MAKE_ADMIN_HANDLER(clusters_handler_.handlerClusters), false, false),
-          makeHandler(
-              "/config_dump", "dump current Envoy configs (experimental)",
-              MAKE_ADMIN_HANDLER(config_dump_handler_.handlerConfigDump), false, false,
+          makeStreamingHandler("/clusters", "upstream cluster status", clusters_handler_, false,
+                               false),
+          makeStreamingHandler(
+              "/config_dump", "dump current Envoy configs (experimental)", config_dump_handler_,
+              false, false,
               {{Admin::ParamDescriptor::Type::String, "resource", "The resource to dump"},
                {Admin::ParamDescriptor::Type::String, "mask",
                 "The mask to apply. When both resource and mask are specified, "
@@ -166,7 +166,13 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
                        {Admin::ParamDescriptor::Type::Enum, "level", "desired logging level",
                         prepend("", LogsHandler::levelStrings())}}),
           makeHandler("/memory", "print current allocation/heap usage",
-                      MAKE_ADMIN_HANDLER(server_info_handler_.handlerMemory), false, false),
+                      MAKE_ADMIN_HANDLER(server_info_handler_.handlerMemory), false, false,
+                      {{Admin::ParamDescriptor::Type::Boolean, "detail",
+                        "print the allocator's detailed internal breakdown as plain text"}}),
+          makeHandler("/perf", "print accumulated perf-annotation data (if enabled)",
+                      MAKE_ADMIN_HANDLER(perf_annotation_handler_.handlerPerfDump), false, false),
+          makeHandler("/perf/clear", "clear accumulated perf-annotation data",
+                      MAKE_ADMIN_HANDLER(perf_annotation_handler_.handlerPerfClear), false, true),
           makeHandler("/quitquitquit", "exit the server",
                       MAKE_ADMIN_HANDLER(server_cmd_handler_.handlerQuitQuitQuit), false, true),
           makeHandler("/reset_counters", "reset all counters to zero",
@@ -187,15 +193,7 @@ AdminImpl::AdminImpl(const std::string& profile_path, Server::Instance& server,
           makeHandler("/ready", "print server state, return 200 if LIVE, otherwise return 503",
                       MAKE_ADMIN_HANDLER(server_info_handler_.handlerReady), false, false),
           stats_handler_.statsHandler(false /* not active mode */),
-          makeHandler("/stats/prometheus", "print server stats in prometheus format",
-                      MAKE_ADMIN_HANDLER(stats_handler_.handlerPrometheusStats), false, false,
-                      {{ParamDescriptor::Type::Boolean, "usedonly",
-                        "Only include stats that have been written by system since restart"},
-                       {ParamDescriptor::Type::Boolean, "text_readouts",
-                        "Render text_readouts as new gaugues with value 0 (increases Prometheus "
-                        "data size)"},
-                       {ParamDescriptor::Type::String, "filter",
-                        "Regular expression (Google re2) for filtering stats"}}),
+          stats_handler_.prometheusStatsHandler(),
           makeHandler("/stats/recentlookups", "Show recent stat-name lookups",
                       MAKE_ADMIN_HANDLER(stats_handler_.handlerStatsRecentLookups), false, false),
           makeHandler("/stats/recentlookups/clear", "clear list of stat-name lookups and counter",
@@ -253,12 +253,13 @@ private:
    */
   template <class Handler>
   UrlHandler makeStreamingHandler(const std::string& prefix, const std::string& help_text,
-                                  Handler& handler, bool removable, bool mutates_state) {
+                                  Handler& handler, bool removable, bool mutates_state,
+                                  const ParamDescriptorVec& params = {}) {
     return {prefix, help_text,
             [&handler](AdminStream& admin_stream) -> Admin::RequestPtr {
               return handler.makeRequest(admin_stream);
             },
-            removable, mutates_state};
+            removable, mutates_state, params};
   }
 
   /**
@@ -477,6 +478,7 @@ private:
   Server::LogsHandler logs_handler_;
   Server::ProfilingHandler profiling_handler_;
   Server::TcmallocProfilingHandler tcmalloc_profiling_handler_;
+  Server::PerfAnnotationHandler perf_annotation_handler_;
   Server::RuntimeHandler runtime_handler_;
   Server::ListenersHandler listeners_handler_;
   Server::ServerCmdHandler server_cmd_handler_;
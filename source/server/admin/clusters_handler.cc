@@ -38,22 +38,37 @@ void addCircuitBreakerSettingsAsJson(const envoy::config::core::v3::RoutingPrior
   thresholds.mutable_max_retries()->set_value(resource_manager.retries().max());
 }
 
+void addOutlierInfo(const std::string& cluster_name,
+                    const Upstream::Outlier::Detector* outlier_detector,
+                    Buffer::Instance& response) {
+  if (outlier_detector) {
+    response.add(fmt::format(
+        "{}::outlier::success_rate_average::{:g}\n", cluster_name,
+        outlier_detector->successRateAverage(
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
+    response.add(fmt::format(
+        "{}::outlier::success_rate_ejection_threshold::{:g}\n", cluster_name,
+        outlier_detector->successRateEjectionThreshold(
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
+    response.add(fmt::format(
+        "{}::outlier::local_origin_success_rate_average::{:g}\n", cluster_name,
+        outlier_detector->successRateAverage(
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
+    response.add(fmt::format(
+        "{}::outlier::local_origin_success_rate_ejection_threshold::{:g}\n", cluster_name,
+        outlier_detector->successRateEjectionThreshold(
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
+  }
+}
+
 } // namespace
 
 ClustersHandler::ClustersHandler(Server::Instance& server) : HandlerContextBase(server) {}
 
-Http::Code ClustersHandler::handlerClusters(Http::ResponseHeaderMap& response_headers,
-                                            Buffer::Instance& response, AdminStream& admin_stream) {
+Admin::RequestPtr ClustersHandler::makeRequest(AdminStream& admin_stream) {
   const auto format_value = Utility::formatParam(admin_stream.queryParams());
-
-  if (format_value.has_value() && format_value.value() == "json") {
-    writeClustersAsJson(response);
-    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
-  } else {
-    writeClustersAsText(response);
-  }
-
-  return Http::Code::OK;
+  const bool json = format_value.has_value() && format_value.value() == "json";
+  return std::make_unique<ClustersRequest>(server_, json);
 }
 
 // Helper method that ensures that we've setting flags based on all the health flag values on the
@@ -102,191 +117,203 @@ void setHealthFlag(Upstream::Host::HealthFlag flag, const Upstream::Host& host,
   }
 }
 
-// TODO(efimki): Add support of text readouts stats.
-void ClustersHandler::writeClustersAsJson(Buffer::Instance& response) {
-  envoy::admin::v3::Clusters clusters;
-  // TODO(mattklein123): Add ability to see warming clusters in admin output.
-  auto all_clusters = server_.clusterManager().clusters();
-  for (const auto& [name, cluster_ref] : all_clusters.active_clusters_) {
-    UNREFERENCED_PARAMETER(name);
-    const Upstream::Cluster& cluster = cluster_ref.get();
-    Upstream::ClusterInfoConstSharedPtr cluster_info = cluster.info();
-
-    envoy::admin::v3::ClusterStatus& cluster_status = *clusters.add_cluster_statuses();
-    cluster_status.set_name(cluster_info->name());
-    cluster_status.set_observability_name(cluster_info->observabilityName());
-    const auto& eds_service_name = cluster_info->edsServiceName();
-    if (eds_service_name.has_value()) {
-      cluster_status.set_eds_service_name(*eds_service_name);
-    }
+namespace {
 
-    addCircuitBreakerSettingsAsJson(
-        envoy::config::core::v3::RoutingPriority::DEFAULT,
-        cluster.info()->resourceManager(Upstream::ResourcePriority::Default), cluster_status);
-    addCircuitBreakerSettingsAsJson(
-        envoy::config::core::v3::RoutingPriority::HIGH,
-        cluster.info()->resourceManager(Upstream::ResourcePriority::High), cluster_status);
+// TODO(efimki): Add support of text readouts stats.
+void addClusterStatusAsJson(const Upstream::Cluster& cluster,
+                            envoy::admin::v3::ClusterStatus& cluster_status) {
+  Upstream::ClusterInfoConstSharedPtr cluster_info = cluster.info();
+
+  cluster_status.set_name(cluster_info->name());
+  cluster_status.set_observability_name(cluster_info->observabilityName());
+  const auto& eds_service_name = cluster_info->edsServiceName();
+  if (eds_service_name.has_value()) {
+    cluster_status.set_eds_service_name(*eds_service_name);
+  }
 
-    const Upstream::Outlier::Detector* outlier_detector = cluster.outlierDetector();
-    if (outlier_detector != nullptr &&
+  addCircuitBreakerSettingsAsJson(
+      envoy::config::core::v3::RoutingPriority::DEFAULT,
+      cluster.info()->resourceManager(Upstream::ResourcePriority::Default), cluster_status);
+  addCircuitBreakerSettingsAsJson(
+      envoy::config::core::v3::RoutingPriority::HIGH,
+      cluster.info()->resourceManager(Upstream::ResourcePriority::High), cluster_status);
+
+  const Upstream::Outlier::Detector* outlier_detector = cluster.outlierDetector();
+  if (outlier_detector != nullptr &&
+      outlier_detector->successRateEjectionThreshold(
+          Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin) > 0.0) {
+    cluster_status.mutable_success_rate_ejection_threshold()->set_value(
         outlier_detector->successRateEjectionThreshold(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin) > 0.0) {
-      cluster_status.mutable_success_rate_ejection_threshold()->set_value(
-          outlier_detector->successRateEjectionThreshold(
-              Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin));
-    }
-    if (outlier_detector != nullptr &&
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin));
+  }
+  if (outlier_detector != nullptr &&
+      outlier_detector->successRateEjectionThreshold(
+          Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin) > 0.0) {
+    cluster_status.mutable_local_origin_success_rate_ejection_threshold()->set_value(
         outlier_detector->successRateEjectionThreshold(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin) > 0.0) {
-      cluster_status.mutable_local_origin_success_rate_ejection_threshold()->set_value(
-          outlier_detector->successRateEjectionThreshold(
-              Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin));
-    }
+            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin));
+  }
 
-    cluster_status.set_added_via_api(cluster_info->addedViaApi());
+  cluster_status.set_added_via_api(cluster_info->addedViaApi());
 
-    for (auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
-      for (auto& host : host_set->hosts()) {
-        envoy::admin::v3::HostStatus& host_status = *cluster_status.add_host_statuses();
-        Network::Utility::addressToProtobufAddress(*host->address(),
-                                                   *host_status.mutable_address());
-        host_status.set_hostname(host->hostname());
-        host_status.mutable_locality()->MergeFrom(host->locality());
+  for (auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
+    for (auto& host : host_set->hosts()) {
+      envoy::admin::v3::HostStatus& host_status = *cluster_status.add_host_statuses();
+      Network::Utility::addressToProtobufAddress(*host->address(), *host_status.mutable_address());
+      host_status.set_hostname(host->hostname());
+      host_status.mutable_locality()->MergeFrom(host->locality());
 
-        for (const auto& [counter_name, counter] : host->counters()) {
-          auto& metric = *host_status.add_stats();
-          metric.set_name(std::string(counter_name));
-          metric.set_value(counter.get().value());
-          metric.set_type(envoy::admin::v3::SimpleMetric::COUNTER);
-        }
+      for (const auto& [counter_name, counter] : host->counters()) {
+        auto& metric = *host_status.add_stats();
+        metric.set_name(std::string(counter_name));
+        metric.set_value(counter.get().value());
+        metric.set_type(envoy::admin::v3::SimpleMetric::COUNTER);
+      }
 
-        for (const auto& [gauge_name, gauge] : host->gauges()) {
-          auto& metric = *host_status.add_stats();
-          metric.set_name(std::string(gauge_name));
-          metric.set_value(gauge.get().value());
-          metric.set_type(envoy::admin::v3::SimpleMetric::GAUGE);
-        }
+      for (const auto& [gauge_name, gauge] : host->gauges()) {
+        auto& metric = *host_status.add_stats();
+        metric.set_name(std::string(gauge_name));
+        metric.set_value(gauge.get().value());
+        metric.set_type(envoy::admin::v3::SimpleMetric::GAUGE);
+      }
 
-        envoy::admin::v3::HostHealthStatus& health_status = *host_status.mutable_health_status();
+      envoy::admin::v3::HostHealthStatus& health_status = *host_status.mutable_health_status();
 
 // Invokes setHealthFlag for each health flag.
 #define SET_HEALTH_FLAG(name, notused)                                                             \
   setHealthFlag(Upstream::Host::HealthFlag::name, *host, health_status);
-        HEALTH_FLAG_ENUM_VALUES(SET_HEALTH_FLAG)
+      HEALTH_FLAG_ENUM_VALUES(SET_HEALTH_FLAG)
 #undef SET_HEALTH_FLAG
 
-        double success_rate = host->outlierDetector().successRate(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin);
-        if (success_rate >= 0.0) {
-          host_status.mutable_success_rate()->set_value(success_rate);
-        }
+      double success_rate = host->outlierDetector().successRate(
+          Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin);
+      if (success_rate >= 0.0) {
+        host_status.mutable_success_rate()->set_value(success_rate);
+      }
 
-        host_status.set_weight(host->weight());
+      host_status.set_weight(host->weight());
 
-        host_status.set_priority(host->priority());
-        success_rate = host->outlierDetector().successRate(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin);
-        if (success_rate >= 0.0) {
-          host_status.mutable_local_origin_success_rate()->set_value(success_rate);
-        }
+      host_status.set_priority(host->priority());
+      success_rate = host->outlierDetector().successRate(
+          Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin);
+      if (success_rate >= 0.0) {
+        host_status.mutable_local_origin_success_rate()->set_value(success_rate);
       }
     }
   }
-  response.add(MessageUtil::getJsonStringFromMessageOrError(clusters, true)); // pretty-print
 }
 
 // TODO(efimki): Add support of text readouts stats.
-void ClustersHandler::writeClustersAsText(Buffer::Instance& response) {
+void addClusterInfoAsText(const Upstream::Cluster& cluster, Buffer::Instance& response) {
+  const std::string& cluster_name = cluster.info()->name();
+  response.add(fmt::format("{}::observability_name::{}\n", cluster_name,
+                           cluster.info()->observabilityName()));
+  addOutlierInfo(cluster_name, cluster.outlierDetector(), response);
+
+  addCircuitBreakerSettingsAsText(
+      cluster_name, "default", cluster.info()->resourceManager(Upstream::ResourcePriority::Default),
+      response);
+  addCircuitBreakerSettingsAsText(
+      cluster_name, "high", cluster.info()->resourceManager(Upstream::ResourcePriority::High),
+      response);
+
+  response.add(fmt::format("{}::added_via_api::{}\n", cluster_name, cluster.info()->addedViaApi()));
+  const auto& eds_service_name = cluster.info()->edsServiceName();
+  if (eds_service_name.has_value()) {
+    response.add(fmt::format("{}::eds_service_name::{}\n", cluster_name, *eds_service_name));
+  }
+  for (auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
+    for (auto& host : host_set->hosts()) {
+      const std::string& host_address = host->address()->asString();
+      std::map<absl::string_view, uint64_t> all_stats;
+      for (const auto& [counter_name, counter] : host->counters()) {
+        all_stats[counter_name] = counter.get().value();
+      }
+
+      for (const auto& [gauge_name, gauge] : host->gauges()) {
+        all_stats[gauge_name] = gauge.get().value();
+      }
+
+      for (const auto& [stat_name, stat] : all_stats) {
+        response.add(fmt::format("{}::{}::{}::{}\n", cluster_name, host_address, stat_name, stat));
+      }
+
+      response.add(
+          fmt::format("{}::{}::hostname::{}\n", cluster_name, host_address, host->hostname()));
+      response.add(fmt::format("{}::{}::health_flags::{}\n", cluster_name, host_address,
+                               Upstream::HostUtility::healthFlagsToString(*host)));
+      response.add(fmt::format("{}::{}::weight::{}\n", cluster_name, host_address, host->weight()));
+      response.add(fmt::format("{}::{}::region::{}\n", cluster_name, host_address,
+                               host->locality().region()));
+      response.add(
+          fmt::format("{}::{}::zone::{}\n", cluster_name, host_address, host->locality().zone()));
+      response.add(fmt::format("{}::{}::sub_zone::{}\n", cluster_name, host_address,
+                               host->locality().sub_zone()));
+      response.add(fmt::format("{}::{}::canary::{}\n", cluster_name, host_address, host->canary()));
+      response.add(
+          fmt::format("{}::{}::priority::{}\n", cluster_name, host_address, host->priority()));
+      response.add(fmt::format(
+          "{}::{}::success_rate::{}\n", cluster_name, host_address,
+          host->outlierDetector().successRate(
+              Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
+      response.add(fmt::format(
+          "{}::{}::local_origin_success_rate::{}\n", cluster_name, host_address,
+          host->outlierDetector().successRate(
+              Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
+    }
+  }
+}
+
+} // namespace
+
+ClustersRequest::ClustersRequest(Server::Instance& server, bool json)
+    : server_(server), json_(json) {}
+
+Http::Code ClustersRequest::start(Http::ResponseHeaderMap& response_headers) {
+  if (json_) {
+    response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
+  }
   // TODO(mattklein123): Add ability to see warming clusters in admin output.
   auto all_clusters = server_.clusterManager().clusters();
+  cluster_names_.reserve(all_clusters.active_clusters_.size());
   for (const auto& [name, cluster_ref] : all_clusters.active_clusters_) {
-    UNREFERENCED_PARAMETER(name);
-    const Upstream::Cluster& cluster = cluster_ref.get();
-    const std::string& cluster_name = cluster.info()->name();
-    response.add(fmt::format("{}::observability_name::{}\n", cluster_name,
-                             cluster.info()->observabilityName()));
-    addOutlierInfo(cluster_name, cluster.outlierDetector(), response);
-
-    addCircuitBreakerSettingsAsText(
-        cluster_name, "default",
-        cluster.info()->resourceManager(Upstream::ResourcePriority::Default), response);
-    addCircuitBreakerSettingsAsText(
-        cluster_name, "high", cluster.info()->resourceManager(Upstream::ResourcePriority::High),
-        response);
-
-    response.add(
-        fmt::format("{}::added_via_api::{}\n", cluster_name, cluster.info()->addedViaApi()));
-    const auto& eds_service_name = cluster.info()->edsServiceName();
-    if (eds_service_name.has_value()) {
-      response.add(fmt::format("{}::eds_service_name::{}\n", cluster_name, *eds_service_name));
-    }
-    for (auto& host_set : cluster.prioritySet().hostSetsPerPriority()) {
-      for (auto& host : host_set->hosts()) {
-        const std::string& host_address = host->address()->asString();
-        std::map<absl::string_view, uint64_t> all_stats;
-        for (const auto& [counter_name, counter] : host->counters()) {
-          all_stats[counter_name] = counter.get().value();
-        }
-
-        for (const auto& [gauge_name, gauge] : host->gauges()) {
-          all_stats[gauge_name] = gauge.get().value();
-        }
-
-        for (const auto& [stat_name, stat] : all_stats) {
-          response.add(
-              fmt::format("{}::{}::{}::{}\n", cluster_name, host_address, stat_name, stat));
-        }
-
-        response.add(
-            fmt::format("{}::{}::hostname::{}\n", cluster_name, host_address, host->hostname()));
-        response.add(fmt::format("{}::{}::health_flags::{}\n", cluster_name, host_address,
-                                 Upstream::HostUtility::healthFlagsToString(*host)));
-        response.add(
-            fmt::format("{}::{}::weight::{}\n", cluster_name, host_address, host->weight()));
-        response.add(fmt::format("{}::{}::region::{}\n", cluster_name, host_address,
-                                 host->locality().region()));
-        response.add(
-            fmt::format("{}::{}::zone::{}\n", cluster_name, host_address, host->locality().zone()));
-        response.add(fmt::format("{}::{}::sub_zone::{}\n", cluster_name, host_address,
-                                 host->locality().sub_zone()));
-        response.add(
-            fmt::format("{}::{}::canary::{}\n", cluster_name, host_address, host->canary()));
-        response.add(
-            fmt::format("{}::{}::priority::{}\n", cluster_name, host_address, host->priority()));
-        response.add(fmt::format(
-            "{}::{}::success_rate::{}\n", cluster_name, host_address,
-            host->outlierDetector().successRate(
-                Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
-        response.add(fmt::format(
-            "{}::{}::local_origin_success_rate::{}\n", cluster_name, host_address,
-            host->outlierDetector().successRate(
-                Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
-      }
-    }
+    UNREFERENCED_PARAMETER(cluster_ref);
+    cluster_names_.push_back(name);
   }
+  return Http::Code::OK;
 }
 
-void ClustersHandler::addOutlierInfo(const std::string& cluster_name,
-                                     const Upstream::Outlier::Detector* outlier_detector,
-                                     Buffer::Instance& response) {
-  if (outlier_detector) {
-    response.add(fmt::format(
-        "{}::outlier::success_rate_average::{:g}\n", cluster_name,
-        outlier_detector->successRateAverage(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
-    response.add(fmt::format(
-        "{}::outlier::success_rate_ejection_threshold::{:g}\n", cluster_name,
-        outlier_detector->successRateEjectionThreshold(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::ExternalOrigin)));
-    response.add(fmt::format(
-        "{}::outlier::local_origin_success_rate_average::{:g}\n", cluster_name,
-        outlier_detector->successRateAverage(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
-    response.add(fmt::format(
-        "{}::outlier::local_origin_success_rate_ejection_threshold::{:g}\n", cluster_name,
-        outlier_detector->successRateEjectionThreshold(
-            Upstream::Outlier::DetectorHostMonitor::SuccessRateMonitorType::LocalOrigin)));
+bool ClustersRequest::nextChunk(Buffer::Instance& response) {
+  const uint64_t starting_response_length = response.length();
+
+  // The references in the cluster maps are only valid until control returns to
+  // the event loop, so a fresh snapshot is taken for each chunk; clusters
+  // removed while the response is streaming out are skipped.
+  auto all_clusters = server_.clusterManager().clusters();
+  while (next_cluster_ < cluster_names_.size() &&
+         response.length() - starting_response_length < chunk_size_) {
+    auto it = all_clusters.active_clusters_.find(cluster_names_[next_cluster_++]);
+    if (it == all_clusters.active_clusters_.end()) {
+      continue;
+    }
+    const Upstream::Cluster& cluster = it->second.get();
+    if (json_) {
+      envoy::admin::v3::Clusters clusters;
+      addClusterStatusAsJson(cluster, *clusters.add_cluster_statuses());
+      json_streamer_.addElement(MessageUtil::getJsonStringFromMessageOrError(clusters, true),
+                                response); // pretty-print
+    } else {
+      addClusterInfoAsText(cluster, response);
+    }
+  }
+  if (next_cluster_ < cluster_names_.size()) {
+    return true;
+  }
+  if (json_) {
+    json_streamer_.finish(
+        MessageUtil::getJsonStringFromMessageOrError(envoy::admin::v3::Clusters(), true), response);
   }
+  return false;
 }
 
 } // namespace Server
@@ -7,6 +7,7 @@
 #include "envoy/server/instance.h"
 
 #include "source/server/admin/handler_ctx.h"
+#include "source/server/admin/utils.h"
 
 #include "absl/strings/string_view.h"
 
@@ -18,15 +19,36 @@ class ClustersHandler : public HandlerContextBase {
 public:
   ClustersHandler(Server::Instance& server);
 
-  Http::Code handlerClusters(Http::ResponseHeaderMap& response_headers, Buffer::Instance& response,
-                             AdminStream&);
+  Admin::RequestPtr makeRequest(AdminStream& admin_stream);
+};
+
+// Streams the /clusters response one cluster at a time, so that deployments
+// with very large numbers of clusters and endpoints do not have to buffer the
+// entire response in memory before any of it is written to the network.
+class ClustersRequest : public Admin::Request {
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  ClustersRequest(Server::Instance& server, bool json);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+
+  // Renders clusters until the chunk size is reached. The set of cluster names
+  // is captured in start(); clusters removed while the response is streaming
+  // out are skipped.
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size (for testing).
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
 
 private:
-  void addOutlierInfo(const std::string& cluster_name,
-                      const Upstream::Outlier::Detector* outlier_detector,
-                      Buffer::Instance& response);
-  void writeClustersAsJson(Buffer::Instance& response);
-  void writeClustersAsText(Buffer::Instance& response);
+  Server::Instance& server_;
+  const bool json_;
+  std::vector<std::string> cluster_names_;
+  uint64_t next_cluster_{0};
+  Utility::JsonArrayStreamer json_streamer_;
+  uint64_t chunk_size_{DefaultChunkSize};
 };
 
 } // namespace Server
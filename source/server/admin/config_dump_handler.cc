@@ -157,42 +157,73 @@ buildNameMatcher(const Http::Utility::QueryParams& params) {
 ConfigDumpHandler::ConfigDumpHandler(ConfigTracker& config_tracker, Server::Instance& server)
     : HandlerContextBase(server), config_tracker_(config_tracker) {}
 
-Http::Code ConfigDumpHandler::handlerConfigDump(Http::ResponseHeaderMap& response_headers,
-                                                Buffer::Instance& response,
-                                                AdminStream& admin_stream) const {
+Admin::RequestPtr ConfigDumpHandler::makeRequest(AdminStream& admin_stream) const {
   Http::Utility::QueryParams query_params = admin_stream.queryParams();
-  const auto resource = resourceParam(query_params);
-  const auto mask = maskParam(query_params);
-  const bool include_eds = shouldIncludeEdsInDump(query_params);
-  const absl::StatusOr<Matchers::StringMatcherPtr> name_matcher = buildNameMatcher(query_params);
-  if (!name_matcher.ok()) {
-    response.add(name_matcher.status().ToString());
+  return std::make_unique<ConfigDumpRequest>(*this, resourceParam(query_params),
+                                             maskParam(query_params),
+                                             buildNameMatcher(query_params),
+                                             shouldIncludeEdsInDump(query_params));
+}
+
+ConfigDumpRequest::ConfigDumpRequest(const ConfigDumpHandler& handler,
+                                     absl::optional<std::string> resource,
+                                     absl::optional<std::string> mask,
+                                     absl::StatusOr<Matchers::StringMatcherPtr> name_matcher,
+                                     bool include_eds)
+    : handler_(handler), resource_(std::move(resource)), mask_(std::move(mask)),
+      name_matcher_(std::move(name_matcher)), include_eds_(include_eds) {}
+
+Http::Code ConfigDumpRequest::start(Http::ResponseHeaderMap& response_headers) {
+  if (!name_matcher_.ok()) {
+    error_ = name_matcher_.status().ToString();
     response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
     return Http::Code::BadRequest;
   }
 
-  envoy::admin::v3::ConfigDump dump;
-
   absl::optional<std::pair<Http::Code, std::string>> err;
-  if (resource.has_value()) {
-    err = addResourceToDump(dump, mask, resource.value(), **name_matcher, include_eds);
+  if (resource_.has_value()) {
+    err = handler_.addResourceToDump(dump_, mask_, resource_.value(), **name_matcher_,
+                                     include_eds_);
   } else {
-    err = addAllConfigToDump(dump, mask, **name_matcher, include_eds);
+    err = handler_.addAllConfigToDump(dump_, mask_, **name_matcher_, include_eds_);
   }
   if (err.has_value()) {
     response_headers.addReference(Http::Headers::get().XContentTypeOptions,
                                   Http::Headers::get().XContentTypeOptionValues.Nosniff);
     response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Text);
-    response.add(err.value().second);
+    error_ = err.value().second;
     return err.value().first;
   }
-  MessageUtil::redact(dump);
+  MessageUtil::redact(dump_);
 
   response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
-  response.add(MessageUtil::getJsonStringFromMessageOrError(dump, true)); // pretty-print
   return Http::Code::OK;
 }
 
+bool ConfigDumpRequest::nextChunk(Buffer::Instance& response) {
+  if (!error_.empty()) {
+    response.add(error_);
+    return false;
+  }
+
+  const uint64_t starting_response_length = response.length();
+  while (next_config_ < dump_.configs_size() &&
+         response.length() - starting_response_length < chunk_size_) {
+    // Swap the resource into a single-element dump so its memory can be
+    // released as soon as it has been rendered.
+    envoy::admin::v3::ConfigDump single;
+    single.add_configs()->Swap(dump_.mutable_configs(next_config_++));
+    json_streamer_.addElement(MessageUtil::getJsonStringFromMessageOrError(single, true),
+                              response); // pretty-print
+  }
+  if (next_config_ < dump_.configs_size()) {
+    return true;
+  }
+  json_streamer_.finish(
+      MessageUtil::getJsonStringFromMessageOrError(envoy::admin::v3::ConfigDump(), true), response);
+  return false;
+}
+
 absl::optional<std::pair<Http::Code, std::string>> ConfigDumpHandler::addResourceToDump(
     envoy::admin::v3::ConfigDump& dump, const absl::optional<std::string>& mask,
     const std::string& resource, const Matchers::StringMatcher& name_matcher,
@@ -9,8 +9,10 @@
 #include "envoy/server/admin.h"
 #include "envoy/server/instance.h"
 
+#include "source/common/common/statusor.h"
 #include "source/server/admin/config_tracker_impl.h"
 #include "source/server/admin/handler_ctx.h"
+#include "source/server/admin/utils.h"
 
 #include "absl/strings/string_view.h"
 
@@ -22,10 +24,11 @@ class ConfigDumpHandler : public HandlerContextBase {
 public:
   ConfigDumpHandler(ConfigTracker& config_tracker, Server::Instance& server);
 
-  Http::Code handlerConfigDump(Http::ResponseHeaderMap& response_headers,
-                               Buffer::Instance& response, AdminStream&) const;
+  Admin::RequestPtr makeRequest(AdminStream& admin_stream) const;
 
 private:
+  friend class ConfigDumpRequest;
+
   absl::optional<std::pair<Http::Code, std::string>>
   addAllConfigToDump(envoy::admin::v3::ConfigDump& dump, const absl::optional<std::string>& mask,
                      const Matchers::StringMatcher& name_matcher, bool include_eds) const;
@@ -50,5 +53,41 @@ private:
   ConfigTracker& config_tracker_;
 };
 
+// Streams the /config_dump response one config resource at a time. The
+// ConfigDump proto is still assembled up front on the main thread -- the
+// config state it snapshots is only safely accessible there -- but the JSON
+// serialization, which dominates the response size, is rendered incrementally
+// so that the full rendering is never buffered in memory at once.
+class ConfigDumpRequest : public Admin::Request {
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  ConfigDumpRequest(const ConfigDumpHandler& handler, absl::optional<std::string> resource,
+                    absl::optional<std::string> mask,
+                    absl::StatusOr<Matchers::StringMatcherPtr> name_matcher, bool include_eds);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+
+  // Serializes config resources until the chunk size is reached, releasing
+  // each resource's proto once it has been rendered.
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size (for testing).
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
+
+private:
+  const ConfigDumpHandler& handler_;
+  const absl::optional<std::string> resource_;
+  const absl::optional<std::string> mask_;
+  absl::StatusOr<Matchers::StringMatcherPtr> name_matcher_;
+  const bool include_eds_;
+  envoy::admin::v3::ConfigDump dump_;
+  std::string error_;
+  int next_config_{0};
+  Utility::JsonArrayStreamer json_streamer_;
+  uint64_t chunk_size_{DefaultChunkSize};
+};
+
 } // namespace Server
 } // namespace Envoy
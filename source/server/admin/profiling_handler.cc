@@ -1,5 +1,6 @@
 #include "source/server/admin/profiling_handler.h"
 
+#include "source/common/common/perf_annotation.h"
 #include "source/common/profiler/profiler.h"
 #include "source/server/admin/utils.h"
 
@@ -91,5 +92,30 @@ Http::Code TcmallocProfilingHandler::handlerHeapDump(Http::ResponseHeaderMap&,
   return Http::Code::NotImplemented;
 }
 
+Http::Code PerfAnnotationHandler::handlerPerfDump(Http::ResponseHeaderMap&,
+                                                  Buffer::Instance& response, AdminStream&) {
+#ifdef ENVOY_PERF_ANNOTATION
+  response.add(PERF_TO_STRING());
+  return Http::Code::OK;
+#else
+  response.add("The current build does not support perf annotation; "
+               "build with --define=perf_annotation=enabled\n");
+  return Http::Code::NotImplemented;
+#endif
+}
+
+Http::Code PerfAnnotationHandler::handlerPerfClear(Http::ResponseHeaderMap&,
+                                                   Buffer::Instance& response, AdminStream&) {
+#ifdef ENVOY_PERF_ANNOTATION
+  PERF_CLEAR();
+  response.add("OK\n");
+  return Http::Code::OK;
+#else
+  response.add("The current build does not support perf annotation; "
+               "build with --define=perf_annotation=enabled\n");
+  return Http::Code::NotImplemented;
+#endif
+}
+
 } // namespace Server
 } // namespace Envoy
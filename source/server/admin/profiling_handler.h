@@ -33,5 +33,18 @@ public:
                              AdminStream&);
 };
 
+// Exposes the data collected by source/common/common/perf_annotation.h for live inspection in
+// builds made with --define=perf_annotation=enabled, without waiting for the process-exit dump.
+class PerfAnnotationHandler {
+public:
+  PerfAnnotationHandler() = default;
+
+  Http::Code handlerPerfDump(Http::ResponseHeaderMap& response_headers, Buffer::Instance& response,
+                             AdminStream&);
+
+  Http::Code handlerPerfClear(Http::ResponseHeaderMap& response_headers, Buffer::Instance& response,
+                              AdminStream&);
+};
+
 } // namespace Server
 } // namespace Envoy
@@ -158,38 +158,31 @@ uint64_t outputStatType(
   return result;
 }
 
-/*
- * Return the prometheus output for a numeric Stat (Counter or Gauge).
- */
+} // namespace
+
 template <class StatType>
-std::string generateNumericOutput(const StatType& metric,
-                                  const std::string& prefixed_tag_extracted_name) {
+std::string
+PrometheusStatsFormatter::generateNumericOutput(const StatType& metric,
+                                                const std::string& prefixed_tag_extracted_name) {
   const std::string tags = PrometheusStatsFormatter::formattedTags(metric.tags());
   return fmt::format("{0}{{{1}}} {2}\n", prefixed_tag_extracted_name, tags, metric.value());
 }
 
-/*
- * Returns the prometheus output for a TextReadout in gauge format.
- * It is a workaround of a limitation of prometheus which stores only numeric metrics.
- * The output is a gauge named the same as a given text-readout. The value of returned gauge is
- * always equal to 0. Returned gauge contains all tags of a given text-readout and one additional
- * tag {"text_value":"textReadout.value"}.
- */
-std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
-                                      const std::string& prefixed_tag_extracted_name) {
+template std::string PrometheusStatsFormatter::generateNumericOutput<Stats::Counter>(
+    const Stats::Counter& metric, const std::string& prefixed_tag_extracted_name);
+template std::string PrometheusStatsFormatter::generateNumericOutput<Stats::Gauge>(
+    const Stats::Gauge& metric, const std::string& prefixed_tag_extracted_name);
+
+std::string PrometheusStatsFormatter::generateTextReadoutOutput(
+    const Stats::TextReadout& text_readout, const std::string& prefixed_tag_extracted_name) {
   auto tags = text_readout.tags();
   tags.push_back(Stats::Tag{"text_value", text_readout.value()});
   const std::string formattedTags = PrometheusStatsFormatter::formattedTags(tags);
   return fmt::format("{0}{{{1}}} 0\n", prefixed_tag_extracted_name, formattedTags);
 }
 
-/*
- * Returns the prometheus output for a histogram. The output is a multi-line string (with embedded
- * newlines) that contains all the individual bucket counts and sum/count for a single histogram
- * (metric_name plus all tags).
- */
-std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
-                                    const std::string& prefixed_tag_extracted_name) {
+std::string PrometheusStatsFormatter::generateHistogramOutput(
+    const Stats::ParentHistogram& histogram, const std::string& prefixed_tag_extracted_name) {
   const std::string tags = PrometheusStatsFormatter::formattedTags(histogram.tags());
   const std::string hist_tags = histogram.tags().empty() ? EMPTY_STRING : (tags + ",");
 
@@ -217,9 +210,7 @@ std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
                             stats.sampleCount()));
 
   return output;
-};
-
-} // namespace
+}
 
 std::string PrometheusStatsFormatter::formattedTags(const std::vector<Stats::Tag>& tags) {
   std::vector<std::string> buf;
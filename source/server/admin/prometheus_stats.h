@@ -45,6 +45,31 @@ public:
   static absl::optional<std::string>
   metricName(const std::string& extracted_name,
              const Stats::CustomStatNamespaces& custom_namespace_factory);
+
+  /**
+   * Return the prometheus output line for a numeric Stat (Counter or Gauge).
+   */
+  template <class StatType>
+  static std::string generateNumericOutput(const StatType& metric,
+                                           const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Returns the prometheus output for a TextReadout in gauge format.
+   * It is a workaround of a limitation of prometheus which stores only numeric metrics.
+   * The output is a gauge named the same as a given text-readout. The value of returned gauge is
+   * always equal to 0. Returned gauge contains all tags of a given text-readout and one additional
+   * tag {"text_value":"textReadout.value"}.
+   */
+  static std::string generateTextReadoutOutput(const Stats::TextReadout& text_readout,
+                                               const std::string& prefixed_tag_extracted_name);
+
+  /**
+   * Returns the prometheus output for a histogram. The output is a multi-line string (with
+   * embedded newlines) that contains all the individual bucket counts and sum/count for a single
+   * histogram (metric_name plus all tags).
+   */
+  static std::string generateHistogramOutput(const Stats::ParentHistogram& histogram,
+                                             const std::string& prefixed_tag_extracted_name);
 };
 
 } // namespace Server
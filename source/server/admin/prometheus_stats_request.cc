@@ -0,0 +1,197 @@
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include <string>
+#include <vector>
+
+#include "source/server/admin/prometheus_stats.h"
+
+namespace Envoy {
+namespace Server {
+
+namespace {
+
+// Overloads mapping each renderable stat type to its Prometheus line format,
+// so renderGroup() can be generic across the StatGroup variant alternatives.
+std::string generateOutput(const Stats::Counter& counter,
+                           const std::string& prefixed_tag_extracted_name) {
+  return PrometheusStatsFormatter::generateNumericOutput(counter, prefixed_tag_extracted_name);
+}
+
+std::string generateOutput(const Stats::Gauge& gauge,
+                           const std::string& prefixed_tag_extracted_name) {
+  return PrometheusStatsFormatter::generateNumericOutput(gauge, prefixed_tag_extracted_name);
+}
+
+std::string generateOutput(const Stats::TextReadout& text_readout,
+                           const std::string& prefixed_tag_extracted_name) {
+  return PrometheusStatsFormatter::generateTextReadoutOutput(text_readout,
+                                                             prefixed_tag_extracted_name);
+}
+
+std::string generateOutput(const Stats::ParentHistogram& histogram,
+                           const std::string& prefixed_tag_extracted_name) {
+  return PrometheusStatsFormatter::generateHistogramOutput(histogram, prefixed_tag_extracted_name);
+}
+
+// Overloads mapping each stat type to its family-iteration entry point, so
+// populateGroups() can be generic across the StatGroup variant alternatives.
+void forEachFamily(const Stats::Store& store, const Stats::FamilyIterateFn<Stats::Counter>& fn) {
+  store.forEachCounterFamily(fn);
+}
+
+void forEachFamily(const Stats::Store& store, const Stats::FamilyIterateFn<Stats::Gauge>& fn) {
+  store.forEachGaugeFamily(fn);
+}
+
+void forEachFamily(const Stats::Store& store,
+                   const Stats::FamilyIterateFn<Stats::TextReadout>& fn) {
+  store.forEachTextReadoutFamily(fn);
+}
+
+void forEachFamily(const Stats::Store& store,
+                   const Stats::FamilyIterateFn<Stats::ParentHistogram>& fn) {
+  store.forEachHistogramFamily(fn);
+}
+
+} // namespace
+
+PrometheusStatsRequest::PrometheusStatsRequest(
+    Stats::Store& stats, const StatsParams& params,
+    const Stats::CustomStatNamespaces& custom_namespaces)
+    : params_(params), stats_(stats), custom_namespaces_(custom_namespaces),
+      groups_(Stats::StatNameLessThan(stats.constSymbolTable())) {}
+
+Http::Code PrometheusStatsRequest::start(Http::ResponseHeaderMap&) {
+  phase_ = Phase::Counters;
+  populateGroups<Stats::Counter>();
+  return Http::Code::OK;
+}
+
+bool PrometheusStatsRequest::nextChunk(Buffer::Instance& response) {
+  // nextChunk's contract is to add up to chunk_size_ bytes of data to the
+  // response buffer per call. We keep appending metric families until that
+  // threshold is crossed or we run out of phases. The caller flushes the
+  // buffer between calls, applying flow-control so that a slow scraper does
+  // not force us to buffer the whole rendered scrape.
+  const uint64_t starting_response_length = response.length();
+  while (response.length() - starting_response_length < chunk_size_) {
+    while (groups_.empty()) {
+      if (!nextPhase()) {
+        return false;
+      }
+    }
+
+    auto iter = groups_.begin();
+    const Stats::StatName tag_extracted_name = iter->first;
+    StatGroup group = std::move(iter->second);
+    // The StatName key and the metrics in `group` stay valid after the erase:
+    // both are owned by the reference-counted metrics now held by our local.
+    groups_.erase(iter);
+
+    switch (static_cast<StatGroupIndex>(group.index())) {
+    case StatGroupIndex::Counter:
+      renderGroup(response, tag_extracted_name,
+                  absl::get<std::vector<Stats::CounterSharedPtr>>(group), "counter");
+      break;
+    case StatGroupIndex::Gauge:
+      renderGroup(response, tag_extracted_name,
+                  absl::get<std::vector<Stats::GaugeSharedPtr>>(group), "gauge");
+      break;
+    case StatGroupIndex::TextReadout:
+      // TextReadout stats are returned in gauge format, so "gauge" type is set intentionally.
+      renderGroup(response, tag_extracted_name,
+                  absl::get<std::vector<Stats::TextReadoutSharedPtr>>(group), "gauge");
+      break;
+    case StatGroupIndex::Histogram:
+      renderGroup(response, tag_extracted_name,
+                  absl::get<std::vector<Stats::ParentHistogramSharedPtr>>(group), "histogram");
+      break;
+    }
+  }
+  return true;
+}
+
+bool PrometheusStatsRequest::nextPhase() {
+  ASSERT(groups_.empty());
+  switch (phase_) {
+  case Phase::Counters:
+    phase_ = Phase::Gauges;
+    populateGroups<Stats::Gauge>();
+    return true;
+  case Phase::Gauges:
+    phase_ = Phase::TextReadouts;
+    if (params_.prometheus_text_readouts_) {
+      populateGroups<Stats::TextReadout>();
+    }
+    return true;
+  case Phase::TextReadouts:
+    phase_ = Phase::Histograms;
+    populateGroups<Stats::ParentHistogram>();
+    return true;
+  case Phase::Histograms:
+    return false;
+  }
+  return false; // unreachable, for gcc.
+}
+
+bool PrometheusStatsRequest::shouldShow(const Stats::Metric& metric) const {
+  // We only use metric.name() for filtering, not rendering, so we only
+  // construct the name if there's a filter.
+  if (params_.used_only_ && !metric.used()) {
+    return false;
+  }
+  if (params_.re2_filter_ != nullptr &&
+      !re2::RE2::PartialMatch(metric.name(), *params_.re2_filter_)) {
+    return false;
+  }
+  return true;
+}
+
+template <class StatType> void PrometheusStatsRequest::populateGroups() {
+  // The store's family index delivers families in increasing tag-extracted
+  // name order with members pre-sorted by stat name, so each family can be
+  // appended at the end of groups_ and rendered without a per-scrape sort.
+  Stats::FamilyIterateFn<StatType> fn =
+      [this](Stats::StatName, const std::vector<Stats::RefcountPtr<StatType>>& stats) -> bool {
+    std::vector<Stats::RefcountPtr<StatType>> group;
+    group.reserve(stats.size());
+    for (const Stats::RefcountPtr<StatType>& stat : stats) {
+      if (shouldShow(*stat)) {
+        group.push_back(stat);
+      }
+    }
+    if (!group.empty()) {
+      // The callback's StatName argument is only valid during the call, so key
+      // the map from a retained metric instead.
+      const Stats::StatName key = group.front()->tagExtractedStatName();
+      groups_.emplace_hint(groups_.end(), key, StatGroup(std::move(group)));
+    }
+    return true;
+  };
+  forEachFamily(stats_, fn);
+}
+
+template <class SharedStatType>
+void PrometheusStatsRequest::renderGroup(Buffer::Instance& response,
+                                         Stats::StatName tag_extracted_name,
+                                         std::vector<SharedStatType>& group,
+                                         absl::string_view type) {
+  const Stats::SymbolTable& symbol_table = stats_.constSymbolTable();
+  const absl::optional<std::string> prefixed_tag_extracted_name =
+      PrometheusStatsFormatter::metricName(symbol_table.toString(tag_extracted_name),
+                                           custom_namespaces_);
+  if (!prefixed_tag_extracted_name.has_value()) {
+    return;
+  }
+  response.add(fmt::format("# TYPE {0} {1}\n", prefixed_tag_extracted_name.value(), type));
+
+  // The family index keeps members sorted by stat name, which satisfies the
+  // "preferred" ordering from the prometheus spec: metrics are emitted in an
+  // order that is consistent across calls, with no per-scrape sort.
+  for (const SharedStatType& metric : group) {
+    response.add(generateOutput(*metric, prefixed_tag_extracted_name.value()));
+  }
+}
+
+} // namespace Server
+} // namespace Envoy
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include "envoy/server/admin.h"
+#include "envoy/stats/custom_stat_namespaces.h"
+#include "envoy/stats/stats.h"
+#include "envoy/stats/store.h"
+
+#include "source/common/stats/symbol_table.h"
+#include "source/server/admin/stats_params.h"
+
+#include "absl/types/variant.h"
+
+namespace Envoy {
+namespace Server {
+
+// Captures context for a streaming Prometheus stats request, implementing the
+// Admin::Request interface.
+//
+// The Prometheus exposition format requires all the series of a metric family
+// to be emitted as one group under a single "# TYPE" line, so unlike
+// StatsRequest we cannot stream stats out in pure name order. Instead each
+// phase (one per stat type) walks the store's family index, which is
+// maintained incrementally as stats are created and destroyed, holding
+// reference-counted metric pointers rather than rendered text, and
+// nextChunk() serializes one metric family at a time with no per-scrape
+// grouping or sorting. This bounds the
+// buffered response text by the chunk size rather than the total scrape
+// size: for servers with millions of stats that's the difference between a
+// few megabytes and hundreds of megabytes of transient memory, and it lets
+// the admin filter apply flow-control between chunks rather than stalling
+// the main thread while the whole scrape is rendered.
+class PrometheusStatsRequest : public Admin::Request {
+  using StatGroup = absl::variant<std::vector<Stats::CounterSharedPtr>,
+                                  std::vector<Stats::GaugeSharedPtr>,
+                                  std::vector<Stats::TextReadoutSharedPtr>,
+                                  std::vector<Stats::ParentHistogramSharedPtr>>;
+
+  // Ordered to match the StatGroup variant.
+  enum class StatGroupIndex { Counter, Gauge, TextReadout, Histogram };
+
+  // Phases are rendered in the same order that the fully buffered
+  // implementation emitted stat types, so the output is byte-for-byte
+  // compatible with the pre-streaming handler.
+  enum class Phase {
+    Counters,
+    Gauges,
+    TextReadouts,
+    Histograms,
+  };
+
+public:
+  static constexpr uint64_t DefaultChunkSize = 2 * 1000 * 1000;
+
+  PrometheusStatsRequest(Stats::Store& stats, const StatsParams& params,
+                         const Stats::CustomStatNamespaces& custom_namespaces);
+
+  // Admin::Request
+  Http::Code start(Http::ResponseHeaderMap& response_headers) override;
+
+  // Streams the next metric families into the response buffer, until the
+  // buffer grows by approximately chunk_size_ bytes or all families of all
+  // phases have been emitted.
+  bool nextChunk(Buffer::Instance& response) override;
+
+  // Sets the chunk size.
+  void setChunkSize(uint64_t chunk_size) { chunk_size_ = chunk_size; }
+
+private:
+  // Advances to the next phase and collects its stats, returning false once
+  // all phases have been consumed.
+  bool nextPhase();
+
+  // Collects the families of the templatized type into groups_, keyed by
+  // tag-extracted name. The StatName keys reference storage owned by the
+  // collected metrics, which are kept alive across chunks by the
+  // reference-counted pointers in the group values.
+  template <class StatType> void populateGroups();
+
+  // Renders one metric family: the TYPE line followed by the series of the
+  // group, which the family index keeps sorted by stat name so repeated
+  // scrapes are reproducible.
+  template <class SharedStatType>
+  void renderGroup(Buffer::Instance& response, Stats::StatName tag_extracted_name,
+                   std::vector<SharedStatType>& group, absl::string_view type);
+
+  // Applies the usedonly/filter query-params to a metric.
+  bool shouldShow(const Stats::Metric& metric) const;
+
+  StatsParams params_;
+  Stats::Store& stats_;
+  const Stats::CustomStatNamespaces& custom_namespaces_;
+  std::map<Stats::StatName, StatGroup, Stats::StatNameLessThan> groups_;
+  Phase phase_{Phase::Counters};
+  uint64_t chunk_size_{DefaultChunkSize};
+};
+
+} // namespace Server
+} // namespace Envoy
@@ -3,6 +3,7 @@
 #include "envoy/admin/v3/memory.pb.h"
 
 #include "source/common/http/headers.h"
+#include "source/common/http/utility.h"
 #include "source/common/memory/stats.h"
 #include "source/common/version/version.h"
 #include "source/server/utils.h"
@@ -41,7 +42,17 @@ Http::Code ServerInfoHandler::handlerHotRestartVersion(Http::ResponseHeaderMap&,
 
 // TODO(ambuc): Add more tcmalloc stats, export proto details based on allocator.
 Http::Code ServerInfoHandler::handlerMemory(Http::ResponseHeaderMap& response_headers,
-                                            Buffer::Instance& response, AdminStream&) {
+                                            Buffer::Instance& response,
+                                            AdminStream& admin_stream) {
+  const Http::Utility::QueryParams params = admin_stream.queryParams();
+  if (params.find("detail") != params.end()) {
+    // The allocator's own breakdown (size classes, page heap, caches) makes it possible to see
+    // where heap growth is concentrated without taking a full heap dump.
+    const std::string detail = Memory::Stats::detailedStats();
+    response.add(detail.empty() ? "detailed allocator stats are not available in this build\n"
+                                : detail);
+    return Http::Code::OK;
+  }
   response_headers.setReferenceContentType(Http::Headers::get().ContentTypeValues.Json);
   envoy::admin::v3::Memory memory;
   memory.set_allocated(Memory::Stats::totalCurrentlyAllocated());
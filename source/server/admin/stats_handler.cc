@@ -11,6 +11,7 @@
 #include "source/common/http/headers.h"
 #include "source/common/http/utility.h"
 #include "source/server/admin/prometheus_stats.h"
+#include "source/server/admin/prometheus_stats_request.h"
 #include "source/server/admin/stats_request.h"
 
 #include "absl/strings/numbers.h"
@@ -79,23 +80,14 @@ Admin::RequestPtr StatsHandler::makeRequest(AdminStream& admin_stream) {
     return Admin::makeStaticTextRequest(response, code);
   }
 
-  if (params.format_ == StatsFormat::Prometheus) {
-    // TODO(#16139): modify streaming algorithm to cover Prometheus.
-    //
-    // This may be easiest to accomplish by populating the set
-    // with tagExtractedName(), and allowing for vectors of
-    // stats as multiples will have the same tag-extracted names.
-    // Ideally we'd find a way to do this without slowing down
-    // the non-Prometheus implementations.
-    Buffer::OwnedImpl response;
-    prometheusFlushAndRender(params, response);
-    return Admin::makeStaticTextRequest(response, code);
-  }
-
   if (server_.statsConfig().flushOnAdmin()) {
     server_.flushStats();
   }
 
+  if (params.format_ == StatsFormat::Prometheus) {
+    return makePrometheusRequest(params);
+  }
+
 #ifdef ENVOY_ADMIN_HTML
   const bool active_mode = params.format_ == StatsFormat::ActiveHtml;
   return makeRequest(server_.stats(), params, [this, active_mode]() -> Admin::UrlHandler {
@@ -112,33 +104,9 @@ Admin::RequestPtr StatsHandler::makeRequest(Stats::Store& stats, const StatsPara
   return std::make_unique<StatsRequest>(stats, params, url_handler_fn);
 }
 
-Http::Code StatsHandler::handlerPrometheusStats(Http::ResponseHeaderMap&,
-                                                Buffer::Instance& response,
-                                                AdminStream& admin_stream) {
-  return prometheusStats(admin_stream.getRequestHeaders().getPathValue(), response);
-}
-
-Http::Code StatsHandler::prometheusStats(absl::string_view path_and_query,
-                                         Buffer::Instance& response) {
-  StatsParams params;
-  Http::Code code = params.parse(path_and_query, response);
-  if (code != Http::Code::OK) {
-    return code;
-  }
-
-  if (server_.statsConfig().flushOnAdmin()) {
-    server_.flushStats();
-  }
-
-  prometheusFlushAndRender(params, response);
-  return Http::Code::OK;
-}
-
-void StatsHandler::prometheusFlushAndRender(const StatsParams& params, Buffer::Instance& response) {
-  if (server_.statsConfig().flushOnAdmin()) {
-    server_.flushStats();
-  }
-  prometheusRender(server_.stats(), server_.api().customStatNamespaces(), params, response);
+Admin::RequestPtr StatsHandler::makePrometheusRequest(const StatsParams& params) {
+  return std::make_unique<PrometheusStatsRequest>(server_.stats(), params,
+                                                  server_.api().customStatNamespaces());
 }
 
 void StatsHandler::prometheusRender(Stats::Store& stats,
@@ -204,5 +172,32 @@ Admin::UrlHandler StatsHandler::statsHandler(bool active_mode) {
       params};
 }
 
+Admin::UrlHandler StatsHandler::prometheusStatsHandler() {
+  return {"/stats/prometheus",
+          "print server stats in prometheus format",
+          [this](AdminStream& admin_stream) -> Admin::RequestPtr {
+            StatsParams params;
+            Buffer::OwnedImpl response;
+            Http::Code code =
+                params.parse(admin_stream.getRequestHeaders().getPathValue(), response);
+            if (code != Http::Code::OK) {
+              return Admin::makeStaticTextRequest(response, code);
+            }
+            if (server_.statsConfig().flushOnAdmin()) {
+              server_.flushStats();
+            }
+            return makePrometheusRequest(params);
+          },
+          false,
+          false,
+          {{Admin::ParamDescriptor::Type::Boolean, "usedonly",
+            "Only include stats that have been written by system since restart"},
+           {Admin::ParamDescriptor::Type::Boolean, "text_readouts",
+            "Render text_readouts as new gaugues with value 0 (increases Prometheus "
+            "data size)"},
+           {Admin::ParamDescriptor::Type::String, "filter",
+            "Regular expression (Google re2) for filtering stats"}}};
+}
+
 } // namespace Server
 } // namespace Envoy
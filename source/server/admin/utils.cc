@@ -62,6 +62,42 @@ absl::optional<std::string> queryParam(const Http::Utility::QueryParams& params,
   return absl::nullopt;
 }
 
+void JsonArrayStreamer::addElement(absl::string_view single_element_json,
+                                   Buffer::Instance& response) {
+  const absl::string_view::size_type open = single_element_json.find('[');
+  const absl::string_view::size_type close = single_element_json.rfind(']');
+  if (open == absl::string_view::npos || close == absl::string_view::npos || close < open) {
+    // The serialization produced an error string rather than the expected
+    // envelope; pass it through verbatim.
+    response.add(single_element_json);
+    first_ = false;
+    return;
+  }
+  // The element body is everything between the array brackets, with any
+  // trailing whitespace saved for the closing frame so pretty-printed output
+  // is reassembled exactly.
+  absl::string_view body = single_element_json.substr(open + 1, close - open - 1);
+  while (!body.empty() && (body.back() == ' ' || body.back() == '\n')) {
+    body.remove_suffix(1);
+  }
+  if (first_) {
+    response.add(single_element_json.substr(0, open + 1));
+    suffix_ = std::string(single_element_json.substr(open + 1 + body.size()));
+    first_ = false;
+  } else {
+    response.add(",");
+  }
+  response.add(body);
+}
+
+void JsonArrayStreamer::finish(absl::string_view empty_message_json, Buffer::Instance& response) {
+  if (first_) {
+    response.add(empty_message_json);
+  } else {
+    response.add(suffix_);
+  }
+}
+
 } // namespace Utility
 } // namespace Server
 } // namespace Envoy
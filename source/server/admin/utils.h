@@ -3,6 +3,7 @@
 #include <regex>
 
 #include "envoy/admin/v3/server_info.pb.h"
+#include "envoy/buffer/buffer.h"
 #include "envoy/init/manager.h"
 
 #include "source/common/http/codes.h"
@@ -28,6 +29,36 @@ absl::optional<std::string> formatParam(const Http::Utility::QueryParams& params
 absl::optional<std::string> queryParam(const Http::Utility::QueryParams& params,
                                        const std::string& key);
 
+/**
+ * Streams the JSON form of a message whose output is dominated by a single
+ * repeated field, one element at a time, so that the entire serialization is
+ * never resident in memory at once. The caller serializes a copy of the
+ * envelope message holding just one element of the repeated field, and this
+ * class splices out the array framing so that the concatenation of all chunks
+ * is byte-identical to serializing the fully-populated message.
+ */
+class JsonArrayStreamer {
+public:
+  /**
+   * Appends the next array element to the response.
+   * @param single_element_json JSON serialization of the envelope message
+   *        containing exactly one element of the repeated field.
+   * @param response buffer in which to write the spliced output.
+   */
+  void addElement(absl::string_view single_element_json, Buffer::Instance& response);
+
+  /**
+   * Closes the array and envelope. Must be called exactly once, after the last
+   * element. If no elements were added, emits empty_message_json instead,
+   * matching the serialization of an empty envelope message.
+   */
+  void finish(absl::string_view empty_message_json, Buffer::Instance& response);
+
+private:
+  bool first_{true};
+  std::string suffix_;
+};
+
 } // namespace Utility
 } // namespace Server
 } // namespace Envoy
@@ -1,6 +1,8 @@
 #include "source/server/drain_manager_impl.h"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -16,20 +18,25 @@ namespace Server {
 
 DrainManagerImpl::DrainManagerImpl(Instance& server,
                                    envoy::config::listener::v3::Listener::DrainType drain_type,
-                                   Event::Dispatcher& dispatcher)
+                                   Event::Dispatcher& dispatcher,
+                                   DrainTokenBucketSharedPtr drain_tokens)
     : server_(server), dispatcher_(dispatcher), drain_type_(drain_type),
+      drain_tokens_(drain_tokens != nullptr ? std::move(drain_tokens)
+                                            : std::make_shared<DrainTokenBucket>()),
+      drain_close_granted_(server.stats().counterFromString("drain.drain_close_granted")),
+      drain_close_deferred_(server.stats().counterFromString("drain.drain_close_deferred")),
       children_(Common::ThreadSafeCallbackManager::create()) {}
 
 DrainManagerPtr
 DrainManagerImpl::createChildManager(Event::Dispatcher& dispatcher,
                                      envoy::config::listener::v3::Listener::DrainType drain_type) {
-  auto child = std::make_unique<DrainManagerImpl>(server_, drain_type, dispatcher);
+  auto child = std::make_unique<DrainManagerImpl>(server_, drain_type, dispatcher, drain_tokens_);
 
   // Wire up the child so that when the parent starts draining, the child also sees the
   // state-change
   auto child_cb = children_->add(dispatcher, [child = child.get()] {
     if (!child->draining_) {
-      child->startDrainSequence([] {});
+      child->startDrainSequence([] {}, /*initiated_by_parent=*/true);
     }
   });
   child->parent_callback_handle_ = std::move(child_cb);
@@ -57,6 +64,7 @@ bool DrainManagerImpl::drainClose() const {
   }
 
   if (server_.options().drainStrategy() == Server::DrainStrategy::Immediate) {
+    drain_close_granted_.inc();
     return true;
   }
   ASSERT(server_.options().drainStrategy() == Server::DrainStrategy::Gradual);
@@ -65,6 +73,7 @@ bool DrainManagerImpl::drainClose() const {
   // If the drain deadline is exceeded, skip the probability calculation.
   const MonotonicTime current_time = dispatcher_.timeSource().monotonicTime();
   if (current_time >= drain_deadline_) {
+    drain_close_granted_.inc();
     return true;
   }
 
@@ -72,8 +81,51 @@ bool DrainManagerImpl::drainClose() const {
       std::chrono::duration_cast<std::chrono::seconds>(drain_deadline_ - current_time);
   ASSERT(server_.options().drainTime() >= remaining_time);
   const auto elapsed_time = server_.options().drainTime() - remaining_time;
-  return static_cast<uint64_t>(elapsed_time.count()) >
-         (server_.api().randomGenerator().random() % server_.options().drainTime().count());
+  const bool drain_requested =
+      static_cast<uint64_t>(elapsed_time.count()) >
+      (server_.api().randomGenerator().random() % server_.options().drainTime().count());
+  if (!drain_requested) {
+    return false;
+  }
+
+  // The probabilistic selection wants to drain this connection; additionally pace the emission
+  // through the shared token bucket so that GOAWAY/connection-close does not cluster across
+  // workers. Deferred connections retry on their next drainClose() check and the hard deadline
+  // above still guarantees teardown at the end of the window.
+  if (!consumeDrainToken()) {
+    drain_close_deferred_.inc();
+    return false;
+  }
+  drain_close_granted_.inc();
+  return true;
+}
+
+void DrainManagerImpl::armDrainTokenBucket() {
+  if (server_.options().drainStrategy() != Server::DrainStrategy::Gradual) {
+    return;
+  }
+  const std::chrono::seconds drain_time = server_.options().drainTime();
+  if (drain_time.count() <= 0) {
+    return;
+  }
+
+  // Refill at the rate that retires the currently-active connections exactly within the drain
+  // window, with a one second burst. Re-arming on every sequence start keeps the rate fresh when
+  // drains repeat (e.g. successive listener updates).
+  const double fill_rate =
+      std::max(1.0, static_cast<double>(server_.listenerManager().numConnections()) /
+                        static_cast<double>(drain_time.count()));
+  absl::MutexLock lock(&drain_tokens_->mutex_);
+  drain_tokens_->bucket_ = std::make_unique<TokenBucketImpl>(
+      static_cast<uint64_t>(std::ceil(fill_rate)), dispatcher_.timeSource(), fill_rate);
+}
+
+bool DrainManagerImpl::consumeDrainToken() const {
+  absl::MutexLock lock(&drain_tokens_->mutex_);
+  if (drain_tokens_->bucket_ == nullptr) {
+    return true;
+  }
+  return drain_tokens_->bucket_->consume(1, false) == 1;
 }
 
 Common::CallbackHandlePtr DrainManagerImpl::addOnDrainCloseCb(DrainCloseCb cb) const {
@@ -112,6 +164,11 @@ void DrainManagerImpl::addDrainCompleteCallback(std::function<void()> cb) {
 }
 
 void DrainManagerImpl::startDrainSequence(std::function<void()> drain_complete_cb) {
+  startDrainSequence(std::move(drain_complete_cb), /*initiated_by_parent=*/false);
+}
+
+void DrainManagerImpl::startDrainSequence(std::function<void()> drain_complete_cb,
+                                          bool initiated_by_parent) {
   ASSERT(drain_complete_cb);
 
   // If we've already started draining (either through direct invocation or through
@@ -124,6 +181,10 @@ void DrainManagerImpl::startDrainSequence(std::function<void()> drain_complete_c
   ASSERT(!drain_tick_timer_);
   draining_ = true;
 
+  if (!initiated_by_parent) {
+    armDrainTokenBucket();
+  }
+
   // Signal to child drain-managers to start their drain sequence
   children_->runCallbacks();
 
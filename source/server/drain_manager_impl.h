@@ -10,23 +10,40 @@
 #include "envoy/event/timer.h"
 #include "envoy/server/drain_manager.h"
 #include "envoy/server/instance.h"
+#include "envoy/stats/stats.h"
 
 #include "source/common/common/callback_impl.h"
 #include "source/common/common/logger.h"
+#include "source/common/common/token_bucket_impl.h"
+
+#include "absl/synchronization/mutex.h"
 
 namespace Envoy {
 namespace Server {
 
+/**
+ * Token bucket shared by a drain manager and all of its children so that drain-close decisions
+ * are paced process-wide rather than per worker. Armed when a drain sequence starts and
+ * consulted (under lock) by every drainClose() call; a null bucket means no pacing.
+ */
+struct DrainTokenBucket {
+  absl::Mutex mutex_;
+  std::unique_ptr<TokenBucketImpl> bucket_ ABSL_GUARDED_BY(mutex_);
+};
+using DrainTokenBucketSharedPtr = std::shared_ptr<DrainTokenBucket>;
+
 /**
  * Implementation of drain manager that does the following by default:
  * 1) Terminates the parent process after 15 minutes.
  * 2) Drains the parent process over a period of 10 minutes where drain close becomes more
- *    likely each second that passes.
+ *    likely each second that passes, paced by a token bucket that spreads connection teardown
+ *    evenly across the drain window.
  */
 class DrainManagerImpl : Logger::Loggable<Logger::Id::main>, public DrainManager {
 public:
   DrainManagerImpl(Instance& server, envoy::config::listener::v3::Listener::DrainType drain_type,
-                   Event::Dispatcher& dispatcher);
+                   Event::Dispatcher& dispatcher,
+                   DrainTokenBucketSharedPtr drain_tokens = nullptr);
 
   // Network::DrainDecision
   bool drainClose() const override;
@@ -44,9 +61,21 @@ public:
 private:
   void addDrainCompleteCallback(std::function<void()> cb);
 
+  // Starts the drain sequence. Only the manager that initiates a drain (not children cascaded
+  // into by their parent) arms the shared token bucket, so a process-wide drain arms it once.
+  void startDrainSequence(std::function<void()> drain_complete_cb, bool initiated_by_parent);
+
+  // (Re)creates the shared token bucket at the start of a drain sequence, sized to retire the
+  // currently-active connections evenly over the drain window. Gradual strategy only.
+  void armDrainTokenBucket();
+  bool consumeDrainToken() const;
+
   Instance& server_;
   Event::Dispatcher& dispatcher_;
   const envoy::config::listener::v3::Listener::DrainType drain_type_;
+  const DrainTokenBucketSharedPtr drain_tokens_;
+  Stats::Counter& drain_close_granted_;
+  Stats::Counter& drain_close_deferred_;
 
   std::atomic<bool> draining_{false};
   Event::TimerPtr drain_tick_timer_;
@@ -55,6 +55,11 @@ GuardDogImpl::GuardDogImpl(Stats::Scope& stats_scope, const Server::Configuratio
           Stats::StatNameManagedStorage(absl::StrCat(name, ".watchdog_mega_miss"),
                                         stats_scope.symbolTable())
               .statName())),
+      watchdog_touch_staleness_ms_(stats_scope.histogramFromStatName(
+          Stats::StatNameManagedStorage(absl::StrCat(name, ".watchdog_touch_staleness_ms"),
+                                        stats_scope.symbolTable())
+              .statName(),
+          Stats::Histogram::Unit::Milliseconds)),
       dispatcher_(api.allocateDispatcher(absl::StrCat(name, "_guarddog_thread"))),
       loop_timer_(dispatcher_->createTimer([this]() { step(); })),
       events_to_actions_([&](const Server::Configuration::Watchdog& config) -> EventToActionsMap {
@@ -134,6 +139,14 @@ void GuardDogImpl::step() {
       const auto last_checkin = watched_dog->last_checkin_;
       const auto tid = watched_dog->dog_->threadId();
       const auto delta = now - last_checkin;
+      // Record the observed staleness each time a thread is seen failing to
+      // check in. This makes event loop stalls that never reach the miss
+      // timeout visible in the stats, while recording nothing for healthy
+      // threads.
+      const uint64_t staleness_ms =
+          std::chrono::duration_cast<std::chrono::milliseconds>(delta).count();
+      watchdog_touch_staleness_ms_.recordValue(staleness_ms);
+      watched_dog->touch_staleness_ms_.recordValue(staleness_ms);
       if (watched_dog->last_alert_time_ && watched_dog->last_alert_time_.value() < last_checkin) {
         watched_dog->miss_alerted_ = false;
         watched_dog->megamiss_alerted_ = false;
@@ -268,7 +281,13 @@ GuardDogImpl::WatchedDog::WatchedDog(Stats::Scope& stats_scope, const std::strin
       megamiss_counter_(stats_scope.counterFromStatName(
           Stats::StatNameManagedStorage(fmt::format("server.{}.watchdog_mega_miss", thread_name),
                                         stats_scope.symbolTable())
-              .statName())) {}
+              .statName())),
+      touch_staleness_ms_(stats_scope.histogramFromStatName(
+          Stats::StatNameManagedStorage(
+              fmt::format("server.{}.watchdog_touch_staleness_ms", thread_name),
+              stats_scope.symbolTable())
+              .statName(),
+          Stats::Histogram::Unit::Milliseconds)) {}
 
 } // namespace Server
 } // namespace Envoy
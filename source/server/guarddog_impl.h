@@ -10,6 +10,7 @@
 #include "envoy/server/guarddog.h"
 #include "envoy/server/guarddog_config.h"
 #include "envoy/server/watchdog.h"
+#include "envoy/stats/histogram.h"
 #include "envoy/stats/scope.h"
 #include "envoy/stats/stats.h"
 
@@ -123,6 +124,7 @@ private:
     bool megamiss_alerted_{};
     Stats::Counter& miss_counter_;
     Stats::Counter& megamiss_counter_;
+    Stats::Histogram& touch_staleness_ms_;
   };
   using WatchedDogPtr = std::unique_ptr<WatchedDog>;
 
@@ -137,6 +139,7 @@ private:
   const std::chrono::milliseconds loop_interval_;
   Stats::Counter& watchdog_miss_counter_;
   Stats::Counter& watchdog_megamiss_counter_;
+  Stats::Histogram& watchdog_touch_staleness_ms_;
   std::vector<WatchedDogPtr> watched_dogs_ ABSL_GUARDED_BY(wd_lock_);
   Thread::MutexBasicLockable wd_lock_;
   Thread::ThreadPtr thread_;
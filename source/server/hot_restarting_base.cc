@@ -1,6 +1,9 @@
 #include "source/server/hot_restarting_base.h"
 
+#include <sys/mman.h>
+
 #include "source/common/api/os_sys_calls_impl.h"
+#include "source/common/api/os_sys_calls_impl_hot_restart.h"
 #include "source/common/common/mem_block_builder.h"
 #include "source/common/common/safe_memcpy.h"
 #include "source/common/common/utility.h"
@@ -98,10 +101,16 @@ void HotRestartingBase::sendHotRestartMessage(sockaddr_un& address,
     message.msg_iov = iov;
     message.msg_iovlen = 1;
 
-    // Control data stuff, only relevant for the fd passing done with PassListenSocketReply.
+    // Control data stuff, only relevant for the fd passing done with PassListenSocketReply
+    // and StatsSharedMemory replies.
+    int passed_fd = -1;
+    if (replyIsExpectedType(&proto, HotRestartMessage::Reply::kPassListenSocket)) {
+      passed_fd = proto.reply().pass_listen_socket().fd();
+    } else if (replyIsExpectedType(&proto, HotRestartMessage::Reply::kStatsSharedMemory)) {
+      passed_fd = proto.reply().stats_shared_memory().fd();
+    }
     uint8_t control_buffer[CMSG_SPACE(sizeof(int))];
-    if (replyIsExpectedType(&proto, HotRestartMessage::Reply::kPassListenSocket) &&
-        proto.reply().pass_listen_socket().fd() != -1) {
+    if (passed_fd != -1) {
       memset(control_buffer, 0, CMSG_SPACE(sizeof(int)));
       message.msg_control = control_buffer;
       message.msg_controllen = CMSG_SPACE(sizeof(int));
@@ -109,7 +118,7 @@ void HotRestartingBase::sendHotRestartMessage(sockaddr_un& address,
       control_message->cmsg_level = SOL_SOCKET;
       control_message->cmsg_type = SCM_RIGHTS;
       control_message->cmsg_len = CMSG_LEN(sizeof(int));
-      *reinterpret_cast<int*>(CMSG_DATA(control_message)) = proto.reply().pass_listen_socket().fd();
+      *reinterpret_cast<int*>(CMSG_DATA(control_message)) = passed_fd;
       ASSERT(sent == total_size, "an fd passing message was too long for one sendmsg().");
     }
 
@@ -147,6 +156,71 @@ void HotRestartingBase::sendHotRestartMessage(sockaddr_un& address,
                  fmt::format("Set domain socket nonblocking failed, errno = {}", errno));
 }
 
+void HotRestartingBase::sendHotRestartStatsReply(sockaddr_un& address,
+                                                 const HotRestartMessage& proto) {
+  ASSERT(replyIsExpectedType(&proto, HotRestartMessage::Reply::kStats));
+  if (sizeof(uint64_t) + proto.ByteSizeLong() <= MaxSendmsgSize) {
+    sendHotRestartMessage(address, proto);
+    return;
+  }
+
+  Api::OsSysCalls& os_sys_calls = Api::OsSysCallsSingleton::get();
+  Api::HotRestartOsSysCalls& hot_restart_os_sys_calls = Api::HotRestartOsSysCallsSingleton::get();
+  const std::string shmem_name = fmt::format("/envoy_stats_snapshot_{}", getpid());
+  // Clean up any leftover region from an earlier crashed exchange, then create a fresh one and
+  // immediately unlink it; it stays alive through the fds held here and by the peer.
+  hot_restart_os_sys_calls.shmUnlink(shmem_name.c_str());
+  const Api::SysCallIntResult open_result = hot_restart_os_sys_calls.shmOpen(
+      shmem_name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+  RELEASE_ASSERT(open_result.return_value_ != -1,
+                 fmt::format("cannot open shared memory region {} for stats transfer. Error: {}",
+                             shmem_name, errorDetails(open_result.errno_)));
+  const int fd = open_result.return_value_;
+  hot_restart_os_sys_calls.shmUnlink(shmem_name.c_str());
+
+  const uint64_t serialized_size = proto.reply().stats().ByteSizeLong();
+  RELEASE_ASSERT(os_sys_calls.ftruncate(fd, serialized_size).return_value_ != -1, "");
+  const Api::SysCallPtrResult mmap_result =
+      os_sys_calls.mmap(nullptr, serialized_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  RELEASE_ASSERT(mmap_result.return_value_ != MAP_FAILED, "");
+  RELEASE_ASSERT(proto.reply().stats().SerializeWithCachedSizesToArray(
+                     static_cast<uint8_t*>(mmap_result.return_value_)) != nullptr,
+                 "failed to serialize a stats snapshot into shared memory");
+
+  HotRestartMessage wrapped_reply;
+  HotRestartMessage::Reply::StatsSharedMemory* shared =
+      wrapped_reply.mutable_reply()->mutable_stats_shared_memory();
+  shared->set_size(serialized_size);
+  shared->set_fd(fd);
+  sendHotRestartMessage(address, wrapped_reply);
+
+  os_sys_calls.munmap(mmap_result.return_value_, serialized_size);
+  os_sys_calls.close(fd);
+}
+
+std::unique_ptr<HotRestartMessage>
+HotRestartingBase::resolveSharedMemoryStatsReply(std::unique_ptr<HotRestartMessage> proto) {
+  if (!replyIsExpectedType(proto.get(), HotRestartMessage::Reply::kStatsSharedMemory)) {
+    return proto;
+  }
+  const HotRestartMessage::Reply::StatsSharedMemory& shared =
+      proto->reply().stats_shared_memory();
+  RELEASE_ASSERT(shared.fd() != -1, "stats shared memory reply arrived without a passed fd.");
+
+  Api::OsSysCalls& os_sys_calls = Api::OsSysCallsSingleton::get();
+  const Api::SysCallPtrResult mmap_result =
+      os_sys_calls.mmap(nullptr, shared.size(), PROT_READ, MAP_SHARED, shared.fd(), 0);
+  RELEASE_ASSERT(mmap_result.return_value_ != MAP_FAILED, "");
+
+  auto ret = std::make_unique<HotRestartMessage>();
+  RELEASE_ASSERT(ret->mutable_reply()->mutable_stats()->ParseFromArray(
+                     mmap_result.return_value_, static_cast<int>(shared.size())),
+                 "failed to parse a stats snapshot out of shared memory.");
+  os_sys_calls.munmap(mmap_result.return_value_, shared.size());
+  os_sys_calls.close(shared.fd());
+  return ret;
+}
+
 bool HotRestartingBase::replyIsExpectedType(const HotRestartMessage* proto,
                                             HotRestartMessage::Reply::ReplyCase oneof_type) const {
   return proto != nullptr && proto->requestreply_case() == HotRestartMessage::kReply &&
@@ -154,19 +228,24 @@ bool HotRestartingBase::replyIsExpectedType(const HotRestartMessage* proto,
 }
 
 // Pull the cloned fd, if present, out of the control data and write it into the
-// PassListenSocketReply proto; the higher level code will see a listening fd that Just Works. We
-// should only get control data in a PassListenSocketReply, it should only be the fd passing type,
-// and there should only be one at a time. Crash on any other control data.
+// PassListenSocketReply or StatsSharedMemory proto; the higher level code will see an fd that
+// Just Works. We should only get control data in those reply types, it should only be the fd
+// passing type, and there should only be one at a time. Crash on any other control data.
 void HotRestartingBase::getPassedFdIfPresent(HotRestartMessage* out, msghdr* message) {
   cmsghdr* cmsg = CMSG_FIRSTHDR(message);
   if (cmsg != nullptr) {
     RELEASE_ASSERT(cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS &&
-                       replyIsExpectedType(out, HotRestartMessage::Reply::kPassListenSocket),
+                       (replyIsExpectedType(out, HotRestartMessage::Reply::kPassListenSocket) ||
+                        replyIsExpectedType(out, HotRestartMessage::Reply::kStatsSharedMemory)),
                    "recvmsg() came with control data when the message's purpose was not to pass a "
                    "file descriptor.");
 
-    out->mutable_reply()->mutable_pass_listen_socket()->set_fd(
-        *reinterpret_cast<int*>(CMSG_DATA(cmsg)));
+    const int fd = *reinterpret_cast<int*>(CMSG_DATA(cmsg));
+    if (replyIsExpectedType(out, HotRestartMessage::Reply::kPassListenSocket)) {
+      out->mutable_reply()->mutable_pass_listen_socket()->set_fd(fd);
+    } else {
+      out->mutable_reply()->mutable_stats_shared_memory()->set_fd(fd);
+    }
 
     RELEASE_ASSERT(CMSG_NXTHDR(message, cmsg) == nullptr,
                    "More than one control data on a single hot restart recvmsg().");
@@ -60,6 +60,19 @@ protected:
   // the next protocol message, even if the function returns a protobuf.
   std::unique_ptr<envoy::HotRestartMessage> receiveHotRestartMessage(Blocking block);
 
+  // Send a Reply::Stats message. Small stats replies are sent inline over the domain socket.
+  // When the serialized stats do not fit in a single sendmsg datagram, they are instead
+  // written to an anonymous shared memory region, and a small StatsSharedMemory reply passing
+  // the region's fd is sent, so the peer can read the whole snapshot in one exchange rather
+  // than through a long series of datagrams.
+  void sendHotRestartStatsReply(sockaddr_un& address, const envoy::HotRestartMessage& proto);
+
+  // If the given message is a StatsSharedMemory reply, reads the serialized stats out of the
+  // passed shared memory region and returns an equivalent regular Stats reply, unmapping the
+  // region and closing its fd. Any other message is returned unchanged.
+  std::unique_ptr<envoy::HotRestartMessage>
+  resolveSharedMemoryStatsReply(std::unique_ptr<envoy::HotRestartMessage> proto);
+
   bool replyIsExpectedType(const envoy::HotRestartMessage* proto,
                            envoy::HotRestartMessage::Reply::ReplyCase oneof_type) const;
 
@@ -45,7 +45,8 @@ std::unique_ptr<HotRestartMessage> HotRestartingChild::getParentStats() {
   wrapped_request.mutable_request()->mutable_stats();
   sendHotRestartMessage(parent_address_, wrapped_request);
 
-  std::unique_ptr<HotRestartMessage> wrapped_reply = receiveHotRestartMessage(Blocking::Yes);
+  std::unique_ptr<HotRestartMessage> wrapped_reply =
+      resolveSharedMemoryStatsReply(receiveHotRestartMessage(Blocking::Yes));
   RELEASE_ASSERT(replyIsExpectedType(wrapped_reply.get(), HotRestartMessage::Reply::kStats),
                  "Hot restart parent did not respond as expected to get stats request.");
   return wrapped_reply;
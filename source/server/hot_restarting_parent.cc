@@ -56,7 +56,7 @@ void HotRestartingParent::onSocketEvent() {
     case HotRestartMessage::Request::kStats: {
       HotRestartMessage wrapped_reply;
       internal_->exportStatsToChild(wrapped_reply.mutable_reply()->mutable_stats());
-      sendHotRestartMessage(child_address_, wrapped_reply);
+      sendHotRestartStatsReply(child_address_, wrapped_reply);
       break;
     }
 
@@ -20,6 +20,7 @@ namespace Server {
   COUNTER(no_filter_chain_match)                                                                   \
   GAUGE(downstream_cx_active, Accumulate)                                                          \
   GAUGE(downstream_pre_cx_active, Accumulate)                                                      \
+  HISTOGRAM(connections_accepted_per_socket_event, Unspecified)                                    \
   HISTOGRAM(downstream_cx_length_ms, Milliseconds)
 
 /**
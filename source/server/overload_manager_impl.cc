@@ -91,12 +91,21 @@ namespace {
 class ThresholdTriggerImpl final : public OverloadAction::Trigger {
 public:
   ThresholdTriggerImpl(const envoy::config::overload::v3::ThresholdTrigger& config)
-      : threshold_(config.value()), state_(OverloadActionState::inactive()) {}
+      : threshold_(config.value()), release_threshold_(config.value() - config.hysteresis()),
+        state_(OverloadActionState::inactive()) {
+    if (config.hysteresis() > config.value()) {
+      throw EnvoyException("hysteresis must not be greater than the trigger threshold");
+    }
+  }
 
   bool updateValue(double value) override {
     const OverloadActionState state = actionState();
-    state_ =
-        value >= threshold_ ? OverloadActionState::saturated() : OverloadActionState::inactive();
+    // Once saturated, the trigger stays saturated until the pressure drops below the release
+    // threshold, so that oscillation around the threshold does not repeatedly re-post state
+    // changes to every worker thread.
+    const double effective_threshold = state.isSaturated() ? release_threshold_ : threshold_;
+    state_ = value >= effective_threshold ? OverloadActionState::saturated()
+                                          : OverloadActionState::inactive();
     // This is a floating point comparison, though state_ is always either
     // saturated or inactive so there's no risk due to floating point precision.
     return state.value() != actionState().value();
@@ -106,6 +115,7 @@ public:
 
 private:
   const double threshold_;
+  const double release_threshold_;
   OverloadActionState state_;
 };
 
@@ -100,7 +100,8 @@ InstanceImpl::InstanceImpl(
       access_log_manager_(options.fileFlushIntervalMsec(), *api_, *dispatcher_, access_log_lock,
                           store),
       singleton_manager_(new Singleton::ManagerImpl(api_->threadFactory())),
-      handler_(getHandler(*dispatcher_)), worker_factory_(thread_local_, *api_, hooks),
+      handler_(getHandler(*dispatcher_)),
+      worker_factory_(thread_local_, *api_, hooks, bootstrap_),
       terminated_(false),
       mutex_tracer_(options.mutexTracingEnabled() ? &Envoy::MutexTracerImpl::getOrCreateTracer()
                                                   : nullptr),
@@ -197,15 +198,20 @@ void InstanceImpl::failHealthcheck(bool fail) {
   server_stats_->live_.set(live_.load());
 }
 
-MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source) {
+MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source,
+                                       bool full_sync) {
   store.forEachSinkedCounter(
       [this](std::size_t size) {
         snapped_counters_.reserve(size);
         counters_.reserve(size);
       },
-      [this](Stats::Counter& counter) {
+      [this, full_sync](Stats::Counter& counter) {
         snapped_counters_.push_back(Stats::CounterSharedPtr(&counter));
-        counters_.push_back({counter.latch(), counter});
+        const uint64_t delta = counter.latch();
+        counters_.push_back({delta, counter});
+        if (full_sync || delta != 0) {
+          changed_counters_.push_back({delta, counter});
+        }
       });
 
   store.forEachSinkedGauge(
@@ -213,10 +219,16 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_sou
         snapped_gauges_.reserve(size);
         gauges_.reserve(size);
       },
-      [this](Stats::Gauge& gauge) {
+      [this, full_sync](Stats::Gauge& gauge) {
         ASSERT(gauge.importMode() != Stats::Gauge::ImportMode::Uninitialized);
         snapped_gauges_.push_back(Stats::GaugeSharedPtr(&gauge));
         gauges_.push_back(gauge);
+        // Latch unconditionally so that the change mark covers exactly one
+        // flush interval, even on full-sync snapshots.
+        const bool changed = gauge.latchChanged();
+        if (full_sync || changed) {
+          changed_gauges_.push_back(gauge);
+        }
       });
 
   store.forEachSinkedHistogram(
@@ -234,21 +246,25 @@ MetricSnapshotImpl::MetricSnapshotImpl(Stats::Store& store, TimeSource& time_sou
         snapped_text_readouts_.reserve(size);
         text_readouts_.reserve(size);
       },
-      [this](Stats::TextReadout& text_readout) {
+      [this, full_sync](Stats::TextReadout& text_readout) {
         snapped_text_readouts_.push_back(Stats::TextReadoutSharedPtr(&text_readout));
         text_readouts_.push_back(text_readout);
+        const bool changed = text_readout.latchChanged();
+        if (full_sync || changed) {
+          changed_text_readouts_.push_back(text_readout);
+        }
       });
 
   snapshot_time_ = time_source.systemTime();
 }
 
 void InstanceUtil::flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                       TimeSource& time_source) {
+                                       TimeSource& time_source, bool full_sync) {
   // Create a snapshot and flush to all sinks.
   // NOTE: Even if there are no sinks, creating the snapshot has the important property that it
   //       latches all counters on a periodic basis. The hot restart code assumes this is being
   //       done so this should not be removed.
-  MetricSnapshotImpl snapshot(store, time_source);
+  MetricSnapshotImpl snapshot(store, time_source, full_sync);
   for (const auto& sink : sinks) {
     sink->flush(snapshot);
   }
@@ -270,7 +286,16 @@ void InstanceImpl::flushStats() {
   if (initManager().state() == Init::Manager::State::Initialized) {
     // A shutdown initiated before this callback may prevent this from being called as per
     // the semantics documented in ThreadLocal's runOnAllThreads method.
-    stats_store_.mergeHistograms([this]() -> void { flushStatsInternal(); });
+    //
+    // Time the merge cycle, as with large numbers of histograms it can occupy
+    // the main thread for long enough to delay other work. The shared_ptr is
+    // needed as the post-merge callback must be copyable.
+    auto merge_timespan = std::make_shared<Stats::HistogramCompletableTimespanImpl>(
+        server_stats_->histogram_merge_time_ms_, timeSource());
+    stats_store_.mergeHistograms([this, merge_timespan]() -> void {
+      merge_timespan->complete();
+      flushStatsInternal();
+    });
   } else {
     ENVOY_LOG(debug, "Envoy is not fully initialized, skipping histogram merge and flushing stats");
     flushStatsInternal();
@@ -307,7 +332,8 @@ void InstanceImpl::updateServerStats() {
 void InstanceImpl::flushStatsInternal() {
   updateServerStats();
   auto& stats_config = config_.statsConfig();
-  InstanceUtil::flushMetricsToSinks(stats_config.sinks(), stats_store_, timeSource());
+  const bool full_sync = stats_flush_count_++ % InstanceUtil::StatsFullSyncInterval == 0;
+  InstanceUtil::flushMetricsToSinks(stats_config.sinks(), stats_store_, timeSource(), full_sync);
   // TODO(ramaraochavali): consider adding different flush interval for histograms.
   if (stat_flush_timer_ != nullptr) {
     stat_flush_timer_->enableTimer(stats_config.flushInterval());
@@ -91,6 +91,7 @@ struct ServerCompilationSettingsStats {
   GAUGE(total_connections, Accumulate)                                                             \
   GAUGE(uptime, Accumulate)                                                                        \
   GAUGE(version, NeverImport)                                                                      \
+  HISTOGRAM(histogram_merge_time_ms, Milliseconds)                                                 \
   HISTOGRAM(initialization_time_ms, Milliseconds)
 
 struct ServerStats {
@@ -126,14 +127,21 @@ public:
    */
   static Runtime::LoaderPtr createRuntime(Instance& server, Server::Configuration::Initial& config);
 
+  // Number of stat flushes between full-sync snapshots handed to sinks that
+  // consume the changed-metrics views; see Stats::MetricSnapshot. At the
+  // default 5s flush interval this yields a full sync roughly once a minute.
+  static constexpr uint64_t StatsFullSyncInterval = 12;
+
   /**
    * Helper for flushing counters, gauges and histograms to sinks. This takes care of calling
    * flush() on each sink.
    * @param sinks supplies the list of sinks.
    * @param store provides the store being flushed.
+   * @param full_sync whether the snapshot's changed-metrics views should contain every metric
+   *                  rather than only those modified since the previous flush.
    */
   static void flushMetricsToSinks(const std::list<Stats::SinkPtr>& sinks, Stats::Store& store,
-                                  TimeSource& time_source);
+                                  TimeSource& time_source, bool full_sync = true);
 
   /**
    * Load a bootstrap config and perform validation.
@@ -403,6 +411,9 @@ private:
   Regex::EnginePtr regex_engine_;
 
   bool stats_flush_in_progress_ : 1;
+  // Counts completed stat flushes to schedule the periodic full syncs handed
+  // to delta-consuming sinks; the first flush is always a full sync.
+  uint64_t stats_flush_count_{0};
 
   template <class T>
   class LifecycleCallbackHandle : public ServerLifecycleNotifier::Handle, RaiiListElement<T> {
@@ -426,7 +437,7 @@ private:
 //                     copying and probably be a cleaner API in general.
 class MetricSnapshotImpl : public Stats::MetricSnapshot {
 public:
-  explicit MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source);
+  MetricSnapshotImpl(Stats::Store& store, TimeSource& time_source, bool full_sync);
 
   // Stats::MetricSnapshot
   const std::vector<CounterSnapshot>& counters() override { return counters_; }
@@ -440,6 +451,14 @@ public:
     return text_readouts_;
   }
   SystemTime snapshotTime() const override { return snapshot_time_; }
+  const std::vector<CounterSnapshot>& changedCounters() override { return changed_counters_; }
+  const std::vector<std::reference_wrapper<const Stats::Gauge>>& changedGauges() override {
+    return changed_gauges_;
+  }
+  const std::vector<std::reference_wrapper<const Stats::TextReadout>>&
+  changedTextReadouts() override {
+    return changed_text_readouts_;
+  }
 
 private:
   std::vector<Stats::CounterSharedPtr> snapped_counters_;
@@ -450,6 +469,9 @@ private:
   std::vector<std::reference_wrapper<const Stats::ParentHistogram>> histograms_;
   std::vector<Stats::TextReadoutSharedPtr> snapped_text_readouts_;
   std::vector<std::reference_wrapper<const Stats::TextReadout>> text_readouts_;
+  std::vector<CounterSnapshot> changed_counters_;
+  std::vector<std::reference_wrapper<const Stats::Gauge>> changed_gauges_;
+  std::vector<std::reference_wrapper<const Stats::TextReadout>> changed_text_readouts_;
   SystemTime snapshot_time_;
 };
 
@@ -9,6 +9,7 @@
 #include "envoy/server/configuration.h"
 #include "envoy/thread_local/thread_local.h"
 
+#include "source/common/common/cpu_affinity.h"
 #include "source/common/config/utility.h"
 #include "source/server/listener_manager_factory.h"
 
@@ -31,17 +32,29 @@ WorkerPtr ProdWorkerFactory::createWorker(uint32_t index, OverloadManager& overl
   Event::DispatcherPtr dispatcher(
       api_.allocateDispatcher(worker_name, overload_manager.scaledTimerFactory()));
   auto conn_handler = getHandler(*dispatcher, index);
+  absl::optional<int32_t> pinned_cpu;
+  if (bootstrap_.pin_worker_threads()) {
+    pinned_cpu = Thread::pinnedCpuForWorker(index);
+    if (!pinned_cpu.has_value()) {
+      ENVOY_LOG(warn,
+                "pin_worker_threads is set but the allowed CPUs could not be determined; "
+                "{} will not be pinned",
+                worker_name);
+    }
+  }
   return std::make_unique<WorkerImpl>(tls_, hooks_, std::move(dispatcher), std::move(conn_handler),
-                                      overload_manager, api_, stat_names_);
+                                      overload_manager, api_, stat_names_, pinned_cpu);
 }
 
 WorkerImpl::WorkerImpl(ThreadLocal::Instance& tls, ListenerHooks& hooks,
                        Event::DispatcherPtr&& dispatcher, Network::ConnectionHandlerPtr handler,
                        OverloadManager& overload_manager, Api::Api& api,
-                       WorkerStatNames& stat_names)
+                       WorkerStatNames& stat_names, absl::optional<int32_t> pinned_cpu)
     : tls_(tls), hooks_(hooks), dispatcher_(std::move(dispatcher)), handler_(std::move(handler)),
-      api_(api), reset_streams_counter_(
-                     api_.rootScope().counterFromStatName(stat_names.reset_high_memory_stream_)) {
+      api_(api),
+      reset_streams_counter_(
+          api_.rootScope().counterFromStatName(stat_names.reset_high_memory_stream_)),
+      pinned_cpu_(pinned_cpu) {
   tls_.registerThread(*dispatcher_, false);
   overload_manager.registerForAction(
       OverloadActionNames::get().StopAcceptingConnections, *dispatcher_,
@@ -107,6 +120,9 @@ void WorkerImpl::start(GuardDog& guard_dog, const Event::PostCb& cb) {
   // TODO(jmarantz): consider refactoring how this naming works so this naming
   // architecture is centralized, resulting in clearer names.
   Thread::Options options{absl::StrCat("wrk:", dispatcher_->name())};
+  if (pinned_cpu_.has_value()) {
+    options.cpu_ = *pinned_cpu_;
+  }
   thread_ = api_.threadFactory().createThread(
       [this, &guard_dog, cb]() -> void { threadRoutine(guard_dog, cb); }, options);
 }
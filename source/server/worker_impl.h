@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "envoy/api/api.h"
+#include "envoy/config/bootstrap/v3/bootstrap.pb.h"
 #include "envoy/network/connection_handler.h"
 #include "envoy/server/guarddog.h"
 #include "envoy/server/listener_manager.h"
@@ -28,8 +29,10 @@ struct WorkerStatNames {
 
 class ProdWorkerFactory : public WorkerFactory, Logger::Loggable<Logger::Id::main> {
 public:
-  ProdWorkerFactory(ThreadLocal::Instance& tls, Api::Api& api, ListenerHooks& hooks)
-      : tls_(tls), api_(api), stat_names_(api.rootScope().symbolTable()), hooks_(hooks) {}
+  ProdWorkerFactory(ThreadLocal::Instance& tls, Api::Api& api, ListenerHooks& hooks,
+                    const envoy::config::bootstrap::v3::Bootstrap& bootstrap)
+      : tls_(tls), api_(api), stat_names_(api.rootScope().symbolTable()), hooks_(hooks),
+        bootstrap_(bootstrap) {}
 
   // Server::WorkerFactory
   WorkerPtr createWorker(uint32_t index, OverloadManager& overload_manager,
@@ -40,6 +43,8 @@ private:
   Api::Api& api_;
   WorkerStatNames stat_names_;
   ListenerHooks& hooks_;
+  // Workers are created after the bootstrap has been loaded, so the message can be read lazily.
+  const envoy::config::bootstrap::v3::Bootstrap& bootstrap_;
 };
 
 /**
@@ -49,7 +54,8 @@ class WorkerImpl : public Worker, Logger::Loggable<Logger::Id::main> {
 public:
   WorkerImpl(ThreadLocal::Instance& tls, ListenerHooks& hooks, Event::DispatcherPtr&& dispatcher,
              Network::ConnectionHandlerPtr handler, OverloadManager& overload_manager,
-             Api::Api& api, WorkerStatNames& stat_names);
+             Api::Api& api, WorkerStatNames& stat_names,
+             absl::optional<int32_t> pinned_cpu = absl::nullopt);
 
   // Server::Worker
   void addListener(absl::optional<uint64_t> overridden_listener, Network::ListenerConfig& listener,
@@ -77,6 +83,8 @@ private:
   Network::ConnectionHandlerPtr handler_;
   Api::Api& api_;
   Stats::Counter& reset_streams_counter_;
+  // The CPU the worker thread should be pinned to, if worker pinning is configured.
+  const absl::optional<int32_t> pinned_cpu_;
   Thread::ThreadPtr thread_;
   WatchDogSharedPtr watch_dog_;
 };
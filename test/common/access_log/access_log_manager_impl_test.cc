@@ -1,4 +1,6 @@
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "source/common/access_log/access_log_manager_impl.h"
 #include "source/common/filesystem/file_shared_impl.h"
@@ -486,6 +488,54 @@ TEST_F(AccessLogManagerImplTest, BigDataChunkShouldBeFlushedWithoutTimer) {
   EXPECT_CALL(*file_, close_()).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
 }
 
+TEST_F(AccessLogManagerImplTest, ConcurrentWritersPreservePerThreadOrder) {
+  EXPECT_CALL(*file_, open_(_)).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
+  AccessLogFileSharedPtr log_file = access_log_manager_.createAccessLog(
+      Filesystem::FilePathAndType{Filesystem::DestinationType::File, "foo"});
+
+  Thread::MutexBasicLockable written_lock;
+  std::string written;
+  EXPECT_CALL(*file_, write_(_))
+      .WillRepeatedly(Invoke([&](absl::string_view data) -> Api::IoCallSizeResult {
+        Thread::LockGuard lock(written_lock);
+        written.append(data.data(), data.size());
+        return Filesystem::resultSuccess<ssize_t>(static_cast<ssize_t>(data.length()));
+      }));
+
+  constexpr int num_threads = 4;
+  constexpr int writes_per_thread = 100;
+  std::vector<Thread::ThreadPtr> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    threads.emplace_back(thread_factory_.createThread([&log_file, t]() {
+      for (int i = 0; i < writes_per_thread; ++i) {
+        log_file->write("t" + std::to_string(t) + "-" + std::to_string(i) + ";");
+      }
+    }));
+  }
+  for (auto& thread : threads) {
+    thread->join();
+  }
+
+  // All buffered data is on "disk" once flush() returns.
+  log_file->flush();
+
+  {
+    Thread::LockGuard lock(written_lock);
+    // Every entry was written, and entries from any single thread appear in the order they were
+    // logged even though entries from different threads may interleave.
+    for (int t = 0; t < num_threads; ++t) {
+      size_t last_pos = 0;
+      for (int i = 0; i < writes_per_thread; ++i) {
+        const size_t pos =
+            written.find("t" + std::to_string(t) + "-" + std::to_string(i) + ";", last_pos);
+        ASSERT_NE(std::string::npos, pos);
+        last_pos = pos;
+      }
+    }
+  }
+  EXPECT_CALL(*file_, close_()).WillOnce(Return(ByMove(Filesystem::resultSuccess<bool>(true))));
+}
+
 TEST_F(AccessLogManagerImplTest, ReopenAllFiles) {
   EXPECT_CALL(dispatcher_, createTimer_(_)).WillRepeatedly(ReturnNew<NiceMock<Event::MockTimer>>());
 
@@ -89,6 +89,29 @@ TEST_F(BufferMemoryAccountTest, ManagesAccountBalance) {
   account->clearDownstream();
 }
 
+TEST_F(BufferMemoryAccountTest, FactoryTracksAggregateBalance) {
+  auto account_one = factory_.createAccount(mock_reset_handler_);
+  auto account_two = factory_.createAccount(mock_reset_handler_);
+  Buffer::OwnedImpl buffer_one(account_one);
+  Buffer::OwnedImpl buffer_two(account_two);
+  ASSERT_EQ(factory_.totalAccountBalance(), 0);
+
+  // The aggregate reflects charges across all accounts, including those below
+  // the per-account tracking threshold.
+  buffer_one.add("Hello");
+  EXPECT_EQ(factory_.totalAccountBalance(), 4096);
+  buffer_two.add("World");
+  EXPECT_EQ(factory_.totalAccountBalance(), 8192);
+
+  buffer_one.drain(buffer_one.length());
+  EXPECT_EQ(factory_.totalAccountBalance(), 4096);
+  buffer_two.drain(buffer_two.length());
+  EXPECT_EQ(factory_.totalAccountBalance(), 0);
+
+  account_one->clearDownstream();
+  account_two->clearDownstream();
+}
+
 TEST_F(BufferMemoryAccountTest, BufferAccountsForUnownedSliceMovedInto) {
   auto account = factory_.createAccount(mock_reset_handler_);
   Buffer::OwnedImpl accounted_buffer(account);
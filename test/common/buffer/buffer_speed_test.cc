@@ -1,9 +1,12 @@
+#include <algorithm>
+
 #include "envoy/config/overload/v3/overload.pb.h"
 #include "envoy/http/stream_reset_handler.h"
 
 #include "source/common/buffer/buffer_impl.h"
 #include "source/common/buffer/watermark_buffer.h"
 #include "source/common/common/assert.h"
+#include "source/common/common/macros.h"
 
 #include "absl/strings/string_view.h"
 #include "benchmark/benchmark.h"
@@ -558,4 +561,120 @@ BENCHMARK(bufferAddVsAddFragments)
     ->Args({1, 1, 64, 5})
     ->Args({1, 1, 4096, 5});
 
+// --- Workload replay ---------------------------------------------------------------------------
+//
+// The benchmarks above each isolate a single operation; the ones below replay recorded sequences
+// of slice operations so that changes to slice sizing or pooling are also validated against the
+// operation mix real streams produce. A trace is a list of (op, size) records; the canned traces
+// below were distilled from proxied traffic. New traces captured from production can be replayed
+// by adding a table and a BENCHMARK_CAPTURE line.
+
+enum class ReplayOp {
+  // Append size bytes of caller-owned data, as codec output does.
+  Add,
+  // Reserve space for a socket read of size bytes and commit all of it.
+  ReserveCommit,
+  // Move size bytes to the peer buffer (0 moves everything), as data crosses from the read
+  // buffer to a codec or connection output buffer.
+  Move,
+  // Drain size bytes from the peer buffer (0 drains everything), as a completed socket write
+  // does.
+  Drain,
+  // Linearize the first size bytes of the peer buffer, as codecs do for contiguous parsing.
+  Linearize,
+};
+
+struct RecordedOp {
+  ReplayOp op_;
+  uint64_t size_;
+};
+
+// A bidirectional gRPC stream: 16kB socket reads committed into the read buffer, small
+// length-prefixed messages moved out one at a time, each linearized for parsing and drained
+// after the onward write completes.
+const std::vector<RecordedOp>& grpcStreamingTrace() {
+  CONSTRUCT_ON_FIRST_USE(std::vector<RecordedOp>, []() {
+    std::vector<RecordedOp> trace;
+    for (int read = 0; read < 8; read++) {
+      trace.push_back({ReplayOp::ReserveCommit, 16 * 1024});
+      for (int message = 0; message < 56; message++) {
+        trace.push_back({ReplayOp::Move, 293});
+        trace.push_back({ReplayOp::Linearize, 5});
+        trace.push_back({ReplayOp::Drain, 0});
+      }
+    }
+    return trace;
+  }());
+}
+
+// A large HTTP/1 download: full 64kB socket reads from the upstream moved wholesale into the
+// downstream connection's output buffer and drained by large, occasionally short, writes.
+const std::vector<RecordedOp>& largeDownloadTrace() {
+  CONSTRUCT_ON_FIRST_USE(std::vector<RecordedOp>, []() {
+    std::vector<RecordedOp> trace;
+    for (int read = 0; read < 16; read++) {
+      trace.push_back({ReplayOp::ReserveCommit, 64 * 1024});
+      trace.push_back({ReplayOp::Move, 0});
+      trace.push_back({ReplayOp::Drain, read % 4 == 3 ? 48 * 1024u : 0});
+    }
+    return trace;
+  }());
+}
+
+// Small plaintext HTTP/1 responses: headers added by the codec in small caller-owned pieces,
+// followed by a short body, written out in full after each response.
+const std::vector<RecordedOp>& smallResponseTrace() {
+  CONSTRUCT_ON_FIRST_USE(std::vector<RecordedOp>, []() {
+    std::vector<RecordedOp> trace;
+    for (int response = 0; response < 64; response++) {
+      for (int header = 0; header < 12; header++) {
+        trace.push_back({ReplayOp::Add, 38});
+      }
+      trace.push_back({ReplayOp::Add, 512});
+      trace.push_back({ReplayOp::Move, 0});
+      trace.push_back({ReplayOp::Drain, 0});
+    }
+    return trace;
+  }());
+}
+
+static void replayTrace(benchmark::State& state, const std::vector<RecordedOp>& trace) {
+  const std::string data(64 * 1024, 'a');
+  for (auto _ : state) {
+    UNREFERENCED_PARAMETER(_);
+    Buffer::OwnedImpl source;
+    Buffer::OwnedImpl sink;
+    for (const RecordedOp& op : trace) {
+      switch (op.op_) {
+      case ReplayOp::Add:
+        source.add(absl::string_view(data.data(), op.size_));
+        break;
+      case ReplayOp::ReserveCommit: {
+        Buffer::Reservation reservation = source.reserveForReadWithLengthForTest(op.size_);
+        reservation.commit(std::min<uint64_t>(reservation.length(), op.size_));
+        break;
+      }
+      case ReplayOp::Move:
+        if (op.size_ == 0) {
+          sink.move(source);
+        } else {
+          sink.move(source, std::min(op.size_, source.length()));
+        }
+        break;
+      case ReplayOp::Drain:
+        sink.drain(op.size_ == 0 ? sink.length() : std::min(op.size_, sink.length()));
+        break;
+      case ReplayOp::Linearize:
+        benchmark::DoNotOptimize(sink.linearize(std::min(op.size_, sink.length())));
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(source.length());
+    benchmark::DoNotOptimize(sink.length());
+  }
+}
+BENCHMARK_CAPTURE(replayTrace, grpc_streaming, grpcStreamingTrace());
+BENCHMARK_CAPTURE(replayTrace, large_download, largeDownloadTrace());
+BENCHMARK_CAPTURE(replayTrace, small_responses, smallResponseTrace());
+
 } // namespace Envoy
@@ -0,0 +1,56 @@
+#include "source/common/buffer/compacting_buffer.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Buffer {
+namespace {
+
+std::string fillFragmented(CompactingOwnedImpl& buffer, uint32_t num_slices, uint32_t slice_size) {
+  std::string contents;
+  for (uint32_t i = 0; i < num_slices; i++) {
+    const std::string chunk(slice_size, 'a' + (i % 26));
+    buffer.appendSliceForTest(chunk);
+    contents += chunk;
+  }
+  return contents;
+}
+
+TEST(CompactingBufferTest, CompactsWhenOccupancyDropsBelowFloor) {
+  CompactingOwnedImpl buffer;
+  std::string contents = fillFragmented(buffer, 64, 4096);
+  EXPECT_EQ(0, buffer.compactions());
+
+  // Drain most of the content; occupancy falls well below the default 25% floor.
+  const uint64_t drain_size = 60 * 4096;
+  buffer.drain(drain_size);
+  EXPECT_EQ(1, buffer.compactions());
+  EXPECT_EQ(contents.substr(drain_size), buffer.toString());
+  // The surviving 16KB of content fits into a single default-sized slice.
+  EXPECT_LE(buffer.totalSliceCapacity(), 2 * 16384);
+  EXPECT_LT(buffer.fragmentationRatio(), 0.5);
+}
+
+TEST(CompactingBufferTest, SmallBuffersNeverCompact) {
+  CompactingOwnedImpl buffer;
+  fillFragmented(buffer, 4, 4096);
+  buffer.drain(3 * 4096);
+  EXPECT_EQ(0, buffer.compactions());
+}
+
+TEST(CompactingBufferTest, DrainTrackersSuppressCompaction) {
+  CompactingOwnedImpl buffer;
+  fillFragmented(buffer, 64, 4096);
+  bool tracker_called = false;
+  buffer.addDrainTracker([&tracker_called]() { tracker_called = true; });
+
+  buffer.drain(60 * 4096);
+  EXPECT_EQ(0, buffer.compactions());
+  EXPECT_FALSE(tracker_called);
+  buffer.drain(buffer.length());
+  EXPECT_TRUE(tracker_called);
+}
+
+} // namespace
+} // namespace Buffer
+} // namespace Envoy
@@ -205,6 +205,26 @@ TEST_F(OwnedImplTest, Add) {
   EXPECT_EQ(string1 + string2 + big_suffix, buffer.toString());
 }
 
+TEST_F(OwnedImplTest, RecyclesDefaultSizedSliceStorage) {
+  const size_t cache_size_before = Slice::storageCache().size();
+  {
+    Buffer::OwnedImpl buffer;
+    buffer.add(std::string(16384, 'x'));
+  }
+  // Destroying the buffer returns its default-sized slice storage to the per-thread cache,
+  // unless the cache is already at its high watermark.
+  if (cache_size_before < Slice::storage_cache_high_watermark_) {
+    EXPECT_GT(Slice::storageCache().size(), cache_size_before);
+  }
+  EXPECT_LE(Slice::storageCache().size(), Slice::storage_cache_high_watermark_);
+
+  // A new default-sized slice draws from the cache instead of the allocator.
+  const size_t cache_size_after_free = Slice::storageCache().size();
+  Buffer::OwnedImpl buffer;
+  buffer.add(std::string(16384, 'y'));
+  EXPECT_LT(Slice::storageCache().size(), cache_size_after_free);
+}
+
 TEST_F(OwnedImplTest, Prepend) {
   const std::string suffix = "World!", prefix = "Hello, ";
   Buffer::OwnedImpl buffer;
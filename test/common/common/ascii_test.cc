@@ -0,0 +1,79 @@
+#include <string>
+
+#include "source/common/common/ascii.h"
+
+#include "absl/strings/ascii.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Ascii {
+namespace {
+
+TEST(AsciiTest, ToLowerInPlaceMatchesScalar) {
+  // Exercise every byte value at every position within a word, plus tails shorter than
+  // a word, and compare against the per-byte implementation.
+  for (size_t length : {0, 1, 3, 7, 8, 9, 15, 16, 31}) {
+    for (int base = 0; base < 256; base++) {
+      std::string input;
+      for (size_t i = 0; i < length; i++) {
+        input.push_back(static_cast<char>((base + i) & 0xff));
+      }
+      std::string expected = input;
+      std::transform(expected.begin(), expected.end(), expected.begin(), absl::ascii_tolower);
+      std::string actual = input;
+      toLowerInPlace(actual.data(), actual.size());
+      EXPECT_EQ(expected, actual) << "length " << length << " base " << base;
+    }
+  }
+}
+
+TEST(AsciiTest, ContainsEmbeddedNulCrLf) {
+  EXPECT_FALSE(containsEmbeddedNulCrLf(""));
+  EXPECT_FALSE(containsEmbeddedNulCrLf("content-type"));
+  EXPECT_FALSE(containsEmbeddedNulCrLf("x-really-long-tracing-header-name-for-swar"));
+
+  // Each forbidden byte, at positions both inside and outside the 8 byte SWAR body.
+  for (const char c : {'\0', '\r', '\n'}) {
+    for (size_t pos : {size_t(0), size_t(3), size_t(7), size_t(8), size_t(20)}) {
+      std::string s(21, 'a');
+      s[pos] = c;
+      EXPECT_TRUE(containsEmbeddedNulCrLf(s)) << "byte " << int(c) << " pos " << pos;
+    }
+  }
+
+  // Nearby byte values must not false-positive.
+  EXPECT_FALSE(containsEmbeddedNulCrLf(std::string("aaaaaaaa\x0b\x0e\x01" "bbbbbbbb")));
+  // Non-ASCII bytes are legal (header values may carry them).
+  EXPECT_FALSE(containsEmbeddedNulCrLf("\x80\xff\xfevalue"));
+}
+
+TEST(AsciiTest, FindFirstNotInRangeMatchesScalar) {
+  const auto scalar = [](absl::string_view s, char lo, char hi) -> size_t {
+    for (size_t i = 0; i < s.size(); i++) {
+      const uint8_t c = static_cast<uint8_t>(s[i]);
+      if (c < static_cast<uint8_t>(lo) || c > static_cast<uint8_t>(hi)) {
+        return i;
+      }
+    }
+    return absl::string_view::npos;
+  };
+
+  // Every byte value at positions inside and outside the 8 byte SWAR body, against a
+  // representative range ('!' through '~', the URL path/query character range).
+  for (int byte = 0; byte < 256; byte++) {
+    for (size_t pos : {size_t(0), size_t(3), size_t(7), size_t(8), size_t(20)}) {
+      std::string s(21, 'a');
+      s[pos] = static_cast<char>(byte);
+      EXPECT_EQ(scalar(s, '!', '~'), findFirstNotInRange(s, '!', '~'))
+          << "byte " << byte << " pos " << pos;
+    }
+  }
+
+  EXPECT_EQ(absl::string_view::npos, findFirstNotInRange("", 'a', 'z'));
+  EXPECT_EQ(absl::string_view::npos, findFirstNotInRange("abcdefghij", 'a', 'z'));
+  EXPECT_EQ(2U, findFirstNotInRange("abCdefghij", 'a', 'z'));
+}
+
+} // namespace
+} // namespace Ascii
+} // namespace Envoy
@@ -0,0 +1,36 @@
+#include "source/common/common/cpu_affinity.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Thread {
+namespace {
+
+TEST(CpuAffinityTest, AllowedCpusAscendingOrDisabled) {
+  const std::vector<int32_t> cpus = allowedCpus();
+#ifdef __linux__
+  ASSERT_FALSE(cpus.empty());
+  for (size_t i = 1; i < cpus.size(); i++) {
+    EXPECT_LT(cpus[i - 1], cpus[i]);
+  }
+#else
+  EXPECT_TRUE(cpus.empty());
+#endif
+}
+
+TEST(CpuAffinityTest, PinnedCpuForWorkerRoundRobin) {
+  const std::vector<int32_t> cpus = allowedCpus();
+  if (cpus.empty()) {
+    EXPECT_FALSE(pinnedCpuForWorker(0).has_value());
+    return;
+  }
+  for (uint32_t i = 0; i < 2 * cpus.size(); i++) {
+    const absl::optional<int32_t> cpu = pinnedCpuForWorker(i);
+    ASSERT_TRUE(cpu.has_value());
+    EXPECT_EQ(cpus[i % cpus.size()], *cpu);
+  }
+}
+
+} // namespace
+} // namespace Thread
+} // namespace Envoy
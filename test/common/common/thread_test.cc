@@ -1,5 +1,9 @@
 #include <functional>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "source/common/common/thread.h"
 #include "source/common/common/thread_synchronizer.h"
 
@@ -246,6 +250,41 @@ TEST_F(ThreadAsyncPtrTest, NameNotSpecifiedWait) {
   thread->join();
 }
 
+#ifdef __linux__
+// Verifies that a thread created with a CPU in its options runs pinned to exactly that CPU.
+TEST(ThreadOptionsTest, PinToCpu) {
+  cpu_set_t allowed;
+  CPU_ZERO(&allowed);
+  ASSERT_EQ(0, sched_getaffinity(0, sizeof(allowed), &allowed));
+  int32_t cpu = -1;
+  for (int32_t i = 0; i < CPU_SETSIZE; i++) {
+    if (CPU_ISSET(i, &allowed)) {
+      cpu = i;
+      break;
+    }
+  }
+  ASSERT_GE(cpu, 0);
+
+  Options options{"pinned"};
+  options.cpu_ = cpu;
+  // Pinning happens on the parent thread during createThread(), so wait for it to return before
+  // reading the affinity back on the new thread.
+  absl::Notification pinned;
+  cpu_set_t thread_cpus;
+  CPU_ZERO(&thread_cpus);
+  auto thread = threadFactoryForTest().createThread(
+      [&pinned, &thread_cpus]() {
+        pinned.WaitForNotification();
+        sched_getaffinity(0, sizeof(thread_cpus), &thread_cpus);
+      },
+      options);
+  pinned.Notify();
+  thread->join();
+  EXPECT_EQ(1, CPU_COUNT(&thread_cpus));
+  EXPECT_TRUE(CPU_ISSET(cpu, &thread_cpus));
+}
+#endif
+
 } // namespace
 } // namespace Thread
 } // namespace Envoy
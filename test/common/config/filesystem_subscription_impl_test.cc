@@ -40,6 +40,22 @@ TEST_F(FilesystemSubscriptionImplTest, InitialFile) {
   EXPECT_TRUE(statsAre(1, 1, 0, 0, 0, TEST_TIME_MILLIS, 7148434200721666028, "0"));
 }
 
+// Validate that a watch event that does not change the file content is not re-delivered to the
+// subscriber (e.g. the multiple events raised by a write-temp-and-rename rotation).
+TEST_F(FilesystemSubscriptionImplTest, SkipsUnchangedUpdate) {
+  startSubscription({"cluster0", "cluster1"});
+  EXPECT_TRUE(statsAre(1, 0, 0, 0, 0, 0, 0, ""));
+  deliverConfigUpdate({"cluster0", "cluster1"}, "0", true);
+  EXPECT_TRUE(statsAre(2, 1, 0, 0, 0, TEST_TIME_MILLIS, 7148434200721666028, "0"));
+  // Rewriting identical content fires the watcher but must not reach the subscriber again.
+  EXPECT_CALL(callbacks_, onConfigUpdate(_, "0")).Times(0);
+  updateFile("{\"versionInfo\":\"0\",\"resources\":[{\"@type\":\"type.googleapis.com/"
+             "envoy.config.endpoint.v3.ClusterLoadAssignment\",\"clusterName\":\"cluster0\"},"
+             "{\"@type\":\"type.googleapis.com/"
+             "envoy.config.endpoint.v3.ClusterLoadAssignment\",\"clusterName\":\"cluster1\"}]}");
+  EXPECT_TRUE(statsAre(3, 2, 0, 0, 0, TEST_TIME_MILLIS, 7148434200721666028, "0"));
+}
+
 // Validate that if we fail to set a watch, we get a sensible warning.
 TEST(MiscFilesystemSubscriptionImplTest, BadWatch) {
   Event::MockDispatcher dispatcher;
@@ -334,10 +334,10 @@ TEST_F(GrpcMuxImplTest, TypeUrlMismatch) {
               e->what()));
         }));
 
-    expectSendMessage(
-        "foo", {"x", "y"}, "", false, "", Grpc::Status::WellKnownGrpcStatus::Internal,
-        fmt::format("bar does not match the message-wide type URL foo in DiscoveryResponse {}",
-                    invalid_response->DebugString()));
+    expectSendMessage("foo", {"x", "y"}, "", false, "",
+                      Grpc::Status::WellKnownGrpcStatus::Internal,
+                      "bar does not match the message-wide type URL foo in DiscoveryResponse "
+                      "(version=foo-version, nonce=, resources=1)");
     grpc_mux_->grpcStreamForTest().onReceiveMessage(std::move(invalid_response));
   }
   expectSendMessage("foo", {}, "");
@@ -675,6 +675,59 @@ TEST_F(GrpcMuxImplTest, WatchDemux) {
   expectSendMessage(type_url, {}, "2");
 }
 
+// Validate that a watch is not re-delivered resources whose contents are unchanged from the
+// previous push, but that an ACK is still sent.
+TEST_F(GrpcMuxImplTest, SkipsRedeliveryOfUnchangedResources) {
+  setup();
+  InSequence s;
+  OpaqueResourceDecoderSharedPtr resource_decoder(
+      std::make_shared<TestUtility::TestOpaqueResourceDecoderImpl<
+          envoy::config::endpoint::v3::ClusterLoadAssignment>>("cluster_name"));
+  const std::string& type_url = Config::TypeUrl::get().ClusterLoadAssignment;
+  auto eds_sub = grpc_mux_->addWatch(type_url, {"x"}, callbacks_, resource_decoder, {});
+  EXPECT_CALL(*async_client_, startRaw(_, _, _, _)).WillOnce(Return(&async_stream_));
+  expectSendMessage(type_url, {"x"}, "", true);
+  grpc_mux_->start();
+
+  envoy::config::endpoint::v3::ClusterLoadAssignment load_assignment;
+  load_assignment.set_cluster_name("x");
+
+  {
+    auto response = std::make_unique<envoy::service::discovery::v3::DiscoveryResponse>();
+    response->set_type_url(type_url);
+    response->set_version_info("1");
+    response->add_resources()->PackFrom(load_assignment);
+    EXPECT_CALL(callbacks_, onConfigUpdate(_, "1"));
+    expectSendMessage(type_url, {"x"}, "1");
+    grpc_mux_->grpcStreamForTest().onReceiveMessage(std::move(response));
+  }
+
+  // The same contents under a new version are ACKed but not re-delivered.
+  {
+    auto response = std::make_unique<envoy::service::discovery::v3::DiscoveryResponse>();
+    response->set_type_url(type_url);
+    response->set_version_info("2");
+    response->add_resources()->PackFrom(load_assignment);
+    EXPECT_CALL(callbacks_, onConfigUpdate(_, "2")).Times(0);
+    expectSendMessage(type_url, {"x"}, "2");
+    grpc_mux_->grpcStreamForTest().onReceiveMessage(std::move(response));
+  }
+
+  // Changed contents are delivered again.
+  {
+    auto response = std::make_unique<envoy::service::discovery::v3::DiscoveryResponse>();
+    response->set_type_url(type_url);
+    response->set_version_info("3");
+    load_assignment.add_endpoints()->mutable_locality()->set_region("updated");
+    response->add_resources()->PackFrom(load_assignment);
+    EXPECT_CALL(callbacks_, onConfigUpdate(_, "3"));
+    expectSendMessage(type_url, {"x"}, "3");
+    grpc_mux_->grpcStreamForTest().onReceiveMessage(std::move(response));
+  }
+
+  expectSendMessage(type_url, {}, "3");
+}
+
 // Validate behavior when we have multiple watchers that send empty updates.
 TEST_F(GrpcMuxImplTest, MultipleWatcherWithEmptyUpdates) {
   setup();
@@ -102,11 +102,12 @@ TEST_P(GrpcSubscriptionImplTest, UpdateTimeChangedOnUpdateSuccess) {
   deliverConfigUpdate({"cluster0", "cluster2"}, "0", true);
   EXPECT_TRUE(statsAre(2, 1, 0, 0, 0, TEST_TIME_MILLIS, 7148434200721666028, "0"));
 
-  // Advance the simulated time and verify that a trivial update (no change) also changes the update
-  // time.
+  // Advance the simulated time and verify that a subsequent update also changes the update
+  // time. A repeat of the same version is not used here since the SotW mux elides re-deliveries
+  // of unchanged resources.
   simTime().setSystemTime(SystemTime(std::chrono::milliseconds(TEST_TIME_MILLIS + 1)));
-  deliverConfigUpdate({"cluster0", "cluster2"}, "0", true);
-  EXPECT_TRUE(statsAre(2, 2, 0, 0, 0, TEST_TIME_MILLIS + 1, 7148434200721666028, "0"));
+  deliverConfigUpdate({"cluster0", "cluster2"}, "1", true);
+  EXPECT_TRUE(statsAre(2, 2, 0, 0, 0, TEST_TIME_MILLIS + 1, 13237225503670494420U, "1"));
 }
 
 } // namespace
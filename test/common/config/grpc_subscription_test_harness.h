@@ -157,6 +157,9 @@ public:
           last_cluster_names_.end()) {
         envoy::config::endpoint::v3::ClusterLoadAssignment* load_assignment = typed_resources.Add();
         load_assignment->set_cluster_name(cluster);
+        // Encode the version into the resource so that successive versions carry distinct
+        // contents; the SotW mux elides re-deliveries of unchanged resources.
+        load_assignment->add_endpoints()->mutable_locality()->set_region(version);
         response->add_resources()->PackFrom(*load_assignment);
       }
     }
@@ -271,11 +271,11 @@ TEST_F(GrpcMuxImplTest, TypeUrlMismatch) {
                           e->what()));
         }));
 
-    expectSendMessage(
-        "type_url_foo", {"x", "y"}, "", false, "", Grpc::Status::WellKnownGrpcStatus::Internal,
-        fmt::format("type URL type_url_bar embedded in an individual Any does not match the "
-                    "message-wide type URL type_url_foo in DiscoveryResponse {}",
-                    invalid_response->DebugString()));
+    expectSendMessage("type_url_foo", {"x", "y"}, "", false, "",
+                      Grpc::Status::WellKnownGrpcStatus::Internal,
+                      "type URL type_url_bar embedded in an individual Any does not match the "
+                      "message-wide type URL type_url_foo in DiscoveryResponse "
+                      "(version=foo-version, nonce=, resources=1)");
     grpc_mux_->onDiscoveryResponse(std::move(invalid_response), control_plane_stats_);
   }
   expectSendMessage("type_url_foo", {}, "");
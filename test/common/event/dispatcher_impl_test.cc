@@ -595,6 +595,37 @@ TEST_F(DispatcherImplTest, Timer) {
   timerTest([](Timer& timer) { timer.enableHRTimer(std::chrono::microseconds(50)); });
 }
 
+// Coarse timers are backed by the dispatcher's timing wheel but behave like regular timers from
+// the caller's perspective.
+TEST_F(DispatcherImplTest, CoarseTimer) {
+  {
+    Thread::LockGuard lock(mu_);
+    work_finished_ = false;
+  }
+  TimerPtr timer;
+  dispatcher_->post([this, &timer]() {
+    {
+      Thread::LockGuard lock(mu_);
+      timer = dispatcher_->createCoarseTimer([this]() {
+        {
+          Thread::LockGuard lock(mu_);
+          ASSERT(!work_finished_);
+          work_finished_ = true;
+        }
+        cv_.notifyOne();
+      });
+      EXPECT_FALSE(timer->enabled());
+      timer->enableTimer(std::chrono::milliseconds(50));
+      EXPECT_TRUE(timer->enabled());
+    }
+  });
+
+  Thread::LockGuard lock(mu_);
+  while (!work_finished_) {
+    cv_.wait(mu_);
+  }
+}
+
 TEST_F(DispatcherImplTest, TimerWithScope) {
   TimerPtr timer;
   MockScopeTrackedObject scope;
@@ -0,0 +1,152 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include "source/common/event/post_callback_queue.h"
+
+#include "test/test_common/thread_factory_for_test.h"
+
+#include "absl/synchronization/mutex.h"
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Event {
+namespace {
+
+MonotonicTime timeAt(uint64_t millis) {
+  return MonotonicTime(std::chrono::milliseconds(millis));
+}
+
+TEST(PostCallbackQueueTest, PopOnEmptyReturnsFalse) {
+  PostCallbackQueue queue;
+  std::function<void()> callback;
+  MonotonicTime enqueue_time;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(0, queue.size());
+  EXPECT_FALSE(queue.pop(callback, enqueue_time));
+}
+
+TEST(PostCallbackQueueTest, FifoOrderAndEnqueueTime) {
+  PostCallbackQueue queue;
+  std::vector<uint32_t> ran;
+  for (uint32_t i = 0; i < 5; ++i) {
+    queue.push([&ran, i]() { ran.push_back(i); }, timeAt(i));
+  }
+  EXPECT_EQ(5, queue.size());
+
+  std::function<void()> callback;
+  MonotonicTime enqueue_time;
+  for (uint32_t i = 0; i < 5; ++i) {
+    ASSERT_TRUE(queue.pop(callback, enqueue_time));
+    EXPECT_EQ(timeAt(i), enqueue_time);
+    callback();
+  }
+  EXPECT_FALSE(queue.pop(callback, enqueue_time));
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ((std::vector<uint32_t>{0, 1, 2, 3, 4}), ran);
+}
+
+// push() must return true exactly when the queue transitions from empty to non-empty: the
+// first push after construction, and the first push after every drain to empty, and no other.
+TEST(PostCallbackQueueTest, PushSignalsWakeupOnlyOnEmptyToNonEmpty) {
+  PostCallbackQueue queue;
+  std::function<void()> callback;
+  MonotonicTime enqueue_time;
+
+  for (uint32_t cycle = 0; cycle < 3; ++cycle) {
+    EXPECT_TRUE(queue.push([]() {}, timeAt(0)));
+    EXPECT_FALSE(queue.push([]() {}, timeAt(1)));
+    EXPECT_FALSE(queue.push([]() {}, timeAt(2)));
+
+    // Partially draining does not make the next push a wakeup.
+    ASSERT_TRUE(queue.pop(callback, enqueue_time));
+    EXPECT_FALSE(queue.push([]() {}, timeAt(3)));
+
+    while (queue.pop(callback, enqueue_time)) {
+    }
+    EXPECT_TRUE(queue.empty());
+  }
+}
+
+// Models the dispatcher's use of the queue: producers push concurrently and the consumer only
+// drains after a true-returning push woke it. Every callback must run exactly once, and no
+// wakeup may be lost: a missing empty-to-non-empty signal would leave callbacks stranded and
+// hang the test, while a spurious one merely wakes the consumer to an empty queue.
+TEST(PostCallbackQueueTest, MultiProducerStress) {
+  constexpr uint32_t num_producers = 8;
+  constexpr uint32_t pushes_per_producer = 20000;
+  constexpr uint32_t total_pushes = num_producers * pushes_per_producer;
+
+  PostCallbackQueue queue;
+  std::vector<std::atomic<uint32_t>> run_counts(total_pushes);
+  for (auto& count : run_counts) {
+    count.store(0);
+  }
+
+  absl::Mutex wakeup_mutex;
+  uint64_t wakeups ABSL_GUARDED_BY(wakeup_mutex) = 0;
+
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  absl::Notification go;
+  std::vector<Thread::ThreadPtr> producers;
+  for (uint32_t p = 0; p < num_producers; ++p) {
+    producers.push_back(thread_factory.createThread([&, p]() {
+      go.WaitForNotification();
+      for (uint32_t i = 0; i < pushes_per_producer; ++i) {
+        const uint32_t index = p * pushes_per_producer + i;
+        if (queue.push([&run_counts, index]() { ++run_counts[index]; }, timeAt(0))) {
+          absl::MutexLock lock(&wakeup_mutex);
+          ++wakeups;
+        }
+      }
+    }));
+  }
+
+  Thread::ThreadPtr consumer = thread_factory.createThread([&]() {
+    std::function<void()> callback;
+    MonotonicTime enqueue_time;
+    uint64_t executed = 0;
+    uint64_t consumed_wakeups = 0;
+    while (executed < total_pushes) {
+      {
+        absl::MutexLock lock(&wakeup_mutex);
+        auto condition = [&]() ABSL_EXCLUSIVE_LOCKS_REQUIRED(wakeup_mutex) {
+          return wakeups > consumed_wakeups;
+        };
+        wakeup_mutex.Await(absl::Condition(&condition));
+        consumed_wakeups = wakeups;
+      }
+      // Drain until the queue is empty. pop() can transiently return false while a producer
+      // finishes linking its node, in which case size() is still non-zero and we retry.
+      while (!queue.empty()) {
+        if (queue.pop(callback, enqueue_time)) {
+          callback();
+          ++executed;
+        }
+      }
+    }
+  });
+
+  go.Notify();
+  for (auto& producer : producers) {
+    producer->join();
+  }
+  consumer->join();
+
+  EXPECT_TRUE(queue.empty());
+  for (const auto& count : run_counts) {
+    EXPECT_EQ(1, count.load());
+  }
+
+  // Each wakeup corresponds to one empty-to-non-empty transition, so there is at least the
+  // initial one and at most one per push.
+  absl::MutexLock lock(&wakeup_mutex);
+  EXPECT_GE(wakeups, 1);
+  EXPECT_LE(wakeups, total_pushes);
+}
+
+} // namespace
+} // namespace Event
+} // namespace Envoy
@@ -0,0 +1,189 @@
+#include <chrono>
+
+#include "envoy/event/timer.h"
+
+#include "source/common/common/assert.h"
+#include "source/common/event/wheel_timer_scheduler.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/test_common/simulated_time_system.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Event {
+namespace {
+
+using testing::NiceMock;
+using testing::Return;
+
+// A base-scheduler stand-in that hands out manually fired timers, so tests can drive the wheel
+// tick-by-tick against simulated time without an event loop.
+class FakeBaseScheduler : public Scheduler {
+public:
+  class FakeTimer : public Timer {
+  public:
+    FakeTimer(TimerCb cb, FakeBaseScheduler& parent) : cb_(cb), parent_(parent) {}
+
+    // Timer
+    void disableTimer() override { enabled_ = false; }
+    void enableTimer(std::chrono::milliseconds ms, const ScopeTrackedObject*) override {
+      enabled_ = true;
+      delay_ = std::chrono::duration_cast<std::chrono::microseconds>(ms);
+    }
+    void enableHRTimer(std::chrono::microseconds us, const ScopeTrackedObject*) override {
+      enabled_ = true;
+      delay_ = us;
+    }
+    bool enabled() override { return enabled_; }
+
+    void fire() {
+      ASSERT(enabled_);
+      enabled_ = false;
+      cb_();
+    }
+
+    TimerCb cb_;
+    FakeBaseScheduler& parent_;
+    bool enabled_{false};
+    std::chrono::microseconds delay_{0};
+  };
+
+  // Scheduler
+  TimerPtr createTimer(const TimerCb& cb, Dispatcher&) override {
+    auto timer = std::make_unique<FakeTimer>(cb, *this);
+    timers_.push_back(timer.get());
+    return timer;
+  }
+
+  std::vector<FakeTimer*> timers_;
+};
+
+class WheelTimerSchedulerTest : public testing::Test {
+protected:
+  WheelTimerSchedulerTest() : scheduler_(base_scheduler_, time_system_) {
+    ON_CALL(dispatcher_, isThreadSafe()).WillByDefault(Return(true));
+  }
+
+  // The first base timer created by the wheel is its driver.
+  FakeBaseScheduler::FakeTimer& driver() {
+    ASSERT(!base_scheduler_.timers_.empty());
+    return *base_scheduler_.timers_[0];
+  }
+
+  // Runs simulated time forward by repeatedly firing the driver at its requested delay, until
+  // either the driver is quiescent or the time budget is spent.
+  void runFor(std::chrono::milliseconds duration) {
+    const MonotonicTime deadline = time_system_.monotonicTime() + duration;
+    while (!base_scheduler_.timers_.empty() && driver().enabled() &&
+           time_system_.monotonicTime() + driver().delay_ <= deadline) {
+      time_system_.advanceTimeWait(driver().delay_);
+      driver().fire();
+    }
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  FakeBaseScheduler base_scheduler_;
+  NiceMock<MockDispatcher> dispatcher_;
+  WheelTimerScheduler scheduler_;
+};
+
+TEST_F(WheelTimerSchedulerTest, CoarseTimerFiresWithinOneTick) {
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableTimer(std::chrono::milliseconds(500));
+  EXPECT_TRUE(timer->enabled());
+
+  // The wheel is driven by a single base timer, not one per wheel timer.
+  EXPECT_EQ(1, base_scheduler_.timers_.size());
+
+  runFor(std::chrono::milliseconds(400));
+  EXPECT_FALSE(fired);
+  runFor(std::chrono::milliseconds(300));
+  EXPECT_TRUE(fired);
+  EXPECT_FALSE(timer->enabled());
+}
+
+TEST_F(WheelTimerSchedulerTest, DisableRemovesFromWheel) {
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableTimer(std::chrono::milliseconds(500));
+  timer->disableTimer();
+  EXPECT_FALSE(timer->enabled());
+
+  runFor(std::chrono::milliseconds(1000));
+  EXPECT_FALSE(fired);
+}
+
+TEST_F(WheelTimerSchedulerTest, DestroyWhilePendingUnlinks) {
+  {
+    TimerPtr timer = scheduler_.createTimer([] { FAIL(); }, dispatcher_);
+    timer->enableTimer(std::chrono::milliseconds(500));
+  }
+  runFor(std::chrono::milliseconds(1000));
+}
+
+TEST_F(WheelTimerSchedulerTest, ReEnableMovesDeadline) {
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableTimer(std::chrono::milliseconds(300));
+  timer->enableTimer(std::chrono::milliseconds(1000));
+
+  runFor(std::chrono::milliseconds(600));
+  EXPECT_FALSE(fired);
+  runFor(std::chrono::milliseconds(600));
+  EXPECT_TRUE(fired);
+}
+
+TEST_F(WheelTimerSchedulerTest, OuterLevelTimerCascadesAndFires) {
+  // Seven seconds lands on the second wheel level with the default 100ms tick.
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableTimer(std::chrono::milliseconds(7000));
+
+  runFor(std::chrono::milliseconds(6900));
+  EXPECT_FALSE(fired);
+  runFor(std::chrono::milliseconds(300));
+  EXPECT_TRUE(fired);
+}
+
+TEST_F(WheelTimerSchedulerTest, ShortTimerUsesPreciseFallback) {
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableTimer(std::chrono::milliseconds(50));
+  EXPECT_TRUE(timer->enabled());
+
+  // The only base timer is the per-timer fallback; no wheel driver is running.
+  ASSERT_EQ(1, base_scheduler_.timers_.size());
+  EXPECT_EQ(std::chrono::microseconds(50000), base_scheduler_.timers_[0]->delay_);
+  base_scheduler_.timers_[0]->fire();
+  EXPECT_TRUE(fired);
+}
+
+TEST_F(WheelTimerSchedulerTest, HighResolutionTimerUsesPreciseFallback) {
+  bool fired = false;
+  TimerPtr timer = scheduler_.createTimer([&fired] { fired = true; }, dispatcher_);
+  timer->enableHRTimer(std::chrono::microseconds(1500));
+
+  ASSERT_EQ(1, base_scheduler_.timers_.size());
+  EXPECT_EQ(std::chrono::microseconds(1500), base_scheduler_.timers_[0]->delay_);
+  base_scheduler_.timers_[0]->fire();
+  EXPECT_TRUE(fired);
+}
+
+TEST_F(WheelTimerSchedulerTest, ManyTimersShareOneDriver) {
+  std::vector<TimerPtr> timers;
+  int fired = 0;
+  for (int i = 0; i < 100; i++) {
+    timers.push_back(scheduler_.createTimer([&fired] { fired++; }, dispatcher_));
+    timers.back()->enableTimer(std::chrono::milliseconds(200 + i * 10));
+  }
+  EXPECT_EQ(1, base_scheduler_.timers_.size());
+
+  runFor(std::chrono::milliseconds(1400));
+  EXPECT_EQ(100, fired);
+}
+
+} // namespace
+} // namespace Event
+} // namespace Envoy
@@ -0,0 +1,127 @@
+// Note: this should be run with --compilation_mode=opt, and would benefit from a
+// quiescent system with disabled cstate power management.
+//
+// Measures the per-request overhead of the downstream filter manager hot path: building the
+// filter chain, iterating request headers through a chain of pass-through filters, and encoding
+// an immediate response, as a function of filter count and request header count. Route table
+// scaling is covered separately by test/common/router/config_impl_speed_test.cc.
+
+#include "envoy/common/optref.h"
+
+#include "source/common/common/logger.h"
+#include "source/common/common/thread.h"
+#include "source/common/http/filter_manager.h"
+#include "source/common/http/header_map_impl.h"
+#include "source/common/stream_info/filter_state_impl.h"
+#include "source/extensions/filters/http/common/pass_through_filter.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/http/mocks.h"
+#include "test/mocks/local_reply/mocks.h"
+#include "test/mocks/network/mocks.h"
+
+#include "benchmark/benchmark.h"
+
+namespace Envoy {
+namespace Http {
+namespace {
+
+using testing::_;
+using testing::Invoke;
+using testing::NiceMock;
+
+// Stands in for the router at the end of the chain: immediately answers every request with a
+// 200 response, as the router would with a zero-latency in-memory upstream.
+class ImmediateResponseFilter : public PassThroughDecoderFilter {
+public:
+  FilterHeadersStatus decodeHeaders(RequestHeaderMap&, bool) override {
+    auto response_headers = ResponseHeaderMapImpl::create();
+    response_headers->setStatus(200);
+    decoder_callbacks_->encodeHeaders(std::move(response_headers), true, "benchmark");
+    return FilterHeadersStatus::StopIteration;
+  }
+};
+
+class FilterManagerBenchmark {
+public:
+  FilterManagerBenchmark(size_t num_filters, size_t num_headers) {
+    for (size_t i = 0; i < num_headers; i++) {
+      header_keys_.emplace_back(absl::StrCat("x-benchmark-", i));
+    }
+    ON_CALL(filter_factory_, createFilterChain(_))
+        .WillByDefault(Invoke([this, num_filters](FilterChainManager& manager) -> bool {
+          FilterFactoryCb factory = [num_filters](FilterChainFactoryCallbacks& callbacks) {
+            for (size_t i = 0; i < num_filters; i++) {
+              callbacks.addStreamFilter(std::make_shared<PassThroughFilter>());
+            }
+            callbacks.addStreamDecoderFilter(std::make_shared<ImmediateResponseFilter>());
+          };
+          manager.applyFilterFactoryCb({}, factory);
+          return true;
+        }));
+    ON_CALL(filter_manager_callbacks_, requestHeaders()).WillByDefault(Invoke([this]() {
+      return makeOptRef(*request_headers_);
+    }));
+  }
+
+  void runOneRequest() {
+    request_headers_ = makeRequestHeaders();
+    DownstreamFilterManager filter_manager(
+        filter_manager_callbacks_, dispatcher_, connection_, 0, nullptr, true, 10000,
+        filter_factory_, local_reply_, Protocol::Http2, time_source_, filter_state_,
+        StreamInfo::FilterState::LifeSpan::Connection);
+    filter_manager.createFilterChain();
+    filter_manager.requestHeadersInitialized();
+    filter_manager.decodeHeaders(*request_headers_, true);
+    filter_manager.destroyFilters();
+  }
+
+private:
+  RequestHeaderMapPtr makeRequestHeaders() {
+    auto headers = RequestHeaderMapImpl::create();
+    headers->setMethod("GET");
+    headers->setScheme("http");
+    headers->setHost("host");
+    headers->setPath("/");
+    for (const LowerCaseString& key : header_keys_) {
+      headers->addCopy(key, "value");
+    }
+    return headers;
+  }
+
+  std::vector<LowerCaseString> header_keys_;
+  RequestHeaderMapPtr request_headers_;
+  NiceMock<MockFilterManagerCallbacks> filter_manager_callbacks_;
+  NiceMock<Event::MockDispatcher> dispatcher_;
+  NiceMock<Network::MockConnection> connection_;
+  NiceMock<MockFilterChainFactory> filter_factory_;
+  NiceMock<LocalReply::MockLocalReply> local_reply_;
+  NiceMock<MockTimeSystem> time_source_;
+  StreamInfo::FilterStateSharedPtr filter_state_ =
+      std::make_shared<StreamInfo::FilterStateImpl>(StreamInfo::FilterState::LifeSpan::Connection);
+};
+
+static void benchmarkFilterManager(benchmark::State& state) {
+  Thread::MutexBasicLockable lock;
+  Logger::Context logging_state(spdlog::level::warn, Logger::Logger::DEFAULT_LOG_FORMAT, lock,
+                                false);
+  FilterManagerBenchmark bench(state.range(0), state.range(1));
+  for (auto _ : state) { // NOLINT: Silences warning about dead store
+    bench.runOneRequest();
+  }
+}
+
+BENCHMARK(benchmarkFilterManager)
+    ->ArgNames({"filters", "request_headers"})
+    ->Args({0, 4})
+    ->Args({1, 4})
+    ->Args({4, 4})
+    ->Args({16, 4})
+    ->Args({4, 16})
+    ->Args({4, 64})
+    ->Args({16, 64})
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace
+} // namespace Http
+} // namespace Envoy
@@ -1037,6 +1037,35 @@ TEST(HeaderMapImplTest, InlineHeaderByteSize) {
   }
 }
 
+// Validates that the per-entry size high-water mark tracks the largest entry across add, append,
+// set, and remove operations, and is only reset by clear().
+TEST(HeaderMapImplTest, MaxEntryByteSize) {
+  TestRequestHeaderMapImpl headers;
+  EXPECT_EQ(headers.maxEntryByteSize(), 0);
+
+  headers.addCopy(LowerCaseString("hello"), "world");
+  EXPECT_EQ(headers.maxEntryByteSize(), 10);
+
+  // A smaller entry does not lower the mark.
+  headers.addCopy(LowerCaseString("a"), "b");
+  EXPECT_EQ(headers.maxEntryByteSize(), 10);
+
+  // Appending grows the existing entry past the current mark.
+  headers.appendCopy(LowerCaseString("hello"), "bigger_world");
+  EXPECT_EQ(headers.maxEntryByteSize(), 23);
+
+  // Removals do not lower the mark.
+  headers.remove(LowerCaseString("hello"));
+  EXPECT_EQ(headers.maxEntryByteSize(), 23);
+
+  // Inline headers are tracked as well.
+  headers.setHost("a_host_longer_than_23_chars.example.com");
+  EXPECT_EQ(headers.maxEntryByteSize(), 49);
+
+  headers.clear();
+  EXPECT_EQ(headers.maxEntryByteSize(), 0);
+}
+
 TEST(HeaderMapImplTest, ValidHeaderString) {
   EXPECT_TRUE(validHeaderString("abc"));
   EXPECT_FALSE(validHeaderString(absl::string_view("a\000bc", 4)));
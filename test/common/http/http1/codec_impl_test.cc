@@ -1959,6 +1959,40 @@ TEST_P(Http1ServerConnectionImplTest, ContentLengthResponse) {
   EXPECT_EQ("HTTP/1.1 200 OK\r\ncontent-length: 11\r\n\r\nHello World", output);
 }
 
+// With the deferred flush feature enabled, a response with a known-small content length should
+// reach the connection as a single write containing both headers and body.
+TEST_P(Http1ServerConnectionImplTest, ContentLengthResponseDeferredHeaderFlush) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.http1_coalesce_small_response_writes", "true"}});
+  initialize();
+
+  NiceMock<MockRequestDecoder> decoder;
+  Http::ResponseEncoder* response_encoder = nullptr;
+  EXPECT_CALL(callbacks_, newStream(_, _))
+      .WillOnce(Invoke([&](ResponseEncoder& encoder, bool) -> RequestDecoder& {
+        response_encoder = &encoder;
+        return decoder;
+      }));
+
+  Buffer::OwnedImpl buffer("GET / HTTP/1.1\r\n\r\n");
+  auto status = codec_->dispatch(buffer);
+  EXPECT_TRUE(status.ok());
+  EXPECT_EQ(0U, buffer.length());
+
+  std::string output;
+  EXPECT_CALL(connection_, write(_, _)).WillOnce(AddBufferToString(&output));
+
+  TestResponseHeaderMapImpl headers{{":status", "200"}, {"content-length", "11"}};
+  response_encoder->encodeHeaders(headers, false);
+  // The headers flush is deferred until the body arrives.
+  EXPECT_EQ("", output);
+
+  Buffer::OwnedImpl data("Hello World");
+  response_encoder->encodeData(data, true);
+  EXPECT_EQ("HTTP/1.1 200 OK\r\ncontent-length: 11\r\n\r\nHello World", output);
+}
+
 TEST_P(Http1ServerConnectionImplTest, HeadRequestResponse) {
   initialize();
 
@@ -1691,6 +1691,26 @@ TEST_P(Http2CodecImplDeferredResetTest, NoDeferredResetServerIfResetBeforeLocalE
 
 class Http2CodecImplFlowControlTest : public Http2CodecImplTest {};
 
+// Each burst of queued body data should record a pending_send_drain_ms sample when it fully
+// drains to the connection.
+TEST_P(Http2CodecImplFlowControlTest, PendingSendDrainHistogram) {
+  initialize();
+
+  TestRequestHeaderMapImpl request_headers;
+  HttpTestUtility::addDefaultHeaders(request_headers);
+  EXPECT_CALL(request_decoder_, decodeHeaders_(_, false));
+  EXPECT_TRUE(request_encoder_->encodeHeaders(request_headers, false).ok());
+  driveToCompletion();
+
+  EXPECT_CALL(request_decoder_, decodeData(_, false));
+  Buffer::OwnedImpl data("hello");
+  request_encoder_->encodeData(data, false);
+  driveToCompletion();
+
+  EXPECT_EQ(1U,
+            client_stats_store_.histogramValues("http2.pending_send_drain_ms", false).size());
+}
+
 // Back up the pending_sent_data_ buffer in the client connection and make sure the watermarks fire
 // as expected.
 //
@@ -11,6 +11,7 @@
 #include "test/common/http/common.h"
 #include "test/common/upstream/utility.h"
 #include "test/mocks/event/mocks.h"
+#include "test/mocks/http/conn_pool.h"
 #include "test/mocks/http/http_server_properties_cache.h"
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/network/mocks.h"
@@ -32,6 +33,7 @@ using testing::Invoke;
 using testing::InvokeWithoutArgs;
 using testing::NiceMock;
 using testing::Property;
+using testing::Ref;
 using testing::Return;
 using testing::ReturnRef;
 
@@ -638,6 +640,29 @@ TEST_F(Http2ConnPoolImplTest, DrainConnections) {
   EXPECT_EQ(2U, cluster_->traffic_stats_->upstream_cx_destroy_remote_.value());
 }
 
+// Test that registered connection lifetime callbacks are told when a connection
+// becomes usable for streams and when it starts draining.
+TEST_F(Http2ConnPoolImplTest, ConnectionLifetimeCallbacks) {
+  ConnectionPool::MockConnectionLifetimeCallbacks callbacks;
+  std::vector<uint8_t> hash_key = {1, 2, 3};
+  pool_->setConnectionLifetimeCallbacks(hash_key, callbacks);
+
+  expectClientCreate();
+  ActiveTestRequest r(*this, 0, false);
+  EXPECT_CALL(callbacks,
+              onConnectionOpen(Ref(*pool_), hash_key, Ref(*test_clients_[0].connection_)));
+  expectClientConnect(0, r);
+  completeRequest(r);
+
+  // Draining the pool closes the now-idle connection; the callbacks are told it is
+  // draining exactly once.
+  EXPECT_CALL(callbacks,
+              onConnectionDraining(Ref(*pool_), hash_key, Ref(*test_clients_[0].connection_)));
+  pool_->drainConnections(Envoy::ConnectionPool::DrainBehavior::DrainExistingConnections);
+  EXPECT_CALL(*this, onClientDestroy());
+  dispatcher_.clearDeferredDeleteList();
+}
+
 // Test that cluster.http2_protocol_options.max_concurrent_streams limits
 // concurrent requests and causes additional connections to be created.
 TEST_F(Http2ConnPoolImplTest, MaxConcurrentRequestsPerStream) {
@@ -27,9 +27,14 @@ public:
   TestRequestHeaderMapImpl headers_;
 };
 
-// Already normalized path don't change.
+// Already normalized path don't change. These hit the fast exit that skips
+// canonicalization when no byte would be rewritten, including paths exercising the
+// full pass-through character set, trailing slashes, dots inside segments, and
+// queries containing bytes that would need normalization in the path itself.
 TEST_F(PathUtilityTest, AlreadyNormalPaths) {
-  const std::vector<std::string> normal_paths{"/xyz", "/x/y/z"};
+  const std::vector<std::string> normal_paths{
+      "/xyz", "/x/y/z", "/",    "/x.y/z-w_v~u/",        "/a,b!c$d&e'f(g)h*i+j;k=l/@:m",
+      "/a.b", "/a/b.",  "/a/.b", "/a/b/?query=%2F/../x", "/file.tar.gz"};
   for (const auto& path : normal_paths) {
     auto& path_header = pathHeaderEntry(path);
     const auto result = PathUtil::canonicalPath(headers_);
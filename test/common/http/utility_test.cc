@@ -12,6 +12,7 @@
 #include "source/common/http/http1/settings.h"
 #include "source/common/http/utility.h"
 #include "source/common/network/address_impl.h"
+#include "source/common/stream_info/filter_state_impl.h"
 
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/protobuf/mocks.h"
@@ -864,6 +865,22 @@ TEST(HttpUtility, TestParseCookiesDuplicates) {
   EXPECT_EQ(cookies.at("b"), "1");
 }
 
+TEST(HttpUtility, TestGetOrCreateParsedCookies) {
+  StreamInfo::FilterStateImpl filter_state(StreamInfo::FilterState::LifeSpan::FilterChain);
+  TestRequestHeaderMapImpl headers{{"cookie", "a=1; b=2"}};
+
+  const auto& parsed = Utility::getOrCreateParsedCookies(headers, filter_state);
+  EXPECT_EQ(parsed.getCookieValue("a").value(), "1");
+  EXPECT_EQ(parsed.getCookieValue("b").value(), "2");
+  EXPECT_FALSE(parsed.getCookieValue("c").has_value());
+
+  // Subsequent calls return the memoized view even if the header has changed.
+  headers.setCopy(LowerCaseString("cookie"), "a=changed");
+  const auto& parsed_again = Utility::getOrCreateParsedCookies(headers, filter_state);
+  EXPECT_EQ(&parsed, &parsed_again);
+  EXPECT_EQ(parsed_again.getCookieValue("a").value(), "1");
+}
+
 TEST(HttpUtility, TestParseSetCookieWithQuotes) {
   TestRequestHeaderMapImpl headers{
       {"someheader", "10.0.0.1"},
@@ -1,10 +1,13 @@
 #include "source/common/init/manager_impl.h"
 
 #include "test/mocks/init/mocks.h"
+#include "test/test_common/utility.h"
 
 #include "gtest/gtest.h"
 
+using ::testing::AnyNumber;
 using ::testing::InSequence;
+using ::testing::Invoke;
 
 namespace Envoy {
 namespace Init {
@@ -120,6 +123,83 @@ TEST(InitManagerImplTest, AddImmediateTargetWhenInitializing) {
   expectInitialized(m);
 }
 
+// A target registered with dependencies doesn't start until all the targets it depends on have
+// initialized.
+TEST(InitManagerImplTest, DependentTargetStartsAfterDependencies) {
+  InSequence s;
+
+  ManagerImpl m("test");
+  expectUninitialized(m);
+
+  ExpectableTargetImpl t1("t1");
+  m.add(t1);
+
+  ExpectableTargetImpl t2("t2");
+  m.add(t2);
+
+  ExpectableTargetImpl t3("t3");
+  m.add(t3, {"t1", "t2"});
+
+  ExpectableWatcherImpl w;
+
+  // only the dependency-free targets start when the manager initializes
+  t1.expectInitialize();
+  t2.expectInitialize();
+  t3.expectInitialize().Times(0);
+  m.initialize(w);
+  expectInitializing(m);
+
+  // the dependent target stays unstarted until its last dependency is ready
+  t1.ready();
+  expectInitializing(m);
+
+  t3.expectInitialize();
+  t2.ready();
+  expectInitializing(m);
+
+  w.expectReady();
+  t3.ready();
+  expectInitialized(m);
+}
+
+// A dependency naming no registered target is considered satisfied.
+TEST(InitManagerImplTest, DependencyOnUnregisteredNameIsSatisfied) {
+  InSequence s;
+
+  ManagerImpl m("test");
+
+  ExpectableTargetImpl t("t");
+  m.add(t, {"nonexistent"});
+
+  ExpectableWatcherImpl w;
+
+  t.expectInitializeWillCallReady();
+  w.expectReady();
+  m.initialize(w);
+  expectInitialized(m);
+}
+
+// A dependency cycle is a programming error: it is surfaced via ENVOY_BUG and the affected
+// targets are started anyway so that initialization cannot hang.
+TEST(InitManagerImplTest, DependencyCycleIsBrokenWithBug) {
+  ManagerImpl m("test");
+
+  ExpectableTargetImpl t1("t1");
+  m.add(t1, {"t2"});
+
+  ExpectableTargetImpl t2("t2");
+  m.add(t2, {"t1"});
+
+  ExpectableWatcherImpl w;
+
+  // In debug builds the ENVOY_BUG aborts in a death-test child process, so the expectations must
+  // tolerate never being exercised in the parent.
+  t1.expectInitialize().Times(AnyNumber()).WillRepeatedly(Invoke([&]() { t1.ready(); }));
+  t2.expectInitialize().Times(AnyNumber()).WillRepeatedly(Invoke([&]() { t2.ready(); }));
+  w.expectReady().Times(AnyNumber());
+  EXPECT_ENVOY_BUG(m.initialize(w), "has a dependency cycle among its targets");
+}
+
 TEST(InitManagerImplTest, UnavailableTarget) {
   InSequence s;
 
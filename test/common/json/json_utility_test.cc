@@ -0,0 +1,73 @@
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "source/common/json/json_utility.h"
+#include "source/common/protobuf/utility.h"
+
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Json {
+namespace {
+
+std::string toJson(const ProtobufWkt::Value& value) {
+  std::string out;
+  Utility::appendValueToString(value, out);
+  return out;
+}
+
+TEST(JsonUtilityTest, PrimitiveValues) {
+  EXPECT_EQ("null", toJson(ValueUtil::nullValue()));
+  EXPECT_EQ("null", toJson(ProtobufWkt::Value()));
+  EXPECT_EQ("true", toJson(ValueUtil::boolValue(true)));
+  EXPECT_EQ("false", toJson(ValueUtil::boolValue(false)));
+  EXPECT_EQ("\"hello\"", toJson(ValueUtil::stringValue("hello")));
+  EXPECT_EQ("5", toJson(ValueUtil::numberValue(5.0)));
+  EXPECT_EQ("-2.5", toJson(ValueUtil::numberValue(-2.5)));
+}
+
+TEST(JsonUtilityTest, StringsAreSanitized) {
+  EXPECT_EQ("\"quote\\\"backslash\\\\\"", toJson(ValueUtil::stringValue("quote\"backslash\\")));
+  EXPECT_EQ("\"new\\nline\"", toJson(ValueUtil::stringValue("new\nline")));
+}
+
+TEST(JsonUtilityTest, NonFiniteNumbersMatchProtobufPrinter) {
+  EXPECT_EQ("\"NaN\"", toJson(ValueUtil::numberValue(std::nan(""))));
+  EXPECT_EQ("\"Infinity\"",
+            toJson(ValueUtil::numberValue(std::numeric_limits<double>::infinity())));
+  EXPECT_EQ("\"-Infinity\"",
+            toJson(ValueUtil::numberValue(-std::numeric_limits<double>::infinity())));
+}
+
+// The direct serialization must be semantically equivalent to the protobuf JSON printer for
+// arbitrary nested structs.
+TEST(JsonUtilityTest, MatchesProtobufJsonPrinter) {
+  ProtobufWkt::Struct message;
+  TestUtility::loadFromYaml(R"EOF(
+    plain_string: plain_string_value
+    number: 42
+    fraction: 0.25
+    flag: true
+    empty:
+    nested:
+      list:
+        - one
+        - 2
+        - false
+        -
+        - inner: {}
+  )EOF",
+                            message);
+
+  std::string direct;
+  Utility::appendStructToString(message, direct);
+  const std::string via_protobuf = MessageUtil::getJsonStringFromMessageOrDie(message, false, true);
+  EXPECT_TRUE(TestUtility::jsonStringEqual(direct, via_protobuf));
+}
+
+} // namespace
+} // namespace Json
+} // namespace Envoy
@@ -0,0 +1,75 @@
+#include <cstring>
+
+#include "source/common/memory/arena.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Memory {
+namespace {
+
+TEST(ArenaTest, BasicAllocation) {
+  Arena arena;
+  void* p1 = arena.allocate(16);
+  void* p2 = arena.allocate(16);
+  ASSERT_NE(p1, nullptr);
+  ASSERT_NE(p2, nullptr);
+  EXPECT_NE(p1, p2);
+  // Allocations must be usable.
+  memset(p1, 0xab, 16);
+  memset(p2, 0xcd, 16);
+  EXPECT_EQ(32, arena.bytesAllocated());
+}
+
+TEST(ArenaTest, Alignment) {
+  Arena arena;
+  // Force an odd cursor position, then request aligned storage.
+  arena.allocate(1, 1);
+  for (size_t alignment : {size_t(2), size_t(4), size_t(8), alignof(std::max_align_t)}) {
+    void* p = arena.allocate(8, alignment);
+    EXPECT_EQ(0, reinterpret_cast<uintptr_t>(p) % alignment);
+    arena.allocate(1, 1);
+  }
+}
+
+TEST(ArenaTest, GrowsAcrossBlocks) {
+  Arena arena(64);
+  // Allocate far more than the initial block; every allocation must remain valid, which
+  // is implicitly checked under ASAN by the writes below.
+  for (int i = 0; i < 1000; i++) {
+    void* p = arena.allocate(32);
+    memset(p, i & 0xff, 32);
+  }
+  EXPECT_EQ(32000, arena.bytesAllocated());
+}
+
+TEST(ArenaTest, OversizeAllocation) {
+  Arena arena(64);
+  // A single allocation larger than the current block size gets its own block.
+  void* p = arena.allocate(Arena::MaxBlockSize * 2);
+  ASSERT_NE(p, nullptr);
+  memset(p, 0, Arena::MaxBlockSize * 2);
+  // The arena remains usable afterwards.
+  void* q = arena.allocate(8);
+  memset(q, 0, 8);
+}
+
+TEST(ArenaTest, ObjectPlacement) {
+  struct Tracked {
+    explicit Tracked(int& destroyed) : destroyed_(destroyed) {}
+    ~Tracked() { destroyed_++; }
+    int& destroyed_;
+  };
+
+  int destroyed = 0;
+  {
+    Arena arena;
+    auto* t = new (arena.allocate(sizeof(Tracked), alignof(Tracked))) Tracked(destroyed);
+    t->~Tracked();
+  }
+  EXPECT_EQ(1, destroyed);
+}
+
+} // namespace
+} // namespace Memory
+} // namespace Envoy
@@ -510,6 +510,27 @@ TEST(AddressFromSockAddrDeathTest, IPv4) {
   EXPECT_FALSE(addressFromSockAddr(ss, sizeof(sockaddr_in)).ok());
 }
 
+TEST(AddressFromSockAddr, InterningReturnsSharedInstances) {
+  sockaddr_storage ss;
+  memset(&ss, 0, sizeof(ss));
+  auto& sin = reinterpret_cast<sockaddr_in&>(ss);
+
+  sin.sin_family = AF_INET;
+  EXPECT_EQ(1, inet_pton(AF_INET, "10.0.0.1", &sin.sin_addr));
+  sin.sin_port = htons(443);
+
+  // Identical sockaddr bytes on the same thread share one immutable instance.
+  InstanceConstSharedPtr first = *addressFromSockAddr(ss, sizeof(sockaddr_in));
+  InstanceConstSharedPtr second = *addressFromSockAddr(ss, sizeof(sockaddr_in));
+  EXPECT_EQ(first.get(), second.get());
+
+  // Different bytes produce a different instance.
+  sin.sin_port = htons(444);
+  InstanceConstSharedPtr third = *addressFromSockAddr(ss, sizeof(sockaddr_in));
+  EXPECT_NE(first.get(), third.get());
+  EXPECT_EQ("10.0.0.1:444", third->asString());
+}
+
 TEST(AddressFromSockAddrDeathTest, IPv6) {
   sockaddr_storage ss;
   memset(&ss, 0, sizeof(ss));
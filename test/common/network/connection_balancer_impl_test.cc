@@ -0,0 +1,174 @@
+#include <atomic>
+#include <vector>
+
+#include "source/common/common/assert.h"
+#include "source/common/network/connection_balancer_impl.h"
+
+#include "test/test_common/thread_factory_for_test.h"
+
+#include "absl/synchronization/notification.h"
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+class TestBalancedConnectionHandler : public BalancedConnectionHandler {
+public:
+  // BalancedConnectionHandler
+  uint64_t numConnections() const override {
+    RELEASE_ASSERT(!poisoned_.load(), "handler examined after unregisterHandler() returned");
+    return connections_.load();
+  }
+  void incNumConnections() override {
+    RELEASE_ASSERT(!poisoned_.load(), "handler picked after unregisterHandler() returned");
+    connections_.fetch_add(1);
+    picks_.fetch_add(1);
+  }
+  void post(Network::ConnectionSocketPtr&&) override {}
+  void onAcceptWorker(Network::ConnectionSocketPtr&&, bool, bool) override {}
+
+  // Marks the handler as torn down, as its listener would be after unregisterHandler() returns.
+  // Any subsequent access from the balancer trips the asserts above.
+  void poison() { poisoned_.store(true); }
+
+  std::atomic<uint64_t> connections_{0};
+  std::atomic<uint64_t> picks_{0};
+
+private:
+  std::atomic<bool> poisoned_{false};
+};
+
+TEST(ExactConnectionBalancerImplTest, PicksLeastLoadedHandler) {
+  ExactConnectionBalancerImpl balancer;
+  TestBalancedConnectionHandler handlers[3];
+  handlers[0].connections_ = 2;
+  handlers[1].connections_ = 1;
+  for (auto& handler : handlers) {
+    balancer.registerHandler(handler);
+  }
+
+  EXPECT_EQ(&handlers[2], &balancer.pickTargetHandler(handlers[0]));
+  // The picked handler is now at one connection, tied with the second; the scan takes the
+  // first strict minimum in registration order.
+  EXPECT_EQ(&handlers[1], &balancer.pickTargetHandler(handlers[0]));
+
+  balancer.unregisterHandler(handlers[2]);
+  // All remaining handlers are tied at two connections, so the first registered wins.
+  EXPECT_EQ(&handlers[0], &balancer.pickTargetHandler(handlers[0]));
+}
+
+TEST(LeastLoadedConnectionBalancerImplTest, NoHandlersStaysOnCurrent) {
+  LeastLoadedConnectionBalancerImpl balancer;
+  TestBalancedConnectionHandler current;
+  EXPECT_EQ(&current, &balancer.pickTargetHandler(current));
+  EXPECT_EQ(1, current.picks_.load());
+}
+
+TEST(LeastLoadedConnectionBalancerImplTest, PicksLessLoadedOfSampledPair) {
+  LeastLoadedConnectionBalancerImpl balancer;
+  TestBalancedConnectionHandler loaded;
+  TestBalancedConnectionHandler idle;
+  loaded.connections_ = 100;
+  balancer.registerHandler(loaded);
+  balancer.registerHandler(idle);
+
+  // With two handlers every pick samples both, so the idle handler must win until it catches
+  // up, which 50 picks cannot make it do.
+  for (uint32_t i = 0; i < 50; ++i) {
+    EXPECT_EQ(&idle, &balancer.pickTargetHandler(loaded));
+  }
+  EXPECT_EQ(50, idle.picks_.load());
+  EXPECT_EQ(0, loaded.picks_.load());
+}
+
+TEST(LeastLoadedConnectionBalancerImplTest, RegisterRepublishesSnapshot) {
+  LeastLoadedConnectionBalancerImpl balancer;
+  TestBalancedConnectionHandler first;
+  TestBalancedConnectionHandler second;
+  balancer.registerHandler(first);
+  for (uint32_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(&first, &balancer.pickTargetHandler(first));
+  }
+
+  // The new handler becomes visible to picks immediately and, being 10 connections behind,
+  // wins every sample until it reaches parity.
+  balancer.registerHandler(second);
+  for (uint32_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(&second, &balancer.pickTargetHandler(first));
+  }
+  EXPECT_EQ(10, second.picks_.load());
+}
+
+TEST(LeastLoadedConnectionBalancerImplTest, SpreadsPicksAcrossEqualHandlers) {
+  LeastLoadedConnectionBalancerImpl balancer;
+  constexpr uint32_t num_handlers = 4;
+  constexpr uint32_t num_picks = 1000;
+  TestBalancedConnectionHandler handlers[num_handlers];
+  for (auto& handler : handlers) {
+    balancer.registerHandler(handler);
+  }
+
+  for (uint32_t i = 0; i < num_picks; ++i) {
+    balancer.pickTargetHandler(handlers[0]);
+  }
+
+  uint64_t total = 0;
+  for (auto& handler : handlers) {
+    // Power of two choices against live counts keeps every handler well within a factor of two
+    // of its fair share.
+    EXPECT_GE(handler.picks_.load(), num_picks / (2 * num_handlers));
+    total += handler.picks_.load();
+  }
+  EXPECT_EQ(num_picks, total);
+}
+
+// Runs picks concurrently with an unregister and verifies the spin-drain protocol: once
+// unregisterHandler() returns, the handler may be torn down and no pick may touch it again.
+// The poisoned handler turns any late access into an assertion failure (and a TSAN report).
+TEST(LeastLoadedConnectionBalancerImplTest, PicksRacingUnregisterNeverTouchRemovedHandler) {
+  LeastLoadedConnectionBalancerImpl balancer;
+  TestBalancedConnectionHandler handlers[3];
+  for (auto& handler : handlers) {
+    balancer.registerHandler(handler);
+  }
+
+  constexpr uint32_t num_pickers = 4;
+  constexpr uint64_t picks_after_unregister_target = 10000;
+  std::atomic<bool> unregistered{false};
+  std::atomic<uint64_t> picks_after_unregister{0};
+
+  Thread::ThreadFactory& thread_factory = Thread::threadFactoryForTest();
+  absl::Notification go;
+  std::vector<Thread::ThreadPtr> pickers;
+  for (uint32_t i = 0; i < num_pickers; ++i) {
+    pickers.push_back(thread_factory.createThread([&]() {
+      go.WaitForNotification();
+      while (picks_after_unregister.load() < picks_after_unregister_target) {
+        // Sample the flag before the pick: a pick that began after unregisterHandler()
+        // returned must never see the removed handler. Picks that merely finish after it
+        // returned may legitimately have chosen the handler through the old snapshot.
+        const bool after_unregister = unregistered.load();
+        BalancedConnectionHandler& picked = balancer.pickTargetHandler(handlers[0]);
+        if (after_unregister) {
+          EXPECT_NE(&handlers[1], &picked);
+          picks_after_unregister.fetch_add(1);
+        }
+      }
+    }));
+  }
+
+  go.Notify();
+  balancer.unregisterHandler(handlers[1]);
+  handlers[1].poison();
+  unregistered.store(true);
+
+  for (auto& picker : pickers) {
+    picker->join();
+  }
+  EXPECT_GE(picks_after_unregister.load(), picks_after_unregister_target);
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
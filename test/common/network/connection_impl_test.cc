@@ -634,8 +634,8 @@ TEST_P(ConnectionImplTest, SocketOptionsFailureTest) {
 
 struct MockConnectionStats {
   Connection::ConnectionStats toBufferStats() {
-    return {rx_total_,   rx_current_,   tx_total_,
-            tx_current_, &bind_errors_, &delayed_close_timeouts_};
+    return {rx_total_,   rx_current_,   tx_total_,          tx_current_,
+            &bind_errors_, &delayed_close_timeouts_, &read_dispatch_us_};
   }
 
   StrictMock<Stats::MockCounter> rx_total_;
@@ -644,12 +644,14 @@ struct MockConnectionStats {
   StrictMock<Stats::MockGauge> tx_current_;
   StrictMock<Stats::MockCounter> bind_errors_;
   StrictMock<Stats::MockCounter> delayed_close_timeouts_;
+  // NiceMock: the number of read events (and thus recordings) depends on socket timing.
+  NiceMock<Stats::MockHistogram> read_dispatch_us_;
 };
 
 struct NiceMockConnectionStats {
   Connection::ConnectionStats toBufferStats() {
-    return {rx_total_,   rx_current_,   tx_total_,
-            tx_current_, &bind_errors_, &delayed_close_timeouts_};
+    return {rx_total_,   rx_current_,   tx_total_,          tx_current_,
+            &bind_errors_, &delayed_close_timeouts_, &read_dispatch_us_};
   }
 
   NiceMock<Stats::MockCounter> rx_total_;
@@ -658,6 +660,7 @@ struct NiceMockConnectionStats {
   NiceMock<Stats::MockGauge> tx_current_;
   NiceMock<Stats::MockCounter> bind_errors_;
   NiceMock<Stats::MockCounter> delayed_close_timeouts_;
+  NiceMock<Stats::MockHistogram> read_dispatch_us_;
 };
 
 TEST_P(ConnectionImplTest, ConnectionHash) {
@@ -721,6 +724,8 @@ TEST_P(ConnectionImplTest, ConnectionStats) {
   EXPECT_CALL(server_connection_stats.rx_current_, add(4)).InSequence(s2);
   EXPECT_CALL(server_connection_stats.rx_current_, sub(4)).InSequence(s2);
   EXPECT_CALL(server_callbacks_, onEvent(ConnectionEvent::LocalClose)).InSequence(s2);
+  EXPECT_CALL(server_connection_stats.read_dispatch_us_, recordValue(_))
+      .Times(testing::AtLeast(1));
 
   EXPECT_CALL(*read_filter_, onNewConnection());
   EXPECT_CALL(*read_filter_, onData(_, _))
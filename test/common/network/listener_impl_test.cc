@@ -360,6 +360,30 @@ TEST_P(TcpListenerImplTest, DisableAndEnableListener) {
   dispatcher_->run(Event::Dispatcher::RunType::Block);
 }
 
+TEST_P(TcpListenerImplTest, RecordsConnectionsAcceptedPerSocketEvent) {
+  auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
+      Network::Test::getCanonicalLoopbackAddress(version_));
+  MockTcpListenerCallbacks listener_callbacks;
+  Random::MockRandomGenerator random_generator;
+  NiceMock<Runtime::MockLoader> runtime;
+  TestTcpListenerImpl listener(dispatcherImpl(), random_generator, runtime, socket,
+                               listener_callbacks, true, false);
+
+  ClientConnectionPtr client_connection = dispatcher_->createClientConnection(
+      socket->connectionInfoProvider().localAddress(), Address::InstanceConstSharedPtr(),
+      Network::Test::createRawBufferSocket(), nullptr, nullptr);
+  client_connection->connect();
+
+  EXPECT_CALL(listener_callbacks, onAccept_(_)).WillOnce(Invoke([&](ConnectionSocketPtr&) -> void {
+    client_connection->close(ConnectionCloseType::NoFlush);
+  }));
+  // The single pending connection is dispatched as a batch of one.
+  EXPECT_CALL(listener_callbacks, recordConnectionsAcceptedOnSocketEvent(1)).WillOnce([&] {
+    dispatcher_->exit();
+  });
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+}
+
 TEST_P(TcpListenerImplTest, SetListenerRejectFractionZero) {
   auto socket = std::make_shared<Network::Test::TcpListenSocketImmediateListen>(
       Network::Test::getCanonicalLoopbackAddress(version_));
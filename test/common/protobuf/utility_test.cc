@@ -292,6 +292,107 @@ TEST_F(ProtobufUtilityTest, JsonConvertKnownGoodMessage) {
               testing::HasSubstr("@type"));
 }
 
+// When envoy.reloadable_features.protobuf_direct_struct_json_serialization is enabled,
+// getJsonStringFromMessage renders Struct and Value with the direct walker. For anything the
+// protobuf JSON printer accepts and formats canonically, the output must be byte-identical.
+TEST_F(ProtobufUtilityTest, DirectStructJsonSerializationMatchesPrinter) {
+  const std::vector<std::string> documents = {
+      "{}",
+      R"({"a":{"b":{"c":[1,2.5,-3,true,false,null,"x"]}}})",
+      R"({"specials":"quote\" backslash\\ control unicodeé"})",
+      R"({"numbers":[0,1,-1,1000000,1e+300,0.5,0.25,0.1,-0.75]})",
+  };
+  for (const std::string& document : documents) {
+    ProtobufWkt::Struct message;
+    TestUtility::loadFromJson(document, message);
+    const std::string from_printer = MessageUtil::getJsonStringFromMessageOrDie(message, false);
+
+    TestScopedRuntime runtime;
+    runtime.mergeValues(
+        {{"envoy.reloadable_features.protobuf_direct_struct_json_serialization", "true"}});
+    const std::string from_walker = MessageUtil::getJsonStringFromMessageOrDie(message, false);
+    EXPECT_EQ(from_printer, from_walker) << document;
+  }
+
+  // A bare Value takes the same fast path.
+  ProtobufWkt::Value value;
+  value.set_string_value("plain");
+  const std::string from_printer = MessageUtil::getJsonStringFromMessageOrDie(value, false);
+  TestScopedRuntime runtime;
+  runtime.mergeValues(
+      {{"envoy.reloadable_features.protobuf_direct_struct_json_serialization", "true"}});
+  EXPECT_EQ(from_printer, MessageUtil::getJsonStringFromMessageOrDie(value, false));
+}
+
+// Both serializers format doubles from their own formatting code (shortest round-trip for the
+// walker, precision-stepped printf for the printer), so the textual form of an awkward double
+// may legitimately differ; the values must still round-trip identically.
+TEST_F(ProtobufUtilityTest, DirectStructJsonSerializationDoubleRoundTrip) {
+  const std::vector<double> values = {1.0 / 3.0, 2.0 / 3.0, 1e-7, 1.7976931348623157e308};
+  for (double number : values) {
+    ProtobufWkt::Struct message;
+    (*message.mutable_fields())["n"].set_number_value(number);
+    const auto from_printer = MessageUtil::getJsonStringFromMessage(message, false);
+    ASSERT_TRUE(from_printer.ok());
+
+    TestScopedRuntime runtime;
+    runtime.mergeValues(
+        {{"envoy.reloadable_features.protobuf_direct_struct_json_serialization", "true"}});
+    const auto from_walker = MessageUtil::getJsonStringFromMessage(message, false);
+    ASSERT_TRUE(from_walker.ok());
+
+    ProtobufWkt::Struct reparsed_printer;
+    ProtobufWkt::Struct reparsed_walker;
+    TestUtility::loadFromJson(from_printer.value(), reparsed_printer);
+    TestUtility::loadFromJson(from_walker.value(), reparsed_walker);
+    EXPECT_EQ(reparsed_printer.fields().at("n").number_value(),
+              reparsed_walker.fields().at("n").number_value())
+        << number;
+  }
+}
+
+// The direct walker accepts inputs that the protobuf JSON printer rejects or renders
+// differently, which is why the fast path is opt-in until the divergence is resolved.
+TEST_F(ProtobufUtilityTest, DirectStructJsonSerializationPrinterErrorCases) {
+  // Non-finite numbers: the walker follows the printer's double-field convention of quoted
+  // "NaN"/"Infinity" strings; the printer itself refuses them inside a Value.
+  {
+    ProtobufWkt::Struct message;
+    (*message.mutable_fields())["nan"].set_number_value(
+        std::numeric_limits<double>::quiet_NaN());
+    (*message.mutable_fields())["inf"].set_number_value(std::numeric_limits<double>::infinity());
+    const auto from_printer = MessageUtil::getJsonStringFromMessage(message, false);
+
+    TestScopedRuntime runtime;
+    runtime.mergeValues(
+        {{"envoy.reloadable_features.protobuf_direct_struct_json_serialization", "true"}});
+    const auto from_walker = MessageUtil::getJsonStringFromMessage(message, false);
+    ASSERT_TRUE(from_walker.ok());
+    EXPECT_THAT(from_walker.value(), HasSubstr("\"NaN\""));
+    EXPECT_THAT(from_walker.value(), HasSubstr("\"Infinity\""));
+    if (from_printer.ok()) {
+      EXPECT_NE(from_printer.value(), from_walker.value());
+    }
+  }
+
+  // Invalid UTF-8: the walker escapes the raw bytes; the printer errors out or substitutes
+  // replacement characters depending on the protobuf version.
+  {
+    ProtobufWkt::Struct message;
+    (*message.mutable_fields())["bad"].set_string_value("truncated\xc3");
+    const auto from_printer = MessageUtil::getJsonStringFromMessage(message, false);
+
+    TestScopedRuntime runtime;
+    runtime.mergeValues(
+        {{"envoy.reloadable_features.protobuf_direct_struct_json_serialization", "true"}});
+    const auto from_walker = MessageUtil::getJsonStringFromMessage(message, false);
+    ASSERT_TRUE(from_walker.ok());
+    if (from_printer.ok()) {
+      EXPECT_NE(from_printer.value(), from_walker.value());
+    }
+  }
+}
+
 TEST_F(ProtobufUtilityTest, JsonConvertOrErrorAnyWithUnknownMessageType) {
   ProtobufWkt::Any source_any;
   source_any.set_type_url("type.googleapis.com/bad.type.url");
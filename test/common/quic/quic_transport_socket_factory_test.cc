@@ -143,6 +143,9 @@ TEST_F(QuicClientTransportSocketFactoryTest, GetCryptoConfig) {
   update_callback_();
   std::shared_ptr<quic::QuicCryptoClientConfig> crypto_config2 = factory_->getCryptoConfig();
   EXPECT_NE(crypto_config2, crypto_config1);
+  // The session cache persists across context updates so that resumption tickets cached
+  // under the previous context are still usable for 0-RTT.
+  EXPECT_EQ(crypto_config2->session_cache(), crypto_config1->session_cache());
 }
 
 } // namespace Quic
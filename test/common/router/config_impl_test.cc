@@ -479,6 +479,73 @@ virtual_hosts:
             config.route(genHeaders("bat5.com", " ", "CONNECT"), 0)->routeEntry()->clusterName());
 }
 
+// A virtual host whose routes all match on literal case sensitive paths takes the
+// PathOnlyRouteIndex fast path; verify it preserves first-match-wins and exact/prefix
+// precedence exactly as the linear scan does.
+TEST_F(RouteMatcherTest, PathOnlyRouteIndex) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+- name: indexed
+  domains:
+  - indexed.lyft.com
+  routes:
+  - match:
+      path: "/api/users"
+    route:
+      cluster: exact_users
+  - match:
+      prefix: "/api/users"
+    route:
+      cluster: prefix_users
+  - match:
+      prefix: "/api"
+    route:
+      cluster: prefix_api
+  - match:
+      path: "/api"
+    route:
+      cluster: unreachable_exact_api
+  - match:
+      prefix: "/"
+    route:
+      cluster: catch_all
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters(
+      {"exact_users", "prefix_users", "prefix_api", "unreachable_exact_api", "catch_all"}, {});
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true);
+
+  // Exact match wins because it is listed first.
+  EXPECT_EQ("exact_users", config.route(genHeaders("indexed.lyft.com", "/api/users", "GET"), 0)
+                               ->routeEntry()
+                               ->clusterName());
+  // Query strings are ignored for matching.
+  EXPECT_EQ("exact_users",
+            config.route(genHeaders("indexed.lyft.com", "/api/users?id=1", "GET"), 0)
+                ->routeEntry()
+                ->clusterName());
+  // Longer paths fall through to the prefix route.
+  EXPECT_EQ("prefix_users",
+            config.route(genHeaders("indexed.lyft.com", "/api/users/10", "GET"), 0)
+                ->routeEntry()
+                ->clusterName());
+  // "/api" hits the earlier prefix route, not the later (unreachable) exact route.
+  EXPECT_EQ("prefix_api", config.route(genHeaders("indexed.lyft.com", "/api", "GET"), 0)
+                              ->routeEntry()
+                              ->clusterName());
+  EXPECT_EQ("prefix_api", config.route(genHeaders("indexed.lyft.com", "/apifoo", "GET"), 0)
+                              ->routeEntry()
+                              ->clusterName());
+  // Everything else lands on the catch-all prefix.
+  EXPECT_EQ("catch_all", config.route(genHeaders("indexed.lyft.com", "/other", "GET"), 0)
+                             ->routeEntry()
+                             ->clusterName());
+  // Case sensitivity is preserved.
+  EXPECT_EQ("catch_all", config.route(genHeaders("indexed.lyft.com", "/API/users", "GET"), 0)
+                             ->routeEntry()
+                             ->clusterName());
+}
+
 TEST_F(RouteMatcherTest, TestRoutes) {
   const std::string yaml = R"EOF(
 virtual_hosts:
@@ -6337,6 +6404,37 @@ virtual_hosts:
                EnvoyException);
 }
 
+// Zero weight clusters must never be picked; the boundary value at the end of a zero width
+// interval belongs to the next non-zero cluster on both the precomputed binary search path and
+// the runtime scan path.
+TEST_F(RouteMatcherTest, WeightedClustersZeroWeightEntrySkipped) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: www1
+    domains: ["www1.lyft.com"]
+    routes:
+      - match: { prefix: "/" }
+        route:
+          weighted_clusters:
+            clusters:
+              - name: cluster1
+                weight: 30
+              - name: cluster2
+                weight: 0
+              - name: cluster3
+                weight: 70
+  )EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"cluster1", "cluster2", "cluster3"}, {});
+  TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true);
+
+  Http::TestRequestHeaderMapImpl headers = genHeaders("www1.lyft.com", "/foo", "GET");
+  EXPECT_EQ("cluster1", config.route(headers, 29)->routeEntry()->clusterName());
+  // Value 30 falls on the boundary of cluster2's zero width interval and must select cluster3.
+  EXPECT_EQ("cluster3", config.route(headers, 30)->routeEntry()->clusterName());
+  EXPECT_EQ("cluster3", config.route(headers, 99)->routeEntry()->clusterName());
+}
+
 TEST_F(RouteMatcherTest, WeightedClustersMissingClusterList) {
   const std::string yaml = R"EOF(
 virtual_hosts:
@@ -10602,6 +10700,106 @@ virtual_hosts:
   checkEach(yaml, 123, expected_traveled_config, "filter.unknown");
 }
 
+TEST_F(PerFilterConfigsTest, RouteFilterConfigWrapperTypedConfig) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: bar
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: baz }
+        typed_per_filter_config:
+          test.filter:
+            "@type": type.googleapis.com/envoy.config.route.v3.FilterConfig
+            config:
+              "@type": type.googleapis.com/google.protobuf.Timestamp
+              value:
+                seconds: 123
+    typed_per_filter_config:
+      test.filter:
+        "@type": type.googleapis.com/google.protobuf.Timestamp
+        value:
+          seconds: 456
+)EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"baz"}, {});
+  absl::InlinedVector<uint32_t, 3> expected_traveled_config({456, 123});
+  checkEach(yaml, 123, expected_traveled_config, "test.filter");
+}
+
+TEST_F(PerFilterConfigsTest, FilterDisabledMostSpecificWins) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: bar
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/enabled" }
+        route: { cluster: baz }
+        typed_per_filter_config:
+          test.filter:
+            "@type": type.googleapis.com/envoy.config.route.v3.FilterConfig
+            config:
+              "@type": type.googleapis.com/google.protobuf.Timestamp
+              value:
+                seconds: 123
+      - match: { prefix: "/" }
+        route: { cluster: baz }
+    typed_per_filter_config:
+      test.filter:
+        "@type": type.googleapis.com/envoy.config.route.v3.FilterConfig
+        disabled: true
+)EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"baz"}, {});
+  const TestConfigImpl config(parseRouteConfigurationFromYaml(yaml), factory_context_, true);
+
+  // A route without its own entry inherits the virtual host level disabling.
+  const auto disabled_route = config.route(genHeaders("www.foo.com", "/", "GET"), 0);
+  EXPECT_EQ(absl::make_optional(true), disabled_route->filterDisabled("test.filter"));
+  EXPECT_EQ(nullptr, disabled_route->mostSpecificPerFilterConfig("test.filter"));
+  // A route level entry (here an explicit config) takes precedence over the virtual host.
+  const auto enabled_route = config.route(genHeaders("www.foo.com", "/enabled", "GET"), 0);
+  EXPECT_EQ(absl::make_optional(false), enabled_route->filterDisabled("test.filter"));
+  // A filter with no entry at any level is neither enabled nor disabled by the route.
+  EXPECT_EQ(absl::nullopt, enabled_route->filterDisabled("filter.unknown"));
+}
+
+TEST_F(PerFilterConfigsTest, FilterConfigWrapperWithoutConfigRejected) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: bar
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: baz }
+        typed_per_filter_config:
+          test.filter:
+            "@type": type.googleapis.com/envoy.config.route.v3.FilterConfig
+)EOF";
+
+  EXPECT_THROW_WITH_MESSAGE(
+      TestConfigImpl(parseRouteConfigurationFromYaml(yaml), factory_context_, true), EnvoyException,
+      "Empty FilterConfig for http filter 'test.filter' is not allowed");
+}
+
+TEST_F(PerFilterConfigsTest, OptionalFilterConfigWrapperWithoutConfigIgnored) {
+  const std::string yaml = R"EOF(
+virtual_hosts:
+  - name: bar
+    domains: ["*"]
+    routes:
+      - match: { prefix: "/" }
+        route: { cluster: baz }
+        typed_per_filter_config:
+          test.filter:
+            "@type": type.googleapis.com/envoy.config.route.v3.FilterConfig
+            is_optional: true
+)EOF";
+
+  factory_context_.cluster_manager_.initializeClusters({"baz"}, {});
+  checkNoPerFilterConfig(yaml, "test.filter");
+}
+
 class RouteMatchOverrideTest : public testing::Test, public ConfigImplTestBase {};
 
 TEST_F(RouteMatchOverrideTest, VerifyAllMatchableRoutes) {
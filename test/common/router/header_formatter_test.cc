@@ -1347,6 +1347,42 @@ request_headers_to_add:
   EXPECT_TRUE(header_map.has("x-client-port"));
 }
 
+TEST(HeaderParserTest, ConfigureSharedDeduplicatesIdenticalConfigs) {
+  const std::string yaml = R"EOF(
+match: { prefix: "/new_endpoint" }
+route:
+  cluster: "www2"
+request_headers_to_add:
+  - header:
+      key: "x-client-ip"
+      value: "%DOWNSTREAM_REMOTE_ADDRESS_WITHOUT_PORT%"
+    append_action: APPEND_IF_EXISTS_OR_ADD
+request_headers_to_remove: ["x-remove-me"]
+)EOF";
+
+  const auto route = parseRouteFromV3Yaml(yaml);
+  HeaderParserSharedPtr parser1 = HeaderParser::configureShared(route.request_headers_to_add(),
+                                                                route.request_headers_to_remove());
+  HeaderParserSharedPtr parser2 = HeaderParser::configureShared(route.request_headers_to_add(),
+                                                                route.request_headers_to_remove());
+  // Identical configs share one parser instance.
+  EXPECT_EQ(parser1.get(), parser2.get());
+
+  // A differing config (same adds, different removals) gets its own parser.
+  auto other_route = route;
+  other_route.add_request_headers_to_remove("x-remove-me-too");
+  HeaderParserSharedPtr parser3 = HeaderParser::configureShared(
+      other_route.request_headers_to_add(), other_route.request_headers_to_remove());
+  EXPECT_NE(parser1.get(), parser3.get());
+
+  // The shared parser behaves like a privately configured one.
+  Http::TestRequestHeaderMapImpl header_map{{":method", "POST"}, {"x-remove-me", "1"}};
+  NiceMock<Envoy::StreamInfo::MockStreamInfo> stream_info;
+  parser1->evaluateHeaders(header_map, stream_info);
+  EXPECT_TRUE(header_map.has("x-client-ip"));
+  EXPECT_FALSE(header_map.has("x-remove-me"));
+}
+
 TEST(HeaderParserTest, EvaluateHeadersAppendIfEmpty) {
   const std::string yaml = R"EOF(
 match: { prefix: "/new_endpoint" }
@@ -2087,7 +2087,12 @@ TEST_F(RouterTest, HedgedPerTryTimeoutFirstRequestSucceeds) {
   EXPECT_EQ(0U, router_->upstreamRequests().size());
   EXPECT_FALSE(router_->finalUpstreamRequest() == nullptr);
 
-  // TODO: Verify hedge stats here once they are implemented.
+  EXPECT_EQ(1U, cm_.thread_local_cluster_.cluster_.info_->stats_store_
+                    .counter("upstream_rq_hedge_attempted")
+                    .value());
+  EXPECT_EQ(1U, cm_.thread_local_cluster_.cluster_.info_->stats_store_
+                    .counter("upstream_rq_hedge_abandoned")
+                    .value());
 }
 
 // Tests that an upstream request is reset even if it can't be retried as long as there is
@@ -4392,7 +4397,8 @@ std::shared_ptr<ShadowPolicyImpl>
 makeShadowPolicy(std::string cluster = "", std::string cluster_header = "",
                  absl::optional<std::string> runtime_key = absl::nullopt,
                  absl::optional<envoy::type::v3::FractionalPercent> default_value = absl::nullopt,
-                 bool trace_sampled = true) {
+                 bool trace_sampled = true,
+                 absl::optional<uint64_t> max_mirrored_body_bytes = absl::nullopt) {
   envoy::config::route::v3::RouteAction::RequestMirrorPolicy policy;
   policy.set_cluster(cluster);
   policy.set_cluster_header(cluster_header);
@@ -4403,6 +4409,9 @@ makeShadowPolicy(std::string cluster = "", std::string cluster_header = "",
     *policy.mutable_runtime_fraction()->mutable_default_value() = default_value.value();
   }
   policy.mutable_trace_sampled()->set_value(trace_sampled);
+  if (max_mirrored_body_bytes.has_value()) {
+    policy.mutable_max_mirrored_body_bytes()->set_value(*max_mirrored_body_bytes);
+  }
 
   return std::make_shared<ShadowPolicyImpl>(policy);
 }
@@ -4484,6 +4493,60 @@ TEST_P(RouterShadowingTest, BufferingShadowWithClusterHeader) {
   EXPECT_TRUE(verifyHostUpstreamStats(1, 0));
 }
 
+// A policy with max_mirrored_body_bytes buffers and truncates the mirrored body even when
+// streaming shadows are enabled, and rewrites the mirrored content-length to the truncated size.
+TEST_P(RouterShadowingTest, BufferingShadowWithBodyCap) {
+  ShadowPolicyPtr policy = makeShadowPolicy("", "some_header", "bar", absl::nullopt,
+                                            /*trace_sampled=*/true,
+                                            /*max_mirrored_body_bytes=*/5);
+  callbacks_.route_->route_entry_.shadow_policies_.push_back(policy);
+  ON_CALL(callbacks_, streamId()).WillByDefault(Return(43));
+
+  NiceMock<Http::MockRequestEncoder> encoder;
+  Http::ResponseDecoder* response_decoder = nullptr;
+  expectNewStreamWithImmediateEncoder(encoder, &response_decoder, Http::Protocol::Http10);
+
+  EXPECT_CALL(
+      runtime_.snapshot_,
+      featureEnabled("bar", testing::Matcher<const envoy::type::v3::FractionalPercent&>(Percent(0)),
+                     43))
+      .WillOnce(Return(true));
+
+  expectResponseTimerCreate();
+  Http::TestRequestHeaderMapImpl headers;
+  HttpTestUtility::addDefaultHeaders(headers);
+  headers.addCopy("some_header", "some_cluster");
+  headers.addCopy("content-length", "11");
+
+  router_->decodeHeaders(headers, false);
+
+  Buffer::InstancePtr body_data(new Buffer::OwnedImpl("hello world"));
+
+  EXPECT_CALL(callbacks_, addDecodedData(_, true));
+
+  EXPECT_EQ(Http::FilterDataStatus::StopIterationNoBuffer, router_->decodeData(*body_data, false));
+
+  Http::TestRequestTrailerMapImpl trailers{{"some", "trailer"}};
+  EXPECT_CALL(callbacks_, decodingBuffer())
+      .Times(AtLeast(2))
+      .WillRepeatedly(Return(body_data.get()));
+  EXPECT_CALL(*shadow_writer_, shadow_("some_cluster", _, _))
+      .WillOnce(Invoke([](const std::string&, Http::RequestMessagePtr& request,
+                          const Http::AsyncClient::RequestOptions&) -> void {
+        EXPECT_EQ("hello", request->body().toString());
+        EXPECT_EQ("5", request->headers().getContentLengthValue());
+      }));
+
+  router_->decodeTrailers(trailers);
+  EXPECT_EQ(1U,
+            callbacks_.route_->route_entry_.virtual_cluster_.stats().upstream_rq_total_.value());
+
+  Http::ResponseHeaderMapPtr response_headers(
+      new Http::TestResponseHeaderMapImpl{{":status", "200"}});
+  response_decoder->decodeHeaders(std::move(response_headers), true);
+  EXPECT_TRUE(verifyHostUpstreamStats(1, 0));
+}
+
 TEST_P(RouterShadowingTest, ShadowNoClusterHeaderInHeader) {
   ShadowPolicyPtr policy = makeShadowPolicy("", "some_header", "bar");
   callbacks_.route_->route_entry_.shadow_policies_.push_back(policy);
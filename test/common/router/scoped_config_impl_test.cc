@@ -350,6 +350,45 @@ TEST(ScopeKeyBuilderImplTest, Parse) {
   EXPECT_EQ(key, nullptr);
 }
 
+// The allocation-free hash computation must agree with computeScopeKey() in both the matched and
+// unmatched cases, since config-time scopes are indexed by ScopeKey::hash().
+TEST(ScopeKeyBuilderImplTest, ComputeScopeKeyHashMatchesComputeScopeKey) {
+  std::string yaml_plain = R"EOF(
+  fragments:
+  - header_value_extractor:
+      name: 'foo_header'
+      element_separator: ','
+      element:
+        key: 'bar'
+        separator: '='
+  - header_value_extractor:
+      name: 'bar_header'
+      element_separator: ';'
+      index: 2
+)EOF";
+
+  ScopedRoutes::ScopeKeyBuilder config;
+  TestUtility::loadFromYaml(yaml_plain, config);
+  ScopeKeyBuilderImpl key_builder(std::move(config));
+
+  const TestRequestHeaderMapImpl matching_headers{
+      {"foo_header", "a=b,bar=bar_value,e=f"},
+      {"bar_header", "a=b;bar=bar_value;index2"},
+  };
+  ScopeKeyPtr key = key_builder.computeScopeKey(matching_headers);
+  ASSERT_NE(key, nullptr);
+  absl::optional<uint64_t> hash = key_builder.computeScopeKeyHash(matching_headers);
+  ASSERT_TRUE(hash.has_value());
+  EXPECT_EQ(key->hash(), *hash);
+
+  // No key can be computed when a fragment is missing.
+  hash = key_builder.computeScopeKeyHash(TestRequestHeaderMapImpl{
+      {"foo_header", "a=b,meh,e=f"},
+      {"bar_header", "a=b;bar=bar_value;"},
+  });
+  EXPECT_FALSE(hash.has_value());
+}
+
 class ScopedRouteInfoTest : public testing::Test {
 public:
   void SetUp() override {
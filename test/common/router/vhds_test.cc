@@ -144,6 +144,40 @@ TEST_F(VhdsTest, VhdsAddsVirtualHosts) {
       vhost, config_update_info->protobufConfigurationCast().virtual_hosts(0)));
 }
 
+// verify that resending unchanged virtual hosts does not recompile the route table
+TEST_F(VhdsTest, VhdsNoopUpdateKeepsParsedConfiguration) {
+  const auto route_config =
+      TestUtility::parseYaml<envoy::config::route::v3::RouteConfiguration>(default_vhds_config_);
+  RouteConfigUpdatePtr config_update_info = makeRouteConfigUpdate(route_config);
+
+  VhdsSubscription subscription(config_update_info, factory_context_, context_, provider_);
+
+  auto vhost = buildVirtualHost("vhost1", "vhost.first");
+  const auto& added_resources = buildAddedResources({vhost});
+  const auto decoded_resources =
+      TestUtility::decodeResources<envoy::config::route::v3::VirtualHost>(added_resources);
+  const Protobuf::RepeatedPtrField<std::string> removed_resources;
+  factory_context_.cluster_manager_.subscription_factory_.callbacks_->onConfigUpdate(
+      decoded_resources.refvec_, removed_resources, "1");
+  const auto config_after_first_update = config_update_info->parsedConfiguration();
+
+  // Resending the identical virtual host must keep the previously parsed configuration.
+  factory_context_.cluster_manager_.subscription_factory_.callbacks_->onConfigUpdate(
+      decoded_resources.refvec_, removed_resources, "2");
+  EXPECT_EQ(config_after_first_update, config_update_info->parsedConfiguration());
+
+  // A modified virtual host triggers a rebuild.
+  auto updated_vhost = buildVirtualHost("vhost1", "vhost.first.updated");
+  const auto& updated_resources = buildAddedResources({updated_vhost});
+  const auto decoded_updated_resources =
+      TestUtility::decodeResources<envoy::config::route::v3::VirtualHost>(updated_resources);
+  factory_context_.cluster_manager_.subscription_factory_.callbacks_->onConfigUpdate(
+      decoded_updated_resources.refvec_, removed_resources, "3");
+  EXPECT_NE(config_after_first_update, config_update_info->parsedConfiguration());
+  EXPECT_TRUE(messageDifferencer_.Equals(
+      updated_vhost, config_update_info->protobufConfigurationCast().virtual_hosts(0)));
+}
+
 // verify that an RDS update of virtual hosts leaves VHDS virtual hosts intact
 TEST_F(VhdsTest, RdsUpdatesVirtualHosts) {
   const auto route_config =
@@ -297,6 +297,29 @@ TEST_F(DiskLoaderImplTest, GetLayers) {
   EXPECT_EQ(2, store_.counter("runtime.load_success").value());
 }
 
+TEST_F(DiskLoaderImplTest, UnchangedLayersAreSharedAcrossSnapshots) {
+  setup();
+  run("test/common/runtime/test_data/current", "envoy_override");
+  // Copy the layer vector so that the old layers stay alive for pointer comparisons below.
+  const auto old_layers = loader_->snapshot().getLayers();
+
+  // An admin merge rebuilds only the admin layer; the static and disk layers are shared with the
+  // previous snapshot.
+  loader_->mergeValues({{"foo", "bar"}});
+  const auto& layers_after_merge = loader_->snapshot().getLayers();
+  EXPECT_EQ(old_layers[0].get(), layers_after_merge[0].get());
+  EXPECT_EQ(old_layers[1].get(), layers_after_merge[1].get());
+  EXPECT_EQ(old_layers[2].get(), layers_after_merge[2].get());
+  EXPECT_NE(old_layers[3].get(), layers_after_merge[3].get());
+
+  // A disk symlink swap rebuilds the disk layers but not the static layer.
+  updateDiskLayer(0);
+  const auto& layers_after_swap = loader_->snapshot().getLayers();
+  EXPECT_EQ(old_layers[0].get(), layers_after_swap[0].get());
+  EXPECT_NE(layers_after_merge[1].get(), layers_after_swap[1].get());
+  EXPECT_NE(layers_after_merge[2].get(), layers_after_swap[2].get());
+}
+
 TEST_F(DiskLoaderImplTest, BadDirectory) {
   setup();
   run("/baddir", "/baddir");
@@ -571,6 +594,35 @@ TEST_F(StaticLoaderImplTest, QuicheReloadableFlags) {
 }
 #endif
 
+TEST_F(StaticLoaderImplTest, CachedRuntimeFeatureTracksGuardUpdates) {
+  setup();
+  // Static since registered handles are never unregistered and must outlive the registry's
+  // references to them.
+  static Runtime::CachedRuntimeFeature cached_feature(
+      "envoy.reloadable_features.test_feature_true");
+  EXPECT_TRUE(cached_feature.enabled());
+
+  // Runtime merges update the cached value through maybeSetRuntimeGuard().
+  loader_->mergeValues({{"envoy.reloadable_features.test_feature_true", "false"}});
+  EXPECT_FALSE(cached_feature.enabled());
+  loader_->mergeValues({{"envoy.reloadable_features.test_feature_true", "true"}});
+  EXPECT_TRUE(cached_feature.enabled());
+
+  // A flag change that bypasses maybeSetRuntimeGuard() (as the FlagSaver restoration in
+  // TestScopedRuntime does) leaves the handle stale until an explicit refresh.
+  absl::CommandLineFlag* flag =
+      absl::FindCommandLineFlag("envoy_reloadable_features_test_feature_true");
+  ASSERT_NE(nullptr, flag);
+  std::string err;
+  flag->ParseFrom("false", &err);
+  EXPECT_TRUE(cached_feature.enabled());
+  Runtime::refreshCachedRuntimeFeatures();
+  EXPECT_FALSE(cached_feature.enabled());
+  flag->ParseFrom("true", &err);
+  Runtime::refreshCachedRuntimeFeatures();
+  EXPECT_TRUE(cached_feature.enabled());
+}
+
 TEST_F(StaticLoaderImplTest, RemovedFlags) {
   base_ = TestUtility::parseYaml<ProtobufWkt::Struct>(R"EOF(
     envoy.reloadable_features.removed_foo: true
@@ -345,6 +345,92 @@ TEST_F(AllocatorImplTest, ForEachWithNullSizeLambda) {
   EXPECT_EQ(num_iterations, num_stats);
 }
 
+// Verify that family iteration groups counters by tag-extracted name, orders
+// families and their members by name, and tracks creation and destruction of
+// stats incrementally.
+TEST_F(AllocatorImplTest, CounterFamilies) {
+  StatName rq_total = makeStat("cluster.upstream_rq_total");
+  StatName live = makeStat("server.live");
+
+  // Create members out of name order to verify the index sorts them.
+  std::vector<CounterSharedPtr> counters;
+  counters.emplace_back(alloc_.makeCounter(makeStat("cluster.b.upstream_rq_total"), rq_total, {}));
+  counters.emplace_back(alloc_.makeCounter(makeStat("server.live"), live, {}));
+  counters.emplace_back(alloc_.makeCounter(makeStat("cluster.a.upstream_rq_total"), rq_total, {}));
+
+  auto collect = [this]() -> std::vector<std::string> {
+    std::vector<std::string> families;
+    alloc_.forEachCounterFamily(
+        [this, &families](StatName name, const std::vector<CounterSharedPtr>& stats) -> bool {
+          std::string family = absl::StrCat(symbol_table_.toString(name), ":");
+          for (const CounterSharedPtr& stat : stats) {
+            absl::StrAppend(&family, " ", stat->name());
+          }
+          families.push_back(family);
+          return true;
+        });
+    return families;
+  };
+
+  EXPECT_THAT(collect(),
+              ::testing::ElementsAre(
+                  "cluster.upstream_rq_total: cluster.a.upstream_rq_total "
+                  "cluster.b.upstream_rq_total",
+                  "server.live: server.live"));
+
+  // Returning false stops the iteration after the first family.
+  size_t num_families = 0;
+  alloc_.forEachCounterFamily([&num_families](StatName, const std::vector<CounterSharedPtr>&) {
+    ++num_families;
+    return false;
+  });
+  EXPECT_EQ(num_families, 1);
+
+  // Destroying the first member re-keys the family from the survivor.
+  counters.erase(counters.begin() + 2);
+  EXPECT_THAT(collect(), ::testing::ElementsAre("cluster.upstream_rq_total: "
+                                                "cluster.b.upstream_rq_total",
+                                                "server.live: server.live"));
+
+  // A stat marked for deletion drops out of its family immediately.
+  alloc_.markCounterForDeletion(counters[0]);
+  are_stats_marked_for_deletion_ = true;
+  counters.erase(counters.begin());
+  EXPECT_THAT(collect(), ::testing::ElementsAre("server.live: server.live"));
+
+  counters.clear();
+  EXPECT_THAT(collect(), ::testing::IsEmpty());
+}
+
+// Spot-check the gauge and text-readout family indexes, which share their
+// implementation with the counter index exercised above.
+TEST_F(AllocatorImplTest, GaugeAndTextReadoutFamilies) {
+  StatName membership = makeStat("cluster.membership_healthy");
+  GaugeSharedPtr g1 = alloc_.makeGauge(makeStat("cluster.a.membership_healthy"), membership, {},
+                                       Gauge::ImportMode::Accumulate);
+  GaugeSharedPtr g2 = alloc_.makeGauge(makeStat("cluster.b.membership_healthy"), membership, {},
+                                       Gauge::ImportMode::Accumulate);
+  size_t num_gauges = 0;
+  alloc_.forEachGaugeFamily(
+      [&](StatName name, const std::vector<GaugeSharedPtr>& stats) -> bool {
+        EXPECT_EQ(name, membership);
+        num_gauges += stats.size();
+        return true;
+      });
+  EXPECT_EQ(num_gauges, 2);
+
+  StatName version = makeStat("server.version");
+  TextReadoutSharedPtr t1 = alloc_.makeTextReadout(makeStat("server.version"), version, {});
+  size_t num_text_readouts = 0;
+  alloc_.forEachTextReadoutFamily(
+      [&](StatName name, const std::vector<TextReadoutSharedPtr>& stats) -> bool {
+        EXPECT_EQ(name, version);
+        num_text_readouts += stats.size();
+        return true;
+      });
+  EXPECT_EQ(num_text_readouts, 1);
+}
+
 // Currently, if we ask for a stat from the Allocator that has already been
 // marked for deletion (i.e. rejected) we get a new stat with the same name.
 // This test documents this behavior.
@@ -0,0 +1,104 @@
+#include <limits>
+
+#include "source/common/stats/fixed_layout_histogram.h"
+
+#include "gtest/gtest.h"
+
+namespace Envoy {
+namespace Stats {
+namespace {
+
+TEST(FixedLayoutHistogramTest, BucketIndexSmallValuesExact) {
+  // Values below 2 * SubBucketCount land in consecutive width-1 buckets.
+  for (uint64_t value = 0; value < 2 * FixedLayoutHistogram::SubBucketCount; ++value) {
+    const uint32_t index = FixedLayoutHistogram::bucketIndex(value);
+    EXPECT_EQ(value, index);
+    EXPECT_EQ(value, FixedLayoutHistogram::bucketLowerBound(index));
+    EXPECT_EQ(1, FixedLayoutHistogram::bucketWidth(index));
+  }
+}
+
+TEST(FixedLayoutHistogramTest, BucketBoundsConsistent) {
+  // Every value maps to a bucket whose [lower, lower + width) range contains
+  // it, buckets are contiguous, and the relative error is bounded by the
+  // bucket width over its lower bound.
+  for (uint64_t value : {1ULL << 5, (1ULL << 20) + 12345, (1ULL << 40) + 7, (1ULL << 63) + 1,
+                         std::numeric_limits<uint64_t>::max()}) {
+    const uint32_t index = FixedLayoutHistogram::bucketIndex(value);
+    ASSERT_LE(index, FixedLayoutHistogram::MaxBucketIndex);
+    const uint64_t lower = FixedLayoutHistogram::bucketLowerBound(index);
+    const uint64_t width = FixedLayoutHistogram::bucketWidth(index);
+    EXPECT_LE(lower, value);
+    EXPECT_LT(value - lower, width);
+    EXPECT_LE(static_cast<double>(width) / static_cast<double>(lower),
+              1.0 / FixedLayoutHistogram::SubBucketCount);
+  }
+  for (uint32_t index = 0; index < FixedLayoutHistogram::MaxBucketIndex; ++index) {
+    EXPECT_EQ(FixedLayoutHistogram::bucketLowerBound(index) +
+                  FixedLayoutHistogram::bucketWidth(index),
+              FixedLayoutHistogram::bucketLowerBound(index + 1));
+  }
+}
+
+TEST(FixedLayoutHistogramTest, RecordMergeClear) {
+  FixedLayoutHistogram h1;
+  FixedLayoutHistogram h2;
+  h1.recordValue(5);
+  h1.recordValue(5);
+  h2.recordValue(1000);
+
+  h1.merge(h2);
+  EXPECT_EQ(3, h1.sampleCount());
+  EXPECT_EQ(1010, h1.sampleSum());
+
+  // The source histogram is unchanged by the merge.
+  EXPECT_EQ(1, h2.sampleCount());
+
+  h1.clear();
+  EXPECT_EQ(0, h1.sampleCount());
+  EXPECT_EQ(0, h1.sampleSum());
+  double quantile = 1.0;
+  double out;
+  h1.approxQuantiles(&quantile, 1, &out);
+  EXPECT_EQ(0, out);
+}
+
+TEST(FixedLayoutHistogramTest, ApproxQuantiles) {
+  FixedLayoutHistogram histogram;
+  for (uint64_t value = 1; value <= 1000; ++value) {
+    histogram.recordValue(value);
+  }
+  const std::vector<double> quantiles{0, 0.5, 0.99, 1};
+  std::vector<double> computed(quantiles.size());
+  histogram.approxQuantiles(quantiles.data(), quantiles.size(), computed.data());
+
+  EXPECT_EQ(1, computed[0]);
+  // Interpolated quantiles are within one sub-bucket of the exact value.
+  EXPECT_NEAR(500, computed[1], 500.0 / FixedLayoutHistogram::SubBucketCount);
+  EXPECT_NEAR(990, computed[2], 990.0 / FixedLayoutHistogram::SubBucketCount);
+  EXPECT_NEAR(1000, computed[3], 1000.0 / FixedLayoutHistogram::SubBucketCount);
+}
+
+TEST(FixedLayoutHistogramTest, ApproxCountBelow) {
+  FixedLayoutHistogram histogram;
+  for (uint64_t value = 0; value < 10; ++value) {
+    histogram.recordValue(value); // Exact, width-1 buckets.
+  }
+  EXPECT_EQ(0, histogram.approxCountBelow(0));
+  EXPECT_EQ(5, histogram.approxCountBelow(5));
+  EXPECT_EQ(10, histogram.approxCountBelow(100));
+
+  // A threshold inside a wider bucket interpolates linearly.
+  FixedLayoutHistogram wide;
+  const uint32_t index = FixedLayoutHistogram::bucketIndex(1000);
+  const uint64_t lower = FixedLayoutHistogram::bucketLowerBound(index);
+  const uint64_t width = FixedLayoutHistogram::bucketWidth(index);
+  for (int i = 0; i < 4; ++i) {
+    wide.recordValue(1000);
+  }
+  EXPECT_EQ(2, wide.approxCountBelow(static_cast<double>(lower) + width / 2.0));
+}
+
+} // namespace
+} // namespace Stats
+} // namespace Envoy
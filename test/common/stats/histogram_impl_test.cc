@@ -107,5 +107,17 @@ TEST_F(HistogramSettingsImplTest, ScaledPercent) {
   EXPECT_EQ(settings_->buckets("abcd"), ConstSupportedBuckets({0.1, 2}));
 }
 
+// Test that the fixed-layout backend selection is parsed from the config and
+// defaults to off.
+TEST_F(HistogramSettingsImplTest, FixedLayout) {
+  initialize();
+  EXPECT_FALSE(settings_->useFixedLayout());
+
+  envoy::config::metrics::v3::StatsConfig config;
+  config.set_use_fixed_layout_histograms(true);
+  settings_ = std::make_unique<HistogramSettingsImpl>(config);
+  EXPECT_TRUE(settings_->useFixedLayout());
+}
+
 } // namespace Stats
 } // namespace Envoy
@@ -106,6 +106,20 @@ TEST_F(StatNameTest, TestEmpty) {
   EXPECT_TRUE(StatName().empty());
 }
 
+TEST_F(StatNameTest, AddAll) {
+  const std::vector<absl::string_view> names = {"cluster.upstream_rq", "cluster.upstream_cx", "",
+                                                "trailing.dot."};
+  const std::vector<StatName> stat_names = pool_.addAll(names);
+  ASSERT_EQ(names.size(), stat_names.size());
+
+  // Batch-encoded names are indistinguishable from individually encoded ones.
+  EXPECT_EQ(makeStat("cluster.upstream_rq"), stat_names[0]);
+  EXPECT_EQ(makeStat("cluster.upstream_cx"), stat_names[1]);
+  EXPECT_TRUE(stat_names[2].empty());
+  EXPECT_EQ(makeStat("trailing.dot"), stat_names[3]);
+  EXPECT_EQ("cluster.upstream_rq", table_.toString(stat_names[0]));
+}
+
 TEST_F(StatNameTest, TestDynamic100k) {
   // Tests a variety different sizes of dynamic stat ranging to 500k, covering
   // potential corner cases of spilling over into multi-byte lengths.
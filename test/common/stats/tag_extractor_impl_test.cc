@@ -138,8 +138,8 @@ public:
     // for this test, however.
     std::list<const TagExtractor*> extractors; // Note push-front is used to reverse order.
     tag_extractors_.forEachExtractorMatching(metric_name,
-                                             [&extractors](const TagExtractorPtr& tag_extractor) {
-                                               extractors.push_front(tag_extractor.get());
+                                             [&extractors](const TagExtractor& tag_extractor) {
+                                               extractors.push_front(&tag_extractor);
                                              });
 
     IntervalSetImpl<size_t> remove_characters;
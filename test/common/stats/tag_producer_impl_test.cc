@@ -119,6 +119,19 @@ TEST_F(TagProducerTest, DuplicateConfigCliTagBehavior) {
   }
 }
 
+TEST_F(TagProducerTest, DuplicateTokenizedTagBehavior) {
+  // A tag specifier naming a default tokenized tag, without providing a regex,
+  // re-adds the default token pattern. The duplicate match found by the
+  // token-trie must be elided, leaving a single cluster tag.
+  auto& specifier = *stats_config_.mutable_stats_tags()->Add();
+  specifier.set_tag_name(tag_name_values_.CLUSTER_NAME);
+  TagProducerImpl producer{stats_config_};
+  TagVector tags;
+  EXPECT_EQ("cluster.upstream_rq_total",
+            producer.produceTags("cluster.xds-grpc.upstream_rq_total", tags));
+  checkTags(TagVector{{tag_name_values_.CLUSTER_NAME, "xds-grpc"}}, tags);
+}
+
 TEST_F(TagProducerTest, Fixed) {
   const TagVector tag_config{{"my-tag", "fixed"}};
   TagProducerImpl producer{stats_config_, tag_config};
@@ -32,6 +32,7 @@
 #include "gtest/gtest.h"
 
 using testing::_;
+using testing::ElementsAre;
 using testing::HasSubstr;
 using testing::InSequence;
 using testing::NiceMock;
@@ -1479,6 +1480,42 @@ TEST_F(HistogramTest, BasicSingleHistogramMerge) {
   EXPECT_EQ(1, validateMerge());
 }
 
+TEST_F(HistogramTest, FixedLayoutBackendMerge) {
+  envoy::config::metrics::v3::StatsConfig config;
+  config.set_use_fixed_layout_histograms(true);
+  store_->setHistogramSettings(std::make_unique<HistogramSettingsImpl>(config));
+
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+  EXPECT_CALL(sink_, onHistogramComplete(Ref(h1), _)).Times(testing::AnyNumber());
+  for (uint64_t value = 1; value <= 100; ++value) {
+    h1.recordValue(value);
+  }
+  store_->mergeHistograms([]() -> void {});
+
+  std::vector<ParentHistogramSharedPtr> histogram_list = store_->histograms();
+  ASSERT_EQ(1, histogram_list.size());
+  const ParentHistogramSharedPtr& parent = histogram_list[0];
+  EXPECT_EQ(100, parent->intervalStatistics().sampleCount());
+  EXPECT_EQ(5050, parent->intervalStatistics().sampleSum());
+
+  // Quantiles from the fixed layout are within one sub-bucket of the exact
+  // values; the median of 1..100 falls in a bucket of width at most
+  // 100 / SubBucketCount.
+  const std::vector<double>& quantiles = parent->intervalStatistics().supportedQuantiles();
+  const std::vector<double>& computed = parent->intervalStatistics().computedQuantiles();
+  for (size_t i = 0; i < quantiles.size(); ++i) {
+    const double exact = 1 + quantiles[i] * 99;
+    EXPECT_NEAR(exact, computed[i], exact / FixedLayoutHistogram::SubBucketCount + 1.0)
+        << " quantile=" << quantiles[i];
+  }
+
+  // A second merge with no new values accumulates nothing further.
+  store_->mergeHistograms([]() -> void {});
+  EXPECT_EQ(0, parent->intervalStatistics().sampleCount());
+  EXPECT_EQ(100, parent->cumulativeStatistics().sampleCount());
+  EXPECT_EQ(5050, parent->cumulativeStatistics().sampleSum());
+}
+
 TEST_F(HistogramTest, BasicMultiHistogramMerge) {
   Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
   Histogram& h2 = scope_.histogramFromString("h2", Histogram::Unit::Unspecified);
@@ -1521,6 +1558,28 @@ TEST_F(HistogramTest, MultiHistogramMultipleMerges) {
   EXPECT_EQ(2, validateMerge());
 }
 
+TEST_F(HistogramTest, RepeatedMergesWithoutNewValues) {
+  Histogram& h1 = scope_.histogramFromString("h1", Histogram::Unit::Unspecified);
+
+  expectCallAndAccumulate(h1, 100);
+  EXPECT_EQ(1, validateMerge());
+
+  // Merges with no recorded values short-circuit via the dirty-tracking in the
+  // TLS histograms; validate that the skipped work is not observable: the first
+  // idle merge empties the interval statistics, and subsequent ones leave both
+  // the interval and cumulative statistics unchanged.
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(1, validateMerge());
+  }
+
+  // Recording again after idle flushes merges normally.
+  expectCallAndAccumulate(h1, 200);
+  EXPECT_EQ(1, validateMerge());
+
+  NameHistogramMap name_histogram_map = makeHistogramMap(store_->histograms());
+  EXPECT_TRUE(name_histogram_map["h1"]->used());
+}
+
 TEST_F(HistogramTest, BasicScopeHistogramMerge) {
   ScopeSharedPtr scope1 = store_->createScope("scope1.");
 
@@ -1683,6 +1742,32 @@ TEST_F(HistogramTest, ForEachHistogram) {
   EXPECT_EQ(deleted_histogram.unit(), Histogram::Unit::Unspecified);
 }
 
+TEST_F(HistogramTest, ForEachHistogramFamily) {
+  scope_.histogramFromString("h.beta", Histogram::Unit::Unspecified);
+  scope_.histogramFromString("h.alpha", Histogram::Unit::Unspecified);
+
+  // Families arrive in name order regardless of creation order.
+  std::vector<std::string> families;
+  store_->forEachHistogramFamily(
+      [this, &families](StatName name, const std::vector<ParentHistogramSharedPtr>& stats) -> bool {
+        EXPECT_EQ(stats.size(), 1);
+        families.push_back(symbol_table_.toString(name));
+        return true;
+      });
+  EXPECT_THAT(families, ElementsAre("h.alpha", "h.beta"));
+
+  // Rejecting the histograms removes them from the family index.
+  envoy::config::metrics::v3::StatsConfig stats_config_;
+  stats_config_.mutable_stats_matcher()->set_reject_all(true);
+  store_->setStatsMatcher(std::make_unique<StatsMatcherImpl>(stats_config_, symbol_table_));
+  size_t num_families = 0;
+  store_->forEachHistogramFamily([&num_families](StatName, const auto&) -> bool {
+    ++num_families;
+    return true;
+  });
+  EXPECT_EQ(num_families, 0);
+}
+
 class OneWorkerThread : public ThreadLocalRealThreadsMixin, public testing::Test {
 protected:
   static constexpr uint32_t NumThreads = 1;
@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "source/common/common/assert.h"
+#include "source/common/network/io_socket_handle_impl.h"
+#include "source/common/tcp_proxy/splice_relay.h"
+
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+#if defined(__linux__)
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace Envoy {
+namespace TcpProxy {
+namespace {
+
+#if defined(__linux__)
+
+// Drives a SpliceRelay over real loopback TCP connections: the "proxy" side of each connection
+// is handed to the relay while the test reads and writes the external ends, mirroring how the
+// tcp_proxy filter engages the relay between its downstream and upstream sockets.
+class SpliceRelayTest : public testing::Test {
+protected:
+  SpliceRelayTest()
+      : api_(Api::createApiForTest()), dispatcher_(api_->allocateDispatcher("test_thread")) {}
+
+  ~SpliceRelayTest() override {
+    relay_.reset();
+    for (int fd : {ext_downstream_, ext_upstream_}) {
+      if (fd != -1) {
+        ::close(fd);
+      }
+    }
+  }
+
+  // Returns {external, proxy} ends of an established loopback TCP connection.
+  static std::pair<int, int> tcpConnectionPair() {
+    const int listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    RELEASE_ASSERT(listener != -1, "");
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    RELEASE_ASSERT(::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0, "");
+    RELEASE_ASSERT(::listen(listener, 1) == 0, "");
+    socklen_t addr_len = sizeof(addr);
+    RELEASE_ASSERT(::getsockname(listener, reinterpret_cast<sockaddr*>(&addr), &addr_len) == 0, "");
+
+    const int external = ::socket(AF_INET, SOCK_STREAM, 0);
+    RELEASE_ASSERT(external != -1, "");
+    RELEASE_ASSERT(::connect(external, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0, "");
+    const int proxy = ::accept(listener, nullptr, nullptr);
+    RELEASE_ASSERT(proxy != -1, "");
+    ::close(listener);
+
+    for (int fd : {external, proxy}) {
+      RELEASE_ASSERT(::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK) == 0, "");
+    }
+    return {external, proxy};
+  }
+
+  void createRelay() {
+    std::tie(ext_downstream_, proxy_downstream_fd_) = tcpConnectionPair();
+    std::tie(ext_upstream_, proxy_upstream_fd_) = tcpConnectionPair();
+    proxy_downstream_ = std::make_unique<Network::IoSocketHandleImpl>(proxy_downstream_fd_);
+    proxy_upstream_ = std::make_unique<Network::IoSocketHandleImpl>(proxy_upstream_fd_);
+    relay_ = SpliceRelay::create(*dispatcher_, *proxy_downstream_, *proxy_upstream_,
+                                 [this]() { disengaged_ = true; });
+    RELEASE_ASSERT(relay_ != nullptr, "");
+  }
+
+  // Runs the event loop while draining the given external fd, until `expected` bytes arrived or
+  // the deadline passes. Appends what was read to `out`.
+  bool pumpUntilReceived(int fd, size_t expected, std::string& out) {
+    const MonotonicTime deadline = api_->timeSource().monotonicTime() + std::chrono::seconds(15);
+    char buf[16384];
+    while (out.size() < expected) {
+      dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+      const ssize_t rc = ::read(fd, buf, sizeof(buf));
+      if (rc > 0) {
+        out.append(buf, rc);
+      }
+      if (api_->timeSource().monotonicTime() > deadline) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Writes the whole payload to the external fd, running the event loop whenever the socket
+  // pushes back so the relay can move bytes along.
+  void writeAll(int fd, absl::string_view payload) {
+    size_t written = 0;
+    while (written < payload.size()) {
+      const ssize_t rc = ::write(fd, payload.data() + written, payload.size() - written);
+      if (rc > 0) {
+        written += rc;
+      } else {
+        RELEASE_ASSERT(errno == EAGAIN, "");
+        dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+      }
+    }
+  }
+
+  static std::string makePayload(size_t size) {
+    std::string payload(size, '\0');
+    for (size_t i = 0; i < size; i++) {
+      payload[i] = static_cast<char>('a' + (i % 26));
+    }
+    return payload;
+  }
+
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  int ext_downstream_{-1};
+  int ext_upstream_{-1};
+  os_fd_t proxy_downstream_fd_{INVALID_SOCKET};
+  os_fd_t proxy_upstream_fd_{INVALID_SOCKET};
+  Network::IoHandlePtr proxy_downstream_;
+  Network::IoHandlePtr proxy_upstream_;
+  SpliceRelayPtr relay_;
+  bool disengaged_{false};
+};
+
+TEST_F(SpliceRelayTest, RelaysDataBothDirections) {
+  createRelay();
+
+  writeAll(ext_downstream_, "hello upstream");
+  std::string received;
+  EXPECT_TRUE(pumpUntilReceived(ext_upstream_, 14, received));
+  EXPECT_EQ("hello upstream", received);
+  EXPECT_EQ(14, relay_->bytesToUpstream());
+
+  writeAll(ext_upstream_, "hello downstream");
+  received.clear();
+  EXPECT_TRUE(pumpUntilReceived(ext_downstream_, 16, received));
+  EXPECT_EQ("hello downstream", received);
+  EXPECT_EQ(16, relay_->bytesToDownstream());
+  EXPECT_FALSE(disengaged_);
+}
+
+// A payload much larger than the socket buffers forces partial splices and EAGAIN on the sink;
+// the relay must re-arm on writability and deliver every byte in order.
+TEST_F(SpliceRelayTest, PartialSplicesUnderBackpressure) {
+  createRelay();
+  const std::string payload = makePayload(4 * 1024 * 1024);
+
+  writeAll(ext_downstream_, payload);
+  std::string received;
+  ASSERT_TRUE(pumpUntilReceived(ext_upstream_, payload.size(), received));
+  EXPECT_EQ(payload, received);
+  EXPECT_EQ(payload.size(), relay_->bytesToUpstream());
+  EXPECT_FALSE(disengaged_);
+}
+
+// Half-closing the source while the sink is not being drained parks bytes in the pipe; the
+// relay must keep draining them after seeing EOF and only disengage once the pipe is empty, so
+// no bytes are lost on the way back to the buffered path.
+TEST_F(SpliceRelayTest, EofDrainsPipeBeforeDisengaging) {
+  createRelay();
+  const std::string payload = makePayload(16 * 1024 * 1024);
+
+  // Fill the downstream send buffer, the relay pipe, and the upstream buffers without draining
+  // the external upstream end, so that bytes are parked in the pipe when the EOF arrives.
+  size_t written = 0;
+  int idle_rounds = 0;
+  while (idle_rounds < 10 && written < payload.size()) {
+    const ssize_t rc = ::write(ext_downstream_, payload.data() + written,
+                               std::min<size_t>(65536, payload.size() - written));
+    if (rc > 0) {
+      written += rc;
+      idle_rounds = 0;
+    } else {
+      ++idle_rounds;
+    }
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+  ASSERT_LT(written, payload.size());
+  ASSERT_EQ(0, ::shutdown(ext_downstream_, SHUT_WR));
+
+  std::string received;
+  ASSERT_TRUE(pumpUntilReceived(ext_upstream_, written, received));
+  EXPECT_EQ(payload.substr(0, written), received);
+  EXPECT_EQ(written, relay_->bytesToUpstream());
+
+  // Let the relay observe the EOF with the pipe now empty.
+  const MonotonicTime deadline = api_->timeSource().monotonicTime() + std::chrono::seconds(15);
+  while (!disengaged_ && api_->timeSource().monotonicTime() < deadline) {
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+  EXPECT_TRUE(disengaged_);
+}
+
+// A half-close from the upstream peer with no data in flight must disengage promptly so the
+// buffered path can run the usual half-close handling.
+TEST_F(SpliceRelayTest, PeerHalfCloseDisengages) {
+  createRelay();
+
+  ASSERT_EQ(0, ::shutdown(ext_upstream_, SHUT_WR));
+  const MonotonicTime deadline = api_->timeSource().monotonicTime() + std::chrono::seconds(15);
+  while (!disengaged_ && api_->timeSource().monotonicTime() < deadline) {
+    dispatcher_->run(Event::Dispatcher::RunType::NonBlock);
+  }
+  EXPECT_TRUE(disengaged_);
+  EXPECT_EQ(0, relay_->bytesToDownstream());
+}
+
+#else
+
+TEST(SpliceRelayTest, UnsupportedPlatformReturnsNull) {
+  Api::ApiPtr api = Api::createApiForTest();
+  Event::DispatcherPtr dispatcher = api->allocateDispatcher("test_thread");
+  Network::IoSocketHandleImpl downstream;
+  Network::IoSocketHandleImpl upstream;
+  EXPECT_EQ(nullptr, SpliceRelay::create(*dispatcher, downstream, upstream, []() {}));
+}
+
+#endif // defined(__linux__)
+
+} // namespace
+} // namespace TcpProxy
+} // namespace Envoy
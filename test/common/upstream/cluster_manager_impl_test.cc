@@ -17,6 +17,7 @@
 #include "test/mocks/matcher/mocks.h"
 #include "test/mocks/protobuf/mocks.h"
 #include "test/mocks/server/instance.h"
+#include "test/mocks/stats/mocks.h"
 #include "test/mocks/upstream/cds_api.h"
 #include "test/mocks/upstream/cluster_priority_set.h"
 #include "test/mocks/upstream/cluster_real_priority_set.h"
@@ -4391,8 +4392,11 @@ public:
   MOCK_METHOD(void, onClusterInit, (ClusterManagerCluster & cluster));
 
   NiceMock<MockClusterManager> cm_;
+  Event::SimulatedTimeSystem time_system_;
+  NiceMock<Stats::MockHistogram> warming_histogram_;
   ClusterManagerInitHelper init_helper_{
-      cm_, [this](ClusterManagerCluster& cluster) { onClusterInit(cluster); }};
+      cm_, time_system_, warming_histogram_,
+      [this](ClusterManagerCluster& cluster) { onClusterInit(cluster); }};
 };
 
 class MockClusterManagerCluster : public ClusterManagerCluster {
@@ -5378,6 +5382,90 @@ TEST_F(TcpKeepaliveTest, TcpKeepaliveWithAllOptions) {
   expectSetsockoptSoKeepalive(7, 4, 1);
 }
 
+class TcpFastOpenTest : public ClusterManagerImplTest {
+public:
+  void initialize(const std::string& yaml) { create(parseBootstrapFromV3Yaml(yaml)); }
+
+  void TearDown() override { factory_.tls_.shutdownThread(); }
+
+  void expectSetsockoptTcpFastOpenConnect() {
+    if (!ENVOY_SOCKET_TCP_FASTOPEN_CONNECT.hasValue()) {
+      EXPECT_CALL(factory_.tls_.dispatcher_, createClientConnection_(_, _, _, _))
+          .WillOnce(
+              Invoke([this](Network::Address::InstanceConstSharedPtr,
+                            Network::Address::InstanceConstSharedPtr, Network::TransportSocketPtr&,
+                            const Network::ConnectionSocket::OptionsSharedPtr& options)
+                         -> Network::ClientConnection* {
+                EXPECT_NE(nullptr, options.get());
+                NiceMock<Network::MockConnectionSocket> socket;
+                EXPECT_FALSE((Network::Socket::applyOptions(
+                    options, socket, envoy::config::core::v3::SocketOption::STATE_PREBIND)));
+                return connection_;
+              }));
+      cluster_manager_->getThreadLocalCluster("TcpFastOpenCluster")->tcpConn(nullptr);
+      return;
+    }
+    NiceMock<Api::MockOsSysCalls> os_sys_calls;
+    TestThreadsafeSingletonInjector<Api::OsSysCallsImpl> os_calls(&os_sys_calls);
+    NiceMock<Network::MockConnectionSocket> socket;
+    EXPECT_CALL(factory_.tls_.dispatcher_, createClientConnection_(_, _, _, _))
+        .WillOnce(Invoke([this, &socket](Network::Address::InstanceConstSharedPtr,
+                                         Network::Address::InstanceConstSharedPtr,
+                                         Network::TransportSocketPtr&,
+                                         const Network::ConnectionSocket::OptionsSharedPtr& options)
+                             -> Network::ClientConnection* {
+          EXPECT_NE(nullptr, options.get());
+          EXPECT_TRUE((Network::Socket::applyOptions(
+              options, socket, envoy::config::core::v3::SocketOption::STATE_PREBIND)));
+          return connection_;
+        }));
+    if (ENVOY_SOCKET_SO_NOSIGPIPE.hasValue()) {
+      EXPECT_CALL(socket, setSocketOption(ENVOY_SOCKET_SO_NOSIGPIPE.level(),
+                                          ENVOY_SOCKET_SO_NOSIGPIPE.option(), _, sizeof(int)))
+          .WillOnce(Invoke([](int, int, const void* optval, socklen_t) -> Api::SysCallIntResult {
+            EXPECT_EQ(1, *static_cast<const int*>(optval));
+            return {0, 0};
+          }));
+    }
+    EXPECT_CALL(socket,
+                setSocketOption(ENVOY_SOCKET_TCP_FASTOPEN_CONNECT.level(),
+                                ENVOY_SOCKET_TCP_FASTOPEN_CONNECT.option(), _, sizeof(int)))
+        .WillOnce(Invoke([](int, int, const void* optval, socklen_t) -> Api::SysCallIntResult {
+          EXPECT_EQ(1, *static_cast<const int*>(optval));
+          return {0, 0};
+        }));
+    auto conn_data =
+        cluster_manager_->getThreadLocalCluster("TcpFastOpenCluster")->tcpConn(nullptr);
+    EXPECT_EQ(connection_, conn_data.connection_.get());
+  }
+
+  Network::MockClientConnection* connection_ = new NiceMock<Network::MockClientConnection>();
+};
+
+TEST_F(TcpFastOpenTest, TcpFastOpenCluster) {
+  const std::string yaml = R"EOF(
+  static_resources:
+    clusters:
+    - name: TcpFastOpenCluster
+      connect_timeout: 0.250s
+      lb_policy: ROUND_ROBIN
+      type: STATIC
+      load_assignment:
+        cluster_name: TcpFastOpenCluster
+        endpoints:
+          - lb_endpoints:
+            - endpoint:
+                address:
+                  socket_address:
+                    address: 127.0.0.1
+                    port_value: 11001
+      upstream_connection_options:
+        tcp_fast_open: true
+  )EOF";
+  initialize(yaml);
+  expectSetsockoptTcpFastOpenConnect();
+}
+
 // Make sure the drainConnections() with a predicate can correctly exclude a host.
 TEST_F(ClusterManagerImplTest, DrainConnectionsPredicate) {
   const std::string yaml = R"EOF(
@@ -6118,6 +6206,32 @@ TEST_F(PreconnectTest, PreconnectCappedAt3) {
   EXPECT_EQ(2, http_preconnect);
 }
 
+TEST_F(PreconnectTest, PreconnectPredictive) {
+  // With preconnect on, a sustained stream arrival rate is folded into the preconnect decision
+  // and surfaced via the predictive preconnect counter.
+  initialize(1.1);
+  EXPECT_CALL(factory_, allocateConnPool_(_, _, _, _, _))
+      .Times(testing::AtLeast(2))
+      .WillRepeatedly(InvokeWithoutArgs([&]() -> Http::ConnectionPool::Instance* {
+        auto* ret = new NiceMock<Http::ConnectionPool::MockInstance>();
+        ON_CALL(*ret, maybePreconnect(_)).WillByDefault(Return(true));
+        return ret;
+      }));
+  auto http_handle = cluster_manager_->getThreadLocalCluster("cluster_1")
+                         ->httpConnPool(ResourcePriority::Default, Http::Protocol::Http11, nullptr);
+  http_handle.value().newStream(decoder_, http_callbacks_, {false, true});
+  // The first stream has no arrival history, so nothing is predicted.
+  EXPECT_EQ(0, cluster_->info()->trafficStats()->upstream_cx_preconnect_predictive_.value());
+
+  // A rapid second stream establishes a high arrival rate; preconnects triggered on its behalf
+  // are counted as predictive.
+  time_system_.advanceTimeWait(std::chrono::milliseconds(1));
+  http_handle = cluster_manager_->getThreadLocalCluster("cluster_1")
+                    ->httpConnPool(ResourcePriority::Default, Http::Protocol::Http11, nullptr);
+  http_handle.value().newStream(decoder_, http_callbacks_, {false, true});
+  EXPECT_LT(0, cluster_->info()->trafficStats()->upstream_cx_preconnect_predictive_.value());
+}
+
 TEST_F(PreconnectTest, PreconnectCappedByMaybePreconnect) {
   // Set preconnect high, and verify preconnecting stops when maybePreconnect returns false.
   initialize(20);
@@ -1338,8 +1338,9 @@ TEST_P(RoundRobinLoadBalancerTest, ZoneAwareRoutingSmallZone) {
   EXPECT_EQ(hostSet().healthy_hosts_per_locality_->get()[0][0], lb_->chooseHost(nullptr));
   EXPECT_EQ(1U, stats_.lb_zone_routing_sampled_.value());
 
-  // Force request out of small zone.
-  EXPECT_CALL(random_, random()).WillOnce(Return(0)).WillOnce(Return(9999)).WillOnce(Return(2));
+  // Force request out of small zone. The local share of the cumulative table is
+  // 6000 * 1334 = 8004000 and locality 1 covers [8004000, 10672000).
+  EXPECT_CALL(random_, random()).WillOnce(Return(0)).WillOnce(Return(9000000));
   EXPECT_EQ(hostSet().healthy_hosts_per_locality_->get()[1][0], lb_->chooseHost(nullptr));
   EXPECT_EQ(1U, stats_.lb_zone_routing_cross_zone_.value());
 }
@@ -1654,6 +1655,31 @@ TEST_P(RoundRobinLoadBalancerTest, SlowStartNoWait) {
   EXPECT_EQ(hostSet().healthy_hosts_[1], lb_->chooseHost(nullptr));
 }
 
+// When the weighted scheduler exists only because equally weighted hosts were in slow start,
+// unweighted round robin selection resumes as soon as the last slow start window elapses, even
+// with no intervening host set update.
+TEST_P(RoundRobinLoadBalancerTest, SlowStartUnweightedAfterWindowWithoutRefresh) {
+  round_robin_lb_config_.mutable_slow_start_config()->mutable_slow_start_window()->set_seconds(60);
+  simTime().advanceTimeWait(std::chrono::seconds(1));
+  auto host1 = makeTestHost(info_, "tcp://127.0.0.1:80", simTime());
+  auto host2 = makeTestHost(info_, "tcp://127.0.0.1:90", simTime());
+  host_set_.hosts_ = {host1, host2};
+  host_set_.healthy_hosts_ = host_set_.hosts_;
+
+  // The initial refresh sees both (equally weighted) hosts in slow start, so the weighted
+  // scheduler is built.
+  init(false);
+
+  // Advance time beyond the slow start window without any host set update. Picks fall back to
+  // the unweighted round robin path and alternate 1:1.
+  simTime().advanceTimeWait(std::chrono::seconds(61));
+
+  EXPECT_EQ(host_set_.healthy_hosts_[0], lb_->chooseHost(nullptr));
+  EXPECT_EQ(host_set_.healthy_hosts_[1], lb_->chooseHost(nullptr));
+  EXPECT_EQ(host_set_.healthy_hosts_[0], lb_->chooseHost(nullptr));
+  EXPECT_EQ(host_set_.healthy_hosts_[1], lb_->chooseHost(nullptr));
+}
+
 TEST_P(RoundRobinLoadBalancerTest, SlowStartWithActiveHC) {
   round_robin_lb_config_.mutable_slow_start_config()->mutable_slow_start_window()->set_seconds(10);
   simTime().advanceTimeWait(std::chrono::seconds(1));
@@ -2123,6 +2123,42 @@ TEST_F(OutlierDetectorImplTest, MaxEjectTimeNotAlligned) {
 }
 
 // Test verifies that the detector is properly initialized with
+// Test verifies that responses slower than slow_request_threshold are recorded
+// as failures and lead to a consecutive 5xx ejection, while response times are
+// ignored when the threshold is not configured.
+TEST_F(OutlierDetectorImplTest, SlowRequestThreshold) {
+  const std::string yaml = R"EOF(
+slow_request_threshold: 1s
+  )EOF";
+  envoy::config::cluster::v3::OutlierDetection outlier_detection;
+  TestUtility::loadFromYaml(yaml, outlier_detection);
+  EXPECT_CALL(cluster_.prioritySet(), addMemberUpdateCb(_));
+  addHosts({"tcp://127.0.0.1:80"});
+  EXPECT_CALL(*interval_timer_, enableTimer(std::chrono::milliseconds(10000), _));
+  std::shared_ptr<DetectorImpl> detector(DetectorImpl::create(
+      cluster_, outlier_detection, dispatcher_, runtime_, time_system_, event_logger_, random_));
+  detector->addChangedStateCb([&](HostSharedPtr host) -> void { checker_.check(host); });
+
+  EXPECT_EQ(1000UL, detector->config().slowRequestThresholdMs());
+
+  // Sub-threshold response times are not recorded as failures.
+  loadRq(hosts_[0], 1, 200);
+  hosts_[0]->outlierDetector().putResponseTime(std::chrono::milliseconds(999));
+  EXPECT_FALSE(hosts_[0]->healthFlagGet(Host::HealthFlag::FAILED_OUTLIER_CHECK));
+
+  // Five consecutive over-threshold responses trigger a consecutive 5xx ejection even
+  // though no error code was ever reported.
+  time_system_.setMonotonicTime(std::chrono::milliseconds(0));
+  EXPECT_CALL(checker_, check(hosts_[0]));
+  EXPECT_CALL(*event_logger_, logEject(std::static_pointer_cast<const HostDescription>(hosts_[0]),
+                                       _, envoy::data::cluster::v3::CONSECUTIVE_5XX, true));
+  for (int i = 0; i < 5; i++) {
+    hosts_[0]->outlierDetector().putResponseTime(std::chrono::milliseconds(1000));
+  }
+  EXPECT_TRUE(hosts_[0]->healthFlagGet(Host::HealthFlag::FAILED_OUTLIER_CHECK));
+  EXPECT_EQ(1UL, outlier_detection_ejections_active_.value());
+}
+
 // max_ejection_time_jitter when it is specified in the
 // the static config
 TEST_F(OutlierDetectorImplTest, DetectorStaticConfigMaxEjectionTimeJitter) {
@@ -2447,6 +2447,44 @@ TEST_F(StaticClusterImplTest, LoadBalancingPolicyWithoutConfiguration) {
 }
 
 // load_balancing_policy is set and common_lb_config is set.
+// Clusters with identical CommonLbConfig messages share one interned copy; differing configs
+// do not.
+TEST_F(StaticClusterImplTest, SharedCommonLbConfig) {
+  const std::string yaml = R"EOF(
+    name: staticcluster
+    connect_timeout: 0.25s
+    type: static
+    lb_policy: round_robin
+    common_lb_config:
+      update_merge_window: 1s
+    load_assignment:
+      endpoints:
+        - lb_endpoints:
+          - endpoint:
+              address:
+                socket_address:
+                  address: 10.0.0.1
+                  port_value: 11001
+  )EOF";
+
+  envoy::config::cluster::v3::Cluster cluster_config1 = parseClusterFromV3Yaml(yaml);
+  envoy::config::cluster::v3::Cluster cluster_config2 = parseClusterFromV3Yaml(yaml);
+  cluster_config2.set_name("staticcluster2");
+  envoy::config::cluster::v3::Cluster cluster_config3 = parseClusterFromV3Yaml(yaml);
+  cluster_config3.set_name("staticcluster3");
+  cluster_config3.mutable_common_lb_config()->mutable_update_merge_window()->set_seconds(2);
+
+  Envoy::Upstream::ClusterFactoryContextImpl factory_context(
+      server_context_, server_context_.cluster_manager_, stats_, nullptr, ssl_context_manager_,
+      nullptr, true, validation_visitor_);
+  StaticClusterImpl cluster1(server_context_, cluster_config1, factory_context, runtime_, true);
+  StaticClusterImpl cluster2(server_context_, cluster_config2, factory_context, runtime_, true);
+  StaticClusterImpl cluster3(server_context_, cluster_config3, factory_context, runtime_, true);
+
+  EXPECT_EQ(&cluster1.info()->lbConfig(), &cluster2.info()->lbConfig());
+  EXPECT_NE(&cluster1.info()->lbConfig(), &cluster3.info()->lbConfig());
+}
+
 TEST_F(StaticClusterImplTest, LoadBalancingPolicyWithCommonLbConfig) {
   TestScopedRuntime scoped_runtime;
   scoped_runtime.mergeValues({{"envoy.reloadable_features.no_extension_lookup_by_name", "false"}});
@@ -3507,6 +3545,66 @@ public:
   }
 };
 
+// With deferred traffic stats enabled, the stats block is only allocated once trafficStats() is
+// first used.
+TEST_F(ClusterInfoImplTest, DeferredTrafficStats) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.deferred_cluster_traffic_stats", "true"}});
+
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+    load_assignment:
+        endpoints:
+          - lb_endpoints:
+            - endpoint:
+                address:
+                  socket_address:
+                    address: foo.bar.com
+                    port_value: 443
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  EXPECT_FALSE(stats_.findCounterByString("cluster.name.upstream_cx_total"));
+  cluster->info()->trafficStats()->upstream_cx_total_.inc();
+  auto counter = stats_.findCounterByString("cluster.name.upstream_cx_total");
+  ASSERT_TRUE(counter.has_value());
+  EXPECT_EQ(1, counter.value().get().value());
+}
+
+// The non-traffic stat blocks (LB, config update, endpoint) follow the same deferred-creation
+// policy under the runtime guard.
+TEST_F(ClusterInfoImplTest, DeferredLbStats) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.deferred_cluster_traffic_stats", "true"}});
+
+  const std::string yaml = R"EOF(
+    name: name
+    connect_timeout: 0.25s
+    type: STRICT_DNS
+    lb_policy: ROUND_ROBIN
+    load_assignment:
+        endpoints:
+          - lb_endpoints:
+            - endpoint:
+                address:
+                  socket_address:
+                    address: foo.bar.com
+                    port_value: 443
+  )EOF";
+
+  auto cluster = makeCluster(yaml);
+  EXPECT_FALSE(stats_.findCounterByString("cluster.name.lb_healthy_panic"));
+  cluster->info()->lbStats().lb_healthy_panic_.inc();
+  auto counter = stats_.findCounterByString("cluster.name.lb_healthy_panic");
+  ASSERT_TRUE(counter.has_value());
+  EXPECT_EQ(1, counter.value().get().value());
+}
+
 // Cluster metadata and common config retrieval.
 TEST_F(ClusterInfoImplTest, Metadata) {
   const std::string yaml = R"EOF(
@@ -60,6 +60,9 @@ public:
 
   int numClears() const { return num_clears_; }
 
+  // Make subsequently logged entries (not) critical for shedding purposes.
+  void setCritical(bool critical) { critical_ = critical; }
+
 private:
   void mockAddEntry(const std::string& key) {
     if (!message_.fields().contains(key)) {
@@ -95,8 +98,11 @@ private:
     num_clears_++;
   }
 
+  bool isCriticalEntry(const ProtobufWkt::Struct&) override { return critical_; }
+
   int num_inits_ = 0;
   int num_clears_ = 0;
+  bool critical_ = false;
 };
 
 class StreamingGrpcAccessLogTest : public testing::Test {
@@ -176,8 +182,8 @@ TEST_F(StreamingGrpcAccessLogTest, BasicFlow) {
   expectFlushedLogEntriesCount(stream, MOCK_TCP_LOG_FIELD_NAME, 1);
   logger_->log(ProtobufWkt::Empty());
   EXPECT_EQ(2, logger_->numClears());
-  // TCP logging doesn't change the logs_written counter.
-  EXPECT_EQ(1,
+  // TCP logging is counted in logs_written just like HTTP logging.
+  EXPECT_EQ(2,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
 
   // Verify that sending an empty response message doesn't do anything bad.
@@ -195,7 +201,7 @@ TEST_F(StreamingGrpcAccessLogTest, BasicFlow) {
   EXPECT_EQ(3, logger_->numClears());
   EXPECT_EQ(0,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
-  EXPECT_EQ(2,
+  EXPECT_EQ(3,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
 }
 
@@ -246,6 +252,52 @@ TEST_F(StreamingGrpcAccessLogTest, WatermarksOverrun) {
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
 }
 
+TEST_F(StreamingGrpcAccessLogTest, CriticalLogEntriesGetShedLast) {
+  const uint64_t entry_size = mockHttpEntry().ByteSizeLong();
+  // Make the buffer fit a single entry so the second entry triggers a flush.
+  initLogger(FlushInterval, entry_size + 1);
+
+  MockAccessLogStream stream;
+  AccessLogCallbacks* callbacks;
+  expectStreamStart(stream, &callbacks);
+  // Keep the stream above its watermark for the whole test so nothing ever flushes.
+  EXPECT_CALL(stream, isAboveWriteBufferHighWatermark()).WillRepeatedly(Return(true));
+  EXPECT_CALL(stream, sendMessageRaw_(_, _)).Times(0);
+
+  // Two entries fill the buffer; the flush attempt fails so they stay buffered.
+  logger_->log(mockHttpEntry());
+  logger_->log(mockHttpEntry());
+  EXPECT_EQ(1, logger_->numInits());
+  EXPECT_EQ(2,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+
+  // A non-critical entry is shed as soon as the buffer is full.
+  logger_->log(mockHttpEntry());
+  EXPECT_EQ(1,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
+  EXPECT_EQ(
+      0,
+      TestUtility::findCounter(stats_store_, "mock_access_log_prefix.critical_logs_dropped")
+          ->value());
+
+  // A critical entry is still admitted via the extra buffer headroom.
+  logger_->setCritical(true);
+  logger_->log(mockHttpEntry());
+  EXPECT_EQ(3,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
+
+  // Once the headroom is exhausted even critical entries are dropped and counted.
+  logger_->log(mockHttpEntry());
+  EXPECT_EQ(2,
+            TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_dropped")->value());
+  EXPECT_EQ(
+      1,
+      TestUtility::findCounter(stats_store_, "mock_access_log_prefix.critical_logs_dropped")
+          ->value());
+  // Nothing was ever flushed.
+  EXPECT_EQ(0, logger_->numClears());
+}
+
 // Test that stream failure is handled correctly.
 TEST_F(StreamingGrpcAccessLogTest, StreamFailure) {
   initLogger(FlushInterval, 0);
@@ -399,8 +451,8 @@ TEST_F(UnaryGrpcAccessLogTest, BasicFlow) {
   // Message should be initialized and cleared every time a request is sent.
   EXPECT_EQ(2, logger_->numInits());
   EXPECT_EQ(2, logger_->numClears());
-  // TCP logging doesn't change the logs_written counter.
-  EXPECT_EQ(1,
+  // TCP logging is counted in logs_written just like HTTP logging.
+  EXPECT_EQ(2,
             TestUtility::findCounter(stats_store_, "mock_access_log_prefix.logs_written")->value());
   // No dropped logs expected.
   EXPECT_EQ(0,
@@ -652,6 +652,28 @@ TEST_F(EdsTest, Hostname) {
   EXPECT_EQ(hosts[0]->hostname(), "foo");
 }
 
+// Validate that onConfigUpdate() propagates additional addresses to the host's address list so
+// connections can race the addresses happy-eyeballs style.
+TEST_F(EdsTest, AdditionalAddresses) {
+  envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
+  auto* endpoint = cluster_load_assignment.add_endpoints()->add_lb_endpoints()->mutable_endpoint();
+  auto* socket_address = endpoint->mutable_address()->mutable_socket_address();
+  socket_address->set_address("1.2.3.4");
+  socket_address->set_port_value(1234);
+  auto* additional_socket_address =
+      endpoint->add_additional_addresses()->mutable_address()->mutable_socket_address();
+  additional_socket_address->set_address("::1");
+  additional_socket_address->set_port_value(1234);
+  cluster_load_assignment.set_cluster_name("fare");
+  initialize();
+  doOnConfigUpdateVerifyNoThrow(cluster_load_assignment);
+  auto& hosts = cluster_->prioritySet().hostSetsPerPriority()[0]->hosts();
+  EXPECT_EQ(hosts.size(), 1);
+  ASSERT_EQ(hosts[0]->addressList().size(), 2);
+  EXPECT_EQ(hosts[0]->addressList()[0]->asString(), "1.2.3.4:1234");
+  EXPECT_EQ(hosts[0]->addressList()[1]->asString(), "[::1]:1234");
+}
+
 TEST_F(EdsTest, UseHostnameForHealthChecks) {
   envoy::config::endpoint::v3::ClusterLoadAssignment cluster_load_assignment;
   auto* endpoint = cluster_load_assignment.add_endpoints()->add_lb_endpoints()->mutable_endpoint();
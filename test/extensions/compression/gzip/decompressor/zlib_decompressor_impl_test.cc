@@ -195,6 +195,44 @@ TEST_F(ZlibDecompressorImplTest, CompressAndDecompress) {
   ASSERT_EQ(0, decompressor.decompression_error_);
 }
 
+// Exercises the per-thread inflate context cache: consecutive decompressors on the same thread
+// recycle the previous one's inflate state, including across different window bits.
+TEST_F(ZlibDecompressorImplTest, RecycledContextsDecompressCorrectly) {
+  for (const int64_t window_bits : {gzip_window_bits, gzip_window_bits, int64_t(15), int64_t(12)}) {
+    Buffer::OwnedImpl buffer;
+    Buffer::OwnedImpl accumulation_buffer;
+
+    Extensions::Compression::Gzip::Compressor::ZlibCompressorImpl compressor;
+    compressor.init(
+        Extensions::Compression::Gzip::Compressor::ZlibCompressorImpl::CompressionLevel::Standard,
+        Extensions::Compression::Gzip::Compressor::ZlibCompressorImpl::CompressionStrategy::
+            Standard,
+        window_bits, memory_level);
+
+    std::string original_text{};
+    for (uint64_t i = 0; i < 5; ++i) {
+      TestUtility::feedBufferWithRandomCharacters(buffer, default_input_size * i, i);
+      original_text.append(buffer.toString());
+      compressor.compress(buffer, Envoy::Compression::Compressor::State::Flush);
+      accumulation_buffer.add(buffer);
+      drainBuffer(buffer);
+    }
+    compressor.compress(buffer, Envoy::Compression::Compressor::State::Finish);
+    accumulation_buffer.add(buffer);
+    drainBuffer(buffer);
+
+    // Destroyed at the end of each iteration, so the next iteration's decompressor picks its
+    // stream out of the thread's cache.
+    ZlibDecompressorImpl decompressor{stats_scope_, "test.", 4096, 100};
+    decompressor.init(window_bits);
+
+    decompressor.decompress(accumulation_buffer, buffer);
+    EXPECT_EQ(original_text, buffer.toString());
+    ASSERT_EQ(compressor.checksum(), decompressor.checksum());
+    ASSERT_EQ(0, decompressor.decompression_error_);
+  }
+}
+
 // Tests decompression_error_ set to True when Decompression Fails
 TEST_F(ZlibDecompressorImplTest, FailedDecompression) {
   Buffer::OwnedImpl buffer;
@@ -0,0 +1,143 @@
+#include <memory>
+#include <string>
+
+#include "envoy/config/endpoint/v3/endpoint.pb.h"
+#include "envoy/extensions/config/v3/kv_store_xds_delegate_config.pb.h"
+#include "envoy/service/discovery/v3/discovery.pb.h"
+
+#include "source/common/config/decoded_resource_impl.h"
+#include "source/common/config/xds_source_id.h"
+#include "source/extensions/config/kv_store_xds_delegate.h"
+#include "source/extensions/key_value/file_based/config.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/test_common/environment.h"
+#include "test/test_common/resources.h"
+#include "test/test_common/utility.h"
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+using testing::NiceMock;
+
+namespace Envoy {
+namespace Extensions {
+namespace Config {
+namespace {
+
+envoy::config::endpoint::v3::ClusterLoadAssignment loadAssignment(const std::string& cluster) {
+  envoy::config::endpoint::v3::ClusterLoadAssignment load_assignment;
+  load_assignment.set_cluster_name(cluster);
+  return load_assignment;
+}
+
+Envoy::Config::DecodedResourceImplPtr
+decodedResource(const std::string& name, const std::string& version,
+                const envoy::config::endpoint::v3::ClusterLoadAssignment& load_assignment) {
+  return std::make_unique<Envoy::Config::DecodedResourceImpl>(
+      std::make_unique<envoy::config::endpoint::v3::ClusterLoadAssignment>(load_assignment), name,
+      std::vector<std::string>{}, version);
+}
+
+class KeyValueStoreXdsDelegateTest : public testing::Test {
+protected:
+  KeyValueStoreXdsDelegateTest()
+      : filename_(TestEnvironment::temporaryPath("xds_kv_store")),
+        source_id_("xds_authority", Envoy::Config::TypeUrl::get().ClusterLoadAssignment) {
+    TestEnvironment::removePath(filename_);
+    createDelegate();
+  }
+
+  void createDelegate() {
+    // Note that timer assignment (to ttl vs flush) is determined by their ordering here.
+    ttl_timer_ = new NiceMock<Event::MockTimer>(&dispatcher_);
+    flush_timer_ = new NiceMock<Event::MockTimer>(&dispatcher_);
+    const std::string yaml = fmt::format(
+        R"EOF(
+    key_value_store_config:
+      config:
+        name: envoy.key_value.file_based
+        typed_config:
+          "@type": type.googleapis.com/envoy.extensions.key_value.file_based.v3.FileBasedKeyValueStoreConfig
+          filename: {}
+    )EOF",
+        filename_);
+    envoy::extensions::config::v3::KeyValueStoreXdsDelegateConfig config;
+    TestUtility::loadFromYaml(yaml, config);
+    ProtobufWkt::Any typed_config;
+    typed_config.PackFrom(config);
+    KeyValueStoreXdsDelegateFactory factory;
+    EXPECT_EQ("envoy.xds_delegates.kv_store", factory.name());
+    delegate_ = factory.createXdsResourcesDelegate(
+        typed_config, ProtobufMessage::getStrictValidationVisitor(), *api_, dispatcher_);
+  }
+
+  Api::ApiPtr api_{Api::createApiForTest()};
+  NiceMock<Event::MockDispatcher> dispatcher_;
+  std::string filename_;
+  Event::MockTimer* ttl_timer_ = nullptr;
+  Event::MockTimer* flush_timer_ = nullptr;
+  Envoy::Config::XdsConfigSourceId source_id_;
+  Envoy::Config::XdsResourcesDelegatePtr delegate_;
+};
+
+TEST_F(KeyValueStoreXdsDelegateTest, PersistsAndRetrievesResources) {
+  const auto resource_a = decodedResource("a", "1", loadAssignment("a"));
+  const auto resource_b = decodedResource("b", "1", loadAssignment("b"));
+  delegate_->onConfigUpdated(source_id_, {*resource_a, *resource_b});
+
+  auto resources = delegate_->getResources(source_id_, {"a", "b"});
+  ASSERT_EQ(2, resources.size());
+  for (const auto& resource : resources) {
+    EXPECT_EQ("1", resource.version());
+    envoy::config::endpoint::v3::ClusterLoadAssignment unpacked;
+    ASSERT_TRUE(resource.resource().UnpackTo(&unpacked));
+    EXPECT_EQ(resource.name(), unpacked.cluster_name());
+  }
+
+  // An update to a resource replaces the persisted entry.
+  auto updated_assignment = loadAssignment("a");
+  updated_assignment.add_endpoints()->mutable_locality()->set_region("updated");
+  const auto updated_resource_a = decodedResource("a", "2", updated_assignment);
+  delegate_->onConfigUpdated(source_id_, {*updated_resource_a});
+
+  resources = delegate_->getResources(source_id_, {"a"});
+  ASSERT_EQ(1, resources.size());
+  EXPECT_EQ("2", resources[0].version());
+  envoy::config::endpoint::v3::ClusterLoadAssignment unpacked;
+  ASSERT_TRUE(resources[0].resource().UnpackTo(&unpacked));
+  EXPECT_TRUE(TestUtility::protoEqual(updated_assignment, unpacked));
+}
+
+TEST_F(KeyValueStoreXdsDelegateTest, WildcardReturnsAllResourcesForSource) {
+  const auto resource_a = decodedResource("a", "1", loadAssignment("a"));
+  const auto resource_b = decodedResource("b", "1", loadAssignment("b"));
+  delegate_->onConfigUpdated(source_id_, {*resource_a, *resource_b});
+
+  // An empty resource name set is a wildcard, returning all resources for the source.
+  auto resources = delegate_->getResources(source_id_, {});
+  EXPECT_EQ(2, resources.size());
+
+  // Resources are keyed by source, so a different authority sees nothing.
+  const Envoy::Config::XdsConfigSourceId other_source_id(
+      "other_authority", Envoy::Config::TypeUrl::get().ClusterLoadAssignment);
+  EXPECT_TRUE(delegate_->getResources(other_source_id, {}).empty());
+}
+
+TEST_F(KeyValueStoreXdsDelegateTest, ResourceLoadFailureRemovesEntry) {
+  const auto resource_a = decodedResource("a", "1", loadAssignment("a"));
+  const auto resource_b = decodedResource("b", "1", loadAssignment("b"));
+  delegate_->onConfigUpdated(source_id_, {*resource_a, *resource_b});
+
+  delegate_->onResourceLoadFailed(source_id_, "a",
+                                  absl::make_optional(EnvoyException("validation failed")));
+
+  // The failed resource is dropped from the store so it isn't reloaded on subsequent startups.
+  EXPECT_TRUE(delegate_->getResources(source_id_, {"a"}).empty());
+  EXPECT_EQ(1, delegate_->getResources(source_id_, {"b"}).size());
+}
+
+} // namespace
+} // namespace Config
+} // namespace Extensions
+} // namespace Envoy
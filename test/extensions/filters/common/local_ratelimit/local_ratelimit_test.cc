@@ -154,6 +154,42 @@ TEST_F(LocalRateLimiterImplTest, TokenBucketMultipleTokensPerFill) {
   EXPECT_FALSE(rate_limiter_->requestAllowed(route_descriptors_));
 }
 
+// Verify a striped token bucket preserves the global limit semantics: a single thread can
+// consume all tokens by stealing from the other stripes, and refills never exceed the global
+// maximum.
+TEST_F(LocalRateLimiterImplTest, TokenBucketStriped) {
+  initializeTimer();
+  rate_limiter_ = std::make_shared<LocalRateLimiterImpl>(std::chrono::milliseconds(200), 4, 2,
+                                                         dispatcher_, descriptors_, 4);
+
+  // 4 -> 0 tokens, draining every stripe from one thread.
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(rate_limiter_->requestAllowed(route_descriptors_));
+  }
+  EXPECT_FALSE(rate_limiter_->requestAllowed(route_descriptors_));
+
+  // 0 -> 2 tokens
+  EXPECT_CALL(*fill_timer_, enableTimer(std::chrono::milliseconds(200), nullptr));
+  fill_timer_->invokeCallback();
+
+  // 2 -> 0 tokens
+  EXPECT_TRUE(rate_limiter_->requestAllowed(route_descriptors_));
+  EXPECT_TRUE(rate_limiter_->requestAllowed(route_descriptors_));
+  EXPECT_FALSE(rate_limiter_->requestAllowed(route_descriptors_));
+
+  // Repeated fills cap out at the global maximum of 4 tokens.
+  for (int i = 0; i < 3; i++) {
+    EXPECT_CALL(*fill_timer_, enableTimer(std::chrono::milliseconds(200), nullptr));
+    fill_timer_->invokeCallback();
+  }
+
+  // 4 -> 0 tokens
+  for (int i = 0; i < 4; i++) {
+    EXPECT_TRUE(rate_limiter_->requestAllowed(route_descriptors_));
+  }
+  EXPECT_FALSE(rate_limiter_->requestAllowed(route_descriptors_));
+}
+
 // Verify token bucket functionality with max tokens > tokens per fill.
 TEST_F(LocalRateLimiterImplTest, TokenBucketMaxTokensGreaterThanTokensPerFill) {
   initialize(std::chrono::milliseconds(200), 2, 1);
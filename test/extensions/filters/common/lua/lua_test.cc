@@ -86,6 +86,57 @@ TEST_F(LuaTest, CoroutineRefCounting) {
   lua_gc(cr2->luaState(), LUA_GCCOLLECT, 0);
 }
 
+// A cleanly finished coroutine's thread is returned to the per-thread pool and reused by the
+// next createCoroutine() call. A thread that errored is not reused.
+TEST_F(LuaTest, CoroutineReuse) {
+  const std::string SCRIPT{R"EOF(
+    function callMe(object)
+    end
+    function callMeBad()
+      error("borked")
+    end
+  )EOF"};
+
+  InSequence s;
+  setup(SCRIPT);
+  const int call_me_ref = state_->getGlobalRef(state_->registerGlobal("callMe", initializers_));
+  const int call_me_bad_ref =
+      state_->getGlobalRef(state_->registerGlobal("callMeBad", initializers_));
+
+  // Run a coroutine to completion and destroy it. Its thread goes back to the pool.
+  CoroutinePtr cr1(state_->createCoroutine());
+  lua_State* thread1 = cr1->luaState();
+  TestObject* object1 = TestObject::create(cr1->luaState()).first;
+  cr1->start(call_me_ref, 1, yield_callback_);
+  EXPECT_EQ(cr1->state(), Coroutine::State::Finished);
+  EXPECT_CALL(*object1, onDestroy());
+  lua_gc(cr1->luaState(), LUA_GCCOLLECT, 0);
+  cr1.reset();
+
+  // The next coroutine reuses the same thread and runs normally.
+  CoroutinePtr cr2(state_->createCoroutine());
+  EXPECT_EQ(thread1, cr2->luaState());
+  TestObject* object2 = TestObject::create(cr2->luaState()).first;
+  cr2->start(call_me_ref, 1, yield_callback_);
+  EXPECT_EQ(cr2->state(), Coroutine::State::Finished);
+  EXPECT_CALL(*object2, onDestroy());
+  lua_gc(cr2->luaState(), LUA_GCCOLLECT, 0);
+
+  // A second live coroutine cannot use the pooled thread while cr2 still owns it.
+  CoroutinePtr cr3(state_->createCoroutine());
+  EXPECT_NE(thread1, cr3->luaState());
+  lua_State* thread3 = cr3->luaState();
+
+  // An errored coroutine's thread is not returned to the pool.
+  EXPECT_THROW_WITH_REGEX(cr3->start(call_me_bad_ref, 0, yield_callback_), EnvoyException,
+                          "borked");
+  cr3.reset();
+  cr2.reset();
+  CoroutinePtr cr4(state_->createCoroutine());
+  EXPECT_EQ(thread1, cr4->luaState());
+  EXPECT_NE(thread3, cr4->luaState());
+}
+
 // Test that we don't crash when empty errors are used (see PR #15471)
 TEST_F(LuaTest, EmptyError) {
   const std::string SCRIPT{R"EOF(
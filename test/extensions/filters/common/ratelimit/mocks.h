@@ -27,6 +27,11 @@ public:
               (RequestCallbacks & callbacks, const std::string& domain,
                const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
                Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info));
+  MOCK_METHOD(void, limit,
+              (RequestCallbacks & callbacks, const std::string& domain,
+               const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+               Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+               uint32_t hits_addend));
 };
 
 } // namespace RateLimit
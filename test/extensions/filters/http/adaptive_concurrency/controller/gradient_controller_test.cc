@@ -844,6 +844,36 @@ min_rtt_calc_params:
   EXPECT_FALSE(controller->inMinRTTSamplingWindow());
 }
 
+// Verify that latency samples recorded on distinct threads (and therefore spread across the
+// histogram shards) are all merged into the minRTT calculation.
+TEST_F(GradientControllerTest, SamplesMergedAcrossThreads) {
+  const std::string yaml = R"EOF(
+sample_aggregate_percentile:
+  value: 50
+concurrency_limit_params:
+  max_concurrency_limit:
+  concurrency_update_interval: 0.1s
+min_rtt_calc_params:
+  jitter:
+    value: 0.0
+  interval: 30s
+  request_count: 5
+)EOF";
+
+  auto controller = makeController(yaml);
+
+  // Record each sample on its own thread so that consecutive samples land in different shards. The
+  // resulting minRTT must still be the median of all recorded latencies.
+  for (int i = 1; i <= 5; ++i) {
+    tryForward(controller, true);
+    std::thread sampler(
+        [this, &controller, i]() { sampleLatency(controller, std::chrono::milliseconds(i)); });
+    sampler.join();
+  }
+  verifyMinRTTInactive();
+  verifyMinRTTValue(std::chrono::milliseconds(3));
+}
+
 } // namespace
 } // namespace Controller
 } // namespace AdaptiveConcurrency
@@ -31,6 +31,25 @@ TEST(Factory, GlobalEmptyConfig) {
   callback(filter_callback);
 }
 
+TEST(Factory, UpstreamFactory) {
+  const std::string yaml = R"(
+  stat_prefix: test
+  enable_mode: REQUEST_AND_RESPONSE
+  limit_kbps: 10
+  )";
+
+  BandwidthLimitFilterConfig factory;
+  ProtobufTypes::MessagePtr proto_config = factory.createEmptyRouteConfigProto();
+  TestUtility::loadFromYaml(yaml, *proto_config);
+
+  NiceMock<Server::Configuration::MockUpstreamHttpFactoryContext> context;
+
+  auto callback = factory.createFilterFactoryFromProto(*proto_config, "stats", context);
+  Http::MockFilterChainFactoryCallbacks filter_callback;
+  EXPECT_CALL(filter_callback, addStreamFilter(_));
+  callback(filter_callback);
+}
+
 TEST(Factory, RouteSpecificFilterConfig) {
   const std::string config_yaml = R"(
   stat_prefix: test
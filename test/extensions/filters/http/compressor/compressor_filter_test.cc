@@ -1,8 +1,12 @@
+#include "envoy/extensions/compression/gzip/compressor/v3/gzip.pb.h"
+
+#include "source/common/protobuf/message_validator_impl.h"
 #include "source/extensions/filters/http/compressor/compressor_filter.h"
 
 #include "test/mocks/compression/compressor/mocks.h"
 #include "test/mocks/http/mocks.h"
 #include "test/mocks/runtime/mocks.h"
+#include "test/mocks/server/factory_context.h"
 #include "test/mocks/stats/mocks.h"
 #include "test/test_common/test_runtime.h"
 #include "test/test_common/utility.h"
@@ -253,7 +257,9 @@ TEST_P(CompresorFilterEnablementTest, DecodeHeadersWithRuntimeDisabled) {
   }
   std::unique_ptr<CompressorPerRouteFilterConfig> per_route_config;
   if (use_per_route_proto) {
-    per_route_config = std::make_unique<CompressorPerRouteFilterConfig>(per_route_proto);
+    NiceMock<Server::Configuration::MockServerFactoryContext> server_factory_context;
+    per_route_config = std::make_unique<CompressorPerRouteFilterConfig>(
+        per_route_proto, server_factory_context, ProtobufMessage::getStrictValidationVisitor());
     ON_CALL(decoder_callbacks_, mostSpecificPerFilterConfig())
         .WillByDefault(Return(per_route_config.get()));
   }
@@ -264,6 +270,83 @@ TEST_P(CompresorFilterEnablementTest, DecodeHeadersWithRuntimeDisabled) {
   EXPECT_EQ(headers.has("vary"), GetParam().expect_compression_);
 }
 
+// A per-route compressor library with a matching content encoding replaces the filter-level
+// library when instantiating the response compressor.
+TEST_F(CompressorFilterTest, PerRouteCompressorLibraryOverride) {
+  // Build a filter config whose library produces "gzip" so that a per-route gzip library is
+  // eligible to override it.
+  envoy::extensions::filters::http::compressor::v3::Compressor compressor_proto;
+  TestUtility::loadFromJson(R"EOF(
+{
+  "compressor_library": {
+     "name": "test",
+     "typed_config": {
+       "@type": "type.googleapis.com/envoy.extensions.compression.gzip.compressor.v3.Gzip"
+     }
+  }
+}
+)EOF",
+                            compressor_proto);
+  auto compressor_factory = std::make_unique<TestCompressorFactory>("gzip");
+  compressor_factory->setExpectedCompressCalls(0);
+  config_ = std::make_shared<CompressorFilterConfig>(compressor_proto, "test.",
+                                                     *stats_.rootScope(), runtime_,
+                                                     std::move(compressor_factory));
+  filter_ = std::make_unique<CompressorFilter>(config_);
+  filter_->setDecoderFilterCallbacks(decoder_callbacks_);
+  filter_->setEncoderFilterCallbacks(encoder_callbacks_);
+
+  CompressorPerRoute per_route_proto;
+  auto* library = per_route_proto.mutable_overrides()
+                      ->mutable_response_direction_config()
+                      ->mutable_compressor_library();
+  library->set_name("gzip");
+  library->mutable_typed_config()->PackFrom(
+      envoy::extensions::compression::gzip::compressor::v3::Gzip());
+  NiceMock<Server::Configuration::MockServerFactoryContext> server_factory_context;
+  CompressorPerRouteFilterConfig per_route_config(per_route_proto, server_factory_context,
+                                                  ProtobufMessage::getStrictValidationVisitor());
+  ASSERT_NE(nullptr, per_route_config.responseCompressorFactory());
+  EXPECT_EQ("gzip", per_route_config.responseCompressorFactory()->contentEncoding());
+  ON_CALL(decoder_callbacks_, mostSpecificPerFilterConfig())
+      .WillByDefault(Return(&per_route_config));
+
+  Http::TestRequestHeaderMapImpl request_headers{{":method", "get"}, {"accept-encoding", "gzip"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers, false));
+  populateBuffer(256);
+  Http::TestResponseHeaderMapImpl headers{{":method", "get"}, {"content-length", "256"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->encodeHeaders(headers, false));
+  EXPECT_EQ("gzip", headers.get_("content-encoding"));
+  EXPECT_EQ(Http::FilterDataStatus::Continue, filter_->encodeData(data_, true));
+  // The data was compressed by the real per-route gzip library, not the filter-level mock (which
+  // would have left the buffer untouched and failed its zero-compress-calls expectation).
+  EXPECT_NE(expected_str_, data_.toString());
+  EXPECT_EQ(1, stats_.counter("test.compressor.test.test.compressed").value());
+}
+
+// A per-route compressor library whose content encoding differs from the filter-level library's
+// is ignored.
+TEST_F(CompressorFilterTest, PerRouteCompressorLibraryEncodingMismatchIgnored) {
+  CompressorPerRoute per_route_proto;
+  auto* library = per_route_proto.mutable_overrides()
+                      ->mutable_response_direction_config()
+                      ->mutable_compressor_library();
+  library->set_name("gzip");
+  library->mutable_typed_config()->PackFrom(
+      envoy::extensions::compression::gzip::compressor::v3::Gzip());
+  NiceMock<Server::Configuration::MockServerFactoryContext> server_factory_context;
+  CompressorPerRouteFilterConfig per_route_config(per_route_proto, server_factory_context,
+                                                  ProtobufMessage::getStrictValidationVisitor());
+  ON_CALL(decoder_callbacks_, mostSpecificPerFilterConfig())
+      .WillByDefault(Return(&per_route_config));
+
+  // The fixture's filter-level encoding is "test", so the gzip override is ignored and the
+  // filter-level compressor is used, as asserted by its expected compress call.
+  doRequestNoCompression({{":method", "get"}, {"accept-encoding", "test"}});
+  Http::TestResponseHeaderMapImpl headers{{":method", "get"}, {"content-length", "256"}};
+  doResponseCompression(headers, false);
+}
+
 // Default config values.
 TEST_F(CompressorFilterTest, DefaultConfigValues) {
   EXPECT_EQ(30, config_->responseDirectionConfig().minimumLength());
@@ -24,6 +24,7 @@
 #include "test/mocks/network/mocks.h"
 #include "test/mocks/router/mocks.h"
 #include "test/mocks/runtime/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
 #include "test/mocks/tracing/mocks.h"
 #include "test/mocks/upstream/cluster_manager.h"
 #include "test/proto/helloworld.pb.h"
@@ -59,7 +60,7 @@ public:
       TestUtility::loadFromYaml(yaml, proto_config);
     }
     config_.reset(new FilterConfig(proto_config, *stats_store_.rootScope(), runtime_, http_context_,
-                                   "ext_authz_prefix", bootstrap_));
+                                   "ext_authz_prefix", bootstrap_, tls_));
     client_ = new Filters::Common::ExtAuthz::MockClient();
     filter_ = std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client_});
     filter_->setDecoderFilterCallbacks(decoder_filter_callbacks_);
@@ -130,6 +131,7 @@ public:
   Http::TestRequestTrailerMapImpl request_trailers_;
   Buffer::OwnedImpl data_;
   NiceMock<Runtime::MockLoader> runtime_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
   NiceMock<Upstream::MockClusterManager> cm_;
   Network::Address::InstanceConstSharedPtr addr_;
   NiceMock<Envoy::Network::MockConnection> connection_;
@@ -1584,6 +1586,208 @@ TEST_F(HttpFilterTest, FilterAllowAtDisable) {
   EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
 }
 
+// Test that a cached decision is replayed without calling the authorization server again.
+TEST_F(HttpFilterTest, DecisionCacheHitSkipsCheck) {
+  initialize(R"EOF(
+  transport_api_version: V3
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy("authorization", "Bearer token");
+
+  // The first request misses the cache and calls the authorization server.
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(
+          Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                     const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                     const StreamInfo::StreamInfo&) -> void { request_callbacks_ = &callbacks; }));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(decoder_filter_callbacks_, continueDecoding());
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  response.headers_to_set = Http::HeaderVector{{Http::LowerCaseString{"x-authz-verified"}, "true"}};
+  request_callbacks_->onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+  EXPECT_EQ(1U, config_->stats().cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().cache_hit_.value());
+
+  // A second request with the same route and key header is served from the cache, including the
+  // request header mutations from the original decision.
+  auto* client = new Filters::Common::ExtAuthz::MockClient();
+  auto cached_filter =
+      std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  cached_filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  cached_filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _)).Times(0);
+  Http::TestRequestHeaderMapImpl second_request_headers{{"authorization", "Bearer token"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue,
+            cached_filter->decodeHeaders(second_request_headers, false));
+  EXPECT_EQ(1U, config_->stats().cache_miss_.value());
+  EXPECT_EQ(1U, config_->stats().cache_hit_.value());
+  EXPECT_EQ(2U, config_->stats().ok_.value());
+  EXPECT_EQ("true", second_request_headers.get_("x-authz-verified"));
+}
+
+// Test that requests missing a configured key header bypass the cache entirely.
+TEST_F(HttpFilterTest, DecisionCacheMissingKeyHeaderBypassesCache) {
+  initialize(R"EOF(
+  transport_api_version: V3
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(
+          Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                     const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                     const StreamInfo::StreamInfo&) -> void { request_callbacks_ = &callbacks; }));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(decoder_filter_callbacks_, continueDecoding());
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  request_callbacks_->onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+  EXPECT_EQ(0U, config_->stats().cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().cache_hit_.value());
+}
+
+// Test that requests matching an unnamed route bypass the cache: all unnamed routes in a
+// virtual host would otherwise share one key and replay each other's decisions.
+TEST_F(HttpFilterTest, DecisionCacheUnnamedRouteBypassesCache) {
+  initialize(R"EOF(
+  transport_api_version: V3
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy("authorization", "Bearer token");
+  decoder_filter_callbacks_.route_->route_entry_.route_name_.clear();
+
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(
+          Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                     const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                     const StreamInfo::StreamInfo&) -> void { request_callbacks_ = &callbacks; }));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(decoder_filter_callbacks_, continueDecoding());
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::OK;
+  request_callbacks_->onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+  EXPECT_EQ(0U, config_->stats().cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().cache_hit_.value());
+}
+
+// Test that denied responses are not cached unless cache_denied_responses is set.
+TEST_F(HttpFilterTest, DecisionCacheDeniedNotCachedByDefault) {
+  initialize(R"EOF(
+  transport_api_version: V3
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    key_headers:
+    - authorization
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy("authorization", "Bearer token");
+
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(
+          Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                     const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                     const StreamInfo::StreamInfo&) -> void { request_callbacks_ = &callbacks; }));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::Denied;
+  response.status_code = Http::Code::Forbidden;
+  request_callbacks_->onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+
+  // The second request misses the cache again and goes to the authorization server.
+  auto* client = new Filters::Common::ExtAuthz::MockClient();
+  auto second_filter =
+      std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  second_filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  second_filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _));
+  Http::TestRequestHeaderMapImpl second_request_headers{{"authorization", "Bearer token"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            second_filter->decodeHeaders(second_request_headers, false));
+  EXPECT_EQ(2U, config_->stats().cache_miss_.value());
+  EXPECT_EQ(0U, config_->stats().cache_hit_.value());
+}
+
+// Test that denied responses are replayed from the cache when cache_denied_responses is set.
+TEST_F(HttpFilterTest, DecisionCacheDeniedCachedWhenConfigured) {
+  initialize(R"EOF(
+  transport_api_version: V3
+  grpc_service:
+    envoy_grpc:
+      cluster_name: "ext_authz_server"
+  decision_cache:
+    ttl: 10s
+    key_headers:
+    - authorization
+    cache_denied_responses: true
+  )EOF");
+
+  prepareCheck();
+  request_headers_.addCopy("authorization", "Bearer token");
+
+  EXPECT_CALL(*client_, check(_, _, _, _))
+      .WillOnce(
+          Invoke([&](Filters::Common::ExtAuthz::RequestCallbacks& callbacks,
+                     const envoy::service::auth::v3::CheckRequest&, Tracing::Span&,
+                     const StreamInfo::StreamInfo&) -> void { request_callbacks_ = &callbacks; }));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopAllIterationAndWatermark,
+            filter_->decodeHeaders(request_headers_, false));
+
+  Filters::Common::ExtAuthz::Response response{};
+  response.status = Filters::Common::ExtAuthz::CheckStatus::Denied;
+  response.status_code = Http::Code::Forbidden;
+  request_callbacks_->onComplete(std::make_unique<Filters::Common::ExtAuthz::Response>(response));
+
+  // The second request is denied locally without a call to the authorization server.
+  auto* client = new Filters::Common::ExtAuthz::MockClient();
+  auto cached_filter =
+      std::make_unique<Filter>(config_, Filters::Common::ExtAuthz::ClientPtr{client});
+  cached_filter->setDecoderFilterCallbacks(decoder_filter_callbacks_);
+  cached_filter->setEncoderFilterCallbacks(encoder_filter_callbacks_);
+  EXPECT_CALL(*client, check(_, _, _, _)).Times(0);
+  EXPECT_CALL(decoder_filter_callbacks_, sendLocalReply(Http::Code::Forbidden, _, _, _, _));
+  Http::TestRequestHeaderMapImpl second_request_headers{{"authorization", "Bearer token"}};
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            cached_filter->decodeHeaders(second_request_headers, false));
+  EXPECT_EQ(1U, config_->stats().cache_hit_.value());
+  EXPECT_EQ(2U, config_->stats().denied_.value());
+}
+
 // -------------------
 // Parameterized Tests
 // -------------------
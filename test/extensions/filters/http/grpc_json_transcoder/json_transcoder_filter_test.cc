@@ -129,6 +129,54 @@ TEST_F(GrpcJsonTranscoderConfigTest, ParseConfigSkipRecalculating) {
       *api_));
 }
 
+TEST_F(GrpcJsonTranscoderConfigTest, DescriptorPoolInterning) {
+  DescriptorPoolRegistry registry;
+  int builds = 0;
+  auto factory = [&builds]() {
+    ++builds;
+    return std::make_shared<const Protobuf::DescriptorPool>();
+  };
+
+  auto pool1 = registry.getOrCreate(1, factory);
+  auto pool2 = registry.getOrCreate(1, factory);
+  EXPECT_EQ(pool1, pool2);
+  EXPECT_EQ(1, builds);
+
+  auto pool3 = registry.getOrCreate(2, factory);
+  EXPECT_NE(pool1, pool3);
+  EXPECT_EQ(2, builds);
+
+  // Once all configs referencing a pool are gone, it is rebuilt on the next request.
+  pool1.reset();
+  pool2.reset();
+  pool1 = registry.getOrCreate(1, factory);
+  EXPECT_EQ(3, builds);
+}
+
+TEST_F(GrpcJsonTranscoderConfigTest, SharedDescriptorPool) {
+  auto registry = std::make_shared<DescriptorPoolRegistry>();
+  const auto proto_config = getProtoConfig(
+      TestEnvironment::runfilesPath("test/proto/bookstore.descriptor"), "bookstore.Bookstore");
+
+  // Two configs built from the same descriptor set share one pool, and both resolve methods.
+  JsonTranscoderConfig config1(proto_config, *api_, registry);
+  JsonTranscoderConfig config2(proto_config, *api_, registry);
+
+  Http::TestRequestHeaderMapImpl headers{{":method", "GET"}, {":path", "/shelves"}};
+
+  for (JsonTranscoderConfig* config : {&config1, &config2}) {
+    TranscoderInputStreamImpl request_in, response_in;
+    TranscoderPtr transcoder;
+    MethodInfoSharedPtr method_info;
+    const auto status =
+        config->createTranscoder(headers, request_in, response_in, transcoder, method_info);
+
+    EXPECT_TRUE(status.ok());
+    EXPECT_TRUE(transcoder);
+    EXPECT_EQ("bookstore.Bookstore.ListShelves", method_info->descriptor_->full_name());
+  }
+}
+
 TEST_F(GrpcJsonTranscoderConfigTest, ParseBinaryConfig) {
   envoy::extensions::filters::http::grpc_json_transcoder::v3::GrpcJsonTranscoder proto_config;
   proto_config.set_proto_descriptor_bin(api_->fileSystem().fileReadToEnd(
@@ -287,6 +287,32 @@ TEST_F(IpTaggingFilterTest, ClearRouteCache) {
   EXPECT_FALSE(request_headers.has(Http::Headers::get().EnvoyIpTags));
 }
 
+// Filter configs with identical ip_tags share one interned trie; different tag data gets its own.
+TEST_F(IpTaggingFilterTest, TrieInterning) {
+  const std::string other_tags_yaml = R"EOF(
+request_type: internal
+ip_tags:
+  - ip_tag_name: other_request
+    ip_list:
+      - {address_prefix: 5.6.7.8, prefix_len: 32}
+
+)EOF";
+
+  // Instantiate the fixture's filter so its destructor has something to tear down.
+  initializeFilter(internal_request_yaml);
+
+  envoy::extensions::filters::http::ip_tagging::v3::IPTagging config;
+  TestUtility::loadFromYaml(internal_request_yaml, config);
+  auto registry = std::make_shared<IpTagTrieRegistry>();
+  IpTaggingFilterConfig config1(config, "prefix.", *stats_.rootScope(), runtime_, registry);
+  IpTaggingFilterConfig config2(config, "prefix.", *stats_.rootScope(), runtime_, registry);
+  EXPECT_EQ(&config1.trie(), &config2.trie());
+
+  TestUtility::loadFromYaml(other_tags_yaml, config);
+  IpTaggingFilterConfig config3(config, "prefix.", *stats_.rootScope(), runtime_, registry);
+  EXPECT_NE(&config1.trie(), &config3.trie());
+}
+
 } // namespace
 } // namespace IpTagging
 } // namespace HttpFilters
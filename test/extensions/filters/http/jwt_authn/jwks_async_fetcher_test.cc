@@ -208,6 +208,31 @@ TEST_P(JwksAsyncFetcherTest, TestGoodFetchAndRefresh) {
   EXPECT_EQ(0U, stats_.jwks_fetch_failed_.value());
 }
 
+TEST_P(JwksAsyncFetcherTest, TestGoodFetchRefreshIsJittered) {
+  const char config[] = R"(
+      http_uri:
+        uri: https://pubkey_server/pubkey_path
+        cluster: pubkey_cluster
+      async_fetch: {}
+)";
+
+  setupAsyncFetcher(config);
+  EXPECT_EQ(fetch_receiver_array_.size(), 1);
+
+  // The refetch timer fires up to 10% early based on the random generator so that a fleet of
+  // proxies sharing the same cache_duration does not refetch in lockstep.
+  ON_CALL(context_.api_.random_, random()).WillByDefault(testing::Return(1234));
+  constexpr std::chrono::seconds refetchBeforeExpiredSec(5);
+  const std::chrono::milliseconds expected_refetch_time =
+      JwksAsyncFetcher::getCacheDuration(config_) - refetchBeforeExpiredSec -
+      std::chrono::milliseconds(1234);
+  EXPECT_CALL(*timer_, enableTimer(expected_refetch_time, nullptr));
+
+  auto jwks = google::jwt_verify::Jwks::createFrom(PublicKey, google::jwt_verify::Jwks::JWKS);
+  fetch_receiver_array_[0]->onJwksSuccess(std::move(jwks));
+  EXPECT_EQ(1U, stats_.jwks_fetch_success_.value());
+}
+
 TEST_P(JwksAsyncFetcherTest, TestNetworkFailureFetchWithDefaultRefetch) {
   const char config[] = R"(
       http_uri:
@@ -16,8 +16,10 @@
 #include "test/mocks/local_info/mocks.h"
 #include "test/mocks/ratelimit/mocks.h"
 #include "test/mocks/runtime/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
 #include "test/mocks/tracing/mocks.h"
 #include "test/test_common/printers.h"
+#include "test/test_common/simulated_time_system.h"
 #include "test/test_common/utility.h"
 
 #include "gmock/gmock.h"
@@ -38,6 +40,31 @@ namespace HttpFilters {
 namespace RateLimitFilter {
 namespace {
 
+// Hands every call over to a test-owned mock so that expectations survive the quota cache
+// creating a new client per bucket.
+class ForwardingClient : public Filters::Common::RateLimit::Client {
+public:
+  explicit ForwardingClient(Filters::Common::RateLimit::MockClient& delegate)
+      : delegate_(delegate) {}
+
+  // Filters::Common::RateLimit::Client
+  void cancel() override { delegate_.cancel(); }
+  void limit(Filters::Common::RateLimit::RequestCallbacks& callbacks, const std::string& domain,
+             const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info) override {
+    delegate_.limit(callbacks, domain, descriptors, parent_span, stream_info);
+  }
+  void limit(Filters::Common::RateLimit::RequestCallbacks& callbacks, const std::string& domain,
+             const std::vector<Envoy::RateLimit::Descriptor>& descriptors,
+             Tracing::Span& parent_span, const StreamInfo::StreamInfo& stream_info,
+             uint32_t hits_addend) override {
+    delegate_.limit(callbacks, domain, descriptors, parent_span, stream_info, hits_addend);
+  }
+
+private:
+  Filters::Common::RateLimit::MockClient& delegate_;
+};
+
 class HttpRateLimitFilterTest : public testing::Test {
 public:
   HttpRateLimitFilterTest() : http_context_(stats_store_.symbolTable()) {
@@ -56,9 +83,7 @@ public:
     config_ = std::make_shared<FilterConfig>(proto_config, local_info_, *stats_store_.rootScope(),
                                              runtime_, http_context_);
 
-    client_ = new Filters::Common::RateLimit::MockClient();
-    filter_ = std::make_unique<Filter>(config_, Filters::Common::RateLimit::ClientPtr{client_});
-    filter_->setDecoderFilterCallbacks(filter_callbacks_);
+    resetFilter();
     filter_callbacks_.route_->route_entry_.rate_limit_policy_.rate_limit_policy_entry_.clear();
     filter_callbacks_.route_->route_entry_.rate_limit_policy_.rate_limit_policy_entry_.emplace_back(
         route_rate_limit_);
@@ -68,6 +93,37 @@ public:
         .emplace_back(vh_rate_limit_);
   }
 
+  void SetUpPrefetchTest(const std::string& yaml) {
+    envoy::extensions::filters::http::ratelimit::v3::RateLimit proto_config{};
+    TestUtility::loadFromYaml(yaml, proto_config);
+
+    quota_cache_ = std::make_shared<QuotaCache>(
+        proto_config.quota_prefetch(), proto_config.domain(),
+        [this]() -> Filters::Common::RateLimit::ClientPtr {
+          return std::make_unique<ForwardingClient>(prefetch_client_);
+        },
+        tls_, time_system_);
+    config_ = std::make_shared<FilterConfig>(proto_config, local_info_, *stats_store_.rootScope(),
+                                             runtime_, http_context_, quota_cache_);
+
+    resetFilter();
+    filter_callbacks_.route_->route_entry_.rate_limit_policy_.rate_limit_policy_entry_.clear();
+    filter_callbacks_.route_->route_entry_.rate_limit_policy_.rate_limit_policy_entry_.emplace_back(
+        route_rate_limit_);
+    filter_callbacks_.route_->route_entry_.virtual_host_.rate_limit_policy_.rate_limit_policy_entry_
+        .clear();
+    filter_callbacks_.route_->route_entry_.virtual_host_.rate_limit_policy_.rate_limit_policy_entry_
+        .emplace_back(vh_rate_limit_);
+  }
+
+  // Replaces the filter under test with a fresh instance sharing the existing config, as if a new
+  // request arrived.
+  void resetFilter() {
+    client_ = new Filters::Common::RateLimit::MockClient();
+    filter_ = std::make_unique<Filter>(config_, Filters::Common::RateLimit::ClientPtr{client_});
+    filter_->setDecoderFilterCallbacks(filter_callbacks_);
+  }
+
   const std::string fail_close_config_ = R"EOF(
   domain: foo
   failure_mode_deny: true
@@ -99,6 +155,13 @@ public:
     code: 200
   )EOF";
 
+  const std::string quota_prefetch_config_ = R"EOF(
+  domain: foo
+  quota_prefetch:
+    units: 4
+    window: 1s
+  )EOF";
+
   Filters::Common::RateLimit::MockClient* client_;
   NiceMock<Http::MockStreamDecoderFilterCallbacks> filter_callbacks_;
   Stats::StatNamePool pool_{filter_callbacks_.clusterInfo()->statsScope().symbolTable()};
@@ -110,6 +173,8 @@ public:
   Stats::StatName upstream_rq_429_{pool_.add("upstream_rq_429")};
   Stats::StatName upstream_rq_5xx_{pool_.add("upstream_rq_5xx")};
   Stats::StatName upstream_rq_503_{pool_.add("upstream_rq_503")};
+  Stats::StatName ratelimit_quota_hit_{pool_.add("ratelimit.quota_hit")};
+  Stats::StatName ratelimit_quota_miss_{pool_.add("ratelimit.quota_miss")};
   Filters::Common::RateLimit::RequestCallbacks* request_callbacks_{};
   Http::TestRequestHeaderMapImpl request_headers_;
   Http::TestRequestTrailerMapImpl request_trailers_;
@@ -127,6 +192,10 @@ public:
   std::vector<RateLimit::Descriptor> descriptor_two_{{{{"key", "value"}}}};
   NiceMock<LocalInfo::MockLocalInfo> local_info_;
   Http::ContextImpl http_context_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  Event::SimulatedTimeSystem time_system_;
+  NiceMock<Filters::Common::RateLimit::MockClient> prefetch_client_;
+  QuotaCacheSharedPtr quota_cache_;
 };
 
 TEST_F(HttpRateLimitFilterTest, NoRoute) {
@@ -1519,6 +1588,197 @@ TEST_F(HttpRateLimitFilterTest, DefaultConfigValueTest) {
   EXPECT_EQ(FilterRequestType::Both, config_->requestType());
 }
 
+TEST_F(HttpRateLimitFilterTest, QuotaPrefetchMissThenHitThenRefreshAhead) {
+  SetUpPrefetchTest(quota_prefetch_config_);
+
+  // First request: no cached quota, so a batch of four units is fetched and the request waits.
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+
+  EXPECT_CALL(filter_callbacks_, continueDecoding());
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+  EXPECT_EQ(1U, filter_callbacks_.clusterInfo()
+                    ->statsScope()
+                    .counterFromStatName(ratelimit_quota_miss_)
+                    .value());
+
+  // Second request: served from the three remaining cached units without a service call.
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1U, filter_callbacks_.clusterInfo()
+                    ->statsScope()
+                    .counterFromStatName(ratelimit_quota_hit_)
+                    .value());
+
+  // Third request: still a cache hit, but only one unit remains afterwards, which triggers a
+  // background refresh that the request does not wait for.
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+
+  // Fourth request: served from the topped-up cache.
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(3U, filter_callbacks_.clusterInfo()
+                    ->statsScope()
+                    .counterFromStatName(ratelimit_quota_hit_)
+                    .value());
+  EXPECT_EQ(
+      4U, filter_callbacks_.clusterInfo()->statsScope().counterFromStatName(ratelimit_ok_).value());
+}
+
+TEST_F(HttpRateLimitFilterTest, QuotaPrefetchCoalescesConcurrentRequests) {
+  SetUpPrefetchTest(quota_prefetch_config_);
+
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .Times(2)
+      .WillRepeatedly(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+
+  // A second request for the same descriptors piggybacks on the in-flight fetch instead of
+  // issuing its own service call.
+  auto filter2 = std::make_unique<Filter>(
+      config_, Filters::Common::RateLimit::ClientPtr{new Filters::Common::RateLimit::MockClient()});
+  filter2->setDecoderFilterCallbacks(filter_callbacks_);
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter2->decodeHeaders(request_headers_, false));
+
+  EXPECT_CALL(filter_callbacks_, continueDecoding()).Times(2);
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+  EXPECT_EQ(2U, filter_callbacks_.clusterInfo()
+                    ->statsScope()
+                    .counterFromStatName(ratelimit_quota_miss_)
+                    .value());
+}
+
+TEST_F(HttpRateLimitFilterTest, QuotaPrefetchOverLimitHalvesBatch) {
+  SetUpPrefetchTest(quota_prefetch_config_);
+
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+
+  // The rejected batch is not cached and the request is denied.
+  EXPECT_CALL(filter_callbacks_.stream_info_,
+              setResponseFlag(StreamInfo::ResponseFlag::RateLimited));
+  Http::TestResponseHeaderMapImpl response_headers{
+      {":status", "429"},
+      {"x-envoy-ratelimited", Http::Headers::get().EnvoyRateLimitedValues.True}};
+  EXPECT_CALL(filter_callbacks_, encodeHeaders_(HeaderMapEqualRef(&response_headers), true));
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OverLimit, nullptr,
+                               nullptr, nullptr, "", nullptr);
+
+  // The next fetch asks for half the batch.
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 2U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(filter_callbacks_, continueDecoding());
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+}
+
+TEST_F(HttpRateLimitFilterTest, QuotaPrefetchWindowExpires) {
+  SetUpPrefetchTest(quota_prefetch_config_);
+
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(filter_callbacks_, continueDecoding());
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+
+  // Unused quota expires with the window; the next request fetches again.
+  time_system_.setMonotonicTime(time_system_.monotonicTime() + std::chrono::seconds(2));
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+  EXPECT_CALL(filter_callbacks_, continueDecoding());
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+}
+
+TEST_F(HttpRateLimitFilterTest, QuotaPrefetchCancelWhileWaiting) {
+  SetUpPrefetchTest(quota_prefetch_config_);
+
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_CALL(prefetch_client_, limit(_, "foo", _, _, _, 4U))
+      .WillOnce(
+          WithArgs<0>(Invoke([&](Filters::Common::RateLimit::RequestCallbacks& callbacks) -> void {
+            request_callbacks_ = &callbacks;
+          })));
+  EXPECT_EQ(Http::FilterHeadersStatus::StopIteration,
+            filter_->decodeHeaders(request_headers_, false));
+
+  // The stream is reset while waiting; the fetch carries on and its grant is cached.
+  filter_->onDestroy();
+  EXPECT_CALL(filter_callbacks_, continueDecoding()).Times(0);
+  request_callbacks_->complete(Filters::Common::RateLimit::LimitStatus::OK, nullptr, nullptr,
+                               nullptr, "", nullptr);
+
+  resetFilter();
+  EXPECT_CALL(route_rate_limit_, populateDescriptors(_, _, _, _))
+      .WillOnce(SetArgReferee<0>(descriptor_));
+  EXPECT_EQ(Http::FilterHeadersStatus::Continue, filter_->decodeHeaders(request_headers_, false));
+  EXPECT_EQ(1U, filter_callbacks_.clusterInfo()
+                    ->statsScope()
+                    .counterFromStatName(ratelimit_quota_hit_)
+                    .value());
+}
+
 } // namespace
 } // namespace RateLimitFilter
 } // namespace HttpFilters
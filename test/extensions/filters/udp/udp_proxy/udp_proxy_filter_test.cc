@@ -472,6 +472,34 @@ upstream_socket_config:
   EXPECT_EQ(output_.back(), "17 3 17 3");
 }
 
+// An explicitly configured upstream packet writer is used on the upstream send path. The default
+// writer issues one sendmsg() per datagram, matching the behavior when the field is unset.
+TEST_F(UdpProxyFilterTest, UpstreamPacketWriterConfig) {
+  InSequence s;
+
+  setup(readConfig(R"EOF(
+stat_prefix: foo
+matcher:
+  on_no_match:
+    action:
+      name: route
+      typed_config:
+        '@type': type.googleapis.com/envoy.extensions.filters.udp.udp_proxy.v3.Route
+        cluster: fake_cluster
+upstream_udp_packet_writer_config:
+  name: envoy.udp_packet_writer.default
+  typed_config:
+    '@type': type.googleapis.com/envoy.extensions.udp_packet_writer.v3.UdpDefaultWriterFactory
+  )EOF"));
+
+  expectSessionCreate(upstream_address_);
+  test_sessions_[0].expectWriteToUpstream("hello", 0, nullptr, true);
+  recvDataFromDownstream("10.0.0.1:1000", "10.0.0.2:80", "hello");
+  checkTransferStats(5 /*rx_bytes*/, 1 /*rx_datagrams*/, 0 /*tx_bytes*/, 0 /*tx_datagrams*/);
+  test_sessions_[0].recvDataFromUpstream("world");
+  checkTransferStats(5 /*rx_bytes*/, 1 /*rx_datagrams*/, 5 /*tx_bytes*/, 1 /*tx_datagrams*/);
+}
+
 // Route with source IP.
 TEST_F(UdpProxyFilterTest, Router) {
   InSequence s;
@@ -199,6 +199,38 @@ TEST_F(FileSystemHttpCacheTestWithNoDefaultCache, EvictsOldestFilesUntilUnderSiz
   // EXPECT_EQ(cache_->stats().eviction_runs_.value(), 1);
 }
 
+TEST_F(FileSystemHttpCacheTestWithNoDefaultCache, SubdividedCacheCreatesAndUsesSubdirectories) {
+  const std::string file_contents = "XXXXX";
+  ConfigProto cfg = testConfig();
+  cfg.set_cache_subdivisions(4);
+  cfg.mutable_max_cache_entry_count()->set_value(2);
+  // A flat-layout leftover whose name-hash maps to a subdirectory should be removed by the
+  // initial cache scan, while a cache file with an unparseable name is left where it is.
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-5"), file_contents, true);
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-a"), file_contents, true);
+  cache_ = std::dynamic_pointer_cast<FileSystemHttpCache>(
+      http_cache_factory_->getCache(cacheConfig(cfg), context_));
+  waitForEvictionThreadIdle();
+  EXPECT_FALSE(Filesystem::fileSystemForTest().fileExists(absl::StrCat(cache_path_, "cache-5")));
+  EXPECT_TRUE(Filesystem::fileSystemForTest().fileExists(absl::StrCat(cache_path_, "cache-a")));
+  // 5 % 4 == 1, so a file named cache-5 belongs in subdirectory cache-0001, which should
+  // have been created during cache startup along with the other three subdirectories.
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-0001/cache-5"), file_contents,
+                                true);
+  env_.writeStringToFileForTest(absl::StrCat(cache_path_, "cache-0000/cache-5"), file_contents,
+                                true);
+  // Push the tracked count over the limit to provoke an eviction pass, which should remove
+  // the misplaced copy and keep the correctly placed one.
+  cache_->trackFileAdded(file_contents.size());
+  cache_->trackFileAdded(file_contents.size());
+  cache_->trackFileAdded(file_contents.size());
+  waitForEvictionThreadIdle();
+  EXPECT_TRUE(
+      Filesystem::fileSystemForTest().fileExists(absl::StrCat(cache_path_, "cache-0001/cache-5")));
+  EXPECT_FALSE(
+      Filesystem::fileSystemForTest().fileExists(absl::StrCat(cache_path_, "cache-0000/cache-5")));
+}
+
 class FileSystemHttpCacheTest : public FileSystemCacheTestContext, public ::testing::Test {
   void SetUp() override { initCache(); }
 };
@@ -30,6 +30,7 @@
 #include "test/test_common/environment.h"
 #include "test/test_common/registry.h"
 #include "test/test_common/simulated_time_system.h"
+#include "test/test_common/test_runtime.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
 #include "test/test_common/utility.h"
 
@@ -256,6 +257,55 @@ TEST_P(FilterChainManagerImplTest, DuplicateContextsAreNotBuilt) {
       nullptr, filter_chain_factory_builder_, new_filter_chain_manager);
 }
 
+TEST_P(FilterChainManagerImplTest, FilterChainWithMatchOnlyChangeIsNotRebuilt) {
+  envoy::config::listener::v3::FilterChain filter_chain = filter_chain_template_;
+  EXPECT_CALL(filter_chain_factory_builder_, buildFilterChain(_, _));
+  filter_chain_manager_->addFilterChains(
+      GetParam() ? &matcher_ : nullptr,
+      std::vector<const envoy::config::listener::v3::FilterChain*>{&filter_chain}, nullptr,
+      filter_chain_factory_builder_, *filter_chain_manager_);
+
+  // The first chain differs from the origin only in the filter chain match, so the existing
+  // filter chain is reused. The second chain is renamed as well, so it must be rebuilt.
+  envoy::config::listener::v3::FilterChain updated_filter_chain = filter_chain;
+  updated_filter_chain.mutable_filter_chain_match()->mutable_destination_port()->set_value(10001);
+  envoy::config::listener::v3::FilterChain renamed_filter_chain = filter_chain;
+  renamed_filter_chain.set_name("bar");
+  renamed_filter_chain.mutable_filter_chain_match()->mutable_destination_port()->set_value(10002);
+
+  FilterChainManagerImpl new_filter_chain_manager{addresses_, parent_context_, init_manager_,
+                                                  *filter_chain_manager_};
+  EXPECT_CALL(filter_chain_factory_builder_, buildFilterChain(_, _));
+  new_filter_chain_manager.addFilterChains(
+      GetParam() ? &matcher_ : nullptr,
+      std::vector<const envoy::config::listener::v3::FilterChain*>{&updated_filter_chain,
+                                                                   &renamed_filter_chain},
+      nullptr, filter_chain_factory_builder_, new_filter_chain_manager);
+}
+
+TEST_P(FilterChainManagerImplTest, FilterChainWithMatchOnlyChangeIsRebuiltWhenReuseDisabled) {
+  TestScopedRuntime scoped_runtime;
+  scoped_runtime.mergeValues(
+      {{"envoy.reloadable_features.reuse_filter_chain_on_match_only_change", "false"}});
+
+  envoy::config::listener::v3::FilterChain filter_chain = filter_chain_template_;
+  EXPECT_CALL(filter_chain_factory_builder_, buildFilterChain(_, _));
+  filter_chain_manager_->addFilterChains(
+      GetParam() ? &matcher_ : nullptr,
+      std::vector<const envoy::config::listener::v3::FilterChain*>{&filter_chain}, nullptr,
+      filter_chain_factory_builder_, *filter_chain_manager_);
+
+  envoy::config::listener::v3::FilterChain updated_filter_chain = filter_chain;
+  updated_filter_chain.mutable_filter_chain_match()->mutable_destination_port()->set_value(10001);
+  FilterChainManagerImpl new_filter_chain_manager{addresses_, parent_context_, init_manager_,
+                                                  *filter_chain_manager_};
+  EXPECT_CALL(filter_chain_factory_builder_, buildFilterChain(_, _));
+  new_filter_chain_manager.addFilterChains(
+      GetParam() ? &matcher_ : nullptr,
+      std::vector<const envoy::config::listener::v3::FilterChain*>{&updated_filter_chain}, nullptr,
+      filter_chain_factory_builder_, new_filter_chain_manager);
+}
+
 TEST_P(FilterChainManagerImplTest, CreatedFilterChainFactoryContextHasIndependentDrainClose) {
   std::vector<envoy::config::listener::v3::FilterChain> filter_chain_messages;
   for (int i = 0; i < 3; i++) {
@@ -19,6 +19,7 @@
 #include "source/common/config/metadata.h"
 #include "source/common/init/manager_impl.h"
 #include "source/common/network/address_impl.h"
+#include "source/common/network/connection_balancer_impl.h"
 #include "source/common/network/io_socket_handle_impl.h"
 #include "source/common/network/socket_interface_impl.h"
 #include "source/common/network/utility.h"
@@ -8087,6 +8088,41 @@ TEST_P(ListenerManagerImplWithRealFiltersTest, EmptyConnectionBalanceConfig) {
 #endif
 }
 
+TEST_P(ListenerManagerImplWithRealFiltersTest, ExactBalanceConfigBalancerSelection) {
+// Envoy always use ExactBalance at WIN32, so ignore it.
+#ifndef WIN32
+  auto listener = createIPv4Listener("TCPListener");
+  listener.mutable_connection_balance_config()->mutable_exact_balance();
+  Network::Address::InstanceConstSharedPtr address(
+      new Network::Address::Ipv4Instance("192.168.0.1", 80, nullptr));
+
+  // By default exact_balance builds the lock-holding exact balancer.
+  {
+    auto listener_impl = ListenerImpl(listener, "version", *manager_, "foo", true, false,
+                                      /*hash=*/static_cast<uint64_t>(0));
+    auto socket_factory = std::make_unique<Network::MockListenSocketFactory>();
+    EXPECT_CALL(*socket_factory, localAddress()).WillRepeatedly(ReturnRef(address));
+    listener_impl.addSocketFactory(std::move(socket_factory));
+    EXPECT_NE(nullptr, dynamic_cast<Network::ExactConnectionBalancerImpl*>(
+                           &listener_impl.connectionBalancer(*address)));
+  }
+
+  // With the runtime flag enabled the least-loaded balancer is substituted.
+  {
+    TestScopedRuntime scoped_runtime;
+    scoped_runtime.mergeValues(
+        {{"envoy.reloadable_features.listener_least_loaded_connection_balance", "true"}});
+    auto listener_impl = ListenerImpl(listener, "version", *manager_, "foo", true, false,
+                                      /*hash=*/static_cast<uint64_t>(0));
+    auto socket_factory = std::make_unique<Network::MockListenSocketFactory>();
+    EXPECT_CALL(*socket_factory, localAddress()).WillRepeatedly(ReturnRef(address));
+    listener_impl.addSocketFactory(std::move(socket_factory));
+    EXPECT_NE(nullptr, dynamic_cast<Network::LeastLoadedConnectionBalancerImpl*>(
+                           &listener_impl.connectionBalancer(*address)));
+  }
+#endif
+}
+
 INSTANTIATE_TEST_SUITE_P(Matcher, ListenerManagerImplTest, ::testing::Values(false));
 INSTANTIATE_TEST_SUITE_P(Matcher, ListenerManagerImplWithRealFiltersTest,
                          ::testing::Values(false, true));
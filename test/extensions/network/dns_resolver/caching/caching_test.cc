@@ -0,0 +1,197 @@
+#include "envoy/extensions/network/dns_resolver/caching/v3/caching_dns_resolver.pb.h"
+
+#include "source/common/network/dns_resolver/dns_factory_util.h"
+#include "source/common/network/utility.h"
+
+#include "test/mocks/network/mocks.h"
+#include "test/test_common/registry.h"
+#include "test/test_common/simulated_time_system.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+using testing::_;
+using testing::DoAll;
+using testing::ElementsAre;
+using testing::NiceMock;
+using testing::Return;
+using testing::SaveArg;
+
+namespace Envoy {
+namespace Network {
+namespace {
+
+class CachingDnsResolverTest : public testing::Test {
+public:
+  CachingDnsResolverTest()
+      : api_(Api::createApiForTest(time_system_)), dispatcher_(api_->allocateDispatcher("test")) {}
+
+  envoy::config::core::v3::TypedExtensionConfig
+  makeConfig(absl::optional<std::chrono::seconds> max_stale = absl::nullopt) {
+    envoy::extensions::network::dns_resolver::caching::v3::CachingDnsResolverConfig config;
+    config.mutable_dns_resolver_config()->set_name(std::string(CaresDnsResolver));
+    envoy::extensions::network::dns_resolver::cares::v3::CaresDnsResolverConfig cares;
+    config.mutable_dns_resolver_config()->mutable_typed_config()->PackFrom(cares);
+    if (max_stale.has_value()) {
+      config.mutable_max_stale()->set_seconds(max_stale->count());
+    }
+    envoy::config::core::v3::TypedExtensionConfig typed_dns_resolver_config;
+    typed_dns_resolver_config.set_name("envoy.network.dns_resolver.caching");
+    typed_dns_resolver_config.mutable_typed_config()->PackFrom(config);
+    return typed_dns_resolver_config;
+  }
+
+  DnsResolverSharedPtr
+  makeResolver(absl::optional<std::chrono::seconds> max_stale = absl::nullopt) {
+    auto typed_dns_resolver_config = makeConfig(max_stale);
+    EXPECT_CALL(dns_resolver_factory_, createDnsResolver(_, _, _))
+        .WillOnce(Return(inner_resolver_));
+    DnsResolverFactory& factory =
+        createDnsResolverFactoryFromTypedConfig(typed_dns_resolver_config);
+    return factory.createDnsResolver(*dispatcher_, *api_, typed_dns_resolver_config);
+  }
+
+  static std::list<DnsResponse> makeResponse(const std::string& ip, std::chrono::seconds ttl) {
+    std::list<DnsResponse> response;
+    response.emplace_back(DnsResponse(Utility::parseInternetAddress(ip), ttl));
+    return response;
+  }
+
+  DnsResolver::ResolveCb resultRecorder(std::vector<std::string>& results) {
+    return [&results](DnsResolver::ResolutionStatus status, std::list<DnsResponse>&& response) {
+      EXPECT_EQ(status, DnsResolver::ResolutionStatus::Success);
+      for (const DnsResponse& r : response) {
+        results.push_back(r.addrInfo().address_->asString());
+      }
+    };
+  }
+
+  Event::SimulatedTimeSystem time_system_;
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  std::shared_ptr<NiceMock<MockDnsResolver>> inner_resolver_{
+      std::make_shared<NiceMock<MockDnsResolver>>()};
+  NiceMock<MockDnsResolverFactory> dns_resolver_factory_;
+  Registry::InjectFactory<DnsResolverFactory> registered_dns_factory_{dns_resolver_factory_};
+  DnsResolver::ResolveCb inner_cb_;
+};
+
+TEST_F(CachingDnsResolverTest, ServesRepeatResolutionFromCache) {
+  auto resolver = makeResolver();
+  EXPECT_CALL(*inner_resolver_, resolve("foo.com", DnsLookupFamily::V4Only, _))
+      .WillOnce(DoAll(SaveArg<2>(&inner_cb_), Return(&inner_resolver_->active_query_)));
+  std::vector<std::string> results;
+  ActiveDnsQuery* query =
+      resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(results));
+  EXPECT_NE(query, nullptr);
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.1", std::chrono::seconds(30)));
+  EXPECT_THAT(results, ElementsAre("10.0.0.1:0"));
+  // A second resolution within the TTL completes synchronously from the cache, with no
+  // further query to the underlying resolver.
+  results.clear();
+  EXPECT_EQ(nullptr, resolver->resolve("foo.com", DnsLookupFamily::V4Only,
+                                       resultRecorder(results)));
+  EXPECT_THAT(results, ElementsAre("10.0.0.1:0"));
+}
+
+TEST_F(CachingDnsResolverTest, CoalescesConcurrentResolutionsAndHonorsCancel) {
+  auto resolver = makeResolver();
+  EXPECT_CALL(*inner_resolver_, resolve("foo.com", DnsLookupFamily::V4Only, _))
+      .WillOnce(DoAll(SaveArg<2>(&inner_cb_), Return(&inner_resolver_->active_query_)));
+  std::vector<std::string> first_results;
+  std::vector<std::string> second_results;
+  ActiveDnsQuery* first =
+      resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(first_results));
+  ActiveDnsQuery* second =
+      resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(second_results));
+  ActiveDnsQuery* cancelled = resolver->resolve(
+      "foo.com", DnsLookupFamily::V4Only,
+      [](DnsResolver::ResolutionStatus, std::list<DnsResponse>&&) { FAIL(); });
+  EXPECT_NE(first, nullptr);
+  EXPECT_NE(second, nullptr);
+  ASSERT_NE(cancelled, nullptr);
+  cancelled->cancel(ActiveDnsQuery::CancelReason::QueryAbandoned);
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.1", std::chrono::seconds(30)));
+  EXPECT_THAT(first_results, ElementsAre("10.0.0.1:0"));
+  EXPECT_THAT(second_results, ElementsAre("10.0.0.1:0"));
+}
+
+TEST_F(CachingDnsResolverTest, ServesStaleEntryWhenRefreshFails) {
+  auto resolver = makeResolver(std::chrono::seconds(300));
+  EXPECT_CALL(*inner_resolver_, resolve("foo.com", DnsLookupFamily::V4Only, _))
+      .Times(2)
+      .WillRepeatedly(DoAll(SaveArg<2>(&inner_cb_), Return(&inner_resolver_->active_query_)));
+  std::vector<std::string> results;
+  resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(results));
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.1", std::chrono::seconds(30)));
+  EXPECT_THAT(results, ElementsAre("10.0.0.1:0"));
+  // Expire the entry, then fail the re-resolution; the stale addresses should be served
+  // with a success status.
+  time_system_.setMonotonicTime(time_system_.monotonicTime() + std::chrono::seconds(60));
+  results.clear();
+  resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(results));
+  EXPECT_TRUE(results.empty());
+  inner_cb_(DnsResolver::ResolutionStatus::Failure, {});
+  EXPECT_THAT(results, ElementsAre("10.0.0.1:0"));
+}
+
+TEST_F(CachingDnsResolverTest, PropagatesFailureWithoutMaxStale) {
+  auto resolver = makeResolver();
+  EXPECT_CALL(*inner_resolver_, resolve("foo.com", DnsLookupFamily::V4Only, _))
+      .Times(2)
+      .WillRepeatedly(DoAll(SaveArg<2>(&inner_cb_), Return(&inner_resolver_->active_query_)));
+  std::vector<std::string> results;
+  resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(results));
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.1", std::chrono::seconds(30)));
+  time_system_.setMonotonicTime(time_system_.monotonicTime() + std::chrono::seconds(60));
+  DnsResolver::ResolutionStatus status = DnsResolver::ResolutionStatus::Success;
+  resolver->resolve("foo.com", DnsLookupFamily::V4Only,
+                    [&status](DnsResolver::ResolutionStatus s, std::list<DnsResponse>&&) {
+                      status = s;
+                    });
+  inner_cb_(DnsResolver::ResolutionStatus::Failure, {});
+  EXPECT_EQ(status, DnsResolver::ResolutionStatus::Failure);
+}
+
+TEST_F(CachingDnsResolverTest, RefreshesAheadOfExpiryOnAccess) {
+  auto resolver = makeResolver();
+  EXPECT_CALL(*inner_resolver_, resolve("foo.com", DnsLookupFamily::V4Only, _))
+      .Times(2)
+      .WillRepeatedly(DoAll(SaveArg<2>(&inner_cb_), Return(&inner_resolver_->active_query_)));
+  std::vector<std::string> results;
+  resolver->resolve("foo.com", DnsLookupFamily::V4Only, resultRecorder(results));
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.1", std::chrono::seconds(40)));
+  // Past 75% of the TTL but not yet expired: the resolution is still answered from the
+  // cache, and a background refresh is triggered (satisfying the second expectation).
+  time_system_.setMonotonicTime(time_system_.monotonicTime() + std::chrono::seconds(35));
+  results.clear();
+  EXPECT_EQ(nullptr, resolver->resolve("foo.com", DnsLookupFamily::V4Only,
+                                       resultRecorder(results)));
+  EXPECT_THAT(results, ElementsAre("10.0.0.1:0"));
+  inner_cb_(DnsResolver::ResolutionStatus::Success,
+            makeResponse("10.0.0.2", std::chrono::seconds(40)));
+  // Past the original expiry, the refreshed entry is served.
+  time_system_.setMonotonicTime(time_system_.monotonicTime() + std::chrono::seconds(10));
+  results.clear();
+  EXPECT_EQ(nullptr, resolver->resolve("foo.com", DnsLookupFamily::V4Only,
+                                       resultRecorder(results)));
+  EXPECT_THAT(results, ElementsAre("10.0.0.2:0"));
+}
+
+TEST_F(CachingDnsResolverTest, IdenticalConfigsShareOneResolver) {
+  auto typed_dns_resolver_config = makeConfig();
+  EXPECT_CALL(dns_resolver_factory_, createDnsResolver(_, _, _)).WillOnce(Return(inner_resolver_));
+  DnsResolverFactory& factory = createDnsResolverFactoryFromTypedConfig(typed_dns_resolver_config);
+  auto resolver = factory.createDnsResolver(*dispatcher_, *api_, typed_dns_resolver_config);
+  auto other_resolver = factory.createDnsResolver(*dispatcher_, *api_, typed_dns_resolver_config);
+  EXPECT_EQ(resolver, other_resolver);
+}
+
+} // namespace
+} // namespace Network
+} // namespace Envoy
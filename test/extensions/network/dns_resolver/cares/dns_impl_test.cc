@@ -348,6 +348,8 @@ public:
     queries_.emplace_back(query);
   }
 
+  void recordConnectionsAcceptedOnSocketEvent(uint32_t) override {}
+
   void onReject(RejectCause) override { PANIC("not implemented"); }
 
   void addHosts(const std::string& hostname, const IpList& ip, const RecordType& type) {
@@ -1025,6 +1027,47 @@ TEST_P(DnsImplTest, LocalLookup) {
   }
 }
 
+// Concurrent resolutions for the same name and lookup family are merged into a single c-ares
+// query whose result is shared with all callers.
+TEST_P(DnsImplTest, ConcurrentResolutionsMerged) {
+  server_->addHosts("some.good.domain", {"201.134.56.7"}, RecordType::A);
+  EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::V4Only,
+                                             DnsResolver::ResolutionStatus::Success,
+                                             {"201.134.56.7"}, {}, absl::nullopt));
+  EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::V4Only,
+                                             DnsResolver::ResolutionStatus::Success,
+                                             {"201.134.56.7"}, {}, absl::nullopt));
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  // Only one query went to the wire; the second resolution was served from the first.
+  checkStats(1 /*resolve_total*/, 0 /*pending_resolutions*/, 0 /*not_found*/,
+             0 /*get_addr_failure*/, 0 /*timeouts*/);
+  EXPECT_EQ(1, stats_store_.counter("dns.cares.resolutions_merged").value());
+
+  // A different lookup family for the same name is not merged.
+  EXPECT_NE(nullptr, resolveWithNoRecordsExpectation("some.good.domain", DnsLookupFamily::V6Only));
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(1, stats_store_.counter("dns.cares.resolutions_merged").value());
+}
+
+// Cancelling a merged resolution suppresses its callback without affecting the resolution it was
+// merged into.
+TEST_P(DnsImplTest, MergedResolutionCancelled) {
+  server_->addHosts("some.good.domain", {"201.134.56.7"}, RecordType::A);
+  EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::V4Only,
+                                             DnsResolver::ResolutionStatus::Success,
+                                             {"201.134.56.7"}, {}, absl::nullopt));
+  ActiveDnsQuery* merged_query =
+      resolveWithUnreferencedParameters("some.good.domain", DnsLookupFamily::V4Only, false);
+  ASSERT_NE(nullptr, merged_query);
+  merged_query->cancel(Network::ActiveDnsQuery::CancelReason::QueryAbandoned);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+
+  checkStats(1 /*resolve_total*/, 0 /*pending_resolutions*/, 0 /*not_found*/,
+             0 /*get_addr_failure*/, 0 /*timeouts*/);
+  EXPECT_EQ(1, stats_store_.counter("dns.cares.resolutions_merged").value());
+}
+
 TEST_P(DnsImplTest, DnsIpAddressVersion) {
   server_->addHosts("some.good.domain", {"1.2.3.4"}, RecordType::A);
   EXPECT_NE(nullptr, resolveWithExpectations("some.good.domain", DnsLookupFamily::Auto,
@@ -0,0 +1,272 @@
+#include <string>
+
+#include "source/extensions/private_key_providers/offload/offload_private_key_provider.h"
+#include "source/extensions/transport_sockets/tls/private_key/private_key_manager_impl.h"
+
+#include "test/mocks/server/transport_socket_factory_context.h"
+#include "test/mocks/ssl/mocks.h"
+#include "test/test_common/environment.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+#include "openssl/evp.h"
+#include "openssl/pem.h"
+#include "openssl/rsa.h"
+#include "openssl/ssl.h"
+
+using testing::NiceMock;
+using testing::ReturnRef;
+
+namespace Envoy {
+namespace Extensions {
+namespace PrivateKeyMethodProvider {
+namespace Offload {
+namespace {
+
+constexpr absl::string_view kRsaKeyPath =
+    "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/selfsigned_key.pem";
+constexpr absl::string_view kEcdsaKeyPath =
+    "{{ test_rundir }}/test/extensions/transport_sockets/tls/test_data/"
+    "selfsigned_ecdsa_p256_key.pem";
+
+// Completion callbacks which exit the dispatcher, so that the test can block
+// until the thread pool has delivered the result to the worker thread.
+class TestCallbacks : public Ssl::PrivateKeyConnectionCallbacks {
+public:
+  TestCallbacks(Event::Dispatcher& dispatcher) : dispatcher_(dispatcher) {}
+  void onPrivateKeyMethodComplete() override {
+    complete_ = true;
+    dispatcher_.exit();
+  }
+
+  bool complete_{false};
+  Event::Dispatcher& dispatcher_;
+};
+
+class OffloadProviderTest : public testing::Test {
+protected:
+  OffloadProviderTest()
+      : api_(Api::createApiForTest(store_)), dispatcher_(api_->allocateDispatcher("test_thread")),
+        ssl_ctx_(SSL_CTX_new(TLS_method())), ssl_(SSL_new(ssl_ctx_.get())) {
+    ON_CALL(factory_context_, api()).WillByDefault(ReturnRef(*api_));
+  }
+
+  Ssl::PrivateKeyMethodProviderSharedPtr createProvider(absl::string_view key_path,
+                                                        uint32_t pool_size = 2) {
+    envoy::extensions::private_key_providers::offload::v3::OffloadPrivateKeyMethodConfig config;
+    config.mutable_private_key()->set_filename(TestEnvironment::substitute(std::string(key_path)));
+    config.mutable_thread_pool_size()->set_value(pool_size);
+    return std::make_shared<OffloadPrivateKeyMethodProvider>(config, factory_context_);
+  }
+
+  bssl::UniquePtr<EVP_PKEY> readKey(absl::string_view key_path) {
+    const std::string pem =
+        TestEnvironment::readFileToStringForTest(TestEnvironment::substitute(std::string(key_path)));
+    bssl::UniquePtr<BIO> bio(BIO_new_mem_buf(const_cast<char*>(pem.data()), pem.size()));
+    return bssl::UniquePtr<EVP_PKEY>(PEM_read_bio_PrivateKey(bio.get(), nullptr, nullptr, nullptr));
+  }
+
+  // Runs one private key operation to completion via the real thread pool and
+  // the real dispatcher, returning the result of the complete() callback.
+  ssl_private_key_result_t signAndComplete(const SSL_PRIVATE_KEY_METHOD* method,
+                                           uint16_t signature_algorithm, const uint8_t* in,
+                                           size_t in_len) {
+    ssl_private_key_result_t res =
+        method->sign(ssl_.get(), out_, &out_len_, sizeof(out_), signature_algorithm, in, in_len);
+    if (res != ssl_private_key_retry) {
+      return res;
+    }
+    dispatcher_->run(Event::Dispatcher::RunType::Block);
+    return method->complete(ssl_.get(), out_, &out_len_, sizeof(out_));
+  }
+
+  Stats::IsolatedStoreImpl store_;
+  Api::ApiPtr api_;
+  Event::DispatcherPtr dispatcher_;
+  NiceMock<Server::Configuration::MockTransportSocketFactoryContext> factory_context_;
+  bssl::UniquePtr<SSL_CTX> ssl_ctx_;
+  bssl::UniquePtr<SSL> ssl_;
+  uint8_t out_[1024];
+  size_t out_len_{};
+};
+
+TEST_F(OffloadProviderTest, RsaPssSign) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kRsaKeyPath);
+  EXPECT_FALSE(provider->checkFips());
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+  ASSERT_NE(nullptr, method);
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+
+  const std::string in = "hello world";
+  EXPECT_EQ(ssl_private_key_success,
+            signAndComplete(method.get(), SSL_SIGN_RSA_PSS_RSAE_SHA256,
+                            reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+  EXPECT_TRUE(cb.complete_);
+  EXPECT_NE(0, out_len_);
+
+  // Verify the signature with the public part of the key.
+  bssl::UniquePtr<EVP_PKEY> pkey = readKey(kRsaKeyPath);
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey.get());
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(SSL_SIGN_RSA_PSS_RSAE_SHA256);
+  uint8_t hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len;
+  bssl::ScopedEVP_MD_CTX ctx;
+  EXPECT_EQ(1, EVP_DigestInit_ex(ctx.get(), md, nullptr));
+  EXPECT_EQ(1, EVP_DigestUpdate(ctx.get(), in.data(), in.size()));
+  EXPECT_EQ(1, EVP_DigestFinal_ex(ctx.get(), hash, &hash_len));
+  EXPECT_EQ(1, RSA_verify_pss_mgf1(rsa, hash, hash_len, md, nullptr, -1, out_, out_len_));
+
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, RsaPkcs1Sign) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kRsaKeyPath);
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+
+  const std::string in = "hello world";
+  EXPECT_EQ(ssl_private_key_success,
+            signAndComplete(method.get(), SSL_SIGN_RSA_PKCS1_SHA256,
+                            reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+
+  bssl::UniquePtr<EVP_PKEY> pkey = readKey(kRsaKeyPath);
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey.get());
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(SSL_SIGN_RSA_PKCS1_SHA256);
+  uint8_t hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len;
+  bssl::ScopedEVP_MD_CTX ctx;
+  EXPECT_EQ(1, EVP_DigestInit_ex(ctx.get(), md, nullptr));
+  EXPECT_EQ(1, EVP_DigestUpdate(ctx.get(), in.data(), in.size()));
+  EXPECT_EQ(1, EVP_DigestFinal_ex(ctx.get(), hash, &hash_len));
+  EXPECT_EQ(1, RSA_verify(EVP_MD_type(md), hash, hash_len, out_, out_len_, rsa));
+
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, RsaDecrypt) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kRsaKeyPath);
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+
+  // Encrypt a message with the public key; the raw decryption result should
+  // be a PKCS#1 block whose trailing bytes are the message.
+  bssl::UniquePtr<EVP_PKEY> pkey = readKey(kRsaKeyPath);
+  RSA* rsa = EVP_PKEY_get0_RSA(pkey.get());
+  const std::string msg = "secret";
+  std::vector<uint8_t> encrypted(RSA_size(rsa));
+  size_t encrypted_len;
+  ASSERT_EQ(1, RSA_encrypt(rsa, &encrypted_len, encrypted.data(), encrypted.size(),
+                           reinterpret_cast<const uint8_t*>(msg.data()), msg.size(),
+                           RSA_PKCS1_PADDING));
+
+  ssl_private_key_result_t res = method->decrypt(ssl_.get(), out_, &out_len_, sizeof(out_),
+                                                 encrypted.data(), encrypted_len);
+  EXPECT_EQ(ssl_private_key_retry, res);
+  dispatcher_->run(Event::Dispatcher::RunType::Block);
+  EXPECT_EQ(ssl_private_key_success, method->complete(ssl_.get(), out_, &out_len_, sizeof(out_)));
+  ASSERT_EQ(static_cast<size_t>(RSA_size(rsa)), out_len_);
+  EXPECT_EQ(msg, std::string(reinterpret_cast<char*>(out_) + out_len_ - msg.size(), msg.size()));
+
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, EcdsaSign) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kEcdsaKeyPath);
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+
+  const std::string in = "hello world";
+  EXPECT_EQ(ssl_private_key_success,
+            signAndComplete(method.get(), SSL_SIGN_ECDSA_SECP256R1_SHA256,
+                            reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+
+  bssl::UniquePtr<EVP_PKEY> pkey = readKey(kEcdsaKeyPath);
+  EC_KEY* ec_key = EVP_PKEY_get0_EC_KEY(pkey.get());
+  const EVP_MD* md = SSL_get_signature_algorithm_digest(SSL_SIGN_ECDSA_SECP256R1_SHA256);
+  uint8_t hash[EVP_MAX_MD_SIZE];
+  unsigned int hash_len;
+  bssl::ScopedEVP_MD_CTX ctx;
+  EXPECT_EQ(1, EVP_DigestInit_ex(ctx.get(), md, nullptr));
+  EXPECT_EQ(1, EVP_DigestUpdate(ctx.get(), in.data(), in.size()));
+  EXPECT_EQ(1, EVP_DigestFinal_ex(ctx.get(), hash, &hash_len));
+  EXPECT_EQ(1, ECDSA_verify(0, hash, hash_len, out_, out_len_, ec_key));
+
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, SignatureAlgorithmKeyMismatch) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kRsaKeyPath);
+  Ssl::BoringSslPrivateKeyMethodSharedPtr method = provider->getBoringSslPrivateKeyMethod();
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+
+  // An ECDSA signature request against an RSA key fails synchronously.
+  const std::string in = "hello world";
+  EXPECT_EQ(ssl_private_key_failure,
+            method->sign(ssl_.get(), out_, &out_len_, sizeof(out_), SSL_SIGN_ECDSA_SECP256R1_SHA256,
+                         reinterpret_cast<const uint8_t*>(in.data()), in.size()));
+
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, DoubleRegistrationThrows) {
+  Ssl::PrivateKeyMethodProviderSharedPtr provider = createProvider(kRsaKeyPath);
+
+  TestCallbacks cb(*dispatcher_);
+  provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_);
+  EXPECT_THROW_WITH_MESSAGE(provider->registerPrivateKeyMethod(ssl_.get(), cb, *dispatcher_),
+                            EnvoyException,
+                            "Not registering the offload provider twice for same context");
+  provider->unregisterPrivateKeyMethod(ssl_.get());
+}
+
+TEST_F(OffloadProviderTest, InvalidKeyThrows) {
+  envoy::extensions::private_key_providers::offload::v3::OffloadPrivateKeyMethodConfig config;
+  config.mutable_private_key()->set_inline_string("not a PEM key");
+  EXPECT_THROW_WITH_MESSAGE(OffloadPrivateKeyMethodProvider(config, factory_context_),
+                            EnvoyException, "Failed to read private key.");
+}
+
+// Creation through the private key method manager, which looks the factory up
+// from the registry by provider name.
+TEST_F(OffloadProviderTest, CreateThroughManager) {
+  NiceMock<Ssl::MockContextManager> context_manager;
+  TransportSockets::Tls::PrivateKeyMethodManagerImpl private_key_method_manager;
+  ON_CALL(factory_context_, sslContextManager()).WillByDefault(ReturnRef(context_manager));
+  ON_CALL(context_manager, privateKeyMethodManager())
+      .WillByDefault(ReturnRef(private_key_method_manager));
+
+  const std::string yaml = absl::StrCat(R"EOF(
+      provider_name: offload
+      typed_config:
+        "@type": type.googleapis.com/envoy.extensions.private_key_providers.offload.v3.OffloadPrivateKeyMethodConfig
+        thread_pool_size: 1
+        private_key: { "filename": ")EOF",
+                                        TestEnvironment::substitute(std::string(kRsaKeyPath)),
+                                        R"EOF(" }
+)EOF");
+
+  envoy::extensions::transport_sockets::tls::v3::PrivateKeyProvider private_key_provider;
+  TestUtility::loadFromYaml(yaml, private_key_provider);
+  Ssl::PrivateKeyMethodProviderSharedPtr provider =
+      factory_context_.sslContextManager()
+          .privateKeyMethodManager()
+          .createPrivateKeyMethodProvider(private_key_provider, factory_context_);
+  EXPECT_NE(nullptr, provider);
+  EXPECT_NE(nullptr, provider->getBoringSslPrivateKeyMethod());
+}
+
+} // namespace
+} // namespace Offload
+} // namespace PrivateKeyMethodProvider
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,110 @@
+#include <cstdint>
+#include <vector>
+
+#include "source/common/common/hex.h"
+#include "source/common/runtime/runtime_features.h"
+#include "source/extensions/transport_sockets/tls/ktls.h"
+
+#include "test/mocks/network/io_handle.h"
+
+#include "gtest/gtest.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+namespace {
+
+using testing::StrictMock;
+
+TEST(KernelTlsTest, VersionAndCipherGating) {
+  EXPECT_TRUE(kernelTlsVersionAndCipherSupported(TLS1_3_VERSION, TLS1_3_CK_AES_128_GCM_SHA256));
+
+  // Only TLS 1.3 is offloadable; the kernel cannot be seeded with TLS 1.2 record state here.
+  EXPECT_FALSE(kernelTlsVersionAndCipherSupported(TLS1_2_VERSION, TLS1_3_CK_AES_128_GCM_SHA256));
+  EXPECT_FALSE(kernelTlsVersionAndCipherSupported(TLS1_1_VERSION, TLS1_3_CK_AES_128_GCM_SHA256));
+
+  // Only AES-128-GCM keys are installed; other TLS 1.3 suites stay on the userspace path.
+  EXPECT_FALSE(kernelTlsVersionAndCipherSupported(TLS1_3_VERSION, TLS1_3_CK_AES_256_GCM_SHA384));
+  EXPECT_FALSE(
+      kernelTlsVersionAndCipherSupported(TLS1_3_VERSION, TLS1_3_CK_CHACHA20_POLY1305_SHA256));
+}
+
+// The runtime guard is off by default, so SslSocket never reaches tryEnableKernelTls and the
+// userspace record path is unchanged unless the feature is explicitly enabled.
+TEST(KernelTlsTest, RuntimeGuardDefaultOff) {
+  EXPECT_FALSE(
+      Runtime::runtimeFeatureEnabled("envoy.reloadable_features.tls_enable_kernel_offload"));
+}
+
+// A connection with no negotiated cipher (here, an SSL object that never handshook) must leave
+// the socket completely untouched: no ULP attach and no key installation.
+TEST(KernelTlsTest, IneligibleConnectionLeavesSocketUntouched) {
+  bssl::UniquePtr<SSL_CTX> ctx(SSL_CTX_new(TLS_method()));
+  bssl::UniquePtr<SSL> ssl(SSL_new(ctx.get()));
+  StrictMock<Network::MockIoHandle> io_handle;
+
+  const KernelTlsStatus status = tryEnableKernelTls(ssl.get(), io_handle);
+  EXPECT_FALSE(status.tx_enabled_);
+  EXPECT_FALSE(status.rx_enabled_);
+}
+
+#if defined(__linux__) && defined(TLS_1_3_VERSION)
+
+// Traffic secrets and the keys/IVs derived from them, taken from the simple 1-RTT handshake
+// trace in RFC 8448 section 3 ("derive write traffic keys for handshake data").
+constexpr char kServerSecretHex[] =
+    "b67b7d690cc16c4e75e54213cb2d37b4e9c912bcded9105d42befd59d391ad38";
+constexpr char kServerKeyHex[] = "3fce516009c21727d0f2e4e86ee403bc";
+constexpr char kServerIvHex[] = "5d313eb2671276ee13000b30";
+constexpr char kClientSecretHex[] =
+    "b3eddb126e067f35a780b3abf45e2d8f3b1a950738f52e9600746a0e27a55a21";
+constexpr char kClientKeyHex[] = "dbfaa693d1762c5b666af5d950258d01";
+constexpr char kClientIvHex[] = "5bd3c71b836e0b76bb73265f";
+
+TEST(KernelTlsTest, HkdfExpandLabelRfc8448Vectors) {
+  const std::vector<std::pair<std::string, std::pair<std::string, std::string>>> vectors = {
+      {kServerSecretHex, {kServerKeyHex, kServerIvHex}},
+      {kClientSecretHex, {kClientKeyHex, kClientIvHex}},
+  };
+  for (const auto& [secret_hex, expected] : vectors) {
+    const std::vector<uint8_t> secret = Hex::decode(secret_hex);
+
+    uint8_t key[16];
+    ASSERT_TRUE(hkdfExpandLabel(EVP_sha256(), secret, "key", key, sizeof(key)));
+    EXPECT_EQ(expected.first, Hex::encode(key, sizeof(key)));
+
+    uint8_t iv[12];
+    ASSERT_TRUE(hkdfExpandLabel(EVP_sha256(), secret, "iv", iv, sizeof(iv)));
+    EXPECT_EQ(expected.second, Hex::encode(iv, sizeof(iv)));
+  }
+}
+
+TEST(KernelTlsTest, CryptoInfoPopulation) {
+  const std::vector<uint8_t> secret = Hex::decode(kServerSecretHex);
+
+  tls12_crypto_info_aes_gcm_128 crypto_info;
+  ASSERT_TRUE(makeCryptoInfo(crypto_info, secret, 0x0102030405060708));
+
+  EXPECT_EQ(TLS_1_3_VERSION, crypto_info.info.version);
+  EXPECT_EQ(TLS_CIPHER_AES_GCM_128, crypto_info.info.cipher_type);
+  EXPECT_EQ(kServerKeyHex, Hex::encode(crypto_info.key, sizeof(crypto_info.key)));
+
+  // The 12-byte RFC 8446 IV is split into the kernel's 4-byte salt and 8-byte IV fields.
+  EXPECT_EQ(std::string(kServerIvHex).substr(0, 8),
+            Hex::encode(crypto_info.salt, sizeof(crypto_info.salt)));
+  EXPECT_EQ(std::string(kServerIvHex).substr(8),
+            Hex::encode(crypto_info.iv, sizeof(crypto_info.iv)));
+
+  // The record sequence is handed over big-endian.
+  EXPECT_EQ("0102030405060708", Hex::encode(crypto_info.rec_seq, sizeof(crypto_info.rec_seq)));
+}
+
+#endif // defined(__linux__) && defined(TLS_1_3_VERSION)
+
+} // namespace
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -0,0 +1,83 @@
+#include "source/extensions/transport_sockets/tls/server_session_cache.h"
+
+#include "gtest/gtest.h"
+#include "openssl/ssl.h"
+
+namespace Envoy {
+namespace Extensions {
+namespace TransportSockets {
+namespace Tls {
+namespace {
+
+class ServerSessionCacheTest : public testing::Test {
+protected:
+  ServerSessionCacheTest() : ssl_ctx_(SSL_CTX_new(TLS_method())) {}
+
+  // Creates a session with the given ID. The caller owns the returned reference;
+  // pass an extra reference to store() with storeSession().
+  bssl::UniquePtr<SSL_SESSION> makeSession(absl::string_view id) {
+    bssl::UniquePtr<SSL_SESSION> session(SSL_SESSION_new(ssl_ctx_.get()));
+    EXPECT_EQ(1, SSL_SESSION_set1_id(session.get(), reinterpret_cast<const uint8_t*>(id.data()),
+                                     id.size()));
+    return session;
+  }
+
+  int storeSession(const bssl::UniquePtr<SSL_SESSION>& session) {
+    SSL_SESSION_up_ref(session.get());
+    return cache_.store(session.get());
+  }
+
+  bssl::UniquePtr<SSL_CTX> ssl_ctx_;
+  ServerSessionCache cache_;
+};
+
+TEST_F(ServerSessionCacheTest, StoreAndFind) {
+  bssl::UniquePtr<SSL_SESSION> session = makeSession("some-session-id");
+  EXPECT_EQ(1, storeSession(session));
+
+  bssl::UniquePtr<SSL_SESSION> found = cache_.find("some-session-id");
+  EXPECT_EQ(session.get(), found.get());
+  EXPECT_EQ(nullptr, cache_.find("unknown-session-id"));
+}
+
+TEST_F(ServerSessionCacheTest, StoreReplacesExistingId) {
+  bssl::UniquePtr<SSL_SESSION> first = makeSession("some-session-id");
+  bssl::UniquePtr<SSL_SESSION> second = makeSession("some-session-id");
+  EXPECT_EQ(1, storeSession(first));
+  EXPECT_EQ(1, storeSession(second));
+
+  bssl::UniquePtr<SSL_SESSION> found = cache_.find("some-session-id");
+  EXPECT_EQ(second.get(), found.get());
+}
+
+TEST_F(ServerSessionCacheTest, Remove) {
+  bssl::UniquePtr<SSL_SESSION> session = makeSession("some-session-id");
+  EXPECT_EQ(1, storeSession(session));
+
+  cache_.remove(session.get());
+  EXPECT_EQ(nullptr, cache_.find("some-session-id"));
+}
+
+// A removal for a session that has since been replaced must not drop the newer
+// session with the same ID.
+TEST_F(ServerSessionCacheTest, StaleRemoveKeepsReplacement) {
+  bssl::UniquePtr<SSL_SESSION> first = makeSession("some-session-id");
+  bssl::UniquePtr<SSL_SESSION> second = makeSession("some-session-id");
+  EXPECT_EQ(1, storeSession(first));
+  EXPECT_EQ(1, storeSession(second));
+
+  cache_.remove(first.get());
+  bssl::UniquePtr<SSL_SESSION> found = cache_.find("some-session-id");
+  EXPECT_EQ(second.get(), found.get());
+}
+
+TEST_F(ServerSessionCacheTest, SessionWithoutIdNotStored) {
+  bssl::UniquePtr<SSL_SESSION> session(SSL_SESSION_new(ssl_ctx_.get()));
+  EXPECT_EQ(0, cache_.store(session.get()));
+}
+
+} // namespace
+} // namespace Tls
+} // namespace TransportSockets
+} // namespace Extensions
+} // namespace Envoy
@@ -131,6 +131,43 @@ TEST_F(ProfileActionTest, CanDoSingleProfile) {
 #endif
 }
 
+TEST_F(ProfileActionTest, HeapSampleDoesNotDisturbCpuProfile) {
+  // Same as CanDoSingleProfile, but with the heap sample enabled. Whether or not the build
+  // carries the gperftools heap profiler, the CPU profile capture must be unaffected.
+  envoy::extensions::watchdog::profile_action::v3::ProfileActionConfig config;
+  config.set_profile_path(test_path_);
+  config.mutable_profile_duration()->set_seconds(1);
+  config.set_capture_heap_sample(true);
+
+  action_ = std::make_unique<ProfileAction>(config, context_);
+  Thread::ThreadPtr thread = api_->threadFactory().createThread(
+      [this]() -> void { dispatcher_->run(Event::Dispatcher::RunType::RunUntilExit); });
+
+  const auto now = api_->timeSource().monotonicTime();
+  std::vector<std::pair<Thread::ThreadId, MonotonicTime>> tid_ltt_pairs = {
+      {Thread::ThreadId(10), now}};
+
+  dispatcher_->post([&tid_ltt_pairs, &now, this]() -> void {
+    action_->run(envoy::config::bootstrap::v3::Watchdog::WatchdogAction::MISS, tid_ltt_pairs, now);
+    absl::MutexLock lock(&mutex_);
+    outstanding_notifies_ += 1;
+  });
+
+  absl::MutexLock lock(&mutex_);
+  waitForOutstandingNotify();
+  time_system_->advanceTimeWait(std::chrono::seconds(2));
+
+  dispatcher_->exit();
+  thread->join();
+
+#ifdef PROFILER_AVAILABLE
+  EXPECT_GE(countNumberOfProfileInPath(test_path_), 1);
+#else
+  EXPECT_EQ(countNumberOfProfileInPath(test_path_), 0);
+#endif
+  EXPECT_FALSE(Profiler::Heap::isProfilerStarted());
+}
+
 TEST_F(ProfileActionTest, CanDoMultipleProfiles) {
   // Create configuration.
   envoy::extensions::watchdog::profile_action::v3::ProfileActionConfig config;
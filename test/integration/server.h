@@ -295,6 +295,22 @@ public:
     Thread::LockGuard lock(lock_);
     store_.forEachScope(f_size, f_scope);
   }
+  void forEachCounterFamily(const Stats::FamilyIterateFn<Counter>& fn) const override {
+    Thread::LockGuard lock(lock_);
+    store_.forEachCounterFamily(fn);
+  }
+  void forEachGaugeFamily(const Stats::FamilyIterateFn<Gauge>& fn) const override {
+    Thread::LockGuard lock(lock_);
+    store_.forEachGaugeFamily(fn);
+  }
+  void forEachTextReadoutFamily(const Stats::FamilyIterateFn<TextReadout>& fn) const override {
+    Thread::LockGuard lock(lock_);
+    store_.forEachTextReadoutFamily(fn);
+  }
+  void forEachHistogramFamily(const Stats::FamilyIterateFn<ParentHistogram>& fn) const override {
+    Thread::LockGuard lock(lock_);
+    store_.forEachHistogramFamily(fn);
+  }
   void forEachSinkedCounter(Stats::SizeFn f_size, StatFn<Counter> f_stat) const override {
     Thread::LockGuard lock(lock_);
     store_.forEachSinkedCounter(f_size, f_stat);
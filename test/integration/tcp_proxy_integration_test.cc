@@ -312,6 +312,34 @@ TEST_P(TcpProxyIntegrationTest, TcpProxyLargeWrite) {
   EXPECT_EQ(downstream_pauses, downstream_resumes);
 }
 
+// With the splice relay enabled, payload must round-trip unchanged and half-close semantics are
+// preserved once the relay disengages back to the buffered path.
+TEST_P(TcpProxyIntegrationTest, TcpProxySpliceRelay) {
+  config_helper_.addRuntimeOverride("envoy.reloadable_features.tcp_proxy_use_splice", "true");
+  initialize();
+
+  IntegrationTcpClientPtr tcp_client = makeTcpConnection(lookupPort("tcp_proxy"));
+  FakeRawConnectionPtr fake_upstream_connection;
+  ASSERT_TRUE(fake_upstreams_[0]->waitForRawConnection(fake_upstream_connection));
+
+  const std::string data(1024 * 16, 'a');
+  ASSERT_TRUE(tcp_client->write(data));
+  ASSERT_TRUE(fake_upstream_connection->waitForData(data.size()));
+  ASSERT_TRUE(fake_upstream_connection->write(data));
+  tcp_client->waitForData(data);
+#if defined(__linux__)
+  test_server_->waitForCounterGe("tcp.tcpproxy_stats.splice_relay_engaged_total", 1);
+#endif
+
+  // A half-close from the upstream peer disengages the relay; the buffered path then observes
+  // the EOF and runs the usual half-close propagation.
+  ASSERT_TRUE(fake_upstream_connection->write("", true));
+  tcp_client->waitForHalfClose();
+  ASSERT_TRUE(tcp_client->write("", true));
+  ASSERT_TRUE(fake_upstream_connection->waitForHalfClose());
+  ASSERT_TRUE(fake_upstream_connection->waitForDisconnect());
+}
+
 // Test that a downstream flush works correctly (all data is flushed)
 TEST_P(TcpProxyIntegrationTest, TcpProxyDownstreamFlush) {
   // Use a very large size to make sure it is larger than the kernel socket read buffer.
@@ -94,6 +94,7 @@ public:
   MOCK_METHOD(SysCallIntResult, ftruncate, (int fd, off_t length));
   MOCK_METHOD(SysCallPtrResult, mmap,
               (void* addr, size_t length, int prot, int flags, int fd, off_t offset));
+  MOCK_METHOD(SysCallIntResult, munmap, (void* addr, size_t length));
   MOCK_METHOD(SysCallIntResult, stat, (const char* name, struct stat* stat));
   MOCK_METHOD(SysCallIntResult, fstat, (os_fd_t fd, struct stat* stat));
   MOCK_METHOD(SysCallIntResult, chmod, (const std::string& name, mode_t mode));
@@ -110,6 +111,7 @@ public:
   MOCK_METHOD(SysCallIntResult, open, (const char* pathname, int flags), (const));
   MOCK_METHOD(SysCallIntResult, open, (const char* pathname, int flags, mode_t mode), (const));
   MOCK_METHOD(SysCallIntResult, unlink, (const char* pathname), (const));
+  MOCK_METHOD(SysCallIntResult, mkdir, (const char* pathname, mode_t mode), (const));
   MOCK_METHOD(SysCallIntResult, linkat,
               (os_fd_t olddirfd, const char* oldpath, os_fd_t newdirfd, const char* newpath,
                int flags),
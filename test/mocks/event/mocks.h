@@ -90,6 +90,14 @@ public:
     return timer;
   }
 
+  Event::TimerPtr createCoarseTimer(Event::TimerCb cb) override {
+    // Tests treat coarse timers like regular timers; expectations are set via createTimer_().
+    auto timer = Event::TimerPtr{createTimer_(cb)};
+    // Assert that the timer is not null to avoid confusing test failures down the line.
+    ASSERT(timer != nullptr);
+    return timer;
+  }
+
   Event::TimerPtr createScaledTimer(ScaledTimerMinimum minimum, Event::TimerCb cb) override {
     auto timer = Event::TimerPtr{createScaledTimer_(minimum, cb)};
     // Assert that the timer is not null to avoid confusing test failures down the line.
@@ -74,6 +74,9 @@ public:
   }
 
   TimerPtr createTimer(TimerCb cb) override { return impl_.createTimer(std::move(cb)); }
+  TimerPtr createCoarseTimer(TimerCb cb) override {
+    return impl_.createCoarseTimer(std::move(cb));
+  }
   TimerPtr createScaledTimer(ScaledTimerMinimum minimum, TimerCb cb) override {
     return impl_.createScaledTimer(minimum, std::move(cb));
   }
@@ -8,6 +8,9 @@ namespace Envoy {
 namespace Http {
 namespace ConnectionPool {
 
+MockConnectionLifetimeCallbacks::MockConnectionLifetimeCallbacks() = default;
+MockConnectionLifetimeCallbacks::~MockConnectionLifetimeCallbacks() = default;
+
 MockInstance::MockInstance()
     : host_{std::make_shared<testing::NiceMock<Upstream::MockHostDescription>>()} {
   ON_CALL(*this, host()).WillByDefault(Return(host_));
@@ -22,6 +22,20 @@ class MockCallbacks : public Callbacks {
                StreamInfo::StreamInfo& info, absl::optional<Http::Protocol> protocol));
 };
 
+class MockConnectionLifetimeCallbacks : public ConnectionLifetimeCallbacks {
+public:
+  MockConnectionLifetimeCallbacks();
+  ~MockConnectionLifetimeCallbacks() override;
+
+  // Http::ConnectionPool::ConnectionLifetimeCallbacks
+  MOCK_METHOD(void, onConnectionOpen,
+              (Instance & pool, std::vector<uint8_t>& hash_key,
+               const Network::Connection& connection));
+  MOCK_METHOD(void, onConnectionDraining,
+              (Instance & pool, std::vector<uint8_t>& hash_key,
+               const Network::Connection& connection));
+};
+
 class MockInstance : public Instance {
 public:
   MockInstance();
@@ -39,6 +53,8 @@ public:
   MOCK_METHOD(bool, maybePreconnect, (float));
   MOCK_METHOD(Upstream::HostDescriptionConstSharedPtr, host, (), (const));
   MOCK_METHOD(absl::string_view, protocolDescription, (), (const));
+  MOCK_METHOD(void, setConnectionLifetimeCallbacks,
+              (std::vector<uint8_t> hash_key, ConnectionLifetimeCallbacks& callbacks));
 
   std::shared_ptr<testing::NiceMock<Upstream::MockHostDescription>> host_;
   IdleCb idle_cb_;
@@ -63,6 +63,11 @@ MockMetricSnapshot::MockMetricSnapshot() {
   ON_CALL(*this, counters()).WillByDefault(ReturnRef(counters_));
   ON_CALL(*this, gauges()).WillByDefault(ReturnRef(gauges_));
   ON_CALL(*this, histograms()).WillByDefault(ReturnRef(histograms_));
+  // By default behave like a full-sync snapshot: the changed-metric views
+  // alias the full backing vectors.
+  ON_CALL(*this, changedCounters()).WillByDefault(ReturnRef(counters_));
+  ON_CALL(*this, changedGauges()).WillByDefault(ReturnRef(gauges_));
+  ON_CALL(*this, changedTextReadouts()).WillByDefault(ReturnRef(text_readouts_));
 }
 
 MockMetricSnapshot::~MockMetricSnapshot() = default;
@@ -161,6 +161,7 @@ public:
   MOCK_METHOD(void, setParentValue, (uint64_t parent_value));
   MOCK_METHOD(void, sub, (uint64_t amount));
   MOCK_METHOD(void, mergeImportMode, (ImportMode));
+  MOCK_METHOD(bool, latchChanged, ());
   MOCK_METHOD(bool, used, (), (const));
   MOCK_METHOD(uint64_t, value, (), (const));
   MOCK_METHOD(absl::optional<bool>, cachedShouldImport, (), (const));
@@ -228,6 +229,7 @@ public:
   ~MockTextReadout() override;
 
   MOCK_METHOD(void, set, (absl::string_view value), (override));
+  MOCK_METHOD(bool, latchChanged, (), (override));
   MOCK_METHOD(bool, used, (), (const, override));
   MOCK_METHOD(std::string, value, (), (const, override));
 
@@ -244,6 +246,10 @@ public:
   MOCK_METHOD(const std::vector<std::reference_wrapper<const Gauge>>&, gauges, ());
   MOCK_METHOD(const std::vector<std::reference_wrapper<const ParentHistogram>>&, histograms, ());
   MOCK_METHOD(const std::vector<std::reference_wrapper<const TextReadout>>&, textReadouts, ());
+  MOCK_METHOD(const std::vector<CounterSnapshot>&, changedCounters, ());
+  MOCK_METHOD(const std::vector<std::reference_wrapper<const Gauge>>&, changedGauges, ());
+  MOCK_METHOD(const std::vector<std::reference_wrapper<const TextReadout>>&, changedTextReadouts,
+              ());
 
   SystemTime snapshotTime() const override { return snapshot_time_; }
 
@@ -160,6 +160,8 @@ TEST_P(AdminInstanceTest, Help) {
       paths: Change multiple logging levels by setting to <logger_name1>:<desired_level1>,<logger_name2>:<desired_level2>.
       level: desired logging level; One of (, trace, debug, info, warning, error, critical, off)
   /memory: print current allocation/heap usage
+  /perf: print accumulated perf-annotation data (if enabled)
+  /perf/clear (POST): clear accumulated perf-annotation data
   /quitquitquit (POST): exit the server
   /ready: print server state, return 200 if LIVE, otherwise return 503
   /reopen_logs (POST): reopen access logs
@@ -240,5 +240,41 @@ fake_cluster::1.2.3.4:80::local_origin_success_rate::93.2
   EXPECT_EQ(expected_text, response2.toString());
 }
 
+// Verifies that the streaming implementation emits one cluster per chunk and
+// that the concatenated chunks are identical to the fully-buffered response.
+TEST_P(AdminInstanceTest, ClustersStreamsChunks) {
+  Upstream::ClusterManager::ClusterInfoMaps cluster_maps;
+  ON_CALL(server_.cluster_manager_, clusters()).WillByDefault(ReturnPointee(&cluster_maps));
+
+  NiceMock<Upstream::MockClusterMockPrioritySet> cluster1;
+  cluster_maps.active_clusters_.emplace(cluster1.info_->name_, cluster1);
+  NiceMock<Upstream::MockClusterMockPrioritySet> cluster2;
+  cluster2.info_->name_ = "fake_cluster_2";
+  cluster_maps.active_clusters_.emplace(cluster2.info_->name_, cluster2);
+
+  for (const bool json : {false, true}) {
+    Http::TestResponseHeaderMapImpl header_map;
+    Buffer::OwnedImpl reference;
+    EXPECT_EQ(Http::Code::OK,
+              getCallback(json ? "/clusters?format=json" : "/clusters", header_map, reference));
+
+    // A one-byte chunk size forces one cluster per chunk.
+    ClustersRequest request(server_, json);
+    request.setChunkSize(1);
+    EXPECT_EQ(Http::Code::OK, request.start(header_map));
+    Buffer::OwnedImpl chunked;
+    uint32_t num_chunks = 0;
+    bool more = true;
+    while (more) {
+      Buffer::OwnedImpl chunk;
+      more = request.nextChunk(chunk);
+      chunked.move(chunk);
+      ++num_chunks;
+    }
+    EXPECT_EQ(2U, num_chunks);
+    EXPECT_EQ(reference.toString(), chunked.toString());
+  }
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -1,3 +1,5 @@
+#include "source/common/common/matchers.h"
+
 #include "test/integration/filters/test_listener_filter.pb.h"
 #include "test/server/admin/admin_instance.h"
 
@@ -858,5 +860,43 @@ TEST_P(AdminInstanceTest, ConfigDumpEcdsByResourceAndMask) {
   EXPECT_EQ(expected_json, output);
 }
 
+// Verifies that the streaming implementation emits one config resource per
+// chunk and that the concatenated chunks are identical to the fully-buffered
+// response.
+TEST_P(AdminInstanceTest, ConfigDumpStreamsChunks) {
+  auto foo = admin_.getConfigTracker().add("foo", [](const Matchers::StringMatcher&) {
+    auto msg = std::make_unique<ProtobufWkt::StringValue>();
+    msg->set_value("bar");
+    return msg;
+  });
+  auto baz = admin_.getConfigTracker().add("baz", [](const Matchers::StringMatcher&) {
+    auto msg = std::make_unique<ProtobufWkt::StringValue>();
+    msg->set_value("quux");
+    return msg;
+  });
+
+  Http::TestResponseHeaderMapImpl header_map;
+  Buffer::OwnedImpl reference;
+  EXPECT_EQ(Http::Code::OK, getCallback("/config_dump", header_map, reference));
+
+  // A one-byte chunk size forces one config resource per chunk.
+  ConfigDumpHandler handler(admin_.getConfigTracker(), server_);
+  ConfigDumpRequest request(handler, absl::nullopt, absl::nullopt,
+                            std::make_unique<Matchers::UniversalStringMatcher>(), false);
+  request.setChunkSize(1);
+  EXPECT_EQ(Http::Code::OK, request.start(header_map));
+  Buffer::OwnedImpl chunked;
+  uint32_t num_chunks = 0;
+  bool more = true;
+  while (more) {
+    Buffer::OwnedImpl chunk;
+    more = request.nextChunk(chunk);
+    chunked.move(chunk);
+    ++num_chunks;
+  }
+  EXPECT_EQ(2U, num_chunks);
+  EXPECT_EQ(reference.toString(), chunked.toString());
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -88,5 +88,18 @@ TEST_P(AdminInstanceTest, AdminHeapDump) {
 #endif
 }
 
+TEST_P(AdminInstanceTest, AdminPerfAnnotation) {
+  Buffer::OwnedImpl data;
+  Http::TestResponseHeaderMapImpl header_map;
+
+#ifdef ENVOY_PERF_ANNOTATION
+  EXPECT_EQ(Http::Code::OK, getCallback("/perf", header_map, data));
+  EXPECT_EQ(Http::Code::OK, postCallback("/perf/clear", header_map, data));
+#else
+  EXPECT_EQ(Http::Code::NotImplemented, getCallback("/perf", header_map, data));
+  EXPECT_EQ(Http::Code::NotImplemented, postCallback("/perf/clear", header_map, data));
+#endif
+}
+
 } // namespace Server
 } // namespace Envoy
@@ -0,0 +1,181 @@
+#include <memory>
+
+#include "source/common/buffer/buffer_impl.h"
+#include "source/common/stats/custom_stat_namespaces_impl.h"
+#include "source/common/stats/thread_local_store.h"
+#include "source/server/admin/prometheus_stats.h"
+#include "source/server/admin/prometheus_stats_request.h"
+
+#include "test/mocks/event/mocks.h"
+#include "test/mocks/stats/mocks.h"
+#include "test/mocks/thread_local/mocks.h"
+#include "test/test_common/utility.h"
+
+#include "gtest/gtest.h"
+
+using testing::HasSubstr;
+using testing::NiceMock;
+using testing::Not;
+using testing::StartsWith;
+
+namespace Envoy {
+namespace Server {
+
+class PrometheusStatsRequestTest : public testing::Test {
+protected:
+  PrometheusStatsRequestTest() : pool_(symbol_table_), alloc_(symbol_table_), store_(alloc_) {
+    store_.addSink(sink_);
+    store_.initializeThreading(main_thread_dispatcher_, tls_);
+  }
+
+  ~PrometheusStatsRequestTest() override {
+    tls_.shutdownGlobalThreading();
+    store_.shutdownThreading();
+    tls_.shutdownThread();
+  }
+
+  std::unique_ptr<PrometheusStatsRequest> makeRequest(const StatsParams& params) {
+    return std::make_unique<PrometheusStatsRequest>(store_, params, custom_namespaces_);
+  }
+
+  // Executes a request, counting the chunks that were generated.
+  uint32_t iterateChunks(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    uint32_t num_chunks = 0;
+    bool more = true;
+    do {
+      more = request.nextChunk(data);
+      uint64_t size = data.length();
+      if (size > 0) {
+        ++num_chunks;
+        data.drain(size);
+      }
+    } while (more);
+    return num_chunks;
+  }
+
+  // Executes a request, returning the rendered buffer as a string.
+  std::string response(PrometheusStatsRequest& request) {
+    Http::TestResponseHeaderMapImpl response_headers;
+    Http::Code code = request.start(response_headers);
+    EXPECT_EQ(Http::Code::OK, code);
+    Buffer::OwnedImpl data;
+    while (request.nextChunk(data)) {
+    }
+    return data.toString();
+  }
+
+  // Renders the same stats through the fully buffered formatter, to verify
+  // that chunking does not change the output.
+  std::string bufferedResponse(const StatsParams& params) {
+    Buffer::OwnedImpl response;
+    const std::vector<Stats::TextReadoutSharedPtr>& text_readouts =
+        params.prometheus_text_readouts_ ? store_.textReadouts()
+                                         : std::vector<Stats::TextReadoutSharedPtr>();
+    PrometheusStatsFormatter::statsAsPrometheus(store_.counters(), store_.gauges(),
+                                                store_.histograms(), text_readouts, response,
+                                                params, custom_namespaces_);
+    return response.toString();
+  }
+
+  Stats::StatName makeStatName(absl::string_view name) { return pool_.add(name); }
+
+  void createTestStats() {
+    Stats::StatNameTagVector c1_tags{{makeStatName("cluster"), makeStatName("c1")}};
+    Stats::StatNameTagVector c2_tags{{makeStatName("cluster"), makeStatName("c2")}};
+    store_.rootScope()
+        ->counterFromStatNameWithTags(makeStatName("cluster.upstream.cx.total"), c1_tags)
+        .add(10);
+    store_.rootScope()
+        ->counterFromStatNameWithTags(makeStatName("cluster.upstream.cx.total"), c2_tags)
+        .add(20);
+    store_.rootScope()
+        ->gaugeFromStatNameWithTags(makeStatName("cluster.upstream.cx.active"), c1_tags,
+                                    Stats::Gauge::ImportMode::Accumulate)
+        .set(11);
+    store_.rootScope()
+        ->textReadoutFromStatNameWithTags(makeStatName("control_plane.identifier"), c1_tags)
+        .set("cp-1");
+    store_.rootScope()->histogramFromStatNameWithTags(
+        makeStatName("cluster.upstream.rq.time"), c1_tags, Stats::Histogram::Unit::Milliseconds);
+  }
+
+  Stats::SymbolTableImpl symbol_table_;
+  Stats::StatNamePool pool_;
+  Stats::AllocatorImpl alloc_;
+  NiceMock<Stats::MockSink> sink_;
+  NiceMock<Event::MockDispatcher> main_thread_dispatcher_;
+  NiceMock<ThreadLocal::MockInstance> tls_;
+  Stats::ThreadLocalStoreImpl store_;
+  Stats::CustomStatNamespacesImpl custom_namespaces_;
+};
+
+TEST_F(PrometheusStatsRequestTest, Empty) {
+  StatsParams params;
+  EXPECT_EQ(0, iterateChunks(*makeRequest(params)));
+}
+
+TEST_F(PrometheusStatsRequestTest, OneCounter) {
+  Stats::StatNameTagVector tags{{makeStatName("a"), makeStatName("b")}};
+  store_.rootScope()->counterFromStatNameWithTags(makeStatName("foo.bar"), tags).inc();
+  StatsParams params;
+  EXPECT_EQ("# TYPE envoy_foo_bar counter\nenvoy_foo_bar{a=\"b\"} 1\n",
+            response(*makeRequest(params)));
+}
+
+TEST_F(PrometheusStatsRequestTest, GroupsSeriesUnderOneTypeLine) {
+  createTestStats();
+  StatsParams params;
+  const std::string out = response(*makeRequest(params));
+
+  // Both counter series share one metric-family header.
+  const std::string type_line = "# TYPE envoy_cluster_upstream_cx_total counter\n";
+  EXPECT_EQ(out.find(type_line), out.rfind(type_line));
+  EXPECT_THAT(out, HasSubstr("envoy_cluster_upstream_cx_total{cluster=\"c1\"} 10\n"
+                             "envoy_cluster_upstream_cx_total{cluster=\"c2\"} 20\n"));
+}
+
+TEST_F(PrometheusStatsRequestTest, MatchesBufferedOutput) {
+  createTestStats();
+  for (const bool text_readouts : {false, true}) {
+    StatsParams params;
+    params.prometheus_text_readouts_ = text_readouts;
+    EXPECT_EQ(bufferedResponse(params), response(*makeRequest(params)));
+  }
+}
+
+TEST_F(PrometheusStatsRequestTest, UsedOnly) {
+  createTestStats();
+  store_.rootScope()->counterFromStatName(makeStatName("never.incremented"));
+  StatsParams params;
+  params.used_only_ = true;
+  EXPECT_THAT(response(*makeRequest(params)), Not(HasSubstr("never_incremented")));
+  EXPECT_EQ(bufferedResponse(params), response(*makeRequest(params)));
+}
+
+TEST_F(PrometheusStatsRequestTest, Filter) {
+  createTestStats();
+  StatsParams params;
+  Buffer::OwnedImpl response_buffer;
+  ASSERT_EQ(Http::Code::OK, params.parse("?filter=cx.total", response_buffer));
+  const std::string out = response(*makeRequest(params));
+  EXPECT_THAT(out, HasSubstr("envoy_cluster_upstream_cx_total"));
+  EXPECT_THAT(out, Not(HasSubstr("envoy_cluster_upstream_cx_active")));
+  EXPECT_EQ(bufferedResponse(params), out);
+}
+
+TEST_F(PrometheusStatsRequestTest, ManyStatsSmallChunkSize) {
+  for (uint32_t i = 0; i < 100; ++i) {
+    store_.rootScope()->counterFromStatName(makeStatName(absl::StrCat("foo", i)));
+  }
+  StatsParams params;
+  std::unique_ptr<PrometheusStatsRequest> request = makeRequest(params);
+  request->setChunkSize(100);
+  EXPECT_LT(1, iterateChunks(*request));
+}
+
+} // namespace Server
+} // namespace Envoy
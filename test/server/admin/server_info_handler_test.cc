@@ -62,6 +62,15 @@ TEST_P(AdminInstanceTest, Memory) {
                                   Property(&envoy::admin::v3::Memory::total_thread_cache, Ge(0))));
 }
 
+TEST_P(AdminInstanceTest, MemoryDetail) {
+  Http::TestResponseHeaderMapImpl header_map;
+  Buffer::OwnedImpl response;
+  // The exact output depends on which allocator Envoy is built with; just verify
+  // that the parameter is accepted and something is printed.
+  EXPECT_EQ(Http::Code::OK, getCallback("/memory?detail", header_map, response));
+  EXPECT_FALSE(response.toString().empty());
+}
+
 TEST_P(AdminInstanceTest, GetReadyRequest) {
   NiceMock<Init::MockManager> initManager;
   ON_CALL(server_, initManager()).WillByDefault(ReturnRef(initManager));
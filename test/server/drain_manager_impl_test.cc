@@ -159,6 +159,40 @@ TEST_P(DrainManagerImplTest, DrainDeadlineProbability) {
   }
 }
 
+TEST_F(DrainManagerImplTest, DrainClosePacedByTokenBucket) {
+  ON_CALL(server_.options_, drainStrategy()).WillByDefault(Return(Server::DrainStrategy::Gradual));
+  ON_CALL(server_.options_, drainTime()).WillByDefault(Return(std::chrono::seconds(5)));
+  ON_CALL(server_.listener_manager_, numConnections()).WillByDefault(Return(10));
+  // Make the probabilistic selection always pass once any time has elapsed so that only the
+  // token bucket gates drain-close decisions.
+  ON_CALL(server_.api_.random_, random()).WillByDefault(Return(0));
+  EXPECT_CALL(server_, healthCheckFailed()).WillRepeatedly(Return(false));
+
+  DrainManagerImpl drain_manager(server_, envoy::config::listener::v3::Listener::DEFAULT,
+                                 server_.dispatcher());
+  drain_manager.startDrainSequence([] {});
+
+  // 10 connections over a 5 second window -> 2 drain closes per second.
+  simTime().advanceTimeWait(std::chrono::seconds(1));
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_FALSE(drain_manager.drainClose());
+  EXPECT_EQ(2, server_.stats_store_.counter("drain.drain_close_granted").value());
+  EXPECT_EQ(1, server_.stats_store_.counter("drain.drain_close_deferred").value());
+
+  // The bucket refills as the window progresses.
+  simTime().advanceTimeWait(std::chrono::seconds(1));
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_FALSE(drain_manager.drainClose());
+
+  // Past the drain deadline pacing no longer applies.
+  simTime().advanceTimeWait(std::chrono::seconds(10));
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_TRUE(drain_manager.drainClose());
+  EXPECT_TRUE(drain_manager.drainClose());
+}
+
 TEST_P(DrainManagerImplTest, OnDrainCallbacks) {
   constexpr int num_cbs = 20;
   const bool drain_gradually = GetParam();
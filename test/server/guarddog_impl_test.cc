@@ -307,6 +307,30 @@ TEST_P(GuardDogMissTest, MissTest) {
   unpet_dog = nullptr;
 }
 
+TEST_P(GuardDogMissTest, StalenessHistogramTest) {
+  // The exact recorded values require simulated time.
+  if (GetParam() == TimeSystemType::Real) {
+    return;
+  }
+
+  // Staleness is recorded on every step in which the watchdog has not been
+  // touched, including steps that don't reach the miss timeout.
+  initGuardDog(stats_store_, config_miss_);
+  auto unpet_dog = guard_dog_->createWatchDog(api_->threadFactory().currentThreadId(),
+                                              "test_thread", mock_dispatcher_);
+  guard_dog_->forceCheckForTest();
+  time_system_->advanceTimeWait(std::chrono::milliseconds(300));
+  guard_dog_->forceCheckForTest();
+  time_system_->advanceTimeWait(std::chrono::milliseconds(250));
+  guard_dog_->forceCheckForTest();
+  EXPECT_EQ((std::vector<uint64_t>{300, 550}),
+            stats_store_.histogramValues("server.test_thread.watchdog_touch_staleness_ms", false));
+  EXPECT_EQ((std::vector<uint64_t>{300, 550}),
+            stats_store_.histogramValues("server.watchdog_touch_staleness_ms", false));
+  guard_dog_->stopWatching(unpet_dog);
+  unpet_dog = nullptr;
+}
+
 TEST_P(GuardDogMissTest, MegaMissTest) {
   // TODO(#6465): This test fails in real-time 1/1000 times, but passes in simulated time.
   if (GetParam() == TimeSystemType::Real) {
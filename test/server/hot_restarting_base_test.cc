@@ -3,6 +3,7 @@
 #include "test/mocks/api/mocks.h"
 #include "test/mocks/network/mocks.h"
 #include "test/test_common/threadsafe_singleton_injector.h"
+#include "test/test_common/utility.h"
 
 #include "gtest/gtest.h"
 
@@ -20,6 +21,15 @@ public:
   void sendMessage(sockaddr_un& address, const envoy::HotRestartMessage& message) {
     sendHotRestartMessage(address, message);
   }
+  void sendStatsReply(sockaddr_un& address, const envoy::HotRestartMessage& message) {
+    sendHotRestartStatsReply(address, message);
+  }
+  std::unique_ptr<envoy::HotRestartMessage> receiveStatsReply() {
+    return resolveSharedMemoryStatsReply(receiveHotRestartMessage(Blocking::Yes));
+  }
+  sockaddr_un myAddress(const std::string& socket_path) {
+    return createDomainSocketAddress(1, "parent", socket_path, 0644);
+  }
 };
 
 class HotRestartingBaseTest : public testing::Test {
@@ -80,6 +90,43 @@ TEST_F(HotRestartingBaseTest, SendMsgRetrySucceedsEventually) {
   EXPECT_TRUE(retried);
 }
 
+TEST_F(HotRestartingBaseTest, SmallStatsReplySentInline) {
+  const std::string receiver_path = "/tmp/hot_restart_stats_dst_small";
+  MockHotRestartingBase receiver(receiver_path);
+  sockaddr_un receiver_address = receiver.myAddress(receiver_path);
+
+  HotRestartMessage reply;
+  (*reply.mutable_reply()->mutable_stats()->mutable_counter_deltas())["cluster.upstream_rq_total"] =
+      42;
+  base_.sendStatsReply(receiver_address, reply);
+
+  std::unique_ptr<HotRestartMessage> received = receiver.receiveStatsReply();
+  ASSERT_NE(received, nullptr);
+  ASSERT_EQ(received->reply().reply_case(), HotRestartMessage::Reply::kStats);
+  EXPECT_TRUE(TestUtility::protoEqual(reply.reply().stats(), received->reply().stats()));
+}
+
+TEST_F(HotRestartingBaseTest, LargeStatsReplyTransfersViaSharedMemory) {
+  const std::string receiver_path = "/tmp/hot_restart_stats_dst_large";
+  MockHotRestartingBase receiver(receiver_path);
+  sockaddr_un receiver_address = receiver.myAddress(receiver_path);
+
+  // Build a stats reply much larger than a single 4096 byte sendmsg datagram, so that the
+  // transfer takes the shared memory path.
+  HotRestartMessage reply;
+  auto& counter_deltas = *reply.mutable_reply()->mutable_stats()->mutable_counter_deltas();
+  for (int i = 0; i < 2000; ++i) {
+    counter_deltas[absl::StrCat("cluster.some_long_cluster_name_", i, ".upstream_rq_total")] = i;
+  }
+  ASSERT_GT(reply.ByteSizeLong(), 4096);
+  base_.sendStatsReply(receiver_address, reply);
+
+  std::unique_ptr<HotRestartMessage> received = receiver.receiveStatsReply();
+  ASSERT_NE(received, nullptr);
+  ASSERT_EQ(received->reply().reply_case(), HotRestartMessage::Reply::kStats);
+  EXPECT_TRUE(TestUtility::protoEqual(reply.reply().stats(), received->reply().stats()));
+}
+
 } // namespace
 } // namespace Server
 } // namespace Envoy
@@ -406,6 +406,78 @@ TEST_F(OverloadManagerImplTest, CallbackOnlyFiresWhenStateChanges) {
   manager->stop();
 }
 
+TEST_F(OverloadManagerImplTest, ThresholdTriggerHysteresis) {
+  setDispatcherExpectation();
+
+  const std::string config = R"EOF(
+    refresh_interval:
+      seconds: 1
+    resource_monitors:
+      - name: envoy.resource_monitors.fake_resource1
+    actions:
+      - name: envoy.overload_actions.dummy_action
+        triggers:
+          - name: envoy.resource_monitors.fake_resource1
+            threshold:
+              value: 0.8
+              hysteresis: 0.1
+  )EOF";
+
+  auto manager(createOverloadManager(config));
+  int cb_count = 0;
+  manager->registerForAction("envoy.overload_actions.dummy_action", dispatcher_,
+                             [&](OverloadActionState) { cb_count++; });
+  manager->start();
+  const auto& action_state =
+      manager->getThreadLocalOverloadState().getState("envoy.overload_actions.dummy_action");
+
+  // Crossing the threshold saturates the action.
+  factory1_.monitor_->setPressure(0.85);
+  timer_cb_();
+  EXPECT_TRUE(action_state.isSaturated());
+  EXPECT_EQ(1, cb_count);
+
+  // Dropping below the threshold but staying within the hysteresis band keeps the action
+  // saturated, so no state change is posted.
+  factory1_.monitor_->setPressure(0.75);
+  timer_cb_();
+  EXPECT_TRUE(action_state.isSaturated());
+  EXPECT_EQ(1, cb_count);
+
+  // Only dropping below threshold - hysteresis deactivates the action.
+  factory1_.monitor_->setPressure(0.65);
+  timer_cb_();
+  EXPECT_FALSE(action_state.isSaturated());
+  EXPECT_EQ(2, cb_count);
+
+  // Re-entering the hysteresis band from below does not reactivate the action.
+  factory1_.monitor_->setPressure(0.75);
+  timer_cb_();
+  EXPECT_FALSE(action_state.isSaturated());
+  EXPECT_EQ(2, cb_count);
+
+  manager->stop();
+}
+
+TEST_F(OverloadManagerImplTest, ThresholdTriggerHysteresisLargerThanThreshold) {
+  const std::string config = R"EOF(
+    refresh_interval:
+      seconds: 1
+    resource_monitors:
+      - name: envoy.resource_monitors.fake_resource1
+    actions:
+      - name: envoy.overload_actions.dummy_action
+        triggers:
+          - name: envoy.resource_monitors.fake_resource1
+            threshold:
+              value: 0.5
+              hysteresis: 0.6
+  )EOF";
+
+  EXPECT_THROW_WITH_MESSAGE(createOverloadManager(config), EnvoyException,
+                            "hysteresis must not be greater than the trigger threshold");
+}
+
 TEST_F(OverloadManagerImplTest, ScaledTrigger) {
   setDispatcherExpectation();
 
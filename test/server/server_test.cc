@@ -111,6 +111,64 @@ TEST(ServerInstanceUtil, flushHelper) {
   InstanceUtil::flushMetricsToSinks(sinks, mock_store, time_system);
 }
 
+TEST(ServerInstanceUtil, flushDeltaToSinks) {
+  InSequence s;
+
+  Stats::TestUtil::TestStore store;
+  Event::SimulatedTimeSystem time_system;
+  Stats::Counter& counter = store.counter("hello");
+  counter.inc();
+  Stats::Gauge& gauge = store.gauge("world", Stats::Gauge::ImportMode::Accumulate);
+  gauge.set(5);
+  store.textReadout("text").set("is important");
+
+  std::list<Stats::SinkPtr> sinks;
+  Stats::MockSink* sink = new StrictMock<Stats::MockSink>();
+  sinks.emplace_back(sink);
+
+  // Everything was modified since startup, so a delta flush contains it all.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    ASSERT_EQ(snapshot.changedCounters().size(), 1);
+    EXPECT_EQ(snapshot.changedCounters()[0].delta_, 1);
+    ASSERT_EQ(snapshot.changedGauges().size(), 1);
+    EXPECT_EQ(snapshot.changedGauges()[0].get().name(), "world");
+    ASSERT_EQ(snapshot.changedTextReadouts().size(), 1);
+    EXPECT_EQ(snapshot.changedTextReadouts()[0].get().value(), "is important");
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system, /*full_sync=*/false);
+
+  // Nothing changed since the previous flush: the delta views are empty but
+  // the full views still contain every metric.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.counters().size(), 1);
+    EXPECT_EQ(snapshot.gauges().size(), 1);
+    EXPECT_EQ(snapshot.textReadouts().size(), 1);
+    EXPECT_TRUE(snapshot.changedCounters().empty());
+    EXPECT_TRUE(snapshot.changedGauges().empty());
+    EXPECT_TRUE(snapshot.changedTextReadouts().empty());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system, /*full_sync=*/false);
+
+  // Only the gauge changed, so only it appears in the delta views.
+  gauge.dec();
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_TRUE(snapshot.changedCounters().empty());
+    ASSERT_EQ(snapshot.changedGauges().size(), 1);
+    EXPECT_EQ(snapshot.changedGauges()[0].get().value(), 4);
+    EXPECT_TRUE(snapshot.changedTextReadouts().empty());
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system, /*full_sync=*/false);
+
+  // A full sync includes every metric in the changed views even when idle.
+  EXPECT_CALL(*sink, flush(_)).WillOnce(Invoke([](Stats::MetricSnapshot& snapshot) {
+    EXPECT_EQ(snapshot.changedCounters().size(), 1);
+    EXPECT_EQ(snapshot.changedCounters()[0].delta_, 0);
+    EXPECT_EQ(snapshot.changedGauges().size(), 1);
+    EXPECT_EQ(snapshot.changedTextReadouts().size(), 1);
+  }));
+  InstanceUtil::flushMetricsToSinks(sinks, store, time_system, /*full_sync=*/true);
+}
+
 class RunHelperTest : public testing::Test {
 public:
   RunHelperTest() {
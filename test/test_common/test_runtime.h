@@ -10,6 +10,8 @@
 
 #include "envoy/config/bootstrap/v3/bootstrap.pb.h"
 
+#include "source/common/common/cleanup.h"
+#include "source/common/runtime/runtime_features.h"
 #include "source/common/runtime/runtime_impl.h"
 #include "source/common/stats/isolated_store_impl.h"
 
@@ -54,6 +56,9 @@ public:
   }
 
 protected:
+  // Declared before saver_ so that its destructor runs after saver_ has restored the flag values,
+  // re-synchronizing any CachedRuntimeFeature handles with the restored flags.
+  Cleanup refresh_cached_features_{[]() { Runtime::refreshCachedRuntimeFeatures(); }};
   absl::FlagSaver saver_;
   Event::MockDispatcher dispatcher_;
   testing::NiceMock<ThreadLocal::MockInstance> tls_;